@@ -21,7 +21,7 @@
 
 #include "avx.h"
 
-#define _AVX_VECTOR_SIZE (256 / (8 * sizeof(double)))
+#define _AVX_VECTOR_SIZE (256 / (8 * sizeof(ps_real)))
 
 int AVX_VECTOR_SIZE = _AVX_VECTOR_SIZE;
 
@@ -32,6 +32,8 @@ int AVX_IDX3 = _AVX_VECTOR_SIZE * 3;
 int AVX_VECTOR4_SIZE = _AVX_VECTOR_SIZE * 4;
 int AVX_VECTOR2_SIZE = _AVX_VECTOR_SIZE * 2;
 
+#ifndef PS_USE_FLOAT
+
 // Computes Dot Product between 2 arrays of 2 doubles at time
 
 double avx_dot_product2(double * x, double * y) {
@@ -240,3 +242,696 @@ void avx_diff4(double * x, double * y, double * dest, int mode) {
     }
     _mm256_storeu_pd(dest, xy);
 }
+
+#else
+
+/* Single precision versions of the kernels above: every vector holds 8
+ * floats, so each kernel handles twice as many values as its double
+ * counterpart (ie. avx_dot_product16 consumes 32 floats). */
+
+static inline float avx_hsum_ps(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v),
+                          _mm256_extractf128_ps(v, 1));
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    return _mm_cvtss_f32(s);
+}
+
+static inline __m128 avx_store_mode_ps128(float * dest, __m128 v, int mode) {
+    if (mode == AVX_STORE_MODE_ADD)
+        v = _mm_add_ps(_mm_loadu_ps(dest), v);
+    else if (mode == AVX_STORE_MODE_SUB)
+        v = _mm_sub_ps(_mm_loadu_ps(dest), v);
+    return v;
+}
+
+static inline __m256 avx_store_mode_ps(float * dest, __m256 v, int mode) {
+    if (mode == AVX_STORE_MODE_ADD)
+        v = _mm256_add_ps(_mm256_loadu_ps(dest), v);
+    else if (mode == AVX_STORE_MODE_SUB)
+        v = _mm256_sub_ps(_mm256_loadu_ps(dest), v);
+    return v;
+}
+
+// Computes Dot Product between 2 arrays of 4 floats at time
+
+float avx_dot_product2(float * x, float * y) {
+    __m128 xy = _mm_mul_ps(_mm_loadu_ps(x), _mm_loadu_ps(y));
+    xy = _mm_hadd_ps(xy, xy);
+    xy = _mm_hadd_ps(xy, xy);
+    return _mm_cvtss_f32(xy);
+}
+
+// Computes Dot Product between 2 arrays of 8 floats at time
+
+float avx_dot_product4(float * x, float * y) {
+    return avx_hsum_ps(_mm256_mul_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y)));
+}
+
+// Computes Dot Product between 2 arrays of 16 floats at time
+
+float avx_dot_product8(float * x, float * y) {
+    __m256 xy = _mm256_mul_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y));
+    xy = _mm256_fmadd_ps(_mm256_loadu_ps(x + AVX_IDX1),
+                         _mm256_loadu_ps(y + AVX_IDX1), xy);
+    return avx_hsum_ps(xy);
+}
+
+// Computes Dot Product between 2 arrays of 32 floats at time
+
+float avx_dot_product16(float * x, float * y) {
+    __m256 xy0 = _mm256_mul_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y));
+    __m256 xy1 = _mm256_mul_ps(_mm256_loadu_ps(x + AVX_IDX1),
+                               _mm256_loadu_ps(y + AVX_IDX1));
+    xy0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + AVX_IDX2),
+                          _mm256_loadu_ps(y + AVX_IDX2), xy0);
+    xy1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + AVX_IDX3),
+                          _mm256_loadu_ps(y + AVX_IDX3), xy1);
+    return avx_hsum_ps(_mm256_add_ps(xy0, xy1));
+}
+
+// Muliply 1 array of 4 floats at time with a single value
+
+void avx_multiply_value2(float * x, float value, float * dest, int mode) {
+    __m128 xy = _mm_mul_ps(_mm_loadu_ps(x), _mm_set1_ps(value));
+    _mm_storeu_ps(dest, avx_store_mode_ps128(dest, xy, mode));
+}
+
+// Muliply 2 arrays of 4 floats at time
+
+void avx_multiply2(float * x, float * y, float * dest, int mode) {
+    __m128 xy = _mm_mul_ps(_mm_loadu_ps(x), _mm_loadu_ps(y));
+    _mm_storeu_ps(dest, avx_store_mode_ps128(dest, xy, mode));
+}
+
+// Muliply 1 array of 8 floats at time with a single value
+
+void avx_multiply_value4(float * x, float value, float * dest, int mode) {
+    __m256 xy = _mm256_mul_ps(_mm256_loadu_ps(x), _mm256_set1_ps(value));
+    _mm256_storeu_ps(dest, avx_store_mode_ps(dest, xy, mode));
+}
+
+// Muliply 2 arrays of 8 floats at time
+
+void avx_multiply4(float * x, float * y, float * dest, int mode) {
+    __m256 xy = _mm256_mul_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y));
+    _mm256_storeu_ps(dest, avx_store_mode_ps(dest, xy, mode));
+}
+
+// Sum 2 arrays of 4 floats at time
+
+void avx_sum2(float * x, float * y, float * dest, int mode) {
+    __m128 xy = _mm_add_ps(_mm_loadu_ps(x), _mm_loadu_ps(y));
+    _mm_storeu_ps(dest, avx_store_mode_ps128(dest, xy, mode));
+}
+
+// Sum 2 arrays of 8 floats at time
+
+void avx_sum4(float * x, float * y, float * dest, int mode) {
+    __m256 xy = _mm256_add_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y));
+    _mm256_storeu_ps(dest, avx_store_mode_ps(dest, xy, mode));
+}
+
+// Subtract 2 arrays of 4 floats at time
+
+void avx_diff2(float * x, float * y, float * dest, int mode) {
+    __m128 xy = _mm_sub_ps(_mm_loadu_ps(x), _mm_loadu_ps(y));
+    _mm_storeu_ps(dest, avx_store_mode_ps128(dest, xy, mode));
+}
+
+// Subtract 2 arrays of 8 floats at time
+
+void avx_diff4(float * x, float * y, float * dest, int mode) {
+    __m256 xy = _mm256_sub_ps(_mm256_loadu_ps(x), _mm256_loadu_ps(y));
+    _mm256_storeu_ps(dest, avx_store_mode_ps(dest, xy, mode));
+}
+
+#endif
+
+/* GEMM
+ *
+ * All the matrices are row-major. The kernels compute a tile of the output
+ * per pass, keeping its partial sums in FMA accumulators until the whole
+ * depth of the current block has been consumed. Row, column and depth
+ * remainders are handled through masked loads and stores, so there is
+ * no scalar tail loop. */
+
+// Depth (K) and width (N) of the blocks kept in cache while the rows of A
+// are streamed against them.
+#define GEMM_KC 256
+#define GEMM_NC 64
+
+#define GEMM_VECTOR_SIZE ((int) _AVX_VECTOR_SIZE)
+#define GEMM_IDX1 GEMM_VECTOR_SIZE
+#define GEMM_IDX2 (GEMM_VECTOR_SIZE * 2)
+#define GEMM_IDX3 (GEMM_VECTOR_SIZE * 3)
+
+// Register tile sizes
+#define GEMM_NT_MR 2
+#define GEMM_NT_NR 4
+#define GEMM_NN_MR 2
+#define GEMM_NN_NR (4 * GEMM_VECTOR_SIZE)
+
+#define GEMM_MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* Precision dependent vector types and operations: avx_vec is a full AVX
+ * vector (4 doubles or 8 floats), while avx_vec4 always holds 4 values, so
+ * that 4 dot products or 4 interleaved tiles fit into it. */
+
+#ifdef PS_USE_FLOAT
+
+typedef __m256 avx_vec;
+typedef __m128 avx_vec4;
+typedef __m128i avx_mask4;
+
+#define avx_loadu       _mm256_loadu_ps
+#define avx_setzero     _mm256_setzero_ps
+#define avx_broadcast   _mm256_broadcast_ss
+#define avx_add         _mm256_add_ps
+#define avx_sub         _mm256_sub_ps
+#define avx_fmadd       _mm256_fmadd_ps
+#define avx_maskload    _mm256_maskload_ps
+#define avx_maskstore   _mm256_maskstore_ps
+
+#define avx4_loadu      _mm_loadu_ps
+#define avx4_storeu     _mm_storeu_ps
+#define avx4_set1       _mm_set1_ps
+#define avx4_add        _mm_add_ps
+#define avx4_sub        _mm_sub_ps
+#define avx4_mul        _mm_mul_ps
+#define avx4_fmadd      _mm_fmadd_ps
+#define avx4_fnmadd     _mm_fnmadd_ps
+#define avx4_maskload   _mm_maskload_ps
+#define avx4_maskstore  _mm_maskstore_ps
+#define avx4_load_mask(m) _mm_loadu_si128((__m128i *) (m))
+
+static const int avx_tail_masks[16] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#else
+
+typedef __m256d avx_vec;
+typedef __m256d avx_vec4;
+typedef __m256i avx_mask4;
+
+#define avx_loadu       _mm256_loadu_pd
+#define avx_setzero     _mm256_setzero_pd
+#define avx_broadcast   _mm256_broadcast_sd
+#define avx_add         _mm256_add_pd
+#define avx_sub         _mm256_sub_pd
+#define avx_fmadd       _mm256_fmadd_pd
+#define avx_maskload    _mm256_maskload_pd
+#define avx_maskstore   _mm256_maskstore_pd
+
+#define avx4_loadu      _mm256_loadu_pd
+#define avx4_storeu     _mm256_storeu_pd
+#define avx4_set1       _mm256_set1_pd
+#define avx4_add        _mm256_add_pd
+#define avx4_sub        _mm256_sub_pd
+#define avx4_mul        _mm256_mul_pd
+#define avx4_fmadd      _mm256_fmadd_pd
+#define avx4_fnmadd     _mm256_fnmadd_pd
+#define avx4_maskload   _mm256_maskload_pd
+#define avx4_maskstore  _mm256_maskstore_pd
+#define avx4_load_mask(m) _mm256_loadu_si256((__m256i *) (m))
+
+static const long long avx_tail_masks[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+
+#endif
+
+// Mask enabling the first 'count' (clamped to [0, GEMM_VECTOR_SIZE]) lanes
+// of a vector
+
+static inline __m256i avx_tail_mask(int count) {
+    if (count <= 0) count = 0;
+    else if (count > GEMM_VECTOR_SIZE) count = GEMM_VECTOR_SIZE;
+    return _mm256_loadu_si256((__m256i *) (avx_tail_masks +
+                                           GEMM_VECTOR_SIZE - count));
+}
+
+// Same as above, for the 4 lanes of an avx_vec4
+
+static inline avx_mask4 avx_tail_mask4(int count) {
+    if (count <= 0) count = 0;
+    else if (count > 4) count = 4;
+    return avx4_load_mask(avx_tail_masks + GEMM_VECTOR_SIZE - count);
+}
+
+// Returns the horizontal sums of 4 vectors packed into a single vector
+
+static inline avx_vec4 avx_hsum4(avx_vec v0, avx_vec v1, avx_vec v2,
+                                 avx_vec v3)
+{
+#ifdef PS_USE_FLOAT
+    // Every 128-bit lane holds the partial sums of the 4 vectors
+    __m256 s = _mm256_hadd_ps(_mm256_hadd_ps(v0, v1),
+                              _mm256_hadd_ps(v2, v3));
+    return _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+#else
+    avx_vec s01 = _mm256_hadd_pd(v0, v1);
+    avx_vec s23 = _mm256_hadd_pd(v2, v3);
+    avx_vec lo = _mm256_permute2f128_pd(s01, s23, 0x20);
+    avx_vec hi = _mm256_permute2f128_pd(s01, s23, 0x31);
+    return avx_add(lo, hi);
+#endif
+}
+
+static inline void avx_store_tile(ps_real * c, avx_vec v, __m256i mask,
+                                  int mode)
+{
+    if (mode == AVX_STORE_MODE_ADD)
+        v = avx_add(avx_maskload(c, mask), v);
+    else if (mode == AVX_STORE_MODE_SUB)
+        v = avx_sub(avx_maskload(c, mask), v);
+    avx_maskstore(c, mask, v);
+}
+
+static inline void avx_store_tile4(ps_real * c, avx_vec4 v, avx_mask4 mask,
+                                   int mode)
+{
+    if (mode == AVX_STORE_MODE_ADD)
+        v = avx4_add(avx4_maskload(c, mask), v);
+    else if (mode == AVX_STORE_MODE_SUB)
+        v = avx4_sub(avx4_maskload(c, mask), v);
+    avx4_maskstore(c, mask, v);
+}
+
+/* Computes a (mr x nr) tile of C = A * B^T, with mr <= 2 and nr <= 4:
+ * every output is the dot product between a row of A and a row of B, so the
+ * accumulators are reduced only once, when the tile is complete. */
+
+static inline __attribute__((always_inline))
+void avx_gemm_nt_tile(const int mr, int nr, int k, ps_real * a, int lda,
+                      ps_real * b, int ldb, ps_real * c, int ldc, int mode)
+{
+    ps_real * a0 = a, * a1 = a + (mr > 1 ? lda : 0);
+    ps_real * b0 = b;
+    ps_real * b1 = b + (nr > 1 ? ldb : 0);
+    ps_real * b2 = b + (nr > 2 ? 2 * ldb : 0);
+    ps_real * b3 = b + (nr > 3 ? 3 * ldb : 0);
+    avx_vec c00 = avx_setzero(), c01 = avx_setzero(),
+            c02 = avx_setzero(), c03 = avx_setzero(),
+            c10 = avx_setzero(), c11 = avx_setzero(),
+            c12 = avx_setzero(), c13 = avx_setzero();
+    avx_vec va0, va1, vb;
+    int p = 0;
+    for (; p <= k - GEMM_VECTOR_SIZE; p += GEMM_VECTOR_SIZE) {
+        va0 = avx_loadu(a0 + p);
+        if (mr > 1) va1 = avx_loadu(a1 + p);
+        vb = avx_loadu(b0 + p);
+        c00 = avx_fmadd(va0, vb, c00);
+        if (mr > 1) c10 = avx_fmadd(va1, vb, c10);
+        vb = avx_loadu(b1 + p);
+        c01 = avx_fmadd(va0, vb, c01);
+        if (mr > 1) c11 = avx_fmadd(va1, vb, c11);
+        vb = avx_loadu(b2 + p);
+        c02 = avx_fmadd(va0, vb, c02);
+        if (mr > 1) c12 = avx_fmadd(va1, vb, c12);
+        vb = avx_loadu(b3 + p);
+        c03 = avx_fmadd(va0, vb, c03);
+        if (mr > 1) c13 = avx_fmadd(va1, vb, c13);
+    }
+    if (p < k) {
+        __m256i kmask = avx_tail_mask(k - p);
+        va0 = avx_maskload(a0 + p, kmask);
+        if (mr > 1) va1 = avx_maskload(a1 + p, kmask);
+        vb = avx_maskload(b0 + p, kmask);
+        c00 = avx_fmadd(va0, vb, c00);
+        if (mr > 1) c10 = avx_fmadd(va1, vb, c10);
+        vb = avx_maskload(b1 + p, kmask);
+        c01 = avx_fmadd(va0, vb, c01);
+        if (mr > 1) c11 = avx_fmadd(va1, vb, c11);
+        vb = avx_maskload(b2 + p, kmask);
+        c02 = avx_fmadd(va0, vb, c02);
+        if (mr > 1) c12 = avx_fmadd(va1, vb, c12);
+        vb = avx_maskload(b3 + p, kmask);
+        c03 = avx_fmadd(va0, vb, c03);
+        if (mr > 1) c13 = avx_fmadd(va1, vb, c13);
+    }
+    avx_mask4 cmask = avx_tail_mask4(nr);
+    avx_store_tile4(c, avx_hsum4(c00, c01, c02, c03), cmask, mode);
+    if (mr > 1)
+        avx_store_tile4(c + ldc, avx_hsum4(c10, c11, c12, c13), cmask, mode);
+}
+
+void avx_gemm_nt(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode)
+{
+    int i, j, pb, jb;
+    for (pb = 0; pb < k; pb += GEMM_KC) {
+        int kc = GEMM_MIN(GEMM_KC, k - pb);
+        // Blocks following the first one accumulate onto the partial sums
+        int kmode = mode;
+        if (pb > 0 && mode == AVX_STORE_MODE_NORM) kmode = AVX_STORE_MODE_ADD;
+        for (jb = 0; jb < n; jb += GEMM_NC) {
+            int max_j = GEMM_MIN(jb + GEMM_NC, n);
+            for (i = 0; i < m; i += GEMM_NT_MR) {
+                ps_real * a_row = a + (i * lda) + pb;
+                ps_real * c_row = c + (i * ldc);
+                for (j = jb; j < max_j; j += GEMM_NT_NR) {
+                    int nr = GEMM_MIN(GEMM_NT_NR, max_j - j);
+                    ps_real * b_row = b + (j * ldb) + pb;
+                    if (m - i > 1)
+                        avx_gemm_nt_tile(2, nr, kc, a_row, lda, b_row, ldb,
+                                         c_row + j, ldc, kmode);
+                    else
+                        avx_gemm_nt_tile(1, nr, kc, a_row, lda, b_row, ldb,
+                                         c_row + j, ldc, kmode);
+                }
+            }
+        }
+    }
+}
+
+/* Computes a (mr x nr) tile of C = A * B, with mr <= 2 and nr <= 16. The
+ * element (i, p) of A is read from a[i * ars + p * acs], so that the same
+ * tile can be used both for A and its transpose. Every row of B is
+ * multiplied by the broadcast A values and added to the accumulators. */
+
+static inline __attribute__((always_inline))
+void avx_gemm_nn_tile(const int mr, int nr, int k, ps_real * a, int ars,
+                      int acs, ps_real * b, int ldb, ps_real * c, int ldc,
+                      int mode)
+{
+    ps_real * a0 = a, * a1 = a + (mr > 1 ? ars : 0);
+    avx_vec c00 = avx_setzero(), c01 = avx_setzero(),
+            c02 = avx_setzero(), c03 = avx_setzero(),
+            c10 = avx_setzero(), c11 = avx_setzero(),
+            c12 = avx_setzero(), c13 = avx_setzero();
+    avx_vec va0, va1, vb0, vb1, vb2, vb3;
+    __m256i m0 = avx_tail_mask(nr), m1 = avx_tail_mask(nr - GEMM_IDX1),
+            m2 = avx_tail_mask(nr - GEMM_IDX2),
+            m3 = avx_tail_mask(nr - GEMM_IDX3);
+    int p, full = (nr == GEMM_NN_NR);
+    for (p = 0; p < k; p++) {
+        ps_real * b_row = b + (p * ldb);
+        if (full) {
+            vb0 = avx_loadu(b_row);
+            vb1 = avx_loadu(b_row + GEMM_IDX1);
+            vb2 = avx_loadu(b_row + GEMM_IDX2);
+            vb3 = avx_loadu(b_row + GEMM_IDX3);
+        } else {
+            vb0 = avx_maskload(b_row, m0);
+            vb1 = avx_maskload(b_row + GEMM_IDX1, m1);
+            vb2 = avx_maskload(b_row + GEMM_IDX2, m2);
+            vb3 = avx_maskload(b_row + GEMM_IDX3, m3);
+        }
+        va0 = avx_broadcast(a0 + (p * acs));
+        c00 = avx_fmadd(va0, vb0, c00);
+        c01 = avx_fmadd(va0, vb1, c01);
+        c02 = avx_fmadd(va0, vb2, c02);
+        c03 = avx_fmadd(va0, vb3, c03);
+        if (mr > 1) {
+            va1 = avx_broadcast(a1 + (p * acs));
+            c10 = avx_fmadd(va1, vb0, c10);
+            c11 = avx_fmadd(va1, vb1, c11);
+            c12 = avx_fmadd(va1, vb2, c12);
+            c13 = avx_fmadd(va1, vb3, c13);
+        }
+    }
+    avx_store_tile(c, c00, m0, mode);
+    avx_store_tile(c + GEMM_IDX1, c01, m1, mode);
+    avx_store_tile(c + GEMM_IDX2, c02, m2, mode);
+    avx_store_tile(c + GEMM_IDX3, c03, m3, mode);
+    if (mr > 1) {
+        c += ldc;
+        avx_store_tile(c, c10, m0, mode);
+        avx_store_tile(c + GEMM_IDX1, c11, m1, mode);
+        avx_store_tile(c + GEMM_IDX2, c12, m2, mode);
+        avx_store_tile(c + GEMM_IDX3, c13, m3, mode);
+    }
+}
+
+static void avx_gemm_nn_generic(int m, int n, int k, ps_real * a, int ars,
+                                int acs, ps_real * b, int ldb, ps_real * c,
+                                int ldc, int mode)
+{
+    int i, j, pb, jb;
+    for (pb = 0; pb < k; pb += GEMM_KC) {
+        int kc = GEMM_MIN(GEMM_KC, k - pb);
+        int kmode = mode;
+        if (pb > 0 && mode == AVX_STORE_MODE_NORM) kmode = AVX_STORE_MODE_ADD;
+        ps_real * b_block = b + (pb * ldb);
+        for (jb = 0; jb < n; jb += GEMM_NC) {
+            int max_j = GEMM_MIN(jb + GEMM_NC, n);
+            for (i = 0; i < m; i += GEMM_NN_MR) {
+                ps_real * a_row = a + (i * ars) + (pb * acs);
+                ps_real * c_row = c + (i * ldc);
+                for (j = jb; j < max_j; j += GEMM_NN_NR) {
+                    int nr = GEMM_MIN(GEMM_NN_NR, max_j - j);
+                    if (m - i > 1)
+                        avx_gemm_nn_tile(2, nr, kc, a_row, ars, acs,
+                                         b_block + j, ldb, c_row + j, ldc,
+                                         kmode);
+                    else
+                        avx_gemm_nn_tile(1, nr, kc, a_row, ars, acs,
+                                         b_block + j, ldb, c_row + j, ldc,
+                                         kmode);
+                }
+            }
+        }
+    }
+}
+
+void avx_gemm_nn(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode)
+{
+    avx_gemm_nn_generic(m, n, k, a, lda, 1, b, ldb, c, ldc, mode);
+}
+
+void avx_gemm_tn(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode)
+{
+    avx_gemm_nn_generic(m, n, k, a, 1, lda, b, ldb, c, ldc, mode);
+}
+
+/* Winograd F(2x2, 3x3) and F(4x4, 3x3) tiles, computed on 4 horizontally
+ * adjacent tiles at once. Tiles are interleaved, so that the element k of
+ * the tile j is at [(k * 4) + j]. Output rows are transposed back, so that
+ * every row of the 4 tiles is stored contiguously. */
+
+static inline void avx_winograd_in2(avx_vec4 * d, int ds, avx_vec4 * v, int vs)
+{
+    v[0] = avx4_sub(d[0], d[2 * ds]);
+    v[vs] = avx4_add(d[ds], d[2 * ds]);
+    v[2 * vs] = avx4_sub(d[2 * ds], d[ds]);
+    v[3 * vs] = avx4_sub(d[ds], d[3 * ds]);
+}
+
+static inline void avx_winograd_out2(avx_vec4 * m, int ms, avx_vec4 * y, int ys)
+{
+    avx_vec4 m1 = m[ms], m2 = m[2 * ms];
+    y[0] = avx4_add(avx4_add(m[0], m1), m2);
+    y[ys] = avx4_sub(avx4_sub(m1, m2), m[3 * ms]);
+}
+
+static inline void avx_winograd_in4(avx_vec4 * d, int ds, avx_vec4 * v, int vs)
+{
+    avx_vec4 four = avx4_set1(4.0), five = avx4_set1(5.0),
+            two = avx4_set1(2.0);
+    avx_vec4 d0 = d[0], d1 = d[ds], d2 = d[2 * ds], d3 = d[3 * ds],
+            d4 = d[4 * ds], d5 = d[5 * ds];
+    avx_vec4 d24 = avx4_sub(d4, d2);
+    v[0] = avx4_fmadd(four, d0, avx4_fnmadd(five, d2, d4));
+    v[vs] = avx4_fnmadd(four, avx4_add(d1, d2),
+                             avx4_add(d3, d4));
+    v[2 * vs] = avx4_fmadd(four, avx4_sub(d1, d2),
+                                avx4_sub(d4, d3));
+    v[3 * vs] = avx4_fmadd(two, avx4_sub(d3, d1), d24);
+    v[4 * vs] = avx4_fmadd(two, avx4_sub(d1, d3), d24);
+    v[5 * vs] = avx4_fmadd(four, d1, avx4_fnmadd(five, d3, d5));
+}
+
+static inline void avx_winograd_out4(avx_vec4 * m, int ms, avx_vec4 * y, int ys)
+{
+    avx_vec4 p12 = avx4_add(m[ms], m[2 * ms]),
+            n12 = avx4_sub(m[ms], m[2 * ms]),
+            p34 = avx4_add(m[3 * ms], m[4 * ms]),
+            n34 = avx4_sub(m[3 * ms], m[4 * ms]);
+    y[0] = avx4_add(avx4_add(m[0], p12), p34);
+    y[ys] = avx4_fmadd(avx4_set1(2.0), n34, n12);
+    y[2 * ys] = avx4_fmadd(avx4_set1(4.0), p34, p12);
+    y[3 * ys] = avx4_add(avx4_fmadd(avx4_set1(8.0), n34, n12),
+                              m[5 * ms]);
+}
+
+void avx_winograd_input2x2(ps_real * d, ps_real * v) {
+    avx_vec4 dv[16], t[16], vv[16];
+    int i;
+    for (i = 0; i < 16; i++) dv[i] = avx4_loadu(d + (i * 4));
+    for (i = 0; i < 4; i++) avx_winograd_in2(dv + i, 4, t + i, 4);
+    for (i = 0; i < 4; i++) avx_winograd_in2(t + (i * 4), 1, vv + (i * 4), 1);
+    for (i = 0; i < 16; i++) avx4_storeu(v + (i * 4), vv[i]);
+}
+
+void avx_winograd_input4x4(ps_real * d, ps_real * v) {
+    avx_vec4 dv[36], t[36], vv[36];
+    int i;
+    for (i = 0; i < 36; i++) dv[i] = avx4_loadu(d + (i * 4));
+    for (i = 0; i < 6; i++) avx_winograd_in4(dv + i, 6, t + i, 6);
+    for (i = 0; i < 6; i++) avx_winograd_in4(t + (i * 6), 1, vv + (i * 6), 1);
+    for (i = 0; i < 36; i++) avx4_storeu(v + (i * 4), vv[i]);
+}
+
+void avx_winograd_output2x2(ps_real * u, ps_real * v, ps_real * y,
+                            int y_stride)
+{
+    avx_vec4 m[16], t[8], yv[4];
+    int i;
+    for (i = 0; i < 16; i++)
+        m[i] = avx4_mul(avx4_set1(u[i]), avx4_loadu(v + i * 4));
+    for (i = 0; i < 4; i++) avx_winograd_out2(m + i, 4, t + i, 4);
+    for (i = 0; i < 2; i++) avx_winograd_out2(t + (i * 4), 1, yv + (i * 2), 1);
+    for (i = 0; i < 2; i++) {
+        ps_real * row = y + (i * y_stride);
+#ifdef PS_USE_FLOAT
+        avx4_storeu(row, _mm_unpacklo_ps(yv[i * 2], yv[(i * 2) + 1]));
+        avx4_storeu(row + 4, _mm_unpackhi_ps(yv[i * 2], yv[(i * 2) + 1]));
+#else
+        avx_vec4 lo = _mm256_unpacklo_pd(yv[i * 2], yv[(i * 2) + 1]);
+        avx_vec4 hi = _mm256_unpackhi_pd(yv[i * 2], yv[(i * 2) + 1]);
+        avx4_storeu(row, _mm256_permute2f128_pd(lo, hi, 0x20));
+        avx4_storeu(row + 4, _mm256_permute2f128_pd(lo, hi, 0x31));
+#endif
+    }
+}
+
+void avx_winograd_output4x4(ps_real * u, ps_real * v, ps_real * y,
+                            int y_stride)
+{
+    avx_vec4 m[36], t[24], yv[16];
+    int i;
+    for (i = 0; i < 36; i++)
+        m[i] = avx4_mul(avx4_set1(u[i]), avx4_loadu(v + i * 4));
+    for (i = 0; i < 6; i++) avx_winograd_out4(m + i, 6, t + i, 6);
+    for (i = 0; i < 4; i++) avx_winograd_out4(t + (i * 6), 1, yv + (i * 4), 1);
+    for (i = 0; i < 4; i++) {
+        avx_vec4 * r = yv + (i * 4);
+        ps_real * row = y + (i * y_stride);
+#ifdef PS_USE_FLOAT
+        _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+        avx4_storeu(row, r[0]);
+        avx4_storeu(row + 4, r[1]);
+        avx4_storeu(row + 8, r[2]);
+        avx4_storeu(row + 12, r[3]);
+#else
+        avx_vec4 t0 = _mm256_unpacklo_pd(r[0], r[1]);
+        avx_vec4 t1 = _mm256_unpackhi_pd(r[0], r[1]);
+        avx_vec4 t2 = _mm256_unpacklo_pd(r[2], r[3]);
+        avx_vec4 t3 = _mm256_unpackhi_pd(r[2], r[3]);
+        avx4_storeu(row, _mm256_permute2f128_pd(t0, t2, 0x20));
+        avx4_storeu(row + 4, _mm256_permute2f128_pd(t1, t3, 0x20));
+        avx4_storeu(row + 8, _mm256_permute2f128_pd(t0, t2, 0x31));
+        avx4_storeu(row + 12, _mm256_permute2f128_pd(t1, t3, 0x31));
+#endif
+    }
+}
+
+/* INT8 GEMM
+ *
+ * vpmaddubsw multiplies 32 unsigned bytes of A by 32 signed bytes of B and
+ * adds adjacent products into 16-bit lanes, then vpmaddwd (by ones) widens
+ * those pairs into 32-bit sums. A values never exceed 127, so the 16-bit
+ * sums (at most 2 * 127 * 127) can't saturate. */
+
+#define GEMM_U8_VECTOR_SIZE 32
+
+static inline __m256i avx_madd_u8s8(__m256i a, __m256i b, __m256i ones,
+                                    __m256i acc)
+{
+    __m256i p = _mm256_maddubs_epi16(a, b);
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(p, ones));
+}
+
+// Returns the horizontal sums of 4 vectors of 32-bit integers
+
+static inline __m128i avx_hsum4_epi32(__m256i v0, __m256i v1, __m256i v2,
+                                      __m256i v3)
+{
+    __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(v0, v1),
+                                  _mm256_hadd_epi32(v2, v3));
+    return _mm_add_epi32(_mm256_castsi256_si128(s),
+                         _mm256_extracti128_si256(s, 1));
+}
+
+/* Computes a (mr x nr) tile of C = A * B^T, with mr <= 2 and nr <= 4, in
+ * the same way as avx_gemm_nt_tile. When signed_a is set, A holds the signed
+ * bytes and B the unsigned ones. */
+
+static inline __attribute__((always_inline))
+void avx_gemm_i8_tile(const int signed_a, const int mr, int nr, int k,
+                      uint8_t * a, int lda, uint8_t * b, int ldb,
+                      int32_t * c, int ldc)
+{
+    uint8_t * a0 = a, * a1 = a + (mr > 1 ? lda : 0);
+    uint8_t * b0 = b;
+    uint8_t * b1 = b + (nr > 1 ? ldb : 0);
+    uint8_t * b2 = b + (nr > 2 ? 2 * ldb : 0);
+    uint8_t * b3 = b + (nr > 3 ? 3 * ldb : 0);
+    __m256i ones = _mm256_set1_epi16(1);
+    __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256(),
+            c02 = _mm256_setzero_si256(), c03 = _mm256_setzero_si256(),
+            c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256(),
+            c12 = _mm256_setzero_si256(), c13 = _mm256_setzero_si256();
+    __m256i va0, va1, vb;
+    int p;
+#define AVX_MADD_I8(va, vb, acc) (signed_a ? \
+    avx_madd_u8s8(vb, va, ones, acc) : avx_madd_u8s8(va, vb, ones, acc))
+    for (p = 0; p < k; p += GEMM_U8_VECTOR_SIZE) {
+        va0 = _mm256_loadu_si256((__m256i *) (a0 + p));
+        if (mr > 1) va1 = _mm256_loadu_si256((__m256i *) (a1 + p));
+        vb = _mm256_loadu_si256((__m256i *) (b0 + p));
+        c00 = AVX_MADD_I8(va0, vb, c00);
+        if (mr > 1) c10 = AVX_MADD_I8(va1, vb, c10);
+        vb = _mm256_loadu_si256((__m256i *) (b1 + p));
+        c01 = AVX_MADD_I8(va0, vb, c01);
+        if (mr > 1) c11 = AVX_MADD_I8(va1, vb, c11);
+        vb = _mm256_loadu_si256((__m256i *) (b2 + p));
+        c02 = AVX_MADD_I8(va0, vb, c02);
+        if (mr > 1) c12 = AVX_MADD_I8(va1, vb, c12);
+        vb = _mm256_loadu_si256((__m256i *) (b3 + p));
+        c03 = AVX_MADD_I8(va0, vb, c03);
+        if (mr > 1) c13 = AVX_MADD_I8(va1, vb, c13);
+    }
+#undef AVX_MADD_I8
+    __m128i cmask = _mm_cmpgt_epi32(_mm_set1_epi32(nr),
+                                    _mm_setr_epi32(0, 1, 2, 3));
+    _mm_maskstore_epi32(c, cmask, avx_hsum4_epi32(c00, c01, c02, c03));
+    if (mr > 1)
+        _mm_maskstore_epi32(c + ldc, cmask,
+                            avx_hsum4_epi32(c10, c11, c12, c13));
+}
+
+static inline __attribute__((always_inline))
+void avx_gemm_i8_nt(const int signed_a, int m, int n, int k, uint8_t * a,
+                    int lda, uint8_t * b, int ldb, int32_t * c, int ldc)
+{
+    int i, j;
+    for (i = 0; i < m; i += GEMM_NT_MR) {
+        uint8_t * a_row = a + (i * lda);
+        int32_t * c_row = c + (i * ldc);
+        for (j = 0; j < n; j += GEMM_NT_NR) {
+            int nr = GEMM_MIN(GEMM_NT_NR, n - j);
+            uint8_t * b_row = b + (j * ldb);
+            if (m - i > 1)
+                avx_gemm_i8_tile(signed_a, 2, nr, k, a_row, lda, b_row, ldb,
+                                 c_row + j, ldc);
+            else
+                avx_gemm_i8_tile(signed_a, 1, nr, k, a_row, lda, b_row, ldb,
+                                 c_row + j, ldc);
+        }
+    }
+}
+
+void avx_gemm_u8s8_nt(int m, int n, int k, uint8_t * a, int lda, int8_t * b,
+                      int ldb, int32_t * c, int ldc)
+{
+    avx_gemm_i8_nt(0, m, n, k, a, lda, (uint8_t *) b, ldb, c, ldc);
+}
+
+void avx_gemm_s8u8_nt(int m, int n, int k, int8_t * a, int lda, uint8_t * b,
+                      int ldb, int32_t * c, int ldc)
+{
+    avx_gemm_i8_nt(1, m, n, k, (uint8_t *) a, lda, b, ldb, c, ldc);
+}
@@ -18,6 +18,9 @@
 #ifndef __PS_AVX_H
 #define __PS_AVX_H
 
+#include <stdint.h>
+#include "psyc.h"
+
 #define AVXGetStepLen(s) (s >= AVX_VECTOR_SIZE ? AVX_VECTOR_SIZE : \
     AVX_VECTOR_SIZE / 2)
 #define AVXGetDotStepLen(s) (s >= AVX_VECTOR4_SIZE ? AVX_VECTOR4_SIZE : \
@@ -43,25 +46,58 @@ extern int AVX_VECTOR_SIZE;
 extern int AVX_VECTOR4_SIZE;
 extern int AVX_VECTOR2_SIZE;
 
-typedef double (* avx_dot_product)(double * x, double * y);
-typedef void (* avx_multiply_value)(double * x, double v, double * d, int mode);
-typedef void (* avx_multiply)(double * x, double * y, double * dest, int mode);
-typedef void (* avx_sum)(double * x, double * y, double * dest, int mode);
-typedef void (* avx_diff)(double * x, double * y, double * dest, int mode);
-
-double avx_dot_product2(double * x, double * y);
-double avx_dot_product4(double * x, double * y);
-double avx_dot_product8(double * x, double * y);
-double avx_dot_product16(double * x, double * y);
-
-void avx_multiply_value2(double * x, double value, double * dest, int mode);
-void avx_multiply2(double * x, double * y, double * dest, int mode);
-void avx_multiply_value4(double * x, double value, double * dest, int mode);
-void avx_multiply4(double * x, double * y, double * dest, int mode);
-
-void avx_sum2(double * x, double * y, double * dest, int mode);
-void avx_sum4(double * x, double * y, double * dest, int mode);
-void avx_diff2(double * x, double * y, double * dest, int mode);
-void avx_diff4(double * x, double * y, double * dest, int mode);
+typedef ps_real (* avx_dot_product)(ps_real * x, ps_real * y);
+typedef void (* avx_multiply_value)(ps_real * x, ps_real v, ps_real * d,
+                                    int mode);
+typedef void (* avx_multiply)(ps_real * x, ps_real * y, ps_real * dest,
+                              int mode);
+typedef void (* avx_sum)(ps_real * x, ps_real * y, ps_real * dest, int mode);
+typedef void (* avx_diff)(ps_real * x, ps_real * y, ps_real * dest, int mode);
+
+ps_real avx_dot_product2(ps_real * x, ps_real * y);
+ps_real avx_dot_product4(ps_real * x, ps_real * y);
+ps_real avx_dot_product8(ps_real * x, ps_real * y);
+ps_real avx_dot_product16(ps_real * x, ps_real * y);
+
+void avx_multiply_value2(ps_real * x, ps_real value, ps_real * dest, int mode);
+void avx_multiply2(ps_real * x, ps_real * y, ps_real * dest, int mode);
+void avx_multiply_value4(ps_real * x, ps_real value, ps_real * dest, int mode);
+void avx_multiply4(ps_real * x, ps_real * y, ps_real * dest, int mode);
+
+void avx_sum2(ps_real * x, ps_real * y, ps_real * dest, int mode);
+void avx_sum4(ps_real * x, ps_real * y, ps_real * dest, int mode);
+void avx_diff2(ps_real * x, ps_real * y, ps_real * dest, int mode);
+void avx_diff4(ps_real * x, ps_real * y, ps_real * dest, int mode);
+
+/* C = A * B^T, C = A * B and C = A^T * B (row-major). The mode tells
+ * whether the result overwrites C or it's added to (subtracted from) it. */
+
+void avx_gemm_nt(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode);
+void avx_gemm_nn(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode);
+void avx_gemm_tn(int m, int n, int k, ps_real * a, int lda, ps_real * b,
+                 int ldb, ps_real * c, int ldc, int mode);
+
+/* Winograd F(2x2, 3x3) and F(4x4, 3x3) on 4 interleaved tiles: the input
+ * functions transform the tiles, the output functions multiply them by the
+ * transformed weights u and store the resulting rows into y. */
+
+void avx_winograd_input2x2(ps_real * d, ps_real * v);
+void avx_winograd_input4x4(ps_real * d, ps_real * v);
+void avx_winograd_output2x2(ps_real * u, ps_real * v, ps_real * y,
+                            int y_stride);
+void avx_winograd_output4x4(ps_real * u, ps_real * v, ps_real * y,
+                            int y_stride);
+
+/* C = A * B^T on 8-bit integers, with 32-bit results: A is unsigned (values
+ * must be <= 127), B is signed. Every row must be padded with zeros to a
+ * multiple of 32 values, so that k is a whole number of vectors.
+ * avx_gemm_s8u8_nt swaps the signedness of A and B. */
+
+void avx_gemm_u8s8_nt(int m, int n, int k, uint8_t * a, int lda, int8_t * b,
+                      int ldb, int32_t * c, int ldc);
+void avx_gemm_s8u8_nt(int m, int n, int k, int8_t * a, int lda, uint8_t * b,
+                      int ldb, int32_t * c, int ldc);
 
 #endif //__PS_AVX_H
@@ -30,67 +30,72 @@
 #include "utils.h"
 #include "convolutional.h"
 #include "recurrent.h"
+#include "gemm.h"
+#include "threads.h"
 
-double getDeltaForConvolutionalNeuron(PSNeuron * neuron,
-                                      PSLayer * layer,
-                                      PSLayer * nextLayer,
-                                      double * last_delta)
+void PSGetConvGeometry(PSLayer * layer, PSLayer * previous,
+                       PSConvGeometry * g)
 {
-    
-    int index = neuron->index, i, j, row, col;
-    int size = layer->size;
-    PSLayerParameters * lparams = layer->parameters;
-    int feature_count = (int) (lparams->parameters[PARAM_FEATURE_COUNT]);
-    double output_w = lparams->parameters[PARAM_OUTPUT_WIDTH];
-    int feature_size = size / feature_count;
-    int feature_idx = index / feature_size;
-    PSLayerParameters * nparams = nextLayer->parameters;
-    int next_feature_count = (int) (nparams->parameters[PARAM_FEATURE_COUNT]);
-    int next_region_size = (int) (nparams->parameters[PARAM_REGION_SIZE]);
-    int stride = (int) (nparams->parameters[PARAM_STRIDE]);
-    double next_output_w = nparams->parameters[PARAM_OUTPUT_WIDTH];
-    int next_feature_size = nextLayer->size / next_feature_count;
-    int features_step = next_feature_count / feature_count;
-    int next_feature_idx = feature_idx * features_step;
-    int max_feature_idx = next_feature_idx + features_step;
-    
-    int n_col = index % (int) output_w;
-    int n_row = index / (int) output_w;
-    
-    PSSharedParams * shared = getConvSharedParams(nextLayer);
-    if (shared == NULL) {
-        //TODO: handle shared == NULL
-        return 0;
+    PSSharedParams * shared = getConvSharedParams(layer);
+    double * params = layer->parameters->parameters;
+    double * previous_params = previous->parameters->parameters;
+    g->feature_count = shared->feature_count;
+    g->feature_size = layer->size / g->feature_count;
+    g->region_size = (int) (params[PARAM_REGION_SIZE]);
+    g->region_area = shared->weights_size;
+    g->stride = (int) (params[PARAM_STRIDE]);
+    if (g->stride == 0) g->stride = 1;
+    g->input_w = (int) (previous_params[PARAM_OUTPUT_WIDTH]);
+    g->output_w = (int) (params[PARAM_OUTPUT_WIDTH]);
+    g->output_h = g->feature_size / g->output_w;
+    g->maps = 1;
+    g->map_size = 0;
+    if (previous->type == Pooling) {
+        g->maps = (int) (previous_params[PARAM_FEATURE_COUNT]);
+        g->map_size = previous->size / g->maps;
     }
-    
-    double dv = 0;
-    
-    for (i = next_feature_idx; i < max_feature_idx; i++) {
-        double * weights = shared->weights[i];
-        int offset = i * next_feature_size;
-        row = 0;
-        col = 0;
-        for (j = 0; j < next_feature_size; j++) {
-            int idx = offset + j;
-            double d = last_delta[idx];
-            col = idx % (int) next_output_w;
-            if (col == 0 && j > 0) row++;
-            int r_row = row * stride;
-            int r_col = col * stride;
-            if (r_col > n_col || r_row > n_row) break;
-            int max_x = next_region_size + r_col;
-            int max_y = next_region_size + r_row;
-            if ((n_col >= r_col && n_col < max_x) &&
-                (n_row >= r_row && n_row < max_y)) {
-                int widx = (r_row * next_region_size) + r_col;
-                dv += (d * weights[widx]);
+    g->features_per_map = g->feature_count / g->maps;
+    g->col_stride = getTensorStride(g->region_area);
+}
+
+/* Unrolls the regions of an input feature map into the rows of a matrix:
+ * row N holds (in row-major order) the region convolved by the output
+ * neuron N. */
+
+static void im2col(ps_real * input, PSConvGeometry * g, ps_real * col) {
+    int row, c, y;
+    size_t region_row_size = g->region_size * sizeof(ps_real);
+    for (row = 0; row < g->output_h; row++) {
+        ps_real * input_row = input + (row * g->stride * g->input_w);
+        for (c = 0; c < g->output_w; c++) {
+            ps_real * region = input_row + (c * g->stride);
+            ps_real * src = col + (((row * g->output_w) + c) * g->col_stride);
+            for (y = 0; y < g->region_size; y++) {
+                memcpy(src, region, region_row_size);
+                src += g->region_size;
+                region += g->input_w;
+            }
+        }
+    }
+}
+
+/* Inverse of im2col: every row of the matrix is added back to the region
+ * it was taken from, so overlapping regions are summed. */
+
+static void col2im(ps_real * col, PSConvGeometry * g, ps_real * output) {
+    int row, c, x, y;
+    for (row = 0; row < g->output_h; row++) {
+        ps_real * output_row = output + (row * g->stride * g->input_w);
+        for (c = 0; c < g->output_w; c++) {
+            ps_real * region = output_row + (c * g->stride);
+            ps_real * src = col + (((row * g->output_w) + c) * g->col_stride);
+            for (y = 0; y < g->region_size; y++) {
+                for (x = 0; x < g->region_size; x++) region[x] += src[x];
+                src += g->region_size;
+                region += g->input_w;
             }
         }
     }
-    
-    if (layer->derivative != NULL)
-        dv *= layer->derivative(neuron->activation);
-    return dv;
 }
 
 /* Init Functions */
@@ -180,20 +185,12 @@ int PSInitConvolutionalLayer(PSNeuralNetwork * network, PSLayer * layer,
     int area = (int)(output_w * output_h);
     int size = area * feature_count;
     layer->size = size;
-    layer->neurons = malloc(sizeof(PSNeuron*) * size);
+    layer->neurons = calloc(size, sizeof(PSNeuron*));
     if (layer->neurons == NULL) {
         PSErr(func, "Layer[%d]: Could not allocate neurons!", index);
         PSAbortLayer(network, layer);
         return 0;
     }
-#ifdef USE_AVX
-    layer->avx_activation_cache = calloc(size, sizeof(double));
-    if (layer->avx_activation_cache == NULL) {
-        printMemoryErrorMsg();
-        PSAbortLayer(network, layer);
-        return 0;
-    }
-#endif
     PSSharedParams * shared = malloc(sizeof(PSSharedParams));
     if (shared == NULL) {
         PSErr(func, "Layer[%d]: Couldn't allocate shared params!", index);
@@ -202,23 +199,36 @@ int PSInitConvolutionalLayer(PSNeuralNetwork * network, PSLayer * layer,
     }
     shared->feature_count = feature_count;
     shared->weights_size = (int)(region_size * region_size);
-    shared->biases = malloc(feature_count * sizeof(double));
-    shared->weights = malloc(feature_count * sizeof(double*));
-    if (shared->biases == NULL || shared->weights == NULL) {
+    shared->weights = malloc(feature_count * sizeof(ps_real*));
+    shared->kernel = CONV_KERNEL_IM2COL;
+    if (region_size == 3 && stride == 1 && padding == 0) {
+        // Larger tiles save more multiplications, but waste more work on
+        // the partial tiles at the edges of small feature maps.
+        if (output_w >= 8 && output_h >= 8)
+            shared->kernel = CONV_KERNEL_WINOGRAD_4X4;
+        else
+            shared->kernel = CONV_KERNEL_WINOGRAD_2X2;
+    }
+    // The workspace holds either an im2col matrix or the Winograd
+    // transformed weights.
+    int workspace_size = area * getTensorStride(shared->weights_size);
+    if (feature_count * WINOGRAD_MAX_TILE_AREA > workspace_size)
+        workspace_size = feature_count * WINOGRAD_MAX_TILE_AREA;
+    shared->workspace = PSCreateTensor(workspace_size);
+    shared->workspace_size = workspace_size;
+    layer->extra = shared;
+    if (shared->weights == NULL || shared->workspace == NULL ||
+        !PSInitLayerTensors(layer, feature_count, shared->weights_size)) {
         PSErr(func, "Layer[%d]: Could not allocate memory!", index);
         PSAbortLayer(network, layer);
         return 0;
     }
-    layer->extra = shared;
+    // Shared biases and weights are views on the layer tensors
+    shared->biases = layer->biases;
     int i, j, w;
     for (i = 0; i < feature_count; i++) {
         shared->biases[i] = gaussian_random(0, 1);
-        shared->weights[i] = malloc(shared->weights_size * sizeof(double));
-        if (shared->weights[i] == NULL) {
-            PSErr(func, "Layer[%d]: Could not allocate weights!", index);
-            PSAbortLayer(network, layer);
-            return 0;
-        }
+        shared->weights[i] = layer->weights + (i * layer->weights_stride);
         for (w = 0; w < shared->weights_size; w++) {
             shared->weights[i][w] = gaussian_random(0, 1);
         }
@@ -233,7 +243,7 @@ int PSInitConvolutionalLayer(PSNeuralNetwork * network, PSLayer * layer,
             neuron->index = idx;
             neuron->extra = NULL;
             neuron->weights_size = shared->weights_size;
-            neuron->bias = shared->biases[i];
+            neuron->bias = shared->biases + i;
             neuron->weights = shared->weights[i];
             neuron->layer = layer;
             layer->neurons[idx] = neuron;
@@ -306,20 +316,17 @@ int PSInitPoolingLayer(PSNeuralNetwork * network, PSLayer * layer,
     int area = (int)(output_w * output_h);
     int size = area * feature_count;
     layer->size = size;
-    layer->neurons = malloc(sizeof(PSNeuron*) * size);
+    layer->neurons = calloc(size, sizeof(PSNeuron*));
     if (layer->neurons == NULL) {
         PSErr(func, "Layer[%d]: Could not allocate neurons!", index);
         PSAbortLayer(network, layer);
         return 0;
     }
-#ifdef USE_AVX
-    layer->avx_activation_cache = calloc(size, sizeof(double));
-    if (layer->avx_activation_cache == NULL) {
+    if (!PSInitLayerTensors(layer, 0, 0)) {
         printMemoryErrorMsg();
         PSAbortLayer(network, layer);
         return 0;
     }
-#endif
     int i, j;
     for (i = 0; i < feature_count; i++) {
         for (j = 0; j < area; j++) {
@@ -333,7 +340,7 @@ int PSInitPoolingLayer(PSNeuralNetwork * network, PSLayer * layer,
             neuron->index = idx;
             neuron->extra = NULL;
             neuron->weights_size = 0;
-            neuron->bias = NULL_VALUE;
+            neuron->bias = NULL;
             neuron->weights = NULL;
             neuron->layer = layer;
             layer->neurons[idx] = neuron;
@@ -347,34 +354,348 @@ int PSInitPoolingLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 /* Feedforward Functions */
 
-int PSConvolve(void * _net, void * _layer, ...) {
-    PSNeuralNetwork * net = (PSNeuralNetwork*) _net;
-    PSLayer * layer = (PSLayer*) _layer;
-    int size = layer->size;
+static PSLayer * getConvolutionalInputLayer(PSNeuralNetwork * net,
+                                            PSLayer * layer)
+{
     if (layer->neurons == NULL) {
         PSErr(NULL, "Layer[%d] has no neurons!", layer->index);
-        return 0;
+        return NULL;
     }
     if (layer->index == 0) {
         PSErr(NULL, "Cannot feedforward on layer 0!");
-        return 0;
+        return NULL;
     }
     PSLayer * previous = net->layers[layer->index - 1];
     if (previous == NULL) {
         PSErr(NULL, "Layer[%d]: previous layer is NULL!", layer->index);
-        return 0;
+        return NULL;
     }
-    int i, j, x, y, row, col;
-    PSLayerParameters * parameters = layer->parameters;
-    if (parameters == NULL) {
+    if (layer->parameters == NULL) {
         PSErr(NULL, "Layer[%d]: parameters are NULL!", layer->index);
-        return 0;
+        return NULL;
     }
-    PSLayerParameters * previous_parameters = previous->parameters;
-    if (previous_parameters == NULL) {
+    if (previous->parameters == NULL) {
         PSErr(NULL, "Layer[%d]: parameters are invalid!", layer->index);
-        return 0;
+        return NULL;
+    }
+    PSSharedParams * shared = getConvSharedParams(layer);
+    if (shared == NULL) {
+        PSErr(NULL, "Layer[%d]: shared params are NULL!", layer->index);
+        return NULL;
+    }
+    return previous;
+}
+
+/* Winograd minimal filtering, F(2x2, 3x3) and F(4x4, 3x3).
+ * Every (m + 2) x (m + 2) input tile d is transformed once (V = B^T d B) and
+ * multiplied element-wise by the transformed weights (U = G g G^T) of each
+ * feature reading it. The m x m outputs are then Y = A^T (U . V) A.
+ * Transforms are applied first to the columns and then to the rows of a
+ * tile, through the 1-D functions below. */
+
+typedef void (*PSWinogradTransform)(ps_real * in, int in_step, ps_real * out,
+                                    int out_step);
+
+static void winogradWeights2x2(ps_real * g, int gs, ps_real * u, int us) {
+    ps_real g0 = g[0], g1 = g[gs], g2 = g[2 * gs];
+    u[0] = g0;
+    u[us] = (g0 + g1 + g2) * 0.5;
+    u[2 * us] = (g0 - g1 + g2) * 0.5;
+    u[3 * us] = g2;
+}
+
+static void winogradWeights4x4(ps_real * g, int gs, ps_real * u, int us) {
+    ps_real g0 = g[0], g1 = g[gs], g2 = g[2 * gs];
+    u[0] = g0 / 4.0;
+    u[us] = -(g0 + g1 + g2) / 6.0;
+    u[2 * us] = -(g0 - g1 + g2) / 6.0;
+    u[3 * us] = g0 / 24.0 + g1 / 12.0 + g2 / 6.0;
+    u[4 * us] = g0 / 24.0 - g1 / 12.0 + g2 / 6.0;
+    u[5 * us] = g2;
+}
+
+#ifndef USE_AVX
+
+static void winogradInput2x2(ps_real * d, int ds, ps_real * v, int vs) {
+    ps_real d0 = d[0], d1 = d[ds], d2 = d[2 * ds], d3 = d[3 * ds];
+    v[0] = d0 - d2;
+    v[vs] = d1 + d2;
+    v[2 * vs] = d2 - d1;
+    v[3 * vs] = d1 - d3;
+}
+
+static void winogradOutput2x2(ps_real * m, int ms, ps_real * y, int ys) {
+    ps_real m0 = m[0], m1 = m[ms], m2 = m[2 * ms], m3 = m[3 * ms];
+    y[0] = m0 + m1 + m2;
+    y[ys] = m1 - m2 - m3;
+}
+
+static void winogradInput4x4(ps_real * d, int ds, ps_real * v, int vs) {
+    ps_real d0 = d[0], d1 = d[ds], d2 = d[2 * ds], d3 = d[3 * ds],
+           d4 = d[4 * ds], d5 = d[5 * ds];
+    v[0] = 4.0 * d0 - 5.0 * d2 + d4;
+    v[vs] = -4.0 * (d1 + d2) + d3 + d4;
+    v[2 * vs] = 4.0 * (d1 - d2) - d3 + d4;
+    v[3 * vs] = 2.0 * (d3 - d1) - d2 + d4;
+    v[4 * vs] = 2.0 * (d1 - d3) - d2 + d4;
+    v[5 * vs] = 4.0 * d1 - 5.0 * d3 + d5;
+}
+
+static void winogradOutput4x4(ps_real * m, int ms, ps_real * y, int ys) {
+    ps_real m0 = m[0], m1 = m[ms], m2 = m[2 * ms], m3 = m[3 * ms],
+           m4 = m[4 * ms], m5 = m[5 * ms];
+    ps_real p12 = m1 + m2, n12 = m1 - m2, p34 = m3 + m4, n34 = m3 - m4;
+    y[0] = m0 + p12 + p34;
+    y[ys] = n12 + 2.0 * n34;
+    y[2 * ys] = p12 + 4.0 * p34;
+    y[3 * ys] = n12 + 8.0 * n34 + m5;
+}
+
+#endif
+
+// out (out_size x out_size) = L in L^T, with in being (in_size x in_size)
+
+static void winogradTransformTile(PSWinogradTransform transform, ps_real * in,
+                                  int in_size, ps_real * out, int out_size)
+{
+    ps_real tmp[WINOGRAD_MAX_TILE_AREA];
+    int i;
+    for (i = 0; i < in_size; i++)
+        transform(in + i, in_size, tmp + i, in_size);
+    for (i = 0; i < out_size; i++)
+        transform(tmp + (i * in_size), 1, out + (i * out_size), 1);
+}
+
+/* Tiles are processed in groups of WINOGRAD_LANES horizontally adjacent
+ * tiles, interleaved so that the element k of the tile j is at
+ * [(k * WINOGRAD_LANES) + j]. The output functions multiply the transformed
+ * tiles by the transformed weights u and store the rows of the whole group
+ * into y. */
+
+typedef void (*PSWinogradInput)(ps_real * d, ps_real * v);
+typedef void (*PSWinogradOutput)(ps_real * u, ps_real * v, ps_real * y,
+                                 int y_stride);
+
+#ifdef USE_AVX
+#define WINOGRAD_LANES 4
+#else
+#define WINOGRAD_LANES 1
+
+static void winogradInputTile2x2(ps_real * d, ps_real * v) {
+    winogradTransformTile(winogradInput2x2, d, 4, v, 4);
+}
+
+static void winogradInputTile4x4(ps_real * d, ps_real * v) {
+    winogradTransformTile(winogradInput4x4, d, 6, v, 6);
+}
+
+static void winogradOutputTile(PSWinogradTransform transform, int m,
+                               ps_real * u, ps_real * v, ps_real * y,
+                               int y_stride)
+{
+    ps_real prod[WINOGRAD_MAX_TILE_AREA], out[WINOGRAD_MAX_TILE_AREA];
+    int alpha = m + 2, i;
+    for (i = 0; i < alpha * alpha; i++) prod[i] = u[i] * v[i];
+    winogradTransformTile(transform, prod, alpha, out, m);
+    for (i = 0; i < m; i++)
+        memcpy(y + (i * y_stride), out + (i * m), m * sizeof(ps_real));
+}
+
+static void winogradOutputTile2x2(ps_real * u, ps_real * v, ps_real * y,
+                                  int y_stride)
+{
+    winogradOutputTile(winogradOutput2x2, 2, u, v, y, y_stride);
+}
+
+static void winogradOutputTile4x4(ps_real * u, ps_real * v, ps_real * y,
+                                  int y_stride)
+{
+    winogradOutputTile(winogradOutput4x4, 4, u, v, y, y_stride);
+}
+#endif
+
+typedef struct {
+    PSLayer * layer;
+    PSConvGeometry * g;
+    ps_real * inputs;
+    ps_real * z_values;
+    ps_real * activations;
+    ps_real * workspace;
+    int map;
+    // Winograd kernel
+    int m;
+    PSWinogradInput input_tiles;
+    PSWinogradOutput output_tiles;
+} PSConvJob;
+
+/* Every worker computes all the features over a range of tile rows, taken
+ * across all the input maps, since the input tiles are shared by the
+ * features reading the same map. */
+
+static void winogradWorker(void * arg, int worker, int count) {
+    PSConvJob * job = (PSConvJob *) arg;
+    PSConvGeometry * g = job->g;
+    int m = job->m;
+    int alpha = m + 2, tile_area = alpha * alpha, lanes = WINOGRAD_LANES;
+    int input_h = g->output_h + 2, input_w = g->input_w;
+    int output_h = g->output_h, output_w = g->output_w;
+    int group_w = m * lanes, feature_size = g->feature_size;
+    int tiles_h = (output_h + m - 1) / m;
+    int groups_w = (output_w + group_w - 1) / group_w;
+    int first_row, last_row, row, f, j, tx, r, c;
+    PSGetWorkerRange(g->maps * tiles_h, worker, count, &first_row, &last_row);
+    ps_real * transformed_weights = job->workspace;
+    ps_real d[WINOGRAD_MAX_TILE_AREA * WINOGRAD_LANES],
+           v[WINOGRAD_MAX_TILE_AREA * WINOGRAD_LANES],
+           y[4 * 4 * WINOGRAD_LANES];
+    for (row = first_row; row < last_row; row++) {
+        int map = row / tiles_h, ty = row % tiles_h;
+        ps_real * input = job->inputs + (map * g->map_size);
+        int first = map * g->features_per_map;
+        int last = first + g->features_per_map;
+        int row0 = ty * m, out_h = output_h - row0;
+        if (out_h > m) out_h = m;
+        for (tx = 0; tx < groups_w; tx++) {
+            int col0 = tx * group_w, out_w = output_w - col0;
+            if (out_w > group_w) out_w = group_w;
+            // Partial tiles at the edges are padded with zeros
+            for (j = 0; j < lanes; j++) {
+                int tile_col = col0 + (j * m);
+                for (r = 0; r < alpha; r++) {
+                    int iy = row0 + r;
+                    for (c = 0; c < alpha; c++) {
+                        int ix = tile_col + c;
+                        ps_real val = 0.0;
+                        if (iy < input_h && ix < input_w)
+                            val = input[(iy * input_w) + ix];
+                        d[(((r * alpha) + c) * lanes) + j] = val;
+                    }
+                }
+            }
+            job->input_tiles(d, v);
+            int is_full = (out_h == m && out_w == group_w);
+            for (f = first; f < last; f++) {
+                ps_real * u = transformed_weights + (f * tile_area);
+                ps_real * z = job->z_values + (f * feature_size) +
+                             (row0 * output_w) + col0;
+                if (is_full) {
+                    job->output_tiles(u, v, z, output_w);
+                    continue;
+                }
+                job->output_tiles(u, v, y, group_w);
+                for (r = 0; r < out_h; r++) {
+                    memcpy(z + (r * output_w), y + (r * group_w),
+                           out_w * sizeof(ps_real));
+                }
+            }
+        }
+    }
+}
+
+static void convolveWinograd(PSConvJob * job) {
+    PSLayer * layer = job->layer;
+    PSConvGeometry * g = job->g;
+    PSSharedParams * shared = getConvSharedParams(layer);
+    PSWinogradTransform weights_transform = winogradWeights2x2;
+    job->m = 2;
+#ifdef USE_AVX
+    job->input_tiles = avx_winograd_input2x2;
+    job->output_tiles = avx_winograd_output2x2;
+#else
+    job->input_tiles = winogradInputTile2x2;
+    job->output_tiles = winogradOutputTile2x2;
+#endif
+    if (shared->kernel == CONV_KERNEL_WINOGRAD_4X4) {
+        job->m = 4;
+        weights_transform = winogradWeights4x4;
+#ifdef USE_AVX
+        job->input_tiles = avx_winograd_input4x4;
+        job->output_tiles = avx_winograd_output4x4;
+#else
+        job->input_tiles = winogradInputTile4x4;
+        job->output_tiles = winogradOutputTile4x4;
+#endif
+    }
+    int alpha = job->m + 2, tile_area = alpha * alpha, f;
+    // Weights are transformed on every call, since they can be updated by
+    // training at any time. It's negligible compared to the tiles.
+    ps_real * transformed_weights = job->workspace;
+    for (f = 0; f < g->feature_count; f++) {
+        winogradTransformTile(weights_transform,
+                              layer->weights + (f * layer->weights_stride), 3,
+                              transformed_weights + (f * tile_area), alpha);
+    }
+    PSRunLayerWorkers(winogradWorker, job,
+                      (long) layer->size * g->region_area);
+}
+
+static void im2colWorker(void * arg, int worker, int count) {
+    PSConvJob * job = (PSConvJob *) arg;
+    PSConvGeometry * g = job->g;
+    PSLayer * layer = job->layer;
+    ps_real * col = job->workspace;
+    int first, last;
+    PSGetWorkerRange(g->features_per_map, worker, count, &first, &last);
+    if (first >= last) return;
+    first += job->map * g->features_per_map;
+    last += job->map * g->features_per_map;
+    PSGemmNT(last - first, g->feature_size, g->region_area,
+             layer->weights + (first * layer->weights_stride),
+             layer->weights_stride, col, g->col_stride,
+             job->z_values + (first * g->feature_size), g->feature_size,
+             PS_GEMM_STORE);
+}
+
+static void activateFeaturesWorker(void * arg, int worker, int count) {
+    PSConvJob * job = (PSConvJob *) arg;
+    PSConvGeometry * g = job->g;
+    PSLayer * layer = job->layer;
+    int first, last, i, j;
+    PSGetWorkerRange(g->feature_count, worker, count, &first, &last);
+    for (i = first; i < last; i++) {
+        ps_real bias = layer->biases[i];
+        ps_real * z = job->z_values + (i * g->feature_size);
+        ps_real * a = job->activations + (i * g->feature_size);
+        for (j = 0; j < g->feature_size; j++) {
+            z[j] += bias;
+            a[j] = layer->activate(z[j]);
+        }
+    }
+}
+
+/* All the features reading the same input map are computed at once, either
+ * through Winograd tiles or as a single GEMM between their weights and the
+ * map's im2col matrix. Both are split across the library's workers.
+ * The workspace must hold at least shared->workspace_size values. */
+
+static void convolveInputs(PSLayer * layer, PSLayer * previous,
+                           ps_real * inputs, ps_real * z_values,
+                           ps_real * activations, ps_real * workspace)
+{
+    PSConvGeometry g;
+    PSGetConvGeometry(layer, previous, &g);
+    PSSharedParams * shared = getConvSharedParams(layer);
+    ps_real * col = workspace;
+    PSConvJob job = {layer, &g, inputs, z_values, activations, workspace, 0};
+    if (shared->kernel != CONV_KERNEL_IM2COL)
+        convolveWinograd(&job);
+    else {
+        long work = (long) g.features_per_map * g.feature_size *
+                    g.region_area;
+        for (job.map = 0; job.map < g.maps; job.map++) {
+            im2col(inputs + (job.map * g.map_size), &g, col);
+            PSRunLayerWorkers(im2colWorker, &job, work);
+        }
     }
+    PSRunLayerWorkers(activateFeaturesWorker, &job, layer->size);
+}
+
+int PSConvolve(void * _net, void * _layer, ...) {
+    PSNeuralNetwork * net = (PSNeuralNetwork*) _net;
+    PSLayer * layer = (PSLayer*) _layer;
+    int size = layer->size, i;
+    PSLayer * previous = getConvolutionalInputLayer(net, layer);
+    if (previous == NULL) return 0;
     int is_recurrent = (net->flags & FLAG_RECURRENT), times, t;
     if (is_recurrent) {
         va_list args;
@@ -383,87 +704,182 @@ int PSConvolve(void * _net, void * _layer, ...) {
         t = va_arg(args, int);
         va_end(args);
     }
-    double * params = parameters->parameters;
-    double * previous_params = previous_parameters->parameters;
-    int feature_count = (int) (params[PARAM_FEATURE_COUNT]);
-    int stride = (int) (params[PARAM_STRIDE]);
-    double region_size = params[PARAM_REGION_SIZE];
-    double input_w = previous_params[PARAM_OUTPUT_WIDTH];
-    double output_w = params[PARAM_OUTPUT_WIDTH];
-    int feature_size = size / feature_count;
-    PSSharedParams * shared = getConvSharedParams(layer);
-    if (shared == NULL) {
-        PSErr(NULL, "Layer[%d]: shared params are NULL!", layer->index);
+    convolveInputs(layer, previous, previous->activations, layer->z_values,
+                   layer->activations, getConvSharedParams(layer)->workspace);
+    for (i = 0; i < size; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        neuron->z_value = layer->z_values[i];
+        neuron->activation = layer->activations[i];
+    }
+    if (is_recurrent &&
+        PSAddRecurrentStates(layer, layer->activations, times, t) == NULL) {
+        PSErr("convolve", "Failed to allocate recurrent states!");
         return 0;
     }
-    int previous_feature_size = 0, prev_features = 1, prev_features_step = 1;
-    if (previous->type == Pooling) {
-        prev_features = (int) (previous_params[PARAM_FEATURE_COUNT]);
-        previous_feature_size = previous->size / prev_features;
-        prev_features_step = feature_count / prev_features;
+    return 1;
+}
+
+/* Batched im2col convolutions unroll each input map of every sample of the
+ * chunk into a single matrix, so that the features reading the map go
+ * through one GEMM over all the samples. The z values of all the features
+ * are then scattered back to the samples' outputs while they're activated.
+ */
+
+typedef struct {
+    PSLayer * layer;
+    PSConvGeometry * g;
+    ps_real * inputs;
+    int inputs_stride;
+    ps_real * outputs;
+    int outputs_stride;
+    int count;
+    int map;
+    ps_real * col;
+    ps_real * z_values; // feature_count x (count * feature_size)
+} PSConvBatchJob;
+
+static void im2colBatchWorker(void * arg, int worker, int count) {
+    PSConvBatchJob * job = (PSConvBatchJob *) arg;
+    PSConvGeometry * g = job->g;
+    int first, last, i;
+    PSGetWorkerRange(job->count, worker, count, &first, &last);
+    for (i = first; i < last; i++) {
+        im2col(job->inputs + ((size_t) i * job->inputs_stride) +
+               (job->map * g->map_size), g,
+               job->col + ((size_t) i * g->feature_size * g->col_stride));
     }
-    for (i = 0; i < feature_count; i++) {
-        double bias = shared->biases[i];
-        double * weights = shared->weights[i];
-        int previous_feature = 0, feature_offset = 0;
-        if (prev_features > 1) {
-            previous_feature = i / prev_features_step;
-            feature_offset = previous_feature * previous_feature_size;
+}
+
+static void gemmBatchWorker(void * arg, int worker, int count) {
+    PSConvBatchJob * job = (PSConvBatchJob *) arg;
+    PSConvGeometry * g = job->g;
+    PSLayer * layer = job->layer;
+    int columns = job->count * g->feature_size, first, last;
+    PSGetWorkerRange(columns, worker, count, &first, &last);
+    if (first >= last) return;
+    int feature = job->map * g->features_per_map;
+    PSGemmNT(g->features_per_map, last - first, g->region_area,
+             layer->weights + (feature * layer->weights_stride),
+             layer->weights_stride,
+             job->col + ((size_t) first * g->col_stride), g->col_stride,
+             job->z_values + ((size_t) feature * columns) + first, columns,
+             PS_GEMM_STORE);
+}
+
+static void activateBatchWorker(void * arg, int worker, int count) {
+    PSConvBatchJob * job = (PSConvBatchJob *) arg;
+    PSConvGeometry * g = job->g;
+    PSLayer * layer = job->layer;
+    int columns = job->count * g->feature_size, first, last, i, f, j;
+    PSGetWorkerRange(job->count, worker, count, &first, &last);
+    for (i = first; i < last; i++) {
+        ps_real * out = job->outputs + ((size_t) i * job->outputs_stride);
+        for (f = 0; f < g->feature_count; f++) {
+            ps_real bias = layer->biases[f];
+            ps_real * z = job->z_values + ((size_t) f * columns) +
+                          (i * g->feature_size);
+            ps_real * a = out + (f * g->feature_size);
+            for (j = 0; j < g->feature_size; j++)
+                a[j] = layer->activate(z[j] + bias);
+        }
+    }
+}
+
+int PSGetConvBatchWorkspaceSize(PSLayer * layer, int count) {
+    PSSharedParams * shared = getConvSharedParams(layer);
+    if (shared->kernel != CONV_KERNEL_IM2COL) return shared->workspace_size;
+    int feature_size = layer->size / shared->feature_count;
+    int size = count * ((feature_size * getTensorStride(shared->weights_size))
+                        + layer->size);
+    return (size > shared->workspace_size ? size : shared->workspace_size);
+}
+
+int PSConvolveBatch(PSNeuralNetwork * net, PSLayer * layer, ps_real * inputs,
+                    int inputs_stride, ps_real * outputs, int outputs_stride,
+                    int count, ps_real * workspace)
+{
+    PSLayer * previous = getConvolutionalInputLayer(net, layer);
+    if (previous == NULL) return 0;
+    PSSharedParams * shared = getConvSharedParams(layer);
+    int i;
+    if (workspace == NULL || shared->kernel != CONV_KERNEL_IM2COL) {
+        // Winograd tiles (and the layer's own workspace) take a sample at a
+        // time
+        if (workspace == NULL) workspace = shared->workspace;
+        for (i = 0; i < count; i++) {
+            ps_real * out = outputs + (i * outputs_stride);
+            // Activations are computed in place over the z values
+            convolveInputs(layer, previous, inputs + (i * inputs_stride),
+                           out, out, workspace);
         }
+        return 1;
+    }
+    PSConvGeometry g;
+    PSGetConvGeometry(layer, previous, &g);
+    long columns = (long) count * g.feature_size;
+    PSConvBatchJob job = {layer, &g, inputs, inputs_stride, outputs,
+                          outputs_stride, count, 0, workspace,
+                          workspace + (columns * g.col_stride)};
+    for (job.map = 0; job.map < g.maps; job.map++) {
+        PSRunLayerWorkers(im2colBatchWorker, &job, columns * g.region_area);
+        PSRunLayerWorkers(gemmBatchWorker, &job, columns *
+                          g.features_per_map * g.region_area);
+    }
+    PSRunLayerWorkers(activateBatchWorker, &job, (long) count * layer->size);
+    return 1;
+}
+
+typedef struct {
+    PSLayer * layer;
+    PSLayer * previous;
+    ps_real * inputs;
+    ps_real * input_z; // Can be NULL, with z_values
+    ps_real * z_values;
+    ps_real * activations;
+} PSPoolJob;
+
+static void poolWorker(void * arg, int worker, int count) {
+    PSPoolJob * job = (PSPoolJob *) arg;
+    PSLayer * layer = job->layer;
+    PSLayer * previous = job->previous;
+    int i, j, x, y, row, col, first, last;
+    double * params = layer->parameters->parameters;
+    double * previous_params = previous->parameters->parameters;
+    int feature_count = (int) (params[PARAM_FEATURE_COUNT]);
+    double region_size = params[PARAM_REGION_SIZE];
+    double input_w = previous_params[PARAM_OUTPUT_WIDTH];
+    double output_w = params[PARAM_OUTPUT_WIDTH];
+    int feature_size = layer->size / feature_count;
+    int prev_size = previous->size / feature_count;
+    ps_real * prev_activations = job->inputs;
+    ps_real * prev_z_values = job->input_z;
+    PSGetWorkerRange(feature_count, worker, count, &first, &last);
+    for (i = first; i < last; i++) {
         row = 0;
         col = 0;
         for (j = 0; j < feature_size; j++) {
             int idx = (i * feature_size) + j;
-            PSNeuron * neuron = layer->neurons[idx];
             col = idx % (int) output_w;
             if (col == 0 && j > 0) row++;
-            int r_row = row * stride;
-            int r_col = col * stride;
+            int r_row = row * region_size;
+            int r_col = col * region_size;
             int max_x = region_size + r_col;
             int max_y = region_size + r_row;
-            double sum = 0;
-            int widx = 0;
-            //printf("Neuron %d,%d: r: %d, b: %d\n", col, row, max_x, max_y);
+            ps_real max = 0.0, max_z = 0.0;
             for (y = r_row; y < max_y; y++) {
-                x = r_col;
-#ifdef USE_AVX
-                int avx_step_len = AVXGetDotStepLen(region_size);
-                avx_dot_product dot_product = AVXGetDotProductFunc(region_size);
-                int avx_steps = region_size / avx_step_len, avx_step;
-                for (avx_step = 0; avx_step < avx_steps; avx_step++) {
-                    int nidx = feature_offset + (y * input_w) + x;
-                    double * x_vector = previous->avx_activation_cache + nidx;
-                    if (is_recurrent) x_vector += (t * previous->size);
-                    double * y_vector = weights + widx;
-                    sum += dot_product(x_vector, y_vector);
-                    x += avx_step_len;
-                    widx += avx_step_len;
-                }
-#endif
-                for (; x < max_x; x++) {
-                    int nidx = feature_offset + (y * input_w) + x;
-                    //printf("  -> %d,%d [%d]\n", x, y, nidx);
-                    PSNeuron * prev_neuron = previous->neurons[nidx];
-                    double a = prev_neuron->activation;
-                    sum += (a * weights[widx++]);
-                }
-            }
-            neuron->z_value = sum + bias;
-            neuron->activation = layer->activate(neuron->z_value);
-#ifdef USE_AVX
-            if (!is_recurrent)
-                layer->avx_activation_cache[idx] = neuron->activation;
-#endif
-            if (is_recurrent) {
-                PSAddRecurrentState(neuron, neuron->activation, times, t);
-                if (neuron->extra == NULL) {
-                    PSErr("convolve", "Failed to allocate Recurrent Cell!");
-                    return 0;
+                for (x = r_col; x < max_x; x++) {
+                    int nidx = ((y * input_w) + x) + (prev_size * i);
+                    ps_real a = prev_activations[nidx];
+                    if (a > max) {
+                        max = a;
+                        if (prev_z_values != NULL) max_z = prev_z_values[nidx];
+                    }
                 }
             }
+            if (job->z_values != NULL) job->z_values[idx] = max_z;
+            job->activations[idx] = max;
         }
     }
-    return 1;
 }
 
 int PSPool(void * _net, void * _layer, ...) {
@@ -483,7 +899,7 @@ int PSPool(void * _net, void * _layer, ...) {
         PSErr(NULL, "Layer[%d]: previous layer is NULL!", layer->index);
         return 0;
     }
-    int i, j, x, y, row, col;
+    int i;
     PSLayerParameters * parameters = layer->parameters;
     if (parameters == NULL) {
         PSErr(NULL, "Layer[%d]: parameters are NULL!", layer->index);
@@ -494,6 +910,13 @@ int PSPool(void * _net, void * _layer, ...) {
         PSErr(NULL, "Layer[%d]: parameters are invalid!", layer->index);
         return 0;
     }
+    double region_size = parameters->parameters[PARAM_REGION_SIZE];
+    PSPoolJob job = {
+        layer, previous, previous->activations, previous->z_values,
+        layer->z_values, layer->activations
+    };
+    PSRunLayerWorkers(poolWorker, &job,
+                      (long) (size * region_size * region_size));
     int is_recurrent = (net->flags & FLAG_RECURRENT), times, t;
     if (is_recurrent) {
         va_list args;
@@ -502,53 +925,39 @@ int PSPool(void * _net, void * _layer, ...) {
         t = va_arg(args, int);
         va_end(args);
     }
-    double * params = parameters->parameters;
-    double * previous_params = previous_parameters->parameters;
-    int feature_count = (int) (params[PARAM_FEATURE_COUNT]);
-    double region_size = params[PARAM_REGION_SIZE];
-    double input_w = previous_params[PARAM_OUTPUT_WIDTH];
-    double output_w = params[PARAM_OUTPUT_WIDTH];
-    int feature_size = size / feature_count;
-    int prev_size = previous->size / feature_count;
-    for (i = 0; i < feature_count; i++) {
-        row = 0;
-        col = 0;
-        for (j = 0; j < feature_size; j++) {
-            int idx = (i * feature_size) + j;
-            PSNeuron * neuron = layer->neurons[idx];
-            col = idx % (int) output_w;
-            if (col == 0 && j > 0) row++;
-            int r_row = row * region_size;
-            int r_col = col * region_size;
-            int max_x = region_size + r_col;
-            int max_y = region_size + r_row;
-            double max = 0.0, max_z = 0.0;
-            for (y = r_row; y < max_y; y++) {
-                for (x = r_col; x < max_x; x++) {
-                    int nidx = ((y * input_w) + x) + (prev_size * i);
-                    PSNeuron * prev_neuron = previous->neurons[nidx];
-                    double a = prev_neuron->activation;
-                    double z = prev_neuron->z_value;
-                    if (a > max) {
-                        max = a;
-                        max_z = z;
-                    }
-                }
-            }
-            neuron->z_value = max_z;
-            neuron->activation = max;
-#ifdef USE_AVX
-            if (!is_recurrent)
-                layer->avx_activation_cache[idx] = neuron->activation;
-#endif
-            if (is_recurrent) {
-                PSAddRecurrentState(neuron, neuron->activation, times, t);
-                if (neuron->extra == NULL) {
-                    PSErr("pool", "Failed to allocate Recurrent Cell!");
-                    return 0;
-                }
-            }
-        }
+    for (i = 0; i < size; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        neuron->z_value = layer->z_values[i];
+        neuron->activation = layer->activations[i];
+    }
+    if (is_recurrent &&
+        PSAddRecurrentStates(layer, layer->activations, times, t) == NULL) {
+        PSErr("pool", "Failed to allocate recurrent states!");
+        return 0;
+    }
+    return 1;
+}
+
+int PSPoolBatch(PSNeuralNetwork * net, PSLayer * layer, ps_real * inputs,
+                int inputs_stride, ps_real * outputs, int outputs_stride,
+                int count)
+{
+    PSLayer * previous = net->layers[layer->index - 1];
+    if (previous == NULL || layer->parameters == NULL ||
+        previous->parameters == NULL)
+    {
+        PSErr("PSPoolBatch", "Layer[%d]: invalid input layer!", layer->index);
+        return 0;
+    }
+    double region_size = layer->parameters->parameters[PARAM_REGION_SIZE];
+    long work = (long) (layer->size * region_size * region_size);
+    int i;
+    for (i = 0; i < count; i++) {
+        PSPoolJob job = {
+            layer, previous, inputs + (i * inputs_stride), NULL, NULL,
+            outputs + (i * outputs_stride)
+        };
+        PSRunLayerWorkers(poolWorker, &job, work);
     }
     return 1;
 }
@@ -556,9 +965,9 @@ int PSPool(void * _net, void * _layer, ...) {
 /* Backpropagation Functions */
 
 int PSPoolingBackprop(PSLayer * pooling_layer, PSLayer * convolutional_layer,
-                      double * delta)
+                      ps_real * delta)
 {
-    double * new_delta = convolutional_layer->delta;
+    ps_real * new_delta = convolutional_layer->delta;
     PSLayerParameters * pool_params = pooling_layer->parameters;
     PSLayerParameters * conv_params = convolutional_layer->parameters;
     int feature_count = (int) (conv_params->parameters[PARAM_FEATURE_COUNT]);
@@ -567,27 +976,27 @@ int PSPoolingBackprop(PSLayer * pooling_layer, PSLayer * convolutional_layer,
     double input_w = pool_params->parameters[PARAM_INPUT_WIDTH];
     double output_w = pool_params->parameters[PARAM_OUTPUT_WIDTH];
     int prev_size = convolutional_layer->size / feature_count;
+    ps_real * conv_activations = convolutional_layer->activations;
     int i, j, row, col, x, y;
     for (i = 0; i < feature_count; i++) {
         row = 0;
         col = 0;
         for (j = 0; j < feature_size; j++) {
             int idx = j + (i * feature_size);
-            double d = delta[idx];
-            PSNeuron * neuron = pooling_layer->neurons[idx];
+            ps_real d = delta[idx];
+            ps_real pooled = pooling_layer->activations[idx];
             col = idx % (int) output_w;
             if (col == 0 && j > 0) row++;
             int r_row = row * pool_size;
             int r_col = col * pool_size;
             int max_x = pool_size + r_col;
             int max_y = pool_size + r_row;
-            //double max = 0;
+            //ps_real max = 0;
             for (y = r_row; y < max_y; y++) {
                 for (x = r_col; x < max_x; x++) {
                     int nidx = ((y * input_w) + x) + (prev_size * i);
-                    PSNeuron * prev_neuron = convolutional_layer->neurons[nidx];
-                    double a = prev_neuron->activation;
-                    new_delta[nidx] = (a < neuron->activation ? 0 : d);
+                    ps_real a = conv_activations[nidx];
+                    new_delta[nidx] = (a < pooled ? 0 : d);
                 }
             }
             
@@ -596,58 +1005,58 @@ int PSPoolingBackprop(PSLayer * pooling_layer, PSLayer * convolutional_layer,
     return 1;
 }
 
+/* Weight gradients are the product between the deltas of the features
+ * reading an input map and the map's im2col matrix. */
+
 int PSConvolutionalBackprop(PSLayer* convolutional_layer, PSLayer * prev_layer,
                             PSGradient * lgradients)
 {
-    double * delta = convolutional_layer->delta;
-    int size = convolutional_layer->size;
-    PSLayerParameters * params = convolutional_layer->parameters;
-    int feature_count = (int) (params->parameters[PARAM_FEATURE_COUNT]);
-    int region_size = (int) (params->parameters[PARAM_REGION_SIZE]);
-    int stride = (int) (params->parameters[PARAM_STRIDE]);
-    double input_w = params->parameters[PARAM_INPUT_WIDTH];
-    double output_w = params->parameters[PARAM_OUTPUT_WIDTH];
-    int feature_size = size / feature_count;
-    int previous_feature_size = 0, prev_features = 1, prev_features_step = 1;
-    if (prev_layer->type == Pooling) {
-        PSLayerParameters * prev_params = prev_layer->parameters;
-        //TODO: check if prev_params == NULL
-        prev_features = (int) (prev_params->parameters[PARAM_FEATURE_COUNT]);
-        previous_feature_size = prev_layer->size / prev_features;
-        prev_features_step = feature_count / prev_features;
+    PSConvGeometry g;
+    PSGetConvGeometry(convolutional_layer, prev_layer, &g);
+    ps_real * delta = convolutional_layer->delta;
+    ps_real * col = getConvSharedParams(convolutional_layer)->workspace;
+    int map, i, j;
+    for (map = 0; map < g.maps; map++) {
+        int first = map * g.features_per_map;
+        im2col(prev_layer->activations + (map * g.map_size), &g, col);
+        PSGemmNN(g.features_per_map, g.region_area, g.feature_size,
+                 delta + (first * g.feature_size), g.feature_size,
+                 col, g.col_stride, lgradients[first].weights, g.col_stride,
+                 PS_GEMM_ADD);
     }
-    int i, j, row, col, x, y;
-    for (i = 0; i < feature_count; i++) {
-        PSGradient * feature_gradient = &(lgradients[i]);
-        int previous_feature = 0, feature_offset = 0;
-        if (prev_features > 1) {
-            previous_feature = i / prev_features_step;
-            feature_offset = previous_feature * previous_feature_size;
-        }
-        row = 0;
-        col = 0;
-        for (j = 0; j < feature_size; j++) {
-            int idx = j + (i * feature_size);
-            double d = delta[idx];
-            feature_gradient->bias += d;
-            
-            col = idx % (int) output_w;
-            if (col == 0 && j > 0) row++;
-            int r_row = row * stride;
-            int r_col = col * stride;
-            int max_x = region_size + r_col;
-            int max_y = region_size + r_row;
-            int widx = 0;
-            for (y = r_row; y < max_y; y++) {
-                for (x = r_col; x < max_x; x++) {
-                    int nidx = feature_offset + (y * input_w) + x;
-                    //printf("  -> %d,%d [%d]\n", x, y, nidx);
-                    PSNeuron * prev_neuron = prev_layer->neurons[nidx];
-                    double a = prev_neuron->activation;
-                    feature_gradient->weights[widx++] += (a * d);
-                }
-            }
-        }
+    for (i = 0; i < g.feature_count; i++) {
+        ps_real * d = delta + (i * g.feature_size);
+        ps_real bias_gradient = 0.0;
+        for (j = 0; j < g.feature_size; j++) bias_gradient += d[j];
+        lgradients[i].bias += bias_gradient;
     }
     return 1;
 }
+
+/* Deltas of the layer preceding a Convolutional layer, computed as a
+ * transposed convolution: the deltas of the features reading an input map
+ * are multiplied by their weights into an im2col-shaped matrix, which is
+ * then folded back onto the map. */
+
+void getConvolutionalLayerDeltas(PSLayer * layer, PSLayer * nextLayer,
+                                 ps_real * last_delta, ps_real * delta)
+{
+    PSConvGeometry g;
+    PSGetConvGeometry(nextLayer, layer, &g);
+    ps_real * col = getConvSharedParams(nextLayer)->workspace;
+    int weights_stride = nextLayer->weights_stride, map, i;
+    memset(delta, 0, layer->size * sizeof(ps_real));
+    for (map = 0; map < g.maps; map++) {
+        int first = map * g.features_per_map;
+        PSGemmTN(g.feature_size, g.region_area, g.features_per_map,
+                 last_delta + (first * g.feature_size), g.feature_size,
+                 nextLayer->weights + (first * weights_stride),
+                 weights_stride, col, g.col_stride, PS_GEMM_STORE);
+        col2im(col, &g, delta + (map * g.map_size));
+    }
+    if (layer->derivative != NULL) {
+        ps_real * activations = layer->activations;
+        for (i = 0; i < layer->size; i++)
+            delta[i] *= layer->derivative(activations[i]);
+    }
+}
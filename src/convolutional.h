@@ -32,16 +32,43 @@
 
 #define CONV_PARAMETER_COUNT 9
 
+/* Convolution kernels: Winograd kernels are selected automatically for
+ * 3x3 regions with stride 1. */
+#define CONV_KERNEL_IM2COL          0
+#define CONV_KERNEL_WINOGRAD_2X2    1
+#define CONV_KERNEL_WINOGRAD_4X4    2
+
+#define WINOGRAD_MAX_TILE_AREA 36
+
 #define getColumn(index, width) (index % width)
 #define getRow(index, width) ((int) ((int) index / (int) width))
 #define getConvSharedParams(layer) ((PSSharedParams*) layer->extra)
 #define calculateConvolutionalSide(s,rs,st,pad) ((s - rs + 2 * pad) / st + 1)
 #define calculatePoolingSide(s, rs) ((s - rs) / rs + 1)
 
-double getDeltaForConvolutionalNeuron(PSNeuron * neuron,
-                                      PSLayer * layer,
-                                      PSLayer * nextLayer,
-                                      double * last_delta);
+/* Geometry of a convolution between a Convolutional layer and its input
+ * layer. Every feature reads a single input feature map (the first one,
+ * unless the input is a Pooling layer), and consecutive features share the
+ * same map. */
+
+typedef struct {
+    int feature_count;
+    int feature_size;
+    int region_size;
+    int region_area;
+    int stride;
+    int input_w;
+    int output_w;
+    int output_h;
+    int maps;
+    int map_size;
+    int features_per_map;
+    int col_stride;
+} PSConvGeometry;
+
+void PSGetConvGeometry(PSLayer * layer, PSLayer * previous,
+                       PSConvGeometry * g);
+
 /* Init Functions */
 
 
@@ -54,12 +81,27 @@ int PSInitPoolingLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 int PSConvolve(void * _net, void * _layer, ...);
 int PSPool(void * _net, void * _layer, ...);
+/* Batch functions only read the layers, leaving their state untouched.
+ * Convolutions use the given workspace, which must hold
+ * PSGetConvBatchWorkspaceSize(layer, count) values: im2col kernels then
+ * convolve all the samples through a single GEMM per input map. If the
+ * workspace is NULL, the samples are convolved one by one in the layer's
+ * own workspace. */
+int PSGetConvBatchWorkspaceSize(PSLayer * layer, int count);
+int PSConvolveBatch(PSNeuralNetwork * net, PSLayer * layer, ps_real * inputs,
+                    int inputs_stride, ps_real * outputs, int outputs_stride,
+                    int count, ps_real * workspace);
+int PSPoolBatch(PSNeuralNetwork * net, PSLayer * layer, ps_real * inputs,
+                int inputs_stride, ps_real * outputs, int outputs_stride,
+                int count);
 
 /* Backpropagation Functions */
 
 int PSPoolingBackprop(PSLayer * pooling_layer, PSLayer * convolutional_layer,
-                      double * delta);
+                      ps_real * delta);
 int PSConvolutionalBackprop(PSLayer* convolutional_layer, PSLayer * prev_layer,
                             PSGradient * lgradients);
+void getConvolutionalLayerDeltas(PSLayer * layer, PSLayer * nextLayer,
+                                 ps_real * last_delta, ps_real * delta);
 
 #endif //__PS_CONVOLUTIONAL_H
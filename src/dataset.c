@@ -0,0 +1,337 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "dataset.h"
+#include "utils.h"
+
+#define PS_DATASET_MAGIC    "PSYCDAT"
+#define PS_DATASET_VERSION  1
+#define FNV_PRIME           1099511628211ULL
+#define HASH_CHUNK          65536
+#define PS_DATASET_CHUNK    1024
+
+/* Dataset file: a header followed by the data values (in native byte
+ * order), aligned to PS_TENSOR_ALIGNMENT. Values are either ps_real or
+ * bytes (PS_DATASET_BYTES). */
+
+typedef struct {
+    char magic[8];
+    int32_t version;
+    int32_t value_size;
+    int32_t flags;
+    int32_t count;
+    int32_t input_size;
+    int32_t output_size;
+    uint64_t source_hash;
+    uint64_t length;
+    uint64_t data_offset;
+} PSDatasetHeader;
+
+#define getDatasetDataOffset() \
+    ((sizeof(PSDatasetHeader) + PS_TENSOR_ALIGNMENT - 1) / \
+     PS_TENSOR_ALIGNMENT * PS_TENSOR_ALIGNMENT)
+#define getDatasetValueSize(flags) \
+    ((flags) & PS_DATASET_BYTES ? sizeof(uint8_t) : sizeof(ps_real))
+
+/* Returns the samples (or series) count of the data, or -1 if the data
+ * doesn't match the given sizes. */
+static int countDatasetElements(ps_real * data, size_t length,
+                                int input_size, int output_size, int flags)
+{
+    if (input_size < 1 || output_size < 1) return -1;
+    if ((flags & PS_DATASET_SERIES) && (flags & PS_DATASET_BYTES)) return -1;
+    if (!(flags & PS_DATASET_SERIES)) {
+        size_t element_size = input_size + output_size;
+        if ((length % element_size) != 0) return -1;
+        return (int) (length / element_size);
+    }
+    if (length < 1) return -1;
+    int count = (int) data[0], i;
+    size_t offset = 1;
+    for (i = 0; i < count; i++) {
+        if (offset >= length) return -1;
+        int times = (int) data[offset];
+        if (times < 1) return -1;
+        offset += 1 + ((size_t) times * (input_size + output_size));
+    }
+    if (offset != length) return -1;
+    return count;
+}
+
+static PSDataset * createDataset(ps_real * data, uint8_t * bytes,
+                                 size_t length, int input_size,
+                                 int output_size, int flags, char * func)
+{
+    int count = countDatasetElements(data, length, input_size, output_size,
+                                     flags);
+    if (count < 0) {
+        PSErr(func, "Data doesn't match the element sizes!");
+        return NULL;
+    }
+    PSDataset * dataset = calloc(1, sizeof(PSDataset));
+    if (dataset == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    dataset->flags = flags;
+    dataset->count = count;
+    dataset->input_size = input_size;
+    dataset->output_size = output_size;
+    dataset->length = length;
+    dataset->data = data;
+    dataset->bytes = bytes;
+    return dataset;
+}
+
+PSDataset * PSCreateDataset(ps_real * data, size_t length, int input_size,
+                            int output_size, int flags)
+{
+    return createDataset(data, NULL, length, input_size, output_size,
+                         flags & ~PS_DATASET_BYTES, "PSCreateDataset");
+}
+
+PSDataset * PSCreateByteDataset(uint8_t * bytes, size_t length,
+                                int input_size, int output_size)
+{
+    return createDataset(NULL, bytes, length, input_size, output_size,
+                         PS_DATASET_BYTES, "PSCreateByteDataset");
+}
+
+void PSDeleteDataset(PSDataset * dataset) {
+    if (dataset == NULL) return;
+    if (dataset->mapping != NULL)
+        munmap(dataset->mapping, dataset->mapping_size);
+    else {
+        free(dataset->data);
+        free(dataset->bytes);
+    }
+    free(dataset);
+}
+
+/* Opens the temporary file a dataset is written to, writing its header. */
+static FILE * createDatasetFile(PSDatasetHeader * header, char * tmpfile,
+                                const char * filename, char * func)
+{
+    strcpy(header->magic, PS_DATASET_MAGIC);
+    header->version = PS_DATASET_VERSION;
+    header->value_size = getDatasetValueSize(header->flags);
+    header->data_offset = getDatasetDataOffset();
+    // Concurrent processes could be building the same dataset
+    sprintf(tmpfile, "%s.%ld.tmp", filename, (long) getpid());
+    FILE * f = fopen(tmpfile, "wb");
+    if (f == NULL) {
+        PSErr(func, "Cannot open %s for writing!", tmpfile);
+        return NULL;
+    }
+    char padding[PS_TENSOR_ALIGNMENT] = {0};
+    size_t padding_size = header->data_offset - sizeof(*header);
+    if (fwrite(header, sizeof(*header), 1, f) != 1 ||
+        fwrite(padding, 1, padding_size, f) != padding_size) {
+        PSErr(func, "Could not write %s!", filename);
+        fclose(f);
+        remove(tmpfile);
+        return NULL;
+    }
+    return f;
+}
+
+/* Closes the temporary file, replacing `filename` with it if it has been
+ * completely written. */
+static int closeDatasetFile(FILE * f, int ok, char * tmpfile,
+                            const char * filename, char * func)
+{
+    if (fclose(f) != 0) ok = 0;
+    if (ok && rename(tmpfile, filename) != 0) ok = 0;
+    if (!ok) {
+        PSErr(func, "Could not write %s!", filename);
+        remove(tmpfile);
+    }
+    return ok;
+}
+
+int PSSaveDataset(PSDataset * dataset, const char * filename) {
+    char * func = "PSSaveDataset";
+    PSDatasetHeader header;
+    memset(&header, 0, sizeof(header));
+    header.flags = dataset->flags;
+    header.count = dataset->count;
+    header.input_size = dataset->input_size;
+    header.output_size = dataset->output_size;
+    header.source_hash = dataset->source_hash;
+    header.length = dataset->length;
+    char tmpfile[strlen(filename) + 32];
+    FILE * f = createDatasetFile(&header, tmpfile, filename, func);
+    if (f == NULL) return 0;
+    void * values = dataset->data;
+    if (dataset->flags & PS_DATASET_BYTES) values = dataset->bytes;
+    int ok = (fwrite(values, header.value_size, dataset->length, f) ==
+              dataset->length);
+    return closeDatasetFile(f, ok, tmpfile, filename, func);
+}
+
+int PSSaveDataSource(PSDataSource * source, const char * filename,
+                     uint64_t source_hash)
+{
+    char * func = "PSSaveDataSource";
+    int element_size = source->input_size + source->output_size;
+    PSDatasetHeader header;
+    memset(&header, 0, sizeof(header));
+    header.count = source->count;
+    header.input_size = source->input_size;
+    header.output_size = source->output_size;
+    header.source_hash = source_hash;
+    header.length = (uint64_t) source->count * element_size;
+    ps_real * chunk = malloc((size_t) PS_DATASET_CHUNK * element_size *
+                             sizeof(ps_real));
+    if (chunk == NULL) {
+        printMemoryErrorMsg();
+        return 0;
+    }
+    char tmpfile[strlen(filename) + 32];
+    FILE * f = createDatasetFile(&header, tmpfile, filename, func);
+    if (f == NULL) {
+        free(chunk);
+        return 0;
+    }
+    int ok = source->rewind(source), written = 0;
+    while (ok && written < source->count) {
+        int count = source->count - written;
+        if (count > PS_DATASET_CHUNK) count = PS_DATASET_CHUNK;
+        count = source->read(source, chunk, count);
+        if (count <= 0) {
+            if (count == 0)
+                PSErr(func, "Data source ended before %d elements!",
+                      source->count);
+            ok = 0;
+            break;
+        }
+        size_t length = (size_t) count * element_size;
+        ok = (fwrite(chunk, sizeof(ps_real), length, f) == length);
+        written += count;
+    }
+    free(chunk);
+    return closeDatasetFile(f, ok, tmpfile, filename, func);
+}
+
+PSDataset * PSLoadDataset(const char * filename, uint64_t source_hash) {
+    char * func = "PSLoadDataset";
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT) PSErr(func, "Cannot open %s!", filename);
+        return NULL;
+    }
+    struct stat st;
+    PSDatasetHeader header;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(header) ||
+        read(fd, &header, sizeof(header)) != sizeof(header) ||
+        memcmp(header.magic, PS_DATASET_MAGIC, sizeof(PS_DATASET_MAGIC)) ||
+        header.version != PS_DATASET_VERSION) {
+        PSErr(func, "Invalid dataset file %s!", filename);
+        close(fd);
+        return NULL;
+    }
+    size_t value_size = getDatasetValueSize(header.flags);
+    if ((size_t) header.value_size != value_size ||
+        (source_hash != 0 && header.source_hash != source_hash)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t) st.st_size;
+    if (header.data_offset != getDatasetDataOffset() ||
+        header.data_offset + (header.length * value_size) != size) {
+        PSErr(func, "Invalid dataset file %s!", filename);
+        close(fd);
+        return NULL;
+    }
+    void * mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        PSErr(func, "Could not map %s!", filename);
+        return NULL;
+    }
+    ps_real * data = NULL;
+    uint8_t * bytes = NULL;
+    if (header.flags & PS_DATASET_BYTES)
+        bytes = (uint8_t *) mapping + header.data_offset;
+    else data = (ps_real *) ((char *) mapping + header.data_offset);
+    int count = countDatasetElements(data, header.length, header.input_size,
+                                     header.output_size, header.flags);
+    if (count != header.count) {
+        PSErr(func, "Invalid dataset file %s!", filename);
+        munmap(mapping, size);
+        return NULL;
+    }
+    PSDataset * dataset = calloc(1, sizeof(PSDataset));
+    if (dataset == NULL) {
+        printMemoryErrorMsg();
+        munmap(mapping, size);
+        return NULL;
+    }
+    dataset->flags = header.flags;
+    dataset->count = count;
+    dataset->input_size = header.input_size;
+    dataset->output_size = header.output_size;
+    dataset->length = header.length;
+    dataset->data = data;
+    dataset->bytes = bytes;
+    dataset->source_hash = header.source_hash;
+    dataset->mapping = mapping;
+    dataset->mapping_size = size;
+    return dataset;
+}
+
+PSDataSource * PSCreateDatasetSource(PSDataset * dataset, int first,
+                                     int count)
+{
+    if ((dataset->flags & (PS_DATASET_SERIES | PS_DATASET_BYTES)) ||
+        first < 0 || count < 0 ||
+        first + count > dataset->count) {
+        PSErr("PSCreateDatasetSource", "Invalid dataset range %d-%d!",
+              first, first + count);
+        return NULL;
+    }
+    // Mapped pages are read ahead of the source and dropped behind it
+    if (dataset->mapping != NULL)
+        madvise(dataset->mapping, dataset->mapping_size, MADV_SEQUENTIAL);
+    return PSCreateArraySource(dataset->data, first, count,
+                               dataset->input_size, dataset->output_size);
+}
+
+/* 64-bit FNV-1a hash */
+uint64_t PSHashFile(const char * filename, uint64_t hash) {
+    FILE * f = fopen(filename, "rb");
+    if (f == NULL) return 0;
+    unsigned char buffer[HASH_CHUNK];
+    size_t read, i;
+    while ((read = fread(buffer, 1, HASH_CHUNK, f)) > 0) {
+        for (i = 0; i < read; i++) {
+            hash ^= buffer[i];
+            hash *= FNV_PRIME;
+        }
+    }
+    int ok = !ferror(f);
+    fclose(f);
+    return (ok ? hash : 0);
+}
@@ -0,0 +1,80 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef __PS_DATASET_H
+#define __PS_DATASET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "psyc.h"
+
+/* Training data laid out as PSTrain expects it, either built in memory or
+ * loaded from a binary dataset file. Dataset files are mapped rather than
+ * read (their data is read-only), so that processes training on the same
+ * file share a single copy of it. Their header stores a hash of the source
+ * files the dataset was built from, so that caches can be detected as
+ * stale. */
+
+#define PS_DATASET_SERIES (1 << 0) // Recurrent series
+/* Compact datasets, whose values are stored as bytes in `bytes` (and
+ * `data` is NULL), to be converted by the code that built them (see
+ * mnist.h). They can't be series. */
+#define PS_DATASET_BYTES  (1 << 1)
+
+typedef struct {
+    int flags;
+    int count; // Samples (or series)
+    int input_size;
+    int output_size; // Size of every target (1 for one-hot series)
+    size_t length; // Number of values in `data` (or `bytes`)
+    ps_real * data;
+    uint8_t * bytes;
+    uint64_t source_hash;
+    void * mapping;
+    size_t mapping_size;
+} PSDataset;
+
+#define PS_DATASET_HASH_SEED 14695981039346656037ULL
+
+/* Creates a dataset taking ownership of `data` (which must be allocated
+ * through malloc). Samples and series count are read from the data. */
+PSDataset * PSCreateDataset(ps_real * data, size_t length, int input_size,
+                            int output_size, int flags);
+/* Same as PSCreateDataset, for PS_DATASET_BYTES datasets. */
+PSDataset * PSCreateByteDataset(uint8_t * bytes, size_t length,
+                                int input_size, int output_size);
+/* Saves a dataset, replacing `filename` only once it has been written. */
+int PSSaveDataset(PSDataset * dataset, const char * filename);
+/* Maps a dataset file: returns NULL if the file doesn't exist, if it's
+ * invalid or if its source hash differs from `source_hash` (unless it's
+ * 0). */
+PSDataset * PSLoadDataset(const char * filename, uint64_t source_hash);
+void PSDeleteDataset(PSDataset * dataset);
+/* Writes the elements of a data source to a dataset file chunk by chunk,
+ * so that datasets larger than the memory can be built. */
+int PSSaveDataSource(PSDataSource * source, const char * filename,
+                     uint64_t source_hash);
+/* Streams `count` samples of a non-recurrent ps_real dataset, starting from
+ * `first`: mapped datasets are read sequentially, so that training on them
+ * doesn't keep the whole file in memory. */
+PSDataSource * PSCreateDatasetSource(PSDataset * dataset, int first,
+                                     int count);
+/* Updates `hash` (PS_DATASET_HASH_SEED initially) with the content of a
+ * file, returning 0 if the file can't be read. */
+uint64_t PSHashFile(const char * filename, uint64_t hash);
+
+#endif //__PS_DATASET_H
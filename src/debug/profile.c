@@ -33,13 +33,13 @@
 #define RNN_TIMES       4
 #define RNN_LEARNING_RATE 0.005
 
-double rnn_train_data[10] = {1, 4, 0, 1, 2, 3, 3, 2, 1, 0};
+ps_real rnn_train_data[10] = {1, 4, 0, 1, 2, 3, 3, 2, 1, 0};
 
 int main(int argc, char** argv) {
     
-    double * test_data = NULL;
-    double * train_data = NULL;
-    double * eval_data = NULL;
+    ps_real * test_data = NULL;
+    ps_real * train_data = NULL;
+    ps_real * eval_data = NULL;
     int datalen = loadMNISTData(TRAINING_DATA,
                                 "../../resources/train-images-idx3-ubyte.gz",
                                 "../../resources/train-labels-idx1-ubyte.gz",
@@ -20,11 +20,11 @@ void TrainCallback (void * _net, int epoch, double loss,
     //if ((epoch % 2) != 0) return;
     PSNeuralNetwork * network = (PSNeuralNetwork*) _net;
     int i;
-    double inputs[256];
+    ps_real inputs[256];
     srand ( time(NULL) - i);
     int p = (rand() % 10) / 10.0f;
     inputs[0] = 1.0;
-    inputs[1] = (double)(rand() % INPUT_SIZE);
+    inputs[1] = (ps_real)(rand() % INPUT_SIZE);
     printf("\nSample:\n%s", characters[(int) inputs[1]]);
     for (i = 0; i < 254; i++) {
         srand ( time(NULL) + i);
@@ -51,7 +51,7 @@ void TrainCallback (void * _net, int epoch, double loss,
         }
         printf("%s", characters[idx]);
         inputs[0] += 1.0;
-        inputs[(int) inputs[0]] = (double) idx;
+        inputs[(int) inputs[0]] = (ps_real) idx;
     }
     printf("\n");
 }
@@ -18,7 +18,7 @@ int main(int argc, char** argv) {
     PSAddLayer(network, FullyConnected, 30, NULL);
     PSAddLayer(network, FullyConnected, 10, NULL);
     
-    double values[INPUTS_SIZE];
+    ps_real values[INPUTS_SIZE];
     int i;
     for (i = 0; i < INPUTS_SIZE; i++) {
         values[i] = normalized_rand();
@@ -27,7 +27,7 @@ int main(int argc, char** argv) {
     
     PSDeleteNetwork(network);
     
-    double nums[] = {1,2,3,4,5,6,7,8,9,10,11,12};
+    ps_real nums[] = {1,2,3,4,5,6,7,8,9,10,11,12};
     testShuffle(nums, 6, 2);
     exit(0);
 }
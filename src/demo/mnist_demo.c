@@ -30,8 +30,8 @@ int main(int argc, char** argv) {
         return 1;
     }
     
-    double * training_data = NULL;
-    double * test_data = NULL;
+    ps_real * training_data = NULL;
+    ps_real * test_data = NULL;
     int testlen = 0;
     int datalen = 0;
     int loaded = 0;
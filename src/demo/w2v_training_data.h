@@ -9,7 +9,7 @@
 #define EVAL_SENTENCES      100
 #define TEST_SENTENCES      100
 char * words[] = {"__S_START__","__S_END__","the","'","to","/","i","and","a","it","of","you","that","-","*","in","is","t","s","for","with","be","have","on","they","but","if","not","are","was","this","like","as","or","can","com","your","at","don","my","just","so","people","them","all","there","an","we","about","he","get","do","when","what","re","no","has","their","more","some","would","out","will","one","from","think","who","me","because","than","any","m","only","up","by","also","other","even","know","how","www","been","|","game","which","then","into","very","had","&gt","his","should","really","before","r","see","good","well","new","going","here","better","much","most","want","too","her","right","why","ll","d","could","still","+","something","place","probably","way","use","3","ve","time","make","say","point","2","great","am","part","reddit","mean","were","many","now","our","after","being","having","isn","thing","wiki","please","got","take","same","day","anything","doesn","play","feel","said","always","though","without","its","first","need","did","message","de","never","actually","go","won","these","damage","post","stuff","either","system","since","down","over","able","find","top","every","lot","put","check","where","work","sure","both","pcpartpicker","try","wouldn","completely","those","bad","best","through","enough","us","last","another","again","looking","life","used","own","building","didn","anyone","civilization","different","made","she","someone","story","while","mod","ones","does","look","bot","https","seems","fine","less","read","let","hard","op","found","win","playing","yourself","15","mind","1","second","fact","rules","kind","help","least","years","google","pretty","keep","may","few","wikia","little","@","come","fucking","long","love","5","else","fun","such","6","high","players","en","bit","team","ever","provide","back","around","close","shit","week","end","wasn","action","feedback","sound","30","vs","changed","games","case","using","getting","until","give","things","comments","consider","questions","worth","under","teams","=","card","http","yet","compose","trying","experience","already","real","big","7","making","movie","based","gun","type","power","ask","instead","each","subreddit","4","city","definitely","average","understand","title","que","stop","non","automatically","certain","old","te","^","taking","maybe","video","nothing","soul","remember","works","example","cards","reading","deal","during","tell","c","whole","haven","friends","risk","played","v","government","low","thank","started","overall","ctrl","complain","lose","considering","cal","contact","consent","away","everything","moderators","f","film","wwe","looks","world","late","money","live","might","yes","quality","exactly","question","him","panels","huge","true","client","likely","dredd","lb","others","times","everyone","pc","president","points","comment","bombs","version","allow","child","run","amount","off","start","honestly","doing","buy","basically","decent","almost","skill","android","person","comes","couldn","kids","agree","open","friend","job","etc","important","control","vanilla","cube","worst","hope","prefer","months","hold","hands","thought","party","believe","mods","near","number","rather","personally","rare","player","vaccines","per","light","children","recommend","wikipedia","far","org","middle","explain","key","8","considered","watch","events","2015","single","learn","tier","youtube","absolutely","rights","set","n","market","asked","nearly","idea","miles","als","among","half","cultural","sub","hit","click","edit","battery","expect","storm","hour","kill","against","specific","die","answer","cause","im","done","concerns","?to=","gets","year","chapter","head","x","items","needs","bmr","redux","performed","unless","putting","interesting","hand","came","song","characters","__UNK__"};
-double training_data[] = {800.0,20.0,0.0,6.0,499.0,8.0,98.0,499.0,30.0,483.0,7.0,24.0,22.0,205.0,499.0,233.0,69.0,6.0,3.0,71.0,199.0,4.0,6.0,499.0,8.0,98.0,499.0,30.0,483.0,7.0,24.0,22.0,205.0,499.0,233.0,69.0,6.0,3.0,71.0,199.0,4.0,1.0,11.0,0.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,13.0,125.0,499.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,13.0,125.0,499.0,1.0,28.0,0.0,499.0,499.0,230.0,384.0,19.0,228.0,499.0,499.0,125.0,384.0,432.0,499.0,254.0,384.0,432.0,499.0,499.0,7.0,59.0,499.0,19.0,499.0,5.0,499.0,5.0,499.0,499.0,499.0,499.0,230.0,384.0,19.0,228.0,499.0,499.0,125.0,384.0,432.0,499.0,254.0,384.0,432.0,499.0,499.0,7.0,59.0,499.0,19.0,499.0,5.0,499.0,5.0,499.0,499.0,1.0,40.0,0.0,39.0,370.0,16.0,16.0,9.0,499.0,499.0,12.0,499.0,56.0,2.0,499.0,499.0,19.0,499.0,6.0,178.0,15.0,2.0,233.0,37.0,8.0,499.0,499.0,7.0,499.0,12.0,175.0,499.0,88.0,499.0,384.0,58.0,69.0,2.0,175.0,499.0,5.0,499.0,39.0,370.0,16.0,16.0,9.0,499.0,499.0,12.0,499.0,56.0,2.0,499.0,499.0,19.0,499.0,6.0,178.0,15.0,2.0,233.0,37.0,8.0,499.0,499.0,7.0,499.0,12.0,175.0,499.0,88.0,499.0,384.0,58.0,69.0,2.0,175.0,499.0,5.0,499.0,1.0,14.0,0.0,60.0,9.0,21.0,499.0,27.0,4.0,499.0,8.0,499.0,15.0,2.0,155.0,499.0,60.0,9.0,21.0,499.0,27.0,4.0,499.0,8.0,499.0,15.0,2.0,155.0,499.0,1.0,25.0,0.0,15.0,36.0,499.0,8.0,402.0,111.0,40.0,27.0,390.0,2.0,499.0,499.0,179.0,23.0,2.0,499.0,7.0,112.0,499.0,2.0,302.0,4.0,2.0,499.0,15.0,36.0,499.0,8.0,402.0,111.0,40.0,27.0,390.0,2.0,499.0,499.0,179.0,23.0,2.0,499.0,7.0,112.0,499.0,2.0,302.0,4.0,2.0,499.0,1.0,9.0,0.0,45.0,3.0,18.0,55.0,117.0,4.0,499.0,9.0,45.0,3.0,18.0,55.0,117.0,4.0,499.0,9.0,1.0,25.0,0.0,46.0,499.0,499.0,16.0,99.0,4.0,27.0,499.0,2.0,302.0,4.0,43.0,52.0,24.0,95.0,24.0,3.0,54.0,8.0,499.0,23.0,2.0,499.0,179.0,46.0,499.0,499.0,16.0,99.0,4.0,27.0,499.0,2.0,302.0,4.0,43.0,52.0,24.0,95.0,24.0,3.0,54.0,8.0,499.0,23.0,2.0,499.0,179.0,1.0,16.0,0.0,8.0,499.0,499.0,138.0,3.0,17.0,99.0,4.0,390.0,2.0,179.0,15.0,2.0,155.0,115.0,8.0,499.0,499.0,138.0,3.0,17.0,99.0,4.0,390.0,2.0,179.0,15.0,2.0,155.0,115.0,1.0,53.0,0.0,55.0,63.0,16.0,99.0,4.0,21.0,499.0,192.0,4.0,390.0,2.0,179.0,95.0,24.0,3.0,54.0,8.0,499.0,7.0,85.0,44.0,10.0,8.0,499.0,499.0,499.0,499.0,7.0,123.0,499.0,11.0,78.0,53.0,100.0,3.0,18.0,36.0,302.0,499.0,24.0,186.0,3.0,17.0,390.0,2.0,247.0,179.0,15.0,2.0,155.0,115.0,499.0,55.0,63.0,16.0,99.0,4.0,21.0,499.0,192.0,4.0,390.0,2.0,179.0,95.0,24.0,3.0,54.0,8.0,499.0,7.0,85.0,44.0,10.0,8.0,499.0,499.0,499.0,499.0,7.0,123.0,499.0,11.0,78.0,53.0,100.0,3.0,18.0,36.0,302.0,499.0,24.0,186.0,3.0,17.0,390.0,2.0,247.0,179.0,15.0,2.0,155.0,115.0,499.0,1.0,45.0,0.0,36.0,499.0,499.0,16.0,14.0,14.0,27.0,499.0,14.0,14.0,30.0,16.0,108.0,42.0,153.0,499.0,3.0,18.0,46.0,458.0,108.0,27.0,122.0,8.0,499.0,179.0,169.0,180.0,9.0,60.0,21.0,499.0,4.0,499.0,499.0,4.0,499.0,12.0,147.0,3.0,17.0,499.0,499.0,499.0,36.0,499.0,499.0,16.0,14.0,14.0,27.0,499.0,14.0,14.0,30.0,16.0,108.0,42.0,153.0,499.0,3.0,18.0,46.0,458.0,108.0,27.0,122.0,8.0,499.0,179.0,169.0,180.0,9.0,60.0,21.0,499.0,4.0,499.0,499.0,4.0,499.0,12.0,147.0,3.0,17.0,499.0,499.0,499.0,1.0,6.0,0.0,47.0,295.0,247.0,22.0,12.0,47.0,295.0,247.0,22.0,12.0,1.0,19.0,0.0,53.0,499.0,3.0,17.0,11.0,499.0,48.0,499.0,9.0,3.0,18.0,40.0,499.0,27.0,499.0,4.0,499.0,499.0,53.0,499.0,3.0,17.0,11.0,499.0,48.0,499.0,9.0,3.0,18.0,40.0,499.0,27.0,499.0,4.0,499.0,499.0,1.0,36.0,0.0,6.0,3.0,110.0,31.0,4.0,122.0,9.0,499.0,25.0,45.0,3.0,18.0,55.0,124.0,15.0,299.0,9.0,499.0,499.0,3.0,54.0,40.0,499.0,9.0,4.0,122.0,8.0,499.0,499.0,499.0,179.0,499.0,15.0,189.0,499.0,6.0,3.0,110.0,31.0,4.0,122.0,9.0,499.0,25.0,45.0,3.0,18.0,55.0,124.0,15.0,299.0,9.0,499.0,499.0,3.0,54.0,40.0,499.0,9.0,4.0,122.0,8.0,499.0,499.0,499.0,179.0,499.0,15.0,189.0,499.0,1.0,29.0,0.0,32.0,8.0,302.0,499.0,66.0,56.0,499.0,55.0,63.0,7.0,56.0,499.0,499.0,452.0,6.0,161.0,38.0,3.0,17.0,200.0,2.0,499.0,13.0,302.0,499.0,8.0,499.0,139.0,32.0,8.0,302.0,499.0,66.0,56.0,499.0,55.0,63.0,7.0,56.0,499.0,499.0,452.0,6.0,161.0,38.0,3.0,17.0,200.0,2.0,499.0,13.0,302.0,499.0,8.0,499.0,139.0,1.0,17.0,0.0,9.0,3.0,18.0,42.0,31.0,11.0,12.0,499.0,67.0,4.0,27.0,280.0,46.0,499.0,37.0,44.0,9.0,3.0,18.0,42.0,31.0,11.0,12.0,499.0,67.0,4.0,27.0,280.0,46.0,499.0,37.0,44.0,1.0,13.0,0.0,6.0,3.0,71.0,499.0,4.0,499.0,499.0,4.0,499.0,499.0,32.0,499.0,6.0,3.0,71.0,499.0,4.0,499.0,499.0,4.0,499.0,499.0,32.0,499.0,1.0,16.0,0.0,143.0,9.0,33.0,499.0,9.0,68.0,9.0,138.0,3.0,17.0,99.0,4.0,21.0,206.0,499.0,143.0,9.0,33.0,499.0,9.0,68.0,9.0,138.0,3.0,17.0,99.0,4.0,21.0,206.0,499.0,1.0,4.0,0.0,27.0,499.0,499.0,27.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,16.0,0.0,24.0,38.0,3.0,17.0,50.0,499.0,19.0,79.0,102.0,121.0,11.0,499.0,201.0,36.0,499.0,24.0,38.0,3.0,17.0,50.0,499.0,19.0,79.0,102.0,121.0,11.0,499.0,201.0,36.0,499.0,1.0,8.0,0.0,24.0,50.0,499.0,52.0,11.0,499.0,9.0,24.0,50.0,499.0,52.0,11.0,499.0,9.0,1.0,31.0,0.0,137.0,8.0,499.0,499.0,499.0,53.0,272.0,499.0,334.0,12.0,121.0,24.0,3.0,120.0,206.0,499.0,7.0,112.0,22.0,2.0,499.0,4.0,122.0,499.0,26.0,11.0,499.0,4.0,499.0,9.0,137.0,8.0,499.0,499.0,499.0,53.0,272.0,499.0,334.0,12.0,121.0,24.0,3.0,120.0,206.0,499.0,7.0,112.0,22.0,2.0,499.0,4.0,122.0,499.0,26.0,11.0,499.0,4.0,499.0,9.0,1.0,33.0,0.0,6.0,499.0,262.0,93.0,2.0,499.0,499.0,15.0,46.0,8.0,113.0,499.0,19.0,499.0,412.0,15.0,499.0,499.0,6.0,328.0,2.0,499.0,259.0,499.0,193.0,20.0,386.0,15.0,8.0,499.0,499.0,499.0,6.0,499.0,262.0,93.0,2.0,499.0,499.0,15.0,46.0,8.0,113.0,499.0,19.0,499.0,412.0,15.0,499.0,499.0,6.0,328.0,2.0,499.0,259.0,499.0,193.0,20.0,386.0,15.0,8.0,499.0,499.0,499.0,1.0,11.0,0.0,7.0,39.0,499.0,131.0,75.0,499.0,386.0,499.0,7.0,107.0,7.0,39.0,499.0,131.0,75.0,499.0,386.0,499.0,7.0,107.0,1.0,10.0,0.0,317.0,13.0,316.0,499.0,5.0,499.0,5.0,499.0,386.0,317.0,13.0,316.0,499.0,5.0,499.0,5.0,499.0,386.0,1.0,5.0,0.0,386.0,386.0,247.0,499.0,386.0,386.0,247.0,499.0,1.0,11.0,0.0,9.0,29.0,499.0,137.0,4.0,499.0,63.0,135.0,2.0,76.0,9.0,29.0,499.0,137.0,4.0,499.0,63.0,135.0,2.0,76.0,1.0,18.0,0.0,9.0,160.0,499.0,7.0,59.0,10.0,43.0,77.0,88.0,499.0,499.0,4.0,499.0,77.0,58.0,499.0,386.0,9.0,160.0,499.0,7.0,59.0,10.0,43.0,77.0,88.0,499.0,499.0,4.0,499.0,77.0,58.0,499.0,386.0,1.0,11.0,0.0,6.0,65.0,6.0,112.0,22.0,499.0,10.0,12.0,499.0,499.0,6.0,65.0,6.0,112.0,22.0,499.0,10.0,12.0,499.0,499.0,1.0,10.0,0.0,12.0,499.0,92.0,499.0,31.0,8.0,499.0,499.0,300.0,12.0,499.0,92.0,499.0,31.0,8.0,499.0,499.0,300.0,1.0,12.0,0.0,55.0,25.0,499.0,499.0,60.0,499.0,499.0,32.0,8.0,244.0,499.0,55.0,25.0,499.0,499.0,60.0,499.0,499.0,32.0,8.0,244.0,499.0,1.0,21.0,0.0,499.0,29.0,8.0,499.0,499.0,19.0,8.0,242.0,499.0,499.0,15.0,2.0,499.0,93.0,11.0,174.0,61.0,90.0,374.0,499.0,499.0,29.0,8.0,499.0,499.0,19.0,8.0,242.0,499.0,499.0,15.0,2.0,499.0,93.0,11.0,174.0,61.0,90.0,374.0,499.0,1.0,9.0,0.0,85.0,49.0,56.0,46.0,499.0,499.0,20.0,499.0,85.0,49.0,56.0,46.0,499.0,499.0,20.0,499.0,1.0,18.0,0.0,499.0,59.0,499.0,10.0,499.0,19.0,424.0,7.0,499.0,8.0,499.0,499.0,4.0,499.0,70.0,499.0,211.0,499.0,59.0,499.0,10.0,499.0,19.0,424.0,7.0,499.0,8.0,499.0,499.0,4.0,499.0,70.0,499.0,211.0,1.0,18.0,0.0,72.0,388.0,424.0,4.0,499.0,8.0,499.0,499.0,23.0,424.0,499.0,69.0,43.0,15.0,2.0,499.0,499.0,72.0,388.0,424.0,4.0,499.0,8.0,499.0,499.0,23.0,424.0,499.0,69.0,43.0,15.0,2.0,499.0,499.0,1.0,30.0,0.0,30.0,499.0,2.0,499.0,10.0,8.0,447.0,211.0,253.0,32.0,46.0,499.0,175.0,211.0,499.0,15.0,7.0,499.0,73.0,2.0,464.0,25.0,147.0,3.0,17.0,499.0,499.0,19.0,499.0,30.0,499.0,2.0,499.0,10.0,8.0,447.0,211.0,253.0,32.0,46.0,499.0,175.0,211.0,499.0,15.0,7.0,499.0,73.0,2.0,464.0,25.0,147.0,3.0,17.0,499.0,499.0,19.0,499.0,1.0,20.0,0.0,499.0,9.0,75.0,147.0,3.0,17.0,499.0,499.0,2.0,499.0,211.0,499.0,33.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,9.0,75.0,147.0,3.0,17.0,499.0,499.0,2.0,499.0,211.0,499.0,33.0,499.0,499.0,499.0,15.0,499.0,499.0,1.0,28.0,0.0,6.0,499.0,332.0,265.0,31.0,30.0,68.0,11.0,271.0,31.0,253.0,8.0,499.0,93.0,33.0,135.0,11.0,346.0,499.0,61.0,7.0,36.0,499.0,499.0,11.0,19.0,499.0,6.0,499.0,332.0,265.0,31.0,30.0,68.0,11.0,271.0,31.0,253.0,8.0,499.0,93.0,33.0,135.0,11.0,346.0,499.0,61.0,7.0,36.0,499.0,499.0,11.0,19.0,499.0,1.0,11.0,0.0,53.0,6.0,60.0,51.0,4.0,21.0,20.0,208.0,31.0,11.0,53.0,6.0,60.0,51.0,4.0,21.0,20.0,208.0,31.0,11.0,1.0,39.0,0.0,6.0,3.0,71.0,27.0,99.0,4.0,335.0,11.0,4.0,499.0,33.0,162.0,25.0,499.0,11.0,499.0,40.0,38.0,3.0,17.0,350.0,499.0,10.0,79.0,11.0,499.0,4.0,21.0,499.0,7.0,38.0,3.0,17.0,178.0,73.0,20.0,146.0,219.0,6.0,3.0,71.0,27.0,99.0,4.0,335.0,11.0,4.0,499.0,33.0,162.0,25.0,499.0,11.0,499.0,40.0,38.0,3.0,17.0,350.0,499.0,10.0,79.0,11.0,499.0,4.0,21.0,499.0,7.0,38.0,3.0,17.0,178.0,73.0,20.0,146.0,219.0,1.0,21.0,0.0,499.0,499.0,499.0,62.0,499.0,4.0,2.0,499.0,3.0,18.0,499.0,93.0,499.0,499.0,4.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,499.0,62.0,499.0,4.0,2.0,499.0,3.0,18.0,499.0,93.0,499.0,499.0,4.0,499.0,499.0,499.0,2.0,499.0,1.0,13.0,0.0,499.0,2.0,499.0,150.0,499.0,207.0,157.0,4.0,39.0,499.0,16.0,499.0,499.0,2.0,499.0,150.0,499.0,207.0,157.0,4.0,39.0,499.0,16.0,499.0,1.0,32.0,0.0,2.0,232.0,12.0,207.0,499.0,106.0,499.0,15.0,499.0,10.0,106.0,200.0,499.0,16.0,77.0,58.0,499.0,2.0,499.0,150.0,499.0,499.0,66.0,499.0,8.0,389.0,499.0,4.0,21.0,15.0,499.0,2.0,232.0,12.0,207.0,499.0,106.0,499.0,15.0,499.0,10.0,106.0,200.0,499.0,16.0,77.0,58.0,499.0,2.0,499.0,150.0,499.0,499.0,66.0,499.0,8.0,389.0,499.0,4.0,21.0,15.0,499.0,1.0,18.0,0.0,141.0,419.0,106.0,499.0,9.0,217.0,31.0,24.0,116.0,62.0,305.0,12.0,24.0,499.0,106.0,4.0,499.0,141.0,419.0,106.0,499.0,9.0,217.0,31.0,24.0,116.0,62.0,305.0,12.0,24.0,499.0,106.0,4.0,499.0,1.0,5.0,0.0,6.0,416.0,24.0,51.0,6.0,416.0,24.0,51.0,1.0,30.0,0.0,394.0,12.0,499.0,397.0,499.0,2.0,499.0,433.0,4.0,70.0,499.0,499.0,4.0,499.0,244.0,499.0,499.0,10.0,499.0,15.0,2.0,499.0,7.0,12.0,3.0,18.0,499.0,27.0,499.0,394.0,12.0,499.0,397.0,499.0,2.0,499.0,433.0,4.0,70.0,499.0,499.0,4.0,499.0,244.0,499.0,499.0,10.0,499.0,15.0,2.0,499.0,7.0,12.0,3.0,18.0,499.0,27.0,499.0,1.0,9.0,0.0,6.0,65.0,11.0,366.0,21.0,499.0,39.0,124.0,6.0,65.0,11.0,366.0,21.0,499.0,39.0,124.0,1.0,13.0,0.0,8.0,302.0,16.0,8.0,499.0,84.0,499.0,11.0,4.0,472.0,87.0,499.0,8.0,302.0,16.0,8.0,499.0,84.0,499.0,11.0,4.0,472.0,87.0,499.0,1.0,22.0,0.0,27.0,137.0,188.0,263.0,499.0,45.0,3.0,18.0,219.0,499.0,19.0,42.0,4.0,122.0,499.0,499.0,84.0,267.0,73.0,15.0,499.0,27.0,137.0,188.0,263.0,499.0,45.0,3.0,18.0,219.0,499.0,19.0,42.0,4.0,122.0,499.0,499.0,84.0,267.0,73.0,15.0,499.0,1.0,46.0,0.0,6.0,3.0,71.0,27.0,499.0,20.0,499.0,499.0,33.0,76.0,42.0,66.0,499.0,4.0,472.0,6.0,3.0,71.0,499.0,20.0,42.0,66.0,186.0,3.0,17.0,499.0,178.0,76.0,3.0,18.0,499.0,37.0,340.0,52.0,24.0,50.0,499.0,25.0,45.0,3.0,18.0,8.0,302.0,37.0,495.0,6.0,3.0,71.0,27.0,499.0,20.0,499.0,499.0,33.0,76.0,42.0,66.0,499.0,4.0,472.0,6.0,3.0,71.0,499.0,20.0,42.0,66.0,186.0,3.0,17.0,499.0,178.0,76.0,3.0,18.0,499.0,37.0,340.0,52.0,24.0,50.0,499.0,25.0,45.0,3.0,18.0,8.0,302.0,37.0,495.0,1.0,10.0,0.0,2.0,499.0,16.0,499.0,58.0,499.0,69.0,2.0,499.0,2.0,499.0,16.0,499.0,58.0,499.0,69.0,2.0,499.0,1.0,18.0,0.0,345.0,11.0,19.0,2.0,499.0,499.0,6.0,60.0,31.0,4.0,499.0,19.0,2.0,499.0,499.0,342.0,499.0,345.0,11.0,19.0,2.0,499.0,499.0,6.0,60.0,31.0,4.0,499.0,19.0,2.0,499.0,499.0,342.0,499.0,1.0,25.0,0.0,6.0,341.0,9.0,37.0,39.0,339.0,499.0,25.0,338.0,3.0,17.0,81.0,173.0,4.0,50.0,9.0,499.0,6.0,345.0,11.0,196.0,19.0,30.0,499.0,6.0,341.0,9.0,37.0,39.0,339.0,499.0,25.0,338.0,3.0,17.0,81.0,173.0,4.0,50.0,9.0,499.0,6.0,345.0,11.0,196.0,19.0,30.0,499.0,1.0,4.0,0.0,96.0,499.0,499.0,96.0,499.0,499.0,1.0,99.0,0.0,478.0,499.0,7.0,22.0,499.0,44.0,499.0,275.0,19.0,2.0,194.0,242.0,237.0,499.0,159.0,499.0,56.0,81.0,499.0,334.0,2.0,499.0,7.0,93.0,7.0,6.0,95.0,55.0,499.0,37.0,44.0,27.0,4.0,499.0,371.0,170.0,47.0,38.0,3.0,17.0,22.0,70.0,317.0,499.0,499.0,15.0,134.0,259.0,76.0,85.0,499.0,84.0,6.0,38.0,3.0,17.0,92.0,499.0,7.0,499.0,66.0,47.0,3.0,109.0,116.0,156.0,32.0,378.0,499.0,499.0,3.0,17.0,77.0,81.0,12.0,96.0,15.0,2.0,499.0,499.0,41.0,108.0,178.0,371.0,499.0,10.0,8.0,499.0,430.0,15.0,2.0,499.0,499.0,31.0,499.0,16.0,499.0,67.0,478.0,499.0,7.0,22.0,499.0,44.0,499.0,275.0,19.0,2.0,194.0,242.0,237.0,499.0,159.0,499.0,56.0,81.0,499.0,334.0,2.0,499.0,7.0,93.0,7.0,6.0,95.0,55.0,499.0,37.0,44.0,27.0,4.0,499.0,371.0,170.0,47.0,38.0,3.0,17.0,22.0,70.0,317.0,499.0,499.0,15.0,134.0,259.0,76.0,85.0,499.0,84.0,6.0,38.0,3.0,17.0,92.0,499.0,7.0,499.0,66.0,47.0,3.0,109.0,116.0,156.0,32.0,378.0,499.0,499.0,3.0,17.0,77.0,81.0,12.0,96.0,15.0,2.0,499.0,499.0,41.0,108.0,178.0,371.0,499.0,10.0,8.0,499.0,430.0,15.0,2.0,499.0,499.0,31.0,499.0,16.0,499.0,67.0,1.0,37.0,0.0,47.0,38.0,3.0,17.0,22.0,8.0,296.0,378.0,15.0,2.0,499.0,72.0,499.0,7.0,499.0,66.0,202.0,3.0,17.0,148.0,97.0,15.0,8.0,499.0,499.0,194.0,499.0,41.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,499.0,47.0,38.0,3.0,17.0,22.0,8.0,296.0,378.0,15.0,2.0,499.0,72.0,499.0,7.0,499.0,66.0,202.0,3.0,17.0,148.0,97.0,15.0,8.0,499.0,499.0,194.0,499.0,41.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,499.0,1.0,8.0,0.0,6.0,3.0,71.0,27.0,299.0,499.0,100.0,6.0,3.0,71.0,27.0,299.0,499.0,100.0,1.0,46.0,0.0,6.0,406.0,12.0,134.0,499.0,499.0,3.0,17.0,81.0,12.0,96.0,12.0,3.0,18.0,108.0,6.0,38.0,3.0,17.0,50.0,108.0,47.0,38.0,3.0,17.0,118.0,499.0,159.0,499.0,12.0,3.0,18.0,108.0,6.0,186.0,3.0,17.0,118.0,499.0,499.0,256.0,31.0,499.0,7.0,499.0,6.0,406.0,12.0,134.0,499.0,499.0,3.0,17.0,81.0,12.0,96.0,12.0,3.0,18.0,108.0,6.0,38.0,3.0,17.0,50.0,108.0,47.0,38.0,3.0,17.0,118.0,499.0,159.0,499.0,12.0,3.0,18.0,108.0,6.0,186.0,3.0,17.0,118.0,499.0,499.0,256.0,31.0,499.0,7.0,499.0,1.0,52.0,0.0,164.0,499.0,28.0,499.0,411.0,47.0,163.0,3.0,17.0,499.0,26.0,47.0,38.0,3.0,17.0,225.0,43.0,41.0,26.0,11.0,104.0,4.0,499.0,20.0,76.0,256.0,6.0,60.0,151.0,118.0,58.0,499.0,256.0,7.0,27.0,256.0,66.0,341.0,20.0,307.0,76.0,93.0,306.0,10.0,98.0,212.0,31.0,499.0,499.0,7.0,499.0,164.0,499.0,28.0,499.0,411.0,47.0,163.0,3.0,17.0,499.0,26.0,47.0,38.0,3.0,17.0,225.0,43.0,41.0,26.0,11.0,104.0,4.0,499.0,20.0,76.0,256.0,6.0,60.0,151.0,118.0,58.0,499.0,256.0,7.0,27.0,256.0,66.0,341.0,20.0,307.0,76.0,93.0,306.0,10.0,98.0,212.0,31.0,499.0,499.0,7.0,499.0,1.0,10.0,0.0,38.0,3.0,17.0,40.0,143.0,43.0,93.0,5.0,135.0,38.0,3.0,17.0,40.0,143.0,43.0,93.0,5.0,135.0,1.0,24.0,0.0,6.0,143.0,499.0,93.0,99.0,61.0,7.0,499.0,23.0,2.0,246.0,171.0,7.0,39.0,499.0,22.0,151.0,81.0,499.0,7.0,39.0,499.0,499.0,6.0,143.0,499.0,93.0,99.0,61.0,7.0,499.0,23.0,2.0,246.0,171.0,7.0,39.0,499.0,22.0,151.0,81.0,499.0,7.0,39.0,499.0,499.0,1.0,7.0,0.0,183.0,34.0,21.0,224.0,23.0,499.0,183.0,34.0,21.0,224.0,23.0,499.0,1.0,5.0,0.0,499.0,5.0,5.0,80.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,47.0,0.0,35.0,26.0,11.0,92.0,499.0,143.0,59.0,15.0,20.0,11.0,2.0,499.0,499.0,72.0,56.0,119.0,499.0,15.0,9.0,44.0,10.0,2.0,499.0,28.0,499.0,86.0,164.0,119.0,499.0,41.0,9.0,3.0,18.0,437.0,499.0,4.0,50.0,43.0,86.0,499.0,69.0,137.0,44.0,2.0,499.0,499.0,35.0,26.0,11.0,92.0,499.0,143.0,59.0,15.0,20.0,11.0,2.0,499.0,499.0,72.0,56.0,119.0,499.0,15.0,9.0,44.0,10.0,2.0,499.0,28.0,499.0,86.0,164.0,119.0,499.0,41.0,9.0,3.0,18.0,437.0,499.0,4.0,50.0,43.0,86.0,499.0,69.0,137.0,44.0,2.0,499.0,499.0,1.0,24.0,0.0,89.0,441.0,499.0,45.0,16.0,499.0,32.0,6.0,499.0,4.0,52.0,6.0,150.0,499.0,262.0,15.0,499.0,84.0,16.0,53.0,6.0,499.0,4.0,89.0,441.0,499.0,45.0,16.0,499.0,32.0,6.0,499.0,4.0,52.0,6.0,150.0,499.0,262.0,15.0,499.0,84.0,16.0,53.0,6.0,499.0,4.0,1.0,97.0,0.0,6.0,499.0,61.0,2.0,14.0,499.0,14.0,10.0,2.0,118.0,10.0,499.0,499.0,499.0,499.0,30.0,138.0,3.0,17.0,499.0,9.0,3.0,18.0,446.0,7.0,41.0,499.0,41.0,42.0,38.0,3.0,17.0,22.0,189.0,499.0,8.0,499.0,163.0,3.0,17.0,118.0,2.0,144.0,499.0,4.0,499.0,4.0,499.0,26.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,499.0,3.0,54.0,226.0,23.0,8.0,499.0,64.0,457.0,499.0,237.0,499.0,32.0,26.0,9.0,131.0,8.0,374.0,499.0,6.0,499.0,61.0,2.0,14.0,499.0,14.0,10.0,2.0,118.0,10.0,499.0,499.0,499.0,499.0,30.0,138.0,3.0,17.0,499.0,9.0,3.0,18.0,446.0,7.0,41.0,499.0,41.0,42.0,38.0,3.0,17.0,22.0,189.0,499.0,8.0,499.0,163.0,3.0,17.0,118.0,2.0,144.0,499.0,4.0,499.0,4.0,499.0,26.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,499.0,3.0,54.0,226.0,23.0,8.0,499.0,64.0,457.0,499.0,237.0,499.0,32.0,26.0,9.0,131.0,8.0,374.0,499.0,1.0,12.0,0.0,7.0,11.0,22.0,187.0,499.0,53.0,6.0,499.0,7.0,39.0,124.0,7.0,11.0,22.0,187.0,499.0,53.0,6.0,499.0,7.0,39.0,124.0,1.0,21.0,0.0,89.0,6.0,3.0,110.0,92.0,31.0,4.0,95.0,26.0,203.0,56.0,260.0,199.0,9.0,100.0,3.0,499.0,5.0,5.0,499.0,89.0,6.0,3.0,110.0,92.0,31.0,4.0,95.0,26.0,203.0,56.0,260.0,199.0,9.0,100.0,3.0,499.0,5.0,5.0,499.0,1.0,76.0,0.0,35.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,468.0,13.0,499.0,13.0,499.0,5.0,8.0,276.0,180.0,8.0,499.0,499.0,90.0,499.0,3.0,18.0,499.0,473.0,46.0,499.0,3.0,18.0,499.0,29.0,499.0,499.0,68.0,2.0,499.0,202.0,3.0,17.0,22.0,499.0,477.0,4.0,499.0,90.0,499.0,89.0,25.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,88.0,499.0,499.0,499.0,153.0,354.0,499.0,477.0,499.0,499.0,33.0,499.0,499.0,35.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,468.0,13.0,499.0,13.0,499.0,5.0,8.0,276.0,180.0,8.0,499.0,499.0,90.0,499.0,3.0,18.0,499.0,473.0,46.0,499.0,3.0,18.0,499.0,29.0,499.0,499.0,68.0,2.0,499.0,202.0,3.0,17.0,22.0,499.0,477.0,4.0,499.0,90.0,499.0,89.0,25.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,88.0,499.0,499.0,499.0,153.0,354.0,499.0,477.0,499.0,499.0,33.0,499.0,499.0,1.0,30.0,0.0,68.0,499.0,499.0,499.0,499.0,499.0,499.0,4.0,264.0,2.0,499.0,499.0,88.0,8.0,499.0,499.0,12.0,499.0,29.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,86.0,90.0,499.0,68.0,499.0,499.0,499.0,499.0,499.0,499.0,4.0,264.0,2.0,499.0,499.0,88.0,8.0,499.0,499.0,12.0,499.0,29.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,86.0,90.0,499.0,1.0,68.0,0.0,499.0,499.0,3.0,499.0,273.0,499.0,499.0,55.0,499.0,499.0,499.0,60.0,22.0,4.0,21.0,499.0,7.0,30.0,60.0,21.0,155.0,390.0,499.0,52.0,49.0,268.0,3.0,17.0,136.0,499.0,32.0,397.0,499.0,25.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,61.0,499.0,101.0,69.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,278.0,2.0,499.0,499.0,61.0,10.0,43.0,214.0,32.0,96.0,32.0,499.0,499.0,499.0,499.0,3.0,499.0,273.0,499.0,499.0,55.0,499.0,499.0,499.0,60.0,22.0,4.0,21.0,499.0,7.0,30.0,60.0,21.0,155.0,390.0,499.0,52.0,49.0,268.0,3.0,17.0,136.0,499.0,32.0,397.0,499.0,25.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,61.0,499.0,101.0,69.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,278.0,2.0,499.0,499.0,61.0,10.0,43.0,214.0,32.0,96.0,32.0,499.0,499.0,1.0,13.0,0.0,6.0,38.0,3.0,17.0,95.0,146.0,31.0,12.0,23.0,2.0,499.0,499.0,6.0,38.0,3.0,17.0,95.0,146.0,31.0,12.0,23.0,2.0,499.0,499.0,1.0,14.0,0.0,147.0,3.0,17.0,130.0,154.0,27.0,45.0,25.0,6.0,160.0,499.0,10.0,9.0,147.0,3.0,17.0,130.0,154.0,27.0,45.0,25.0,6.0,160.0,499.0,10.0,9.0,1.0,26.0,0.0,2.0,155.0,499.0,499.0,22.0,7.0,499.0,499.0,15.0,2.0,499.0,12.0,34.0,21.0,199.0,19.0,344.0,499.0,499.0,31.0,8.0,499.0,499.0,33.0,499.0,2.0,155.0,499.0,499.0,22.0,7.0,499.0,499.0,15.0,2.0,499.0,12.0,34.0,21.0,199.0,19.0,344.0,499.0,499.0,31.0,8.0,499.0,499.0,33.0,499.0,1.0,10.0,0.0,499.0,8.0,499.0,499.0,138.0,3.0,17.0,87.0,499.0,499.0,8.0,499.0,499.0,138.0,3.0,17.0,87.0,499.0,1.0,14.0,0.0,28.0,11.0,199.0,4.0,499.0,23.0,499.0,33.0,20.0,499.0,499.0,37.0,499.0,28.0,11.0,199.0,4.0,499.0,23.0,499.0,33.0,20.0,499.0,499.0,37.0,499.0,1.0,15.0,0.0,6.0,65.0,14.0,71.0,14.0,16.0,63.0,10.0,2.0,103.0,494.0,499.0,271.0,499.0,6.0,65.0,14.0,71.0,14.0,16.0,63.0,10.0,2.0,103.0,494.0,499.0,271.0,499.0,1.0,22.0,0.0,499.0,499.0,92.0,206.0,499.0,118.0,10.0,271.0,499.0,19.0,8.0,499.0,66.0,88.0,499.0,479.0,499.0,499.0,37.0,2.0,121.0,499.0,499.0,92.0,206.0,499.0,118.0,10.0,271.0,499.0,19.0,8.0,499.0,66.0,88.0,499.0,479.0,499.0,499.0,37.0,2.0,121.0,1.0,22.0,0.0,102.0,10.0,2.0,359.0,16.0,187.0,499.0,84.0,499.0,4.0,2.0,499.0,19.0,67.0,7.0,2.0,499.0,12.0,2.0,359.0,499.0,102.0,10.0,2.0,359.0,16.0,187.0,499.0,84.0,499.0,4.0,2.0,499.0,19.0,67.0,7.0,2.0,499.0,12.0,2.0,359.0,499.0,1.0,17.0,0.0,45.0,3.0,18.0,160.0,92.0,8.0,499.0,271.0,499.0,176.0,499.0,10.0,499.0,16.0,499.0,411.0,45.0,3.0,18.0,160.0,92.0,8.0,499.0,271.0,499.0,176.0,499.0,10.0,499.0,16.0,499.0,411.0,1.0,12.0,0.0,77.0,499.0,499.0,3.0,18.0,499.0,16.0,499.0,4.0,2.0,499.0,77.0,499.0,499.0,3.0,18.0,499.0,16.0,499.0,4.0,2.0,499.0,1.0,14.0,0.0,30.0,16.0,499.0,32.0,9.0,16.0,224.0,499.0,10.0,5.0,94.0,5.0,499.0,30.0,16.0,499.0,32.0,9.0,16.0,224.0,499.0,10.0,5.0,94.0,5.0,499.0,1.0,5.0,0.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,30.0,115.0,147.0,3.0,17.0,499.0,499.0,2.0,144.0,117.0,30.0,115.0,147.0,3.0,17.0,499.0,499.0,2.0,144.0,117.0,1.0,18.0,0.0,7.0,170.0,11.0,160.0,316.0,74.0,4.0,22.0,499.0,36.0,499.0,28.0,196.0,499.0,7.0,499.0,499.0,7.0,170.0,11.0,160.0,316.0,74.0,4.0,22.0,499.0,36.0,499.0,28.0,196.0,499.0,7.0,499.0,499.0,1.0,18.0,0.0,108.0,38.0,3.0,17.0,11.0,316.0,74.0,19.0,499.0,305.0,284.0,4.0,36.0,499.0,3.0,18.0,499.0,108.0,38.0,3.0,17.0,11.0,316.0,74.0,19.0,499.0,305.0,284.0,4.0,36.0,499.0,3.0,18.0,499.0,1.0,10.0,0.0,499.0,448.0,4.0,499.0,39.0,499.0,16.0,87.0,218.0,499.0,448.0,4.0,499.0,39.0,499.0,16.0,87.0,218.0,1.0,24.0,0.0,2.0,83.0,16.0,87.0,96.0,25.0,2.0,499.0,10.0,9.0,147.0,3.0,17.0,499.0,4.0,499.0,499.0,4.0,2.0,499.0,33.0,2.0,499.0,2.0,83.0,16.0,87.0,96.0,25.0,2.0,499.0,10.0,9.0,147.0,3.0,17.0,499.0,4.0,499.0,499.0,4.0,2.0,499.0,33.0,2.0,499.0,1.0,24.0,0.0,84.0,16.0,8.0,499.0,10.0,2.0,83.0,32.0,9.0,147.0,3.0,17.0,499.0,11.0,15.0,83.0,20.0,146.0,19.0,499.0,499.0,499.0,499.0,84.0,16.0,8.0,499.0,10.0,2.0,83.0,32.0,9.0,147.0,3.0,17.0,499.0,11.0,15.0,83.0,20.0,146.0,19.0,499.0,499.0,499.0,499.0,1.0,49.0,0.0,41.0,60.0,9.0,499.0,21.0,499.0,4.0,499.0,171.0,44.0,134.0,499.0,499.0,23.0,499.0,499.0,334.0,2.0,499.0,7.0,85.0,118.0,12.0,144.0,499.0,499.0,20.0,2.0,499.0,334.0,2.0,499.0,5.0,499.0,499.0,170.0,9.0,3.0,18.0,2.0,155.0,499.0,499.0,12.0,60.0,21.0,499.0,126.0,41.0,60.0,9.0,499.0,21.0,499.0,4.0,499.0,171.0,44.0,134.0,499.0,499.0,23.0,499.0,499.0,334.0,2.0,499.0,7.0,85.0,118.0,12.0,144.0,499.0,499.0,20.0,2.0,499.0,334.0,2.0,499.0,5.0,499.0,499.0,170.0,9.0,3.0,18.0,2.0,155.0,499.0,499.0,12.0,60.0,21.0,499.0,126.0,1.0,9.0,0.0,6.0,435.0,499.0,7.0,499.0,5.0,5.0,499.0,6.0,435.0,499.0,7.0,499.0,5.0,5.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,74.0,499.0,499.0,35.0,5.0,499.0,74.0,499.0,499.0,1.0,25.0,0.0,46.0,499.0,220.0,7.0,8.0,87.0,499.0,499.0,10.0,2.0,499.0,10.0,499.0,499.0,15.0,248.0,499.0,499.0,499.0,15.0,499.0,5.0,5.0,499.0,46.0,499.0,220.0,7.0,8.0,87.0,499.0,499.0,10.0,2.0,499.0,10.0,499.0,499.0,15.0,248.0,499.0,499.0,499.0,15.0,499.0,5.0,5.0,499.0,1.0,19.0,0.0,35.0,5.0,499.0,16.0,75.0,87.0,96.0,25.0,499.0,58.0,23.0,499.0,10.0,499.0,427.0,69.0,499.0,499.0,35.0,5.0,499.0,16.0,75.0,87.0,96.0,25.0,499.0,58.0,23.0,499.0,10.0,499.0,427.0,69.0,499.0,499.0,1.0,2.0,0.0,55.0,55.0,1.0,20.0,0.0,499.0,56.0,58.0,287.0,15.0,499.0,69.0,499.0,288.0,499.0,287.0,34.0,122.0,58.0,384.0,69.0,499.0,8.0,287.0,499.0,56.0,58.0,287.0,15.0,499.0,69.0,499.0,288.0,499.0,287.0,34.0,122.0,58.0,384.0,69.0,499.0,8.0,287.0,1.0,22.0,0.0,499.0,62.0,72.0,350.0,154.0,499.0,499.0,499.0,26.0,44.0,499.0,287.0,350.0,7.0,44.0,499.0,287.0,499.0,499.0,5.0,499.0,499.0,62.0,72.0,350.0,154.0,499.0,499.0,499.0,26.0,44.0,499.0,287.0,350.0,7.0,44.0,499.0,287.0,499.0,499.0,5.0,499.0,1.0,3.0,0.0,41.0,55.0,41.0,55.0,1.0,5.0,0.0,393.0,332.0,48.0,499.0,393.0,332.0,48.0,499.0,1.0,15.0,0.0,51.0,12.0,19.0,8.0,242.0,418.0,85.0,11.0,3.0,109.0,22.0,8.0,101.0,458.0,51.0,12.0,19.0,8.0,242.0,418.0,85.0,11.0,3.0,109.0,22.0,8.0,101.0,458.0,1.0,11.0,0.0,42.0,38.0,3.0,17.0,40.0,499.0,43.0,153.0,499.0,146.0,42.0,38.0,3.0,17.0,40.0,499.0,43.0,153.0,499.0,146.0,1.0,16.0,0.0,47.0,50.0,86.0,9.0,135.0,418.0,10.0,332.0,48.0,414.0,201.0,499.0,332.0,499.0,410.0,47.0,50.0,86.0,9.0,135.0,418.0,10.0,332.0,48.0,414.0,201.0,499.0,332.0,499.0,410.0,1.0,5.0,0.0,393.0,499.0,12.0,499.0,393.0,499.0,12.0,499.0,1.0,3.0,0.0,499.0,55.0,499.0,55.0,1.0,9.0,0.0,12.0,3.0,18.0,27.0,2.0,117.0,499.0,181.0,12.0,3.0,18.0,27.0,2.0,117.0,499.0,181.0,1.0,32.0,0.0,11.0,38.0,3.0,17.0,499.0,208.0,66.0,56.0,55.0,499.0,7.0,85.0,499.0,12.0,49.0,3.0,109.0,499.0,61.0,8.0,117.0,4.0,50.0,9.0,479.0,499.0,49.0,3.0,18.0,15.0,499.0,11.0,38.0,3.0,17.0,499.0,208.0,66.0,56.0,55.0,499.0,7.0,85.0,499.0,12.0,49.0,3.0,109.0,499.0,61.0,8.0,117.0,4.0,50.0,9.0,479.0,499.0,49.0,3.0,18.0,15.0,499.0,1.0,26.0,0.0,11.0,3.0,54.0,397.0,499.0,208.0,23.0,8.0,499.0,24.0,241.0,33.0,241.0,27.0,240.0,84.0,6.0,421.0,29.0,53.0,499.0,3.0,499.0,29.0,473.0,11.0,3.0,54.0,397.0,499.0,208.0,23.0,8.0,499.0,24.0,241.0,33.0,241.0,27.0,240.0,84.0,6.0,421.0,29.0,53.0,499.0,3.0,499.0,29.0,473.0,1.0,18.0,0.0,37.0,236.0,499.0,31.0,499.0,33.0,499.0,22.0,2.0,499.0,499.0,4.0,50.0,53.0,24.0,123.0,479.0,37.0,236.0,499.0,31.0,499.0,33.0,499.0,22.0,2.0,499.0,499.0,4.0,50.0,53.0,24.0,123.0,479.0,1.0,12.0,0.0,6.0,65.0,30.0,16.0,114.0,12.0,499.0,8.0,177.0,10.0,42.0,6.0,65.0,30.0,16.0,114.0,12.0,499.0,8.0,177.0,10.0,42.0,1.0,36.0,0.0,9.0,3.0,18.0,27.0,48.0,66.0,29.0,15.0,2.0,107.0,33.0,66.0,29.0,15.0,2.0,499.0,9.0,403.0,171.0,4.0,381.0,499.0,499.0,7.0,99.0,499.0,15.0,63.0,499.0,37.0,2.0,267.0,10.0,2.0,145.0,9.0,3.0,18.0,27.0,48.0,66.0,29.0,15.0,2.0,107.0,33.0,66.0,29.0,15.0,2.0,499.0,9.0,403.0,171.0,4.0,381.0,499.0,499.0,7.0,99.0,499.0,15.0,63.0,499.0,37.0,2.0,267.0,10.0,2.0,145.0,1.0,7.0,0.0,6.0,186.0,3.0,17.0,123.0,499.0,6.0,186.0,3.0,17.0,123.0,499.0,1.0,9.0,0.0,9.0,34.0,235.0,20.0,44.0,76.0,499.0,499.0,9.0,34.0,235.0,20.0,44.0,76.0,499.0,499.0,1.0,6.0,0.0,499.0,290.0,5.0,5.0,204.0,499.0,290.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,25.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,64.0,499.0,499.0,463.0,499.0,20.0,8.0,319.0,499.0,499.0,499.0,499.0,64.0,499.0,499.0,499.0,20.0,43.0,35.0,5.0,140.0,5.0,499.0,499.0,64.0,499.0,499.0,463.0,499.0,20.0,8.0,319.0,499.0,499.0,499.0,499.0,64.0,499.0,499.0,499.0,20.0,43.0,1.0,28.0,0.0,41.0,499.0,36.0,499.0,74.0,499.0,499.0,499.0,20.0,499.0,11.0,3.0,54.0,499.0,499.0,499.0,36.0,499.0,499.0,58.0,499.0,15.0,499.0,499.0,74.0,11.0,499.0,41.0,499.0,36.0,499.0,74.0,499.0,499.0,499.0,20.0,499.0,11.0,3.0,54.0,499.0,499.0,499.0,36.0,499.0,499.0,58.0,499.0,15.0,499.0,499.0,74.0,11.0,499.0,1.0,13.0,0.0,24.0,62.0,143.0,72.0,63.0,499.0,4.0,499.0,499.0,15.0,57.0,499.0,24.0,62.0,143.0,72.0,63.0,499.0,4.0,499.0,499.0,15.0,57.0,499.0,1.0,15.0,0.0,499.0,499.0,499.0,75.0,499.0,43.0,499.0,32.0,26.0,24.0,88.0,295.0,81.0,499.0,499.0,499.0,499.0,75.0,499.0,43.0,499.0,32.0,26.0,24.0,88.0,295.0,81.0,499.0,1.0,23.0,0.0,499.0,52.0,11.0,499.0,8.0,310.0,499.0,4.0,46.0,499.0,499.0,74.0,11.0,499.0,15.0,12.0,310.0,62.0,194.0,15.0,499.0,499.0,499.0,52.0,11.0,499.0,8.0,310.0,499.0,4.0,46.0,499.0,499.0,74.0,11.0,499.0,15.0,12.0,310.0,62.0,194.0,15.0,499.0,499.0,1.0,10.0,0.0,75.0,2.0,310.0,62.0,350.0,499.0,499.0,499.0,499.0,75.0,2.0,310.0,62.0,350.0,499.0,499.0,499.0,499.0,1.0,4.0,0.0,249.0,12.0,497.0,249.0,12.0,497.0,1.0,26.0,0.0,324.0,9.0,3.0,18.0,40.0,67.0,136.0,499.0,499.0,499.0,9.0,16.0,25.0,6.0,151.0,499.0,2.0,499.0,15.0,12.0,497.0,499.0,9.0,4.0,499.0,324.0,9.0,3.0,18.0,40.0,67.0,136.0,499.0,499.0,499.0,9.0,16.0,25.0,6.0,151.0,499.0,2.0,499.0,15.0,12.0,497.0,499.0,9.0,4.0,499.0,1.0,29.0,0.0,33.0,77.0,9.0,3.0,18.0,8.0,499.0,13.0,303.0,139.0,7.0,2.0,9.0,3.0,18.0,2.0,499.0,10.0,499.0,499.0,12.0,3.0,18.0,189.0,7.0,488.0,4.0,475.0,33.0,77.0,9.0,3.0,18.0,8.0,499.0,13.0,303.0,139.0,7.0,2.0,9.0,3.0,18.0,2.0,499.0,10.0,499.0,499.0,12.0,3.0,18.0,189.0,7.0,488.0,4.0,475.0,1.0,7.0,0.0,6.0,31.0,4.0,65.0,105.0,102.0,6.0,31.0,4.0,65.0,105.0,102.0,1.0,11.0,0.0,19.0,59.0,42.0,9.0,14.0,16.0,14.0,8.0,499.0,499.0,19.0,59.0,42.0,9.0,14.0,16.0,14.0,8.0,499.0,499.0,1.0,50.0,0.0,59.0,42.0,22.0,499.0,12.0,28.0,499.0,74.0,57.0,499.0,15.0,2.0,499.0,499.0,16.0,8.0,499.0,499.0,12.0,6.0,38.0,3.0,17.0,65.0,499.0,4.0,103.0,10.0,43.0,84.0,241.0,21.0,499.0,25.0,28.0,499.0,19.0,103.0,152.0,499.0,16.0,499.0,48.0,2.0,499.0,10.0,2.0,499.0,499.0,59.0,42.0,22.0,499.0,12.0,28.0,499.0,74.0,57.0,499.0,15.0,2.0,499.0,499.0,16.0,8.0,499.0,499.0,12.0,6.0,38.0,3.0,17.0,65.0,499.0,4.0,103.0,10.0,43.0,84.0,241.0,21.0,499.0,25.0,28.0,499.0,19.0,103.0,152.0,499.0,16.0,499.0,48.0,2.0,499.0,10.0,2.0,499.0,499.0,1.0,7.0,0.0,100.0,3.0,18.0,8.0,499.0,499.0,100.0,3.0,18.0,8.0,499.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,80.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,290.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,15.0,0.0,35.0,5.0,446.0,5.0,499.0,5.0,11.0,13.0,499.0,13.0,50.0,13.0,499.0,5.0,35.0,5.0,446.0,5.0,499.0,5.0,11.0,13.0,499.0,13.0,50.0,13.0,499.0,5.0,1.0,15.0,0.0,49.0,3.0,18.0,161.0,87.0,252.0,4.0,148.0,32.0,26.0,11.0,313.0,2.0,83.0,49.0,3.0,18.0,161.0,87.0,252.0,4.0,148.0,32.0,26.0,11.0,313.0,2.0,83.0,1.0,34.0,0.0,49.0,75.0,56.0,499.0,25.0,42.0,31.0,227.0,28.0,105.0,499.0,4.0,499.0,12.0,61.0,7.0,306.0,40.0,123.0,49.0,3.0,18.0,499.0,499.0,40.0,68.0,11.0,499.0,178.0,70.0,421.0,86.0,9.0,49.0,75.0,56.0,499.0,25.0,42.0,31.0,227.0,28.0,105.0,499.0,4.0,499.0,12.0,61.0,7.0,306.0,40.0,123.0,49.0,3.0,18.0,499.0,499.0,40.0,68.0,11.0,499.0,178.0,70.0,421.0,86.0,9.0,1.0,14.0,0.0,499.0,16.0,499.0,16.0,97.0,499.0,49.0,3.0,18.0,40.0,320.0,7.0,499.0,499.0,16.0,499.0,16.0,97.0,499.0,49.0,3.0,18.0,40.0,320.0,7.0,499.0,1.0,25.0,0.0,499.0,108.0,49.0,3.0,18.0,194.0,23.0,2.0,499.0,499.0,68.0,49.0,499.0,499.0,4.0,2.0,83.0,7.0,27.0,192.0,42.0,148.0,30.0,499.0,499.0,108.0,49.0,3.0,18.0,194.0,23.0,2.0,499.0,499.0,68.0,49.0,499.0,499.0,4.0,2.0,83.0,7.0,27.0,192.0,42.0,148.0,30.0,499.0,1.0,23.0,0.0,2.0,139.0,16.0,12.0,499.0,13.0,449.0,499.0,499.0,3.0,17.0,92.0,70.0,205.0,69.0,2.0,231.0,13.0,449.0,499.0,24.0,499.0,2.0,139.0,16.0,12.0,499.0,13.0,449.0,499.0,499.0,3.0,17.0,92.0,70.0,205.0,69.0,2.0,231.0,13.0,449.0,499.0,24.0,499.0,1.0,31.0,0.0,24.0,40.0,499.0,2.0,231.0,13.0,449.0,499.0,8.0,258.0,7.0,499.0,2.0,499.0,499.0,499.0,281.0,31.0,499.0,499.0,33.0,8.0,231.0,499.0,303.0,19.0,499.0,13.0,449.0,306.0,24.0,40.0,499.0,2.0,231.0,13.0,449.0,499.0,8.0,258.0,7.0,499.0,2.0,499.0,499.0,499.0,281.0,31.0,499.0,499.0,33.0,8.0,231.0,499.0,303.0,19.0,499.0,13.0,449.0,306.0,1.0,20.0,0.0,2.0,499.0,256.0,499.0,4.0,30.0,194.0,499.0,7.0,88.0,55.0,499.0,20.0,9.0,52.0,9.0,29.0,341.0,191.0,2.0,499.0,256.0,499.0,4.0,30.0,194.0,499.0,7.0,88.0,55.0,499.0,20.0,9.0,52.0,9.0,29.0,341.0,191.0,1.0,6.0,0.0,9.0,397.0,499.0,499.0,273.0,9.0,397.0,499.0,499.0,273.0,1.0,6.0,0.0,499.0,5.0,499.0,19.0,499.0,499.0,5.0,499.0,19.0,499.0,1.0,6.0,0.0,499.0,16.0,499.0,273.0,499.0,499.0,16.0,499.0,273.0,499.0,1.0,10.0,0.0,7.0,499.0,16.0,499.0,34.0,148.0,23.0,9.0,190.0,7.0,499.0,16.0,499.0,34.0,148.0,23.0,9.0,190.0,1.0,4.0,0.0,9.0,329.0,61.0,9.0,329.0,61.0,1.0,25.0,0.0,7.0,36.0,499.0,259.0,56.0,499.0,39.0,499.0,259.0,23.0,499.0,15.0,2.0,499.0,41.0,6.0,65.0,499.0,7.0,499.0,62.0,21.0,218.0,499.0,7.0,36.0,499.0,259.0,56.0,499.0,39.0,499.0,259.0,23.0,499.0,15.0,2.0,499.0,41.0,6.0,65.0,499.0,7.0,499.0,62.0,21.0,218.0,499.0,1.0,31.0,0.0,499.0,25.0,26.0,9.0,213.0,499.0,391.0,10.0,165.0,499.0,84.0,9.0,62.0,85.0,26.0,11.0,338.0,3.0,17.0,163.0,2.0,83.0,20.0,12.0,499.0,11.0,62.0,225.0,20.0,499.0,499.0,25.0,26.0,9.0,213.0,499.0,391.0,10.0,165.0,499.0,84.0,9.0,62.0,85.0,26.0,11.0,338.0,3.0,17.0,163.0,2.0,83.0,20.0,12.0,499.0,11.0,62.0,225.0,20.0,499.0,1.0,15.0,0.0,9.0,499.0,105.0,499.0,45.0,268.0,3.0,17.0,192.0,499.0,4.0,27.0,51.0,9.0,9.0,499.0,105.0,499.0,45.0,268.0,3.0,17.0,192.0,499.0,4.0,27.0,51.0,9.0,1.0,21.0,0.0,499.0,6.0,95.0,53.0,60.0,499.0,21.0,8.0,96.0,333.0,499.0,4.0,67.0,6.0,40.0,499.0,9.0,32.0,8.0,499.0,499.0,6.0,95.0,53.0,60.0,499.0,21.0,8.0,96.0,333.0,499.0,4.0,67.0,6.0,40.0,499.0,9.0,32.0,8.0,499.0,1.0,14.0,0.0,15.0,39.0,229.0,37.0,236.0,176.0,447.0,499.0,6.0,95.0,16.0,8.0,499.0,15.0,39.0,229.0,37.0,236.0,176.0,447.0,499.0,6.0,95.0,16.0,8.0,499.0,1.0,30.0,0.0,133.0,26.0,6.0,3.0,71.0,197.0,23.0,238.0,7.0,6.0,246.0,499.0,8.0,499.0,23.0,39.0,200.0,20.0,12.0,144.0,96.0,333.0,6.0,3.0,109.0,21.0,44.0,172.0,9.0,133.0,26.0,6.0,3.0,71.0,197.0,23.0,238.0,7.0,6.0,246.0,499.0,8.0,499.0,23.0,39.0,200.0,20.0,12.0,144.0,96.0,333.0,6.0,3.0,109.0,21.0,44.0,172.0,9.0,1.0,11.0,0.0,25.0,26.0,6.0,246.0,499.0,9.0,32.0,46.0,499.0,499.0,25.0,26.0,6.0,246.0,499.0,9.0,32.0,46.0,499.0,499.0,1.0,28.0,0.0,6.0,29.0,15.0,2.0,144.0,499.0,6.0,3.0,71.0,99.0,86.0,155.0,483.0,499.0,133.0,7.0,499.0,499.0,61.0,52.0,103.0,10.0,39.0,339.0,88.0,57.0,499.0,6.0,29.0,15.0,2.0,144.0,499.0,6.0,3.0,71.0,99.0,86.0,155.0,483.0,499.0,133.0,7.0,499.0,499.0,61.0,52.0,103.0,10.0,39.0,339.0,88.0,57.0,499.0,1.0,33.0,0.0,6.0,328.0,6.0,29.0,499.0,32.0,499.0,32.0,2.0,499.0,499.0,29.0,499.0,68.0,6.0,202.0,3.0,17.0,104.0,4.0,499.0,7.0,103.0,10.0,39.0,339.0,142.0,57.0,499.0,155.0,499.0,105.0,6.0,328.0,6.0,29.0,499.0,32.0,499.0,32.0,2.0,499.0,499.0,29.0,499.0,68.0,6.0,202.0,3.0,17.0,104.0,4.0,499.0,7.0,103.0,10.0,39.0,339.0,142.0,57.0,499.0,155.0,499.0,105.0,1.0,30.0,0.0,53.0,499.0,67.0,29.0,8.0,177.0,10.0,499.0,6.0,199.0,4.0,50.0,39.0,499.0,4.0,143.0,67.0,499.0,19.0,499.0,499.0,380.0,8.0,266.0,7.0,50.0,92.0,499.0,499.0,53.0,499.0,67.0,29.0,8.0,177.0,10.0,499.0,6.0,199.0,4.0,50.0,39.0,499.0,4.0,143.0,67.0,499.0,19.0,499.0,499.0,380.0,8.0,266.0,7.0,50.0,92.0,499.0,499.0,1.0,24.0,0.0,41.0,52.0,6.0,157.0,39.0,499.0,44.0,39.0,499.0,7.0,499.0,29.0,499.0,68.0,6.0,29.0,41.0,499.0,20.0,499.0,37.0,30.0,124.0,41.0,52.0,6.0,157.0,39.0,499.0,44.0,39.0,499.0,7.0,499.0,29.0,499.0,68.0,6.0,29.0,41.0,499.0,20.0,499.0,37.0,30.0,124.0,1.0,3.0,0.0,96.0,499.0,96.0,499.0,1.0,18.0,0.0,2.0,442.0,165.0,16.0,126.0,4.0,235.0,264.0,61.0,275.0,33.0,77.0,4.0,235.0,499.0,2.0,499.0,2.0,442.0,165.0,16.0,126.0,4.0,235.0,264.0,61.0,275.0,33.0,77.0,4.0,235.0,499.0,2.0,499.0,1.0,24.0,0.0,499.0,331.0,40.0,499.0,499.0,499.0,77.0,152.0,499.0,16.0,46.0,499.0,301.0,289.0,154.0,499.0,16.0,151.0,499.0,15.0,70.0,499.0,73.0,499.0,331.0,40.0,499.0,499.0,499.0,77.0,152.0,499.0,16.0,46.0,499.0,301.0,289.0,154.0,499.0,16.0,151.0,499.0,15.0,70.0,499.0,73.0,1.0,22.0,0.0,27.0,499.0,6.0,499.0,162.0,74.0,53.0,57.0,499.0,123.0,48.0,371.0,7.0,332.0,167.0,31.0,30.0,290.0,5.0,5.0,80.0,27.0,499.0,6.0,499.0,162.0,74.0,53.0,57.0,499.0,123.0,48.0,371.0,7.0,332.0,167.0,31.0,30.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,32.0,0.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,166.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,166.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,1.0,6.0,0.0,499.0,16.0,8.0,126.0,499.0,499.0,16.0,8.0,126.0,499.0,1.0,17.0,0.0,499.0,16.0,192.0,10.0,8.0,430.0,4.0,499.0,8.0,499.0,2.0,117.0,499.0,34.0,3.0,17.0,499.0,16.0,192.0,10.0,8.0,430.0,4.0,499.0,8.0,499.0,2.0,117.0,499.0,34.0,3.0,17.0,1.0,26.0,0.0,53.0,6.0,127.0,499.0,16.0,12.0,307.0,7.0,176.0,259.0,499.0,499.0,3.0,18.0,499.0,88.0,4.0,499.0,23.0,8.0,499.0,499.0,499.0,4.0,225.0,53.0,6.0,127.0,499.0,16.0,12.0,307.0,7.0,176.0,259.0,499.0,499.0,3.0,18.0,499.0,88.0,4.0,499.0,23.0,8.0,499.0,499.0,499.0,4.0,225.0,1.0,14.0,0.0,499.0,499.0,499.0,499.0,28.0,499.0,24.0,28.0,27.0,499.0,499.0,499.0,256.0,499.0,499.0,499.0,499.0,28.0,499.0,24.0,28.0,27.0,499.0,499.0,499.0,256.0,1.0,21.0,0.0,2.0,297.0,499.0,29.0,48.0,499.0,13.0,7.0,499.0,38.0,3.0,17.0,22.0,12.0,499.0,499.0,499.0,76.0,287.0,51.0,2.0,297.0,499.0,29.0,48.0,499.0,13.0,7.0,499.0,38.0,3.0,17.0,22.0,12.0,499.0,499.0,499.0,76.0,287.0,51.0,1.0,21.0,0.0,9.0,3.0,18.0,108.0,164.0,499.0,12.0,499.0,22.0,28.0,92.0,247.0,499.0,52.0,58.0,499.0,499.0,499.0,2.0,83.0,9.0,3.0,18.0,108.0,164.0,499.0,12.0,499.0,22.0,28.0,92.0,247.0,499.0,52.0,58.0,499.0,499.0,499.0,2.0,83.0,1.0,43.0,0.0,499.0,499.0,56.0,499.0,25.0,381.0,499.0,43.0,7.0,499.0,307.0,474.0,499.0,4.0,2.0,190.0,10.0,57.0,499.0,499.0,2.0,487.0,12.0,181.0,190.0,19.0,12.0,499.0,7.0,493.0,43.0,15.0,2.0,499.0,12.0,499.0,43.0,7.0,57.0,259.0,2.0,103.0,499.0,499.0,56.0,499.0,25.0,381.0,499.0,43.0,7.0,499.0,307.0,474.0,499.0,4.0,2.0,190.0,10.0,57.0,499.0,499.0,2.0,487.0,12.0,181.0,190.0,19.0,12.0,499.0,7.0,493.0,43.0,15.0,2.0,499.0,12.0,499.0,43.0,7.0,57.0,259.0,2.0,103.0,1.0,32.0,0.0,499.0,499.0,28.0,499.0,15.0,2.0,205.0,499.0,180.0,499.0,2.0,144.0,487.0,28.0,499.0,20.0,499.0,2.0,144.0,499.0,7.0,28.0,178.0,15.0,499.0,2.0,144.0,499.0,20.0,242.0,499.0,499.0,499.0,28.0,499.0,15.0,2.0,205.0,499.0,180.0,499.0,2.0,144.0,487.0,28.0,499.0,20.0,499.0,2.0,144.0,499.0,7.0,28.0,178.0,15.0,499.0,2.0,144.0,499.0,20.0,242.0,499.0,1.0,14.0,0.0,499.0,36.0,166.0,56.0,81.0,499.0,499.0,4.0,137.0,8.0,87.0,499.0,314.0,499.0,36.0,166.0,56.0,81.0,499.0,499.0,4.0,137.0,8.0,87.0,499.0,314.0,1.0,37.0,0.0,499.0,51.0,27.0,156.0,4.0,21.0,499.0,248.0,72.0,48.0,46.0,14.0,14.0,312.0,499.0,15.0,499.0,14.0,14.0,298.0,499.0,25.0,499.0,192.0,12.0,208.0,251.0,34.0,313.0,153.0,137.0,4.0,95.0,2.0,499.0,166.0,499.0,51.0,27.0,156.0,4.0,21.0,499.0,248.0,72.0,48.0,46.0,14.0,14.0,312.0,499.0,15.0,499.0,14.0,14.0,298.0,499.0,25.0,499.0,192.0,12.0,208.0,251.0,34.0,313.0,153.0,137.0,4.0,95.0,2.0,499.0,166.0,1.0,12.0,0.0,8.0,474.0,370.0,62.0,499.0,58.0,499.0,69.0,8.0,499.0,63.0,8.0,474.0,370.0,62.0,499.0,58.0,499.0,69.0,8.0,499.0,63.0,1.0,44.0,0.0,499.0,10.0,499.0,14.0,14.0,26.0,36.0,370.0,34.0,499.0,15.0,2.0,314.0,499.0,498.0,85.0,9.0,91.0,21.0,15.0,2.0,314.0,14.0,14.0,11.0,34.0,174.0,499.0,10.0,76.0,499.0,27.0,4.0,118.0,14.0,14.0,100.0,14.0,14.0,290.0,5.0,5.0,80.0,499.0,10.0,499.0,14.0,14.0,26.0,36.0,370.0,34.0,499.0,15.0,2.0,314.0,499.0,498.0,85.0,9.0,91.0,21.0,15.0,2.0,314.0,14.0,14.0,11.0,34.0,174.0,499.0,10.0,76.0,499.0,27.0,4.0,118.0,14.0,14.0,100.0,14.0,14.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,25.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,308.0,5.0,233.0,5.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,308.0,5.0,233.0,5.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,30.0,0.0,345.0,499.0,47.0,32.0,8.0,499.0,38.0,3.0,17.0,22.0,4.0,499.0,2.0,499.0,10.0,493.0,2.0,499.0,7.0,499.0,10.0,499.0,499.0,7.0,134.0,499.0,4.0,8.0,499.0,345.0,499.0,47.0,32.0,8.0,499.0,38.0,3.0,17.0,22.0,4.0,499.0,2.0,499.0,10.0,493.0,2.0,499.0,7.0,499.0,10.0,499.0,499.0,7.0,134.0,499.0,4.0,8.0,499.0,1.0,20.0,0.0,6.0,3.0,71.0,499.0,12.0,253.0,8.0,499.0,499.0,56.0,499.0,4.0,499.0,14.0,499.0,499.0,2.0,499.0,14.0,6.0,3.0,71.0,499.0,12.0,253.0,8.0,499.0,499.0,56.0,499.0,4.0,499.0,14.0,499.0,499.0,2.0,499.0,14.0,1.0,44.0,0.0,6.0,29.0,37.0,8.0,499.0,19.0,8.0,242.0,499.0,41.0,6.0,499.0,12.0,30.0,16.0,41.0,363.0,25.0,26.0,11.0,338.0,3.0,17.0,295.0,224.0,61.0,291.0,499.0,16.0,46.0,499.0,499.0,499.0,234.0,10.0,31.0,499.0,33.0,114.0,64.0,53.0,6.0,313.0,6.0,29.0,37.0,8.0,499.0,19.0,8.0,242.0,499.0,41.0,6.0,499.0,12.0,30.0,16.0,41.0,363.0,25.0,26.0,11.0,338.0,3.0,17.0,295.0,224.0,61.0,291.0,499.0,16.0,46.0,499.0,499.0,499.0,234.0,10.0,31.0,499.0,33.0,114.0,64.0,53.0,6.0,313.0,1.0,20.0,0.0,24.0,22.0,2.0,499.0,499.0,73.0,499.0,68.0,24.0,3.0,54.0,499.0,19.0,52.0,24.0,3.0,54.0,161.0,499.0,24.0,22.0,2.0,499.0,499.0,73.0,499.0,68.0,24.0,3.0,54.0,499.0,19.0,52.0,24.0,3.0,54.0,161.0,499.0,1.0,37.0,0.0,24.0,3.0,54.0,15.0,2.0,499.0,25.0,27.0,173.0,4.0,21.0,499.0,4.0,234.0,10.0,31.0,79.0,499.0,56.0,499.0,73.0,8.0,145.0,93.0,24.0,3.0,54.0,61.0,25.0,11.0,34.0,3.0,17.0,499.0,4.0,43.0,24.0,3.0,54.0,15.0,2.0,499.0,25.0,27.0,173.0,4.0,21.0,499.0,4.0,234.0,10.0,31.0,79.0,499.0,56.0,499.0,73.0,8.0,145.0,93.0,24.0,3.0,54.0,61.0,25.0,11.0,34.0,3.0,17.0,499.0,4.0,43.0,1.0,4.0,0.0,239.0,102.0,367.0,239.0,102.0,367.0,1.0,18.0,0.0,11.0,163.0,3.0,17.0,21.0,173.0,4.0,499.0,8.0,373.0,391.0,10.0,499.0,15.0,40.0,254.0,499.0,11.0,163.0,3.0,17.0,21.0,173.0,4.0,499.0,8.0,373.0,391.0,10.0,499.0,15.0,40.0,254.0,499.0,1.0,28.0,0.0,11.0,34.0,499.0,86.0,499.0,499.0,8.0,242.0,499.0,45.0,85.0,499.0,4.0,499.0,33.0,499.0,7.0,51.0,59.0,499.0,61.0,4.0,2.0,499.0,93.0,499.0,61.0,11.0,34.0,499.0,86.0,499.0,499.0,8.0,242.0,499.0,45.0,85.0,499.0,4.0,499.0,33.0,499.0,7.0,51.0,59.0,499.0,61.0,4.0,2.0,499.0,93.0,499.0,61.0,1.0,6.0,0.0,33.0,51.0,499.0,499.0,499.0,33.0,51.0,499.0,499.0,499.0,1.0,25.0,0.0,45.0,28.0,499.0,19.0,183.0,499.0,7.0,499.0,41.0,11.0,34.0,50.0,59.0,474.0,499.0,64.0,45.0,32.0,97.0,32.0,499.0,499.0,31.0,499.0,45.0,28.0,499.0,19.0,183.0,499.0,7.0,499.0,41.0,11.0,34.0,50.0,59.0,474.0,499.0,64.0,45.0,32.0,97.0,32.0,499.0,499.0,31.0,499.0,1.0,18.0,0.0,12.0,3.0,18.0,40.0,39.0,499.0,285.0,13.0,379.0,241.0,22.0,76.0,499.0,19.0,11.0,4.0,283.0,12.0,3.0,18.0,40.0,39.0,499.0,285.0,13.0,379.0,241.0,22.0,76.0,499.0,19.0,11.0,4.0,283.0,1.0,14.0,0.0,6.0,3.0,110.0,499.0,23.0,499.0,26.0,11.0,28.0,135.0,2.0,499.0,499.0,6.0,3.0,110.0,499.0,23.0,499.0,26.0,11.0,28.0,135.0,2.0,499.0,499.0,1.0,20.0,0.0,499.0,3.0,18.0,499.0,56.0,326.0,4.0,51.0,20.0,499.0,499.0,19.0,2.0,499.0,7.0,11.0,78.0,9.0,499.0,499.0,3.0,18.0,499.0,56.0,326.0,4.0,51.0,20.0,499.0,499.0,19.0,2.0,499.0,7.0,11.0,78.0,9.0,499.0,1.0,20.0,0.0,49.0,3.0,18.0,72.0,499.0,150.0,114.0,499.0,2.0,499.0,10.0,136.0,218.0,20.0,90.0,200.0,499.0,99.0,73.0,49.0,3.0,18.0,72.0,499.0,150.0,114.0,499.0,2.0,499.0,10.0,136.0,218.0,20.0,90.0,200.0,499.0,99.0,73.0,1.0,11.0,0.0,90.0,499.0,16.0,48.0,499.0,12.0,16.0,53.0,346.0,9.0,90.0,499.0,16.0,48.0,499.0,12.0,16.0,53.0,346.0,9.0,1.0,26.0,0.0,11.0,499.0,499.0,2.0,499.0,20.0,84.0,2.0,499.0,499.0,499.0,176.0,76.0,499.0,499.0,10.0,49.0,499.0,7.0,123.0,24.0,28.0,499.0,10.0,9.0,11.0,499.0,499.0,2.0,499.0,20.0,84.0,2.0,499.0,499.0,499.0,176.0,76.0,499.0,499.0,10.0,49.0,499.0,7.0,123.0,24.0,28.0,499.0,10.0,9.0,1.0,10.0,0.0,24.0,499.0,499.0,499.0,19.0,499.0,499.0,70.0,499.0,24.0,499.0,499.0,499.0,19.0,499.0,499.0,70.0,499.0,1.0,41.0,0.0,499.0,9.0,3.0,18.0,151.0,499.0,4.0,499.0,25.0,6.0,65.0,2.0,499.0,499.0,12.0,499.0,499.0,16.0,499.0,69.0,499.0,499.0,10.0,2.0,499.0,6.0,428.0,31.0,106.0,499.0,9.0,3.0,18.0,239.0,499.0,52.0,207.0,499.0,499.0,499.0,499.0,9.0,3.0,18.0,151.0,499.0,4.0,499.0,25.0,6.0,65.0,2.0,499.0,499.0,12.0,499.0,499.0,16.0,499.0,69.0,499.0,499.0,10.0,2.0,499.0,6.0,428.0,31.0,106.0,499.0,9.0,3.0,18.0,239.0,499.0,52.0,207.0,499.0,499.0,499.0,1.0,15.0,0.0,499.0,238.0,499.0,12.0,164.0,28.0,103.0,10.0,2.0,327.0,499.0,5.0,5.0,80.0,499.0,238.0,499.0,12.0,164.0,28.0,103.0,10.0,2.0,327.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,15.0,0.0,499.0,9.0,3.0,18.0,44.0,499.0,23.0,53.0,234.0,10.0,499.0,11.0,104.0,92.0,499.0,9.0,3.0,18.0,44.0,499.0,23.0,53.0,234.0,10.0,499.0,11.0,104.0,92.0,1.0,7.0,0.0,15.0,499.0,10.0,499.0,33.0,499.0,15.0,499.0,10.0,499.0,33.0,499.0,1.0,22.0,0.0,6.0,417.0,499.0,170.0,24.0,161.0,51.0,92.0,398.0,165.0,7.0,499.0,499.0,87.0,97.0,26.0,11.0,22.0,46.0,499.0,499.0,6.0,417.0,499.0,170.0,24.0,161.0,51.0,92.0,398.0,165.0,7.0,499.0,499.0,87.0,97.0,26.0,11.0,22.0,46.0,499.0,499.0,1.0,27.0,0.0,499.0,499.0,16.0,116.0,2.0,190.0,499.0,327.0,33.0,499.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,499.0,499.0,53.0,303.0,10.0,499.0,24.0,62.0,22.0,499.0,499.0,16.0,116.0,2.0,190.0,499.0,327.0,33.0,499.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,499.0,499.0,53.0,303.0,10.0,499.0,24.0,62.0,22.0,1.0,28.0,0.0,41.0,19.0,330.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,2.0,499.0,499.0,33.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,499.0,165.0,41.0,19.0,330.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,2.0,499.0,499.0,33.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,499.0,165.0,1.0,35.0,0.0,499.0,19.0,8.0,499.0,11.0,116.0,104.0,8.0,14.0,14.0,499.0,14.0,14.0,327.0,170.0,9.0,499.0,46.0,44.0,499.0,499.0,26.0,11.0,34.0,3.0,17.0,499.0,4.0,174.0,5.0,396.0,8.0,499.0,327.0,499.0,19.0,8.0,499.0,11.0,116.0,104.0,8.0,14.0,14.0,499.0,14.0,14.0,327.0,170.0,9.0,499.0,46.0,44.0,499.0,499.0,26.0,11.0,34.0,3.0,17.0,499.0,4.0,174.0,5.0,396.0,8.0,499.0,327.0,1.0,26.0,0.0,36.0,194.0,499.0,45.0,16.0,40.0,499.0,4.0,2.0,233.0,100.0,7.0,47.0,163.0,3.0,17.0,388.0,11.0,4.0,122.0,8.0,499.0,10.0,395.0,30.0,36.0,194.0,499.0,45.0,16.0,40.0,499.0,4.0,2.0,233.0,100.0,7.0,47.0,163.0,3.0,17.0,388.0,11.0,4.0,122.0,8.0,499.0,10.0,395.0,30.0,1.0,6.0,0.0,11.0,34.0,499.0,4.0,42.0,11.0,34.0,499.0,4.0,42.0,1.0,29.0,0.0,141.0,38.0,3.0,17.0,499.0,43.0,10.0,167.0,499.0,167.0,23.0,43.0,33.0,499.0,2.0,415.0,48.0,43.0,7.0,499.0,4.0,43.0,32.0,26.0,24.0,161.0,157.0,12.0,141.0,38.0,3.0,17.0,499.0,43.0,10.0,167.0,499.0,167.0,23.0,43.0,33.0,499.0,2.0,415.0,48.0,43.0,7.0,499.0,4.0,43.0,32.0,26.0,24.0,161.0,157.0,12.0,1.0,19.0,0.0,45.0,3.0,18.0,55.0,499.0,15.0,30.0,12.0,3.0,18.0,40.0,499.0,7.0,9.0,3.0,18.0,27.0,499.0,45.0,3.0,18.0,55.0,499.0,15.0,30.0,12.0,3.0,18.0,40.0,499.0,7.0,9.0,3.0,18.0,27.0,499.0,1.0,17.0,0.0,70.0,499.0,10.0,42.0,66.0,51.0,30.0,100.0,60.0,115.0,11.0,37.0,33.0,425.0,2.0,175.0,70.0,499.0,10.0,42.0,66.0,51.0,30.0,100.0,60.0,115.0,11.0,37.0,33.0,425.0,2.0,175.0,1.0,9.0,0.0,11.0,156.0,4.0,51.0,101.0,141.0,7.0,133.0,11.0,156.0,4.0,51.0,101.0,141.0,7.0,133.0,1.0,8.0,0.0,2.0,155.0,387.0,29.0,2.0,499.0,499.0,2.0,155.0,387.0,29.0,2.0,499.0,499.0,1.0,28.0,0.0,2.0,499.0,387.0,16.0,301.0,23.0,270.0,64.0,2.0,499.0,499.0,7.0,44.0,499.0,499.0,22.0,81.0,499.0,86.0,2.0,83.0,168.0,32.0,498.0,33.0,15.0,445.0,2.0,499.0,387.0,16.0,301.0,23.0,270.0,64.0,2.0,499.0,499.0,7.0,44.0,499.0,499.0,22.0,81.0,499.0,86.0,2.0,83.0,168.0,32.0,498.0,33.0,15.0,445.0,1.0,41.0,0.0,499.0,15.0,2.0,499.0,8.0,499.0,499.0,66.0,499.0,191.0,2.0,445.0,7.0,274.0,43.0,4.0,499.0,499.0,7.0,2.0,499.0,19.0,79.0,445.0,180.0,499.0,29.0,187.0,499.0,7.0,499.0,4.0,499.0,15.0,20.0,2.0,499.0,10.0,2.0,83.0,499.0,15.0,2.0,499.0,8.0,499.0,499.0,66.0,499.0,191.0,2.0,445.0,7.0,274.0,43.0,4.0,499.0,499.0,7.0,2.0,499.0,19.0,79.0,445.0,180.0,499.0,29.0,187.0,499.0,7.0,499.0,4.0,499.0,15.0,20.0,2.0,499.0,10.0,2.0,83.0,1.0,31.0,0.0,6.0,202.0,3.0,17.0,123.0,9.0,29.0,265.0,6.0,40.0,150.0,9.0,268.0,3.0,17.0,10.0,499.0,368.0,7.0,268.0,3.0,17.0,285.0,2.0,499.0,11.0,131.0,499.0,19.0,9.0,6.0,202.0,3.0,17.0,123.0,9.0,29.0,265.0,6.0,40.0,150.0,9.0,268.0,3.0,17.0,10.0,499.0,368.0,7.0,268.0,3.0,17.0,285.0,2.0,499.0,11.0,131.0,499.0,19.0,9.0,1.0,28.0,0.0,6.0,75.0,499.0,46.0,499.0,10.0,8.0,499.0,12.0,6.0,157.0,283.0,4.0,21.0,499.0,368.0,7.0,84.0,29.0,285.0,2.0,234.0,10.0,364.0,11.0,28.0,499.0,6.0,75.0,499.0,46.0,499.0,10.0,8.0,499.0,12.0,6.0,157.0,283.0,4.0,21.0,499.0,368.0,7.0,84.0,29.0,285.0,2.0,234.0,10.0,364.0,11.0,28.0,499.0,1.0,43.0,0.0,2.0,65.0,12.0,482.0,67.0,16.0,12.0,11.0,499.0,100.0,499.0,26.0,36.0,499.0,29.0,285.0,499.0,36.0,339.0,499.0,11.0,9.0,268.0,3.0,17.0,6.0,499.0,11.0,9.0,268.0,3.0,17.0,7.0,499.0,108.0,7.0,11.0,50.0,44.0,499.0,48.0,9.0,2.0,65.0,12.0,482.0,67.0,16.0,12.0,11.0,499.0,100.0,499.0,26.0,36.0,499.0,29.0,285.0,499.0,36.0,339.0,499.0,11.0,9.0,268.0,3.0,17.0,6.0,499.0,11.0,9.0,268.0,3.0,17.0,7.0,499.0,108.0,7.0,11.0,50.0,44.0,499.0,48.0,9.0,1.0,23.0,0.0,26.0,11.0,38.0,3.0,17.0,104.0,2.0,499.0,10.0,42.0,58.0,499.0,69.0,227.0,85.0,11.0,499.0,3.0,17.0,305.0,19.0,9.0,26.0,11.0,38.0,3.0,17.0,104.0,2.0,499.0,10.0,42.0,58.0,499.0,69.0,227.0,85.0,11.0,499.0,3.0,17.0,305.0,19.0,9.0,1.0,31.0,0.0,64.0,332.0,12.0,9.0,499.0,31.0,49.0,3.0,18.0,137.0,499.0,499.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,67.0,288.0,27.0,137.0,4.0,65.0,40.0,499.0,7.0,148.0,499.0,64.0,332.0,12.0,9.0,499.0,31.0,49.0,3.0,18.0,137.0,499.0,499.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,67.0,288.0,27.0,137.0,4.0,65.0,40.0,499.0,7.0,148.0,499.0,1.0,24.0,0.0,26.0,49.0,138.0,3.0,17.0,499.0,263.0,9.0,3.0,18.0,116.0,68.0,49.0,3.0,18.0,27.0,319.0,10.0,90.0,499.0,44.0,2.0,121.0,26.0,49.0,138.0,3.0,17.0,499.0,263.0,9.0,3.0,18.0,116.0,68.0,49.0,3.0,18.0,27.0,319.0,10.0,90.0,499.0,44.0,2.0,121.0,1.0,20.0,0.0,499.0,6.0,127.0,151.0,499.0,74.0,30.0,499.0,32.0,8.0,499.0,23.0,108.0,499.0,14.0,499.0,14.0,499.0,499.0,499.0,6.0,127.0,151.0,499.0,74.0,30.0,499.0,32.0,8.0,499.0,23.0,108.0,499.0,14.0,499.0,14.0,499.0,499.0,1.0,19.0,0.0,2.0,499.0,14.0,28.0,14.0,499.0,7.0,499.0,25.0,499.0,58.0,69.0,499.0,52.0,499.0,4.0,2.0,499.0,2.0,499.0,14.0,28.0,14.0,499.0,7.0,499.0,25.0,499.0,58.0,69.0,499.0,52.0,499.0,4.0,2.0,499.0,1.0,22.0,0.0,277.0,43.0,32.0,8.0,499.0,499.0,10.0,108.0,4.0,499.0,499.0,499.0,31.0,46.0,172.0,499.0,23.0,2.0,156.0,19.0,499.0,277.0,43.0,32.0,8.0,499.0,499.0,10.0,108.0,4.0,499.0,499.0,499.0,31.0,46.0,172.0,499.0,23.0,2.0,156.0,19.0,499.0,1.0,16.0,0.0,499.0,81.0,37.0,499.0,19.0,499.0,499.0,7.0,499.0,499.0,107.0,499.0,8.0,499.0,499.0,499.0,81.0,37.0,499.0,19.0,499.0,499.0,7.0,499.0,499.0,107.0,499.0,8.0,499.0,499.0,1.0,21.0,0.0,11.0,499.0,78.0,265.0,48.0,2.0,499.0,2.0,499.0,499.0,9.0,2.0,499.0,10.0,2.0,499.0,33.0,70.0,10.0,12.0,11.0,499.0,78.0,265.0,48.0,2.0,499.0,2.0,499.0,499.0,9.0,2.0,499.0,10.0,2.0,499.0,33.0,70.0,10.0,12.0,1.0,62.0,0.0,7.0,23.0,2.0,499.0,10.0,499.0,499.0,6.0,34.0,335.0,11.0,11.0,28.0,46.0,499.0,499.0,499.0,2.0,499.0,499.0,4.0,11.0,74.0,299.0,11.0,499.0,3.0,197.0,189.0,3.0,478.0,499.0,499.0,11.0,499.0,499.0,11.0,78.0,499.0,499.0,44.0,48.0,83.0,499.0,342.0,499.0,499.0,499.0,33.0,70.0,10.0,2.0,76.0,265.0,11.0,41.0,499.0,499.0,42.0,355.0,64.0,7.0,23.0,2.0,499.0,10.0,499.0,499.0,6.0,34.0,335.0,11.0,11.0,28.0,46.0,499.0,499.0,499.0,2.0,499.0,499.0,4.0,11.0,74.0,299.0,11.0,499.0,3.0,197.0,189.0,3.0,478.0,499.0,499.0,11.0,499.0,499.0,11.0,78.0,499.0,499.0,44.0,48.0,83.0,499.0,342.0,499.0,499.0,499.0,33.0,70.0,10.0,2.0,76.0,265.0,11.0,41.0,499.0,499.0,42.0,355.0,64.0,1.0,11.0,0.0,499.0,11.0,22.0,36.0,485.0,107.0,73.0,36.0,200.0,499.0,499.0,11.0,22.0,36.0,485.0,107.0,73.0,36.0,200.0,499.0,1.0,14.0,0.0,41.0,102.0,41.0,478.0,499.0,11.0,499.0,77.0,499.0,4.0,499.0,36.0,499.0,41.0,102.0,41.0,478.0,499.0,11.0,499.0,77.0,499.0,4.0,499.0,36.0,499.0,1.0,11.0,0.0,40.0,31.0,176.0,76.0,499.0,499.0,52.0,456.0,19.0,499.0,40.0,31.0,176.0,76.0,499.0,499.0,52.0,456.0,19.0,499.0,1.0,20.0,0.0,6.0,65.0,450.0,499.0,10.0,499.0,499.0,277.0,499.0,499.0,142.0,67.0,86.0,499.0,499.0,499.0,59.0,499.0,167.0,6.0,65.0,450.0,499.0,10.0,499.0,499.0,277.0,499.0,499.0,142.0,67.0,86.0,499.0,499.0,499.0,59.0,499.0,167.0,1.0,50.0,0.0,6.0,199.0,4.0,444.0,8.0,177.0,10.0,499.0,499.0,15.0,439.0,499.0,25.0,6.0,160.0,92.0,499.0,86.0,9.0,279.0,255.0,499.0,499.0,7.0,6.0,75.0,88.0,8.0,499.0,408.0,20.0,499.0,499.0,12.0,6.0,92.0,499.0,152.0,207.0,202.0,3.0,17.0,118.0,70.0,499.0,499.0,499.0,40.0,499.0,6.0,199.0,4.0,444.0,8.0,177.0,10.0,499.0,499.0,15.0,439.0,499.0,25.0,6.0,160.0,92.0,499.0,86.0,9.0,279.0,255.0,499.0,499.0,7.0,6.0,75.0,88.0,8.0,499.0,408.0,20.0,499.0,499.0,12.0,6.0,92.0,499.0,152.0,207.0,202.0,3.0,17.0,118.0,70.0,499.0,499.0,499.0,40.0,499.0,1.0,6.0,0.0,6.0,31.0,42.0,31.0,11.0,6.0,31.0,42.0,31.0,11.0,1.0,24.0,0.0,103.0,42.0,123.0,137.0,499.0,16.0,8.0,189.0,139.0,25.0,6.0,78.0,105.0,132.0,42.0,12.0,22.0,55.0,499.0,7.0,28.0,499.0,499.0,103.0,42.0,123.0,137.0,499.0,16.0,8.0,189.0,139.0,25.0,6.0,78.0,105.0,132.0,42.0,12.0,22.0,55.0,499.0,7.0,28.0,499.0,499.0,1.0,33.0,0.0,6.0,22.0,499.0,499.0,10.0,8.0,405.0,66.0,3.0,18.0,499.0,499.0,3.0,17.0,88.0,8.0,409.0,15.0,237.0,56.0,499.0,405.0,7.0,2.0,343.0,499.0,19.0,499.0,44.0,10.0,90.0,499.0,6.0,22.0,499.0,499.0,10.0,8.0,405.0,66.0,3.0,18.0,499.0,499.0,3.0,17.0,88.0,8.0,409.0,15.0,237.0,56.0,499.0,405.0,7.0,2.0,343.0,499.0,19.0,499.0,44.0,10.0,90.0,499.0,1.0,11.0,0.0,49.0,16.0,187.0,499.0,7.0,40.0,499.0,499.0,44.0,145.0,49.0,16.0,187.0,499.0,7.0,40.0,499.0,499.0,44.0,145.0,1.0,6.0,0.0,499.0,19.0,99.0,392.0,499.0,499.0,19.0,99.0,392.0,499.0,1.0,13.0,0.0,11.0,3.0,54.0,395.0,96.0,7.0,6.0,499.0,499.0,11.0,2.0,190.0,11.0,3.0,54.0,395.0,96.0,7.0,6.0,499.0,499.0,11.0,2.0,190.0,1.0,4.0,0.0,40.0,240.0,499.0,40.0,240.0,499.0,1.0,14.0,0.0,6.0,130.0,45.0,3.0,18.0,195.0,117.0,4.0,214.0,37.0,9.0,32.0,97.0,6.0,130.0,45.0,3.0,18.0,195.0,117.0,4.0,214.0,37.0,9.0,32.0,97.0,1.0,19.0,0.0,11.0,3.0,54.0,499.0,68.0,11.0,499.0,499.0,499.0,19.0,36.0,339.0,7.0,24.0,338.0,3.0,17.0,499.0,11.0,3.0,54.0,499.0,68.0,11.0,499.0,499.0,499.0,19.0,36.0,339.0,7.0,24.0,338.0,3.0,17.0,499.0,1.0,17.0,0.0,25.0,24.0,499.0,8.0,422.0,7.0,499.0,11.0,7.0,14.0,11.0,14.0,338.0,3.0,17.0,499.0,25.0,24.0,499.0,8.0,422.0,7.0,499.0,11.0,7.0,14.0,11.0,14.0,338.0,3.0,17.0,499.0,1.0,7.0,0.0,53.0,3.0,18.0,2.0,499.0,499.0,53.0,3.0,18.0,2.0,499.0,499.0,1.0,14.0,0.0,499.0,499.0,7.0,24.0,91.0,50.0,262.0,4.0,11.0,20.0,8.0,499.0,426.0,499.0,499.0,7.0,24.0,91.0,50.0,262.0,4.0,11.0,20.0,8.0,499.0,426.0,1.0,33.0,0.0,499.0,81.0,499.0,20.0,39.0,499.0,52.0,499.0,499.0,29.0,8.0,499.0,499.0,14.0,26.0,11.0,38.0,3.0,17.0,499.0,280.0,67.0,499.0,7.0,499.0,7.0,499.0,499.0,37.0,43.0,19.0,11.0,499.0,81.0,499.0,20.0,39.0,499.0,52.0,499.0,499.0,29.0,8.0,499.0,499.0,14.0,26.0,11.0,38.0,3.0,17.0,499.0,280.0,67.0,499.0,7.0,499.0,7.0,499.0,499.0,37.0,43.0,19.0,11.0,1.0,11.0,0.0,2.0,499.0,91.0,22.0,81.0,206.0,61.0,4.0,2.0,499.0,2.0,499.0,91.0,22.0,81.0,206.0,61.0,4.0,2.0,499.0,1.0,30.0,0.0,2.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,12.0,2.0,499.0,499.0,2.0,499.0,32.0,9.0,241.0,499.0,59.0,499.0,12.0,28.0,499.0,286.0,2.0,499.0,499.0,2.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,12.0,2.0,499.0,499.0,2.0,499.0,32.0,9.0,241.0,499.0,59.0,499.0,12.0,28.0,499.0,286.0,2.0,499.0,499.0,1.0,45.0,0.0,2.0,76.0,125.0,499.0,10.0,499.0,253.0,32.0,8.0,499.0,499.0,499.0,7.0,317.0,13.0,499.0,499.0,499.0,28.0,499.0,286.0,2.0,499.0,3.0,18.0,499.0,32.0,196.0,24.0,62.0,21.0,499.0,23.0,70.0,499.0,499.0,32.0,30.0,138.0,3.0,17.0,8.0,499.0,499.0,2.0,76.0,125.0,499.0,10.0,499.0,253.0,32.0,8.0,499.0,499.0,499.0,7.0,317.0,13.0,499.0,499.0,499.0,28.0,499.0,286.0,2.0,499.0,3.0,18.0,499.0,32.0,196.0,24.0,62.0,21.0,499.0,23.0,70.0,499.0,499.0,32.0,30.0,138.0,3.0,17.0,8.0,499.0,499.0,1.0,31.0,0.0,37.0,2.0,267.0,10.0,2.0,145.0,30.0,217.0,31.0,8.0,499.0,499.0,66.0,499.0,4.0,122.0,182.0,11.0,38.0,3.0,17.0,499.0,2.0,364.0,23.0,317.0,13.0,499.0,499.0,487.0,37.0,2.0,267.0,10.0,2.0,145.0,30.0,217.0,31.0,8.0,499.0,499.0,66.0,499.0,4.0,122.0,182.0,11.0,38.0,3.0,17.0,499.0,2.0,364.0,23.0,317.0,13.0,499.0,499.0,487.0,1.0,12.0,0.0,40.0,157.0,8.0,499.0,499.0,7.0,9.0,213.0,181.0,19.0,67.0,40.0,157.0,8.0,499.0,499.0,7.0,9.0,213.0,181.0,19.0,67.0,1.0,9.0,0.0,2.0,499.0,16.0,103.0,376.0,23.0,36.0,499.0,2.0,499.0,16.0,103.0,376.0,23.0,36.0,499.0,1.0,13.0,0.0,499.0,499.0,288.0,499.0,3.0,499.0,3.0,499.0,375.0,288.0,499.0,375.0,499.0,499.0,288.0,499.0,3.0,499.0,3.0,499.0,375.0,288.0,499.0,375.0,1.0,10.0,0.0,499.0,3.0,499.0,3.0,499.0,3.0,499.0,3.0,375.0,499.0,3.0,499.0,3.0,499.0,3.0,499.0,3.0,375.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,3.0,0.0,499.0,375.0,499.0,375.0,1.0,2.0,0.0,499.0,499.0,1.0,50.0,0.0,499.0,11.0,22.0,183.0,499.0,15.0,205.0,499.0,10.0,499.0,11.0,346.0,499.0,125.0,380.0,7.0,22.0,63.0,499.0,15.0,307.0,499.0,26.0,12.0,3.0,18.0,2.0,276.0,6.0,65.0,12.0,52.0,11.0,499.0,9.0,62.0,72.0,388.0,11.0,4.0,499.0,499.0,27.0,499.0,11.0,70.0,499.0,499.0,499.0,499.0,11.0,22.0,183.0,499.0,15.0,205.0,499.0,10.0,499.0,11.0,346.0,499.0,125.0,380.0,7.0,22.0,63.0,499.0,15.0,307.0,499.0,26.0,12.0,3.0,18.0,2.0,276.0,6.0,65.0,12.0,52.0,11.0,499.0,9.0,62.0,72.0,388.0,11.0,4.0,499.0,499.0,27.0,499.0,11.0,70.0,499.0,499.0,499.0,1.0,17.0,0.0,264.0,44.0,2.0,499.0,499.0,7.0,122.0,182.0,11.0,22.0,183.0,499.0,23.0,2.0,144.0,499.0,264.0,44.0,2.0,499.0,499.0,7.0,122.0,182.0,11.0,22.0,183.0,499.0,23.0,2.0,144.0,499.0,1.0,16.0,0.0,26.0,11.0,3.0,54.0,99.0,4.0,51.0,30.0,50.0,8.0,499.0,7.0,51.0,499.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,51.0,30.0,50.0,8.0,499.0,7.0,51.0,499.0,499.0,1.0,6.0,0.0,37.0,236.0,462.0,46.0,471.0,37.0,236.0,462.0,46.0,471.0,1.0,38.0,0.0,39.0,499.0,499.0,499.0,5.0,499.0,499.0,5.0,462.0,7.0,6.0,22.0,4.0,123.0,6.0,38.0,3.0,17.0,65.0,6.0,3.0,110.0,21.0,457.0,32.0,96.0,33.0,457.0,32.0,499.0,26.0,6.0,268.0,3.0,17.0,323.0,499.0,39.0,499.0,499.0,499.0,5.0,499.0,499.0,5.0,462.0,7.0,6.0,22.0,4.0,123.0,6.0,38.0,3.0,17.0,65.0,6.0,3.0,110.0,21.0,457.0,32.0,96.0,33.0,457.0,32.0,499.0,26.0,6.0,268.0,3.0,17.0,323.0,499.0,1.0,18.0,0.0,6.0,3.0,120.0,81.0,226.0,19.0,499.0,418.0,7.0,6.0,149.0,31.0,6.0,22.0,8.0,398.0,499.0,6.0,3.0,120.0,81.0,226.0,19.0,499.0,418.0,7.0,6.0,149.0,31.0,6.0,22.0,8.0,398.0,499.0,1.0,11.0,0.0,326.0,229.0,499.0,25.0,9.0,147.0,3.0,17.0,271.0,189.0,326.0,229.0,499.0,25.0,9.0,147.0,3.0,17.0,271.0,189.0,1.0,30.0,0.0,9.0,60.0,3.0,120.0,499.0,67.0,41.0,102.0,499.0,4.0,50.0,4.0,12.0,124.0,26.0,6.0,268.0,3.0,17.0,395.0,499.0,46.0,471.0,8.0,266.0,75.0,40.0,247.0,499.0,9.0,60.0,3.0,120.0,499.0,67.0,41.0,102.0,499.0,4.0,50.0,4.0,12.0,124.0,26.0,6.0,268.0,3.0,17.0,395.0,499.0,46.0,471.0,8.0,266.0,75.0,40.0,247.0,499.0,1.0,10.0,0.0,176.0,145.0,55.0,219.0,69.0,272.0,499.0,8.0,145.0,176.0,145.0,55.0,219.0,69.0,272.0,499.0,8.0,145.0,1.0,19.0,0.0,499.0,8.0,145.0,100.0,7.0,45.0,138.0,3.0,17.0,2.0,267.0,10.0,2.0,362.0,25.0,499.0,4.0,9.0,499.0,8.0,145.0,100.0,7.0,45.0,138.0,3.0,17.0,2.0,267.0,10.0,2.0,362.0,25.0,499.0,4.0,9.0,1.0,39.0,0.0,11.0,186.0,3.0,17.0,104.0,4.0,143.0,2.0,499.0,499.0,61.0,2.0,499.0,163.0,3.0,17.0,393.0,73.0,37.0,12.0,124.0,13.0,2.0,468.0,499.0,499.0,169.0,499.0,2.0,499.0,169.0,7.0,9.0,186.0,3.0,17.0,21.0,499.0,11.0,186.0,3.0,17.0,104.0,4.0,143.0,2.0,499.0,499.0,61.0,2.0,499.0,163.0,3.0,17.0,393.0,73.0,37.0,12.0,124.0,13.0,2.0,468.0,499.0,499.0,169.0,499.0,2.0,499.0,169.0,7.0,9.0,186.0,3.0,17.0,21.0,499.0,1.0,23.0,0.0,2.0,499.0,18.0,499.0,16.0,295.0,499.0,499.0,4.0,499.0,41.0,499.0,499.0,116.0,138.0,3.0,17.0,2.0,476.0,4.0,499.0,499.0,2.0,499.0,18.0,499.0,16.0,295.0,499.0,499.0,4.0,499.0,41.0,499.0,499.0,116.0,138.0,3.0,17.0,2.0,476.0,4.0,499.0,499.0,1.0,18.0,0.0,116.0,499.0,2.0,499.0,499.0,7.0,499.0,499.0,60.0,235.0,32.0,97.0,32.0,2.0,107.0,499.0,499.0,116.0,499.0,2.0,499.0,499.0,7.0,499.0,499.0,60.0,235.0,32.0,97.0,32.0,2.0,107.0,499.0,499.0,1.0,27.0,0.0,358.0,499.0,16.0,44.0,48.0,264.0,499.0,7.0,255.0,165.0,499.0,358.0,499.0,16.0,48.0,499.0,499.0,7.0,499.0,358.0,499.0,16.0,499.0,7.0,499.0,412.0,358.0,499.0,16.0,44.0,48.0,264.0,499.0,7.0,255.0,165.0,499.0,358.0,499.0,16.0,48.0,499.0,499.0,7.0,499.0,358.0,499.0,16.0,499.0,7.0,499.0,412.0,1.0,30.0,0.0,61.0,10.0,499.0,53.0,499.0,157.0,11.0,50.0,36.0,358.0,499.0,4.0,6.0,22.0,161.0,224.0,499.0,4.0,21.0,499.0,8.0,177.0,10.0,252.0,103.0,10.0,2.0,117.0,191.0,61.0,10.0,499.0,53.0,499.0,157.0,11.0,50.0,36.0,358.0,499.0,4.0,6.0,22.0,161.0,224.0,499.0,4.0,21.0,499.0,8.0,177.0,10.0,252.0,103.0,10.0,2.0,117.0,191.0,1.0,23.0,0.0,15.0,499.0,10.0,84.0,10.0,188.0,16.0,2.0,103.0,252.0,4.0,499.0,19.0,2.0,312.0,402.0,154.0,116.0,99.0,4.0,21.0,499.0,15.0,499.0,10.0,84.0,10.0,188.0,16.0,2.0,103.0,252.0,4.0,499.0,19.0,2.0,312.0,402.0,154.0,116.0,99.0,4.0,21.0,499.0,1.0,82.0,0.0,499.0,213.0,27.0,92.0,499.0,252.0,279.0,11.0,50.0,499.0,499.0,37.0,499.0,499.0,7.0,499.0,16.0,116.0,99.0,4.0,21.0,187.0,499.0,4.0,11.0,279.0,11.0,50.0,8.0,499.0,10.0,414.0,499.0,53.0,30.0,62.0,130.0,4.0,11.0,16.0,205.0,432.0,430.0,6.0,428.0,22.0,499.0,39.0,358.0,499.0,44.0,2.0,117.0,191.0,499.0,499.0,37.0,499.0,9.0,499.0,8.0,177.0,499.0,23.0,4.0,499.0,20.0,499.0,499.0,7.0,344.0,499.0,499.0,43.0,4.0,499.0,165.0,20.0,2.0,499.0,499.0,499.0,213.0,27.0,92.0,499.0,252.0,279.0,11.0,50.0,499.0,499.0,37.0,499.0,499.0,7.0,499.0,16.0,116.0,99.0,4.0,21.0,187.0,499.0,4.0,11.0,279.0,11.0,50.0,8.0,499.0,10.0,414.0,499.0,53.0,30.0,62.0,130.0,4.0,11.0,16.0,205.0,432.0,430.0,6.0,428.0,22.0,499.0,39.0,358.0,499.0,44.0,2.0,117.0,191.0,499.0,499.0,37.0,499.0,9.0,499.0,8.0,177.0,499.0,23.0,4.0,499.0,20.0,499.0,499.0,7.0,344.0,499.0,499.0,43.0,4.0,499.0,165.0,20.0,2.0,499.0,499.0,1.0,224.0,0.0,499.0,4.0,2.0,499.0,499.0,499.0,499.0,19.0,499.0,108.0,134.0,169.0,10.0,499.0,16.0,499.0,265.0,7.0,134.0,169.0,10.0,499.0,7.0,499.0,16.0,499.0,499.0,15.0,30.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,499.0,41.0,437.0,32.0,4.0,499.0,2.0,499.0,107.0,27.0,4.0,499.0,499.0,8.0,499.0,88.0,161.0,81.0,499.0,23.0,33.0,27.0,499.0,349.0,12.0,2.0,343.0,91.0,27.0,21.0,499.0,4.0,499.0,499.0,499.0,74.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,16.0,8.0,499.0,10.0,2.0,499.0,27.0,8.0,499.0,84.0,91.0,499.0,4.0,229.0,46.0,499.0,499.0,499.0,499.0,419.0,164.0,499.0,4.0,21.0,499.0,13.0,499.0,12.0,44.0,499.0,28.0,499.0,499.0,12.0,24.0,28.0,499.0,74.0,57.0,499.0,20.0,319.0,499.0,452.0,12.0,461.0,164.0,28.0,198.0,499.0,7.0,2.0,499.0,10.0,499.0,13.0,13.0,12.0,4.0,499.0,164.0,452.0,499.0,28.0,499.0,461.0,499.0,499.0,57.0,40.0,499.0,64.0,2.0,354.0,10.0,2.0,499.0,13.0,13.0,12.0,499.0,70.0,499.0,10.0,343.0,499.0,499.0,10.0,164.0,499.0,9.0,16.0,2.0,107.0,10.0,2.0,42.0,4.0,499.0,33.0,4.0,499.0,9.0,7.0,4.0,499.0,98.0,343.0,499.0,154.0,499.0,23.0,253.0,499.0,7.0,499.0,154.0,499.0,15.0,253.0,499.0,32.0,4.0,43.0,499.0,499.0,103.0,376.0,4.0,499.0,57.0,499.0,7.0,499.0,499.0,4.0,2.0,499.0,499.0,499.0,499.0,19.0,499.0,108.0,134.0,169.0,10.0,499.0,16.0,499.0,265.0,7.0,134.0,169.0,10.0,499.0,7.0,499.0,16.0,499.0,499.0,15.0,30.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,499.0,41.0,437.0,32.0,4.0,499.0,2.0,499.0,107.0,27.0,4.0,499.0,499.0,8.0,499.0,88.0,161.0,81.0,499.0,23.0,33.0,27.0,499.0,349.0,12.0,2.0,343.0,91.0,27.0,21.0,499.0,4.0,499.0,499.0,499.0,74.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,16.0,8.0,499.0,10.0,2.0,499.0,27.0,8.0,499.0,84.0,91.0,499.0,4.0,229.0,46.0,499.0,499.0,499.0,499.0,419.0,164.0,499.0,4.0,21.0,499.0,13.0,499.0,12.0,44.0,499.0,28.0,499.0,499.0,12.0,24.0,28.0,499.0,74.0,57.0,499.0,20.0,319.0,499.0,452.0,12.0,461.0,164.0,28.0,198.0,499.0,7.0,2.0,499.0,10.0,499.0,13.0,13.0,12.0,4.0,499.0,164.0,452.0,499.0,28.0,499.0,461.0,499.0,499.0,57.0,40.0,499.0,64.0,2.0,354.0,10.0,2.0,499.0,13.0,13.0,12.0,499.0,70.0,499.0,10.0,343.0,499.0,499.0,10.0,164.0,499.0,9.0,16.0,2.0,107.0,10.0,2.0,42.0,4.0,499.0,33.0,4.0,499.0,9.0,7.0,4.0,499.0,98.0,343.0,499.0,154.0,499.0,23.0,253.0,499.0,7.0,499.0,154.0,499.0,15.0,253.0,499.0,32.0,4.0,43.0,499.0,499.0,103.0,376.0,4.0,499.0,57.0,499.0,7.0,499.0,1.0,48.0,0.0,499.0,499.0,62.0,499.0,12.0,499.0,248.0,499.0,91.0,27.0,21.0,274.0,19.0,433.0,7.0,499.0,499.0,7.0,499.0,44.0,294.0,499.0,499.0,12.0,499.0,28.0,58.0,499.0,4.0,499.0,210.0,499.0,28.0,499.0,69.0,4.0,107.0,499.0,74.0,499.0,2.0,499.0,4.0,84.0,24.0,28.0,499.0,499.0,499.0,62.0,499.0,12.0,499.0,248.0,499.0,91.0,27.0,21.0,274.0,19.0,433.0,7.0,499.0,499.0,7.0,499.0,44.0,294.0,499.0,499.0,12.0,499.0,28.0,58.0,499.0,4.0,499.0,210.0,499.0,28.0,499.0,69.0,4.0,107.0,499.0,74.0,499.0,2.0,499.0,4.0,84.0,24.0,28.0,499.0,1.0,50.0,0.0,25.0,14.0,14.0,52.0,8.0,248.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,2.0,144.0,499.0,499.0,8.0,499.0,4.0,499.0,43.0,286.0,499.0,499.0,9.0,16.0,57.0,107.0,9.0,16.0,57.0,499.0,4.0,499.0,392.0,253.0,343.0,7.0,4.0,261.0,98.0,499.0,19.0,57.0,499.0,499.0,14.0,14.0,25.0,14.0,14.0,52.0,8.0,248.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,2.0,144.0,499.0,499.0,8.0,499.0,4.0,499.0,43.0,286.0,499.0,499.0,9.0,16.0,57.0,107.0,9.0,16.0,57.0,499.0,4.0,499.0,392.0,253.0,343.0,7.0,4.0,261.0,98.0,499.0,19.0,57.0,499.0,499.0,14.0,14.0,1.0,7.0,0.0,12.0,16.0,8.0,239.0,499.0,476.0,12.0,16.0,8.0,239.0,499.0,476.0,1.0,22.0,0.0,49.0,202.0,3.0,17.0,123.0,12.0,49.0,499.0,499.0,499.0,72.0,12.0,499.0,499.0,42.0,147.0,3.0,17.0,92.0,235.0,203.0,49.0,202.0,3.0,17.0,123.0,12.0,49.0,499.0,499.0,499.0,72.0,12.0,499.0,499.0,42.0,147.0,3.0,17.0,92.0,235.0,203.0,1.0,34.0,0.0,22.0,11.0,443.0,306.0,10.0,164.0,499.0,499.0,11.0,305.0,2.0,499.0,10.0,2.0,499.0,57.0,499.0,6.0,102.0,417.0,499.0,499.0,25.0,45.0,28.0,380.0,499.0,499.0,56.0,8.0,115.0,32.0,97.0,22.0,11.0,443.0,306.0,10.0,164.0,499.0,499.0,11.0,305.0,2.0,499.0,10.0,2.0,499.0,57.0,499.0,6.0,102.0,417.0,499.0,499.0,25.0,45.0,28.0,380.0,499.0,499.0,56.0,8.0,115.0,32.0,97.0,1.0,22.0,0.0,26.0,47.0,88.0,8.0,499.0,499.0,47.0,111.0,118.0,4.0,178.0,12.0,286.0,9.0,60.0,21.0,2.0,190.0,10.0,183.0,499.0,26.0,47.0,88.0,8.0,499.0,499.0,47.0,111.0,118.0,4.0,178.0,12.0,286.0,9.0,60.0,21.0,2.0,190.0,10.0,183.0,499.0,1.0,27.0,0.0,2.0,499.0,111.0,21.0,499.0,15.0,2.0,499.0,499.0,25.0,188.0,66.0,104.0,8.0,499.0,499.0,499.0,38.0,3.0,17.0,22.0,4.0,21.0,499.0,20.0,9.0,2.0,499.0,111.0,21.0,499.0,15.0,2.0,499.0,499.0,25.0,188.0,66.0,104.0,8.0,499.0,499.0,499.0,38.0,3.0,17.0,22.0,4.0,21.0,499.0,20.0,9.0,1.0,14.0,0.0,75.0,45.0,16.0,55.0,499.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,499.0,75.0,45.0,16.0,55.0,499.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,7.0,0.0,196.0,12.0,499.0,4.0,126.0,499.0,196.0,12.0,499.0,4.0,126.0,499.0,1.0,14.0,0.0,136.0,8.0,211.0,11.0,34.0,168.0,181.0,20.0,2.0,499.0,33.0,19.0,227.0,136.0,8.0,211.0,11.0,34.0,168.0,181.0,20.0,2.0,499.0,33.0,19.0,227.0,1.0,10.0,0.0,324.0,11.0,91.0,283.0,53.0,11.0,104.0,4.0,51.0,324.0,11.0,91.0,283.0,53.0,11.0,104.0,4.0,51.0,1.0,19.0,0.0,9.0,3.0,18.0,374.0,12.0,431.0,499.0,3.0,17.0,499.0,55.0,499.0,33.0,499.0,499.0,16.0,499.0,499.0,9.0,3.0,18.0,374.0,12.0,431.0,499.0,3.0,17.0,499.0,55.0,499.0,33.0,499.0,499.0,16.0,499.0,499.0,1.0,18.0,0.0,45.0,16.0,8.0,340.0,12.0,59.0,42.0,3.0,18.0,499.0,62.0,499.0,499.0,4.0,46.0,499.0,499.0,45.0,16.0,8.0,340.0,12.0,59.0,42.0,3.0,18.0,499.0,62.0,499.0,499.0,4.0,46.0,499.0,499.0,1.0,11.0,0.0,9.0,3.0,18.0,499.0,429.0,25.0,9.0,16.0,8.0,340.0,9.0,3.0,18.0,499.0,429.0,25.0,9.0,16.0,8.0,340.0,1.0,52.0,0.0,45.0,16.0,75.0,8.0,499.0,340.0,26.0,2.0,499.0,29.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,30.0,499.0,58.0,499.0,499.0,68.0,499.0,13.0,499.0,499.0,499.0,19.0,499.0,499.0,64.0,431.0,68.0,10.0,499.0,48.0,2.0,499.0,23.0,2.0,499.0,499.0,499.0,89.0,499.0,499.0,28.0,27.0,499.0,499.0,45.0,16.0,75.0,8.0,499.0,340.0,26.0,2.0,499.0,29.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,30.0,499.0,58.0,499.0,499.0,68.0,499.0,13.0,499.0,499.0,499.0,19.0,499.0,499.0,64.0,431.0,68.0,10.0,499.0,48.0,2.0,499.0,23.0,2.0,499.0,499.0,499.0,89.0,499.0,499.0,28.0,27.0,499.0,499.0,1.0,23.0,0.0,24.0,143.0,2.0,499.0,10.0,136.0,499.0,53.0,4.0,51.0,7.0,28.0,64.0,145.0,63.0,286.0,2.0,412.0,10.0,2.0,499.0,499.0,24.0,143.0,2.0,499.0,10.0,136.0,499.0,53.0,4.0,51.0,7.0,28.0,64.0,145.0,63.0,286.0,2.0,412.0,10.0,2.0,499.0,499.0,1.0,49.0,0.0,9.0,3.0,18.0,27.0,40.0,499.0,12.0,406.0,431.0,28.0,499.0,9.0,3.0,18.0,2.0,499.0,499.0,499.0,68.0,2.0,499.0,499.0,16.0,499.0,7.0,45.0,56.0,160.0,81.0,8.0,499.0,499.0,499.0,499.0,12.0,56.0,499.0,45.0,16.0,8.0,499.0,499.0,4.0,70.0,499.0,15.0,118.0,499.0,9.0,3.0,18.0,27.0,40.0,499.0,12.0,406.0,431.0,28.0,499.0,9.0,3.0,18.0,2.0,499.0,499.0,499.0,68.0,2.0,499.0,499.0,16.0,499.0,7.0,45.0,56.0,160.0,81.0,8.0,499.0,499.0,499.0,499.0,12.0,56.0,499.0,45.0,16.0,8.0,499.0,499.0,4.0,70.0,499.0,15.0,118.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,27.0,0.0,499.0,10.0,42.0,143.0,431.0,7.0,42.0,66.0,143.0,431.0,28.0,55.0,58.0,376.0,4.0,499.0,70.0,303.0,10.0,499.0,69.0,188.0,66.0,38.0,3.0,17.0,499.0,10.0,42.0,143.0,431.0,7.0,42.0,66.0,143.0,431.0,28.0,55.0,58.0,376.0,4.0,499.0,70.0,303.0,10.0,499.0,69.0,188.0,66.0,38.0,3.0,17.0,1.0,21.0,0.0,6.0,72.0,341.0,8.0,499.0,10.0,499.0,25.0,394.0,6.0,160.0,499.0,70.0,499.0,499.0,20.0,2.0,233.0,32.0,499.0,6.0,72.0,341.0,8.0,499.0,10.0,499.0,25.0,394.0,6.0,160.0,499.0,70.0,499.0,499.0,20.0,2.0,233.0,32.0,499.0,1.0,23.0,0.0,152.0,11.0,111.0,75.0,499.0,73.0,499.0,499.0,7.0,499.0,172.0,4.0,226.0,2.0,83.0,20.0,2.0,499.0,499.0,10.0,499.0,499.0,152.0,11.0,111.0,75.0,499.0,73.0,499.0,499.0,7.0,499.0,172.0,4.0,226.0,2.0,83.0,20.0,2.0,499.0,499.0,10.0,499.0,499.0,1.0,35.0,0.0,6.0,127.0,499.0,2.0,424.0,499.0,62.0,166.0,39.0,499.0,100.0,230.0,2.0,499.0,499.0,211.0,217.0,499.0,4.0,67.0,27.0,499.0,125.0,499.0,3.0,18.0,499.0,499.0,28.0,499.0,30.0,16.0,399.0,223.0,6.0,127.0,499.0,2.0,424.0,499.0,62.0,166.0,39.0,499.0,100.0,230.0,2.0,499.0,499.0,211.0,217.0,499.0,4.0,67.0,27.0,499.0,125.0,499.0,3.0,18.0,499.0,499.0,28.0,499.0,30.0,16.0,399.0,223.0,1.0,33.0,0.0,6.0,3.0,110.0,427.0,88.0,43.0,499.0,338.0,3.0,17.0,499.0,2.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,291.0,119.0,6.0,499.0,30.0,499.0,499.0,7.0,499.0,15.0,249.0,20.0,9.0,6.0,3.0,110.0,427.0,88.0,43.0,499.0,338.0,3.0,17.0,499.0,2.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,291.0,119.0,6.0,499.0,30.0,499.0,499.0,7.0,499.0,15.0,249.0,20.0,9.0,1.0,16.0,0.0,9.0,3.0,18.0,499.0,187.0,205.0,499.0,4.0,499.0,32.0,97.0,32.0,400.0,7.0,499.0,9.0,3.0,18.0,499.0,187.0,205.0,499.0,4.0,499.0,32.0,97.0,32.0,400.0,7.0,499.0,1.0,7.0,0.0,27.0,223.0,25.0,252.0,32.0,499.0,27.0,223.0,25.0,252.0,32.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,499.0,216.0,5.0,5.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,309.0,499.0,499.0,28.0,15.0,39.0,499.0,223.0,32.0,97.0,32.0,57.0,499.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,309.0,499.0,499.0,28.0,15.0,39.0,499.0,223.0,32.0,97.0,32.0,57.0,499.0,499.0,1.0,32.0,0.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,499.0,250.0,2.0,499.0,499.0,214.0,102.0,101.0,261.0,2.0,144.0,391.0,10.0,499.0,7.0,2.0,499.0,499.0,16.0,399.0,317.0,13.0,499.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,499.0,250.0,2.0,499.0,499.0,214.0,102.0,101.0,261.0,2.0,144.0,391.0,10.0,499.0,7.0,2.0,499.0,499.0,16.0,399.0,317.0,13.0,499.0,1.0,52.0,0.0,34.0,143.0,8.0,499.0,58.0,499.0,499.0,41.0,27.0,223.0,25.0,214.0,102.0,101.0,7.0,91.0,122.0,9.0,86.0,413.0,83.0,14.0,14.0,499.0,499.0,499.0,499.0,499.0,4.0,21.0,499.0,4.0,2.0,499.0,413.0,83.0,499.0,14.0,14.0,254.0,499.0,499.0,28.0,87.0,96.0,91.0,21.0,15.0,413.0,83.0,105.0,34.0,143.0,8.0,499.0,58.0,499.0,499.0,41.0,27.0,223.0,25.0,214.0,102.0,101.0,7.0,91.0,122.0,9.0,86.0,413.0,83.0,14.0,14.0,499.0,499.0,499.0,499.0,499.0,4.0,21.0,499.0,4.0,2.0,499.0,413.0,83.0,499.0,14.0,14.0,254.0,499.0,499.0,28.0,87.0,96.0,91.0,21.0,15.0,413.0,83.0,105.0,1.0,35.0,0.0,499.0,19.0,499.0,499.0,499.0,499.0,19.0,146.0,251.0,298.0,499.0,7.0,499.0,28.0,126.0,7.0,499.0,499.0,4.0,499.0,499.0,181.0,31.0,499.0,12.0,34.0,499.0,58.0,499.0,25.0,57.0,499.0,16.0,499.0,499.0,19.0,499.0,499.0,499.0,499.0,19.0,146.0,251.0,298.0,499.0,7.0,499.0,28.0,126.0,7.0,499.0,499.0,4.0,499.0,499.0,181.0,31.0,499.0,12.0,34.0,499.0,58.0,499.0,25.0,57.0,499.0,16.0,499.0,1.0,13.0,0.0,111.0,21.0,126.0,19.0,499.0,499.0,499.0,15.0,499.0,7.0,499.0,499.0,111.0,21.0,126.0,19.0,499.0,499.0,499.0,15.0,499.0,7.0,499.0,499.0,1.0,18.0,0.0,499.0,28.0,2.0,499.0,87.0,344.0,499.0,25.0,34.0,261.0,297.0,499.0,499.0,499.0,19.0,499.0,499.0,499.0,28.0,2.0,499.0,87.0,344.0,499.0,25.0,34.0,261.0,297.0,499.0,499.0,499.0,19.0,499.0,499.0,1.0,11.0,0.0,6.0,499.0,2.0,499.0,7.0,499.0,499.0,273.0,468.0,499.0,6.0,499.0,2.0,499.0,7.0,499.0,499.0,273.0,468.0,499.0,1.0,33.0,0.0,2.0,499.0,499.0,468.0,16.0,218.0,25.0,2.0,499.0,468.0,16.0,8.0,244.0,499.0,7.0,488.0,4.0,21.0,499.0,442.0,499.0,16.0,8.0,87.0,494.0,499.0,499.0,2.0,499.0,111.0,21.0,101.0,2.0,499.0,499.0,468.0,16.0,218.0,25.0,2.0,499.0,468.0,16.0,8.0,244.0,499.0,7.0,488.0,4.0,21.0,499.0,442.0,499.0,16.0,8.0,87.0,494.0,499.0,499.0,2.0,499.0,111.0,21.0,101.0,1.0,39.0,0.0,6.0,3.0,110.0,31.0,4.0,22.0,188.0,15.0,2.0,83.0,7.0,6.0,77.0,443.0,299.0,8.0,499.0,211.0,499.0,25.0,45.0,16.0,295.0,46.0,499.0,63.0,499.0,2.0,499.0,499.0,211.0,6.0,499.0,499.0,499.0,372.0,32.0,97.0,6.0,3.0,110.0,31.0,4.0,22.0,188.0,15.0,2.0,83.0,7.0,6.0,77.0,443.0,299.0,8.0,499.0,211.0,499.0,25.0,45.0,16.0,295.0,46.0,499.0,63.0,499.0,2.0,499.0,499.0,211.0,6.0,499.0,499.0,499.0,372.0,32.0,97.0,1.0,12.0,0.0,6.0,499.0,2.0,304.0,499.0,273.0,499.0,273.0,2.0,413.0,372.0,6.0,499.0,2.0,304.0,499.0,273.0,499.0,273.0,2.0,413.0,372.0,1.0,22.0,0.0,297.0,499.0,372.0,261.0,369.0,2.0,144.0,304.0,5.0,499.0,499.0,7.0,2.0,499.0,499.0,372.0,28.0,40.0,499.0,219.0,499.0,297.0,499.0,372.0,261.0,369.0,2.0,144.0,304.0,5.0,499.0,499.0,7.0,2.0,499.0,499.0,372.0,28.0,40.0,499.0,219.0,499.0,1.0,22.0,0.0,6.0,499.0,499.0,30.0,211.0,9.0,499.0,126.0,499.0,20.0,2.0,499.0,499.0,499.0,499.0,7.0,2.0,499.0,372.0,32.0,97.0,6.0,499.0,499.0,30.0,211.0,9.0,499.0,126.0,499.0,20.0,2.0,499.0,499.0,499.0,499.0,7.0,2.0,499.0,372.0,32.0,97.0,1.0,15.0,0.0,195.0,126.0,211.0,12.0,91.0,21.0,15.0,413.0,83.0,499.0,4.0,21.0,499.0,499.0,195.0,126.0,211.0,12.0,91.0,21.0,15.0,413.0,83.0,499.0,4.0,21.0,499.0,499.0,1.0,10.0,0.0,361.0,31.0,8.0,177.0,10.0,499.0,499.0,499.0,499.0,361.0,31.0,8.0,177.0,10.0,499.0,499.0,499.0,499.0,1.0,43.0,0.0,6.0,499.0,78.0,146.0,474.0,499.0,111.0,185.0,197.0,23.0,499.0,499.0,26.0,499.0,251.0,499.0,8.0,101.0,476.0,69.0,6.0,25.0,11.0,91.0,22.0,499.0,4.0,53.0,49.0,361.0,31.0,19.0,188.0,499.0,20.0,66.0,11.0,28.0,499.0,48.0,31.0,67.0,6.0,499.0,78.0,146.0,474.0,499.0,111.0,185.0,197.0,23.0,499.0,499.0,26.0,499.0,251.0,499.0,8.0,101.0,476.0,69.0,6.0,25.0,11.0,91.0,22.0,499.0,4.0,53.0,49.0,361.0,31.0,19.0,188.0,499.0,20.0,66.0,11.0,28.0,499.0,48.0,31.0,67.0,1.0,21.0,0.0,26.0,36.0,499.0,16.0,499.0,12.0,499.0,36.0,499.0,499.0,28.0,116.0,499.0,36.0,499.0,499.0,499.0,5.0,5.0,80.0,26.0,36.0,499.0,16.0,499.0,12.0,499.0,36.0,499.0,499.0,28.0,116.0,499.0,36.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,174.0,0.0,35.0,5.0,499.0,5.0,489.0,13.0,499.0,230.0,39.0,489.0,16.0,499.0,352.0,5.0,145.0,7.0,6.0,104.0,4.0,499.0,48.0,228.0,378.0,5.0,266.0,125.0,6.0,499.0,39.0,499.0,32.0,499.0,499.0,486.0,489.0,170.0,39.0,409.0,16.0,499.0,119.0,133.0,6.0,104.0,4.0,350.0,228.0,378.0,5.0,266.0,228.0,378.0,5.0,499.0,14.0,499.0,378.0,5.0,352.0,288.0,499.0,352.0,5.0,499.0,25.0,26.0,6.0,499.0,39.0,499.0,74.0,499.0,499.0,5.0,298.0,499.0,5.0,145.0,4.0,499.0,352.0,5.0,145.0,6.0,3.0,110.0,21.0,499.0,39.0,489.0,7.0,87.0,499.0,31.0,11.0,499.0,309.0,306.0,6.0,51.0,48.0,499.0,352.0,5.0,499.0,10.0,499.0,7.0,499.0,39.0,499.0,4.0,499.0,352.0,5.0,145.0,40.0,499.0,39.0,489.0,250.0,39.0,499.0,499.0,432.0,266.0,16.0,114.0,31.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,499.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,13.0,499.0,264.0,192.0,4.0,39.0,499.0,10.0,499.0,416.0,30.0,44.0,499.0,499.0,221.0,67.0,78.0,26.0,11.0,3.0,110.0,31.0,195.0,330.0,20.0,36.0,499.0,35.0,5.0,499.0,5.0,489.0,13.0,499.0,230.0,39.0,489.0,16.0,499.0,352.0,5.0,145.0,7.0,6.0,104.0,4.0,499.0,48.0,228.0,378.0,5.0,266.0,125.0,6.0,499.0,39.0,499.0,32.0,499.0,499.0,486.0,489.0,170.0,39.0,409.0,16.0,499.0,119.0,133.0,6.0,104.0,4.0,350.0,228.0,378.0,5.0,266.0,228.0,378.0,5.0,499.0,14.0,499.0,378.0,5.0,352.0,288.0,499.0,352.0,5.0,499.0,25.0,26.0,6.0,499.0,39.0,499.0,74.0,499.0,499.0,5.0,298.0,499.0,5.0,145.0,4.0,499.0,352.0,5.0,145.0,6.0,3.0,110.0,21.0,499.0,39.0,489.0,7.0,87.0,499.0,31.0,11.0,499.0,309.0,306.0,6.0,51.0,48.0,499.0,352.0,5.0,499.0,10.0,499.0,7.0,499.0,39.0,499.0,4.0,499.0,352.0,5.0,145.0,40.0,499.0,39.0,489.0,250.0,39.0,499.0,499.0,432.0,266.0,16.0,114.0,31.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,499.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,13.0,499.0,264.0,192.0,4.0,39.0,499.0,10.0,499.0,416.0,30.0,44.0,499.0,499.0,221.0,67.0,78.0,26.0,11.0,3.0,110.0,31.0,195.0,330.0,20.0,36.0,499.0,1.0,19.0,0.0,89.0,6.0,3.0,71.0,8.0,499.0,13.0,499.0,7.0,6.0,38.0,3.0,17.0,283.0,499.0,8.0,499.0,499.0,89.0,6.0,3.0,71.0,8.0,499.0,13.0,499.0,7.0,6.0,38.0,3.0,17.0,283.0,499.0,8.0,499.0,499.0,1.0,30.0,0.0,97.0,12.0,3.0,18.0,218.0,7.0,499.0,12.0,11.0,38.0,3.0,17.0,283.0,227.0,63.0,11.0,14.0,51.0,14.0,419.0,8.0,499.0,499.0,499.0,23.0,37.0,236.0,63.0,499.0,97.0,12.0,3.0,18.0,218.0,7.0,499.0,12.0,11.0,38.0,3.0,17.0,283.0,227.0,63.0,11.0,14.0,51.0,14.0,419.0,8.0,499.0,499.0,499.0,23.0,37.0,236.0,63.0,499.0,1.0,32.0,0.0,499.0,499.0,499.0,132.0,499.0,90.0,499.0,23.0,499.0,499.0,90.0,499.0,23.0,499.0,499.0,37.0,236.0,15.0,2.0,499.0,7.0,90.0,499.0,23.0,499.0,499.0,49.0,16.0,8.0,499.0,499.0,499.0,499.0,499.0,132.0,499.0,90.0,499.0,23.0,499.0,499.0,90.0,499.0,23.0,499.0,499.0,37.0,236.0,15.0,2.0,499.0,7.0,90.0,499.0,23.0,499.0,499.0,49.0,16.0,8.0,499.0,499.0,1.0,9.0,0.0,9.0,3.0,18.0,172.0,462.0,8.0,499.0,320.0,9.0,3.0,18.0,172.0,462.0,8.0,499.0,320.0,1.0,10.0,0.0,499.0,29.0,103.0,311.0,14.0,27.0,14.0,2.0,499.0,499.0,29.0,103.0,311.0,14.0,27.0,14.0,2.0,499.0,1.0,32.0,0.0,2.0,209.0,29.0,499.0,58.0,31.0,46.0,320.0,499.0,499.0,180.0,499.0,434.0,66.0,38.0,3.0,17.0,499.0,50.0,499.0,7.0,2.0,499.0,499.0,499.0,482.0,499.0,20.0,90.0,499.0,499.0,2.0,209.0,29.0,499.0,58.0,31.0,46.0,320.0,499.0,499.0,180.0,499.0,434.0,66.0,38.0,3.0,17.0,499.0,50.0,499.0,7.0,2.0,499.0,499.0,499.0,482.0,499.0,20.0,90.0,499.0,499.0,1.0,26.0,0.0,499.0,499.0,499.0,2.0,434.0,2.0,233.0,24.0,499.0,499.0,90.0,499.0,7.0,267.0,73.0,278.0,499.0,61.0,499.0,499.0,499.0,15.0,499.0,499.0,410.0,499.0,499.0,499.0,2.0,434.0,2.0,233.0,24.0,499.0,499.0,90.0,499.0,7.0,267.0,73.0,278.0,499.0,61.0,499.0,499.0,499.0,15.0,499.0,499.0,410.0,1.0,26.0,0.0,97.0,9.0,3.0,18.0,411.0,4.0,328.0,47.0,28.0,44.0,499.0,152.0,499.0,499.0,213.0,27.0,499.0,499.0,15.0,499.0,47.0,91.0,499.0,499.0,499.0,97.0,9.0,3.0,18.0,411.0,4.0,328.0,47.0,28.0,44.0,499.0,152.0,499.0,499.0,213.0,27.0,499.0,499.0,15.0,499.0,47.0,91.0,499.0,499.0,499.0,1.0,17.0,0.0,499.0,11.0,111.0,77.0,22.0,8.0,126.0,499.0,499.0,20.0,203.0,499.0,2.0,499.0,77.0,499.0,499.0,11.0,111.0,77.0,22.0,8.0,126.0,499.0,499.0,20.0,203.0,499.0,2.0,499.0,77.0,499.0,1.0,8.0,0.0,499.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,499.0,2.0,499.0,10.0,134.0,499.0,1.0,14.0,0.0,2.0,499.0,499.0,57.0,499.0,37.0,499.0,13.0,499.0,317.0,13.0,499.0,499.0,2.0,499.0,499.0,57.0,499.0,37.0,499.0,13.0,499.0,317.0,13.0,499.0,499.0,1.0,25.0,0.0,2.0,499.0,499.0,499.0,12.0,32.0,8.0,499.0,4.0,2.0,107.0,7.0,499.0,499.0,12.0,24.0,88.0,499.0,2.0,103.0,499.0,499.0,15.0,499.0,2.0,499.0,499.0,499.0,12.0,32.0,8.0,499.0,4.0,2.0,107.0,7.0,499.0,499.0,12.0,24.0,88.0,499.0,2.0,103.0,499.0,499.0,15.0,499.0,1.0,22.0,0.0,12.0,3.0,18.0,108.0,2.0,499.0,499.0,57.0,499.0,7.0,499.0,499.0,397.0,77.0,210.0,499.0,9.0,499.0,355.0,64.0,499.0,12.0,3.0,18.0,108.0,2.0,499.0,499.0,57.0,499.0,7.0,499.0,499.0,397.0,77.0,210.0,499.0,9.0,499.0,355.0,64.0,499.0,1.0,54.0,0.0,12.0,3.0,18.0,108.0,42.0,31.0,499.0,499.0,499.0,57.0,499.0,499.0,9.0,29.0,2.0,499.0,20.0,499.0,499.0,499.0,499.0,66.0,499.0,31.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,15.0,343.0,499.0,56.0,81.0,499.0,499.0,499.0,73.0,499.0,23.0,499.0,7.0,499.0,2.0,499.0,10.0,499.0,86.0,255.0,499.0,12.0,3.0,18.0,108.0,42.0,31.0,499.0,499.0,499.0,57.0,499.0,499.0,9.0,29.0,2.0,499.0,20.0,499.0,499.0,499.0,499.0,66.0,499.0,31.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,15.0,343.0,499.0,56.0,81.0,499.0,499.0,499.0,73.0,499.0,23.0,499.0,7.0,499.0,2.0,499.0,10.0,499.0,86.0,255.0,499.0,1.0,44.0,0.0,203.0,499.0,192.0,4.0,423.0,2.0,499.0,48.0,2.0,499.0,3.0,18.0,499.0,499.0,2.0,499.0,56.0,56.0,499.0,2.0,499.0,499.0,57.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,24.0,3.0,54.0,499.0,499.0,19.0,9.0,30.0,121.0,52.0,499.0,499.0,9.0,203.0,499.0,192.0,4.0,423.0,2.0,499.0,48.0,2.0,499.0,3.0,18.0,499.0,499.0,2.0,499.0,56.0,56.0,499.0,2.0,499.0,499.0,57.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,24.0,3.0,54.0,499.0,499.0,19.0,9.0,30.0,121.0,52.0,499.0,499.0,9.0,1.0,20.0,0.0,499.0,2.0,499.0,10.0,499.0,366.0,22.0,346.0,4.0,499.0,86.0,499.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,10.0,499.0,366.0,22.0,346.0,4.0,499.0,86.0,499.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,1.0,17.0,0.0,39.0,124.0,16.0,499.0,3.0,18.0,40.0,8.0,499.0,10.0,499.0,16.0,499.0,15.0,30.0,276.0,39.0,124.0,16.0,499.0,3.0,18.0,40.0,8.0,499.0,10.0,499.0,16.0,499.0,15.0,30.0,276.0,1.0,20.0,0.0,499.0,499.0,37.0,2.0,124.0,12.0,59.0,10.0,164.0,499.0,28.0,136.0,499.0,7.0,294.0,499.0,499.0,7.0,499.0,499.0,499.0,37.0,2.0,124.0,12.0,59.0,10.0,164.0,499.0,28.0,136.0,499.0,7.0,294.0,499.0,499.0,7.0,499.0,1.0,5.0,0.0,290.0,5.0,5.0,80.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,6.0,0.0,35.0,5.0,499.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,1.0,22.0,0.0,499.0,499.0,224.0,12.0,279.0,12.0,139.0,111.0,499.0,499.0,2.0,499.0,48.0,499.0,499.0,499.0,22.0,499.0,37.0,499.0,499.0,499.0,499.0,224.0,12.0,279.0,12.0,139.0,111.0,499.0,499.0,2.0,499.0,48.0,499.0,499.0,499.0,22.0,499.0,37.0,499.0,499.0,1.0,17.0,0.0,100.0,3.0,18.0,53.0,6.0,127.0,499.0,4.0,11.0,47.0,91.0,499.0,7.0,499.0,134.0,499.0,100.0,3.0,18.0,53.0,6.0,127.0,499.0,4.0,11.0,47.0,91.0,499.0,7.0,499.0,134.0,499.0,1.0,11.0,0.0,47.0,91.0,151.0,283.0,53.0,16.0,7.0,16.0,27.0,499.0,47.0,91.0,151.0,283.0,53.0,16.0,7.0,16.0,27.0,499.0,1.0,23.0,0.0,499.0,8.0,209.0,206.0,9.0,4.0,2.0,499.0,10.0,499.0,7.0,45.0,29.0,8.0,385.0,499.0,499.0,16.0,499.0,10.0,134.0,499.0,499.0,8.0,209.0,206.0,9.0,4.0,2.0,499.0,10.0,499.0,7.0,45.0,29.0,8.0,385.0,499.0,499.0,16.0,499.0,10.0,134.0,499.0,1.0,33.0,0.0,47.0,91.0,21.0,173.0,4.0,143.0,2.0,499.0,7.0,122.0,9.0,86.0,499.0,499.0,7.0,9.0,60.0,112.0,21.0,55.0,63.0,3.0,18.0,499.0,6.0,111.0,72.0,65.0,216.0,5.0,5.0,257.0,47.0,91.0,21.0,173.0,4.0,143.0,2.0,499.0,7.0,122.0,9.0,86.0,499.0,499.0,7.0,9.0,60.0,112.0,21.0,55.0,63.0,3.0,18.0,499.0,6.0,111.0,72.0,65.0,216.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,6.0,0.0,438.0,5.0,140.0,5.0,499.0,438.0,5.0,140.0,5.0,499.0,1.0,6.0,0.0,9.0,3.0,18.0,499.0,499.0,9.0,3.0,18.0,499.0,499.0,1.0,22.0,0.0,25.0,59.0,10.0,57.0,499.0,16.0,499.0,4.0,214.0,7.0,56.0,8.0,499.0,499.0,499.0,499.0,12.0,499.0,61.0,37.0,11.0,25.0,59.0,10.0,57.0,499.0,16.0,499.0,4.0,214.0,7.0,56.0,8.0,499.0,499.0,499.0,499.0,12.0,499.0,61.0,37.0,11.0,1.0,14.0,0.0,9.0,499.0,59.0,499.0,499.0,25.0,12.0,3.0,18.0,128.0,10.0,2.0,252.0,9.0,499.0,59.0,499.0,499.0,25.0,12.0,3.0,18.0,128.0,10.0,2.0,252.0,1.0,19.0,0.0,103.0,42.0,499.0,9.0,32.0,499.0,19.0,42.0,66.0,34.0,3.0,17.0,499.0,296.0,499.0,25.0,6.0,499.0,103.0,42.0,499.0,9.0,32.0,499.0,19.0,42.0,66.0,34.0,3.0,17.0,499.0,296.0,499.0,25.0,6.0,499.0,1.0,15.0,0.0,45.0,28.0,59.0,499.0,31.0,57.0,499.0,12.0,28.0,499.0,499.0,7.0,499.0,499.0,45.0,28.0,59.0,499.0,31.0,57.0,499.0,12.0,28.0,499.0,499.0,7.0,499.0,499.0,1.0,29.0,0.0,6.0,95.0,41.0,132.0,499.0,7.0,499.0,499.0,499.0,153.0,499.0,499.0,7.0,32.0,8.0,499.0,499.0,9.0,3.0,18.0,499.0,4.0,95.0,43.0,50.0,355.0,20.0,9.0,6.0,95.0,41.0,132.0,499.0,7.0,499.0,499.0,499.0,153.0,499.0,499.0,7.0,32.0,8.0,499.0,499.0,9.0,3.0,18.0,499.0,4.0,95.0,43.0,50.0,355.0,20.0,9.0,1.0,30.0,0.0,188.0,499.0,28.0,27.0,19.0,36.0,499.0,24.0,3.0,54.0,19.0,2.0,499.0,10.0,381.0,251.0,23.0,2.0,499.0,7.0,235.0,499.0,499.0,31.0,30.0,63.0,499.0,499.0,499.0,188.0,499.0,28.0,27.0,19.0,36.0,499.0,24.0,3.0,54.0,19.0,2.0,499.0,10.0,381.0,251.0,23.0,2.0,499.0,7.0,235.0,499.0,499.0,31.0,30.0,63.0,499.0,499.0,499.0,1.0,28.0,0.0,499.0,499.0,387.0,125.0,60.0,22.0,163.0,25.0,9.0,29.0,499.0,32.0,9.0,3.0,18.0,27.0,499.0,98.0,25.0,46.0,499.0,387.0,10.0,46.0,295.0,499.0,211.0,499.0,499.0,387.0,125.0,60.0,22.0,163.0,25.0,9.0,29.0,499.0,32.0,9.0,3.0,18.0,27.0,499.0,98.0,25.0,46.0,499.0,387.0,10.0,46.0,295.0,499.0,211.0,1.0,15.0,0.0,2.0,499.0,4.0,499.0,7.0,453.0,9.0,73.0,16.0,100.0,290.0,5.0,5.0,499.0,2.0,499.0,4.0,499.0,7.0,453.0,9.0,73.0,16.0,100.0,290.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,228.0,13.0,499.0,13.0,499.0,35.0,5.0,499.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,228.0,13.0,499.0,13.0,499.0,1.0,18.0,0.0,499.0,16.0,499.0,97.0,192.0,74.0,2.0,499.0,12.0,246.0,64.0,499.0,499.0,15.0,8.0,499.0,455.0,499.0,16.0,499.0,97.0,192.0,74.0,2.0,499.0,12.0,246.0,64.0,499.0,499.0,15.0,8.0,499.0,455.0,1.0,19.0,0.0,2.0,72.0,499.0,499.0,12.0,499.0,7.0,499.0,499.0,16.0,499.0,19.0,57.0,499.0,499.0,27.0,499.0,452.0,2.0,72.0,499.0,499.0,12.0,499.0,7.0,499.0,499.0,16.0,499.0,19.0,57.0,499.0,499.0,27.0,499.0,452.0,1.0,13.0,0.0,499.0,499.0,46.0,499.0,107.0,4.0,146.0,499.0,57.0,200.0,499.0,499.0,499.0,499.0,46.0,499.0,107.0,4.0,146.0,499.0,57.0,200.0,499.0,499.0,1.0,10.0,0.0,6.0,38.0,3.0,17.0,65.0,24.0,28.0,499.0,499.0,6.0,38.0,3.0,17.0,65.0,24.0,28.0,499.0,499.0,1.0,27.0,0.0,324.0,499.0,68.0,24.0,34.0,3.0,17.0,499.0,499.0,499.0,405.0,92.0,149.0,499.0,4.0,365.0,73.0,4.0,57.0,499.0,3.0,499.0,7.0,240.0,43.0,499.0,324.0,499.0,68.0,24.0,34.0,3.0,17.0,499.0,499.0,499.0,405.0,92.0,149.0,499.0,4.0,365.0,73.0,4.0,57.0,499.0,3.0,499.0,7.0,240.0,43.0,499.0,1.0,9.0,0.0,6.0,34.0,95.0,30.0,499.0,4.0,106.0,152.0,6.0,34.0,95.0,30.0,499.0,4.0,106.0,152.0,1.0,34.0,0.0,6.0,394.0,423.0,9.0,60.0,21.0,101.0,19.0,106.0,4.0,168.0,27.0,499.0,203.0,66.0,138.0,3.0,17.0,499.0,33.0,246.0,61.0,4.0,106.0,499.0,7.0,123.0,12.0,207.0,499.0,4.0,499.0,43.0,6.0,394.0,423.0,9.0,60.0,21.0,101.0,19.0,106.0,4.0,168.0,27.0,499.0,203.0,66.0,138.0,3.0,17.0,499.0,33.0,246.0,61.0,4.0,106.0,499.0,7.0,123.0,12.0,207.0,499.0,4.0,499.0,43.0,1.0,44.0,0.0,45.0,28.0,499.0,499.0,26.0,11.0,499.0,499.0,13.0,2.0,499.0,425.0,499.0,13.0,499.0,425.0,499.0,499.0,13.0,499.0,15.0,499.0,3.0,18.0,499.0,13.0,499.0,15.0,499.0,13.0,499.0,37.0,499.0,13.0,499.0,425.0,499.0,3.0,18.0,499.0,467.0,499.0,499.0,45.0,28.0,499.0,499.0,26.0,11.0,499.0,499.0,13.0,2.0,499.0,425.0,499.0,13.0,499.0,425.0,499.0,499.0,13.0,499.0,15.0,499.0,3.0,18.0,499.0,13.0,499.0,15.0,499.0,13.0,499.0,37.0,499.0,13.0,499.0,425.0,499.0,3.0,18.0,499.0,467.0,499.0,499.0,1.0,12.0,0.0,6.0,3.0,120.0,81.0,499.0,52.0,6.0,22.0,81.0,499.0,499.0,6.0,3.0,120.0,81.0,499.0,52.0,6.0,22.0,81.0,499.0,499.0,1.0,60.0,0.0,6.0,65.0,9.0,16.0,168.0,12.0,24.0,469.0,208.0,251.0,4.0,499.0,73.0,7.0,28.0,499.0,19.0,43.0,85.0,28.0,105.0,499.0,4.0,499.0,11.0,499.0,33.0,12.0,24.0,38.0,3.0,17.0,65.0,9.0,62.0,21.0,285.0,57.0,210.0,32.0,11.0,163.0,3.0,17.0,21.0,499.0,12.0,102.0,499.0,7.0,41.0,24.0,163.0,3.0,17.0,50.0,8.0,373.0,499.0,6.0,65.0,9.0,16.0,168.0,12.0,24.0,469.0,208.0,251.0,4.0,499.0,73.0,7.0,28.0,499.0,19.0,43.0,85.0,28.0,105.0,499.0,4.0,499.0,11.0,499.0,33.0,12.0,24.0,38.0,3.0,17.0,65.0,9.0,62.0,21.0,285.0,57.0,210.0,32.0,11.0,163.0,3.0,17.0,21.0,499.0,12.0,102.0,499.0,7.0,41.0,24.0,163.0,3.0,17.0,50.0,8.0,373.0,499.0,1.0,12.0,0.0,45.0,62.0,21.0,76.0,42.0,66.0,365.0,61.0,10.0,499.0,105.0,45.0,62.0,21.0,76.0,42.0,66.0,365.0,61.0,10.0,499.0,105.0,1.0,9.0,0.0,38.0,3.0,17.0,305.0,19.0,70.0,499.0,499.0,38.0,3.0,17.0,305.0,19.0,70.0,499.0,499.0,1.0,24.0,0.0,11.0,3.0,109.0,72.0,174.0,227.0,499.0,52.0,24.0,123.0,55.0,7.0,11.0,3.0,109.0,21.0,32.0,499.0,32.0,136.0,499.0,33.0,499.0,11.0,3.0,109.0,72.0,174.0,227.0,499.0,52.0,24.0,123.0,55.0,7.0,11.0,3.0,109.0,21.0,32.0,499.0,32.0,136.0,499.0,33.0,499.0,1.0,10.0,0.0,294.0,13.0,499.0,23.0,363.0,499.0,19.0,499.0,237.0,294.0,13.0,499.0,23.0,363.0,499.0,19.0,499.0,237.0,1.0,7.0,0.0,499.0,53.0,4.0,335.0,11.0,499.0,499.0,53.0,4.0,335.0,11.0,499.0,1.0,25.0,0.0,61.0,10.0,499.0,6.0,40.0,499.0,2.0,499.0,10.0,44.0,499.0,42.0,499.0,23.0,39.0,499.0,250.0,499.0,119.0,499.0,119.0,499.0,125.0,499.0,61.0,10.0,499.0,6.0,40.0,499.0,2.0,499.0,10.0,44.0,499.0,42.0,499.0,23.0,39.0,499.0,250.0,499.0,119.0,499.0,119.0,499.0,125.0,499.0,1.0,7.0,0.0,44.0,10.0,43.0,88.0,499.0,499.0,44.0,10.0,43.0,88.0,499.0,499.0,1.0,15.0,0.0,6.0,75.0,499.0,2.0,499.0,13.0,499.0,259.0,19.0,8.0,210.0,119.0,237.0,499.0,6.0,75.0,499.0,2.0,499.0,13.0,499.0,259.0,19.0,8.0,210.0,119.0,237.0,499.0,1.0,16.0,0.0,9.0,29.0,8.0,499.0,429.0,52.0,47.0,202.0,3.0,17.0,174.0,8.0,499.0,15.0,499.0,9.0,29.0,8.0,499.0,429.0,52.0,47.0,202.0,3.0,17.0,174.0,8.0,499.0,15.0,499.0,1.0,35.0,0.0,36.0,231.0,499.0,239.0,102.0,499.0,369.0,53.0,30.0,499.0,29.0,48.0,499.0,7.0,499.0,499.0,499.0,10.0,412.0,20.0,499.0,16.0,239.0,499.0,13.0,499.0,26.0,499.0,191.0,2.0,499.0,13.0,499.0,499.0,36.0,231.0,499.0,239.0,102.0,499.0,369.0,53.0,30.0,499.0,29.0,48.0,499.0,7.0,499.0,499.0,499.0,10.0,412.0,20.0,499.0,16.0,239.0,499.0,13.0,499.0,26.0,499.0,191.0,2.0,499.0,13.0,499.0,499.0,1.0,31.0,0.0,2.0,231.0,499.0,11.0,149.0,31.0,11.0,499.0,88.0,8.0,499.0,128.0,10.0,227.0,499.0,22.0,11.0,88.0,4.0,333.0,20.0,2.0,499.0,10.0,8.0,499.0,499.0,10.0,36.0,499.0,2.0,231.0,499.0,11.0,149.0,31.0,11.0,499.0,88.0,8.0,499.0,128.0,10.0,227.0,499.0,22.0,11.0,88.0,4.0,333.0,20.0,2.0,499.0,10.0,8.0,499.0,499.0,10.0,36.0,499.0,1.0,35.0,0.0,2.0,72.0,121.0,6.0,29.0,499.0,499.0,74.0,114.0,31.0,30.0,29.0,79.0,499.0,176.0,484.0,10.0,499.0,23.0,499.0,56.0,298.0,13.0,228.0,499.0,10.0,499.0,499.0,499.0,14.0,93.0,14.0,2.0,484.0,2.0,72.0,121.0,6.0,29.0,499.0,499.0,74.0,114.0,31.0,30.0,29.0,79.0,499.0,176.0,484.0,10.0,499.0,23.0,499.0,56.0,298.0,13.0,228.0,499.0,10.0,499.0,499.0,499.0,14.0,93.0,14.0,2.0,484.0,1.0,30.0,0.0,2.0,499.0,499.0,136.0,372.0,64.0,2.0,484.0,11.0,3.0,54.0,48.0,4.0,220.0,41.0,24.0,499.0,499.0,2.0,484.0,93.0,11.0,77.0,50.0,8.0,499.0,4.0,220.0,9.0,2.0,499.0,499.0,136.0,372.0,64.0,2.0,484.0,11.0,3.0,54.0,48.0,4.0,220.0,41.0,24.0,499.0,499.0,2.0,484.0,93.0,11.0,77.0,50.0,8.0,499.0,4.0,220.0,9.0,1.0,37.0,0.0,7.0,492.0,11.0,22.0,8.0,499.0,4.0,220.0,44.0,10.0,2.0,499.0,15.0,8.0,499.0,11.0,22.0,55.0,117.0,4.0,78.0,79.0,132.0,499.0,11.0,156.0,4.0,499.0,4.0,50.0,4.0,2.0,14.0,499.0,14.0,484.0,7.0,492.0,11.0,22.0,8.0,499.0,4.0,220.0,44.0,10.0,2.0,499.0,15.0,8.0,499.0,11.0,22.0,55.0,117.0,4.0,78.0,79.0,132.0,499.0,11.0,156.0,4.0,499.0,4.0,50.0,4.0,2.0,14.0,499.0,14.0,484.0,1.0,9.0,0.0,499.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,1.0,23.0,0.0,460.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,10.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,10.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,1.0,28.0,0.0,460.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,1.0,21.0,0.0,460.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,223.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,223.0,499.0,499.0,499.0,1.0,37.0,0.0,499.0,16.0,499.0,475.0,499.0,499.0,499.0,499.0,475.0,499.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,499.0,321.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,16.0,499.0,475.0,499.0,499.0,499.0,499.0,475.0,499.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,499.0,321.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,1.0,42.0,0.0,6.0,22.0,81.0,8.0,373.0,499.0,10.0,499.0,17.0,7.0,499.0,499.0,19.0,228.0,113.0,237.0,6.0,127.0,15.0,39.0,272.0,3.0,18.0,49.0,56.0,81.0,499.0,19.0,136.0,8.0,499.0,37.0,236.0,170.0,499.0,499.0,496.0,61.0,19.0,2.0,499.0,6.0,22.0,81.0,8.0,373.0,499.0,10.0,499.0,17.0,7.0,499.0,499.0,19.0,228.0,113.0,237.0,6.0,127.0,15.0,39.0,272.0,3.0,18.0,49.0,56.0,81.0,499.0,19.0,136.0,8.0,499.0,37.0,236.0,170.0,499.0,499.0,496.0,61.0,19.0,2.0,499.0,1.0,14.0,0.0,6.0,127.0,27.0,499.0,49.0,499.0,499.0,351.0,356.0,6.0,78.0,48.0,371.0,6.0,127.0,27.0,499.0,49.0,499.0,499.0,351.0,356.0,6.0,78.0,48.0,371.0,1.0,22.0,0.0,499.0,37.0,499.0,499.0,45.0,10.0,2.0,256.0,12.0,499.0,499.0,499.0,19.0,2.0,499.0,194.0,483.0,49.0,29.0,2.0,415.0,499.0,37.0,499.0,499.0,45.0,10.0,2.0,256.0,12.0,499.0,499.0,499.0,19.0,2.0,499.0,194.0,483.0,49.0,29.0,2.0,415.0,1.0,18.0,0.0,499.0,2.0,499.0,131.0,8.0,96.0,499.0,259.0,41.0,12.0,147.0,3.0,17.0,130.0,49.0,29.0,189.0,499.0,2.0,499.0,131.0,8.0,96.0,499.0,259.0,41.0,12.0,147.0,3.0,17.0,130.0,49.0,29.0,189.0,1.0,26.0,0.0,7.0,49.0,499.0,8.0,177.0,15.0,2.0,231.0,462.0,10.0,2.0,499.0,25.0,49.0,3.0,18.0,142.0,8.0,499.0,4.0,162.0,93.0,49.0,499.0,499.0,7.0,49.0,499.0,8.0,177.0,15.0,2.0,231.0,462.0,10.0,2.0,499.0,25.0,49.0,3.0,18.0,142.0,8.0,499.0,4.0,162.0,93.0,49.0,499.0,499.0,1.0,15.0,0.0,31.0,9.0,33.0,27.0,499.0,147.0,3.0,17.0,92.0,130.0,12.0,9.0,16.0,499.0,31.0,9.0,33.0,27.0,499.0,147.0,3.0,17.0,92.0,130.0,12.0,9.0,16.0,499.0,1.0,16.0,0.0,9.0,40.0,499.0,9.0,3.0,18.0,8.0,115.0,4.0,148.0,153.0,499.0,36.0,499.0,499.0,9.0,40.0,499.0,9.0,3.0,18.0,8.0,115.0,4.0,148.0,153.0,499.0,36.0,499.0,499.0,1.0,20.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,148.0,68.0,24.0,3.0,54.0,98.0,7.0,499.0,10.0,226.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,148.0,68.0,24.0,3.0,54.0,98.0,7.0,499.0,10.0,226.0,499.0,1.0,14.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,185.0,61.0,499.0,499.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,185.0,61.0,499.0,499.0,499.0,1.0,13.0,0.0,4.0,59.0,12.0,34.0,130.0,293.0,61.0,499.0,4.0,57.0,175.0,499.0,4.0,59.0,12.0,34.0,130.0,293.0,61.0,499.0,4.0,57.0,175.0,499.0,1.0,18.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,51.0,36.0,499.0,20.0,499.0,175.0,499.0,24.0,31.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,51.0,36.0,499.0,20.0,499.0,175.0,499.0,24.0,31.0,1.0,18.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,448.0,33.0,499.0,2.0,499.0,10.0,59.0,175.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,448.0,33.0,499.0,2.0,499.0,10.0,59.0,175.0,499.0,1.0,19.0,0.0,4.0,59.0,9.0,34.0,130.0,8.0,115.0,4.0,148.0,32.0,499.0,52.0,24.0,22.0,8.0,499.0,499.0,499.0,4.0,59.0,9.0,34.0,130.0,8.0,115.0,4.0,148.0,32.0,499.0,52.0,24.0,22.0,8.0,499.0,499.0,499.0,1.0,6.0,0.0,24.0,22.0,8.0,499.0,499.0,24.0,22.0,8.0,499.0,499.0,1.0,18.0,0.0,27.0,187.0,499.0,25.0,45.0,91.0,21.0,63.0,499.0,499.0,13.0,499.0,15.0,2.0,499.0,10.0,499.0,27.0,187.0,499.0,25.0,45.0,91.0,21.0,63.0,499.0,499.0,13.0,499.0,15.0,2.0,499.0,10.0,499.0,1.0,13.0,0.0,55.0,63.0,56.0,224.0,9.0,291.0,25.0,9.0,91.0,21.0,45.0,499.0,55.0,63.0,56.0,224.0,9.0,291.0,25.0,9.0,91.0,21.0,45.0,499.0,1.0,12.0,0.0,9.0,3.0,110.0,21.0,499.0,26.0,208.0,224.0,9.0,499.0,119.0,9.0,3.0,110.0,21.0,499.0,26.0,208.0,224.0,9.0,499.0,119.0,1.0,62.0,0.0,68.0,8.0,238.0,499.0,19.0,79.0,4.0,51.0,499.0,499.0,499.0,67.0,100.0,72.0,4.0,335.0,67.0,499.0,11.0,91.0,51.0,12.0,139.0,11.0,3.0,54.0,293.0,4.0,499.0,61.0,79.0,4.0,499.0,499.0,499.0,27.0,223.0,3.0,18.0,499.0,25.0,15.0,276.0,203.0,251.0,499.0,86.0,30.0,499.0,100.0,3.0,18.0,79.0,11.0,51.0,9.0,230.0,174.0,46.0,499.0,499.0,68.0,8.0,238.0,499.0,19.0,79.0,4.0,51.0,499.0,499.0,499.0,67.0,100.0,72.0,4.0,335.0,67.0,499.0,11.0,91.0,51.0,12.0,139.0,11.0,3.0,54.0,293.0,4.0,499.0,61.0,79.0,4.0,499.0,499.0,499.0,27.0,223.0,3.0,18.0,499.0,25.0,15.0,276.0,203.0,251.0,499.0,86.0,30.0,499.0,100.0,3.0,18.0,79.0,11.0,51.0,9.0,230.0,174.0,46.0,499.0,499.0,1.0,7.0,0.0,6.0,499.0,499.0,15.0,499.0,499.0,6.0,499.0,499.0,15.0,499.0,499.0,1.0,30.0,0.0,499.0,64.0,499.0,13.0,499.0,19.0,330.0,25.0,24.0,3.0,54.0,23.0,8.0,499.0,44.0,172.0,2.0,98.0,499.0,45.0,3.0,18.0,116.0,8.0,499.0,499.0,5.0,5.0,499.0,499.0,64.0,499.0,13.0,499.0,19.0,330.0,25.0,24.0,3.0,54.0,23.0,8.0,499.0,44.0,172.0,2.0,98.0,499.0,45.0,3.0,18.0,116.0,8.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,19.0,0.0,35.0,5.0,140.0,5.0,499.0,125.0,499.0,23.0,2.0,499.0,3.0,18.0,499.0,269.0,93.0,499.0,5.0,499.0,35.0,5.0,140.0,5.0,499.0,125.0,499.0,23.0,2.0,499.0,3.0,18.0,499.0,269.0,93.0,499.0,5.0,499.0,1.0,16.0,0.0,9.0,3.0,18.0,15.0,36.0,499.0,499.0,2.0,495.0,74.0,2.0,499.0,5.0,499.0,499.0,9.0,3.0,18.0,15.0,36.0,499.0,499.0,2.0,495.0,74.0,2.0,499.0,5.0,499.0,499.0,1.0,19.0,0.0,9.0,3.0,18.0,8.0,499.0,139.0,12.0,499.0,23.0,119.0,100.0,3.0,18.0,180.0,6.0,29.0,278.0,499.0,9.0,3.0,18.0,8.0,499.0,139.0,12.0,499.0,23.0,119.0,100.0,3.0,18.0,180.0,6.0,29.0,278.0,499.0,1.0,68.0,0.0,466.0,36.0,499.0,33.0,499.0,7.0,9.0,62.0,162.0,4.0,8.0,499.0,20.0,8.0,272.0,5.0,272.0,7.0,9.0,163.0,3.0,17.0,221.0,11.0,51.0,499.0,84.0,29.0,2.0,124.0,6.0,346.0,395.0,238.0,499.0,7.0,224.0,30.0,139.0,48.0,79.0,499.0,2.0,139.0,6.0,34.0,3.0,17.0,51.0,16.0,309.0,38.0,3.0,17.0,51.0,53.0,6.0,157.0,306.0,51.0,30.0,250.0,465.0,2.0,400.0,499.0,499.0,466.0,36.0,499.0,33.0,499.0,7.0,9.0,62.0,162.0,4.0,8.0,499.0,20.0,8.0,272.0,5.0,272.0,7.0,9.0,163.0,3.0,17.0,221.0,11.0,51.0,499.0,84.0,29.0,2.0,124.0,6.0,346.0,395.0,238.0,499.0,7.0,224.0,30.0,139.0,48.0,79.0,499.0,2.0,139.0,6.0,34.0,3.0,17.0,51.0,16.0,309.0,38.0,3.0,17.0,51.0,53.0,6.0,157.0,306.0,51.0,30.0,250.0,465.0,2.0,400.0,499.0,499.0,1.0,7.0,0.0,499.0,112.0,38.0,3.0,17.0,78.0,499.0,112.0,38.0,3.0,17.0,78.0,1.0,68.0,0.0,40.0,51.0,9.0,254.0,133.0,11.0,34.0,465.0,499.0,499.0,400.0,7.0,324.0,59.0,76.0,167.0,196.0,6.0,112.0,38.0,3.0,17.0,78.0,53.0,3.0,18.0,99.0,23.0,25.0,9.0,329.0,499.0,298.0,135.0,499.0,164.0,499.0,499.0,11.0,3.0,120.0,88.0,19.0,125.0,418.0,153.0,8.0,499.0,32.0,4.0,53.0,24.0,157.0,11.0,34.0,118.0,499.0,499.0,13.0,13.0,84.0,16.0,2.0,499.0,30.0,167.0,400.0,40.0,51.0,9.0,254.0,133.0,11.0,34.0,465.0,499.0,499.0,400.0,7.0,324.0,59.0,76.0,167.0,196.0,6.0,112.0,38.0,3.0,17.0,78.0,53.0,3.0,18.0,99.0,23.0,25.0,9.0,329.0,499.0,298.0,135.0,499.0,164.0,499.0,499.0,11.0,3.0,120.0,88.0,19.0,125.0,418.0,153.0,8.0,499.0,32.0,4.0,53.0,24.0,157.0,11.0,34.0,118.0,499.0,499.0,13.0,13.0,84.0,16.0,2.0,499.0,30.0,167.0,400.0,1.0,35.0,0.0,11.0,3.0,109.0,50.0,114.0,499.0,499.0,442.0,499.0,12.0,167.0,499.0,2.0,499.0,16.0,499.0,499.0,162.0,4.0,36.0,487.0,7.0,133.0,188.0,499.0,62.0,280.0,11.0,2.0,499.0,4.0,499.0,499.0,43.0,11.0,3.0,109.0,50.0,114.0,499.0,499.0,442.0,499.0,12.0,167.0,499.0,2.0,499.0,16.0,499.0,499.0,162.0,4.0,36.0,487.0,7.0,133.0,188.0,499.0,62.0,280.0,11.0,2.0,499.0,4.0,499.0,499.0,43.0,1.0,37.0,0.0,6.0,78.0,326.0,48.0,79.0,4.0,50.0,2.0,190.0,167.0,53.0,2.0,499.0,51.0,25.0,9.0,3.0,18.0,8.0,393.0,7.0,9.0,3.0,18.0,101.0,69.0,499.0,37.0,238.0,19.0,323.0,11.0,100.0,19.0,46.0,471.0,6.0,78.0,326.0,48.0,79.0,4.0,50.0,2.0,190.0,167.0,53.0,2.0,499.0,51.0,25.0,9.0,3.0,18.0,8.0,393.0,7.0,9.0,3.0,18.0,101.0,69.0,499.0,37.0,238.0,19.0,323.0,11.0,100.0,19.0,46.0,471.0,1.0,2.0,0.0,499.0,499.0,1.0,20.0,0.0,89.0,2.0,499.0,499.0,499.0,499.0,459.0,23.0,90.0,499.0,432.0,266.0,19.0,8.0,499.0,10.0,48.0,499.0,459.0,89.0,2.0,499.0,499.0,499.0,499.0,459.0,23.0,90.0,499.0,432.0,266.0,19.0,8.0,499.0,10.0,48.0,499.0,459.0,1.0,28.0,0.0,15.0,2.0,499.0,499.0,89.0,499.0,486.0,499.0,459.0,7.0,12.0,3.0,18.0,499.0,7.0,499.0,10.0,15.0,13.0,7.0,13.0,499.0,19.0,2.0,499.0,7.0,499.0,15.0,2.0,499.0,499.0,89.0,499.0,486.0,499.0,459.0,7.0,12.0,3.0,18.0,499.0,7.0,499.0,10.0,15.0,13.0,7.0,13.0,499.0,19.0,2.0,499.0,7.0,499.0,1.0,23.0,0.0,6.0,186.0,3.0,17.0,21.0,8.0,258.0,499.0,26.0,46.0,499.0,20.0,12.0,132.0,459.0,23.0,9.0,499.0,59.0,499.0,499.0,499.0,6.0,186.0,3.0,17.0,21.0,8.0,258.0,499.0,26.0,46.0,499.0,20.0,12.0,132.0,459.0,23.0,9.0,499.0,59.0,499.0,499.0,499.0,1.0,11.0,0.0,9.0,147.0,3.0,17.0,22.0,12.0,499.0,6.0,451.0,499.0,9.0,147.0,3.0,17.0,22.0,12.0,499.0,6.0,451.0,499.0,1.0,11.0,0.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,50.0,105.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,50.0,105.0,1.0,30.0,0.0,9.0,3.0,18.0,32.0,26.0,223.0,7.0,2.0,499.0,15.0,2.0,499.0,202.0,3.0,17.0,78.0,12.0,72.0,499.0,7.0,499.0,22.0,8.0,499.0,33.0,499.0,23.0,57.0,499.0,9.0,3.0,18.0,32.0,26.0,223.0,7.0,2.0,499.0,15.0,2.0,499.0,202.0,3.0,17.0,78.0,12.0,72.0,499.0,7.0,499.0,22.0,8.0,499.0,33.0,499.0,23.0,57.0,499.0,1.0,30.0,0.0,44.0,2.0,379.0,168.0,22.0,168.0,499.0,499.0,33.0,499.0,499.0,499.0,136.0,499.0,2.0,103.0,499.0,7.0,74.0,44.0,2.0,379.0,6.0,127.0,499.0,48.0,254.0,76.0,499.0,44.0,2.0,379.0,168.0,22.0,168.0,499.0,499.0,33.0,499.0,499.0,499.0,136.0,499.0,2.0,103.0,499.0,7.0,74.0,44.0,2.0,379.0,6.0,127.0,499.0,48.0,254.0,76.0,499.0,1.0,17.0,0.0,499.0,223.0,16.0,8.0,499.0,7.0,2.0,499.0,15.0,12.0,499.0,29.0,8.0,499.0,20.0,223.0,499.0,223.0,16.0,8.0,499.0,7.0,2.0,499.0,15.0,12.0,499.0,29.0,8.0,499.0,20.0,223.0,1.0,9.0,0.0,499.0,14.0,14.0,377.0,499.0,5.0,5.0,80.0,499.0,14.0,14.0,377.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,113.0,499.0,14.0,14.0,269.0,499.0,13.0,499.0,499.0,5.0,5.0,257.0,35.0,5.0,499.0,113.0,499.0,14.0,14.0,269.0,499.0,13.0,499.0,499.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,71.0,0.0,438.0,5.0,140.0,5.0,499.0,230.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,14.0,14.0,499.0,14.0,14.0,14.0,14.0,499.0,14.0,14.0,5.0,499.0,499.0,499.0,89.0,15.0,8.0,499.0,499.0,499.0,2.0,499.0,499.0,98.0,499.0,7.0,499.0,56.0,499.0,8.0,499.0,13.0,499.0,499.0,499.0,10.0,499.0,499.0,42.0,499.0,32.0,499.0,310.0,438.0,5.0,140.0,5.0,499.0,230.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,14.0,14.0,499.0,14.0,14.0,14.0,14.0,499.0,14.0,14.0,5.0,499.0,499.0,499.0,89.0,15.0,8.0,499.0,499.0,499.0,2.0,499.0,499.0,98.0,499.0,7.0,499.0,56.0,499.0,8.0,499.0,13.0,499.0,499.0,499.0,10.0,499.0,499.0,42.0,499.0,32.0,499.0,310.0,1.0,20.0,0.0,499.0,2.0,499.0,28.0,499.0,499.0,13.0,499.0,66.0,122.0,2.0,499.0,499.0,499.0,7.0,85.0,499.0,2.0,499.0,499.0,2.0,499.0,28.0,499.0,499.0,13.0,499.0,66.0,122.0,2.0,499.0,499.0,499.0,7.0,85.0,499.0,2.0,499.0,1.0,44.0,0.0,499.0,377.0,16.0,461.0,2.0,190.0,37.0,53.0,49.0,213.0,7.0,49.0,16.0,499.0,8.0,499.0,499.0,499.0,66.0,157.0,27.0,499.0,2.0,499.0,499.0,19.0,2.0,409.0,25.0,66.0,56.0,63.0,499.0,103.0,51.0,499.0,207.0,16.0,8.0,499.0,20.0,499.0,499.0,499.0,377.0,16.0,461.0,2.0,190.0,37.0,53.0,49.0,213.0,7.0,49.0,16.0,499.0,8.0,499.0,499.0,499.0,66.0,157.0,27.0,499.0,2.0,499.0,499.0,19.0,2.0,409.0,25.0,66.0,56.0,63.0,499.0,103.0,51.0,499.0,207.0,16.0,8.0,499.0,20.0,499.0,499.0,1.0,34.0,0.0,24.0,499.0,174.0,499.0,499.0,499.0,499.0,8.0,499.0,209.0,201.0,12.0,499.0,461.0,132.0,379.0,499.0,13.0,499.0,8.0,499.0,66.0,499.0,2.0,499.0,10.0,499.0,15.0,499.0,310.0,499.0,13.0,499.0,24.0,499.0,174.0,499.0,499.0,499.0,499.0,8.0,499.0,209.0,201.0,12.0,499.0,461.0,132.0,379.0,499.0,13.0,499.0,8.0,499.0,66.0,499.0,2.0,499.0,10.0,499.0,15.0,499.0,310.0,499.0,13.0,499.0,1.0,38.0,0.0,499.0,13.0,499.0,499.0,2.0,201.0,171.0,499.0,12.0,377.0,7.0,499.0,62.0,160.0,196.0,95.0,2.0,433.0,10.0,145.0,14.0,499.0,14.0,14.0,14.0,499.0,499.0,14.0,14.0,89.0,2.0,359.0,499.0,499.0,499.0,64.0,499.0,499.0,13.0,499.0,499.0,2.0,201.0,171.0,499.0,12.0,377.0,7.0,499.0,62.0,160.0,196.0,95.0,2.0,433.0,10.0,145.0,14.0,499.0,14.0,14.0,14.0,499.0,499.0,14.0,14.0,89.0,2.0,359.0,499.0,499.0,499.0,64.0,499.0,1.0,111.0,0.0,23.0,499.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,301.0,23.0,499.0,499.0,20.0,46.0,312.0,499.0,10.0,499.0,5.0,499.0,2.0,499.0,3.0,18.0,499.0,499.0,499.0,499.0,74.0,499.0,499.0,7.0,499.0,499.0,499.0,499.0,15.0,499.0,13.0,499.0,7.0,499.0,499.0,377.0,499.0,16.0,8.0,429.0,330.0,10.0,8.0,499.0,12.0,161.0,499.0,23.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,61.0,10.0,499.0,301.0,23.0,499.0,499.0,499.0,499.0,33.0,312.0,499.0,499.0,499.0,499.0,12.0,2.0,312.0,499.0,499.0,499.0,2.0,359.0,29.0,8.0,499.0,23.0,8.0,499.0,10.0,499.0,113.0,4.0,358.0,14.0,436.0,14.0,58.0,499.0,37.0,499.0,5.0,5.0,80.0,23.0,499.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,301.0,23.0,499.0,499.0,20.0,46.0,312.0,499.0,10.0,499.0,5.0,499.0,2.0,499.0,3.0,18.0,499.0,499.0,499.0,499.0,74.0,499.0,499.0,7.0,499.0,499.0,499.0,499.0,15.0,499.0,13.0,499.0,7.0,499.0,499.0,377.0,499.0,16.0,8.0,429.0,330.0,10.0,8.0,499.0,12.0,161.0,499.0,23.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,61.0,10.0,499.0,301.0,23.0,499.0,499.0,499.0,499.0,33.0,312.0,499.0,499.0,499.0,499.0,12.0,2.0,312.0,499.0,499.0,499.0,2.0,359.0,29.0,8.0,499.0,23.0,8.0,499.0,10.0,499.0,113.0,4.0,358.0,14.0,436.0,14.0,58.0,499.0,37.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,499.0,113.0,499.0,499.0,5.0,5.0,257.0,35.0,5.0,499.0,113.0,499.0,499.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,6.0,0.0,438.0,5.0,499.0,5.0,499.0,438.0,5.0,499.0,5.0,499.0,1.0,7.0,0.0,499.0,499.0,499.0,5.0,5.0,80.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,11.0,0.0,35.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,300.0,5.0,377.0,499.0,5.0,5.0,80.0,35.0,5.0,300.0,5.0,377.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,20.0,0.0,35.0,5.0,436.0,5.0,499.0,5.0,377.0,14.0,6.0,127.0,8.0,215.0,14.0,499.0,67.0,499.0,5.0,5.0,80.0,35.0,5.0,436.0,5.0,499.0,5.0,377.0,14.0,6.0,127.0,8.0,215.0,14.0,499.0,67.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,6.0,0.0,35.0,5.0,158.0,5.0,499.0,35.0,5.0,158.0,5.0,499.0,1.0,17.0,0.0,499.0,499.0,499.0,499.0,499.0,7.0,76.0,499.0,5.0,94.0,5.0,499.0,5.0,499.0,5.0,48.0,499.0,499.0,499.0,499.0,499.0,7.0,76.0,499.0,5.0,94.0,5.0,499.0,5.0,499.0,5.0,48.0,1.0,17.0,0.0,6.0,3.0,71.0,27.0,182.0,53.0,11.0,130.0,52.0,11.0,123.0,12.0,3.0,18.0,499.0,124.0,6.0,3.0,71.0,27.0,182.0,53.0,11.0,130.0,52.0,11.0,123.0,12.0,3.0,18.0,499.0,124.0,1.0,35.0,0.0,9.0,3.0,18.0,499.0,4.0,103.0,42.0,12.0,26.0,8.0,389.0,16.0,499.0,15.0,499.0,10.0,11.0,7.0,11.0,34.0,499.0,43.0,20.0,55.0,340.0,4.0,227.0,11.0,22.0,8.0,499.0,4.0,51.0,9.0,9.0,3.0,18.0,499.0,4.0,103.0,42.0,12.0,26.0,8.0,389.0,16.0,499.0,15.0,499.0,10.0,11.0,7.0,11.0,34.0,499.0,43.0,20.0,55.0,340.0,4.0,227.0,11.0,22.0,8.0,499.0,4.0,51.0,9.0,1.0,10.0,0.0,7.0,2.0,499.0,3.0,18.0,499.0,499.0,4.0,406.0,7.0,2.0,499.0,3.0,18.0,499.0,499.0,4.0,406.0,1.0,7.0,0.0,10.0,499.0,24.0,22.0,499.0,9.0,10.0,499.0,24.0,22.0,499.0,9.0,1.0,11.0,0.0,90.0,499.0,409.0,16.0,4.0,499.0,30.0,499.0,10.0,256.0,90.0,499.0,409.0,16.0,4.0,499.0,30.0,499.0,10.0,256.0,1.0,23.0,0.0,57.0,499.0,499.0,16.0,499.0,222.0,7.0,11.0,38.0,3.0,17.0,65.0,24.0,60.0,77.0,499.0,48.0,499.0,499.0,4.0,499.0,499.0,57.0,499.0,499.0,16.0,499.0,222.0,7.0,11.0,38.0,3.0,17.0,65.0,24.0,60.0,77.0,499.0,48.0,499.0,499.0,4.0,499.0,499.0,1.0,5.0,0.0,30.0,16.0,41.0,374.0,30.0,16.0,41.0,374.0,1.0,14.0,0.0,6.0,365.0,15.0,499.0,499.0,133.0,25.0,6.0,3.0,71.0,64.0,499.0,499.0,6.0,365.0,15.0,499.0,499.0,133.0,25.0,6.0,3.0,71.0,64.0,499.0,499.0,1.0,28.0,0.0,6.0,78.0,6.0,365.0,46.0,471.0,7.0,8.0,462.0,171.0,2.0,499.0,64.0,499.0,499.0,25.0,6.0,22.0,291.0,4.0,95.0,8.0,475.0,13.0,222.0,499.0,499.0,6.0,78.0,6.0,365.0,46.0,471.0,7.0,8.0,462.0,171.0,2.0,499.0,64.0,499.0,499.0,25.0,6.0,22.0,291.0,4.0,95.0,8.0,475.0,13.0,222.0,499.0,499.0,1.0,29.0,0.0,2.0,499.0,499.0,125.0,13.0,499.0,7.0,22.0,81.0,499.0,499.0,19.0,8.0,210.0,25.0,2.0,499.0,112.0,217.0,4.0,22.0,499.0,6.0,499.0,60.0,21.0,2.0,499.0,2.0,499.0,499.0,125.0,13.0,499.0,7.0,22.0,81.0,499.0,499.0,19.0,8.0,210.0,25.0,2.0,499.0,112.0,217.0,4.0,22.0,499.0,6.0,499.0,60.0,21.0,2.0,499.0,1.0,16.0,0.0,45.0,40.0,217.0,4.0,21.0,114.0,102.0,58.0,494.0,48.0,2.0,499.0,69.0,2.0,499.0,45.0,40.0,217.0,4.0,21.0,114.0,102.0,58.0,494.0,48.0,2.0,499.0,69.0,2.0,499.0,1.0,34.0,0.0,324.0,9.0,3.0,18.0,2.0,499.0,139.0,33.0,2.0,232.0,12.0,2.0,499.0,225.0,8.0,398.0,391.0,10.0,275.0,499.0,52.0,2.0,499.0,225.0,63.0,154.0,31.0,2.0,499.0,266.0,10.0,36.0,198.0,324.0,9.0,3.0,18.0,2.0,499.0,139.0,33.0,2.0,232.0,12.0,2.0,499.0,225.0,8.0,398.0,391.0,10.0,275.0,499.0,52.0,2.0,499.0,225.0,63.0,154.0,31.0,2.0,499.0,266.0,10.0,36.0,198.0,1.0,10.0,0.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,34.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,11.0,404.0,3.0,17.0,122.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,11.0,404.0,3.0,17.0,122.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,129.0,129.0,1.0,12.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,1.0,65.0,0.0,207.0,499.0,32.0,90.0,495.0,499.0,420.0,499.0,499.0,172.0,106.0,102.0,499.0,212.0,499.0,16.0,9.0,31.0,499.0,105.0,102.0,499.0,33.0,499.0,6.0,3.0,120.0,81.0,499.0,4.0,499.0,499.0,135.0,137.0,105.0,132.0,499.0,23.0,499.0,207.0,499.0,499.0,499.0,499.0,73.0,86.0,90.0,499.0,212.0,106.0,499.0,499.0,499.0,263.0,90.0,495.0,32.0,26.0,9.0,499.0,9.0,19.0,106.0,200.0,207.0,499.0,32.0,90.0,495.0,499.0,420.0,499.0,499.0,172.0,106.0,102.0,499.0,212.0,499.0,16.0,9.0,31.0,499.0,105.0,102.0,499.0,33.0,499.0,6.0,3.0,120.0,81.0,499.0,4.0,499.0,499.0,135.0,137.0,105.0,132.0,499.0,23.0,499.0,207.0,499.0,499.0,499.0,499.0,73.0,86.0,90.0,499.0,212.0,106.0,499.0,499.0,499.0,263.0,90.0,495.0,32.0,26.0,9.0,499.0,9.0,19.0,106.0,200.0,1.0,10.0,0.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,15.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,1.0,7.0,0.0,499.0,499.0,499.0,5.0,5.0,6.0,499.0,499.0,499.0,5.0,5.0,6.0,1.0,2.0,0.0,499.0,499.0,1.0,4.0,0.0,35.0,5.0,499.0,35.0,5.0,499.0,1.0,18.0,0.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,129.0,129.0,1.0,12.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,1.0,13.0,0.0,55.0,499.0,2.0,499.0,383.0,29.0,206.0,383.0,52.0,499.0,499.0,171.0,55.0,499.0,2.0,499.0,383.0,29.0,206.0,383.0,52.0,499.0,499.0,171.0,1.0,16.0,0.0,85.0,49.0,499.0,67.0,68.0,6.0,150.0,6.0,34.0,235.0,371.0,52.0,49.0,142.0,499.0,85.0,49.0,499.0,67.0,68.0,6.0,150.0,6.0,34.0,235.0,371.0,52.0,49.0,142.0,499.0,1.0,11.0,0.0,85.0,49.0,206.0,67.0,499.0,383.0,153.0,67.0,77.0,499.0,85.0,49.0,206.0,67.0,499.0,383.0,153.0,67.0,77.0,499.0,1.0,7.0,0.0,38.0,3.0,17.0,122.0,73.0,499.0,38.0,3.0,17.0,122.0,73.0,499.0,1.0,31.0,0.0,499.0,499.0,16.0,63.0,499.0,115.0,499.0,10.0,499.0,499.0,499.0,499.0,32.0,97.0,32.0,2.0,499.0,499.0,152.0,26.0,11.0,156.0,499.0,11.0,104.0,4.0,499.0,2.0,499.0,499.0,499.0,499.0,16.0,63.0,499.0,115.0,499.0,10.0,499.0,499.0,499.0,499.0,32.0,97.0,32.0,2.0,499.0,499.0,152.0,26.0,11.0,156.0,499.0,11.0,104.0,4.0,499.0,2.0,499.0,499.0,1.0,20.0,0.0,195.0,115.0,16.0,2.0,499.0,201.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,2.0,499.0,499.0,195.0,115.0,16.0,2.0,499.0,201.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,2.0,499.0,499.0,1.0,26.0,0.0,26.0,11.0,50.0,45.0,105.0,363.0,2.0,499.0,62.0,21.0,499.0,25.0,9.0,3.0,18.0,376.0,208.0,62.0,21.0,15.0,45.0,4.0,221.0,11.0,15.0,26.0,11.0,50.0,45.0,105.0,363.0,2.0,499.0,62.0,21.0,499.0,25.0,9.0,3.0,18.0,376.0,208.0,62.0,21.0,15.0,45.0,4.0,221.0,11.0,15.0,1.0,8.0,0.0,499.0,499.0,60.0,21.0,101.0,69.0,326.0,499.0,499.0,60.0,21.0,101.0,69.0,326.0,1.0,25.0,0.0,428.0,6.0,3.0,71.0,499.0,10.0,226.0,74.0,2.0,233.0,7.0,278.0,499.0,31.0,6.0,3.0,71.0,499.0,112.0,15.0,2.0,499.0,153.0,499.0,428.0,6.0,3.0,71.0,499.0,10.0,226.0,74.0,2.0,233.0,7.0,278.0,499.0,31.0,6.0,3.0,71.0,499.0,112.0,15.0,2.0,499.0,153.0,499.0,1.0,81.0,0.0,6.0,499.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,16.0,247.0,499.0,23.0,8.0,499.0,12.0,26.0,9.0,131.0,193.0,499.0,15.0,499.0,9.0,3.0,110.0,21.0,499.0,97.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,7.0,499.0,166.0,499.0,171.0,4.0,272.0,19.0,499.0,394.0,20.0,2.0,499.0,10.0,499.0,265.0,73.0,23.0,7.0,499.0,10.0,499.0,499.0,6.0,3.0,71.0,499.0,499.0,138.0,3.0,17.0,499.0,183.0,171.0,4.0,8.0,499.0,10.0,499.0,6.0,499.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,16.0,247.0,499.0,23.0,8.0,499.0,12.0,26.0,9.0,131.0,193.0,499.0,15.0,499.0,9.0,3.0,110.0,21.0,499.0,97.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,7.0,499.0,166.0,499.0,171.0,4.0,272.0,19.0,499.0,394.0,20.0,2.0,499.0,10.0,499.0,265.0,73.0,23.0,7.0,499.0,10.0,499.0,499.0,6.0,3.0,71.0,499.0,499.0,138.0,3.0,17.0,499.0,183.0,171.0,4.0,8.0,499.0,10.0,499.0,1.0,55.0,0.0,499.0,381.0,30.0,217.0,4.0,21.0,2.0,499.0,115.0,41.0,31.0,2.0,499.0,10.0,11.0,100.0,37.0,499.0,47.0,28.0,197.0,19.0,59.0,270.0,23.0,134.0,499.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,7.0,205.0,201.0,499.0,499.0,205.0,499.0,7.0,499.0,493.0,8.0,499.0,23.0,146.0,12.0,241.0,22.0,81.0,479.0,93.0,499.0,381.0,30.0,217.0,4.0,21.0,2.0,499.0,115.0,41.0,31.0,2.0,499.0,10.0,11.0,100.0,37.0,499.0,47.0,28.0,197.0,19.0,59.0,270.0,23.0,134.0,499.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,7.0,205.0,201.0,499.0,499.0,205.0,499.0,7.0,499.0,493.0,8.0,499.0,23.0,146.0,12.0,241.0,22.0,81.0,479.0,93.0,1.0,12.0,0.0,47.0,499.0,44.0,270.0,499.0,499.0,23.0,79.0,4.0,499.0,499.0,47.0,499.0,44.0,270.0,499.0,499.0,23.0,79.0,4.0,499.0,499.0,1.0,6.0,0.0,100.0,16.0,134.0,499.0,80.0,100.0,16.0,134.0,499.0,80.0,1.0,2.0,0.0,450.0,450.0,1.0,32.0,0.0,35.0,5.0,336.0,5.0,499.0,416.0,4.0,499.0,59.0,270.0,9.0,3.0,18.0,102.0,499.0,26.0,203.0,499.0,193.0,4.0,499.0,270.0,47.0,60.0,21.0,58.0,69.0,499.0,4.0,51.0,41.0,35.0,5.0,336.0,5.0,499.0,416.0,4.0,499.0,59.0,270.0,9.0,3.0,18.0,102.0,499.0,26.0,203.0,499.0,193.0,4.0,499.0,270.0,47.0,60.0,21.0,58.0,69.0,499.0,4.0,51.0,41.0,1.0,28.0,0.0,499.0,6.0,38.0,3.0,17.0,499.0,23.0,499.0,2.0,499.0,4.0,50.0,98.0,212.0,68.0,12.0,60.0,234.0,10.0,499.0,2.0,337.0,124.0,10.0,278.0,98.0,212.0,499.0,6.0,38.0,3.0,17.0,499.0,23.0,499.0,2.0,499.0,4.0,50.0,98.0,212.0,68.0,12.0,60.0,234.0,10.0,499.0,2.0,337.0,124.0,10.0,278.0,98.0,212.0,1.0,23.0,0.0,75.0,77.0,26.0,6.0,499.0,59.0,275.0,12.0,186.0,3.0,17.0,21.0,192.0,19.0,2.0,499.0,10.0,2.0,499.0,499.0,2.0,83.0,75.0,77.0,26.0,6.0,499.0,59.0,275.0,12.0,186.0,3.0,17.0,21.0,192.0,19.0,2.0,499.0,10.0,2.0,499.0,499.0,2.0,83.0,1.0,6.0,0.0,499.0,19.0,2.0,499.0,152.0,499.0,19.0,2.0,499.0,152.0,1.0,28.0,0.0,11.0,316.0,499.0,48.0,79.0,96.0,307.0,499.0,402.0,361.0,52.0,11.0,34.0,22.0,172.0,499.0,10.0,43.0,23.0,2.0,499.0,37.0,499.0,20.0,55.0,499.0,499.0,11.0,316.0,499.0,48.0,79.0,96.0,307.0,499.0,402.0,361.0,52.0,11.0,34.0,22.0,172.0,499.0,10.0,43.0,23.0,2.0,499.0,37.0,499.0,20.0,55.0,499.0,499.0,1.0,19.0,0.0,39.0,72.0,416.0,19.0,499.0,16.0,12.0,2.0,499.0,499.0,38.0,3.0,17.0,499.0,8.0,499.0,499.0,499.0,39.0,72.0,416.0,19.0,499.0,16.0,12.0,2.0,499.0,499.0,38.0,3.0,17.0,499.0,8.0,499.0,499.0,499.0,1.0,16.0,0.0,6.0,3.0,110.0,102.0,427.0,22.0,132.0,219.0,499.0,499.0,69.0,499.0,255.0,499.0,212.0,6.0,3.0,110.0,102.0,427.0,22.0,132.0,219.0,499.0,499.0,69.0,499.0,255.0,499.0,212.0,1.0,22.0,0.0,499.0,8.0,177.0,10.0,499.0,499.0,15.0,499.0,499.0,2.0,144.0,421.0,100.0,3.0,18.0,2.0,499.0,499.0,5.0,5.0,499.0,499.0,8.0,177.0,10.0,499.0,499.0,15.0,499.0,499.0,2.0,144.0,421.0,100.0,3.0,18.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,4.0,0.0,499.0,13.0,499.0,499.0,13.0,499.0,1.0,14.0,0.0,37.0,5.0,499.0,13.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,37.0,5.0,499.0,13.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,22.0,0.0,499.0,116.0,2.0,63.0,197.0,103.0,31.0,8.0,499.0,499.0,499.0,20.0,8.0,499.0,10.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,116.0,2.0,63.0,197.0,103.0,31.0,8.0,499.0,499.0,499.0,20.0,8.0,499.0,10.0,499.0,499.0,2.0,499.0,10.0,499.0,1.0,19.0,0.0,97.0,26.0,53.0,11.0,123.0,16.0,374.0,85.0,9.0,499.0,499.0,13.0,499.0,77.0,58.0,10.0,8.0,499.0,97.0,26.0,53.0,11.0,123.0,16.0,374.0,85.0,9.0,499.0,499.0,13.0,499.0,77.0,58.0,10.0,8.0,499.0,1.0,37.0,0.0,6.0,3.0,71.0,27.0,293.0,4.0,499.0,20.0,11.0,25.0,40.0,64.0,39.0,499.0,10.0,208.0,66.0,499.0,13.0,499.0,210.0,499.0,23.0,222.0,499.0,499.0,20.0,499.0,113.0,499.0,49.0,150.0,228.0,13.0,125.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,499.0,20.0,11.0,25.0,40.0,64.0,39.0,499.0,10.0,208.0,66.0,499.0,13.0,499.0,210.0,499.0,23.0,222.0,499.0,499.0,20.0,499.0,113.0,499.0,49.0,150.0,228.0,13.0,125.0,499.0,1.0,19.0,0.0,6.0,3.0,71.0,182.0,11.0,34.0,194.0,499.0,20.0,499.0,33.0,255.0,499.0,499.0,499.0,23.0,499.0,499.0,6.0,3.0,71.0,182.0,11.0,34.0,194.0,499.0,20.0,499.0,33.0,255.0,499.0,499.0,499.0,23.0,499.0,499.0,1.0,46.0,0.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,44.0,0.0,6.0,22.0,8.0,499.0,25.0,55.0,499.0,499.0,27.0,182.0,26.0,114.0,56.0,274.0,27.0,277.0,2.0,499.0,499.0,133.0,25.0,2.0,499.0,217.0,4.0,181.0,218.0,133.0,6.0,127.0,173.0,4.0,499.0,7.0,118.0,3.0,499.0,3.0,4.0,499.0,5.0,407.0,281.0,6.0,22.0,8.0,499.0,25.0,55.0,499.0,499.0,27.0,182.0,26.0,114.0,56.0,274.0,27.0,277.0,2.0,499.0,499.0,133.0,25.0,2.0,499.0,217.0,4.0,181.0,218.0,133.0,6.0,127.0,173.0,4.0,499.0,7.0,118.0,3.0,499.0,3.0,4.0,499.0,5.0,407.0,281.0,1.0,62.0,0.0,2.0,499.0,499.0,4.0,21.0,499.0,27.0,499.0,499.0,64.0,2.0,499.0,41.0,6.0,34.0,3.0,17.0,499.0,499.0,263.0,466.0,499.0,33.0,264.0,146.0,499.0,6.0,127.0,173.0,4.0,499.0,2.0,499.0,7.0,32.0,7.0,499.0,6.0,127.0,173.0,4.0,466.0,5.0,499.0,3.0,499.0,3.0,15.0,2.0,169.0,499.0,30.0,385.0,499.0,67.0,6.0,127.0,75.0,277.0,8.0,94.0,2.0,499.0,499.0,4.0,21.0,499.0,27.0,499.0,499.0,64.0,2.0,499.0,41.0,6.0,34.0,3.0,17.0,499.0,499.0,263.0,466.0,499.0,33.0,264.0,146.0,499.0,6.0,127.0,173.0,4.0,499.0,2.0,499.0,7.0,32.0,7.0,499.0,6.0,127.0,173.0,4.0,466.0,5.0,499.0,3.0,499.0,3.0,15.0,2.0,169.0,499.0,30.0,385.0,499.0,67.0,6.0,127.0,75.0,277.0,8.0,94.0,1.0,23.0,0.0,37.0,6.0,3.0,109.0,174.0,8.0,499.0,13.0,499.0,499.0,7.0,95.0,26.0,12.0,329.0,70.0,101.0,5.0,216.0,5.0,5.0,80.0,37.0,6.0,3.0,109.0,174.0,8.0,499.0,13.0,499.0,499.0,7.0,95.0,26.0,12.0,329.0,70.0,101.0,5.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,5.0,0.0,8.0,87.0,499.0,209.0,8.0,87.0,499.0,209.0,1.0,4.0,0.0,499.0,16.0,222.0,499.0,16.0,222.0,1.0,8.0,0.0,47.0,3.0,120.0,44.0,81.0,45.0,499.0,47.0,3.0,120.0,44.0,81.0,45.0,499.0,1.0,9.0,0.0,499.0,58.0,42.0,69.0,11.0,65.0,499.0,499.0,499.0,58.0,42.0,69.0,11.0,65.0,499.0,499.0,1.0,12.0,0.0,478.0,87.0,499.0,11.0,202.0,3.0,17.0,162.0,191.0,20.0,9.0,478.0,87.0,499.0,11.0,202.0,3.0,17.0,162.0,191.0,20.0,9.0,1.0,14.0,0.0,499.0,499.0,7.0,499.0,23.0,499.0,227.0,7.0,36.0,198.0,19.0,2.0,101.0,499.0,499.0,7.0,499.0,23.0,499.0,227.0,7.0,36.0,198.0,19.0,2.0,101.0,1.0,8.0,0.0,51.0,2.0,281.0,12.0,122.0,11.0,499.0,51.0,2.0,281.0,12.0,122.0,11.0,499.0,1.0,3.0,0.0,249.0,227.0,249.0,227.0,1.0,7.0,0.0,499.0,10.0,11.0,499.0,11.0,28.0,499.0,10.0,11.0,499.0,11.0,28.0,1.0,6.0,0.0,12.0,499.0,39.0,370.0,369.0,12.0,499.0,39.0,370.0,369.0,1.0,44.0,0.0,345.0,11.0,41.0,26.0,478.0,499.0,64.0,499.0,4.0,123.0,499.0,7.0,2.0,499.0,72.0,56.0,119.0,499.0,12.0,499.0,45.0,28.0,72.0,119.0,499.0,119.0,499.0,13.0,63.0,15.0,499.0,499.0,7.0,63.0,15.0,499.0,2.0,499.0,499.0,361.0,31.0,230.0,499.0,345.0,11.0,41.0,26.0,478.0,499.0,64.0,499.0,4.0,123.0,499.0,7.0,2.0,499.0,72.0,56.0,119.0,499.0,12.0,499.0,45.0,28.0,72.0,119.0,499.0,119.0,499.0,13.0,63.0,15.0,499.0,499.0,7.0,63.0,15.0,499.0,2.0,499.0,499.0,361.0,31.0,230.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,4.0,0.0,35.0,125.0,499.0,35.0,125.0,499.0,1.0,4.0,0.0,499.0,119.0,499.0,499.0,119.0,499.0,1.0,6.0,0.0,499.0,309.0,499.0,13.0,499.0,499.0,309.0,499.0,13.0,499.0,1.0,2.0,0.0,35.0,35.0,1.0,24.0,0.0,89.0,141.0,22.0,499.0,499.0,21.0,499.0,499.0,85.0,196.0,49.0,295.0,142.0,2.0,300.0,452.0,19.0,132.0,325.0,83.0,498.0,15.0,499.0,89.0,141.0,22.0,499.0,499.0,21.0,499.0,499.0,85.0,196.0,49.0,295.0,142.0,2.0,300.0,452.0,19.0,132.0,325.0,83.0,498.0,15.0,499.0,1.0,21.0,0.0,6.0,186.0,3.0,17.0,21.0,499.0,26.0,2.0,499.0,29.0,173.0,4.0,499.0,195.0,297.0,499.0,499.0,4.0,325.0,275.0,6.0,186.0,3.0,17.0,21.0,499.0,26.0,2.0,499.0,29.0,173.0,4.0,499.0,195.0,297.0,499.0,499.0,4.0,325.0,275.0,1.0,32.0,0.0,7.0,4.0,21.0,499.0,26.0,24.0,499.0,2.0,374.0,499.0,499.0,9.0,366.0,40.0,499.0,59.0,42.0,7.0,477.0,43.0,4.0,499.0,193.0,499.0,10.0,499.0,499.0,499.0,15.0,499.0,499.0,7.0,4.0,21.0,499.0,26.0,24.0,499.0,2.0,374.0,499.0,499.0,9.0,366.0,40.0,499.0,59.0,42.0,7.0,477.0,43.0,4.0,499.0,193.0,499.0,10.0,499.0,499.0,499.0,15.0,499.0,499.0,1.0,49.0,0.0,19.0,330.0,26.0,24.0,499.0,12.0,2.0,499.0,499.0,29.0,2.0,499.0,477.0,10.0,2.0,499.0,10.0,73.0,4.0,14.0,14.0,14.0,230.0,499.0,14.0,14.0,14.0,499.0,2.0,499.0,10.0,499.0,131.0,499.0,24.0,60.0,21.0,222.0,178.0,4.0,499.0,2.0,499.0,10.0,499.0,7.0,499.0,499.0,19.0,330.0,26.0,24.0,499.0,12.0,2.0,499.0,499.0,29.0,2.0,499.0,477.0,10.0,2.0,499.0,10.0,73.0,4.0,14.0,14.0,14.0,230.0,499.0,14.0,14.0,14.0,499.0,2.0,499.0,10.0,499.0,131.0,499.0,24.0,60.0,21.0,222.0,178.0,4.0,499.0,2.0,499.0,10.0,499.0,7.0,499.0,499.0,1.0,24.0,0.0,7.0,12.0,426.0,499.0,44.0,10.0,2.0,499.0,499.0,4.0,499.0,7.0,253.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,10.0,57.0,499.0,7.0,12.0,426.0,499.0,44.0,10.0,2.0,499.0,499.0,4.0,499.0,7.0,253.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,10.0,57.0,499.0,1.0,26.0,0.0,6.0,88.0,442.0,499.0,10.0,9.0,20.0,499.0,499.0,29.0,499.0,263.0,499.0,499.0,20.0,8.0,499.0,12.0,29.0,443.0,255.0,340.0,19.0,499.0,499.0,6.0,88.0,442.0,499.0,10.0,9.0,20.0,499.0,499.0,29.0,499.0,263.0,499.0,499.0,20.0,8.0,499.0,12.0,29.0,443.0,255.0,340.0,19.0,499.0,499.0,1.0,16.0,0.0,499.0,496.0,37.0,499.0,113.0,119.0,6.0,29.0,8.0,499.0,499.0,74.0,85.0,9.0,499.0,499.0,496.0,37.0,499.0,113.0,119.0,6.0,29.0,8.0,499.0,499.0,74.0,85.0,9.0,499.0,1.0,17.0,0.0,65.0,363.0,55.0,499.0,53.0,499.0,23.0,499.0,8.0,117.0,4.0,469.0,363.0,499.0,2.0,499.0,65.0,363.0,55.0,499.0,53.0,499.0,23.0,499.0,8.0,117.0,4.0,469.0,363.0,499.0,2.0,499.0,1.0,38.0,0.0,6.0,3.0,71.0,15.0,499.0,73.0,196.0,20.0,426.0,119.0,55.0,499.0,499.0,68.0,9.0,499.0,72.0,499.0,67.0,25.0,499.0,7.0,499.0,28.0,499.0,6.0,3.0,71.0,99.0,499.0,69.0,39.0,266.0,499.0,499.0,336.0,499.0,6.0,3.0,71.0,15.0,499.0,73.0,196.0,20.0,426.0,119.0,55.0,499.0,499.0,68.0,9.0,499.0,72.0,499.0,67.0,25.0,499.0,7.0,499.0,28.0,499.0,6.0,3.0,71.0,99.0,499.0,69.0,39.0,266.0,499.0,499.0,336.0,499.0,1.0,11.0,0.0,6.0,78.0,6.0,3.0,71.0,15.0,19.0,2.0,248.0,499.0,6.0,78.0,6.0,3.0,71.0,15.0,19.0,2.0,248.0,499.0,1.0,4.0,0.0,499.0,15.0,45.0,499.0,15.0,45.0,1.0,13.0,0.0,6.0,22.0,499.0,12.0,6.0,156.0,4.0,143.0,195.0,214.0,37.0,9.0,6.0,22.0,499.0,12.0,6.0,156.0,4.0,143.0,195.0,214.0,37.0,9.0,1.0,18.0,0.0,41.0,132.0,42.0,249.0,9.0,12.0,6.0,499.0,19.0,8.0,248.0,121.0,6.0,29.0,323.0,499.0,499.0,41.0,132.0,42.0,249.0,9.0,12.0,6.0,499.0,19.0,8.0,248.0,121.0,6.0,29.0,323.0,499.0,499.0,1.0,17.0,0.0,9.0,16.0,63.0,10.0,2.0,72.0,499.0,12.0,6.0,22.0,499.0,499.0,68.0,6.0,29.0,499.0,9.0,16.0,63.0,10.0,2.0,72.0,499.0,12.0,6.0,22.0,499.0,499.0,68.0,6.0,29.0,499.0,1.0,28.0,0.0,6.0,328.0,9.0,29.0,37.0,2.0,128.0,180.0,24.0,131.0,499.0,64.0,2.0,499.0,7.0,6.0,40.0,421.0,499.0,499.0,50.0,23.0,20.0,499.0,7.0,499.0,499.0,6.0,328.0,9.0,29.0,37.0,2.0,128.0,180.0,24.0,131.0,499.0,64.0,2.0,499.0,7.0,6.0,40.0,421.0,499.0,499.0,50.0,23.0,20.0,499.0,7.0,499.0,499.0,1.0,13.0,0.0,12.0,29.0,132.0,237.0,499.0,324.0,6.0,60.0,499.0,9.0,58.0,133.0,12.0,29.0,132.0,237.0,499.0,324.0,6.0,60.0,499.0,9.0,58.0,133.0,1.0,14.0,0.0,9.0,3.0,18.0,499.0,68.0,6.0,499.0,260.0,143.0,12.0,499.0,20.0,146.0,9.0,3.0,18.0,499.0,68.0,6.0,499.0,260.0,143.0,12.0,499.0,20.0,146.0,1.0,19.0,0.0,63.0,121.0,67.0,7.0,39.0,408.0,131.0,499.0,134.0,499.0,499.0,4.0,307.0,76.0,499.0,153.0,134.0,420.0,63.0,121.0,67.0,7.0,39.0,408.0,131.0,499.0,134.0,499.0,499.0,4.0,307.0,76.0,499.0,153.0,134.0,420.0,1.0,18.0,0.0,6.0,88.0,2.0,126.0,458.0,19.0,67.0,4.0,499.0,499.0,90.0,499.0,210.0,49.0,499.0,499.0,499.0,6.0,88.0,2.0,126.0,458.0,19.0,67.0,4.0,499.0,499.0,90.0,499.0,210.0,49.0,499.0,499.0,499.0,1.0,10.0,0.0,47.0,499.0,499.0,7.0,45.0,29.0,499.0,10.0,499.0,47.0,499.0,499.0,7.0,45.0,29.0,499.0,10.0,499.0,1.0,30.0,0.0,499.0,29.0,499.0,499.0,499.0,6.0,421.0,2.0,320.0,499.0,29.0,499.0,5.0,499.0,6.0,65.0,6.0,3.0,71.0,499.0,4.0,50.0,499.0,293.0,4.0,328.0,66.0,381.0,29.0,499.0,29.0,499.0,499.0,499.0,6.0,421.0,2.0,320.0,499.0,29.0,499.0,5.0,499.0,6.0,65.0,6.0,3.0,71.0,499.0,4.0,50.0,499.0,293.0,4.0,328.0,66.0,381.0,29.0,1.0,21.0,0.0,6.0,78.0,11.0,3.0,54.0,107.0,48.0,63.0,139.0,30.0,499.0,499.0,499.0,56.0,160.0,81.0,499.0,23.0,499.0,93.0,6.0,78.0,11.0,3.0,54.0,107.0,48.0,63.0,139.0,30.0,499.0,499.0,499.0,56.0,160.0,81.0,499.0,23.0,499.0,93.0,1.0,9.0,0.0,112.0,34.0,24.0,499.0,8.0,430.0,31.0,499.0,112.0,34.0,24.0,499.0,8.0,430.0,31.0,499.0,1.0,37.0,0.0,89.0,7.0,19.0,12.0,499.0,108.0,34.0,3.0,17.0,6.0,499.0,499.0,15.0,2.0,300.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,185.0,4.0,499.0,46.0,499.0,11.0,3.0,54.0,40.0,299.0,227.0,214.0,2.0,499.0,89.0,7.0,19.0,12.0,499.0,108.0,34.0,3.0,17.0,6.0,499.0,499.0,15.0,2.0,300.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,185.0,4.0,499.0,46.0,499.0,11.0,3.0,54.0,40.0,299.0,227.0,214.0,2.0,499.0,1.0,13.0,0.0,11.0,34.0,3.0,17.0,499.0,499.0,499.0,68.0,12.0,16.0,27.0,499.0,11.0,34.0,3.0,17.0,499.0,499.0,499.0,68.0,12.0,16.0,27.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,5.0,0.0,499.0,8.0,499.0,16.0,499.0,8.0,499.0,16.0,1.0,3.0,0.0,499.0,183.0,499.0,183.0,1.0,14.0,0.0,2.0,499.0,64.0,2.0,499.0,28.0,499.0,20.0,90.0,499.0,7.0,499.0,499.0,2.0,499.0,64.0,2.0,499.0,28.0,499.0,20.0,90.0,499.0,7.0,499.0,499.0,1.0,42.0,0.0,499.0,9.0,499.0,86.0,2.0,499.0,499.0,10.0,499.0,499.0,499.0,12.0,499.0,499.0,49.0,16.0,499.0,25.0,26.0,11.0,38.0,3.0,17.0,65.0,9.0,16.0,4.0,21.0,499.0,32.0,128.0,10.0,57.0,499.0,13.0,499.0,499.0,15.0,499.0,55.0,499.0,499.0,9.0,499.0,86.0,2.0,499.0,499.0,10.0,499.0,499.0,499.0,12.0,499.0,499.0,49.0,16.0,499.0,25.0,26.0,11.0,38.0,3.0,17.0,65.0,9.0,16.0,4.0,21.0,499.0,32.0,128.0,10.0,57.0,499.0,13.0,499.0,499.0,15.0,499.0,55.0,499.0,1.0,84.0,0.0,42.0,50.0,499.0,24.0,499.0,499.0,15.0,57.0,485.0,44.0,2.0,121.0,12.0,40.0,217.0,4.0,21.0,46.0,499.0,499.0,19.0,90.0,499.0,26.0,12.0,131.0,2.0,276.0,499.0,45.0,29.0,75.0,499.0,23.0,2.0,470.0,74.0,2.0,499.0,52.0,49.0,29.0,499.0,5.0,137.0,499.0,20.0,2.0,499.0,499.0,210.0,106.0,499.0,29.0,499.0,4.0,2.0,499.0,40.0,128.0,10.0,2.0,499.0,33.0,226.0,15.0,90.0,499.0,68.0,49.0,499.0,9.0,499.0,461.0,90.0,499.0,10.0,499.0,499.0,499.0,384.0,4.0,499.0,42.0,50.0,499.0,24.0,499.0,499.0,15.0,57.0,485.0,44.0,2.0,121.0,12.0,40.0,217.0,4.0,21.0,46.0,499.0,499.0,19.0,90.0,499.0,26.0,12.0,131.0,2.0,276.0,499.0,45.0,29.0,75.0,499.0,23.0,2.0,470.0,74.0,2.0,499.0,52.0,49.0,29.0,499.0,5.0,137.0,499.0,20.0,2.0,499.0,499.0,210.0,106.0,499.0,29.0,499.0,4.0,2.0,499.0,40.0,128.0,10.0,2.0,499.0,33.0,226.0,15.0,90.0,499.0,68.0,49.0,499.0,9.0,499.0,461.0,90.0,499.0,10.0,499.0,499.0,499.0,384.0,4.0,499.0,1.0,38.0,0.0,467.0,32.0,6.0,220.0,30.0,6.0,271.0,149.0,31.0,6.0,271.0,31.0,8.0,499.0,25.0,499.0,97.0,12.0,3.0,18.0,40.0,79.0,9.0,44.0,496.0,61.0,12.0,3.0,18.0,356.0,6.0,34.0,65.0,10.0,37.0,2.0,499.0,467.0,32.0,6.0,220.0,30.0,6.0,271.0,149.0,31.0,6.0,271.0,31.0,8.0,499.0,25.0,499.0,97.0,12.0,3.0,18.0,40.0,79.0,9.0,44.0,496.0,61.0,12.0,3.0,18.0,356.0,6.0,34.0,65.0,10.0,37.0,2.0,499.0,1.0,12.0,0.0,6.0,3.0,120.0,142.0,8.0,499.0,499.0,119.0,126.0,244.0,499.0,6.0,3.0,120.0,142.0,8.0,499.0,499.0,119.0,126.0,244.0,499.0,1.0,60.0,0.0,8.0,177.0,58.0,252.0,69.0,8.0,499.0,25.0,499.0,219.0,499.0,27.0,12.0,6.0,3.0,120.0,88.0,70.0,499.0,20.0,499.0,41.0,437.0,499.0,499.0,457.0,57.0,337.0,499.0,15.0,499.0,7.0,178.0,2.0,103.0,499.0,44.0,13.0,499.0,499.0,15.0,2.0,499.0,119.0,482.0,101.0,499.0,499.0,69.0,2.0,499.0,33.0,499.0,7.0,56.0,58.0,304.0,32.0,97.0,8.0,177.0,58.0,252.0,69.0,8.0,499.0,25.0,499.0,219.0,499.0,27.0,12.0,6.0,3.0,120.0,88.0,70.0,499.0,20.0,499.0,41.0,437.0,499.0,499.0,457.0,57.0,337.0,499.0,15.0,499.0,7.0,178.0,2.0,103.0,499.0,44.0,13.0,499.0,499.0,15.0,2.0,499.0,119.0,482.0,101.0,499.0,499.0,69.0,2.0,499.0,33.0,499.0,7.0,56.0,58.0,304.0,32.0,97.0,1.0,18.0,0.0,20.0,12.0,150.0,499.0,366.0,21.0,8.0,244.0,499.0,170.0,499.0,28.0,499.0,499.0,74.0,499.0,499.0,20.0,12.0,150.0,499.0,366.0,21.0,8.0,244.0,499.0,170.0,499.0,28.0,499.0,499.0,74.0,499.0,499.0,1.0,5.0,0.0,499.0,285.0,9.0,499.0,499.0,285.0,9.0,499.0,1.0,22.0,0.0,89.0,23.0,30.0,464.0,70.0,499.0,10.0,382.0,482.0,451.0,499.0,86.0,499.0,12.0,3.0,18.0,499.0,7.0,11.0,78.0,9.0,89.0,23.0,30.0,464.0,70.0,499.0,10.0,382.0,482.0,451.0,499.0,86.0,499.0,12.0,3.0,18.0,499.0,7.0,11.0,78.0,9.0,1.0,22.0,0.0,26.0,11.0,3.0,54.0,499.0,499.0,20.0,12.0,499.0,7.0,2.0,499.0,499.0,282.0,85.0,24.0,3.0,109.0,499.0,50.0,499.0,26.0,11.0,3.0,54.0,499.0,499.0,20.0,12.0,499.0,7.0,2.0,499.0,499.0,282.0,85.0,24.0,3.0,109.0,499.0,50.0,499.0,1.0,12.0,0.0,499.0,499.0,499.0,8.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,8.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,28.0,0.0,499.0,257.0,499.0,67.0,49.0,499.0,499.0,499.0,499.0,315.0,321.0,49.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,315.0,159.0,499.0,321.0,499.0,499.0,499.0,499.0,257.0,499.0,67.0,49.0,499.0,499.0,499.0,499.0,315.0,321.0,49.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,315.0,159.0,499.0,321.0,499.0,499.0,499.0,1.0,8.0,0.0,499.0,55.0,321.0,499.0,55.0,499.0,499.0,499.0,55.0,321.0,499.0,55.0,499.0,499.0,1.0,11.0,0.0,56.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,321.0,499.0,8.0,499.0,315.0,55.0,499.0,315.0,55.0,499.0,321.0,499.0,8.0,499.0,315.0,55.0,499.0,315.0,55.0,499.0,1.0,20.0,0.0,499.0,55.0,499.0,159.0,499.0,499.0,257.0,499.0,67.0,499.0,499.0,499.0,55.0,499.0,499.0,499.0,499.0,315.0,499.0,499.0,55.0,499.0,159.0,499.0,499.0,257.0,499.0,67.0,499.0,499.0,499.0,55.0,499.0,499.0,499.0,499.0,315.0,499.0,1.0,18.0,0.0,499.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,315.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,315.0,67.0,499.0,499.0,499.0,499.0,499.0,1.0,16.0,0.0,499.0,257.0,499.0,321.0,499.0,499.0,499.0,499.0,499.0,257.0,499.0,315.0,321.0,49.0,499.0,499.0,257.0,499.0,321.0,499.0,499.0,499.0,499.0,499.0,257.0,499.0,315.0,321.0,49.0,499.0,1.0,31.0,0.0,6.0,38.0,3.0,17.0,22.0,8.0,177.0,10.0,499.0,15.0,2.0,499.0,3.0,18.0,499.0,26.0,6.0,104.0,4.0,444.0,96.0,499.0,3.0,18.0,499.0,6.0,34.0,214.0,251.0,180.0,6.0,38.0,3.0,17.0,22.0,8.0,177.0,10.0,499.0,15.0,2.0,499.0,3.0,18.0,499.0,26.0,6.0,104.0,4.0,444.0,96.0,499.0,3.0,18.0,499.0,6.0,34.0,214.0,251.0,180.0,1.0,16.0,0.0,6.0,249.0,52.0,42.0,50.0,499.0,48.0,2.0,499.0,136.0,499.0,367.0,50.0,172.0,9.0,6.0,249.0,52.0,42.0,50.0,499.0,48.0,2.0,499.0,136.0,499.0,367.0,50.0,172.0,9.0,1.0,30.0,0.0,75.0,6.0,249.0,79.0,42.0,104.0,4.0,499.0,265.0,48.0,499.0,7.0,122.0,499.0,499.0,48.0,42.0,24.0,51.0,38.0,3.0,17.0,78.0,7.0,499.0,43.0,2.0,499.0,212.0,75.0,6.0,249.0,79.0,42.0,104.0,4.0,499.0,265.0,48.0,499.0,7.0,122.0,499.0,499.0,48.0,42.0,24.0,51.0,38.0,3.0,17.0,78.0,7.0,499.0,43.0,2.0,499.0,212.0,1.0,19.0,0.0,6.0,62.0,143.0,2.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,6.0,62.0,143.0,2.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,1.0,20.0,0.0,75.0,6.0,34.0,160.0,50.0,499.0,37.0,360.0,68.0,26.0,9.0,16.0,247.0,73.0,6.0,62.0,444.0,114.0,251.0,75.0,6.0,34.0,160.0,50.0,499.0,37.0,360.0,68.0,26.0,9.0,16.0,247.0,73.0,6.0,62.0,444.0,114.0,251.0,1.0,37.0,0.0,360.0,16.0,27.0,2.0,267.0,44.0,21.0,44.0,25.0,30.0,115.0,182.0,499.0,31.0,9.0,16.0,103.0,10.0,2.0,499.0,28.0,44.0,360.0,499.0,41.0,6.0,493.0,2.0,499.0,10.0,2.0,499.0,23.0,499.0,360.0,499.0,360.0,16.0,27.0,2.0,267.0,44.0,21.0,44.0,25.0,30.0,115.0,182.0,499.0,31.0,9.0,16.0,103.0,10.0,2.0,499.0,28.0,44.0,360.0,499.0,41.0,6.0,493.0,2.0,499.0,10.0,2.0,499.0,23.0,499.0,360.0,499.0,1.0,36.0,0.0,55.0,11.0,3.0,54.0,218.0,13.0,6.0,78.0,9.0,3.0,18.0,234.0,10.0,499.0,499.0,25.0,268.0,3.0,17.0,182.0,26.0,30.0,29.0,499.0,4.0,499.0,499.0,499.0,8.0,499.0,4.0,5.0,94.0,5.0,129.0,55.0,11.0,3.0,54.0,218.0,13.0,6.0,78.0,9.0,3.0,18.0,234.0,10.0,499.0,499.0,25.0,268.0,3.0,17.0,182.0,26.0,30.0,29.0,499.0,4.0,499.0,499.0,499.0,8.0,499.0,4.0,5.0,94.0,5.0,129.0,1.0,20.0,0.0,35.0,27.0,499.0,15.0,100.0,93.0,25.0,6.0,111.0,335.0,45.0,29.0,451.0,55.0,499.0,4.0,2.0,347.0,426.0,35.0,27.0,499.0,15.0,100.0,93.0,25.0,6.0,111.0,335.0,45.0,29.0,451.0,55.0,499.0,4.0,2.0,347.0,426.0,1.0,102.0,0.0,89.0,15.0,499.0,499.0,499.0,4.0,499.0,61.0,154.0,499.0,499.0,12.0,62.0,388.0,42.0,20.0,8.0,499.0,499.0,4.0,396.0,499.0,331.0,499.0,499.0,499.0,21.0,173.0,4.0,499.0,86.0,499.0,13.0,499.0,162.0,499.0,162.0,23.0,2.0,499.0,210.0,499.0,15.0,499.0,7.0,396.0,8.0,499.0,289.0,107.0,45.0,23.0,36.0,499.0,150.0,499.0,499.0,11.0,50.0,4.0,2.0,499.0,11.0,40.0,499.0,43.0,2.0,499.0,41.0,213.0,30.0,130.0,11.0,51.0,27.0,22.0,4.0,499.0,19.0,499.0,93.0,11.0,499.0,36.0,499.0,499.0,6.0,423.0,23.0,499.0,11.0,156.0,4.0,499.0,19.0,499.0,26.0,6.0,127.0,27.0,499.0,89.0,15.0,499.0,499.0,499.0,4.0,499.0,61.0,154.0,499.0,499.0,12.0,62.0,388.0,42.0,20.0,8.0,499.0,499.0,4.0,396.0,499.0,331.0,499.0,499.0,499.0,21.0,173.0,4.0,499.0,86.0,499.0,13.0,499.0,162.0,499.0,162.0,23.0,2.0,499.0,210.0,499.0,15.0,499.0,7.0,396.0,8.0,499.0,289.0,107.0,45.0,23.0,36.0,499.0,150.0,499.0,499.0,11.0,50.0,4.0,2.0,499.0,11.0,40.0,499.0,43.0,2.0,499.0,41.0,213.0,30.0,130.0,11.0,51.0,27.0,22.0,4.0,499.0,19.0,499.0,93.0,11.0,499.0,36.0,499.0,499.0,6.0,423.0,23.0,499.0,11.0,156.0,4.0,499.0,19.0,499.0,26.0,6.0,127.0,27.0,499.0,1.0,16.0,0.0,12.0,3.0,18.0,8.0,87.0,97.0,499.0,166.0,100.0,11.0,22.0,39.0,499.0,499.0,499.0,12.0,3.0,18.0,8.0,87.0,97.0,499.0,166.0,100.0,11.0,22.0,39.0,499.0,499.0,499.0,1.0,52.0,0.0,40.0,4.0,499.0,59.0,281.0,73.0,6.0,499.0,4.0,499.0,15.0,2.0,499.0,12.0,6.0,38.0,3.0,17.0,130.0,176.0,447.0,63.0,10.0,193.0,499.0,176.0,447.0,499.0,499.0,15.0,232.0,6.0,150.0,15.0,2.0,155.0,499.0,12.0,6.0,313.0,43.0,7.0,10.0,499.0,45.0,28.0,281.0,12.0,111.0,21.0,101.0,40.0,4.0,499.0,59.0,281.0,73.0,6.0,499.0,4.0,499.0,15.0,2.0,499.0,12.0,6.0,38.0,3.0,17.0,130.0,176.0,447.0,63.0,10.0,193.0,499.0,176.0,447.0,499.0,499.0,15.0,232.0,6.0,150.0,15.0,2.0,155.0,499.0,12.0,6.0,313.0,43.0,7.0,10.0,499.0,45.0,28.0,281.0,12.0,111.0,21.0,101.0,1.0,44.0,0.0,39.0,499.0,499.0,72.0,499.0,67.0,4.0,440.0,499.0,73.0,4.0,8.0,319.0,124.0,25.0,2.0,347.0,124.0,16.0,47.0,28.0,499.0,32.0,8.0,337.0,37.0,312.0,77.0,152.0,45.0,28.0,499.0,499.0,7.0,281.0,12.0,111.0,7.0,91.0,21.0,499.0,5.0,274.0,39.0,499.0,499.0,72.0,499.0,67.0,4.0,440.0,499.0,73.0,4.0,8.0,319.0,124.0,25.0,2.0,347.0,124.0,16.0,47.0,28.0,499.0,32.0,8.0,337.0,37.0,312.0,77.0,152.0,45.0,28.0,499.0,499.0,7.0,281.0,12.0,111.0,7.0,91.0,21.0,499.0,5.0,274.0,1.0,30.0,0.0,7.0,77.0,152.0,59.0,499.0,131.0,206.0,499.0,58.0,499.0,33.0,58.0,121.0,499.0,6.0,65.0,12.0,347.0,24.0,28.0,499.0,193.0,102.0,58.0,69.0,24.0,499.0,64.0,193.0,7.0,77.0,152.0,59.0,499.0,131.0,206.0,499.0,58.0,499.0,33.0,58.0,121.0,499.0,6.0,65.0,12.0,347.0,24.0,28.0,499.0,193.0,102.0,58.0,69.0,24.0,499.0,64.0,193.0,1.0,18.0,0.0,47.0,142.0,499.0,10.0,499.0,4.0,499.0,7.0,47.0,349.0,47.0,34.0,3.0,17.0,50.0,43.0,44.0,47.0,142.0,499.0,10.0,499.0,4.0,499.0,7.0,47.0,349.0,47.0,34.0,3.0,17.0,50.0,43.0,44.0,1.0,13.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,28.0,105.0,121.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,28.0,105.0,121.0,499.0,1.0,13.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,47.0,34.0,50.0,43.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,47.0,34.0,50.0,43.0,499.0,1.0,15.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,163.0,3.0,17.0,21.0,45.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,163.0,3.0,17.0,21.0,45.0,499.0,1.0,8.0,0.0,6.0,65.0,11.0,34.0,95.0,2.0,499.0,6.0,65.0,11.0,34.0,95.0,2.0,499.0,1.0,75.0,0.0,75.0,499.0,47.0,34.0,3.0,17.0,316.0,499.0,47.0,22.0,2.0,107.0,4.0,22.0,9.0,44.0,33.0,225.0,9.0,44.0,6.0,186.0,3.0,17.0,469.0,2.0,83.0,4.0,388.0,67.0,4.0,21.0,499.0,15.0,499.0,20.0,8.0,259.0,10.0,309.0,14.0,74.0,72.0,499.0,67.0,20.0,287.0,31.0,499.0,2.0,144.0,117.0,42.0,38.0,3.0,17.0,469.0,4.0,499.0,15.0,296.0,198.0,72.0,20.0,144.0,13.0,499.0,42.0,306.0,10.0,2.0,337.0,499.0,6.0,75.0,499.0,47.0,34.0,3.0,17.0,316.0,499.0,47.0,22.0,2.0,107.0,4.0,22.0,9.0,44.0,33.0,225.0,9.0,44.0,6.0,186.0,3.0,17.0,469.0,2.0,83.0,4.0,388.0,67.0,4.0,21.0,499.0,15.0,499.0,20.0,8.0,259.0,10.0,309.0,14.0,74.0,72.0,499.0,67.0,20.0,287.0,31.0,499.0,2.0,144.0,117.0,42.0,38.0,3.0,17.0,469.0,4.0,499.0,15.0,296.0,198.0,72.0,20.0,144.0,13.0,499.0,42.0,306.0,10.0,2.0,337.0,499.0,6.0,1.0,65.0,0.0,499.0,499.0,15.0,8.0,175.0,499.0,20.0,8.0,344.0,499.0,499.0,26.0,11.0,38.0,3.0,17.0,22.0,175.0,499.0,11.0,38.0,3.0,17.0,162.0,4.0,175.0,499.0,6.0,65.0,9.0,3.0,18.0,499.0,6.0,3.0,71.0,182.0,2.0,499.0,111.0,21.0,499.0,25.0,37.0,59.0,124.0,11.0,91.0,21.0,499.0,20.0,287.0,101.0,69.0,499.0,15.0,499.0,4.0,465.0,8.0,499.0,37.0,36.0,499.0,499.0,499.0,15.0,8.0,175.0,499.0,20.0,8.0,344.0,499.0,499.0,26.0,11.0,38.0,3.0,17.0,22.0,175.0,499.0,11.0,38.0,3.0,17.0,162.0,4.0,175.0,499.0,6.0,65.0,9.0,3.0,18.0,499.0,6.0,3.0,71.0,182.0,2.0,499.0,111.0,21.0,499.0,25.0,37.0,59.0,124.0,11.0,91.0,21.0,499.0,20.0,287.0,101.0,69.0,499.0,15.0,499.0,4.0,465.0,8.0,499.0,37.0,36.0,499.0,1.0,31.0,0.0,499.0,20.0,499.0,499.0,6.0,3.0,71.0,15.0,2.0,175.0,499.0,19.0,2.0,499.0,264.0,4.0,2.0,267.0,41.0,9.0,3.0,18.0,27.0,12.0,121.0,499.0,6.0,3.0,110.0,123.0,499.0,20.0,499.0,499.0,6.0,3.0,71.0,15.0,2.0,175.0,499.0,19.0,2.0,499.0,264.0,4.0,2.0,267.0,41.0,9.0,3.0,18.0,27.0,12.0,121.0,499.0,6.0,3.0,110.0,123.0,1.0,41.0,0.0,7.0,85.0,196.0,9.0,3.0,18.0,27.0,31.0,11.0,3.0,109.0,499.0,8.0,297.0,499.0,9.0,3.0,18.0,58.0,31.0,499.0,345.0,11.0,19.0,36.0,499.0,499.0,6.0,65.0,12.0,47.0,34.0,499.0,307.0,76.0,15.0,2.0,439.0,135.0,44.0,7.0,85.0,196.0,9.0,3.0,18.0,27.0,31.0,11.0,3.0,109.0,499.0,8.0,297.0,499.0,9.0,3.0,18.0,58.0,31.0,499.0,345.0,11.0,19.0,36.0,499.0,499.0,6.0,65.0,12.0,47.0,34.0,499.0,307.0,76.0,15.0,2.0,439.0,135.0,44.0,1.0,19.0,0.0,148.0,8.0,258.0,58.0,93.0,201.0,8.0,414.0,492.0,11.0,3.0,54.0,201.0,8.0,499.0,5.0,499.0,414.0,148.0,8.0,258.0,58.0,93.0,201.0,8.0,414.0,492.0,11.0,3.0,54.0,201.0,8.0,499.0,5.0,499.0,414.0,1.0,60.0,0.0,492.0,11.0,3.0,54.0,2.0,231.0,499.0,10.0,2.0,499.0,499.0,430.0,260.0,135.0,226.0,19.0,8.0,499.0,11.0,22.0,451.0,55.0,499.0,108.0,319.0,331.0,91.0,21.0,15.0,53.0,499.0,53.0,2.0,499.0,7.0,499.0,499.0,331.0,28.0,53.0,499.0,499.0,52.0,9.0,3.0,18.0,499.0,4.0,148.0,114.0,52.0,4.0,419.0,499.0,4.0,499.0,4.0,8.0,499.0,492.0,11.0,3.0,54.0,2.0,231.0,499.0,10.0,2.0,499.0,499.0,430.0,260.0,135.0,226.0,19.0,8.0,499.0,11.0,22.0,451.0,55.0,499.0,108.0,319.0,331.0,91.0,21.0,15.0,53.0,499.0,53.0,2.0,499.0,7.0,499.0,499.0,331.0,28.0,53.0,499.0,499.0,52.0,9.0,3.0,18.0,499.0,4.0,148.0,114.0,52.0,4.0,419.0,499.0,4.0,499.0,4.0,8.0,499.0,1.0,54.0,0.0,45.0,3.0,18.0,41.0,102.0,4.0,9.0,12.0,11.0,3.0,54.0,397.0,499.0,86.0,2.0,499.0,267.0,68.0,136.0,2.0,402.0,66.0,161.0,499.0,2.0,414.0,92.0,499.0,7.0,499.0,12.0,3.0,18.0,8.0,499.0,499.0,40.0,499.0,79.0,4.0,499.0,9.0,3.0,18.0,499.0,4.0,313.0,79.0,2.0,499.0,169.0,329.0,499.0,45.0,3.0,18.0,41.0,102.0,4.0,9.0,12.0,11.0,3.0,54.0,397.0,499.0,86.0,2.0,499.0,267.0,68.0,136.0,2.0,402.0,66.0,161.0,499.0,2.0,414.0,92.0,499.0,7.0,499.0,12.0,3.0,18.0,8.0,499.0,499.0,40.0,499.0,79.0,4.0,499.0,9.0,3.0,18.0,499.0,4.0,313.0,79.0,2.0,499.0,169.0,329.0,499.0,1.0,11.0,0.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,499.0,499.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,499.0,499.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,14.0,0.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,29.0,0.0,35.0,5.0,499.0,254.0,499.0,250.0,5.0,250.0,13.0,499.0,499.0,8.0,499.0,499.0,289.0,4.0,36.0,495.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,35.0,5.0,499.0,254.0,499.0,250.0,5.0,250.0,13.0,499.0,499.0,8.0,499.0,499.0,289.0,4.0,36.0,495.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,429.0,499.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,429.0,499.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,14.0,0.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,23.0,0.0,35.0,5.0,499.0,250.0,499.0,13.0,499.0,8.0,289.0,7.0,333.0,165.0,499.0,4.0,154.0,499.0,499.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,250.0,499.0,13.0,499.0,8.0,289.0,7.0,333.0,165.0,499.0,4.0,154.0,499.0,499.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,17.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,13.0,215.0,322.0,67.0,20.0,73.0,4.0,298.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,13.0,215.0,322.0,67.0,20.0,73.0,4.0,298.0,499.0,1.0,63.0,0.0,6.0,199.0,4.0,65.0,14.0,499.0,499.0,14.0,29.0,48.0,499.0,105.0,25.0,499.0,6.0,499.0,12.0,9.0,3.0,18.0,161.0,8.0,499.0,48.0,79.0,499.0,62.0,122.0,42.0,499.0,48.0,2.0,499.0,499.0,7.0,133.0,12.0,6.0,65.0,48.0,9.0,12.0,3.0,18.0,369.0,53.0,499.0,15.0,2.0,499.0,42.0,499.0,4.0,50.0,499.0,10.0,499.0,15.0,499.0,10.0,499.0,499.0,6.0,199.0,4.0,65.0,14.0,499.0,499.0,14.0,29.0,48.0,499.0,105.0,25.0,499.0,6.0,499.0,12.0,9.0,3.0,18.0,161.0,8.0,499.0,48.0,79.0,499.0,62.0,122.0,42.0,499.0,48.0,2.0,499.0,499.0,7.0,133.0,12.0,6.0,65.0,48.0,9.0,12.0,3.0,18.0,369.0,53.0,499.0,15.0,2.0,499.0,42.0,499.0,4.0,50.0,499.0,10.0,499.0,15.0,499.0,10.0,499.0,499.0,1.0,7.0,0.0,6.0,78.0,369.0,79.0,11.0,149.0,6.0,78.0,369.0,79.0,11.0,149.0,1.0,18.0,0.0,6.0,104.0,4.0,21.0,173.0,4.0,21.0,407.0,48.0,9.0,41.0,189.0,25.0,6.0,365.0,15.0,499.0,6.0,104.0,4.0,21.0,173.0,4.0,21.0,407.0,48.0,9.0,41.0,189.0,25.0,6.0,365.0,15.0,499.0,1.0,48.0,0.0,84.0,16.0,239.0,102.0,63.0,10.0,2.0,415.0,499.0,4.0,21.0,407.0,48.0,9.0,351.0,47.0,38.0,3.0,17.0,77.0,22.0,398.0,499.0,499.0,499.0,72.0,7.0,19.0,87.0,242.0,499.0,26.0,6.0,29.0,15.0,8.0,499.0,31.0,499.0,6.0,3.0,110.0,22.0,55.0,499.0,20.0,9.0,84.0,16.0,239.0,102.0,63.0,10.0,2.0,415.0,499.0,4.0,21.0,407.0,48.0,9.0,351.0,47.0,38.0,3.0,17.0,77.0,22.0,398.0,499.0,499.0,499.0,72.0,7.0,19.0,87.0,242.0,499.0,26.0,6.0,29.0,15.0,8.0,499.0,31.0,499.0,6.0,3.0,110.0,22.0,55.0,499.0,20.0,9.0,1.0,20.0,0.0,2.0,232.0,12.0,11.0,3.0,54.0,499.0,19.0,8.0,115.0,12.0,499.0,499.0,499.0,92.0,499.0,281.0,6.0,149.0,2.0,232.0,12.0,11.0,3.0,54.0,499.0,19.0,8.0,115.0,12.0,499.0,499.0,499.0,92.0,499.0,281.0,6.0,149.0,1.0,36.0,0.0,9.0,3.0,18.0,499.0,7.0,107.0,12.0,11.0,3.0,110.0,149.0,30.0,117.0,25.0,9.0,3.0,18.0,116.0,19.0,2.0,190.0,12.0,11.0,240.0,9.0,23.0,2.0,171.0,344.0,19.0,2.0,499.0,483.0,37.0,236.0,9.0,3.0,18.0,499.0,7.0,107.0,12.0,11.0,3.0,110.0,149.0,30.0,117.0,25.0,9.0,3.0,18.0,116.0,19.0,2.0,190.0,12.0,11.0,240.0,9.0,23.0,2.0,171.0,344.0,19.0,2.0,499.0,483.0,37.0,236.0,1.0,17.0,0.0,188.0,499.0,499.0,28.0,72.0,499.0,15.0,276.0,10.0,8.0,455.0,499.0,84.0,16.0,87.0,429.0,188.0,499.0,499.0,28.0,72.0,499.0,15.0,276.0,10.0,8.0,455.0,499.0,84.0,16.0,87.0,429.0,1.0,14.0,0.0,15.0,44.0,76.0,499.0,499.0,16.0,32.0,499.0,32.0,9.0,29.0,23.0,499.0,15.0,44.0,76.0,499.0,499.0,16.0,32.0,499.0,32.0,9.0,29.0,23.0,499.0,1.0,54.0,0.0,41.0,9.0,3.0,18.0,8.0,225.0,13.0,225.0,100.0,26.0,2.0,455.0,16.0,73.0,356.0,499.0,499.0,26.0,2.0,455.0,16.0,171.0,11.0,34.0,112.0,50.0,36.0,499.0,499.0,499.0,499.0,75.0,9.0,16.0,58.0,31.0,254.0,499.0,10.0,499.0,13.0,499.0,27.0,499.0,11.0,78.0,348.0,113.0,336.0,7.0,348.0,113.0,342.0,41.0,9.0,3.0,18.0,8.0,225.0,13.0,225.0,100.0,26.0,2.0,455.0,16.0,73.0,356.0,499.0,499.0,26.0,2.0,455.0,16.0,171.0,11.0,34.0,112.0,50.0,36.0,499.0,499.0,499.0,499.0,75.0,9.0,16.0,58.0,31.0,254.0,499.0,10.0,499.0,13.0,499.0,27.0,499.0,11.0,78.0,348.0,113.0,336.0,7.0,348.0,113.0,342.0,1.0,13.0,0.0,12.0,139.0,47.0,44.0,499.0,79.0,4.0,51.0,15.0,2.0,499.0,499.0,12.0,139.0,47.0,44.0,499.0,79.0,4.0,51.0,15.0,2.0,499.0,499.0,1.0,43.0,0.0,26.0,8.0,499.0,16.0,105.0,499.0,4.0,448.0,79.0,4.0,348.0,113.0,336.0,348.0,113.0,342.0,499.0,4.0,499.0,7.0,60.0,427.0,22.0,90.0,499.0,286.0,2.0,412.0,10.0,2.0,455.0,66.0,34.0,499.0,37.0,70.0,121.0,85.0,12.0,16.0,90.0,499.0,26.0,8.0,499.0,16.0,105.0,499.0,4.0,448.0,79.0,4.0,348.0,113.0,336.0,348.0,113.0,342.0,499.0,4.0,499.0,7.0,60.0,427.0,22.0,90.0,499.0,286.0,2.0,412.0,10.0,2.0,455.0,66.0,34.0,499.0,37.0,70.0,121.0,85.0,12.0,16.0,90.0,499.0,1.0,41.0,0.0,499.0,9.0,3.0,18.0,499.0,4.0,499.0,350.0,36.0,499.0,15.0,30.0,499.0,32.0,2.0,499.0,62.0,280.0,11.0,8.0,499.0,244.0,499.0,499.0,15.0,499.0,26.0,11.0,499.0,73.0,348.0,113.0,336.0,5.0,348.0,113.0,342.0,3.0,499.0,114.0,499.0,9.0,3.0,18.0,499.0,4.0,499.0,350.0,36.0,499.0,15.0,30.0,499.0,32.0,2.0,499.0,62.0,280.0,11.0,8.0,499.0,244.0,499.0,499.0,15.0,499.0,26.0,11.0,499.0,73.0,348.0,113.0,336.0,5.0,348.0,113.0,342.0,3.0,499.0,114.0,1.0,12.0,0.0,9.0,3.0,18.0,27.0,31.0,36.0,499.0,62.0,162.0,86.0,499.0,9.0,3.0,18.0,27.0,31.0,36.0,499.0,62.0,162.0,86.0,499.0,1.0,33.0,0.0,499.0,499.0,8.0,125.0,13.0,10.0,13.0,499.0,499.0,34.0,499.0,499.0,20.0,499.0,11.0,271.0,31.0,8.0,499.0,492.0,11.0,3.0,54.0,499.0,84.0,499.0,12.0,16.0,59.0,87.0,96.0,499.0,499.0,499.0,8.0,125.0,13.0,10.0,13.0,499.0,499.0,34.0,499.0,499.0,20.0,499.0,11.0,271.0,31.0,8.0,499.0,492.0,11.0,3.0,54.0,499.0,84.0,499.0,12.0,16.0,59.0,87.0,96.0,499.0,1.0,9.0,0.0,499.0,16.0,8.0,398.0,499.0,499.0,2.0,499.0,499.0,16.0,8.0,398.0,499.0,499.0,2.0,499.0,1.0,7.0,0.0,499.0,29.0,499.0,77.0,20.0,499.0,499.0,29.0,499.0,77.0,20.0,499.0,1.0,7.0,0.0,499.0,499.0,213.0,27.0,499.0,499.0,499.0,499.0,213.0,27.0,499.0,499.0,1.0,12.0,0.0,499.0,56.0,81.0,499.0,351.0,53.0,49.0,3.0,18.0,81.0,499.0,499.0,56.0,81.0,499.0,351.0,53.0,49.0,3.0,18.0,81.0,499.0,1.0,22.0,0.0,49.0,3.0,18.0,112.0,8.0,499.0,312.0,499.0,7.0,49.0,19.0,182.0,499.0,73.0,2.0,499.0,15.0,98.0,499.0,194.0,499.0,49.0,3.0,18.0,112.0,8.0,499.0,312.0,499.0,7.0,49.0,19.0,182.0,499.0,73.0,2.0,499.0,15.0,98.0,499.0,194.0,499.0,1.0,22.0,0.0,6.0,3.0,71.0,311.0,351.0,12.0,499.0,7.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,39.0,499.0,400.0,4.0,499.0,499.0,6.0,3.0,71.0,311.0,351.0,12.0,499.0,7.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,39.0,499.0,400.0,4.0,499.0,499.0,1.0,8.0,0.0,75.0,499.0,12.0,499.0,7.0,327.0,499.0,75.0,499.0,12.0,499.0,7.0,327.0,499.0,1.0,14.0,0.0,6.0,60.0,149.0,499.0,323.0,499.0,198.0,5.0,499.0,499.0,52.0,277.0,499.0,6.0,60.0,149.0,499.0,323.0,499.0,198.0,5.0,499.0,499.0,52.0,277.0,499.0,1.0,10.0,0.0,25.0,6.0,499.0,9.0,34.0,3.0,17.0,21.0,499.0,25.0,6.0,499.0,9.0,34.0,3.0,17.0,21.0,499.0,1.0,27.0,0.0,428.0,6.0,60.0,417.0,30.0,4.0,21.0,46.0,499.0,115.0,19.0,203.0,12.0,60.0,31.0,4.0,499.0,499.0,7.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,428.0,6.0,60.0,417.0,30.0,4.0,21.0,46.0,499.0,115.0,19.0,203.0,12.0,60.0,31.0,4.0,499.0,499.0,7.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,1.0,26.0,0.0,6.0,60.0,75.0,417.0,9.0,4.0,21.0,301.0,15.0,166.0,48.0,296.0,445.0,499.0,15.0,2.0,362.0,98.0,7.0,320.0,12.0,499.0,4.0,12.0,499.0,6.0,60.0,75.0,417.0,9.0,4.0,21.0,301.0,15.0,166.0,48.0,296.0,445.0,499.0,15.0,2.0,362.0,98.0,7.0,320.0,12.0,499.0,4.0,12.0,499.0,1.0,21.0,0.0,6.0,38.0,3.0,17.0,65.0,499.0,499.0,91.0,21.0,499.0,100.0,492.0,24.0,499.0,15.0,296.0,198.0,23.0,57.0,200.0,6.0,38.0,3.0,17.0,65.0,499.0,499.0,91.0,21.0,499.0,100.0,492.0,24.0,499.0,15.0,296.0,198.0,23.0,57.0,200.0,1.0,18.0,0.0,25.0,6.0,3.0,71.0,27.0,499.0,4.0,21.0,8.0,499.0,7.0,6.0,104.0,4.0,499.0,36.0,499.0,25.0,6.0,3.0,71.0,27.0,499.0,4.0,21.0,8.0,499.0,7.0,6.0,104.0,4.0,499.0,36.0,499.0,1.0,29.0,0.0,32.0,30.0,16.0,8.0,87.0,98.0,464.0,6.0,65.0,499.0,2.0,499.0,47.0,104.0,499.0,7.0,15.0,499.0,20.0,2.0,499.0,47.0,22.0,37.0,30.0,124.0,16.0,441.0,32.0,30.0,16.0,8.0,87.0,98.0,464.0,6.0,65.0,499.0,2.0,499.0,47.0,104.0,499.0,7.0,15.0,499.0,20.0,2.0,499.0,47.0,22.0,37.0,30.0,124.0,16.0,441.0,1.0,9.0,0.0,41.0,141.0,499.0,36.0,499.0,7.0,70.0,499.0,41.0,141.0,499.0,36.0,499.0,7.0,70.0,499.0,1.0,25.0,0.0,37.0,2.0,144.0,121.0,6.0,38.0,3.0,17.0,65.0,9.0,91.0,21.0,8.0,499.0,13.0,499.0,13.0,44.0,13.0,2.0,13.0,121.0,115.0,168.0,37.0,2.0,144.0,121.0,6.0,38.0,3.0,17.0,65.0,9.0,91.0,21.0,8.0,499.0,13.0,499.0,13.0,44.0,13.0,2.0,13.0,121.0,115.0,168.0,1.0,11.0,0.0,6.0,60.0,31.0,9.0,4.0,21.0,499.0,15.0,296.0,445.0,6.0,60.0,31.0,9.0,4.0,21.0,499.0,15.0,296.0,445.0,1.0,6.0,0.0,20.0,2.0,499.0,499.0,499.0,20.0,2.0,499.0,499.0,499.0,1.0,46.0,0.0,89.0,499.0,470.0,499.0,125.0,125.0,5.0,499.0,288.0,499.0,113.0,125.0,499.0,41.0,499.0,19.0,499.0,470.0,4.0,472.0,125.0,486.0,5.0,230.0,3.0,18.0,9.0,72.0,488.0,4.0,21.0,499.0,499.0,19.0,499.0,11.0,50.0,63.0,499.0,40.0,19.0,499.0,2.0,499.0,499.0,89.0,499.0,470.0,499.0,125.0,125.0,5.0,499.0,288.0,499.0,113.0,125.0,499.0,41.0,499.0,19.0,499.0,470.0,4.0,472.0,125.0,486.0,5.0,230.0,3.0,18.0,9.0,72.0,488.0,4.0,21.0,499.0,499.0,19.0,499.0,11.0,50.0,63.0,499.0,40.0,19.0,499.0,2.0,499.0,499.0,1.0,22.0,0.0,15.0,232.0,19.0,499.0,70.0,426.0,10.0,486.0,5.0,230.0,3.0,18.0,499.0,470.0,62.0,499.0,2.0,144.0,32.0,499.0,499.0,15.0,232.0,19.0,499.0,70.0,426.0,10.0,486.0,5.0,230.0,3.0,18.0,499.0,470.0,62.0,499.0,2.0,144.0,32.0,499.0,499.0,1.0,18.0,0.0,499.0,470.0,403.0,61.0,499.0,52.0,11.0,104.0,4.0,333.0,58.0,69.0,63.0,165.0,4.0,499.0,499.0,499.0,470.0,403.0,61.0,499.0,52.0,11.0,104.0,4.0,333.0,58.0,69.0,63.0,165.0,4.0,499.0,499.0,1.0,19.0,0.0,20.0,499.0,6.0,65.0,11.0,3.0,54.0,493.0,117.0,105.0,102.0,499.0,15.0,2.0,282.0,64.0,2.0,209.0,20.0,499.0,6.0,65.0,11.0,3.0,54.0,493.0,117.0,105.0,102.0,499.0,15.0,2.0,282.0,64.0,2.0,209.0,1.0,30.0,0.0,6.0,130.0,47.0,38.0,3.0,17.0,156.0,499.0,499.0,19.0,499.0,13.0,26.0,11.0,3.0,54.0,499.0,61.0,10.0,499.0,499.0,4.0,280.0,354.0,11.0,34.0,3.0,17.0,354.0,6.0,130.0,47.0,38.0,3.0,17.0,156.0,499.0,499.0,19.0,499.0,13.0,26.0,11.0,3.0,54.0,499.0,61.0,10.0,499.0,499.0,4.0,280.0,354.0,11.0,34.0,3.0,17.0,354.0,1.0,31.0,0.0,367.0,47.0,3.0,54.0,136.0,499.0,15.0,30.0,15.0,2.0,183.0,499.0,33.0,499.0,88.0,63.0,499.0,303.0,499.0,25.0,499.0,16.0,2.0,499.0,10.0,354.0,19.0,499.0,7.0,499.0,367.0,47.0,3.0,54.0,136.0,499.0,15.0,30.0,15.0,2.0,183.0,499.0,33.0,499.0,88.0,63.0,499.0,303.0,499.0,25.0,499.0,16.0,2.0,499.0,10.0,354.0,19.0,499.0,7.0,499.0,1.0,48.0,0.0,2.0,499.0,3.0,18.0,385.0,138.0,3.0,17.0,499.0,10.0,499.0,63.0,3.0,18.0,229.0,135.0,2.0,232.0,13.0,57.0,499.0,499.0,23.0,499.0,33.0,27.0,207.0,499.0,4.0,2.0,422.0,4.0,22.0,499.0,207.0,111.0,112.0,499.0,4.0,27.0,354.0,52.0,2.0,499.0,161.0,499.0,499.0,2.0,499.0,3.0,18.0,385.0,138.0,3.0,17.0,499.0,10.0,499.0,63.0,3.0,18.0,229.0,135.0,2.0,232.0,13.0,57.0,499.0,499.0,23.0,499.0,33.0,27.0,207.0,499.0,4.0,2.0,422.0,4.0,22.0,499.0,207.0,111.0,112.0,499.0,4.0,27.0,354.0,52.0,2.0,499.0,161.0,499.0,499.0,1.0,17.0,0.0,6.0,95.0,55.0,499.0,12.0,207.0,91.0,21.0,173.0,4.0,499.0,106.0,229.0,135.0,2.0,232.0,6.0,95.0,55.0,499.0,12.0,207.0,91.0,21.0,173.0,4.0,499.0,106.0,229.0,135.0,2.0,232.0,1.0,19.0,0.0,7.0,10.0,499.0,2.0,499.0,10.0,2.0,244.0,499.0,28.0,99.0,4.0,499.0,73.0,19.0,57.0,244.0,499.0,7.0,10.0,499.0,2.0,499.0,10.0,2.0,244.0,499.0,28.0,99.0,4.0,499.0,73.0,19.0,57.0,244.0,499.0,1.0,32.0,0.0,24.0,3.0,54.0,27.0,99.0,4.0,246.0,61.0,46.0,499.0,8.0,499.0,499.0,2.0,362.0,57.0,499.0,16.0,8.0,499.0,499.0,19.0,77.0,99.0,33.0,499.0,4.0,499.0,93.0,2.0,422.0,24.0,3.0,54.0,27.0,99.0,4.0,246.0,61.0,46.0,499.0,8.0,499.0,499.0,2.0,362.0,57.0,499.0,16.0,8.0,499.0,499.0,19.0,77.0,99.0,33.0,499.0,4.0,499.0,93.0,2.0,422.0,1.0,21.0,0.0,154.0,499.0,4.0,2.0,209.0,68.0,176.0,499.0,62.0,499.0,31.0,12.0,26.0,24.0,423.0,57.0,499.0,29.0,161.0,499.0,154.0,499.0,4.0,2.0,209.0,68.0,176.0,499.0,62.0,499.0,31.0,12.0,26.0,24.0,423.0,57.0,499.0,29.0,161.0,499.0,1.0,29.0,0.0,6.0,51.0,65.0,12.0,30.0,499.0,116.0,142.0,499.0,74.0,2.0,169.0,499.0,6.0,78.0,13.0,25.0,499.0,132.0,10.0,36.0,499.0,48.0,2.0,209.0,499.0,499.0,499.0,6.0,51.0,65.0,12.0,30.0,499.0,116.0,142.0,499.0,74.0,2.0,169.0,499.0,6.0,78.0,13.0,25.0,499.0,132.0,10.0,36.0,499.0,48.0,2.0,209.0,499.0,499.0,499.0,1.0,5.0,0.0,40.0,39.0,499.0,499.0,40.0,39.0,499.0,499.0,1.0,4.0,0.0,6.0,231.0,499.0,6.0,231.0,499.0,1.0,6.0,0.0,11.0,3.0,109.0,249.0,9.0,11.0,3.0,109.0,249.0,9.0,1.0,2.0,0.0,499.0,499.0,1.0,26.0,0.0,6.0,3.0,110.0,75.0,435.0,3.0,55.0,58.0,499.0,15.0,499.0,3.0,13.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,314.0,48.0,499.0,64.0,499.0,6.0,3.0,110.0,75.0,435.0,3.0,55.0,58.0,499.0,15.0,499.0,3.0,13.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,314.0,48.0,499.0,64.0,499.0,1.0,10.0,0.0,499.0,9.0,3.0,18.0,499.0,499.0,6.0,249.0,9.0,499.0,9.0,3.0,18.0,499.0,499.0,6.0,249.0,9.0,1.0,20.0,0.0,45.0,3.0,18.0,55.0,499.0,37.0,44.0,7.0,9.0,3.0,18.0,126.0,19.0,8.0,499.0,20.0,8.0,242.0,339.0,45.0,3.0,18.0,55.0,499.0,37.0,44.0,7.0,9.0,3.0,18.0,126.0,19.0,8.0,499.0,20.0,8.0,242.0,339.0,1.0,16.0,0.0,6.0,499.0,499.0,4.0,9.0,20.0,8.0,408.0,7.0,9.0,3.0,18.0,40.0,126.0,499.0,6.0,499.0,499.0,4.0,9.0,20.0,8.0,408.0,7.0,9.0,3.0,18.0,40.0,126.0,499.0,1.0,52.0,0.0,27.0,182.0,26.0,9.0,3.0,18.0,443.0,3.0,499.0,3.0,25.0,6.0,3.0,110.0,499.0,435.0,2.0,499.0,499.0,499.0,26.0,11.0,34.0,50.0,36.0,420.0,23.0,9.0,499.0,499.0,499.0,280.0,9.0,355.0,499.0,176.0,483.0,33.0,41.0,499.0,209.0,499.0,7.0,8.0,126.0,314.0,4.0,499.0,191.0,7.0,499.0,27.0,182.0,26.0,9.0,3.0,18.0,443.0,3.0,499.0,3.0,25.0,6.0,3.0,110.0,499.0,435.0,2.0,499.0,499.0,499.0,26.0,11.0,34.0,50.0,36.0,420.0,23.0,9.0,499.0,499.0,499.0,280.0,9.0,355.0,499.0,176.0,483.0,33.0,41.0,499.0,209.0,499.0,7.0,8.0,126.0,314.0,4.0,499.0,191.0,7.0,499.0,1.0,22.0,0.0,24.0,499.0,3.0,499.0,490.0,3.0,84.0,16.0,499.0,499.0,7.0,9.0,3.0,18.0,499.0,194.0,433.0,15.0,8.0,499.0,499.0,24.0,499.0,3.0,499.0,490.0,3.0,84.0,16.0,499.0,499.0,7.0,9.0,3.0,18.0,499.0,194.0,433.0,15.0,8.0,499.0,499.0,1.0,36.0,0.0,6.0,338.0,3.0,17.0,341.0,2.0,490.0,387.0,10.0,499.0,76.0,69.0,8.0,499.0,499.0,68.0,6.0,499.0,2.0,499.0,19.0,109.0,490.0,25.0,24.0,3.0,120.0,274.0,9.0,73.0,105.0,102.0,19.0,39.0,499.0,6.0,338.0,3.0,17.0,341.0,2.0,490.0,387.0,10.0,499.0,76.0,69.0,8.0,499.0,499.0,68.0,6.0,499.0,2.0,499.0,19.0,109.0,490.0,25.0,24.0,3.0,120.0,274.0,9.0,73.0,105.0,102.0,19.0,39.0,499.0,1.0,29.0,0.0,499.0,194.0,433.0,490.0,16.0,218.0,32.0,45.0,3.0,18.0,27.0,102.0,15.0,2.0,117.0,10.0,499.0,499.0,9.0,29.0,499.0,41.0,264.0,4.0,2.0,490.0,13.0,499.0,499.0,194.0,433.0,490.0,16.0,218.0,32.0,45.0,3.0,18.0,27.0,102.0,15.0,2.0,117.0,10.0,499.0,499.0,9.0,29.0,499.0,41.0,264.0,4.0,2.0,490.0,13.0,499.0,1.0,26.0,0.0,262.0,15.0,2.0,499.0,6.0,328.0,499.0,4.0,2.0,310.0,499.0,74.0,499.0,499.0,499.0,499.0,210.0,499.0,23.0,8.0,499.0,499.0,499.0,37.0,499.0,262.0,15.0,2.0,499.0,6.0,328.0,499.0,4.0,2.0,310.0,499.0,74.0,499.0,499.0,499.0,499.0,210.0,499.0,23.0,8.0,499.0,499.0,499.0,37.0,499.0,1.0,5.0,0.0,311.0,22.0,67.0,499.0,311.0,22.0,67.0,499.0,1.0,11.0,0.0,324.0,8.0,258.0,499.0,133.0,25.0,6.0,112.0,499.0,9.0,324.0,8.0,258.0,499.0,133.0,25.0,6.0,112.0,499.0,9.0,1.0,17.0,0.0,75.0,6.0,499.0,9.0,15.0,195.0,385.0,2.0,499.0,499.0,74.0,499.0,499.0,36.0,499.0,369.0,75.0,6.0,499.0,9.0,15.0,195.0,385.0,2.0,499.0,499.0,74.0,499.0,499.0,36.0,499.0,369.0,1.0,5.0,0.0,64.0,2.0,499.0,499.0,64.0,2.0,499.0,499.0,1.0,8.0,0.0,9.0,3.0,18.0,499.0,499.0,7.0,499.0,9.0,3.0,18.0,499.0,499.0,7.0,499.0,1.0,31.0,0.0,66.0,15.0,2.0,499.0,157.0,499.0,499.0,65.0,49.0,29.0,74.0,499.0,4.0,499.0,53.0,70.0,383.0,499.0,15.0,57.0,499.0,49.0,488.0,4.0,78.0,90.0,115.0,15.0,30.0,499.0,66.0,15.0,2.0,499.0,157.0,499.0,499.0,65.0,49.0,29.0,74.0,499.0,4.0,499.0,53.0,70.0,383.0,499.0,15.0,57.0,499.0,49.0,488.0,4.0,78.0,90.0,115.0,15.0,30.0,499.0,1.0,8.0,0.0,499.0,51.0,27.0,499.0,4.0,70.0,499.0,499.0,51.0,27.0,499.0,4.0,70.0,499.0,1.0,3.0,0.0,18.0,383.0,18.0,383.0,1.0,24.0,0.0,383.0,499.0,29.0,499.0,4.0,499.0,499.0,3.0,18.0,499.0,499.0,2.0,165.0,12.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,98.0,499.0,383.0,499.0,29.0,499.0,4.0,499.0,499.0,3.0,18.0,499.0,499.0,2.0,165.0,12.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,98.0,499.0,1.0,40.0,0.0,26.0,11.0,28.0,499.0,4.0,2.0,499.0,11.0,62.0,294.0,8.0,499.0,15.0,499.0,48.0,499.0,11.0,3.0,109.0,116.0,75.0,499.0,20.0,76.0,499.0,263.0,11.0,41.0,32.0,97.0,84.0,62.0,75.0,499.0,2.0,368.0,10.0,2.0,499.0,26.0,11.0,28.0,499.0,4.0,2.0,499.0,11.0,62.0,294.0,8.0,499.0,15.0,499.0,48.0,499.0,11.0,3.0,109.0,116.0,75.0,499.0,20.0,76.0,499.0,263.0,11.0,41.0,32.0,97.0,84.0,62.0,75.0,499.0,2.0,368.0,10.0,2.0,499.0,1.0,14.0,0.0,25.0,2.0,499.0,16.0,12.0,11.0,62.0,22.0,8.0,499.0,15.0,36.0,499.0,25.0,2.0,499.0,16.0,12.0,11.0,62.0,22.0,8.0,499.0,15.0,36.0,499.0,1.0,15.0,0.0,11.0,34.0,151.0,185.0,499.0,11.0,200.0,499.0,7.0,95.0,79.0,12.0,329.0,61.0,11.0,34.0,151.0,185.0,499.0,11.0,200.0,499.0,7.0,95.0,79.0,12.0,329.0,61.0,1.0,43.0,0.0,6.0,3.0,110.0,435.0,114.0,10.0,368.0,26.0,11.0,28.0,15.0,8.0,499.0,13.0,499.0,499.0,84.0,499.0,31.0,11.0,28.0,396.0,114.0,31.0,46.0,499.0,499.0,13.0,499.0,178.0,36.0,499.0,499.0,86.0,499.0,499.0,7.0,499.0,2.0,499.0,4.0,12.0,6.0,3.0,110.0,435.0,114.0,10.0,368.0,26.0,11.0,28.0,15.0,8.0,499.0,13.0,499.0,499.0,84.0,499.0,31.0,11.0,28.0,396.0,114.0,31.0,46.0,499.0,499.0,13.0,499.0,178.0,36.0,499.0,499.0,86.0,499.0,499.0,7.0,499.0,2.0,499.0,4.0,12.0,1.0,31.0,0.0,20.0,59.0,255.0,13.0,368.0,499.0,499.0,12.0,16.0,248.0,192.0,11.0,91.0,21.0,173.0,4.0,499.0,2.0,499.0,4.0,8.0,58.0,499.0,499.0,7.0,22.0,8.0,101.0,499.0,347.0,20.0,59.0,255.0,13.0,368.0,499.0,499.0,12.0,16.0,248.0,192.0,11.0,91.0,21.0,173.0,4.0,499.0,2.0,499.0,4.0,8.0,58.0,499.0,499.0,7.0,22.0,8.0,101.0,499.0,347.0,1.0,40.0,0.0,6.0,38.0,3.0,17.0,22.0,14.0,12.0,14.0,102.0,10.0,46.0,499.0,20.0,43.0,76.0,69.0,2.0,232.0,12.0,24.0,28.0,499.0,499.0,499.0,499.0,499.0,6.0,355.0,499.0,43.0,32.0,499.0,499.0,499.0,31.0,79.0,499.0,499.0,43.0,6.0,38.0,3.0,17.0,22.0,14.0,12.0,14.0,102.0,10.0,46.0,499.0,20.0,43.0,76.0,69.0,2.0,232.0,12.0,24.0,28.0,499.0,499.0,499.0,499.0,499.0,6.0,355.0,499.0,43.0,32.0,499.0,499.0,499.0,31.0,79.0,499.0,499.0,43.0,1.0,19.0,0.0,25.0,6.0,51.0,31.0,79.0,24.0,499.0,2.0,499.0,6.0,151.0,152.0,2.0,499.0,131.0,499.0,15.0,499.0,25.0,6.0,51.0,31.0,79.0,24.0,499.0,2.0,499.0,6.0,151.0,152.0,2.0,499.0,131.0,499.0,15.0,499.0,1.0,10.0,0.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,313.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,313.0,1.0,41.0,0.0,11.0,78.0,12.0,44.0,11.0,22.0,4.0,51.0,16.0,499.0,499.0,499.0,4.0,27.0,50.0,499.0,7.0,291.0,11.0,112.0,40.0,499.0,15.0,2.0,407.0,7.0,221.0,499.0,499.0,11.0,286.0,499.0,7.0,85.0,349.0,12.0,49.0,3.0,18.0,223.0,11.0,78.0,12.0,44.0,11.0,22.0,4.0,51.0,16.0,499.0,499.0,499.0,4.0,27.0,50.0,499.0,7.0,291.0,11.0,112.0,40.0,499.0,15.0,2.0,407.0,7.0,221.0,499.0,499.0,11.0,286.0,499.0,7.0,85.0,349.0,12.0,49.0,3.0,18.0,223.0,1.0,74.0,0.0,6.0,78.0,8.0,177.0,10.0,380.0,42.0,15.0,344.0,499.0,28.0,299.0,499.0,31.0,12.0,68.0,24.0,38.0,3.0,17.0,78.0,53.0,4.0,51.0,33.0,24.0,38.0,3.0,17.0,78.0,79.0,4.0,333.0,20.0,8.0,319.0,499.0,33.0,499.0,25.0,52.0,11.0,78.0,53.0,11.0,3.0,54.0,499.0,4.0,51.0,84.0,9.0,217.0,381.0,213.0,20.0,499.0,7.0,85.0,11.0,112.0,38.0,3.0,17.0,51.0,9.0,6.0,40.0,38.0,3.0,17.0,313.0,12.0,6.0,78.0,8.0,177.0,10.0,380.0,42.0,15.0,344.0,499.0,28.0,299.0,499.0,31.0,12.0,68.0,24.0,38.0,3.0,17.0,78.0,53.0,4.0,51.0,33.0,24.0,38.0,3.0,17.0,78.0,79.0,4.0,333.0,20.0,8.0,319.0,499.0,33.0,499.0,25.0,52.0,11.0,78.0,53.0,11.0,3.0,54.0,499.0,4.0,51.0,84.0,9.0,217.0,381.0,213.0,20.0,499.0,7.0,85.0,11.0,112.0,38.0,3.0,17.0,51.0,9.0,6.0,40.0,38.0,3.0,17.0,313.0,12.0,1.0,29.0,0.0,499.0,499.0,16.0,499.0,52.0,11.0,148.0,9.0,3.0,3.0,41.0,499.0,499.0,475.0,499.0,3.0,3.0,6.0,118.0,499.0,273.0,382.0,7.0,499.0,499.0,228.0,23.0,9.0,499.0,499.0,16.0,499.0,52.0,11.0,148.0,9.0,3.0,3.0,41.0,499.0,499.0,475.0,499.0,3.0,3.0,6.0,118.0,499.0,273.0,382.0,7.0,499.0,499.0,228.0,23.0,9.0,1.0,31.0,0.0,9.0,3.0,18.0,499.0,499.0,4.0,118.0,19.0,52.0,6.0,104.0,4.0,499.0,8.0,175.0,83.0,4.0,95.0,499.0,99.0,23.0,52.0,39.0,499.0,229.0,34.0,3.0,17.0,499.0,9.0,9.0,3.0,18.0,499.0,499.0,4.0,118.0,19.0,52.0,6.0,104.0,4.0,499.0,8.0,175.0,83.0,4.0,95.0,499.0,99.0,23.0,52.0,39.0,499.0,229.0,34.0,3.0,17.0,499.0,9.0,1.0,6.0,0.0,428.0,6.0,118.0,135.0,499.0,428.0,6.0,118.0,135.0,499.0,1.0,23.0,0.0,38.0,3.0,17.0,499.0,67.0,23.0,9.0,25.0,6.0,29.0,286.0,2.0,499.0,12.0,499.0,16.0,8.0,499.0,13.0,301.0,499.0,499.0,38.0,3.0,17.0,499.0,67.0,23.0,9.0,25.0,6.0,29.0,286.0,2.0,499.0,12.0,499.0,16.0,8.0,499.0,13.0,301.0,499.0,499.0,1.0,27.0,0.0,6.0,199.0,499.0,68.0,9.0,3.0,18.0,46.0,499.0,7.0,499.0,499.0,12.0,329.0,20.0,499.0,499.0,7.0,16.0,499.0,4.0,21.0,499.0,20.0,499.0,499.0,6.0,199.0,499.0,68.0,9.0,3.0,18.0,46.0,499.0,7.0,499.0,499.0,12.0,329.0,20.0,499.0,499.0,7.0,16.0,499.0,4.0,21.0,499.0,20.0,499.0,499.0,1.0,6.0,0.0,6.0,78.0,326.0,48.0,499.0,6.0,78.0,326.0,48.0,499.0,1.0,12.0,0.0,19.0,499.0,7.0,499.0,499.0,499.0,11.0,104.0,8.0,499.0,499.0,19.0,499.0,7.0,499.0,499.0,499.0,11.0,104.0,8.0,499.0,499.0,1.0,11.0,0.0,499.0,16.0,58.0,499.0,19.0,53.0,11.0,3.0,54.0,395.0,499.0,16.0,58.0,499.0,19.0,53.0,11.0,3.0,54.0,395.0,1.0,15.0,0.0,75.0,499.0,10.0,499.0,16.0,58.0,69.0,192.0,19.0,8.0,499.0,499.0,107.0,133.0,75.0,499.0,10.0,499.0,16.0,58.0,69.0,192.0,19.0,8.0,499.0,499.0,107.0,133.0,1.0,24.0,0.0,6.0,499.0,59.0,499.0,61.0,19.0,379.0,12.0,28.0,499.0,499.0,368.0,7.0,101.0,19.0,2.0,364.0,184.0,128.0,499.0,5.0,5.0,184.0,6.0,499.0,59.0,499.0,61.0,19.0,379.0,12.0,28.0,499.0,499.0,368.0,7.0,101.0,19.0,2.0,364.0,184.0,128.0,499.0,5.0,5.0,184.0,1.0,14.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,499.0,74.0,499.0,5.0,5.0,184.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,499.0,74.0,499.0,5.0,5.0,184.0,1.0,47.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,303.0,82.0,499.0,82.0,499.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,303.0,82.0,499.0,82.0,499.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,1.0,31.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,193.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,193.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,33.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,125.0,486.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,125.0,486.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,1.0,33.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,37.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,222.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,222.0,499.0,5.0,5.0,184.0,1.0,39.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,190.0,396.0,14.0,14.0,325.0,289.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,325.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,190.0,396.0,14.0,14.0,325.0,289.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,325.0,499.0,5.0,5.0,184.0,1.0,32.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,325.0,13.0,289.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,276.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,325.0,13.0,289.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,276.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,38.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,276.0,13.0,499.0,82.0,499.0,245.0,499.0,499.0,14.0,14.0,304.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,113.0,499.0,499.0,499.0,13.0,499.0,499.0,304.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,276.0,13.0,499.0,82.0,499.0,245.0,499.0,499.0,14.0,14.0,304.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,113.0,499.0,499.0,499.0,13.0,499.0,499.0,304.0,499.0,5.0,5.0,184.0,1.0,46.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,304.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,82.0,14.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,14.0,82.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,74.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,304.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,82.0,14.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,14.0,82.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,74.0,499.0,5.0,5.0,184.0,1.0,12.0,0.0,35.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,82.0,35.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,82.0,1.0,35.0,0.0,39.0,499.0,499.0,499.0,16.0,46.0,499.0,317.0,13.0,499.0,499.0,15.0,499.0,84.0,499.0,40.0,499.0,4.0,22.0,499.0,15.0,320.0,499.0,499.0,7.0,437.0,499.0,2.0,499.0,47.0,3.0,54.0,499.0,20.0,39.0,499.0,499.0,499.0,16.0,46.0,499.0,317.0,13.0,499.0,499.0,15.0,499.0,84.0,499.0,40.0,499.0,4.0,22.0,499.0,15.0,320.0,499.0,499.0,7.0,437.0,499.0,2.0,499.0,47.0,3.0,54.0,499.0,20.0,1.0,26.0,0.0,499.0,499.0,499.0,499.0,73.0,23.0,2.0,499.0,168.0,499.0,9.0,15.0,499.0,33.0,499.0,74.0,137.0,59.0,499.0,499.0,10.0,2.0,499.0,362.0,499.0,499.0,499.0,499.0,499.0,73.0,23.0,2.0,499.0,168.0,499.0,9.0,15.0,499.0,33.0,499.0,74.0,137.0,59.0,499.0,499.0,10.0,2.0,499.0,362.0,499.0,1.0,6.0,0.0,499.0,499.0,499.0,33.0,499.0,499.0,499.0,499.0,33.0,499.0,1.0,11.0,0.0,47.0,51.0,156.0,4.0,499.0,499.0,2.0,391.0,10.0,499.0,47.0,51.0,156.0,4.0,499.0,499.0,2.0,391.0,10.0,499.0,1.0,9.0,0.0,33.0,174.0,8.0,98.0,117.0,10.0,499.0,43.0,33.0,174.0,8.0,98.0,117.0,10.0,499.0,43.0,1.0,48.0,0.0,6.0,3.0,120.0,151.0,499.0,2.0,458.0,12.0,499.0,499.0,111.0,499.0,57.0,200.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,77.0,2.0,499.0,7.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,419.0,8.0,499.0,15.0,2.0,499.0,6.0,3.0,120.0,151.0,499.0,2.0,458.0,12.0,499.0,499.0,111.0,499.0,57.0,200.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,77.0,2.0,499.0,7.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,419.0,8.0,499.0,15.0,2.0,499.0,1.0,28.0,0.0,41.0,24.0,3.0,54.0,296.0,499.0,20.0,237.0,10.0,294.0,12.0,28.0,499.0,4.0,499.0,183.0,2.0,499.0,7.0,499.0,10.0,57.0,499.0,15.0,8.0,499.0,499.0,41.0,24.0,3.0,54.0,296.0,499.0,20.0,237.0,10.0,294.0,12.0,28.0,499.0,4.0,499.0,183.0,2.0,499.0,7.0,499.0,10.0,57.0,499.0,15.0,8.0,499.0,499.0,1.0,7.0,0.0,258.0,10.0,8.0,499.0,499.0,152.0,258.0,10.0,8.0,499.0,499.0,152.0,1.0,18.0,0.0,8.0,499.0,37.0,39.0,499.0,499.0,499.0,15.0,8.0,499.0,20.0,499.0,165.0,334.0,46.0,61.0,499.0,8.0,499.0,37.0,39.0,499.0,499.0,499.0,15.0,8.0,499.0,20.0,499.0,165.0,334.0,46.0,61.0,499.0,1.0,44.0,0.0,9.0,29.0,311.0,499.0,4.0,46.0,499.0,499.0,23.0,106.0,128.0,7.0,499.0,61.0,16.0,114.0,11.0,91.0,151.0,21.0,499.0,19.0,477.0,499.0,9.0,14.0,16.0,14.0,2.0,101.0,499.0,25.0,499.0,27.0,499.0,31.0,45.0,3.0,18.0,160.0,146.0,4.0,9.0,9.0,29.0,311.0,499.0,4.0,46.0,499.0,499.0,23.0,106.0,128.0,7.0,499.0,61.0,16.0,114.0,11.0,91.0,151.0,21.0,499.0,19.0,477.0,499.0,9.0,14.0,16.0,14.0,2.0,101.0,499.0,25.0,499.0,27.0,499.0,31.0,45.0,3.0,18.0,160.0,146.0,4.0,9.0,1.0,23.0,0.0,499.0,67.0,499.0,52.0,6.0,95.0,42.0,123.0,499.0,499.0,3.0,18.0,28.0,46.0,330.0,10.0,499.0,499.0,7.0,24.0,499.0,9.0,499.0,67.0,499.0,52.0,6.0,95.0,42.0,123.0,499.0,499.0,3.0,18.0,28.0,46.0,330.0,10.0,499.0,499.0,7.0,24.0,499.0,9.0,1.0,11.0,0.0,55.0,63.0,499.0,4.0,22.0,57.0,405.0,499.0,64.0,499.0,55.0,63.0,499.0,4.0,22.0,57.0,405.0,499.0,64.0,499.0,1.0,22.0,0.0,30.0,499.0,3.0,18.0,175.0,282.0,499.0,12.0,55.0,63.0,499.0,48.0,293.0,4.0,50.0,499.0,499.0,499.0,33.0,499.0,499.0,30.0,499.0,3.0,18.0,175.0,282.0,499.0,12.0,55.0,63.0,499.0,48.0,293.0,4.0,50.0,499.0,499.0,499.0,33.0,499.0,499.0,1.0,10.0,0.0,24.0,40.0,104.0,4.0,21.0,499.0,499.0,7.0,499.0,24.0,40.0,104.0,4.0,21.0,499.0,499.0,7.0,499.0,1.0,59.0,0.0,499.0,499.0,499.0,36.0,166.0,56.0,81.0,499.0,89.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,13.0,499.0,14.0,14.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,7.0,27.0,2.0,499.0,499.0,284.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,89.0,95.0,2.0,140.0,499.0,19.0,58.0,89.0,499.0,5.0,5.0,80.0,499.0,499.0,499.0,36.0,166.0,56.0,81.0,499.0,89.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,13.0,499.0,14.0,14.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,7.0,27.0,2.0,499.0,499.0,284.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,89.0,95.0,2.0,140.0,499.0,19.0,58.0,89.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,35.0,0.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,13.0,499.0,11.0,241.0,21.0,499.0,15.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,36.0,499.0,3.0,18.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,13.0,499.0,11.0,241.0,21.0,499.0,15.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,36.0,499.0,3.0,18.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,33.0,499.0,13.0,499.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,33.0,499.0,13.0,499.0,1.0,5.0,0.0,499.0,5.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,4.0,0.0,499.0,13.0,499.0,499.0,13.0,499.0,1.0,32.0,0.0,35.0,5.0,499.0,13.0,499.0,13.0,474.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,2.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,13.0,499.0,13.0,474.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,238.0,238.0,1.0,19.0,0.0,35.0,5.0,499.0,5.0,401.0,5.0,13.0,499.0,401.0,499.0,5.0,499.0,499.0,13.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,401.0,5.0,13.0,499.0,401.0,499.0,5.0,499.0,499.0,13.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,28.0,0.0,35.0,5.0,33.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,33.0,499.0,499.0,13.0,499.0,11.0,366.0,21.0,499.0,15.0,499.0,134.0,499.0,499.0,13.0,14.0,499.0,35.0,5.0,33.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,33.0,499.0,499.0,13.0,499.0,11.0,366.0,21.0,499.0,15.0,499.0,134.0,499.0,499.0,13.0,14.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,28.0,0.0,438.0,499.0,14.0,26.0,11.0,3.0,54.0,499.0,30.0,64.0,8.0,499.0,499.0,11.0,34.0,499.0,193.0,15.0,46.0,15.0,13.0,499.0,375.0,499.0,5.0,5.0,499.0,438.0,499.0,14.0,26.0,11.0,3.0,54.0,499.0,30.0,64.0,8.0,499.0,499.0,11.0,34.0,499.0,193.0,15.0,46.0,15.0,13.0,499.0,375.0,499.0,5.0,5.0,499.0,1.0,6.0,0.0,35.0,5.0,375.0,5.0,499.0,35.0,5.0,375.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,438.0,5.0,401.0,26.0,11.0,60.0,31.0,4.0,499.0,141.0,158.0,2.0,357.0,74.0,499.0,30.0,499.0,5.0,5.0,80.0,438.0,5.0,401.0,26.0,11.0,60.0,31.0,4.0,499.0,141.0,158.0,2.0,357.0,74.0,499.0,30.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,20.0,0.0,35.0,5.0,158.0,5.0,499.0,13.0,13.0,13.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,158.0,5.0,499.0,13.0,13.0,13.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,401.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,401.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,50.0,0.0,6.0,38.0,3.0,17.0,156.0,4.0,54.0,13.0,220.0,36.0,385.0,180.0,11.0,499.0,2.0,499.0,7.0,499.0,12.0,9.0,60.0,21.0,14.0,219.0,14.0,499.0,4.0,261.0,8.0,187.0,499.0,499.0,12.0,499.0,2.0,499.0,10.0,114.0,12.0,111.0,21.0,499.0,74.0,63.0,441.0,20.0,8.0,499.0,499.0,6.0,38.0,3.0,17.0,156.0,4.0,54.0,13.0,220.0,36.0,385.0,180.0,11.0,499.0,2.0,499.0,7.0,499.0,12.0,9.0,60.0,21.0,14.0,219.0,14.0,499.0,4.0,261.0,8.0,187.0,499.0,499.0,12.0,499.0,2.0,499.0,10.0,114.0,12.0,111.0,21.0,499.0,74.0,63.0,441.0,20.0,8.0,499.0,499.0,1.0,26.0,0.0,6.0,295.0,220.0,12.0,499.0,7.0,499.0,79.0,499.0,392.0,499.0,11.0,131.0,13.0,12.0,3.0,18.0,108.0,6.0,499.0,15.0,4.0,499.0,11.0,499.0,6.0,295.0,220.0,12.0,499.0,7.0,499.0,79.0,499.0,392.0,499.0,11.0,131.0,13.0,12.0,3.0,18.0,108.0,6.0,499.0,15.0,4.0,499.0,11.0,499.0,1.0,11.0,0.0,36.0,499.0,16.0,4.0,261.0,195.0,499.0,499.0,441.0,499.0,36.0,499.0,16.0,4.0,261.0,195.0,499.0,499.0,441.0,499.0,1.0,13.0,0.0,499.0,499.0,499.0,30.0,499.0,19.0,126.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,499.0,30.0,499.0,19.0,126.0,499.0,499.0,499.0,5.0,499.0,1.0,5.0,0.0,64.0,2.0,499.0,499.0,64.0,2.0,499.0,499.0,1.0,9.0,0.0,499.0,195.0,499.0,16.0,8.0,87.0,499.0,499.0,499.0,195.0,499.0,16.0,8.0,87.0,499.0,499.0,1.0,21.0,0.0,136.0,20.0,8.0,499.0,11.0,34.0,499.0,19.0,106.0,499.0,7.0,499.0,16.0,114.0,27.0,132.0,499.0,50.0,4.0,294.0,136.0,20.0,8.0,499.0,11.0,34.0,499.0,19.0,106.0,499.0,7.0,499.0,16.0,114.0,27.0,132.0,499.0,50.0,4.0,294.0,1.0,27.0,0.0,45.0,16.0,499.0,499.0,499.0,4.0,181.0,191.0,499.0,20.0,457.0,55.0,499.0,7.0,499.0,399.0,151.0,267.0,20.0,2.0,499.0,10.0,137.0,224.0,8.0,499.0,45.0,16.0,499.0,499.0,499.0,4.0,181.0,191.0,499.0,20.0,457.0,55.0,499.0,7.0,499.0,399.0,151.0,267.0,20.0,2.0,499.0,10.0,137.0,224.0,8.0,499.0,1.0,46.0,0.0,45.0,28.0,72.0,119.0,281.0,4.0,179.0,64.0,39.0,294.0,7.0,332.0,282.0,100.0,7.0,499.0,8.0,28.0,183.0,42.0,499.0,192.0,4.0,499.0,499.0,15.0,2.0,499.0,7.0,499.0,9.0,59.0,499.0,26.0,27.0,9.0,62.0,499.0,61.0,499.0,28.0,183.0,42.0,499.0,6.0,45.0,28.0,72.0,119.0,281.0,4.0,179.0,64.0,39.0,294.0,7.0,332.0,282.0,100.0,7.0,499.0,8.0,28.0,183.0,42.0,499.0,192.0,4.0,499.0,499.0,15.0,2.0,499.0,7.0,499.0,9.0,59.0,499.0,26.0,27.0,9.0,62.0,499.0,61.0,499.0,28.0,183.0,42.0,499.0,6.0,1.0,53.0,0.0,499.0,55.0,499.0,499.0,13.0,499.0,198.0,16.0,222.0,132.0,10.0,193.0,499.0,499.0,84.0,34.0,21.0,499.0,499.0,84.0,16.0,499.0,279.0,2.0,499.0,63.0,482.0,86.0,46.0,499.0,499.0,20.0,195.0,402.0,7.0,45.0,28.0,499.0,23.0,2.0,499.0,336.0,16.0,45.0,499.0,169.0,499.0,7.0,34.0,9.0,21.0,499.0,499.0,55.0,499.0,499.0,13.0,499.0,198.0,16.0,222.0,132.0,10.0,193.0,499.0,499.0,84.0,34.0,21.0,499.0,499.0,84.0,16.0,499.0,279.0,2.0,499.0,63.0,482.0,86.0,46.0,499.0,499.0,20.0,195.0,402.0,7.0,45.0,28.0,499.0,23.0,2.0,499.0,336.0,16.0,45.0,499.0,169.0,499.0,7.0,34.0,9.0,21.0,499.0,1.0,46.0,0.0,30.0,499.0,183.0,323.0,499.0,10.0,2.0,361.0,499.0,87.0,222.0,52.0,11.0,28.0,15.0,2.0,439.0,10.0,8.0,499.0,7.0,75.0,40.0,137.0,59.0,499.0,499.0,4.0,36.0,499.0,12.0,240.0,2.0,499.0,499.0,499.0,10.0,2.0,76.0,402.0,499.0,499.0,20.0,2.0,499.0,30.0,499.0,183.0,323.0,499.0,10.0,2.0,361.0,499.0,87.0,222.0,52.0,11.0,28.0,15.0,2.0,439.0,10.0,8.0,499.0,7.0,75.0,40.0,137.0,59.0,499.0,499.0,4.0,36.0,499.0,12.0,240.0,2.0,499.0,499.0,499.0,10.0,2.0,76.0,402.0,499.0,499.0,20.0,2.0,499.0,1.0,39.0,0.0,499.0,15.0,336.0,45.0,16.0,8.0,177.0,10.0,499.0,99.0,64.0,42.0,66.0,404.0,3.0,17.0,499.0,219.0,48.0,146.0,76.0,69.0,499.0,499.0,499.0,13.0,499.0,4.0,42.0,66.0,104.0,8.0,58.0,499.0,499.0,499.0,499.0,499.0,499.0,15.0,336.0,45.0,16.0,8.0,177.0,10.0,499.0,99.0,64.0,42.0,66.0,404.0,3.0,17.0,499.0,219.0,48.0,146.0,76.0,69.0,499.0,499.0,499.0,13.0,499.0,4.0,42.0,66.0,104.0,8.0,58.0,499.0,499.0,499.0,499.0,499.0,1.0,6.0,0.0,2.0,499.0,499.0,56.0,164.0,2.0,499.0,499.0,56.0,164.0,1.0,35.0,0.0,24.0,3.0,54.0,37.0,2.0,262.0,10.0,2.0,499.0,499.0,41.0,2.0,499.0,138.0,3.0,17.0,126.0,25.0,2.0,499.0,130.0,11.0,34.0,37.0,236.0,499.0,40.0,218.0,25.0,55.0,63.0,34.0,499.0,11.0,24.0,3.0,54.0,37.0,2.0,262.0,10.0,2.0,499.0,499.0,41.0,2.0,499.0,138.0,3.0,17.0,126.0,25.0,2.0,499.0,130.0,11.0,34.0,37.0,236.0,499.0,40.0,218.0,25.0,55.0,63.0,34.0,499.0,11.0,1.0,32.0,0.0,6.0,78.0,30.0,68.0,26.0,11.0,149.0,499.0,24.0,3.0,109.0,221.0,11.0,118.0,43.0,32.0,97.0,499.0,170.0,87.0,242.0,42.0,499.0,405.0,4.0,2.0,499.0,15.0,2.0,155.0,115.0,6.0,78.0,30.0,68.0,26.0,11.0,149.0,499.0,24.0,3.0,109.0,221.0,11.0,118.0,43.0,32.0,97.0,499.0,170.0,87.0,242.0,42.0,499.0,405.0,4.0,2.0,499.0,15.0,2.0,155.0,115.0,1.0,24.0,0.0,12.0,117.0,11.0,34.0,499.0,33.0,499.0,7.0,27.0,499.0,42.0,66.0,499.0,499.0,19.0,57.0,499.0,33.0,53.0,13.0,22.0,13.0,11.0,12.0,117.0,11.0,34.0,499.0,33.0,499.0,7.0,27.0,499.0,42.0,66.0,499.0,499.0,19.0,57.0,499.0,33.0,53.0,13.0,22.0,13.0,11.0,1.0,37.0,0.0,89.0,24.0,157.0,9.0,153.0,499.0,7.0,75.0,153.0,499.0,499.0,7.0,499.0,89.0,89.0,89.0,89.0,85.0,238.0,496.0,15.0,450.0,157.0,27.0,22.0,499.0,33.0,77.0,499.0,279.0,14.0,135.0,14.0,238.0,499.0,9.0,89.0,24.0,157.0,9.0,153.0,499.0,7.0,75.0,153.0,499.0,499.0,7.0,499.0,89.0,89.0,89.0,89.0,85.0,238.0,496.0,15.0,450.0,157.0,27.0,22.0,499.0,33.0,77.0,499.0,279.0,14.0,135.0,14.0,238.0,499.0,9.0,1.0,22.0,0.0,24.0,131.0,8.0,499.0,499.0,499.0,191.0,499.0,7.0,238.0,499.0,43.0,19.0,2.0,499.0,7.0,499.0,4.0,122.0,9.0,499.0,24.0,131.0,8.0,499.0,499.0,499.0,191.0,499.0,7.0,238.0,499.0,43.0,19.0,2.0,499.0,7.0,499.0,4.0,122.0,9.0,499.0,1.0,35.0,0.0,6.0,3.0,71.0,27.0,182.0,13.0,6.0,72.0,78.0,12.0,8.0,210.0,262.0,6.0,499.0,4.0,499.0,4.0,2.0,499.0,4.0,124.0,61.0,79.0,499.0,9.0,29.0,7.0,39.0,385.0,29.0,499.0,13.0,499.0,6.0,3.0,71.0,27.0,182.0,13.0,6.0,72.0,78.0,12.0,8.0,210.0,262.0,6.0,499.0,4.0,499.0,4.0,2.0,499.0,4.0,124.0,61.0,79.0,499.0,9.0,29.0,7.0,39.0,385.0,29.0,499.0,13.0,499.0,1.0,17.0,0.0,84.0,16.0,116.0,108.0,30.0,166.0,499.0,4.0,46.0,499.0,387.0,427.0,69.0,2.0,499.0,499.0,84.0,16.0,116.0,108.0,30.0,166.0,499.0,4.0,46.0,499.0,387.0,427.0,69.0,2.0,499.0,499.0,1.0,10.0,0.0,9.0,62.0,376.0,162.0,23.0,4.0,36.0,499.0,499.0,9.0,62.0,376.0,162.0,23.0,4.0,36.0,499.0,499.0,1.0,22.0,0.0,26.0,11.0,499.0,499.0,15.0,2.0,499.0,499.0,499.0,93.0,11.0,9.0,62.0,21.0,15.0,499.0,499.0,85.0,178.0,262.0,499.0,26.0,11.0,499.0,499.0,15.0,2.0,499.0,499.0,499.0,93.0,11.0,9.0,62.0,21.0,15.0,499.0,499.0,85.0,178.0,262.0,499.0,1.0,11.0,0.0,11.0,3.0,109.0,156.0,4.0,499.0,9.0,152.0,46.0,499.0,11.0,3.0,109.0,156.0,4.0,499.0,9.0,152.0,46.0,499.0,1.0,26.0,0.0,499.0,499.0,16.0,499.0,239.0,189.0,19.0,499.0,6.0,3.0,110.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,26.0,188.0,28.0,499.0,4.0,11.0,499.0,499.0,16.0,499.0,239.0,189.0,19.0,499.0,6.0,3.0,110.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,26.0,188.0,28.0,499.0,4.0,11.0,1.0,49.0,0.0,133.0,12.0,11.0,22.0,499.0,36.0,499.0,23.0,499.0,91.0,21.0,499.0,255.0,499.0,334.0,499.0,499.0,41.0,11.0,3.0,109.0,499.0,95.0,8.0,499.0,499.0,15.0,499.0,23.0,319.0,499.0,499.0,499.0,410.0,133.0,4.0,2.0,499.0,23.0,2.0,499.0,472.0,36.0,499.0,36.0,499.0,93.0,499.0,133.0,12.0,11.0,22.0,499.0,36.0,499.0,23.0,499.0,91.0,21.0,499.0,255.0,499.0,334.0,499.0,499.0,41.0,11.0,3.0,109.0,499.0,95.0,8.0,499.0,499.0,15.0,499.0,23.0,319.0,499.0,499.0,499.0,410.0,133.0,4.0,2.0,499.0,23.0,2.0,499.0,472.0,36.0,499.0,36.0,499.0,93.0,499.0,1.0,28.0,0.0,196.0,6.0,3.0,120.0,150.0,30.0,499.0,30.0,16.0,72.0,8.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,76.0,499.0,25.0,9.0,16.0,112.0,8.0,499.0,499.0,196.0,6.0,3.0,120.0,150.0,30.0,499.0,30.0,16.0,72.0,8.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,76.0,499.0,25.0,9.0,16.0,112.0,8.0,499.0,499.0,1.0,23.0,0.0,6.0,51.0,499.0,423.0,30.0,29.0,499.0,4.0,499.0,136.0,499.0,363.0,7.0,27.0,11.0,499.0,25.0,51.0,240.0,30.0,15.0,229.0,6.0,51.0,499.0,423.0,30.0,29.0,499.0,4.0,499.0,136.0,499.0,363.0,7.0,27.0,11.0,499.0,25.0,51.0,240.0,30.0,15.0,229.0,1.0,35.0,0.0,48.0,499.0,6.0,51.0,499.0,277.0,499.0,499.0,113.0,327.0,499.0,23.0,499.0,7.0,499.0,31.0,6.0,150.0,8.0,499.0,282.0,499.0,499.0,6.0,3.0,110.0,118.0,327.0,499.0,113.0,499.0,23.0,499.0,499.0,48.0,499.0,6.0,51.0,499.0,277.0,499.0,499.0,113.0,327.0,499.0,23.0,499.0,7.0,499.0,31.0,6.0,150.0,8.0,499.0,282.0,499.0,499.0,6.0,3.0,110.0,118.0,327.0,499.0,113.0,499.0,23.0,499.0,499.0,1.0,23.0,0.0,6.0,186.0,3.0,17.0,148.0,499.0,23.0,499.0,499.0,351.0,36.0,499.0,16.0,499.0,84.0,16.0,77.0,101.0,69.0,464.0,19.0,499.0,6.0,186.0,3.0,17.0,148.0,499.0,23.0,499.0,499.0,351.0,36.0,499.0,16.0,499.0,84.0,16.0,77.0,101.0,69.0,464.0,19.0,499.0,1.0,19.0,0.0,499.0,16.0,116.0,2.0,415.0,499.0,9.0,3.0,18.0,44.0,499.0,165.0,170.0,499.0,16.0,2.0,296.0,499.0,499.0,16.0,116.0,2.0,415.0,499.0,9.0,3.0,18.0,44.0,499.0,165.0,170.0,499.0,16.0,2.0,296.0,499.0,1.0,11.0,0.0,416.0,9.0,29.0,499.0,499.0,36.0,499.0,214.0,499.0,347.0,416.0,9.0,29.0,499.0,499.0,36.0,499.0,214.0,499.0,347.0,1.0,13.0,0.0,12.0,3.0,18.0,2.0,103.0,499.0,139.0,6.0,3.0,120.0,260.0,499.0,12.0,3.0,18.0,2.0,103.0,499.0,139.0,6.0,3.0,120.0,260.0,499.0,1.0,47.0,0.0,6.0,38.0,3.0,17.0,499.0,48.0,2.0,499.0,499.0,25.0,499.0,499.0,6.0,31.0,4.0,148.0,23.0,255.0,499.0,41.0,6.0,34.0,22.0,46.0,499.0,23.0,76.0,256.0,25.0,6.0,34.0,3.0,17.0,51.0,12.0,52.0,30.0,499.0,265.0,499.0,499.0,499.0,263.0,41.0,499.0,499.0,6.0,38.0,3.0,17.0,499.0,48.0,2.0,499.0,499.0,25.0,499.0,499.0,6.0,31.0,4.0,148.0,23.0,255.0,499.0,41.0,6.0,34.0,22.0,46.0,499.0,23.0,76.0,256.0,25.0,6.0,34.0,3.0,17.0,51.0,12.0,52.0,30.0,499.0,265.0,499.0,499.0,499.0,263.0,41.0,499.0,499.0,1.0,8.0,0.0,499.0,499.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,499.0,9.0,3.0,18.0,499.0,1.0,28.0,0.0,6.0,3.0,120.0,81.0,499.0,2.0,499.0,499.0,19.0,2.0,155.0,121.0,7.0,29.0,92.0,499.0,4.0,50.0,4.0,499.0,170.0,9.0,499.0,262.0,2.0,499.0,169.0,6.0,3.0,120.0,81.0,499.0,2.0,499.0,499.0,19.0,2.0,155.0,121.0,7.0,29.0,92.0,499.0,4.0,50.0,4.0,499.0,170.0,9.0,499.0,262.0,2.0,499.0,169.0,1.0,20.0,0.0,6.0,3.0,71.0,137.0,252.0,499.0,499.0,499.0,499.0,2.0,209.0,41.0,437.0,56.0,81.0,499.0,499.0,7.0,499.0,6.0,3.0,71.0,137.0,252.0,499.0,499.0,499.0,499.0,2.0,209.0,41.0,437.0,56.0,81.0,499.0,499.0,7.0,499.0,1.0,9.0,0.0,499.0,10.0,2.0,498.0,28.0,87.0,494.0,168.0,499.0,10.0,2.0,498.0,28.0,87.0,494.0,168.0,1.0,11.0,0.0,499.0,392.0,10.0,342.0,30.0,16.0,8.0,297.0,221.0,171.0,499.0,392.0,10.0,342.0,30.0,16.0,8.0,297.0,221.0,171.0,1.0,30.0,0.0,499.0,6.0,3.0,71.0,112.0,499.0,137.0,252.0,499.0,167.0,7.0,6.0,65.0,12.0,3.0,18.0,53.0,499.0,213.0,190.0,499.0,11.0,8.0,499.0,13.0,407.0,362.0,4.0,499.0,499.0,6.0,3.0,71.0,112.0,499.0,137.0,252.0,499.0,167.0,7.0,6.0,65.0,12.0,3.0,18.0,53.0,499.0,213.0,190.0,499.0,11.0,8.0,499.0,13.0,407.0,362.0,4.0,499.0,1.0,25.0,0.0,499.0,499.0,499.0,6.0,3.0,120.0,499.0,4.0,148.0,9.0,19.0,8.0,248.0,121.0,7.0,6.0,3.0,71.0,499.0,299.0,39.0,117.0,191.0,9.0,499.0,499.0,499.0,6.0,3.0,120.0,499.0,4.0,148.0,9.0,19.0,8.0,248.0,121.0,7.0,6.0,3.0,71.0,499.0,299.0,39.0,117.0,191.0,9.0,1.0,27.0,0.0,6.0,92.0,104.0,4.0,280.0,30.0,83.0,8.0,499.0,5.0,499.0,68.0,10.0,2.0,499.0,10.0,9.0,44.0,9.0,34.0,21.0,499.0,6.0,34.0,3.0,17.0,6.0,92.0,104.0,4.0,280.0,30.0,83.0,8.0,499.0,5.0,499.0,68.0,10.0,2.0,499.0,10.0,9.0,44.0,9.0,34.0,21.0,499.0,6.0,34.0,3.0,17.0,1.0};
-double validation_data[] = {100.0,19.0,0.0,2.0,209.0,16.0,8.0,258.0,499.0,107.0,133.0,152.0,6.0,3.0,71.0,499.0,9.0,3.0,109.0,50.0,101.0,2.0,209.0,16.0,8.0,258.0,499.0,107.0,133.0,152.0,6.0,3.0,71.0,499.0,9.0,3.0,109.0,50.0,101.0,1.0,6.0,0.0,2.0,498.0,499.0,239.0,499.0,2.0,498.0,499.0,239.0,499.0,1.0,15.0,0.0,25.0,2.0,499.0,499.0,31.0,45.0,3.0,18.0,117.0,105.0,132.0,499.0,99.0,23.0,25.0,2.0,499.0,499.0,31.0,45.0,3.0,18.0,117.0,105.0,132.0,499.0,99.0,23.0,1.0,84.0,0.0,499.0,20.0,499.0,499.0,499.0,20.0,422.0,499.0,400.0,499.0,422.0,499.0,499.0,499.0,499.0,499.0,487.0,499.0,44.0,172.0,2.0,499.0,19.0,499.0,53.0,499.0,278.0,499.0,499.0,20.0,499.0,205.0,499.0,7.0,59.0,136.0,499.0,33.0,499.0,13.0,499.0,499.0,499.0,169.0,2.0,337.0,499.0,499.0,499.0,19.0,8.0,499.0,499.0,499.0,12.0,499.0,15.0,499.0,9.0,499.0,31.0,9.0,3.0,18.0,105.0,102.0,291.0,499.0,10.0,9.0,499.0,499.0,172.0,39.0,485.0,41.0,6.0,3.0,71.0,112.0,499.0,9.0,44.0,499.0,20.0,499.0,499.0,499.0,20.0,422.0,499.0,400.0,499.0,422.0,499.0,499.0,499.0,499.0,499.0,487.0,499.0,44.0,172.0,2.0,499.0,19.0,499.0,53.0,499.0,278.0,499.0,499.0,20.0,499.0,205.0,499.0,7.0,59.0,136.0,499.0,33.0,499.0,13.0,499.0,499.0,499.0,169.0,2.0,337.0,499.0,499.0,499.0,19.0,8.0,499.0,499.0,499.0,12.0,499.0,15.0,499.0,9.0,499.0,31.0,9.0,3.0,18.0,105.0,102.0,291.0,499.0,10.0,9.0,499.0,499.0,172.0,39.0,485.0,41.0,6.0,3.0,71.0,112.0,499.0,9.0,44.0,1.0,14.0,0.0,75.0,499.0,499.0,499.0,16.0,116.0,2.0,190.0,325.0,83.0,497.0,260.0,206.0,75.0,499.0,499.0,499.0,16.0,116.0,2.0,190.0,325.0,83.0,497.0,260.0,206.0,1.0,11.0,0.0,168.0,117.0,45.0,3.0,18.0,499.0,499.0,499.0,499.0,499.0,168.0,117.0,45.0,3.0,18.0,499.0,499.0,499.0,499.0,499.0,1.0,54.0,0.0,499.0,23.0,2.0,232.0,499.0,149.0,2.0,156.0,4.0,21.0,58.0,499.0,170.0,24.0,499.0,5.0,62.0,21.0,499.0,32.0,219.0,69.0,24.0,28.0,77.0,499.0,7.0,499.0,66.0,149.0,9.0,3.0,18.0,27.0,499.0,12.0,9.0,3.0,18.0,499.0,41.0,499.0,10.0,43.0,4.0,14.0,22.0,14.0,499.0,7.0,499.0,499.0,499.0,499.0,23.0,2.0,232.0,499.0,149.0,2.0,156.0,4.0,21.0,58.0,499.0,170.0,24.0,499.0,5.0,62.0,21.0,499.0,32.0,219.0,69.0,24.0,28.0,77.0,499.0,7.0,499.0,66.0,149.0,9.0,3.0,18.0,27.0,499.0,12.0,9.0,3.0,18.0,499.0,41.0,499.0,10.0,43.0,4.0,14.0,22.0,14.0,499.0,7.0,499.0,499.0,499.0,1.0,14.0,0.0,6.0,112.0,34.0,3.0,17.0,148.0,8.0,447.0,83.0,153.0,2.0,83.0,499.0,6.0,112.0,34.0,3.0,17.0,148.0,8.0,447.0,83.0,153.0,2.0,83.0,499.0,1.0,105.0,0.0,6.0,34.0,3.0,17.0,77.0,499.0,13.0,499.0,135.0,12.0,7.0,22.0,4.0,168.0,499.0,2.0,382.0,33.0,118.0,225.0,113.0,94.0,4.0,118.0,499.0,187.0,499.0,68.0,6.0,40.0,95.0,8.0,499.0,499.0,75.0,2.0,499.0,499.0,16.0,499.0,7.0,499.0,39.0,499.0,28.0,151.0,499.0,52.0,6.0,393.0,2.0,83.0,52.0,9.0,499.0,113.0,52.0,6.0,264.0,9.0,499.0,41.0,6.0,75.0,22.0,4.0,453.0,356.0,4.0,499.0,2.0,499.0,499.0,499.0,6.0,22.0,55.0,458.0,79.0,2.0,499.0,7.0,382.0,499.0,28.0,41.0,499.0,135.0,2.0,92.0,96.0,499.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,225.0,499.0,499.0,6.0,34.0,3.0,17.0,77.0,499.0,13.0,499.0,135.0,12.0,7.0,22.0,4.0,168.0,499.0,2.0,382.0,33.0,118.0,225.0,113.0,94.0,4.0,118.0,499.0,187.0,499.0,68.0,6.0,40.0,95.0,8.0,499.0,499.0,75.0,2.0,499.0,499.0,16.0,499.0,7.0,499.0,39.0,499.0,28.0,151.0,499.0,52.0,6.0,393.0,2.0,83.0,52.0,9.0,499.0,113.0,52.0,6.0,264.0,9.0,499.0,41.0,6.0,75.0,22.0,4.0,453.0,356.0,4.0,499.0,2.0,499.0,499.0,499.0,6.0,22.0,55.0,458.0,79.0,2.0,499.0,7.0,382.0,499.0,28.0,41.0,499.0,135.0,2.0,92.0,96.0,499.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,225.0,499.0,499.0,1.0,18.0,0.0,32.0,208.0,66.0,499.0,9.0,4.0,39.0,499.0,6.0,3.0,110.0,435.0,323.0,9.0,37.0,106.0,499.0,32.0,208.0,66.0,499.0,9.0,4.0,39.0,499.0,6.0,3.0,110.0,435.0,323.0,9.0,37.0,106.0,499.0,1.0,13.0,0.0,499.0,34.0,21.0,499.0,68.0,45.0,3.0,18.0,41.0,102.0,4.0,448.0,499.0,34.0,21.0,499.0,68.0,45.0,3.0,18.0,41.0,102.0,4.0,448.0,1.0,25.0,0.0,221.0,106.0,51.0,2.0,499.0,444.0,2.0,499.0,40.0,450.0,9.0,45.0,3.0,18.0,59.0,126.0,212.0,444.0,2.0,499.0,20.0,106.0,20.0,499.0,221.0,106.0,51.0,2.0,499.0,444.0,2.0,499.0,40.0,450.0,9.0,45.0,3.0,18.0,59.0,126.0,212.0,444.0,2.0,499.0,20.0,106.0,20.0,499.0,1.0,10.0,0.0,24.0,3.0,54.0,126.0,4.0,440.0,499.0,7.0,440.0,24.0,3.0,54.0,126.0,4.0,440.0,499.0,7.0,440.0,1.0,2.0,0.0,499.0,499.0,1.0,17.0,0.0,77.0,499.0,4.0,143.0,499.0,499.0,499.0,2.0,117.0,499.0,73.0,8.0,499.0,20.0,8.0,408.0,77.0,499.0,4.0,143.0,499.0,499.0,499.0,2.0,117.0,499.0,73.0,8.0,499.0,20.0,8.0,408.0,1.0,13.0,0.0,6.0,3.0,110.0,21.0,499.0,32.0,499.0,395.0,9.0,19.0,12.0,248.0,6.0,3.0,110.0,21.0,499.0,32.0,499.0,395.0,9.0,19.0,12.0,248.0,1.0,12.0,0.0,37.0,39.0,499.0,499.0,6.0,499.0,37.0,119.0,459.0,46.0,471.0,37.0,39.0,499.0,499.0,6.0,499.0,37.0,119.0,459.0,46.0,471.0,1.0,11.0,0.0,499.0,171.0,499.0,12.0,6.0,40.0,34.0,3.0,17.0,499.0,499.0,171.0,499.0,12.0,6.0,40.0,34.0,3.0,17.0,499.0,1.0,33.0,0.0,97.0,351.0,12.0,77.0,8.0,499.0,34.0,21.0,499.0,20.0,8.0,485.0,13.0,23.0,499.0,20.0,8.0,499.0,2.0,499.0,376.0,404.0,3.0,17.0,499.0,499.0,3.0,18.0,499.0,485.0,13.0,23.0,97.0,351.0,12.0,77.0,8.0,499.0,34.0,21.0,499.0,20.0,8.0,485.0,13.0,23.0,499.0,20.0,8.0,499.0,2.0,499.0,376.0,404.0,3.0,17.0,499.0,499.0,3.0,18.0,499.0,485.0,13.0,23.0,1.0,16.0,0.0,26.0,2.0,499.0,88.0,499.0,33.0,499.0,33.0,114.0,10.0,12.0,499.0,499.0,36.0,499.0,26.0,2.0,499.0,88.0,499.0,33.0,499.0,33.0,114.0,10.0,12.0,499.0,499.0,36.0,499.0,1.0,25.0,0.0,89.0,499.0,9.0,73.0,40.0,403.0,392.0,32.0,8.0,499.0,473.0,499.0,68.0,37.0,30.0,124.0,30.0,16.0,2.0,72.0,139.0,360.0,499.0,48.0,89.0,499.0,9.0,73.0,40.0,403.0,392.0,32.0,8.0,499.0,473.0,499.0,68.0,37.0,30.0,124.0,30.0,16.0,2.0,72.0,139.0,360.0,499.0,48.0,1.0,16.0,0.0,24.0,3.0,120.0,151.0,81.0,499.0,52.0,9.0,403.0,4.0,189.0,499.0,20.0,499.0,499.0,24.0,3.0,120.0,151.0,81.0,499.0,52.0,9.0,403.0,4.0,189.0,499.0,20.0,499.0,499.0,1.0,21.0,0.0,24.0,60.0,160.0,499.0,499.0,7.0,118.0,106.0,121.0,20.0,2.0,499.0,7.0,106.0,499.0,20.0,499.0,23.0,8.0,499.0,24.0,60.0,160.0,499.0,499.0,7.0,118.0,106.0,121.0,20.0,2.0,499.0,7.0,106.0,499.0,20.0,499.0,23.0,8.0,499.0,1.0,5.0,0.0,290.0,5.0,5.0,499.0,290.0,5.0,5.0,499.0,1.0,4.0,0.0,35.0,5.0,499.0,35.0,5.0,499.0,1.0,18.0,0.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,21.0,499.0,33.0,146.0,25.0,499.0,30.0,60.0,21.0,499.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,21.0,499.0,33.0,146.0,25.0,499.0,30.0,60.0,21.0,499.0,1.0,51.0,0.0,39.0,499.0,28.0,499.0,265.0,449.0,25.0,398.0,20.0,46.0,499.0,13.0,499.0,499.0,499.0,499.0,7.0,442.0,499.0,10.0,499.0,3.0,17.0,499.0,499.0,499.0,499.0,19.0,2.0,499.0,499.0,7.0,499.0,382.0,25.0,499.0,499.0,19.0,2.0,499.0,5.0,499.0,4.0,499.0,499.0,26.0,6.0,38.0,3.0,17.0,39.0,499.0,28.0,499.0,265.0,449.0,25.0,398.0,20.0,46.0,499.0,13.0,499.0,499.0,499.0,499.0,7.0,442.0,499.0,10.0,499.0,3.0,17.0,499.0,499.0,499.0,499.0,19.0,2.0,499.0,499.0,7.0,499.0,382.0,25.0,499.0,499.0,19.0,2.0,499.0,5.0,499.0,4.0,499.0,499.0,26.0,6.0,38.0,3.0,17.0,1.0,6.0,0.0,499.0,16.0,8.0,499.0,499.0,499.0,16.0,8.0,499.0,499.0,1.0,21.0,0.0,499.0,42.0,116.0,149.0,31.0,24.0,22.0,8.0,107.0,4.0,2.0,499.0,10.0,39.0,499.0,499.0,7.0,499.0,499.0,105.0,499.0,42.0,116.0,149.0,31.0,24.0,22.0,8.0,107.0,4.0,2.0,499.0,10.0,39.0,499.0,499.0,7.0,499.0,499.0,105.0,1.0,19.0,0.0,135.0,44.0,9.0,3.0,18.0,247.0,499.0,12.0,6.0,3.0,71.0,40.0,499.0,12.0,364.0,499.0,45.0,499.0,135.0,44.0,9.0,3.0,18.0,247.0,499.0,12.0,6.0,3.0,71.0,40.0,499.0,12.0,364.0,499.0,45.0,499.0,1.0,12.0,0.0,6.0,38.0,3.0,17.0,229.0,499.0,191.0,46.0,37.0,13.0,499.0,6.0,38.0,3.0,17.0,229.0,499.0,191.0,46.0,37.0,13.0,499.0,1.0,30.0,0.0,499.0,499.0,213.0,9.0,23.0,367.0,499.0,25.0,499.0,176.0,76.0,499.0,64.0,499.0,3.0,18.0,499.0,499.0,20.0,14.0,6.0,14.0,47.0,78.0,11.0,131.0,8.0,499.0,499.0,499.0,499.0,213.0,9.0,23.0,367.0,499.0,25.0,499.0,176.0,76.0,499.0,64.0,499.0,3.0,18.0,499.0,499.0,20.0,14.0,6.0,14.0,47.0,78.0,11.0,131.0,8.0,499.0,499.0,1.0,21.0,0.0,49.0,34.0,499.0,499.0,499.0,499.0,7.0,2.0,31.0,153.0,499.0,499.0,193.0,12.0,49.0,199.0,4.0,148.0,2.0,83.0,49.0,34.0,499.0,499.0,499.0,499.0,7.0,2.0,31.0,153.0,499.0,499.0,193.0,12.0,49.0,199.0,4.0,148.0,2.0,83.0,1.0,15.0,0.0,9.0,3.0,18.0,48.0,2.0,499.0,23.0,2.0,499.0,27.0,15.0,2.0,499.0,499.0,9.0,3.0,18.0,48.0,2.0,499.0,23.0,2.0,499.0,27.0,15.0,2.0,499.0,499.0,1.0,16.0,0.0,36.0,499.0,56.0,81.0,318.0,499.0,68.0,36.0,499.0,16.0,219.0,69.0,272.0,499.0,320.0,36.0,499.0,56.0,81.0,318.0,499.0,68.0,36.0,499.0,16.0,219.0,69.0,272.0,499.0,320.0,1.0,13.0,0.0,141.0,220.0,2.0,233.0,4.0,448.0,58.0,245.0,290.0,5.0,5.0,80.0,141.0,220.0,2.0,233.0,4.0,448.0,58.0,245.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,21.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,233.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,233.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,49.0,0.0,89.0,499.0,6.0,3.0,71.0,499.0,499.0,7.0,499.0,41.0,6.0,3.0,120.0,499.0,73.0,20.0,46.0,391.0,10.0,499.0,499.0,32.0,11.0,3.0,110.0,469.0,25.0,6.0,499.0,9.0,58.0,7.0,58.0,2.0,499.0,250.0,13.0,254.0,237.0,69.0,260.0,93.0,68.0,154.0,499.0,499.0,86.0,499.0,89.0,499.0,6.0,3.0,71.0,499.0,499.0,7.0,499.0,41.0,6.0,3.0,120.0,499.0,73.0,20.0,46.0,391.0,10.0,499.0,499.0,32.0,11.0,3.0,110.0,469.0,25.0,6.0,499.0,9.0,58.0,7.0,58.0,2.0,499.0,250.0,13.0,254.0,237.0,69.0,260.0,93.0,68.0,154.0,499.0,499.0,86.0,499.0,1.0,19.0,0.0,9.0,217.0,47.0,22.0,499.0,499.0,64.0,12.0,499.0,499.0,65.0,47.0,465.0,8.0,96.0,439.0,499.0,394.0,9.0,217.0,47.0,22.0,499.0,499.0,64.0,12.0,499.0,499.0,65.0,47.0,465.0,8.0,96.0,439.0,499.0,394.0,1.0,16.0,0.0,154.0,27.0,499.0,23.0,129.0,11.0,34.0,499.0,114.0,153.0,499.0,499.0,48.0,187.0,406.0,154.0,27.0,499.0,23.0,129.0,11.0,34.0,499.0,114.0,153.0,499.0,499.0,48.0,187.0,406.0,1.0,15.0,0.0,126.0,499.0,4.0,11.0,7.0,96.0,499.0,23.0,499.0,499.0,499.0,11.0,142.0,99.0,126.0,499.0,4.0,11.0,7.0,96.0,499.0,23.0,499.0,499.0,499.0,11.0,142.0,99.0,1.0,3.0,0.0,499.0,499.0,499.0,499.0,1.0,13.0,0.0,6.0,3.0,71.0,8.0,373.0,499.0,10.0,499.0,499.0,7.0,2.0,31.0,6.0,3.0,71.0,8.0,373.0,499.0,10.0,499.0,499.0,7.0,2.0,31.0,1.0,9.0,0.0,32.0,253.0,6.0,417.0,499.0,499.0,499.0,410.0,32.0,253.0,6.0,417.0,499.0,499.0,499.0,410.0,1.0,10.0,0.0,7.0,44.0,57.0,499.0,7.0,499.0,13.0,303.0,499.0,7.0,44.0,57.0,499.0,7.0,499.0,13.0,303.0,499.0,1.0,42.0,0.0,6.0,499.0,73.0,226.0,164.0,499.0,10.0,275.0,20.0,39.0,499.0,66.0,29.0,168.0,8.0,499.0,297.0,13.0,499.0,499.0,33.0,499.0,41.0,49.0,151.0,499.0,8.0,499.0,499.0,4.0,235.0,333.0,165.0,7.0,6.0,151.0,499.0,499.0,172.0,499.0,499.0,6.0,499.0,73.0,226.0,164.0,499.0,10.0,275.0,20.0,39.0,499.0,66.0,29.0,168.0,8.0,499.0,297.0,13.0,499.0,499.0,33.0,499.0,41.0,49.0,151.0,499.0,8.0,499.0,499.0,4.0,235.0,333.0,165.0,7.0,6.0,151.0,499.0,499.0,172.0,499.0,499.0,1.0,21.0,0.0,30.0,136.0,150.0,6.0,3.0,120.0,81.0,197.0,86.0,499.0,41.0,47.0,3.0,109.0,95.0,26.0,6.0,499.0,8.0,258.0,30.0,136.0,150.0,6.0,3.0,120.0,81.0,197.0,86.0,499.0,41.0,47.0,3.0,109.0,95.0,26.0,6.0,499.0,8.0,258.0,1.0,21.0,0.0,39.0,83.0,499.0,87.0,499.0,12.0,499.0,499.0,93.0,11.0,77.0,393.0,2.0,83.0,11.0,95.0,15.0,2.0,499.0,499.0,39.0,83.0,499.0,87.0,499.0,12.0,499.0,499.0,93.0,11.0,77.0,393.0,2.0,83.0,11.0,95.0,15.0,2.0,499.0,499.0,1.0,21.0,0.0,367.0,68.0,6.0,499.0,2.0,499.0,499.0,28.0,27.0,499.0,291.0,499.0,32.0,2.0,83.0,91.0,27.0,21.0,61.0,291.0,367.0,68.0,6.0,499.0,2.0,499.0,499.0,28.0,27.0,499.0,291.0,499.0,32.0,2.0,83.0,91.0,27.0,21.0,61.0,291.0,1.0,32.0,0.0,37.0,2.0,340.0,10.0,499.0,31.0,46.0,499.0,138.0,3.0,17.0,12.0,234.0,10.0,2.0,124.0,10.0,137.0,8.0,98.0,499.0,499.0,19.0,499.0,499.0,56.0,4.0,316.0,37.0,59.0,124.0,37.0,2.0,340.0,10.0,499.0,31.0,46.0,499.0,138.0,3.0,17.0,12.0,234.0,10.0,2.0,124.0,10.0,137.0,8.0,98.0,499.0,499.0,19.0,499.0,499.0,56.0,4.0,316.0,37.0,59.0,124.0,1.0,18.0,0.0,34.0,3.0,17.0,92.0,499.0,15.0,2.0,499.0,26.0,11.0,3.0,54.0,112.0,499.0,20.0,499.0,499.0,34.0,3.0,17.0,92.0,499.0,15.0,2.0,499.0,26.0,11.0,3.0,54.0,112.0,499.0,20.0,499.0,499.0,1.0,24.0,0.0,499.0,499.0,499.0,16.0,23.0,499.0,5.0,499.0,26.0,11.0,200.0,46.0,499.0,169.0,11.0,22.0,4.0,50.0,199.0,4.0,226.0,499.0,275.0,499.0,499.0,499.0,16.0,23.0,499.0,5.0,499.0,26.0,11.0,200.0,46.0,499.0,169.0,11.0,22.0,4.0,50.0,199.0,4.0,226.0,499.0,275.0,1.0,11.0,0.0,12.0,3.0,18.0,234.0,10.0,8.0,499.0,497.0,4.0,499.0,12.0,3.0,18.0,234.0,10.0,8.0,499.0,497.0,4.0,499.0,1.0,35.0,0.0,6.0,130.0,24.0,499.0,150.0,24.0,499.0,499.0,499.0,27.0,12.0,6.0,38.0,3.0,17.0,249.0,12.0,497.0,25.0,9.0,138.0,3.0,17.0,53.0,103.0,42.0,66.0,283.0,46.0,330.0,10.0,499.0,499.0,499.0,6.0,130.0,24.0,499.0,150.0,24.0,499.0,499.0,499.0,27.0,12.0,6.0,38.0,3.0,17.0,249.0,12.0,497.0,25.0,9.0,138.0,3.0,17.0,53.0,103.0,42.0,66.0,283.0,46.0,330.0,10.0,499.0,499.0,499.0,1.0,24.0,0.0,499.0,30.0,241.0,21.0,8.0,258.0,499.0,25.0,11.0,111.0,396.0,44.0,2.0,167.0,155.0,7.0,85.0,499.0,8.0,499.0,20.0,499.0,499.0,499.0,30.0,241.0,21.0,8.0,258.0,499.0,25.0,11.0,111.0,396.0,44.0,2.0,167.0,155.0,7.0,85.0,499.0,8.0,499.0,20.0,499.0,499.0,1.0,17.0,0.0,85.0,26.0,24.0,31.0,2.0,499.0,7.0,104.0,4.0,499.0,2.0,499.0,499.0,8.0,499.0,499.0,85.0,26.0,24.0,31.0,2.0,499.0,7.0,104.0,4.0,499.0,2.0,499.0,499.0,8.0,499.0,499.0,1.0,17.0,0.0,6.0,38.0,3.0,17.0,78.0,2.0,499.0,499.0,12.0,147.0,3.0,17.0,22.0,8.0,499.0,499.0,6.0,38.0,3.0,17.0,78.0,2.0,499.0,499.0,12.0,147.0,3.0,17.0,22.0,8.0,499.0,499.0,1.0,5.0,0.0,499.0,31.0,228.0,499.0,499.0,31.0,228.0,499.0,1.0,13.0,0.0,16.0,45.0,8.0,499.0,499.0,19.0,499.0,26.0,27.0,45.0,91.0,21.0,16.0,45.0,8.0,499.0,499.0,19.0,499.0,26.0,27.0,45.0,91.0,21.0,1.0,22.0,0.0,26.0,47.0,111.0,50.0,2.0,499.0,10.0,44.0,2.0,42.0,66.0,246.0,4.0,30.0,464.0,9.0,60.0,311.0,122.0,46.0,499.0,26.0,47.0,111.0,50.0,2.0,499.0,10.0,44.0,2.0,42.0,66.0,246.0,4.0,30.0,464.0,9.0,60.0,311.0,122.0,46.0,499.0,1.0,29.0,0.0,133.0,6.0,111.0,499.0,63.0,7.0,499.0,4.0,9.0,100.0,25.0,6.0,38.0,3.0,17.0,104.0,9.0,4.0,246.0,392.0,32.0,59.0,234.0,10.0,499.0,499.0,33.0,146.0,133.0,6.0,111.0,499.0,63.0,7.0,499.0,4.0,9.0,100.0,25.0,6.0,38.0,3.0,17.0,104.0,9.0,4.0,246.0,392.0,32.0,59.0,234.0,10.0,499.0,499.0,33.0,146.0,1.0,11.0,0.0,6.0,404.0,3.0,17.0,406.0,58.0,20.0,36.0,499.0,499.0,6.0,404.0,3.0,17.0,406.0,58.0,20.0,36.0,499.0,499.0,1.0,14.0,0.0,499.0,6.0,127.0,8.0,373.0,499.0,10.0,499.0,10.0,63.0,10.0,2.0,499.0,499.0,6.0,127.0,8.0,373.0,499.0,10.0,499.0,10.0,63.0,10.0,2.0,499.0,1.0,31.0,0.0,41.0,132.0,380.0,6.0,22.0,499.0,8.0,472.0,4.0,499.0,39.0,499.0,499.0,40.0,15.0,121.0,19.0,168.0,8.0,166.0,13.0,499.0,33.0,37.0,2.0,87.0,236.0,499.0,499.0,165.0,41.0,132.0,380.0,6.0,22.0,499.0,8.0,472.0,4.0,499.0,39.0,499.0,499.0,40.0,15.0,121.0,19.0,168.0,8.0,166.0,13.0,499.0,33.0,37.0,2.0,87.0,236.0,499.0,499.0,165.0,1.0,10.0,0.0,467.0,187.0,499.0,172.0,499.0,499.0,499.0,96.0,181.0,467.0,187.0,499.0,172.0,499.0,499.0,499.0,96.0,181.0,1.0,14.0,0.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,216.0,5.0,5.0,204.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,216.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,30.0,0.0,35.0,5.0,140.0,5.0,499.0,64.0,204.0,243.0,499.0,13.0,13.0,13.0,499.0,16.0,8.0,98.0,499.0,499.0,15.0,2.0,14.0,204.0,342.0,499.0,98.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,64.0,204.0,243.0,499.0,13.0,13.0,13.0,499.0,16.0,8.0,98.0,499.0,499.0,15.0,2.0,14.0,204.0,342.0,499.0,98.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,21.0,0.0,35.0,5.0,140.0,5.0,499.0,14.0,499.0,499.0,7.0,2.0,441.0,4.0,499.0,2.0,98.0,463.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,14.0,499.0,499.0,7.0,2.0,441.0,4.0,499.0,2.0,98.0,463.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,38.0,0.0,35.0,5.0,140.0,5.0,499.0,9.0,16.0,31.0,2.0,231.0,499.0,128.0,10.0,2.0,98.0,463.0,169.0,10.0,2.0,83.0,13.0,499.0,46.0,499.0,499.0,84.0,499.0,499.0,2.0,76.0,499.0,499.0,36.0,499.0,74.0,463.0,499.0,35.0,5.0,140.0,5.0,499.0,9.0,16.0,31.0,2.0,231.0,499.0,128.0,10.0,2.0,98.0,463.0,169.0,10.0,2.0,83.0,13.0,499.0,46.0,499.0,499.0,84.0,499.0,499.0,2.0,76.0,499.0,499.0,36.0,499.0,74.0,463.0,499.0,1.0,46.0,0.0,154.0,499.0,28.0,499.0,329.0,10.0,499.0,499.0,74.0,36.0,204.0,84.0,499.0,499.0,201.0,8.0,499.0,201.0,33.0,299.0,499.0,10.0,499.0,499.0,7.0,499.0,32.0,97.0,32.0,499.0,499.0,499.0,61.0,74.0,36.0,499.0,7.0,85.0,499.0,499.0,15.0,36.0,499.0,7.0,499.0,154.0,499.0,28.0,499.0,329.0,10.0,499.0,499.0,74.0,36.0,204.0,84.0,499.0,499.0,201.0,8.0,499.0,201.0,33.0,299.0,499.0,10.0,499.0,499.0,7.0,499.0,32.0,97.0,32.0,499.0,499.0,499.0,61.0,74.0,36.0,499.0,7.0,85.0,499.0,499.0,15.0,36.0,499.0,7.0,499.0,1.0,24.0,0.0,57.0,499.0,463.0,499.0,499.0,76.0,499.0,499.0,2.0,499.0,10.0,36.0,499.0,7.0,499.0,43.0,89.0,499.0,499.0,499.0,5.0,5.0,204.0,57.0,499.0,463.0,499.0,499.0,76.0,499.0,499.0,2.0,499.0,10.0,36.0,499.0,7.0,499.0,43.0,89.0,499.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,322.0,82.0,499.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,499.0,322.0,82.0,499.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,2.0,499.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,2.0,499.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,14.0,0.0,35.0,5.0,140.0,5.0,310.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,310.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,140.0,5.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,17.0,0.0,35.0,5.0,158.0,5.0,499.0,499.0,499.0,13.0,499.0,113.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,158.0,5.0,499.0,499.0,499.0,13.0,499.0,113.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,27.0,0.0,35.0,5.0,158.0,5.0,499.0,499.0,113.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,322.0,13.0,230.0,499.0,499.0,322.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,158.0,5.0,499.0,499.0,113.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,322.0,13.0,230.0,499.0,499.0,322.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,16.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,499.0,322.0,82.0,499.0,5.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,499.0,322.0,82.0,499.0,5.0,5.0,499.0,1.0,15.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,30.0,215.0,16.0,15.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,30.0,215.0,16.0,15.0,499.0,1.0,23.0,0.0,70.0,235.0,60.0,21.0,499.0,499.0,77.0,26.0,9.0,16.0,40.0,8.0,499.0,499.0,141.0,499.0,2.0,499.0,499.0,5.0,5.0,499.0,70.0,235.0,60.0,21.0,499.0,499.0,77.0,26.0,9.0,16.0,40.0,8.0,499.0,499.0,141.0,499.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,11.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,6.0,34.0,95.0,53.0,11.0,3.0,54.0,293.0,4.0,51.0,6.0,34.0,95.0,53.0,11.0,3.0,54.0,293.0,4.0,51.0,1.0,17.0,0.0,19.0,67.0,499.0,4.0,42.0,66.0,499.0,4.0,39.0,499.0,499.0,128.0,10.0,2.0,499.0,499.0,19.0,67.0,499.0,4.0,42.0,66.0,499.0,4.0,39.0,499.0,499.0,128.0,10.0,2.0,499.0,499.0,1.0,20.0,0.0,6.0,34.0,50.0,8.0,499.0,499.0,23.0,10.0,2.0,499.0,10.0,2.0,499.0,191.0,46.0,499.0,33.0,499.0,499.0,6.0,34.0,50.0,8.0,499.0,499.0,23.0,10.0,2.0,499.0,10.0,2.0,499.0,191.0,46.0,499.0,33.0,499.0,499.0,1.0,11.0,0.0,12.0,60.0,21.0,499.0,26.0,2.0,499.0,29.0,105.0,499.0,12.0,60.0,21.0,499.0,26.0,2.0,499.0,29.0,105.0,499.0,1.0,56.0,0.0,8.0,499.0,499.0,86.0,8.0,499.0,7.0,499.0,4.0,2.0,499.0,3.0,6.0,3.0,109.0,22.0,8.0,499.0,7.0,499.0,345.0,11.0,3.0,3.0,182.0,139.0,3.0,2.0,499.0,499.0,7.0,499.0,3.0,25.0,499.0,20.0,2.0,297.0,499.0,3.0,2.0,499.0,499.0,73.0,90.0,420.0,7.0,499.0,3.0,6.0,29.0,499.0,20.0,43.0,3.0,8.0,499.0,499.0,86.0,8.0,499.0,7.0,499.0,4.0,2.0,499.0,3.0,6.0,3.0,109.0,22.0,8.0,499.0,7.0,499.0,345.0,11.0,3.0,3.0,182.0,139.0,3.0,2.0,499.0,499.0,7.0,499.0,3.0,25.0,499.0,20.0,2.0,297.0,499.0,3.0,2.0,499.0,499.0,73.0,90.0,420.0,7.0,499.0,3.0,6.0,29.0,499.0,20.0,43.0,3.0,1.0,24.0,0.0,12.0,7.0,52.0,24.0,499.0,499.0,24.0,60.0,499.0,7.0,499.0,499.0,4.0,499.0,2.0,83.0,171.0,41.0,24.0,111.0,453.0,57.0,499.0,12.0,7.0,52.0,24.0,499.0,499.0,24.0,60.0,499.0,7.0,499.0,499.0,4.0,499.0,2.0,83.0,171.0,41.0,24.0,111.0,453.0,57.0,499.0,1.0,17.0,0.0,57.0,83.0,473.0,499.0,453.0,2.0,499.0,19.0,79.0,24.0,60.0,21.0,19.0,30.0,362.0,499.0,57.0,83.0,473.0,499.0,453.0,2.0,499.0,19.0,79.0,24.0,60.0,21.0,19.0,30.0,362.0,499.0,1.0};
-double test_data[] = {100.0,21.0,0.0,6.0,161.0,499.0,12.0,499.0,60.0,499.0,43.0,309.0,13.0,499.0,24.0,499.0,499.0,15.0,59.0,10.0,57.0,499.0,275.0,6.0,161.0,499.0,12.0,499.0,60.0,499.0,43.0,309.0,13.0,499.0,24.0,499.0,499.0,15.0,59.0,10.0,57.0,499.0,275.0,1.0,11.0,0.0,9.0,29.0,8.0,499.0,7.0,499.0,499.0,179.0,19.0,43.0,9.0,29.0,8.0,499.0,7.0,499.0,499.0,179.0,19.0,43.0,1.0,64.0,0.0,27.0,4.0,499.0,2.0,76.0,266.0,6.0,29.0,15.0,39.0,499.0,499.0,499.0,52.0,499.0,499.0,43.0,73.0,7.0,456.0,79.0,132.0,499.0,10.0,279.0,499.0,24.0,499.0,2.0,499.0,10.0,2.0,499.0,150.0,499.0,2.0,499.0,499.0,456.0,108.0,2.0,499.0,499.0,456.0,79.0,49.0,111.0,21.0,499.0,4.0,499.0,499.0,52.0,2.0,42.0,49.0,29.0,499.0,9.0,64.0,131.0,499.0,371.0,27.0,4.0,499.0,2.0,76.0,266.0,6.0,29.0,15.0,39.0,499.0,499.0,499.0,52.0,499.0,499.0,43.0,73.0,7.0,456.0,79.0,132.0,499.0,10.0,279.0,499.0,24.0,499.0,2.0,499.0,10.0,2.0,499.0,150.0,499.0,2.0,499.0,499.0,456.0,108.0,2.0,499.0,499.0,456.0,79.0,49.0,111.0,21.0,499.0,4.0,499.0,499.0,52.0,2.0,42.0,49.0,29.0,499.0,9.0,64.0,131.0,499.0,371.0,1.0,13.0,0.0,499.0,42.0,34.0,499.0,11.0,86.0,499.0,43.0,499.0,20.0,2.0,389.0,499.0,42.0,34.0,499.0,11.0,86.0,499.0,43.0,499.0,20.0,2.0,389.0,1.0,18.0,0.0,499.0,42.0,34.0,499.0,36.0,389.0,12.0,24.0,28.0,2.0,96.0,212.0,7.0,11.0,28.0,2.0,499.0,499.0,42.0,34.0,499.0,36.0,389.0,12.0,24.0,28.0,2.0,96.0,212.0,7.0,11.0,28.0,2.0,499.0,1.0,28.0,0.0,499.0,42.0,34.0,178.0,73.0,8.0,96.0,499.0,19.0,237.0,41.0,12.0,11.0,65.0,24.0,22.0,274.0,52.0,24.0,92.0,22.0,72.0,274.0,52.0,11.0,28.0,499.0,499.0,42.0,34.0,178.0,73.0,8.0,96.0,499.0,19.0,237.0,41.0,12.0,11.0,65.0,24.0,22.0,274.0,52.0,24.0,92.0,22.0,72.0,274.0,52.0,11.0,28.0,499.0,1.0,29.0,0.0,10.0,2.0,499.0,15.0,39.0,198.0,2.0,499.0,16.0,12.0,39.0,434.0,499.0,499.0,37.0,2.0,420.0,10.0,57.0,499.0,93.0,47.0,499.0,12.0,454.0,88.0,27.0,274.0,10.0,2.0,499.0,15.0,39.0,198.0,2.0,499.0,16.0,12.0,39.0,434.0,499.0,499.0,37.0,2.0,420.0,10.0,57.0,499.0,93.0,47.0,499.0,12.0,454.0,88.0,27.0,274.0,1.0,24.0,0.0,499.0,499.0,47.0,202.0,3.0,17.0,221.0,106.0,22.0,43.0,499.0,25.0,454.0,72.0,499.0,499.0,499.0,2.0,499.0,7.0,499.0,499.0,499.0,499.0,499.0,47.0,202.0,3.0,17.0,221.0,106.0,22.0,43.0,499.0,25.0,454.0,72.0,499.0,499.0,499.0,2.0,499.0,7.0,499.0,499.0,499.0,1.0,26.0,0.0,26.0,6.0,88.0,499.0,52.0,24.0,131.0,499.0,12.0,454.0,29.0,112.0,454.0,13.0,499.0,37.0,379.0,6.0,60.0,27.0,22.0,221.0,106.0,425.0,43.0,26.0,6.0,88.0,499.0,52.0,24.0,131.0,499.0,12.0,454.0,29.0,112.0,454.0,13.0,499.0,37.0,379.0,6.0,60.0,27.0,22.0,221.0,106.0,425.0,43.0,1.0,5.0,0.0,6.0,499.0,6.0,88.0,6.0,499.0,6.0,88.0,1.0,11.0,0.0,47.0,499.0,499.0,499.0,4.0,399.0,499.0,15.0,30.0,499.0,47.0,499.0,499.0,499.0,4.0,399.0,499.0,15.0,30.0,499.0,1.0,12.0,0.0,26.0,9.0,16.0,8.0,96.0,499.0,367.0,22.0,499.0,20.0,43.0,26.0,9.0,16.0,8.0,96.0,499.0,367.0,22.0,499.0,20.0,43.0,1.0,31.0,0.0,25.0,26.0,53.0,24.0,28.0,99.0,4.0,499.0,36.0,389.0,16.0,12.0,2.0,389.0,16.0,499.0,33.0,4.0,21.0,499.0,499.0,31.0,454.0,33.0,70.0,76.0,499.0,85.0,390.0,355.0,25.0,26.0,53.0,24.0,28.0,99.0,4.0,499.0,36.0,389.0,16.0,12.0,2.0,389.0,16.0,499.0,33.0,4.0,21.0,499.0,499.0,31.0,454.0,33.0,70.0,76.0,499.0,85.0,390.0,355.0,1.0,42.0,0.0,8.0,499.0,6.0,499.0,88.0,8.0,499.0,12.0,199.0,4.0,499.0,373.0,499.0,10.0,364.0,277.0,106.0,499.0,499.0,29.0,499.0,9.0,29.0,187.0,499.0,7.0,12.0,2.0,364.0,496.0,64.0,90.0,409.0,499.0,272.0,499.0,37.0,8.0,499.0,499.0,499.0,8.0,499.0,6.0,499.0,88.0,8.0,499.0,12.0,199.0,4.0,499.0,373.0,499.0,10.0,364.0,277.0,106.0,499.0,499.0,29.0,499.0,9.0,29.0,187.0,499.0,7.0,12.0,2.0,364.0,496.0,64.0,90.0,409.0,499.0,272.0,499.0,37.0,8.0,499.0,499.0,499.0,1.0,11.0,0.0,499.0,499.0,12.0,30.0,16.0,2.0,83.0,3.0,18.0,499.0,499.0,499.0,12.0,30.0,16.0,2.0,83.0,3.0,18.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,6.0,216.0,5.0,5.0,6.0,1.0,2.0,0.0,499.0,499.0,1.0,26.0,0.0,35.0,5.0,499.0,75.0,499.0,29.0,72.0,96.0,64.0,8.0,499.0,499.0,9.0,56.0,244.0,4.0,55.0,161.0,499.0,499.0,4.0,122.0,8.0,300.0,64.0,35.0,5.0,499.0,75.0,499.0,29.0,72.0,96.0,64.0,8.0,499.0,499.0,9.0,56.0,244.0,4.0,55.0,161.0,499.0,499.0,4.0,122.0,8.0,300.0,64.0,1.0,12.0,0.0,499.0,4.0,8.0,499.0,499.0,499.0,499.0,29.0,136.0,221.0,162.0,499.0,4.0,8.0,499.0,499.0,499.0,499.0,29.0,136.0,221.0,162.0,1.0,11.0,0.0,499.0,499.0,64.0,499.0,62.0,21.0,499.0,86.0,90.0,115.0,499.0,499.0,64.0,499.0,62.0,21.0,499.0,86.0,90.0,115.0,1.0,7.0,0.0,6.0,22.0,499.0,499.0,48.0,499.0,6.0,22.0,499.0,499.0,48.0,499.0,1.0,11.0,0.0,6.0,3.0,109.0,40.0,22.0,4.0,95.0,79.0,9.0,499.0,6.0,3.0,109.0,40.0,22.0,4.0,95.0,79.0,9.0,499.0,1.0,3.0,0.0,467.0,499.0,467.0,499.0,1.0,8.0,0.0,499.0,499.0,28.0,499.0,7.0,499.0,105.0,499.0,499.0,28.0,499.0,7.0,499.0,105.0,1.0,12.0,0.0,40.0,214.0,37.0,70.0,10.0,2.0,499.0,20.0,499.0,15.0,43.0,40.0,214.0,37.0,70.0,10.0,2.0,499.0,20.0,499.0,15.0,43.0,1.0,10.0,0.0,33.0,12.0,325.0,10.0,2.0,499.0,2.0,76.0,145.0,33.0,12.0,325.0,10.0,2.0,499.0,2.0,76.0,145.0,1.0,5.0,0.0,216.0,5.0,5.0,80.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,8.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,499.0,1.0,9.0,0.0,9.0,3.0,18.0,77.0,101.0,23.0,8.0,499.0,9.0,3.0,18.0,77.0,101.0,23.0,8.0,499.0,1.0,3.0,0.0,2.0,499.0,2.0,499.0,1.0,3.0,0.0,2.0,499.0,2.0,499.0,1.0,6.0,0.0,2.0,499.0,23.0,36.0,499.0,2.0,499.0,23.0,36.0,499.0,1.0,10.0,0.0,79.0,2.0,499.0,499.0,7.0,499.0,499.0,11.0,263.0,79.0,2.0,499.0,499.0,7.0,499.0,499.0,11.0,263.0,1.0,4.0,0.0,356.0,499.0,74.0,356.0,499.0,74.0,1.0,10.0,0.0,154.0,2.0,499.0,499.0,19.0,2.0,499.0,499.0,229.0,154.0,2.0,499.0,499.0,19.0,2.0,499.0,499.0,229.0,1.0,6.0,0.0,11.0,162.0,86.0,8.0,499.0,11.0,162.0,86.0,8.0,499.0,1.0,5.0,0.0,39.0,499.0,499.0,105.0,39.0,499.0,499.0,105.0,1.0,22.0,0.0,2.0,139.0,12.0,206.0,9.0,499.0,19.0,67.0,29.0,4.0,72.0,499.0,499.0,52.0,11.0,78.0,12.0,9.0,62.0,499.0,499.0,2.0,139.0,12.0,206.0,9.0,499.0,19.0,67.0,29.0,4.0,72.0,499.0,499.0,52.0,11.0,78.0,12.0,9.0,62.0,499.0,499.0,1.0,13.0,0.0,499.0,72.0,466.0,4.0,499.0,9.0,52.0,11.0,3.0,54.0,15.0,499.0,499.0,72.0,466.0,4.0,499.0,9.0,52.0,11.0,3.0,54.0,15.0,499.0,1.0,12.0,0.0,26.0,11.0,51.0,12.0,85.0,107.0,135.0,11.0,466.0,499.0,499.0,26.0,11.0,51.0,12.0,85.0,107.0,135.0,11.0,466.0,499.0,499.0,1.0,28.0,0.0,11.0,34.0,499.0,473.0,499.0,7.0,167.0,9.0,3.0,18.0,411.0,4.0,21.0,173.0,4.0,51.0,41.0,40.0,240.0,37.0,9.0,7.0,11.0,3.0,109.0,50.0,9.0,11.0,34.0,499.0,473.0,499.0,7.0,167.0,9.0,3.0,18.0,411.0,4.0,21.0,173.0,4.0,51.0,41.0,40.0,240.0,37.0,9.0,7.0,11.0,3.0,109.0,50.0,9.0,1.0,27.0,0.0,6.0,3.0,120.0,160.0,499.0,499.0,499.0,6.0,499.0,2.0,499.0,499.0,16.0,87.0,411.0,4.0,67.0,41.0,6.0,38.0,3.0,17.0,65.0,12.0,60.0,235.0,6.0,3.0,120.0,160.0,499.0,499.0,499.0,6.0,499.0,2.0,499.0,499.0,16.0,87.0,411.0,4.0,67.0,41.0,6.0,38.0,3.0,17.0,65.0,12.0,60.0,235.0,1.0,41.0,0.0,6.0,51.0,9.0,68.0,85.0,2.0,499.0,62.0,160.0,50.0,43.0,262.0,7.0,12.0,499.0,67.0,467.0,499.0,6.0,150.0,2.0,499.0,32.0,8.0,499.0,85.0,220.0,2.0,499.0,10.0,2.0,282.0,7.0,9.0,499.0,61.0,42.0,92.0,51.0,12.0,6.0,51.0,9.0,68.0,85.0,2.0,499.0,62.0,160.0,50.0,43.0,262.0,7.0,12.0,499.0,67.0,467.0,499.0,6.0,150.0,2.0,499.0,32.0,8.0,499.0,85.0,220.0,2.0,499.0,10.0,2.0,282.0,7.0,9.0,499.0,61.0,42.0,92.0,51.0,12.0,1.0,4.0,0.0,42.0,28.0,499.0,42.0,28.0,499.0,1.0,13.0,0.0,14.0,14.0,141.0,220.0,30.0,158.0,15.0,154.0,499.0,93.0,323.0,269.0,14.0,14.0,141.0,220.0,30.0,158.0,15.0,154.0,499.0,93.0,323.0,269.0,1.0,30.0,0.0,11.0,22.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,14.0,14.0,36.0,166.0,29.0,499.0,32.0,9.0,361.0,31.0,11.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,11.0,22.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,14.0,14.0,36.0,166.0,29.0,499.0,32.0,9.0,361.0,31.0,11.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,1.0,117.0,0.0,499.0,179.0,356.0,499.0,499.0,7.0,185.0,499.0,196.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,4.0,335.0,8.0,209.0,33.0,440.0,114.0,141.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,499.0,10.0,70.0,234.0,185.0,5.0,94.0,5.0,499.0,33.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,8.0,232.0,301.0,476.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,114.0,12.0,56.0,499.0,36.0,229.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,146.0,251.0,27.0,499.0,185.0,63.0,10.0,2.0,499.0,499.0,15.0,134.0,499.0,12.0,101.0,499.0,36.0,488.0,499.0,179.0,356.0,499.0,499.0,7.0,185.0,499.0,196.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,4.0,335.0,8.0,209.0,33.0,440.0,114.0,141.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,499.0,10.0,70.0,234.0,185.0,5.0,94.0,5.0,499.0,33.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,8.0,232.0,301.0,476.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,114.0,12.0,56.0,499.0,36.0,229.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,146.0,251.0,27.0,499.0,185.0,63.0,10.0,2.0,499.0,499.0,15.0,134.0,499.0,12.0,101.0,499.0,36.0,488.0,1.0,35.0,0.0,26.0,11.0,156.0,58.0,499.0,33.0,149.0,30.0,29.0,46.0,499.0,141.0,353.0,2.0,424.0,7.0,261.0,8.0,499.0,4.0,30.0,166.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,26.0,11.0,156.0,58.0,499.0,33.0,149.0,30.0,29.0,46.0,499.0,141.0,353.0,2.0,424.0,7.0,261.0,8.0,499.0,4.0,30.0,166.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,67.0,0.0,85.0,440.0,79.0,47.0,34.0,22.0,499.0,499.0,434.0,499.0,48.0,2.0,98.0,499.0,7.0,22.0,499.0,499.0,64.0,499.0,499.0,84.0,147.0,3.0,17.0,499.0,37.0,2.0,98.0,499.0,4.0,174.0,250.0,499.0,434.0,52.0,499.0,499.0,499.0,2.0,499.0,28.0,55.0,499.0,499.0,4.0,499.0,263.0,334.0,2.0,145.0,7.0,49.0,147.0,3.0,17.0,65.0,24.0,77.0,181.0,70.0,58.0,216.0,5.0,5.0,80.0,85.0,440.0,79.0,47.0,34.0,22.0,499.0,499.0,434.0,499.0,48.0,2.0,98.0,499.0,7.0,22.0,499.0,499.0,64.0,499.0,499.0,84.0,147.0,3.0,17.0,499.0,37.0,2.0,98.0,499.0,4.0,174.0,250.0,499.0,434.0,52.0,499.0,499.0,499.0,2.0,499.0,28.0,55.0,499.0,499.0,4.0,499.0,263.0,334.0,2.0,145.0,7.0,49.0,147.0,3.0,17.0,65.0,24.0,77.0,181.0,70.0,58.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,18.0,0.0,6.0,38.0,3.0,17.0,68.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,499.0,4.0,2.0,499.0,499.0,6.0,38.0,3.0,17.0,68.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,499.0,4.0,2.0,499.0,499.0,1.0,36.0,0.0,25.0,63.0,10.0,2.0,87.0,155.0,499.0,499.0,284.0,6.0,29.0,260.0,456.0,15.0,39.0,87.0,155.0,499.0,29.0,48.0,499.0,499.0,13.0,499.0,499.0,7.0,63.0,499.0,13.0,499.0,499.0,7.0,2.0,499.0,499.0,25.0,63.0,10.0,2.0,87.0,155.0,499.0,499.0,284.0,6.0,29.0,260.0,456.0,15.0,39.0,87.0,155.0,499.0,29.0,48.0,499.0,499.0,13.0,499.0,499.0,7.0,63.0,499.0,13.0,499.0,499.0,7.0,2.0,499.0,499.0,1.0,8.0,0.0,6.0,499.0,87.0,97.0,499.0,4.0,476.0,6.0,499.0,87.0,97.0,499.0,4.0,476.0,1.0,27.0,0.0,499.0,311.0,142.0,499.0,105.0,9.0,3.0,18.0,40.0,27.0,32.0,189.0,347.0,68.0,499.0,56.0,499.0,499.0,499.0,12.0,62.0,116.0,499.0,4.0,21.0,218.0,499.0,311.0,142.0,499.0,105.0,9.0,3.0,18.0,40.0,27.0,32.0,189.0,347.0,68.0,499.0,56.0,499.0,499.0,499.0,12.0,62.0,116.0,499.0,4.0,21.0,218.0,1.0,8.0,0.0,311.0,499.0,19.0,2.0,103.0,128.0,152.0,311.0,499.0,19.0,2.0,103.0,128.0,152.0,1.0,15.0,0.0,394.0,24.0,92.0,156.0,4.0,50.0,117.0,101.0,37.0,499.0,499.0,289.0,304.0,273.0,394.0,24.0,92.0,156.0,4.0,50.0,117.0,101.0,37.0,499.0,499.0,289.0,304.0,273.0,1.0,2.0,0.0,499.0,499.0,1.0,23.0,0.0,499.0,16.0,40.0,499.0,189.0,12.0,499.0,499.0,15.0,499.0,19.0,53.0,499.0,309.0,5.0,119.0,138.0,3.0,17.0,77.0,96.0,499.0,499.0,16.0,40.0,499.0,189.0,12.0,499.0,499.0,15.0,499.0,19.0,53.0,499.0,309.0,5.0,119.0,138.0,3.0,17.0,77.0,96.0,499.0,1.0,6.0,0.0,27.0,4.0,499.0,499.0,499.0,27.0,4.0,499.0,499.0,499.0,1.0,17.0,0.0,19.0,2.0,499.0,499.0,499.0,241.0,87.0,97.0,22.0,499.0,2.0,415.0,331.0,61.0,10.0,203.0,19.0,2.0,499.0,499.0,499.0,241.0,87.0,97.0,22.0,499.0,2.0,415.0,331.0,61.0,10.0,203.0,1.0,25.0,0.0,37.0,236.0,499.0,142.0,59.0,499.0,494.0,212.0,31.0,499.0,2.0,499.0,499.0,7.0,499.0,7.0,75.0,142.0,8.0,239.0,499.0,499.0,15.0,499.0,37.0,236.0,499.0,142.0,59.0,499.0,494.0,212.0,31.0,499.0,2.0,499.0,499.0,7.0,499.0,7.0,75.0,142.0,8.0,239.0,499.0,499.0,15.0,499.0,1.0,7.0,0.0,499.0,92.0,40.0,142.0,451.0,326.0,499.0,92.0,40.0,142.0,451.0,326.0,1.0,24.0,0.0,23.0,2.0,76.0,499.0,10.0,2.0,499.0,6.0,72.0,22.0,254.0,418.0,285.0,10.0,499.0,294.0,7.0,12.0,29.0,40.0,19.0,8.0,499.0,23.0,2.0,76.0,499.0,10.0,2.0,499.0,6.0,72.0,22.0,254.0,418.0,285.0,10.0,499.0,294.0,7.0,12.0,29.0,40.0,19.0,8.0,499.0,1.0,16.0,0.0,6.0,157.0,59.0,499.0,167.0,15.0,499.0,25.0,12.0,138.0,3.0,17.0,92.0,285.0,499.0,6.0,157.0,59.0,499.0,167.0,15.0,499.0,25.0,12.0,138.0,3.0,17.0,92.0,285.0,499.0,1.0,15.0,0.0,6.0,72.0,78.0,79.0,4.0,499.0,15.0,499.0,7.0,59.0,499.0,499.0,499.0,499.0,6.0,72.0,78.0,79.0,4.0,499.0,15.0,499.0,7.0,59.0,499.0,499.0,499.0,499.0,1.0,54.0,0.0,41.0,11.0,130.0,4.0,335.0,67.0,12.0,499.0,499.0,12.0,499.0,57.0,337.0,499.0,15.0,2.0,439.0,499.0,22.0,499.0,499.0,86.0,8.0,337.0,205.0,499.0,20.0,8.0,205.0,499.0,7.0,42.0,66.0,214.0,326.0,31.0,11.0,7.0,38.0,3.0,17.0,22.0,146.0,15.0,499.0,20.0,499.0,316.0,2.0,499.0,13.0,499.0,499.0,41.0,11.0,130.0,4.0,335.0,67.0,12.0,499.0,499.0,12.0,499.0,57.0,337.0,499.0,15.0,2.0,439.0,499.0,22.0,499.0,499.0,86.0,8.0,337.0,205.0,499.0,20.0,8.0,205.0,499.0,7.0,42.0,66.0,214.0,326.0,31.0,11.0,7.0,38.0,3.0,17.0,22.0,146.0,15.0,499.0,20.0,499.0,316.0,2.0,499.0,13.0,499.0,499.0,1.0,13.0,0.0,47.0,142.0,59.0,499.0,61.0,10.0,2.0,499.0,499.0,499.0,107.0,100.0,47.0,142.0,59.0,499.0,61.0,10.0,2.0,499.0,499.0,499.0,107.0,100.0,1.0,33.0,0.0,6.0,186.0,3.0,17.0,123.0,49.0,29.0,260.0,8.0,499.0,499.0,25.0,499.0,49.0,157.0,499.0,499.0,499.0,7.0,59.0,10.0,90.0,181.0,20.0,2.0,499.0,88.0,4.0,51.0,20.0,499.0,499.0,6.0,186.0,3.0,17.0,123.0,49.0,29.0,260.0,8.0,499.0,499.0,25.0,499.0,49.0,157.0,499.0,499.0,499.0,7.0,59.0,10.0,90.0,181.0,20.0,2.0,499.0,88.0,4.0,51.0,20.0,499.0,499.0,1.0,15.0,0.0,9.0,3.0,18.0,27.0,12.0,14.0,499.0,14.0,403.0,4.0,499.0,64.0,2.0,499.0,9.0,3.0,18.0,27.0,12.0,14.0,499.0,14.0,403.0,4.0,499.0,64.0,2.0,499.0,1.0,18.0,0.0,9.0,3.0,18.0,40.0,12.0,103.0,246.0,64.0,2.0,499.0,499.0,7.0,76.0,499.0,31.0,499.0,499.0,9.0,3.0,18.0,40.0,12.0,103.0,246.0,64.0,2.0,499.0,499.0,7.0,76.0,499.0,31.0,499.0,499.0,1.0,5.0,0.0,499.0,19.0,36.0,499.0,499.0,19.0,36.0,499.0,1.0,19.0,0.0,6.0,3.0,71.0,197.0,86.0,278.0,39.0,499.0,499.0,289.0,365.0,15.0,499.0,7.0,499.0,12.0,8.0,499.0,6.0,3.0,71.0,197.0,86.0,278.0,39.0,499.0,499.0,289.0,365.0,15.0,499.0,7.0,499.0,12.0,8.0,499.0,1.0,32.0,0.0,9.0,34.0,3.0,17.0,499.0,499.0,26.0,39.0,499.0,212.0,131.0,15.0,499.0,6.0,60.0,22.0,88.0,2.0,499.0,2.0,145.0,135.0,2.0,499.0,499.0,6.0,29.0,8.0,499.0,19.0,63.0,9.0,34.0,3.0,17.0,499.0,499.0,26.0,39.0,499.0,212.0,131.0,15.0,499.0,6.0,60.0,22.0,88.0,2.0,499.0,2.0,145.0,135.0,2.0,499.0,499.0,6.0,29.0,8.0,499.0,19.0,63.0,1.0,17.0,0.0,6.0,65.0,24.0,3.0,54.0,499.0,23.0,39.0,499.0,7.0,104.0,4.0,95.0,67.0,149.0,101.0,6.0,65.0,24.0,3.0,54.0,499.0,23.0,39.0,499.0,7.0,104.0,4.0,95.0,67.0,149.0,101.0,1.0,32.0,0.0,24.0,3.0,54.0,44.0,41.0,499.0,12.0,6.0,3.0,109.0,21.0,101.0,7.0,499.0,8.0,499.0,198.0,25.0,107.0,133.0,2.0,499.0,38.0,3.0,17.0,499.0,2.0,499.0,15.0,39.0,499.0,24.0,3.0,54.0,44.0,41.0,499.0,12.0,6.0,3.0,109.0,21.0,101.0,7.0,499.0,8.0,499.0,198.0,25.0,107.0,133.0,2.0,499.0,38.0,3.0,17.0,499.0,2.0,499.0,15.0,39.0,499.0,1.0,22.0,0.0,6.0,3.0,71.0,293.0,4.0,499.0,4.0,39.0,98.0,198.0,7.0,62.0,499.0,4.0,181.0,23.0,499.0,8.0,198.0,15.0,499.0,6.0,3.0,71.0,293.0,4.0,499.0,4.0,39.0,98.0,198.0,7.0,62.0,499.0,4.0,181.0,23.0,499.0,8.0,198.0,15.0,499.0,1.0,8.0,0.0,499.0,36.0,499.0,56.0,81.0,318.0,499.0,499.0,36.0,499.0,56.0,81.0,318.0,499.0,1.0,10.0,0.0,30.0,308.0,213.0,27.0,388.0,499.0,4.0,166.0,499.0,30.0,308.0,213.0,27.0,388.0,499.0,4.0,166.0,499.0,1.0,11.0,0.0,141.0,179.0,61.0,2.0,233.0,93.0,499.0,70.0,58.0,499.0,141.0,179.0,61.0,2.0,233.0,93.0,499.0,70.0,58.0,499.0,1.0,28.0,0.0,26.0,11.0,3.0,54.0,197.0,19.0,270.0,23.0,8.0,499.0,179.0,61.0,2.0,499.0,270.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,26.0,11.0,3.0,54.0,197.0,19.0,270.0,23.0,8.0,499.0,179.0,61.0,2.0,499.0,270.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,17.0,0.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,15.0,2.0,499.0,3.0,18.0,16.0,499.0,10.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,15.0,2.0,499.0,3.0,18.0,16.0,499.0,10.0,499.0,1.0,5.0,0.0,499.0,159.0,499.0,410.0,499.0,159.0,499.0,410.0,1.0,38.0,0.0,170.0,2.0,300.0,3.0,18.0,121.0,499.0,16.0,14.0,14.0,499.0,14.0,14.0,4.0,2.0,499.0,6.0,399.0,149.0,31.0,47.0,28.0,99.0,4.0,50.0,8.0,453.0,73.0,19.0,2.0,499.0,7.0,499.0,10.0,499.0,7.0,499.0,170.0,2.0,300.0,3.0,18.0,121.0,499.0,16.0,14.0,14.0,499.0,14.0,14.0,4.0,2.0,499.0,6.0,399.0,149.0,31.0,47.0,28.0,99.0,4.0,50.0,8.0,453.0,73.0,19.0,2.0,499.0,7.0,499.0,10.0,499.0,7.0,499.0,1.0,86.0,0.0,328.0,2.0,499.0,28.0,197.0,19.0,499.0,7.0,499.0,7.0,180.0,51.0,47.0,174.0,8.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,12.0,3.0,18.0,107.0,188.0,10.0,11.0,226.0,37.0,499.0,53.0,26.0,30.0,300.0,16.0,99.0,4.0,21.0,499.0,181.0,19.0,8.0,231.0,300.0,4.0,143.0,193.0,4.0,499.0,499.0,4.0,499.0,5.0,499.0,188.0,499.0,47.0,78.0,64.0,499.0,12.0,2.0,499.0,28.0,499.0,8.0,499.0,499.0,15.0,499.0,4.0,174.0,499.0,41.0,114.0,56.0,4.0,499.0,43.0,15.0,12.0,499.0,499.0,328.0,2.0,499.0,28.0,197.0,19.0,499.0,7.0,499.0,7.0,180.0,51.0,47.0,174.0,8.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,12.0,3.0,18.0,107.0,188.0,10.0,11.0,226.0,37.0,499.0,53.0,26.0,30.0,300.0,16.0,99.0,4.0,21.0,499.0,181.0,19.0,8.0,231.0,300.0,4.0,143.0,193.0,4.0,499.0,499.0,4.0,499.0,5.0,499.0,188.0,499.0,47.0,78.0,64.0,499.0,12.0,2.0,499.0,28.0,499.0,8.0,499.0,499.0,15.0,499.0,4.0,174.0,499.0,41.0,114.0,56.0,4.0,499.0,43.0,15.0,12.0,499.0,499.0,1.0,13.0,0.0,278.0,270.0,16.0,63.0,139.0,277.0,9.0,19.0,146.0,499.0,16.0,195.0,278.0,270.0,16.0,63.0,139.0,277.0,9.0,19.0,146.0,499.0,16.0,195.0,1.0,30.0,0.0,280.0,59.0,42.0,8.0,499.0,4.0,499.0,64.0,7.0,24.0,366.0,22.0,8.0,499.0,499.0,149.0,96.0,499.0,4.0,499.0,43.0,19.0,8.0,258.0,89.0,5.0,499.0,5.0,499.0,280.0,59.0,42.0,8.0,499.0,4.0,499.0,64.0,7.0,24.0,366.0,22.0,8.0,499.0,499.0,149.0,96.0,499.0,4.0,499.0,43.0,19.0,8.0,258.0,89.0,5.0,499.0,5.0,499.0,1.0,48.0,0.0,22.0,11.0,260.0,499.0,70.0,10.0,2.0,499.0,167.0,24.0,3.0,120.0,479.0,33.0,499.0,450.0,499.0,12.0,3.0,18.0,44.0,43.0,360.0,116.0,499.0,43.0,8.0,499.0,499.0,33.0,499.0,124.0,4.0,465.0,25.0,6.0,499.0,499.0,45.0,3.0,18.0,70.0,499.0,499.0,499.0,20.0,43.0,22.0,11.0,260.0,499.0,70.0,10.0,2.0,499.0,167.0,24.0,3.0,120.0,479.0,33.0,499.0,450.0,499.0,12.0,3.0,18.0,44.0,43.0,360.0,116.0,499.0,43.0,8.0,499.0,499.0,33.0,499.0,124.0,4.0,465.0,25.0,6.0,499.0,499.0,45.0,3.0,18.0,70.0,499.0,499.0,499.0,20.0,43.0,1.0,37.0,0.0,499.0,28.0,11.0,499.0,499.0,8.0,499.0,138.0,3.0,17.0,8.0,499.0,11.0,499.0,499.0,112.0,499.0,23.0,11.0,4.0,174.0,46.0,499.0,180.0,208.0,29.0,499.0,19.0,499.0,33.0,499.0,208.0,15.0,8.0,499.0,499.0,499.0,28.0,11.0,499.0,499.0,8.0,499.0,138.0,3.0,17.0,8.0,499.0,11.0,499.0,499.0,112.0,499.0,23.0,11.0,4.0,174.0,46.0,499.0,180.0,208.0,29.0,499.0,19.0,499.0,33.0,499.0,208.0,15.0,8.0,499.0,499.0,1.0,11.0,0.0,499.0,75.0,147.0,3.0,17.0,499.0,499.0,11.0,247.0,499.0,499.0,75.0,147.0,3.0,17.0,499.0,499.0,11.0,247.0,499.0,1.0,15.0,0.0,68.0,8.0,499.0,404.0,3.0,17.0,21.0,443.0,8.0,499.0,74.0,70.0,499.0,499.0,68.0,8.0,499.0,404.0,3.0,17.0,21.0,443.0,8.0,499.0,74.0,70.0,499.0,499.0,1.0,24.0,0.0,499.0,56.0,499.0,48.0,30.0,128.0,10.0,2.0,145.0,399.0,32.0,132.0,380.0,26.0,27.0,58.0,69.0,49.0,56.0,499.0,48.0,2.0,499.0,499.0,56.0,499.0,48.0,30.0,128.0,10.0,2.0,145.0,399.0,32.0,132.0,380.0,26.0,27.0,58.0,69.0,49.0,56.0,499.0,48.0,2.0,499.0,1.0,22.0,0.0,37.0,499.0,49.0,7.0,499.0,131.0,499.0,10.0,499.0,15.0,2.0,499.0,180.0,499.0,3.0,18.0,499.0,60.0,499.0,21.0,224.0,37.0,499.0,49.0,7.0,499.0,131.0,499.0,10.0,499.0,15.0,2.0,499.0,180.0,499.0,3.0,18.0,499.0,60.0,499.0,21.0,224.0,1.0,8.0,0.0,6.0,88.0,81.0,8.0,499.0,499.0,499.0,6.0,88.0,81.0,8.0,499.0,499.0,499.0,1.0,13.0,0.0,9.0,40.0,206.0,499.0,39.0,339.0,341.0,9.0,7.0,6.0,341.0,9.0,9.0,40.0,206.0,499.0,39.0,339.0,341.0,9.0,7.0,6.0,341.0,9.0,1.0,14.0,0.0,6.0,499.0,499.0,172.0,499.0,7.0,6.0,202.0,3.0,17.0,77.0,283.0,382.0,6.0,499.0,499.0,172.0,499.0,7.0,6.0,202.0,3.0,17.0,77.0,283.0,382.0,1.0,9.0,0.0,12.0,29.0,279.0,63.0,408.0,346.0,201.0,63.0,12.0,29.0,279.0,63.0,408.0,346.0,201.0,63.0,1.0};
+ps_real training_data[] = {800.0,20.0,0.0,6.0,499.0,8.0,98.0,499.0,30.0,483.0,7.0,24.0,22.0,205.0,499.0,233.0,69.0,6.0,3.0,71.0,199.0,4.0,6.0,499.0,8.0,98.0,499.0,30.0,483.0,7.0,24.0,22.0,205.0,499.0,233.0,69.0,6.0,3.0,71.0,199.0,4.0,1.0,11.0,0.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,13.0,125.0,499.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,13.0,125.0,499.0,1.0,28.0,0.0,499.0,499.0,230.0,384.0,19.0,228.0,499.0,499.0,125.0,384.0,432.0,499.0,254.0,384.0,432.0,499.0,499.0,7.0,59.0,499.0,19.0,499.0,5.0,499.0,5.0,499.0,499.0,499.0,499.0,230.0,384.0,19.0,228.0,499.0,499.0,125.0,384.0,432.0,499.0,254.0,384.0,432.0,499.0,499.0,7.0,59.0,499.0,19.0,499.0,5.0,499.0,5.0,499.0,499.0,1.0,40.0,0.0,39.0,370.0,16.0,16.0,9.0,499.0,499.0,12.0,499.0,56.0,2.0,499.0,499.0,19.0,499.0,6.0,178.0,15.0,2.0,233.0,37.0,8.0,499.0,499.0,7.0,499.0,12.0,175.0,499.0,88.0,499.0,384.0,58.0,69.0,2.0,175.0,499.0,5.0,499.0,39.0,370.0,16.0,16.0,9.0,499.0,499.0,12.0,499.0,56.0,2.0,499.0,499.0,19.0,499.0,6.0,178.0,15.0,2.0,233.0,37.0,8.0,499.0,499.0,7.0,499.0,12.0,175.0,499.0,88.0,499.0,384.0,58.0,69.0,2.0,175.0,499.0,5.0,499.0,1.0,14.0,0.0,60.0,9.0,21.0,499.0,27.0,4.0,499.0,8.0,499.0,15.0,2.0,155.0,499.0,60.0,9.0,21.0,499.0,27.0,4.0,499.0,8.0,499.0,15.0,2.0,155.0,499.0,1.0,25.0,0.0,15.0,36.0,499.0,8.0,402.0,111.0,40.0,27.0,390.0,2.0,499.0,499.0,179.0,23.0,2.0,499.0,7.0,112.0,499.0,2.0,302.0,4.0,2.0,499.0,15.0,36.0,499.0,8.0,402.0,111.0,40.0,27.0,390.0,2.0,499.0,499.0,179.0,23.0,2.0,499.0,7.0,112.0,499.0,2.0,302.0,4.0,2.0,499.0,1.0,9.0,0.0,45.0,3.0,18.0,55.0,117.0,4.0,499.0,9.0,45.0,3.0,18.0,55.0,117.0,4.0,499.0,9.0,1.0,25.0,0.0,46.0,499.0,499.0,16.0,99.0,4.0,27.0,499.0,2.0,302.0,4.0,43.0,52.0,24.0,95.0,24.0,3.0,54.0,8.0,499.0,23.0,2.0,499.0,179.0,46.0,499.0,499.0,16.0,99.0,4.0,27.0,499.0,2.0,302.0,4.0,43.0,52.0,24.0,95.0,24.0,3.0,54.0,8.0,499.0,23.0,2.0,499.0,179.0,1.0,16.0,0.0,8.0,499.0,499.0,138.0,3.0,17.0,99.0,4.0,390.0,2.0,179.0,15.0,2.0,155.0,115.0,8.0,499.0,499.0,138.0,3.0,17.0,99.0,4.0,390.0,2.0,179.0,15.0,2.0,155.0,115.0,1.0,53.0,0.0,55.0,63.0,16.0,99.0,4.0,21.0,499.0,192.0,4.0,390.0,2.0,179.0,95.0,24.0,3.0,54.0,8.0,499.0,7.0,85.0,44.0,10.0,8.0,499.0,499.0,499.0,499.0,7.0,123.0,499.0,11.0,78.0,53.0,100.0,3.0,18.0,36.0,302.0,499.0,24.0,186.0,3.0,17.0,390.0,2.0,247.0,179.0,15.0,2.0,155.0,115.0,499.0,55.0,63.0,16.0,99.0,4.0,21.0,499.0,192.0,4.0,390.0,2.0,179.0,95.0,24.0,3.0,54.0,8.0,499.0,7.0,85.0,44.0,10.0,8.0,499.0,499.0,499.0,499.0,7.0,123.0,499.0,11.0,78.0,53.0,100.0,3.0,18.0,36.0,302.0,499.0,24.0,186.0,3.0,17.0,390.0,2.0,247.0,179.0,15.0,2.0,155.0,115.0,499.0,1.0,45.0,0.0,36.0,499.0,499.0,16.0,14.0,14.0,27.0,499.0,14.0,14.0,30.0,16.0,108.0,42.0,153.0,499.0,3.0,18.0,46.0,458.0,108.0,27.0,122.0,8.0,499.0,179.0,169.0,180.0,9.0,60.0,21.0,499.0,4.0,499.0,499.0,4.0,499.0,12.0,147.0,3.0,17.0,499.0,499.0,499.0,36.0,499.0,499.0,16.0,14.0,14.0,27.0,499.0,14.0,14.0,30.0,16.0,108.0,42.0,153.0,499.0,3.0,18.0,46.0,458.0,108.0,27.0,122.0,8.0,499.0,179.0,169.0,180.0,9.0,60.0,21.0,499.0,4.0,499.0,499.0,4.0,499.0,12.0,147.0,3.0,17.0,499.0,499.0,499.0,1.0,6.0,0.0,47.0,295.0,247.0,22.0,12.0,47.0,295.0,247.0,22.0,12.0,1.0,19.0,0.0,53.0,499.0,3.0,17.0,11.0,499.0,48.0,499.0,9.0,3.0,18.0,40.0,499.0,27.0,499.0,4.0,499.0,499.0,53.0,499.0,3.0,17.0,11.0,499.0,48.0,499.0,9.0,3.0,18.0,40.0,499.0,27.0,499.0,4.0,499.0,499.0,1.0,36.0,0.0,6.0,3.0,110.0,31.0,4.0,122.0,9.0,499.0,25.0,45.0,3.0,18.0,55.0,124.0,15.0,299.0,9.0,499.0,499.0,3.0,54.0,40.0,499.0,9.0,4.0,122.0,8.0,499.0,499.0,499.0,179.0,499.0,15.0,189.0,499.0,6.0,3.0,110.0,31.0,4.0,122.0,9.0,499.0,25.0,45.0,3.0,18.0,55.0,124.0,15.0,299.0,9.0,499.0,499.0,3.0,54.0,40.0,499.0,9.0,4.0,122.0,8.0,499.0,499.0,499.0,179.0,499.0,15.0,189.0,499.0,1.0,29.0,0.0,32.0,8.0,302.0,499.0,66.0,56.0,499.0,55.0,63.0,7.0,56.0,499.0,499.0,452.0,6.0,161.0,38.0,3.0,17.0,200.0,2.0,499.0,13.0,302.0,499.0,8.0,499.0,139.0,32.0,8.0,302.0,499.0,66.0,56.0,499.0,55.0,63.0,7.0,56.0,499.0,499.0,452.0,6.0,161.0,38.0,3.0,17.0,200.0,2.0,499.0,13.0,302.0,499.0,8.0,499.0,139.0,1.0,17.0,0.0,9.0,3.0,18.0,42.0,31.0,11.0,12.0,499.0,67.0,4.0,27.0,280.0,46.0,499.0,37.0,44.0,9.0,3.0,18.0,42.0,31.0,11.0,12.0,499.0,67.0,4.0,27.0,280.0,46.0,499.0,37.0,44.0,1.0,13.0,0.0,6.0,3.0,71.0,499.0,4.0,499.0,499.0,4.0,499.0,499.0,32.0,499.0,6.0,3.0,71.0,499.0,4.0,499.0,499.0,4.0,499.0,499.0,32.0,499.0,1.0,16.0,0.0,143.0,9.0,33.0,499.0,9.0,68.0,9.0,138.0,3.0,17.0,99.0,4.0,21.0,206.0,499.0,143.0,9.0,33.0,499.0,9.0,68.0,9.0,138.0,3.0,17.0,99.0,4.0,21.0,206.0,499.0,1.0,4.0,0.0,27.0,499.0,499.0,27.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,16.0,0.0,24.0,38.0,3.0,17.0,50.0,499.0,19.0,79.0,102.0,121.0,11.0,499.0,201.0,36.0,499.0,24.0,38.0,3.0,17.0,50.0,499.0,19.0,79.0,102.0,121.0,11.0,499.0,201.0,36.0,499.0,1.0,8.0,0.0,24.0,50.0,499.0,52.0,11.0,499.0,9.0,24.0,50.0,499.0,52.0,11.0,499.0,9.0,1.0,31.0,0.0,137.0,8.0,499.0,499.0,499.0,53.0,272.0,499.0,334.0,12.0,121.0,24.0,3.0,120.0,206.0,499.0,7.0,112.0,22.0,2.0,499.0,4.0,122.0,499.0,26.0,11.0,499.0,4.0,499.0,9.0,137.0,8.0,499.0,499.0,499.0,53.0,272.0,499.0,334.0,12.0,121.0,24.0,3.0,120.0,206.0,499.0,7.0,112.0,22.0,2.0,499.0,4.0,122.0,499.0,26.0,11.0,499.0,4.0,499.0,9.0,1.0,33.0,0.0,6.0,499.0,262.0,93.0,2.0,499.0,499.0,15.0,46.0,8.0,113.0,499.0,19.0,499.0,412.0,15.0,499.0,499.0,6.0,328.0,2.0,499.0,259.0,499.0,193.0,20.0,386.0,15.0,8.0,499.0,499.0,499.0,6.0,499.0,262.0,93.0,2.0,499.0,499.0,15.0,46.0,8.0,113.0,499.0,19.0,499.0,412.0,15.0,499.0,499.0,6.0,328.0,2.0,499.0,259.0,499.0,193.0,20.0,386.0,15.0,8.0,499.0,499.0,499.0,1.0,11.0,0.0,7.0,39.0,499.0,131.0,75.0,499.0,386.0,499.0,7.0,107.0,7.0,39.0,499.0,131.0,75.0,499.0,386.0,499.0,7.0,107.0,1.0,10.0,0.0,317.0,13.0,316.0,499.0,5.0,499.0,5.0,499.0,386.0,317.0,13.0,316.0,499.0,5.0,499.0,5.0,499.0,386.0,1.0,5.0,0.0,386.0,386.0,247.0,499.0,386.0,386.0,247.0,499.0,1.0,11.0,0.0,9.0,29.0,499.0,137.0,4.0,499.0,63.0,135.0,2.0,76.0,9.0,29.0,499.0,137.0,4.0,499.0,63.0,135.0,2.0,76.0,1.0,18.0,0.0,9.0,160.0,499.0,7.0,59.0,10.0,43.0,77.0,88.0,499.0,499.0,4.0,499.0,77.0,58.0,499.0,386.0,9.0,160.0,499.0,7.0,59.0,10.0,43.0,77.0,88.0,499.0,499.0,4.0,499.0,77.0,58.0,499.0,386.0,1.0,11.0,0.0,6.0,65.0,6.0,112.0,22.0,499.0,10.0,12.0,499.0,499.0,6.0,65.0,6.0,112.0,22.0,499.0,10.0,12.0,499.0,499.0,1.0,10.0,0.0,12.0,499.0,92.0,499.0,31.0,8.0,499.0,499.0,300.0,12.0,499.0,92.0,499.0,31.0,8.0,499.0,499.0,300.0,1.0,12.0,0.0,55.0,25.0,499.0,499.0,60.0,499.0,499.0,32.0,8.0,244.0,499.0,55.0,25.0,499.0,499.0,60.0,499.0,499.0,32.0,8.0,244.0,499.0,1.0,21.0,0.0,499.0,29.0,8.0,499.0,499.0,19.0,8.0,242.0,499.0,499.0,15.0,2.0,499.0,93.0,11.0,174.0,61.0,90.0,374.0,499.0,499.0,29.0,8.0,499.0,499.0,19.0,8.0,242.0,499.0,499.0,15.0,2.0,499.0,93.0,11.0,174.0,61.0,90.0,374.0,499.0,1.0,9.0,0.0,85.0,49.0,56.0,46.0,499.0,499.0,20.0,499.0,85.0,49.0,56.0,46.0,499.0,499.0,20.0,499.0,1.0,18.0,0.0,499.0,59.0,499.0,10.0,499.0,19.0,424.0,7.0,499.0,8.0,499.0,499.0,4.0,499.0,70.0,499.0,211.0,499.0,59.0,499.0,10.0,499.0,19.0,424.0,7.0,499.0,8.0,499.0,499.0,4.0,499.0,70.0,499.0,211.0,1.0,18.0,0.0,72.0,388.0,424.0,4.0,499.0,8.0,499.0,499.0,23.0,424.0,499.0,69.0,43.0,15.0,2.0,499.0,499.0,72.0,388.0,424.0,4.0,499.0,8.0,499.0,499.0,23.0,424.0,499.0,69.0,43.0,15.0,2.0,499.0,499.0,1.0,30.0,0.0,30.0,499.0,2.0,499.0,10.0,8.0,447.0,211.0,253.0,32.0,46.0,499.0,175.0,211.0,499.0,15.0,7.0,499.0,73.0,2.0,464.0,25.0,147.0,3.0,17.0,499.0,499.0,19.0,499.0,30.0,499.0,2.0,499.0,10.0,8.0,447.0,211.0,253.0,32.0,46.0,499.0,175.0,211.0,499.0,15.0,7.0,499.0,73.0,2.0,464.0,25.0,147.0,3.0,17.0,499.0,499.0,19.0,499.0,1.0,20.0,0.0,499.0,9.0,75.0,147.0,3.0,17.0,499.0,499.0,2.0,499.0,211.0,499.0,33.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,9.0,75.0,147.0,3.0,17.0,499.0,499.0,2.0,499.0,211.0,499.0,33.0,499.0,499.0,499.0,15.0,499.0,499.0,1.0,28.0,0.0,6.0,499.0,332.0,265.0,31.0,30.0,68.0,11.0,271.0,31.0,253.0,8.0,499.0,93.0,33.0,135.0,11.0,346.0,499.0,61.0,7.0,36.0,499.0,499.0,11.0,19.0,499.0,6.0,499.0,332.0,265.0,31.0,30.0,68.0,11.0,271.0,31.0,253.0,8.0,499.0,93.0,33.0,135.0,11.0,346.0,499.0,61.0,7.0,36.0,499.0,499.0,11.0,19.0,499.0,1.0,11.0,0.0,53.0,6.0,60.0,51.0,4.0,21.0,20.0,208.0,31.0,11.0,53.0,6.0,60.0,51.0,4.0,21.0,20.0,208.0,31.0,11.0,1.0,39.0,0.0,6.0,3.0,71.0,27.0,99.0,4.0,335.0,11.0,4.0,499.0,33.0,162.0,25.0,499.0,11.0,499.0,40.0,38.0,3.0,17.0,350.0,499.0,10.0,79.0,11.0,499.0,4.0,21.0,499.0,7.0,38.0,3.0,17.0,178.0,73.0,20.0,146.0,219.0,6.0,3.0,71.0,27.0,99.0,4.0,335.0,11.0,4.0,499.0,33.0,162.0,25.0,499.0,11.0,499.0,40.0,38.0,3.0,17.0,350.0,499.0,10.0,79.0,11.0,499.0,4.0,21.0,499.0,7.0,38.0,3.0,17.0,178.0,73.0,20.0,146.0,219.0,1.0,21.0,0.0,499.0,499.0,499.0,62.0,499.0,4.0,2.0,499.0,3.0,18.0,499.0,93.0,499.0,499.0,4.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,499.0,62.0,499.0,4.0,2.0,499.0,3.0,18.0,499.0,93.0,499.0,499.0,4.0,499.0,499.0,499.0,2.0,499.0,1.0,13.0,0.0,499.0,2.0,499.0,150.0,499.0,207.0,157.0,4.0,39.0,499.0,16.0,499.0,499.0,2.0,499.0,150.0,499.0,207.0,157.0,4.0,39.0,499.0,16.0,499.0,1.0,32.0,0.0,2.0,232.0,12.0,207.0,499.0,106.0,499.0,15.0,499.0,10.0,106.0,200.0,499.0,16.0,77.0,58.0,499.0,2.0,499.0,150.0,499.0,499.0,66.0,499.0,8.0,389.0,499.0,4.0,21.0,15.0,499.0,2.0,232.0,12.0,207.0,499.0,106.0,499.0,15.0,499.0,10.0,106.0,200.0,499.0,16.0,77.0,58.0,499.0,2.0,499.0,150.0,499.0,499.0,66.0,499.0,8.0,389.0,499.0,4.0,21.0,15.0,499.0,1.0,18.0,0.0,141.0,419.0,106.0,499.0,9.0,217.0,31.0,24.0,116.0,62.0,305.0,12.0,24.0,499.0,106.0,4.0,499.0,141.0,419.0,106.0,499.0,9.0,217.0,31.0,24.0,116.0,62.0,305.0,12.0,24.0,499.0,106.0,4.0,499.0,1.0,5.0,0.0,6.0,416.0,24.0,51.0,6.0,416.0,24.0,51.0,1.0,30.0,0.0,394.0,12.0,499.0,397.0,499.0,2.0,499.0,433.0,4.0,70.0,499.0,499.0,4.0,499.0,244.0,499.0,499.0,10.0,499.0,15.0,2.0,499.0,7.0,12.0,3.0,18.0,499.0,27.0,499.0,394.0,12.0,499.0,397.0,499.0,2.0,499.0,433.0,4.0,70.0,499.0,499.0,4.0,499.0,244.0,499.0,499.0,10.0,499.0,15.0,2.0,499.0,7.0,12.0,3.0,18.0,499.0,27.0,499.0,1.0,9.0,0.0,6.0,65.0,11.0,366.0,21.0,499.0,39.0,124.0,6.0,65.0,11.0,366.0,21.0,499.0,39.0,124.0,1.0,13.0,0.0,8.0,302.0,16.0,8.0,499.0,84.0,499.0,11.0,4.0,472.0,87.0,499.0,8.0,302.0,16.0,8.0,499.0,84.0,499.0,11.0,4.0,472.0,87.0,499.0,1.0,22.0,0.0,27.0,137.0,188.0,263.0,499.0,45.0,3.0,18.0,219.0,499.0,19.0,42.0,4.0,122.0,499.0,499.0,84.0,267.0,73.0,15.0,499.0,27.0,137.0,188.0,263.0,499.0,45.0,3.0,18.0,219.0,499.0,19.0,42.0,4.0,122.0,499.0,499.0,84.0,267.0,73.0,15.0,499.0,1.0,46.0,0.0,6.0,3.0,71.0,27.0,499.0,20.0,499.0,499.0,33.0,76.0,42.0,66.0,499.0,4.0,472.0,6.0,3.0,71.0,499.0,20.0,42.0,66.0,186.0,3.0,17.0,499.0,178.0,76.0,3.0,18.0,499.0,37.0,340.0,52.0,24.0,50.0,499.0,25.0,45.0,3.0,18.0,8.0,302.0,37.0,495.0,6.0,3.0,71.0,27.0,499.0,20.0,499.0,499.0,33.0,76.0,42.0,66.0,499.0,4.0,472.0,6.0,3.0,71.0,499.0,20.0,42.0,66.0,186.0,3.0,17.0,499.0,178.0,76.0,3.0,18.0,499.0,37.0,340.0,52.0,24.0,50.0,499.0,25.0,45.0,3.0,18.0,8.0,302.0,37.0,495.0,1.0,10.0,0.0,2.0,499.0,16.0,499.0,58.0,499.0,69.0,2.0,499.0,2.0,499.0,16.0,499.0,58.0,499.0,69.0,2.0,499.0,1.0,18.0,0.0,345.0,11.0,19.0,2.0,499.0,499.0,6.0,60.0,31.0,4.0,499.0,19.0,2.0,499.0,499.0,342.0,499.0,345.0,11.0,19.0,2.0,499.0,499.0,6.0,60.0,31.0,4.0,499.0,19.0,2.0,499.0,499.0,342.0,499.0,1.0,25.0,0.0,6.0,341.0,9.0,37.0,39.0,339.0,499.0,25.0,338.0,3.0,17.0,81.0,173.0,4.0,50.0,9.0,499.0,6.0,345.0,11.0,196.0,19.0,30.0,499.0,6.0,341.0,9.0,37.0,39.0,339.0,499.0,25.0,338.0,3.0,17.0,81.0,173.0,4.0,50.0,9.0,499.0,6.0,345.0,11.0,196.0,19.0,30.0,499.0,1.0,4.0,0.0,96.0,499.0,499.0,96.0,499.0,499.0,1.0,99.0,0.0,478.0,499.0,7.0,22.0,499.0,44.0,499.0,275.0,19.0,2.0,194.0,242.0,237.0,499.0,159.0,499.0,56.0,81.0,499.0,334.0,2.0,499.0,7.0,93.0,7.0,6.0,95.0,55.0,499.0,37.0,44.0,27.0,4.0,499.0,371.0,170.0,47.0,38.0,3.0,17.0,22.0,70.0,317.0,499.0,499.0,15.0,134.0,259.0,76.0,85.0,499.0,84.0,6.0,38.0,3.0,17.0,92.0,499.0,7.0,499.0,66.0,47.0,3.0,109.0,116.0,156.0,32.0,378.0,499.0,499.0,3.0,17.0,77.0,81.0,12.0,96.0,15.0,2.0,499.0,499.0,41.0,108.0,178.0,371.0,499.0,10.0,8.0,499.0,430.0,15.0,2.0,499.0,499.0,31.0,499.0,16.0,499.0,67.0,478.0,499.0,7.0,22.0,499.0,44.0,499.0,275.0,19.0,2.0,194.0,242.0,237.0,499.0,159.0,499.0,56.0,81.0,499.0,334.0,2.0,499.0,7.0,93.0,7.0,6.0,95.0,55.0,499.0,37.0,44.0,27.0,4.0,499.0,371.0,170.0,47.0,38.0,3.0,17.0,22.0,70.0,317.0,499.0,499.0,15.0,134.0,259.0,76.0,85.0,499.0,84.0,6.0,38.0,3.0,17.0,92.0,499.0,7.0,499.0,66.0,47.0,3.0,109.0,116.0,156.0,32.0,378.0,499.0,499.0,3.0,17.0,77.0,81.0,12.0,96.0,15.0,2.0,499.0,499.0,41.0,108.0,178.0,371.0,499.0,10.0,8.0,499.0,430.0,15.0,2.0,499.0,499.0,31.0,499.0,16.0,499.0,67.0,1.0,37.0,0.0,47.0,38.0,3.0,17.0,22.0,8.0,296.0,378.0,15.0,2.0,499.0,72.0,499.0,7.0,499.0,66.0,202.0,3.0,17.0,148.0,97.0,15.0,8.0,499.0,499.0,194.0,499.0,41.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,499.0,47.0,38.0,3.0,17.0,22.0,8.0,296.0,378.0,15.0,2.0,499.0,72.0,499.0,7.0,499.0,66.0,202.0,3.0,17.0,148.0,97.0,15.0,8.0,499.0,499.0,194.0,499.0,41.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,499.0,1.0,8.0,0.0,6.0,3.0,71.0,27.0,299.0,499.0,100.0,6.0,3.0,71.0,27.0,299.0,499.0,100.0,1.0,46.0,0.0,6.0,406.0,12.0,134.0,499.0,499.0,3.0,17.0,81.0,12.0,96.0,12.0,3.0,18.0,108.0,6.0,38.0,3.0,17.0,50.0,108.0,47.0,38.0,3.0,17.0,118.0,499.0,159.0,499.0,12.0,3.0,18.0,108.0,6.0,186.0,3.0,17.0,118.0,499.0,499.0,256.0,31.0,499.0,7.0,499.0,6.0,406.0,12.0,134.0,499.0,499.0,3.0,17.0,81.0,12.0,96.0,12.0,3.0,18.0,108.0,6.0,38.0,3.0,17.0,50.0,108.0,47.0,38.0,3.0,17.0,118.0,499.0,159.0,499.0,12.0,3.0,18.0,108.0,6.0,186.0,3.0,17.0,118.0,499.0,499.0,256.0,31.0,499.0,7.0,499.0,1.0,52.0,0.0,164.0,499.0,28.0,499.0,411.0,47.0,163.0,3.0,17.0,499.0,26.0,47.0,38.0,3.0,17.0,225.0,43.0,41.0,26.0,11.0,104.0,4.0,499.0,20.0,76.0,256.0,6.0,60.0,151.0,118.0,58.0,499.0,256.0,7.0,27.0,256.0,66.0,341.0,20.0,307.0,76.0,93.0,306.0,10.0,98.0,212.0,31.0,499.0,499.0,7.0,499.0,164.0,499.0,28.0,499.0,411.0,47.0,163.0,3.0,17.0,499.0,26.0,47.0,38.0,3.0,17.0,225.0,43.0,41.0,26.0,11.0,104.0,4.0,499.0,20.0,76.0,256.0,6.0,60.0,151.0,118.0,58.0,499.0,256.0,7.0,27.0,256.0,66.0,341.0,20.0,307.0,76.0,93.0,306.0,10.0,98.0,212.0,31.0,499.0,499.0,7.0,499.0,1.0,10.0,0.0,38.0,3.0,17.0,40.0,143.0,43.0,93.0,5.0,135.0,38.0,3.0,17.0,40.0,143.0,43.0,93.0,5.0,135.0,1.0,24.0,0.0,6.0,143.0,499.0,93.0,99.0,61.0,7.0,499.0,23.0,2.0,246.0,171.0,7.0,39.0,499.0,22.0,151.0,81.0,499.0,7.0,39.0,499.0,499.0,6.0,143.0,499.0,93.0,99.0,61.0,7.0,499.0,23.0,2.0,246.0,171.0,7.0,39.0,499.0,22.0,151.0,81.0,499.0,7.0,39.0,499.0,499.0,1.0,7.0,0.0,183.0,34.0,21.0,224.0,23.0,499.0,183.0,34.0,21.0,224.0,23.0,499.0,1.0,5.0,0.0,499.0,5.0,5.0,80.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,47.0,0.0,35.0,26.0,11.0,92.0,499.0,143.0,59.0,15.0,20.0,11.0,2.0,499.0,499.0,72.0,56.0,119.0,499.0,15.0,9.0,44.0,10.0,2.0,499.0,28.0,499.0,86.0,164.0,119.0,499.0,41.0,9.0,3.0,18.0,437.0,499.0,4.0,50.0,43.0,86.0,499.0,69.0,137.0,44.0,2.0,499.0,499.0,35.0,26.0,11.0,92.0,499.0,143.0,59.0,15.0,20.0,11.0,2.0,499.0,499.0,72.0,56.0,119.0,499.0,15.0,9.0,44.0,10.0,2.0,499.0,28.0,499.0,86.0,164.0,119.0,499.0,41.0,9.0,3.0,18.0,437.0,499.0,4.0,50.0,43.0,86.0,499.0,69.0,137.0,44.0,2.0,499.0,499.0,1.0,24.0,0.0,89.0,441.0,499.0,45.0,16.0,499.0,32.0,6.0,499.0,4.0,52.0,6.0,150.0,499.0,262.0,15.0,499.0,84.0,16.0,53.0,6.0,499.0,4.0,89.0,441.0,499.0,45.0,16.0,499.0,32.0,6.0,499.0,4.0,52.0,6.0,150.0,499.0,262.0,15.0,499.0,84.0,16.0,53.0,6.0,499.0,4.0,1.0,97.0,0.0,6.0,499.0,61.0,2.0,14.0,499.0,14.0,10.0,2.0,118.0,10.0,499.0,499.0,499.0,499.0,30.0,138.0,3.0,17.0,499.0,9.0,3.0,18.0,446.0,7.0,41.0,499.0,41.0,42.0,38.0,3.0,17.0,22.0,189.0,499.0,8.0,499.0,163.0,3.0,17.0,118.0,2.0,144.0,499.0,4.0,499.0,4.0,499.0,26.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,499.0,3.0,54.0,226.0,23.0,8.0,499.0,64.0,457.0,499.0,237.0,499.0,32.0,26.0,9.0,131.0,8.0,374.0,499.0,6.0,499.0,61.0,2.0,14.0,499.0,14.0,10.0,2.0,118.0,10.0,499.0,499.0,499.0,499.0,30.0,138.0,3.0,17.0,499.0,9.0,3.0,18.0,446.0,7.0,41.0,499.0,41.0,42.0,38.0,3.0,17.0,22.0,189.0,499.0,8.0,499.0,163.0,3.0,17.0,118.0,2.0,144.0,499.0,4.0,499.0,4.0,499.0,26.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,9.0,16.0,499.0,4.0,123.0,499.0,163.0,3.0,17.0,499.0,23.0,8.0,499.0,499.0,499.0,3.0,54.0,226.0,23.0,8.0,499.0,64.0,457.0,499.0,237.0,499.0,32.0,26.0,9.0,131.0,8.0,374.0,499.0,1.0,12.0,0.0,7.0,11.0,22.0,187.0,499.0,53.0,6.0,499.0,7.0,39.0,124.0,7.0,11.0,22.0,187.0,499.0,53.0,6.0,499.0,7.0,39.0,124.0,1.0,21.0,0.0,89.0,6.0,3.0,110.0,92.0,31.0,4.0,95.0,26.0,203.0,56.0,260.0,199.0,9.0,100.0,3.0,499.0,5.0,5.0,499.0,89.0,6.0,3.0,110.0,92.0,31.0,4.0,95.0,26.0,203.0,56.0,260.0,199.0,9.0,100.0,3.0,499.0,5.0,5.0,499.0,1.0,76.0,0.0,35.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,468.0,13.0,499.0,13.0,499.0,5.0,8.0,276.0,180.0,8.0,499.0,499.0,90.0,499.0,3.0,18.0,499.0,473.0,46.0,499.0,3.0,18.0,499.0,29.0,499.0,499.0,68.0,2.0,499.0,202.0,3.0,17.0,22.0,499.0,477.0,4.0,499.0,90.0,499.0,89.0,25.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,88.0,499.0,499.0,499.0,153.0,354.0,499.0,477.0,499.0,499.0,33.0,499.0,499.0,35.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,468.0,13.0,499.0,13.0,499.0,5.0,8.0,276.0,180.0,8.0,499.0,499.0,90.0,499.0,3.0,18.0,499.0,473.0,46.0,499.0,3.0,18.0,499.0,29.0,499.0,499.0,68.0,2.0,499.0,202.0,3.0,17.0,22.0,499.0,477.0,4.0,499.0,90.0,499.0,89.0,25.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,88.0,499.0,499.0,499.0,153.0,354.0,499.0,477.0,499.0,499.0,33.0,499.0,499.0,1.0,30.0,0.0,68.0,499.0,499.0,499.0,499.0,499.0,499.0,4.0,264.0,2.0,499.0,499.0,88.0,8.0,499.0,499.0,12.0,499.0,29.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,86.0,90.0,499.0,68.0,499.0,499.0,499.0,499.0,499.0,499.0,4.0,264.0,2.0,499.0,499.0,88.0,8.0,499.0,499.0,12.0,499.0,29.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,86.0,90.0,499.0,1.0,68.0,0.0,499.0,499.0,3.0,499.0,273.0,499.0,499.0,55.0,499.0,499.0,499.0,60.0,22.0,4.0,21.0,499.0,7.0,30.0,60.0,21.0,155.0,390.0,499.0,52.0,49.0,268.0,3.0,17.0,136.0,499.0,32.0,397.0,499.0,25.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,61.0,499.0,101.0,69.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,278.0,2.0,499.0,499.0,61.0,10.0,43.0,214.0,32.0,96.0,32.0,499.0,499.0,499.0,499.0,3.0,499.0,273.0,499.0,499.0,55.0,499.0,499.0,499.0,60.0,22.0,4.0,21.0,499.0,7.0,30.0,60.0,21.0,155.0,390.0,499.0,52.0,49.0,268.0,3.0,17.0,136.0,499.0,32.0,397.0,499.0,25.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,61.0,499.0,101.0,69.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,203.0,499.0,278.0,2.0,499.0,499.0,61.0,10.0,43.0,214.0,32.0,96.0,32.0,499.0,499.0,1.0,13.0,0.0,6.0,38.0,3.0,17.0,95.0,146.0,31.0,12.0,23.0,2.0,499.0,499.0,6.0,38.0,3.0,17.0,95.0,146.0,31.0,12.0,23.0,2.0,499.0,499.0,1.0,14.0,0.0,147.0,3.0,17.0,130.0,154.0,27.0,45.0,25.0,6.0,160.0,499.0,10.0,9.0,147.0,3.0,17.0,130.0,154.0,27.0,45.0,25.0,6.0,160.0,499.0,10.0,9.0,1.0,26.0,0.0,2.0,155.0,499.0,499.0,22.0,7.0,499.0,499.0,15.0,2.0,499.0,12.0,34.0,21.0,199.0,19.0,344.0,499.0,499.0,31.0,8.0,499.0,499.0,33.0,499.0,2.0,155.0,499.0,499.0,22.0,7.0,499.0,499.0,15.0,2.0,499.0,12.0,34.0,21.0,199.0,19.0,344.0,499.0,499.0,31.0,8.0,499.0,499.0,33.0,499.0,1.0,10.0,0.0,499.0,8.0,499.0,499.0,138.0,3.0,17.0,87.0,499.0,499.0,8.0,499.0,499.0,138.0,3.0,17.0,87.0,499.0,1.0,14.0,0.0,28.0,11.0,199.0,4.0,499.0,23.0,499.0,33.0,20.0,499.0,499.0,37.0,499.0,28.0,11.0,199.0,4.0,499.0,23.0,499.0,33.0,20.0,499.0,499.0,37.0,499.0,1.0,15.0,0.0,6.0,65.0,14.0,71.0,14.0,16.0,63.0,10.0,2.0,103.0,494.0,499.0,271.0,499.0,6.0,65.0,14.0,71.0,14.0,16.0,63.0,10.0,2.0,103.0,494.0,499.0,271.0,499.0,1.0,22.0,0.0,499.0,499.0,92.0,206.0,499.0,118.0,10.0,271.0,499.0,19.0,8.0,499.0,66.0,88.0,499.0,479.0,499.0,499.0,37.0,2.0,121.0,499.0,499.0,92.0,206.0,499.0,118.0,10.0,271.0,499.0,19.0,8.0,499.0,66.0,88.0,499.0,479.0,499.0,499.0,37.0,2.0,121.0,1.0,22.0,0.0,102.0,10.0,2.0,359.0,16.0,187.0,499.0,84.0,499.0,4.0,2.0,499.0,19.0,67.0,7.0,2.0,499.0,12.0,2.0,359.0,499.0,102.0,10.0,2.0,359.0,16.0,187.0,499.0,84.0,499.0,4.0,2.0,499.0,19.0,67.0,7.0,2.0,499.0,12.0,2.0,359.0,499.0,1.0,17.0,0.0,45.0,3.0,18.0,160.0,92.0,8.0,499.0,271.0,499.0,176.0,499.0,10.0,499.0,16.0,499.0,411.0,45.0,3.0,18.0,160.0,92.0,8.0,499.0,271.0,499.0,176.0,499.0,10.0,499.0,16.0,499.0,411.0,1.0,12.0,0.0,77.0,499.0,499.0,3.0,18.0,499.0,16.0,499.0,4.0,2.0,499.0,77.0,499.0,499.0,3.0,18.0,499.0,16.0,499.0,4.0,2.0,499.0,1.0,14.0,0.0,30.0,16.0,499.0,32.0,9.0,16.0,224.0,499.0,10.0,5.0,94.0,5.0,499.0,30.0,16.0,499.0,32.0,9.0,16.0,224.0,499.0,10.0,5.0,94.0,5.0,499.0,1.0,5.0,0.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,30.0,115.0,147.0,3.0,17.0,499.0,499.0,2.0,144.0,117.0,30.0,115.0,147.0,3.0,17.0,499.0,499.0,2.0,144.0,117.0,1.0,18.0,0.0,7.0,170.0,11.0,160.0,316.0,74.0,4.0,22.0,499.0,36.0,499.0,28.0,196.0,499.0,7.0,499.0,499.0,7.0,170.0,11.0,160.0,316.0,74.0,4.0,22.0,499.0,36.0,499.0,28.0,196.0,499.0,7.0,499.0,499.0,1.0,18.0,0.0,108.0,38.0,3.0,17.0,11.0,316.0,74.0,19.0,499.0,305.0,284.0,4.0,36.0,499.0,3.0,18.0,499.0,108.0,38.0,3.0,17.0,11.0,316.0,74.0,19.0,499.0,305.0,284.0,4.0,36.0,499.0,3.0,18.0,499.0,1.0,10.0,0.0,499.0,448.0,4.0,499.0,39.0,499.0,16.0,87.0,218.0,499.0,448.0,4.0,499.0,39.0,499.0,16.0,87.0,218.0,1.0,24.0,0.0,2.0,83.0,16.0,87.0,96.0,25.0,2.0,499.0,10.0,9.0,147.0,3.0,17.0,499.0,4.0,499.0,499.0,4.0,2.0,499.0,33.0,2.0,499.0,2.0,83.0,16.0,87.0,96.0,25.0,2.0,499.0,10.0,9.0,147.0,3.0,17.0,499.0,4.0,499.0,499.0,4.0,2.0,499.0,33.0,2.0,499.0,1.0,24.0,0.0,84.0,16.0,8.0,499.0,10.0,2.0,83.0,32.0,9.0,147.0,3.0,17.0,499.0,11.0,15.0,83.0,20.0,146.0,19.0,499.0,499.0,499.0,499.0,84.0,16.0,8.0,499.0,10.0,2.0,83.0,32.0,9.0,147.0,3.0,17.0,499.0,11.0,15.0,83.0,20.0,146.0,19.0,499.0,499.0,499.0,499.0,1.0,49.0,0.0,41.0,60.0,9.0,499.0,21.0,499.0,4.0,499.0,171.0,44.0,134.0,499.0,499.0,23.0,499.0,499.0,334.0,2.0,499.0,7.0,85.0,118.0,12.0,144.0,499.0,499.0,20.0,2.0,499.0,334.0,2.0,499.0,5.0,499.0,499.0,170.0,9.0,3.0,18.0,2.0,155.0,499.0,499.0,12.0,60.0,21.0,499.0,126.0,41.0,60.0,9.0,499.0,21.0,499.0,4.0,499.0,171.0,44.0,134.0,499.0,499.0,23.0,499.0,499.0,334.0,2.0,499.0,7.0,85.0,118.0,12.0,144.0,499.0,499.0,20.0,2.0,499.0,334.0,2.0,499.0,5.0,499.0,499.0,170.0,9.0,3.0,18.0,2.0,155.0,499.0,499.0,12.0,60.0,21.0,499.0,126.0,1.0,9.0,0.0,6.0,435.0,499.0,7.0,499.0,5.0,5.0,499.0,6.0,435.0,499.0,7.0,499.0,5.0,5.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,74.0,499.0,499.0,35.0,5.0,499.0,74.0,499.0,499.0,1.0,25.0,0.0,46.0,499.0,220.0,7.0,8.0,87.0,499.0,499.0,10.0,2.0,499.0,10.0,499.0,499.0,15.0,248.0,499.0,499.0,499.0,15.0,499.0,5.0,5.0,499.0,46.0,499.0,220.0,7.0,8.0,87.0,499.0,499.0,10.0,2.0,499.0,10.0,499.0,499.0,15.0,248.0,499.0,499.0,499.0,15.0,499.0,5.0,5.0,499.0,1.0,19.0,0.0,35.0,5.0,499.0,16.0,75.0,87.0,96.0,25.0,499.0,58.0,23.0,499.0,10.0,499.0,427.0,69.0,499.0,499.0,35.0,5.0,499.0,16.0,75.0,87.0,96.0,25.0,499.0,58.0,23.0,499.0,10.0,499.0,427.0,69.0,499.0,499.0,1.0,2.0,0.0,55.0,55.0,1.0,20.0,0.0,499.0,56.0,58.0,287.0,15.0,499.0,69.0,499.0,288.0,499.0,287.0,34.0,122.0,58.0,384.0,69.0,499.0,8.0,287.0,499.0,56.0,58.0,287.0,15.0,499.0,69.0,499.0,288.0,499.0,287.0,34.0,122.0,58.0,384.0,69.0,499.0,8.0,287.0,1.0,22.0,0.0,499.0,62.0,72.0,350.0,154.0,499.0,499.0,499.0,26.0,44.0,499.0,287.0,350.0,7.0,44.0,499.0,287.0,499.0,499.0,5.0,499.0,499.0,62.0,72.0,350.0,154.0,499.0,499.0,499.0,26.0,44.0,499.0,287.0,350.0,7.0,44.0,499.0,287.0,499.0,499.0,5.0,499.0,1.0,3.0,0.0,41.0,55.0,41.0,55.0,1.0,5.0,0.0,393.0,332.0,48.0,499.0,393.0,332.0,48.0,499.0,1.0,15.0,0.0,51.0,12.0,19.0,8.0,242.0,418.0,85.0,11.0,3.0,109.0,22.0,8.0,101.0,458.0,51.0,12.0,19.0,8.0,242.0,418.0,85.0,11.0,3.0,109.0,22.0,8.0,101.0,458.0,1.0,11.0,0.0,42.0,38.0,3.0,17.0,40.0,499.0,43.0,153.0,499.0,146.0,42.0,38.0,3.0,17.0,40.0,499.0,43.0,153.0,499.0,146.0,1.0,16.0,0.0,47.0,50.0,86.0,9.0,135.0,418.0,10.0,332.0,48.0,414.0,201.0,499.0,332.0,499.0,410.0,47.0,50.0,86.0,9.0,135.0,418.0,10.0,332.0,48.0,414.0,201.0,499.0,332.0,499.0,410.0,1.0,5.0,0.0,393.0,499.0,12.0,499.0,393.0,499.0,12.0,499.0,1.0,3.0,0.0,499.0,55.0,499.0,55.0,1.0,9.0,0.0,12.0,3.0,18.0,27.0,2.0,117.0,499.0,181.0,12.0,3.0,18.0,27.0,2.0,117.0,499.0,181.0,1.0,32.0,0.0,11.0,38.0,3.0,17.0,499.0,208.0,66.0,56.0,55.0,499.0,7.0,85.0,499.0,12.0,49.0,3.0,109.0,499.0,61.0,8.0,117.0,4.0,50.0,9.0,479.0,499.0,49.0,3.0,18.0,15.0,499.0,11.0,38.0,3.0,17.0,499.0,208.0,66.0,56.0,55.0,499.0,7.0,85.0,499.0,12.0,49.0,3.0,109.0,499.0,61.0,8.0,117.0,4.0,50.0,9.0,479.0,499.0,49.0,3.0,18.0,15.0,499.0,1.0,26.0,0.0,11.0,3.0,54.0,397.0,499.0,208.0,23.0,8.0,499.0,24.0,241.0,33.0,241.0,27.0,240.0,84.0,6.0,421.0,29.0,53.0,499.0,3.0,499.0,29.0,473.0,11.0,3.0,54.0,397.0,499.0,208.0,23.0,8.0,499.0,24.0,241.0,33.0,241.0,27.0,240.0,84.0,6.0,421.0,29.0,53.0,499.0,3.0,499.0,29.0,473.0,1.0,18.0,0.0,37.0,236.0,499.0,31.0,499.0,33.0,499.0,22.0,2.0,499.0,499.0,4.0,50.0,53.0,24.0,123.0,479.0,37.0,236.0,499.0,31.0,499.0,33.0,499.0,22.0,2.0,499.0,499.0,4.0,50.0,53.0,24.0,123.0,479.0,1.0,12.0,0.0,6.0,65.0,30.0,16.0,114.0,12.0,499.0,8.0,177.0,10.0,42.0,6.0,65.0,30.0,16.0,114.0,12.0,499.0,8.0,177.0,10.0,42.0,1.0,36.0,0.0,9.0,3.0,18.0,27.0,48.0,66.0,29.0,15.0,2.0,107.0,33.0,66.0,29.0,15.0,2.0,499.0,9.0,403.0,171.0,4.0,381.0,499.0,499.0,7.0,99.0,499.0,15.0,63.0,499.0,37.0,2.0,267.0,10.0,2.0,145.0,9.0,3.0,18.0,27.0,48.0,66.0,29.0,15.0,2.0,107.0,33.0,66.0,29.0,15.0,2.0,499.0,9.0,403.0,171.0,4.0,381.0,499.0,499.0,7.0,99.0,499.0,15.0,63.0,499.0,37.0,2.0,267.0,10.0,2.0,145.0,1.0,7.0,0.0,6.0,186.0,3.0,17.0,123.0,499.0,6.0,186.0,3.0,17.0,123.0,499.0,1.0,9.0,0.0,9.0,34.0,235.0,20.0,44.0,76.0,499.0,499.0,9.0,34.0,235.0,20.0,44.0,76.0,499.0,499.0,1.0,6.0,0.0,499.0,290.0,5.0,5.0,204.0,499.0,290.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,25.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,64.0,499.0,499.0,463.0,499.0,20.0,8.0,319.0,499.0,499.0,499.0,499.0,64.0,499.0,499.0,499.0,20.0,43.0,35.0,5.0,140.0,5.0,499.0,499.0,64.0,499.0,499.0,463.0,499.0,20.0,8.0,319.0,499.0,499.0,499.0,499.0,64.0,499.0,499.0,499.0,20.0,43.0,1.0,28.0,0.0,41.0,499.0,36.0,499.0,74.0,499.0,499.0,499.0,20.0,499.0,11.0,3.0,54.0,499.0,499.0,499.0,36.0,499.0,499.0,58.0,499.0,15.0,499.0,499.0,74.0,11.0,499.0,41.0,499.0,36.0,499.0,74.0,499.0,499.0,499.0,20.0,499.0,11.0,3.0,54.0,499.0,499.0,499.0,36.0,499.0,499.0,58.0,499.0,15.0,499.0,499.0,74.0,11.0,499.0,1.0,13.0,0.0,24.0,62.0,143.0,72.0,63.0,499.0,4.0,499.0,499.0,15.0,57.0,499.0,24.0,62.0,143.0,72.0,63.0,499.0,4.0,499.0,499.0,15.0,57.0,499.0,1.0,15.0,0.0,499.0,499.0,499.0,75.0,499.0,43.0,499.0,32.0,26.0,24.0,88.0,295.0,81.0,499.0,499.0,499.0,499.0,75.0,499.0,43.0,499.0,32.0,26.0,24.0,88.0,295.0,81.0,499.0,1.0,23.0,0.0,499.0,52.0,11.0,499.0,8.0,310.0,499.0,4.0,46.0,499.0,499.0,74.0,11.0,499.0,15.0,12.0,310.0,62.0,194.0,15.0,499.0,499.0,499.0,52.0,11.0,499.0,8.0,310.0,499.0,4.0,46.0,499.0,499.0,74.0,11.0,499.0,15.0,12.0,310.0,62.0,194.0,15.0,499.0,499.0,1.0,10.0,0.0,75.0,2.0,310.0,62.0,350.0,499.0,499.0,499.0,499.0,75.0,2.0,310.0,62.0,350.0,499.0,499.0,499.0,499.0,1.0,4.0,0.0,249.0,12.0,497.0,249.0,12.0,497.0,1.0,26.0,0.0,324.0,9.0,3.0,18.0,40.0,67.0,136.0,499.0,499.0,499.0,9.0,16.0,25.0,6.0,151.0,499.0,2.0,499.0,15.0,12.0,497.0,499.0,9.0,4.0,499.0,324.0,9.0,3.0,18.0,40.0,67.0,136.0,499.0,499.0,499.0,9.0,16.0,25.0,6.0,151.0,499.0,2.0,499.0,15.0,12.0,497.0,499.0,9.0,4.0,499.0,1.0,29.0,0.0,33.0,77.0,9.0,3.0,18.0,8.0,499.0,13.0,303.0,139.0,7.0,2.0,9.0,3.0,18.0,2.0,499.0,10.0,499.0,499.0,12.0,3.0,18.0,189.0,7.0,488.0,4.0,475.0,33.0,77.0,9.0,3.0,18.0,8.0,499.0,13.0,303.0,139.0,7.0,2.0,9.0,3.0,18.0,2.0,499.0,10.0,499.0,499.0,12.0,3.0,18.0,189.0,7.0,488.0,4.0,475.0,1.0,7.0,0.0,6.0,31.0,4.0,65.0,105.0,102.0,6.0,31.0,4.0,65.0,105.0,102.0,1.0,11.0,0.0,19.0,59.0,42.0,9.0,14.0,16.0,14.0,8.0,499.0,499.0,19.0,59.0,42.0,9.0,14.0,16.0,14.0,8.0,499.0,499.0,1.0,50.0,0.0,59.0,42.0,22.0,499.0,12.0,28.0,499.0,74.0,57.0,499.0,15.0,2.0,499.0,499.0,16.0,8.0,499.0,499.0,12.0,6.0,38.0,3.0,17.0,65.0,499.0,4.0,103.0,10.0,43.0,84.0,241.0,21.0,499.0,25.0,28.0,499.0,19.0,103.0,152.0,499.0,16.0,499.0,48.0,2.0,499.0,10.0,2.0,499.0,499.0,59.0,42.0,22.0,499.0,12.0,28.0,499.0,74.0,57.0,499.0,15.0,2.0,499.0,499.0,16.0,8.0,499.0,499.0,12.0,6.0,38.0,3.0,17.0,65.0,499.0,4.0,103.0,10.0,43.0,84.0,241.0,21.0,499.0,25.0,28.0,499.0,19.0,103.0,152.0,499.0,16.0,499.0,48.0,2.0,499.0,10.0,2.0,499.0,499.0,1.0,7.0,0.0,100.0,3.0,18.0,8.0,499.0,499.0,100.0,3.0,18.0,8.0,499.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,80.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,290.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,499.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,15.0,0.0,35.0,5.0,446.0,5.0,499.0,5.0,11.0,13.0,499.0,13.0,50.0,13.0,499.0,5.0,35.0,5.0,446.0,5.0,499.0,5.0,11.0,13.0,499.0,13.0,50.0,13.0,499.0,5.0,1.0,15.0,0.0,49.0,3.0,18.0,161.0,87.0,252.0,4.0,148.0,32.0,26.0,11.0,313.0,2.0,83.0,49.0,3.0,18.0,161.0,87.0,252.0,4.0,148.0,32.0,26.0,11.0,313.0,2.0,83.0,1.0,34.0,0.0,49.0,75.0,56.0,499.0,25.0,42.0,31.0,227.0,28.0,105.0,499.0,4.0,499.0,12.0,61.0,7.0,306.0,40.0,123.0,49.0,3.0,18.0,499.0,499.0,40.0,68.0,11.0,499.0,178.0,70.0,421.0,86.0,9.0,49.0,75.0,56.0,499.0,25.0,42.0,31.0,227.0,28.0,105.0,499.0,4.0,499.0,12.0,61.0,7.0,306.0,40.0,123.0,49.0,3.0,18.0,499.0,499.0,40.0,68.0,11.0,499.0,178.0,70.0,421.0,86.0,9.0,1.0,14.0,0.0,499.0,16.0,499.0,16.0,97.0,499.0,49.0,3.0,18.0,40.0,320.0,7.0,499.0,499.0,16.0,499.0,16.0,97.0,499.0,49.0,3.0,18.0,40.0,320.0,7.0,499.0,1.0,25.0,0.0,499.0,108.0,49.0,3.0,18.0,194.0,23.0,2.0,499.0,499.0,68.0,49.0,499.0,499.0,4.0,2.0,83.0,7.0,27.0,192.0,42.0,148.0,30.0,499.0,499.0,108.0,49.0,3.0,18.0,194.0,23.0,2.0,499.0,499.0,68.0,49.0,499.0,499.0,4.0,2.0,83.0,7.0,27.0,192.0,42.0,148.0,30.0,499.0,1.0,23.0,0.0,2.0,139.0,16.0,12.0,499.0,13.0,449.0,499.0,499.0,3.0,17.0,92.0,70.0,205.0,69.0,2.0,231.0,13.0,449.0,499.0,24.0,499.0,2.0,139.0,16.0,12.0,499.0,13.0,449.0,499.0,499.0,3.0,17.0,92.0,70.0,205.0,69.0,2.0,231.0,13.0,449.0,499.0,24.0,499.0,1.0,31.0,0.0,24.0,40.0,499.0,2.0,231.0,13.0,449.0,499.0,8.0,258.0,7.0,499.0,2.0,499.0,499.0,499.0,281.0,31.0,499.0,499.0,33.0,8.0,231.0,499.0,303.0,19.0,499.0,13.0,449.0,306.0,24.0,40.0,499.0,2.0,231.0,13.0,449.0,499.0,8.0,258.0,7.0,499.0,2.0,499.0,499.0,499.0,281.0,31.0,499.0,499.0,33.0,8.0,231.0,499.0,303.0,19.0,499.0,13.0,449.0,306.0,1.0,20.0,0.0,2.0,499.0,256.0,499.0,4.0,30.0,194.0,499.0,7.0,88.0,55.0,499.0,20.0,9.0,52.0,9.0,29.0,341.0,191.0,2.0,499.0,256.0,499.0,4.0,30.0,194.0,499.0,7.0,88.0,55.0,499.0,20.0,9.0,52.0,9.0,29.0,341.0,191.0,1.0,6.0,0.0,9.0,397.0,499.0,499.0,273.0,9.0,397.0,499.0,499.0,273.0,1.0,6.0,0.0,499.0,5.0,499.0,19.0,499.0,499.0,5.0,499.0,19.0,499.0,1.0,6.0,0.0,499.0,16.0,499.0,273.0,499.0,499.0,16.0,499.0,273.0,499.0,1.0,10.0,0.0,7.0,499.0,16.0,499.0,34.0,148.0,23.0,9.0,190.0,7.0,499.0,16.0,499.0,34.0,148.0,23.0,9.0,190.0,1.0,4.0,0.0,9.0,329.0,61.0,9.0,329.0,61.0,1.0,25.0,0.0,7.0,36.0,499.0,259.0,56.0,499.0,39.0,499.0,259.0,23.0,499.0,15.0,2.0,499.0,41.0,6.0,65.0,499.0,7.0,499.0,62.0,21.0,218.0,499.0,7.0,36.0,499.0,259.0,56.0,499.0,39.0,499.0,259.0,23.0,499.0,15.0,2.0,499.0,41.0,6.0,65.0,499.0,7.0,499.0,62.0,21.0,218.0,499.0,1.0,31.0,0.0,499.0,25.0,26.0,9.0,213.0,499.0,391.0,10.0,165.0,499.0,84.0,9.0,62.0,85.0,26.0,11.0,338.0,3.0,17.0,163.0,2.0,83.0,20.0,12.0,499.0,11.0,62.0,225.0,20.0,499.0,499.0,25.0,26.0,9.0,213.0,499.0,391.0,10.0,165.0,499.0,84.0,9.0,62.0,85.0,26.0,11.0,338.0,3.0,17.0,163.0,2.0,83.0,20.0,12.0,499.0,11.0,62.0,225.0,20.0,499.0,1.0,15.0,0.0,9.0,499.0,105.0,499.0,45.0,268.0,3.0,17.0,192.0,499.0,4.0,27.0,51.0,9.0,9.0,499.0,105.0,499.0,45.0,268.0,3.0,17.0,192.0,499.0,4.0,27.0,51.0,9.0,1.0,21.0,0.0,499.0,6.0,95.0,53.0,60.0,499.0,21.0,8.0,96.0,333.0,499.0,4.0,67.0,6.0,40.0,499.0,9.0,32.0,8.0,499.0,499.0,6.0,95.0,53.0,60.0,499.0,21.0,8.0,96.0,333.0,499.0,4.0,67.0,6.0,40.0,499.0,9.0,32.0,8.0,499.0,1.0,14.0,0.0,15.0,39.0,229.0,37.0,236.0,176.0,447.0,499.0,6.0,95.0,16.0,8.0,499.0,15.0,39.0,229.0,37.0,236.0,176.0,447.0,499.0,6.0,95.0,16.0,8.0,499.0,1.0,30.0,0.0,133.0,26.0,6.0,3.0,71.0,197.0,23.0,238.0,7.0,6.0,246.0,499.0,8.0,499.0,23.0,39.0,200.0,20.0,12.0,144.0,96.0,333.0,6.0,3.0,109.0,21.0,44.0,172.0,9.0,133.0,26.0,6.0,3.0,71.0,197.0,23.0,238.0,7.0,6.0,246.0,499.0,8.0,499.0,23.0,39.0,200.0,20.0,12.0,144.0,96.0,333.0,6.0,3.0,109.0,21.0,44.0,172.0,9.0,1.0,11.0,0.0,25.0,26.0,6.0,246.0,499.0,9.0,32.0,46.0,499.0,499.0,25.0,26.0,6.0,246.0,499.0,9.0,32.0,46.0,499.0,499.0,1.0,28.0,0.0,6.0,29.0,15.0,2.0,144.0,499.0,6.0,3.0,71.0,99.0,86.0,155.0,483.0,499.0,133.0,7.0,499.0,499.0,61.0,52.0,103.0,10.0,39.0,339.0,88.0,57.0,499.0,6.0,29.0,15.0,2.0,144.0,499.0,6.0,3.0,71.0,99.0,86.0,155.0,483.0,499.0,133.0,7.0,499.0,499.0,61.0,52.0,103.0,10.0,39.0,339.0,88.0,57.0,499.0,1.0,33.0,0.0,6.0,328.0,6.0,29.0,499.0,32.0,499.0,32.0,2.0,499.0,499.0,29.0,499.0,68.0,6.0,202.0,3.0,17.0,104.0,4.0,499.0,7.0,103.0,10.0,39.0,339.0,142.0,57.0,499.0,155.0,499.0,105.0,6.0,328.0,6.0,29.0,499.0,32.0,499.0,32.0,2.0,499.0,499.0,29.0,499.0,68.0,6.0,202.0,3.0,17.0,104.0,4.0,499.0,7.0,103.0,10.0,39.0,339.0,142.0,57.0,499.0,155.0,499.0,105.0,1.0,30.0,0.0,53.0,499.0,67.0,29.0,8.0,177.0,10.0,499.0,6.0,199.0,4.0,50.0,39.0,499.0,4.0,143.0,67.0,499.0,19.0,499.0,499.0,380.0,8.0,266.0,7.0,50.0,92.0,499.0,499.0,53.0,499.0,67.0,29.0,8.0,177.0,10.0,499.0,6.0,199.0,4.0,50.0,39.0,499.0,4.0,143.0,67.0,499.0,19.0,499.0,499.0,380.0,8.0,266.0,7.0,50.0,92.0,499.0,499.0,1.0,24.0,0.0,41.0,52.0,6.0,157.0,39.0,499.0,44.0,39.0,499.0,7.0,499.0,29.0,499.0,68.0,6.0,29.0,41.0,499.0,20.0,499.0,37.0,30.0,124.0,41.0,52.0,6.0,157.0,39.0,499.0,44.0,39.0,499.0,7.0,499.0,29.0,499.0,68.0,6.0,29.0,41.0,499.0,20.0,499.0,37.0,30.0,124.0,1.0,3.0,0.0,96.0,499.0,96.0,499.0,1.0,18.0,0.0,2.0,442.0,165.0,16.0,126.0,4.0,235.0,264.0,61.0,275.0,33.0,77.0,4.0,235.0,499.0,2.0,499.0,2.0,442.0,165.0,16.0,126.0,4.0,235.0,264.0,61.0,275.0,33.0,77.0,4.0,235.0,499.0,2.0,499.0,1.0,24.0,0.0,499.0,331.0,40.0,499.0,499.0,499.0,77.0,152.0,499.0,16.0,46.0,499.0,301.0,289.0,154.0,499.0,16.0,151.0,499.0,15.0,70.0,499.0,73.0,499.0,331.0,40.0,499.0,499.0,499.0,77.0,152.0,499.0,16.0,46.0,499.0,301.0,289.0,154.0,499.0,16.0,151.0,499.0,15.0,70.0,499.0,73.0,1.0,22.0,0.0,27.0,499.0,6.0,499.0,162.0,74.0,53.0,57.0,499.0,123.0,48.0,371.0,7.0,332.0,167.0,31.0,30.0,290.0,5.0,5.0,80.0,27.0,499.0,6.0,499.0,162.0,74.0,53.0,57.0,499.0,123.0,48.0,371.0,7.0,332.0,167.0,31.0,30.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,32.0,0.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,166.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,166.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,13.0,499.0,13.0,10.0,13.0,499.0,13.0,499.0,1.0,6.0,0.0,499.0,16.0,8.0,126.0,499.0,499.0,16.0,8.0,126.0,499.0,1.0,17.0,0.0,499.0,16.0,192.0,10.0,8.0,430.0,4.0,499.0,8.0,499.0,2.0,117.0,499.0,34.0,3.0,17.0,499.0,16.0,192.0,10.0,8.0,430.0,4.0,499.0,8.0,499.0,2.0,117.0,499.0,34.0,3.0,17.0,1.0,26.0,0.0,53.0,6.0,127.0,499.0,16.0,12.0,307.0,7.0,176.0,259.0,499.0,499.0,3.0,18.0,499.0,88.0,4.0,499.0,23.0,8.0,499.0,499.0,499.0,4.0,225.0,53.0,6.0,127.0,499.0,16.0,12.0,307.0,7.0,176.0,259.0,499.0,499.0,3.0,18.0,499.0,88.0,4.0,499.0,23.0,8.0,499.0,499.0,499.0,4.0,225.0,1.0,14.0,0.0,499.0,499.0,499.0,499.0,28.0,499.0,24.0,28.0,27.0,499.0,499.0,499.0,256.0,499.0,499.0,499.0,499.0,28.0,499.0,24.0,28.0,27.0,499.0,499.0,499.0,256.0,1.0,21.0,0.0,2.0,297.0,499.0,29.0,48.0,499.0,13.0,7.0,499.0,38.0,3.0,17.0,22.0,12.0,499.0,499.0,499.0,76.0,287.0,51.0,2.0,297.0,499.0,29.0,48.0,499.0,13.0,7.0,499.0,38.0,3.0,17.0,22.0,12.0,499.0,499.0,499.0,76.0,287.0,51.0,1.0,21.0,0.0,9.0,3.0,18.0,108.0,164.0,499.0,12.0,499.0,22.0,28.0,92.0,247.0,499.0,52.0,58.0,499.0,499.0,499.0,2.0,83.0,9.0,3.0,18.0,108.0,164.0,499.0,12.0,499.0,22.0,28.0,92.0,247.0,499.0,52.0,58.0,499.0,499.0,499.0,2.0,83.0,1.0,43.0,0.0,499.0,499.0,56.0,499.0,25.0,381.0,499.0,43.0,7.0,499.0,307.0,474.0,499.0,4.0,2.0,190.0,10.0,57.0,499.0,499.0,2.0,487.0,12.0,181.0,190.0,19.0,12.0,499.0,7.0,493.0,43.0,15.0,2.0,499.0,12.0,499.0,43.0,7.0,57.0,259.0,2.0,103.0,499.0,499.0,56.0,499.0,25.0,381.0,499.0,43.0,7.0,499.0,307.0,474.0,499.0,4.0,2.0,190.0,10.0,57.0,499.0,499.0,2.0,487.0,12.0,181.0,190.0,19.0,12.0,499.0,7.0,493.0,43.0,15.0,2.0,499.0,12.0,499.0,43.0,7.0,57.0,259.0,2.0,103.0,1.0,32.0,0.0,499.0,499.0,28.0,499.0,15.0,2.0,205.0,499.0,180.0,499.0,2.0,144.0,487.0,28.0,499.0,20.0,499.0,2.0,144.0,499.0,7.0,28.0,178.0,15.0,499.0,2.0,144.0,499.0,20.0,242.0,499.0,499.0,499.0,28.0,499.0,15.0,2.0,205.0,499.0,180.0,499.0,2.0,144.0,487.0,28.0,499.0,20.0,499.0,2.0,144.0,499.0,7.0,28.0,178.0,15.0,499.0,2.0,144.0,499.0,20.0,242.0,499.0,1.0,14.0,0.0,499.0,36.0,166.0,56.0,81.0,499.0,499.0,4.0,137.0,8.0,87.0,499.0,314.0,499.0,36.0,166.0,56.0,81.0,499.0,499.0,4.0,137.0,8.0,87.0,499.0,314.0,1.0,37.0,0.0,499.0,51.0,27.0,156.0,4.0,21.0,499.0,248.0,72.0,48.0,46.0,14.0,14.0,312.0,499.0,15.0,499.0,14.0,14.0,298.0,499.0,25.0,499.0,192.0,12.0,208.0,251.0,34.0,313.0,153.0,137.0,4.0,95.0,2.0,499.0,166.0,499.0,51.0,27.0,156.0,4.0,21.0,499.0,248.0,72.0,48.0,46.0,14.0,14.0,312.0,499.0,15.0,499.0,14.0,14.0,298.0,499.0,25.0,499.0,192.0,12.0,208.0,251.0,34.0,313.0,153.0,137.0,4.0,95.0,2.0,499.0,166.0,1.0,12.0,0.0,8.0,474.0,370.0,62.0,499.0,58.0,499.0,69.0,8.0,499.0,63.0,8.0,474.0,370.0,62.0,499.0,58.0,499.0,69.0,8.0,499.0,63.0,1.0,44.0,0.0,499.0,10.0,499.0,14.0,14.0,26.0,36.0,370.0,34.0,499.0,15.0,2.0,314.0,499.0,498.0,85.0,9.0,91.0,21.0,15.0,2.0,314.0,14.0,14.0,11.0,34.0,174.0,499.0,10.0,76.0,499.0,27.0,4.0,118.0,14.0,14.0,100.0,14.0,14.0,290.0,5.0,5.0,80.0,499.0,10.0,499.0,14.0,14.0,26.0,36.0,370.0,34.0,499.0,15.0,2.0,314.0,499.0,498.0,85.0,9.0,91.0,21.0,15.0,2.0,314.0,14.0,14.0,11.0,34.0,174.0,499.0,10.0,76.0,499.0,27.0,4.0,118.0,14.0,14.0,100.0,14.0,14.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,25.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,308.0,5.0,233.0,5.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,308.0,5.0,233.0,5.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,30.0,0.0,345.0,499.0,47.0,32.0,8.0,499.0,38.0,3.0,17.0,22.0,4.0,499.0,2.0,499.0,10.0,493.0,2.0,499.0,7.0,499.0,10.0,499.0,499.0,7.0,134.0,499.0,4.0,8.0,499.0,345.0,499.0,47.0,32.0,8.0,499.0,38.0,3.0,17.0,22.0,4.0,499.0,2.0,499.0,10.0,493.0,2.0,499.0,7.0,499.0,10.0,499.0,499.0,7.0,134.0,499.0,4.0,8.0,499.0,1.0,20.0,0.0,6.0,3.0,71.0,499.0,12.0,253.0,8.0,499.0,499.0,56.0,499.0,4.0,499.0,14.0,499.0,499.0,2.0,499.0,14.0,6.0,3.0,71.0,499.0,12.0,253.0,8.0,499.0,499.0,56.0,499.0,4.0,499.0,14.0,499.0,499.0,2.0,499.0,14.0,1.0,44.0,0.0,6.0,29.0,37.0,8.0,499.0,19.0,8.0,242.0,499.0,41.0,6.0,499.0,12.0,30.0,16.0,41.0,363.0,25.0,26.0,11.0,338.0,3.0,17.0,295.0,224.0,61.0,291.0,499.0,16.0,46.0,499.0,499.0,499.0,234.0,10.0,31.0,499.0,33.0,114.0,64.0,53.0,6.0,313.0,6.0,29.0,37.0,8.0,499.0,19.0,8.0,242.0,499.0,41.0,6.0,499.0,12.0,30.0,16.0,41.0,363.0,25.0,26.0,11.0,338.0,3.0,17.0,295.0,224.0,61.0,291.0,499.0,16.0,46.0,499.0,499.0,499.0,234.0,10.0,31.0,499.0,33.0,114.0,64.0,53.0,6.0,313.0,1.0,20.0,0.0,24.0,22.0,2.0,499.0,499.0,73.0,499.0,68.0,24.0,3.0,54.0,499.0,19.0,52.0,24.0,3.0,54.0,161.0,499.0,24.0,22.0,2.0,499.0,499.0,73.0,499.0,68.0,24.0,3.0,54.0,499.0,19.0,52.0,24.0,3.0,54.0,161.0,499.0,1.0,37.0,0.0,24.0,3.0,54.0,15.0,2.0,499.0,25.0,27.0,173.0,4.0,21.0,499.0,4.0,234.0,10.0,31.0,79.0,499.0,56.0,499.0,73.0,8.0,145.0,93.0,24.0,3.0,54.0,61.0,25.0,11.0,34.0,3.0,17.0,499.0,4.0,43.0,24.0,3.0,54.0,15.0,2.0,499.0,25.0,27.0,173.0,4.0,21.0,499.0,4.0,234.0,10.0,31.0,79.0,499.0,56.0,499.0,73.0,8.0,145.0,93.0,24.0,3.0,54.0,61.0,25.0,11.0,34.0,3.0,17.0,499.0,4.0,43.0,1.0,4.0,0.0,239.0,102.0,367.0,239.0,102.0,367.0,1.0,18.0,0.0,11.0,163.0,3.0,17.0,21.0,173.0,4.0,499.0,8.0,373.0,391.0,10.0,499.0,15.0,40.0,254.0,499.0,11.0,163.0,3.0,17.0,21.0,173.0,4.0,499.0,8.0,373.0,391.0,10.0,499.0,15.0,40.0,254.0,499.0,1.0,28.0,0.0,11.0,34.0,499.0,86.0,499.0,499.0,8.0,242.0,499.0,45.0,85.0,499.0,4.0,499.0,33.0,499.0,7.0,51.0,59.0,499.0,61.0,4.0,2.0,499.0,93.0,499.0,61.0,11.0,34.0,499.0,86.0,499.0,499.0,8.0,242.0,499.0,45.0,85.0,499.0,4.0,499.0,33.0,499.0,7.0,51.0,59.0,499.0,61.0,4.0,2.0,499.0,93.0,499.0,61.0,1.0,6.0,0.0,33.0,51.0,499.0,499.0,499.0,33.0,51.0,499.0,499.0,499.0,1.0,25.0,0.0,45.0,28.0,499.0,19.0,183.0,499.0,7.0,499.0,41.0,11.0,34.0,50.0,59.0,474.0,499.0,64.0,45.0,32.0,97.0,32.0,499.0,499.0,31.0,499.0,45.0,28.0,499.0,19.0,183.0,499.0,7.0,499.0,41.0,11.0,34.0,50.0,59.0,474.0,499.0,64.0,45.0,32.0,97.0,32.0,499.0,499.0,31.0,499.0,1.0,18.0,0.0,12.0,3.0,18.0,40.0,39.0,499.0,285.0,13.0,379.0,241.0,22.0,76.0,499.0,19.0,11.0,4.0,283.0,12.0,3.0,18.0,40.0,39.0,499.0,285.0,13.0,379.0,241.0,22.0,76.0,499.0,19.0,11.0,4.0,283.0,1.0,14.0,0.0,6.0,3.0,110.0,499.0,23.0,499.0,26.0,11.0,28.0,135.0,2.0,499.0,499.0,6.0,3.0,110.0,499.0,23.0,499.0,26.0,11.0,28.0,135.0,2.0,499.0,499.0,1.0,20.0,0.0,499.0,3.0,18.0,499.0,56.0,326.0,4.0,51.0,20.0,499.0,499.0,19.0,2.0,499.0,7.0,11.0,78.0,9.0,499.0,499.0,3.0,18.0,499.0,56.0,326.0,4.0,51.0,20.0,499.0,499.0,19.0,2.0,499.0,7.0,11.0,78.0,9.0,499.0,1.0,20.0,0.0,49.0,3.0,18.0,72.0,499.0,150.0,114.0,499.0,2.0,499.0,10.0,136.0,218.0,20.0,90.0,200.0,499.0,99.0,73.0,49.0,3.0,18.0,72.0,499.0,150.0,114.0,499.0,2.0,499.0,10.0,136.0,218.0,20.0,90.0,200.0,499.0,99.0,73.0,1.0,11.0,0.0,90.0,499.0,16.0,48.0,499.0,12.0,16.0,53.0,346.0,9.0,90.0,499.0,16.0,48.0,499.0,12.0,16.0,53.0,346.0,9.0,1.0,26.0,0.0,11.0,499.0,499.0,2.0,499.0,20.0,84.0,2.0,499.0,499.0,499.0,176.0,76.0,499.0,499.0,10.0,49.0,499.0,7.0,123.0,24.0,28.0,499.0,10.0,9.0,11.0,499.0,499.0,2.0,499.0,20.0,84.0,2.0,499.0,499.0,499.0,176.0,76.0,499.0,499.0,10.0,49.0,499.0,7.0,123.0,24.0,28.0,499.0,10.0,9.0,1.0,10.0,0.0,24.0,499.0,499.0,499.0,19.0,499.0,499.0,70.0,499.0,24.0,499.0,499.0,499.0,19.0,499.0,499.0,70.0,499.0,1.0,41.0,0.0,499.0,9.0,3.0,18.0,151.0,499.0,4.0,499.0,25.0,6.0,65.0,2.0,499.0,499.0,12.0,499.0,499.0,16.0,499.0,69.0,499.0,499.0,10.0,2.0,499.0,6.0,428.0,31.0,106.0,499.0,9.0,3.0,18.0,239.0,499.0,52.0,207.0,499.0,499.0,499.0,499.0,9.0,3.0,18.0,151.0,499.0,4.0,499.0,25.0,6.0,65.0,2.0,499.0,499.0,12.0,499.0,499.0,16.0,499.0,69.0,499.0,499.0,10.0,2.0,499.0,6.0,428.0,31.0,106.0,499.0,9.0,3.0,18.0,239.0,499.0,52.0,207.0,499.0,499.0,499.0,1.0,15.0,0.0,499.0,238.0,499.0,12.0,164.0,28.0,103.0,10.0,2.0,327.0,499.0,5.0,5.0,80.0,499.0,238.0,499.0,12.0,164.0,28.0,103.0,10.0,2.0,327.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,15.0,0.0,499.0,9.0,3.0,18.0,44.0,499.0,23.0,53.0,234.0,10.0,499.0,11.0,104.0,92.0,499.0,9.0,3.0,18.0,44.0,499.0,23.0,53.0,234.0,10.0,499.0,11.0,104.0,92.0,1.0,7.0,0.0,15.0,499.0,10.0,499.0,33.0,499.0,15.0,499.0,10.0,499.0,33.0,499.0,1.0,22.0,0.0,6.0,417.0,499.0,170.0,24.0,161.0,51.0,92.0,398.0,165.0,7.0,499.0,499.0,87.0,97.0,26.0,11.0,22.0,46.0,499.0,499.0,6.0,417.0,499.0,170.0,24.0,161.0,51.0,92.0,398.0,165.0,7.0,499.0,499.0,87.0,97.0,26.0,11.0,22.0,46.0,499.0,499.0,1.0,27.0,0.0,499.0,499.0,16.0,116.0,2.0,190.0,499.0,327.0,33.0,499.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,499.0,499.0,53.0,303.0,10.0,499.0,24.0,62.0,22.0,499.0,499.0,16.0,116.0,2.0,190.0,499.0,327.0,33.0,499.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,499.0,499.0,53.0,303.0,10.0,499.0,24.0,62.0,22.0,1.0,28.0,0.0,41.0,19.0,330.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,2.0,499.0,499.0,33.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,499.0,165.0,41.0,19.0,330.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,2.0,499.0,499.0,33.0,8.0,14.0,14.0,499.0,14.0,14.0,499.0,62.0,261.0,499.0,165.0,1.0,35.0,0.0,499.0,19.0,8.0,499.0,11.0,116.0,104.0,8.0,14.0,14.0,499.0,14.0,14.0,327.0,170.0,9.0,499.0,46.0,44.0,499.0,499.0,26.0,11.0,34.0,3.0,17.0,499.0,4.0,174.0,5.0,396.0,8.0,499.0,327.0,499.0,19.0,8.0,499.0,11.0,116.0,104.0,8.0,14.0,14.0,499.0,14.0,14.0,327.0,170.0,9.0,499.0,46.0,44.0,499.0,499.0,26.0,11.0,34.0,3.0,17.0,499.0,4.0,174.0,5.0,396.0,8.0,499.0,327.0,1.0,26.0,0.0,36.0,194.0,499.0,45.0,16.0,40.0,499.0,4.0,2.0,233.0,100.0,7.0,47.0,163.0,3.0,17.0,388.0,11.0,4.0,122.0,8.0,499.0,10.0,395.0,30.0,36.0,194.0,499.0,45.0,16.0,40.0,499.0,4.0,2.0,233.0,100.0,7.0,47.0,163.0,3.0,17.0,388.0,11.0,4.0,122.0,8.0,499.0,10.0,395.0,30.0,1.0,6.0,0.0,11.0,34.0,499.0,4.0,42.0,11.0,34.0,499.0,4.0,42.0,1.0,29.0,0.0,141.0,38.0,3.0,17.0,499.0,43.0,10.0,167.0,499.0,167.0,23.0,43.0,33.0,499.0,2.0,415.0,48.0,43.0,7.0,499.0,4.0,43.0,32.0,26.0,24.0,161.0,157.0,12.0,141.0,38.0,3.0,17.0,499.0,43.0,10.0,167.0,499.0,167.0,23.0,43.0,33.0,499.0,2.0,415.0,48.0,43.0,7.0,499.0,4.0,43.0,32.0,26.0,24.0,161.0,157.0,12.0,1.0,19.0,0.0,45.0,3.0,18.0,55.0,499.0,15.0,30.0,12.0,3.0,18.0,40.0,499.0,7.0,9.0,3.0,18.0,27.0,499.0,45.0,3.0,18.0,55.0,499.0,15.0,30.0,12.0,3.0,18.0,40.0,499.0,7.0,9.0,3.0,18.0,27.0,499.0,1.0,17.0,0.0,70.0,499.0,10.0,42.0,66.0,51.0,30.0,100.0,60.0,115.0,11.0,37.0,33.0,425.0,2.0,175.0,70.0,499.0,10.0,42.0,66.0,51.0,30.0,100.0,60.0,115.0,11.0,37.0,33.0,425.0,2.0,175.0,1.0,9.0,0.0,11.0,156.0,4.0,51.0,101.0,141.0,7.0,133.0,11.0,156.0,4.0,51.0,101.0,141.0,7.0,133.0,1.0,8.0,0.0,2.0,155.0,387.0,29.0,2.0,499.0,499.0,2.0,155.0,387.0,29.0,2.0,499.0,499.0,1.0,28.0,0.0,2.0,499.0,387.0,16.0,301.0,23.0,270.0,64.0,2.0,499.0,499.0,7.0,44.0,499.0,499.0,22.0,81.0,499.0,86.0,2.0,83.0,168.0,32.0,498.0,33.0,15.0,445.0,2.0,499.0,387.0,16.0,301.0,23.0,270.0,64.0,2.0,499.0,499.0,7.0,44.0,499.0,499.0,22.0,81.0,499.0,86.0,2.0,83.0,168.0,32.0,498.0,33.0,15.0,445.0,1.0,41.0,0.0,499.0,15.0,2.0,499.0,8.0,499.0,499.0,66.0,499.0,191.0,2.0,445.0,7.0,274.0,43.0,4.0,499.0,499.0,7.0,2.0,499.0,19.0,79.0,445.0,180.0,499.0,29.0,187.0,499.0,7.0,499.0,4.0,499.0,15.0,20.0,2.0,499.0,10.0,2.0,83.0,499.0,15.0,2.0,499.0,8.0,499.0,499.0,66.0,499.0,191.0,2.0,445.0,7.0,274.0,43.0,4.0,499.0,499.0,7.0,2.0,499.0,19.0,79.0,445.0,180.0,499.0,29.0,187.0,499.0,7.0,499.0,4.0,499.0,15.0,20.0,2.0,499.0,10.0,2.0,83.0,1.0,31.0,0.0,6.0,202.0,3.0,17.0,123.0,9.0,29.0,265.0,6.0,40.0,150.0,9.0,268.0,3.0,17.0,10.0,499.0,368.0,7.0,268.0,3.0,17.0,285.0,2.0,499.0,11.0,131.0,499.0,19.0,9.0,6.0,202.0,3.0,17.0,123.0,9.0,29.0,265.0,6.0,40.0,150.0,9.0,268.0,3.0,17.0,10.0,499.0,368.0,7.0,268.0,3.0,17.0,285.0,2.0,499.0,11.0,131.0,499.0,19.0,9.0,1.0,28.0,0.0,6.0,75.0,499.0,46.0,499.0,10.0,8.0,499.0,12.0,6.0,157.0,283.0,4.0,21.0,499.0,368.0,7.0,84.0,29.0,285.0,2.0,234.0,10.0,364.0,11.0,28.0,499.0,6.0,75.0,499.0,46.0,499.0,10.0,8.0,499.0,12.0,6.0,157.0,283.0,4.0,21.0,499.0,368.0,7.0,84.0,29.0,285.0,2.0,234.0,10.0,364.0,11.0,28.0,499.0,1.0,43.0,0.0,2.0,65.0,12.0,482.0,67.0,16.0,12.0,11.0,499.0,100.0,499.0,26.0,36.0,499.0,29.0,285.0,499.0,36.0,339.0,499.0,11.0,9.0,268.0,3.0,17.0,6.0,499.0,11.0,9.0,268.0,3.0,17.0,7.0,499.0,108.0,7.0,11.0,50.0,44.0,499.0,48.0,9.0,2.0,65.0,12.0,482.0,67.0,16.0,12.0,11.0,499.0,100.0,499.0,26.0,36.0,499.0,29.0,285.0,499.0,36.0,339.0,499.0,11.0,9.0,268.0,3.0,17.0,6.0,499.0,11.0,9.0,268.0,3.0,17.0,7.0,499.0,108.0,7.0,11.0,50.0,44.0,499.0,48.0,9.0,1.0,23.0,0.0,26.0,11.0,38.0,3.0,17.0,104.0,2.0,499.0,10.0,42.0,58.0,499.0,69.0,227.0,85.0,11.0,499.0,3.0,17.0,305.0,19.0,9.0,26.0,11.0,38.0,3.0,17.0,104.0,2.0,499.0,10.0,42.0,58.0,499.0,69.0,227.0,85.0,11.0,499.0,3.0,17.0,305.0,19.0,9.0,1.0,31.0,0.0,64.0,332.0,12.0,9.0,499.0,31.0,49.0,3.0,18.0,137.0,499.0,499.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,67.0,288.0,27.0,137.0,4.0,65.0,40.0,499.0,7.0,148.0,499.0,64.0,332.0,12.0,9.0,499.0,31.0,49.0,3.0,18.0,137.0,499.0,499.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,67.0,288.0,27.0,137.0,4.0,65.0,40.0,499.0,7.0,148.0,499.0,1.0,24.0,0.0,26.0,49.0,138.0,3.0,17.0,499.0,263.0,9.0,3.0,18.0,116.0,68.0,49.0,3.0,18.0,27.0,319.0,10.0,90.0,499.0,44.0,2.0,121.0,26.0,49.0,138.0,3.0,17.0,499.0,263.0,9.0,3.0,18.0,116.0,68.0,49.0,3.0,18.0,27.0,319.0,10.0,90.0,499.0,44.0,2.0,121.0,1.0,20.0,0.0,499.0,6.0,127.0,151.0,499.0,74.0,30.0,499.0,32.0,8.0,499.0,23.0,108.0,499.0,14.0,499.0,14.0,499.0,499.0,499.0,6.0,127.0,151.0,499.0,74.0,30.0,499.0,32.0,8.0,499.0,23.0,108.0,499.0,14.0,499.0,14.0,499.0,499.0,1.0,19.0,0.0,2.0,499.0,14.0,28.0,14.0,499.0,7.0,499.0,25.0,499.0,58.0,69.0,499.0,52.0,499.0,4.0,2.0,499.0,2.0,499.0,14.0,28.0,14.0,499.0,7.0,499.0,25.0,499.0,58.0,69.0,499.0,52.0,499.0,4.0,2.0,499.0,1.0,22.0,0.0,277.0,43.0,32.0,8.0,499.0,499.0,10.0,108.0,4.0,499.0,499.0,499.0,31.0,46.0,172.0,499.0,23.0,2.0,156.0,19.0,499.0,277.0,43.0,32.0,8.0,499.0,499.0,10.0,108.0,4.0,499.0,499.0,499.0,31.0,46.0,172.0,499.0,23.0,2.0,156.0,19.0,499.0,1.0,16.0,0.0,499.0,81.0,37.0,499.0,19.0,499.0,499.0,7.0,499.0,499.0,107.0,499.0,8.0,499.0,499.0,499.0,81.0,37.0,499.0,19.0,499.0,499.0,7.0,499.0,499.0,107.0,499.0,8.0,499.0,499.0,1.0,21.0,0.0,11.0,499.0,78.0,265.0,48.0,2.0,499.0,2.0,499.0,499.0,9.0,2.0,499.0,10.0,2.0,499.0,33.0,70.0,10.0,12.0,11.0,499.0,78.0,265.0,48.0,2.0,499.0,2.0,499.0,499.0,9.0,2.0,499.0,10.0,2.0,499.0,33.0,70.0,10.0,12.0,1.0,62.0,0.0,7.0,23.0,2.0,499.0,10.0,499.0,499.0,6.0,34.0,335.0,11.0,11.0,28.0,46.0,499.0,499.0,499.0,2.0,499.0,499.0,4.0,11.0,74.0,299.0,11.0,499.0,3.0,197.0,189.0,3.0,478.0,499.0,499.0,11.0,499.0,499.0,11.0,78.0,499.0,499.0,44.0,48.0,83.0,499.0,342.0,499.0,499.0,499.0,33.0,70.0,10.0,2.0,76.0,265.0,11.0,41.0,499.0,499.0,42.0,355.0,64.0,7.0,23.0,2.0,499.0,10.0,499.0,499.0,6.0,34.0,335.0,11.0,11.0,28.0,46.0,499.0,499.0,499.0,2.0,499.0,499.0,4.0,11.0,74.0,299.0,11.0,499.0,3.0,197.0,189.0,3.0,478.0,499.0,499.0,11.0,499.0,499.0,11.0,78.0,499.0,499.0,44.0,48.0,83.0,499.0,342.0,499.0,499.0,499.0,33.0,70.0,10.0,2.0,76.0,265.0,11.0,41.0,499.0,499.0,42.0,355.0,64.0,1.0,11.0,0.0,499.0,11.0,22.0,36.0,485.0,107.0,73.0,36.0,200.0,499.0,499.0,11.0,22.0,36.0,485.0,107.0,73.0,36.0,200.0,499.0,1.0,14.0,0.0,41.0,102.0,41.0,478.0,499.0,11.0,499.0,77.0,499.0,4.0,499.0,36.0,499.0,41.0,102.0,41.0,478.0,499.0,11.0,499.0,77.0,499.0,4.0,499.0,36.0,499.0,1.0,11.0,0.0,40.0,31.0,176.0,76.0,499.0,499.0,52.0,456.0,19.0,499.0,40.0,31.0,176.0,76.0,499.0,499.0,52.0,456.0,19.0,499.0,1.0,20.0,0.0,6.0,65.0,450.0,499.0,10.0,499.0,499.0,277.0,499.0,499.0,142.0,67.0,86.0,499.0,499.0,499.0,59.0,499.0,167.0,6.0,65.0,450.0,499.0,10.0,499.0,499.0,277.0,499.0,499.0,142.0,67.0,86.0,499.0,499.0,499.0,59.0,499.0,167.0,1.0,50.0,0.0,6.0,199.0,4.0,444.0,8.0,177.0,10.0,499.0,499.0,15.0,439.0,499.0,25.0,6.0,160.0,92.0,499.0,86.0,9.0,279.0,255.0,499.0,499.0,7.0,6.0,75.0,88.0,8.0,499.0,408.0,20.0,499.0,499.0,12.0,6.0,92.0,499.0,152.0,207.0,202.0,3.0,17.0,118.0,70.0,499.0,499.0,499.0,40.0,499.0,6.0,199.0,4.0,444.0,8.0,177.0,10.0,499.0,499.0,15.0,439.0,499.0,25.0,6.0,160.0,92.0,499.0,86.0,9.0,279.0,255.0,499.0,499.0,7.0,6.0,75.0,88.0,8.0,499.0,408.0,20.0,499.0,499.0,12.0,6.0,92.0,499.0,152.0,207.0,202.0,3.0,17.0,118.0,70.0,499.0,499.0,499.0,40.0,499.0,1.0,6.0,0.0,6.0,31.0,42.0,31.0,11.0,6.0,31.0,42.0,31.0,11.0,1.0,24.0,0.0,103.0,42.0,123.0,137.0,499.0,16.0,8.0,189.0,139.0,25.0,6.0,78.0,105.0,132.0,42.0,12.0,22.0,55.0,499.0,7.0,28.0,499.0,499.0,103.0,42.0,123.0,137.0,499.0,16.0,8.0,189.0,139.0,25.0,6.0,78.0,105.0,132.0,42.0,12.0,22.0,55.0,499.0,7.0,28.0,499.0,499.0,1.0,33.0,0.0,6.0,22.0,499.0,499.0,10.0,8.0,405.0,66.0,3.0,18.0,499.0,499.0,3.0,17.0,88.0,8.0,409.0,15.0,237.0,56.0,499.0,405.0,7.0,2.0,343.0,499.0,19.0,499.0,44.0,10.0,90.0,499.0,6.0,22.0,499.0,499.0,10.0,8.0,405.0,66.0,3.0,18.0,499.0,499.0,3.0,17.0,88.0,8.0,409.0,15.0,237.0,56.0,499.0,405.0,7.0,2.0,343.0,499.0,19.0,499.0,44.0,10.0,90.0,499.0,1.0,11.0,0.0,49.0,16.0,187.0,499.0,7.0,40.0,499.0,499.0,44.0,145.0,49.0,16.0,187.0,499.0,7.0,40.0,499.0,499.0,44.0,145.0,1.0,6.0,0.0,499.0,19.0,99.0,392.0,499.0,499.0,19.0,99.0,392.0,499.0,1.0,13.0,0.0,11.0,3.0,54.0,395.0,96.0,7.0,6.0,499.0,499.0,11.0,2.0,190.0,11.0,3.0,54.0,395.0,96.0,7.0,6.0,499.0,499.0,11.0,2.0,190.0,1.0,4.0,0.0,40.0,240.0,499.0,40.0,240.0,499.0,1.0,14.0,0.0,6.0,130.0,45.0,3.0,18.0,195.0,117.0,4.0,214.0,37.0,9.0,32.0,97.0,6.0,130.0,45.0,3.0,18.0,195.0,117.0,4.0,214.0,37.0,9.0,32.0,97.0,1.0,19.0,0.0,11.0,3.0,54.0,499.0,68.0,11.0,499.0,499.0,499.0,19.0,36.0,339.0,7.0,24.0,338.0,3.0,17.0,499.0,11.0,3.0,54.0,499.0,68.0,11.0,499.0,499.0,499.0,19.0,36.0,339.0,7.0,24.0,338.0,3.0,17.0,499.0,1.0,17.0,0.0,25.0,24.0,499.0,8.0,422.0,7.0,499.0,11.0,7.0,14.0,11.0,14.0,338.0,3.0,17.0,499.0,25.0,24.0,499.0,8.0,422.0,7.0,499.0,11.0,7.0,14.0,11.0,14.0,338.0,3.0,17.0,499.0,1.0,7.0,0.0,53.0,3.0,18.0,2.0,499.0,499.0,53.0,3.0,18.0,2.0,499.0,499.0,1.0,14.0,0.0,499.0,499.0,7.0,24.0,91.0,50.0,262.0,4.0,11.0,20.0,8.0,499.0,426.0,499.0,499.0,7.0,24.0,91.0,50.0,262.0,4.0,11.0,20.0,8.0,499.0,426.0,1.0,33.0,0.0,499.0,81.0,499.0,20.0,39.0,499.0,52.0,499.0,499.0,29.0,8.0,499.0,499.0,14.0,26.0,11.0,38.0,3.0,17.0,499.0,280.0,67.0,499.0,7.0,499.0,7.0,499.0,499.0,37.0,43.0,19.0,11.0,499.0,81.0,499.0,20.0,39.0,499.0,52.0,499.0,499.0,29.0,8.0,499.0,499.0,14.0,26.0,11.0,38.0,3.0,17.0,499.0,280.0,67.0,499.0,7.0,499.0,7.0,499.0,499.0,37.0,43.0,19.0,11.0,1.0,11.0,0.0,2.0,499.0,91.0,22.0,81.0,206.0,61.0,4.0,2.0,499.0,2.0,499.0,91.0,22.0,81.0,206.0,61.0,4.0,2.0,499.0,1.0,30.0,0.0,2.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,12.0,2.0,499.0,499.0,2.0,499.0,32.0,9.0,241.0,499.0,59.0,499.0,12.0,28.0,499.0,286.0,2.0,499.0,499.0,2.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,12.0,2.0,499.0,499.0,2.0,499.0,32.0,9.0,241.0,499.0,59.0,499.0,12.0,28.0,499.0,286.0,2.0,499.0,499.0,1.0,45.0,0.0,2.0,76.0,125.0,499.0,10.0,499.0,253.0,32.0,8.0,499.0,499.0,499.0,7.0,317.0,13.0,499.0,499.0,499.0,28.0,499.0,286.0,2.0,499.0,3.0,18.0,499.0,32.0,196.0,24.0,62.0,21.0,499.0,23.0,70.0,499.0,499.0,32.0,30.0,138.0,3.0,17.0,8.0,499.0,499.0,2.0,76.0,125.0,499.0,10.0,499.0,253.0,32.0,8.0,499.0,499.0,499.0,7.0,317.0,13.0,499.0,499.0,499.0,28.0,499.0,286.0,2.0,499.0,3.0,18.0,499.0,32.0,196.0,24.0,62.0,21.0,499.0,23.0,70.0,499.0,499.0,32.0,30.0,138.0,3.0,17.0,8.0,499.0,499.0,1.0,31.0,0.0,37.0,2.0,267.0,10.0,2.0,145.0,30.0,217.0,31.0,8.0,499.0,499.0,66.0,499.0,4.0,122.0,182.0,11.0,38.0,3.0,17.0,499.0,2.0,364.0,23.0,317.0,13.0,499.0,499.0,487.0,37.0,2.0,267.0,10.0,2.0,145.0,30.0,217.0,31.0,8.0,499.0,499.0,66.0,499.0,4.0,122.0,182.0,11.0,38.0,3.0,17.0,499.0,2.0,364.0,23.0,317.0,13.0,499.0,499.0,487.0,1.0,12.0,0.0,40.0,157.0,8.0,499.0,499.0,7.0,9.0,213.0,181.0,19.0,67.0,40.0,157.0,8.0,499.0,499.0,7.0,9.0,213.0,181.0,19.0,67.0,1.0,9.0,0.0,2.0,499.0,16.0,103.0,376.0,23.0,36.0,499.0,2.0,499.0,16.0,103.0,376.0,23.0,36.0,499.0,1.0,13.0,0.0,499.0,499.0,288.0,499.0,3.0,499.0,3.0,499.0,375.0,288.0,499.0,375.0,499.0,499.0,288.0,499.0,3.0,499.0,3.0,499.0,375.0,288.0,499.0,375.0,1.0,10.0,0.0,499.0,3.0,499.0,3.0,499.0,3.0,499.0,3.0,375.0,499.0,3.0,499.0,3.0,499.0,3.0,499.0,3.0,375.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,3.0,0.0,499.0,375.0,499.0,375.0,1.0,2.0,0.0,499.0,499.0,1.0,50.0,0.0,499.0,11.0,22.0,183.0,499.0,15.0,205.0,499.0,10.0,499.0,11.0,346.0,499.0,125.0,380.0,7.0,22.0,63.0,499.0,15.0,307.0,499.0,26.0,12.0,3.0,18.0,2.0,276.0,6.0,65.0,12.0,52.0,11.0,499.0,9.0,62.0,72.0,388.0,11.0,4.0,499.0,499.0,27.0,499.0,11.0,70.0,499.0,499.0,499.0,499.0,11.0,22.0,183.0,499.0,15.0,205.0,499.0,10.0,499.0,11.0,346.0,499.0,125.0,380.0,7.0,22.0,63.0,499.0,15.0,307.0,499.0,26.0,12.0,3.0,18.0,2.0,276.0,6.0,65.0,12.0,52.0,11.0,499.0,9.0,62.0,72.0,388.0,11.0,4.0,499.0,499.0,27.0,499.0,11.0,70.0,499.0,499.0,499.0,1.0,17.0,0.0,264.0,44.0,2.0,499.0,499.0,7.0,122.0,182.0,11.0,22.0,183.0,499.0,23.0,2.0,144.0,499.0,264.0,44.0,2.0,499.0,499.0,7.0,122.0,182.0,11.0,22.0,183.0,499.0,23.0,2.0,144.0,499.0,1.0,16.0,0.0,26.0,11.0,3.0,54.0,99.0,4.0,51.0,30.0,50.0,8.0,499.0,7.0,51.0,499.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,51.0,30.0,50.0,8.0,499.0,7.0,51.0,499.0,499.0,1.0,6.0,0.0,37.0,236.0,462.0,46.0,471.0,37.0,236.0,462.0,46.0,471.0,1.0,38.0,0.0,39.0,499.0,499.0,499.0,5.0,499.0,499.0,5.0,462.0,7.0,6.0,22.0,4.0,123.0,6.0,38.0,3.0,17.0,65.0,6.0,3.0,110.0,21.0,457.0,32.0,96.0,33.0,457.0,32.0,499.0,26.0,6.0,268.0,3.0,17.0,323.0,499.0,39.0,499.0,499.0,499.0,5.0,499.0,499.0,5.0,462.0,7.0,6.0,22.0,4.0,123.0,6.0,38.0,3.0,17.0,65.0,6.0,3.0,110.0,21.0,457.0,32.0,96.0,33.0,457.0,32.0,499.0,26.0,6.0,268.0,3.0,17.0,323.0,499.0,1.0,18.0,0.0,6.0,3.0,120.0,81.0,226.0,19.0,499.0,418.0,7.0,6.0,149.0,31.0,6.0,22.0,8.0,398.0,499.0,6.0,3.0,120.0,81.0,226.0,19.0,499.0,418.0,7.0,6.0,149.0,31.0,6.0,22.0,8.0,398.0,499.0,1.0,11.0,0.0,326.0,229.0,499.0,25.0,9.0,147.0,3.0,17.0,271.0,189.0,326.0,229.0,499.0,25.0,9.0,147.0,3.0,17.0,271.0,189.0,1.0,30.0,0.0,9.0,60.0,3.0,120.0,499.0,67.0,41.0,102.0,499.0,4.0,50.0,4.0,12.0,124.0,26.0,6.0,268.0,3.0,17.0,395.0,499.0,46.0,471.0,8.0,266.0,75.0,40.0,247.0,499.0,9.0,60.0,3.0,120.0,499.0,67.0,41.0,102.0,499.0,4.0,50.0,4.0,12.0,124.0,26.0,6.0,268.0,3.0,17.0,395.0,499.0,46.0,471.0,8.0,266.0,75.0,40.0,247.0,499.0,1.0,10.0,0.0,176.0,145.0,55.0,219.0,69.0,272.0,499.0,8.0,145.0,176.0,145.0,55.0,219.0,69.0,272.0,499.0,8.0,145.0,1.0,19.0,0.0,499.0,8.0,145.0,100.0,7.0,45.0,138.0,3.0,17.0,2.0,267.0,10.0,2.0,362.0,25.0,499.0,4.0,9.0,499.0,8.0,145.0,100.0,7.0,45.0,138.0,3.0,17.0,2.0,267.0,10.0,2.0,362.0,25.0,499.0,4.0,9.0,1.0,39.0,0.0,11.0,186.0,3.0,17.0,104.0,4.0,143.0,2.0,499.0,499.0,61.0,2.0,499.0,163.0,3.0,17.0,393.0,73.0,37.0,12.0,124.0,13.0,2.0,468.0,499.0,499.0,169.0,499.0,2.0,499.0,169.0,7.0,9.0,186.0,3.0,17.0,21.0,499.0,11.0,186.0,3.0,17.0,104.0,4.0,143.0,2.0,499.0,499.0,61.0,2.0,499.0,163.0,3.0,17.0,393.0,73.0,37.0,12.0,124.0,13.0,2.0,468.0,499.0,499.0,169.0,499.0,2.0,499.0,169.0,7.0,9.0,186.0,3.0,17.0,21.0,499.0,1.0,23.0,0.0,2.0,499.0,18.0,499.0,16.0,295.0,499.0,499.0,4.0,499.0,41.0,499.0,499.0,116.0,138.0,3.0,17.0,2.0,476.0,4.0,499.0,499.0,2.0,499.0,18.0,499.0,16.0,295.0,499.0,499.0,4.0,499.0,41.0,499.0,499.0,116.0,138.0,3.0,17.0,2.0,476.0,4.0,499.0,499.0,1.0,18.0,0.0,116.0,499.0,2.0,499.0,499.0,7.0,499.0,499.0,60.0,235.0,32.0,97.0,32.0,2.0,107.0,499.0,499.0,116.0,499.0,2.0,499.0,499.0,7.0,499.0,499.0,60.0,235.0,32.0,97.0,32.0,2.0,107.0,499.0,499.0,1.0,27.0,0.0,358.0,499.0,16.0,44.0,48.0,264.0,499.0,7.0,255.0,165.0,499.0,358.0,499.0,16.0,48.0,499.0,499.0,7.0,499.0,358.0,499.0,16.0,499.0,7.0,499.0,412.0,358.0,499.0,16.0,44.0,48.0,264.0,499.0,7.0,255.0,165.0,499.0,358.0,499.0,16.0,48.0,499.0,499.0,7.0,499.0,358.0,499.0,16.0,499.0,7.0,499.0,412.0,1.0,30.0,0.0,61.0,10.0,499.0,53.0,499.0,157.0,11.0,50.0,36.0,358.0,499.0,4.0,6.0,22.0,161.0,224.0,499.0,4.0,21.0,499.0,8.0,177.0,10.0,252.0,103.0,10.0,2.0,117.0,191.0,61.0,10.0,499.0,53.0,499.0,157.0,11.0,50.0,36.0,358.0,499.0,4.0,6.0,22.0,161.0,224.0,499.0,4.0,21.0,499.0,8.0,177.0,10.0,252.0,103.0,10.0,2.0,117.0,191.0,1.0,23.0,0.0,15.0,499.0,10.0,84.0,10.0,188.0,16.0,2.0,103.0,252.0,4.0,499.0,19.0,2.0,312.0,402.0,154.0,116.0,99.0,4.0,21.0,499.0,15.0,499.0,10.0,84.0,10.0,188.0,16.0,2.0,103.0,252.0,4.0,499.0,19.0,2.0,312.0,402.0,154.0,116.0,99.0,4.0,21.0,499.0,1.0,82.0,0.0,499.0,213.0,27.0,92.0,499.0,252.0,279.0,11.0,50.0,499.0,499.0,37.0,499.0,499.0,7.0,499.0,16.0,116.0,99.0,4.0,21.0,187.0,499.0,4.0,11.0,279.0,11.0,50.0,8.0,499.0,10.0,414.0,499.0,53.0,30.0,62.0,130.0,4.0,11.0,16.0,205.0,432.0,430.0,6.0,428.0,22.0,499.0,39.0,358.0,499.0,44.0,2.0,117.0,191.0,499.0,499.0,37.0,499.0,9.0,499.0,8.0,177.0,499.0,23.0,4.0,499.0,20.0,499.0,499.0,7.0,344.0,499.0,499.0,43.0,4.0,499.0,165.0,20.0,2.0,499.0,499.0,499.0,213.0,27.0,92.0,499.0,252.0,279.0,11.0,50.0,499.0,499.0,37.0,499.0,499.0,7.0,499.0,16.0,116.0,99.0,4.0,21.0,187.0,499.0,4.0,11.0,279.0,11.0,50.0,8.0,499.0,10.0,414.0,499.0,53.0,30.0,62.0,130.0,4.0,11.0,16.0,205.0,432.0,430.0,6.0,428.0,22.0,499.0,39.0,358.0,499.0,44.0,2.0,117.0,191.0,499.0,499.0,37.0,499.0,9.0,499.0,8.0,177.0,499.0,23.0,4.0,499.0,20.0,499.0,499.0,7.0,344.0,499.0,499.0,43.0,4.0,499.0,165.0,20.0,2.0,499.0,499.0,1.0,224.0,0.0,499.0,4.0,2.0,499.0,499.0,499.0,499.0,19.0,499.0,108.0,134.0,169.0,10.0,499.0,16.0,499.0,265.0,7.0,134.0,169.0,10.0,499.0,7.0,499.0,16.0,499.0,499.0,15.0,30.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,499.0,41.0,437.0,32.0,4.0,499.0,2.0,499.0,107.0,27.0,4.0,499.0,499.0,8.0,499.0,88.0,161.0,81.0,499.0,23.0,33.0,27.0,499.0,349.0,12.0,2.0,343.0,91.0,27.0,21.0,499.0,4.0,499.0,499.0,499.0,74.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,16.0,8.0,499.0,10.0,2.0,499.0,27.0,8.0,499.0,84.0,91.0,499.0,4.0,229.0,46.0,499.0,499.0,499.0,499.0,419.0,164.0,499.0,4.0,21.0,499.0,13.0,499.0,12.0,44.0,499.0,28.0,499.0,499.0,12.0,24.0,28.0,499.0,74.0,57.0,499.0,20.0,319.0,499.0,452.0,12.0,461.0,164.0,28.0,198.0,499.0,7.0,2.0,499.0,10.0,499.0,13.0,13.0,12.0,4.0,499.0,164.0,452.0,499.0,28.0,499.0,461.0,499.0,499.0,57.0,40.0,499.0,64.0,2.0,354.0,10.0,2.0,499.0,13.0,13.0,12.0,499.0,70.0,499.0,10.0,343.0,499.0,499.0,10.0,164.0,499.0,9.0,16.0,2.0,107.0,10.0,2.0,42.0,4.0,499.0,33.0,4.0,499.0,9.0,7.0,4.0,499.0,98.0,343.0,499.0,154.0,499.0,23.0,253.0,499.0,7.0,499.0,154.0,499.0,15.0,253.0,499.0,32.0,4.0,43.0,499.0,499.0,103.0,376.0,4.0,499.0,57.0,499.0,7.0,499.0,499.0,4.0,2.0,499.0,499.0,499.0,499.0,19.0,499.0,108.0,134.0,169.0,10.0,499.0,16.0,499.0,265.0,7.0,134.0,169.0,10.0,499.0,7.0,499.0,16.0,499.0,499.0,15.0,30.0,499.0,499.0,499.0,15.0,499.0,499.0,499.0,499.0,41.0,437.0,32.0,4.0,499.0,2.0,499.0,107.0,27.0,4.0,499.0,499.0,8.0,499.0,88.0,161.0,81.0,499.0,23.0,33.0,27.0,499.0,349.0,12.0,2.0,343.0,91.0,27.0,21.0,499.0,4.0,499.0,499.0,499.0,74.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,16.0,8.0,499.0,10.0,2.0,499.0,27.0,8.0,499.0,84.0,91.0,499.0,4.0,229.0,46.0,499.0,499.0,499.0,499.0,419.0,164.0,499.0,4.0,21.0,499.0,13.0,499.0,12.0,44.0,499.0,28.0,499.0,499.0,12.0,24.0,28.0,499.0,74.0,57.0,499.0,20.0,319.0,499.0,452.0,12.0,461.0,164.0,28.0,198.0,499.0,7.0,2.0,499.0,10.0,499.0,13.0,13.0,12.0,4.0,499.0,164.0,452.0,499.0,28.0,499.0,461.0,499.0,499.0,57.0,40.0,499.0,64.0,2.0,354.0,10.0,2.0,499.0,13.0,13.0,12.0,499.0,70.0,499.0,10.0,343.0,499.0,499.0,10.0,164.0,499.0,9.0,16.0,2.0,107.0,10.0,2.0,42.0,4.0,499.0,33.0,4.0,499.0,9.0,7.0,4.0,499.0,98.0,343.0,499.0,154.0,499.0,23.0,253.0,499.0,7.0,499.0,154.0,499.0,15.0,253.0,499.0,32.0,4.0,43.0,499.0,499.0,103.0,376.0,4.0,499.0,57.0,499.0,7.0,499.0,1.0,48.0,0.0,499.0,499.0,62.0,499.0,12.0,499.0,248.0,499.0,91.0,27.0,21.0,274.0,19.0,433.0,7.0,499.0,499.0,7.0,499.0,44.0,294.0,499.0,499.0,12.0,499.0,28.0,58.0,499.0,4.0,499.0,210.0,499.0,28.0,499.0,69.0,4.0,107.0,499.0,74.0,499.0,2.0,499.0,4.0,84.0,24.0,28.0,499.0,499.0,499.0,62.0,499.0,12.0,499.0,248.0,499.0,91.0,27.0,21.0,274.0,19.0,433.0,7.0,499.0,499.0,7.0,499.0,44.0,294.0,499.0,499.0,12.0,499.0,28.0,58.0,499.0,4.0,499.0,210.0,499.0,28.0,499.0,69.0,4.0,107.0,499.0,74.0,499.0,2.0,499.0,4.0,84.0,24.0,28.0,499.0,1.0,50.0,0.0,25.0,14.0,14.0,52.0,8.0,248.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,2.0,144.0,499.0,499.0,8.0,499.0,4.0,499.0,43.0,286.0,499.0,499.0,9.0,16.0,57.0,107.0,9.0,16.0,57.0,499.0,4.0,499.0,392.0,253.0,343.0,7.0,4.0,261.0,98.0,499.0,19.0,57.0,499.0,499.0,14.0,14.0,25.0,14.0,14.0,52.0,8.0,248.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,2.0,144.0,499.0,499.0,8.0,499.0,4.0,499.0,43.0,286.0,499.0,499.0,9.0,16.0,57.0,107.0,9.0,16.0,57.0,499.0,4.0,499.0,392.0,253.0,343.0,7.0,4.0,261.0,98.0,499.0,19.0,57.0,499.0,499.0,14.0,14.0,1.0,7.0,0.0,12.0,16.0,8.0,239.0,499.0,476.0,12.0,16.0,8.0,239.0,499.0,476.0,1.0,22.0,0.0,49.0,202.0,3.0,17.0,123.0,12.0,49.0,499.0,499.0,499.0,72.0,12.0,499.0,499.0,42.0,147.0,3.0,17.0,92.0,235.0,203.0,49.0,202.0,3.0,17.0,123.0,12.0,49.0,499.0,499.0,499.0,72.0,12.0,499.0,499.0,42.0,147.0,3.0,17.0,92.0,235.0,203.0,1.0,34.0,0.0,22.0,11.0,443.0,306.0,10.0,164.0,499.0,499.0,11.0,305.0,2.0,499.0,10.0,2.0,499.0,57.0,499.0,6.0,102.0,417.0,499.0,499.0,25.0,45.0,28.0,380.0,499.0,499.0,56.0,8.0,115.0,32.0,97.0,22.0,11.0,443.0,306.0,10.0,164.0,499.0,499.0,11.0,305.0,2.0,499.0,10.0,2.0,499.0,57.0,499.0,6.0,102.0,417.0,499.0,499.0,25.0,45.0,28.0,380.0,499.0,499.0,56.0,8.0,115.0,32.0,97.0,1.0,22.0,0.0,26.0,47.0,88.0,8.0,499.0,499.0,47.0,111.0,118.0,4.0,178.0,12.0,286.0,9.0,60.0,21.0,2.0,190.0,10.0,183.0,499.0,26.0,47.0,88.0,8.0,499.0,499.0,47.0,111.0,118.0,4.0,178.0,12.0,286.0,9.0,60.0,21.0,2.0,190.0,10.0,183.0,499.0,1.0,27.0,0.0,2.0,499.0,111.0,21.0,499.0,15.0,2.0,499.0,499.0,25.0,188.0,66.0,104.0,8.0,499.0,499.0,499.0,38.0,3.0,17.0,22.0,4.0,21.0,499.0,20.0,9.0,2.0,499.0,111.0,21.0,499.0,15.0,2.0,499.0,499.0,25.0,188.0,66.0,104.0,8.0,499.0,499.0,499.0,38.0,3.0,17.0,22.0,4.0,21.0,499.0,20.0,9.0,1.0,14.0,0.0,75.0,45.0,16.0,55.0,499.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,499.0,75.0,45.0,16.0,55.0,499.0,499.0,4.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,7.0,0.0,196.0,12.0,499.0,4.0,126.0,499.0,196.0,12.0,499.0,4.0,126.0,499.0,1.0,14.0,0.0,136.0,8.0,211.0,11.0,34.0,168.0,181.0,20.0,2.0,499.0,33.0,19.0,227.0,136.0,8.0,211.0,11.0,34.0,168.0,181.0,20.0,2.0,499.0,33.0,19.0,227.0,1.0,10.0,0.0,324.0,11.0,91.0,283.0,53.0,11.0,104.0,4.0,51.0,324.0,11.0,91.0,283.0,53.0,11.0,104.0,4.0,51.0,1.0,19.0,0.0,9.0,3.0,18.0,374.0,12.0,431.0,499.0,3.0,17.0,499.0,55.0,499.0,33.0,499.0,499.0,16.0,499.0,499.0,9.0,3.0,18.0,374.0,12.0,431.0,499.0,3.0,17.0,499.0,55.0,499.0,33.0,499.0,499.0,16.0,499.0,499.0,1.0,18.0,0.0,45.0,16.0,8.0,340.0,12.0,59.0,42.0,3.0,18.0,499.0,62.0,499.0,499.0,4.0,46.0,499.0,499.0,45.0,16.0,8.0,340.0,12.0,59.0,42.0,3.0,18.0,499.0,62.0,499.0,499.0,4.0,46.0,499.0,499.0,1.0,11.0,0.0,9.0,3.0,18.0,499.0,429.0,25.0,9.0,16.0,8.0,340.0,9.0,3.0,18.0,499.0,429.0,25.0,9.0,16.0,8.0,340.0,1.0,52.0,0.0,45.0,16.0,75.0,8.0,499.0,340.0,26.0,2.0,499.0,29.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,30.0,499.0,58.0,499.0,499.0,68.0,499.0,13.0,499.0,499.0,499.0,19.0,499.0,499.0,64.0,431.0,68.0,10.0,499.0,48.0,2.0,499.0,23.0,2.0,499.0,499.0,499.0,89.0,499.0,499.0,28.0,27.0,499.0,499.0,45.0,16.0,75.0,8.0,499.0,340.0,26.0,2.0,499.0,29.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,30.0,499.0,58.0,499.0,499.0,68.0,499.0,13.0,499.0,499.0,499.0,19.0,499.0,499.0,64.0,431.0,68.0,10.0,499.0,48.0,2.0,499.0,23.0,2.0,499.0,499.0,499.0,89.0,499.0,499.0,28.0,27.0,499.0,499.0,1.0,23.0,0.0,24.0,143.0,2.0,499.0,10.0,136.0,499.0,53.0,4.0,51.0,7.0,28.0,64.0,145.0,63.0,286.0,2.0,412.0,10.0,2.0,499.0,499.0,24.0,143.0,2.0,499.0,10.0,136.0,499.0,53.0,4.0,51.0,7.0,28.0,64.0,145.0,63.0,286.0,2.0,412.0,10.0,2.0,499.0,499.0,1.0,49.0,0.0,9.0,3.0,18.0,27.0,40.0,499.0,12.0,406.0,431.0,28.0,499.0,9.0,3.0,18.0,2.0,499.0,499.0,499.0,68.0,2.0,499.0,499.0,16.0,499.0,7.0,45.0,56.0,160.0,81.0,8.0,499.0,499.0,499.0,499.0,12.0,56.0,499.0,45.0,16.0,8.0,499.0,499.0,4.0,70.0,499.0,15.0,118.0,499.0,9.0,3.0,18.0,27.0,40.0,499.0,12.0,406.0,431.0,28.0,499.0,9.0,3.0,18.0,2.0,499.0,499.0,499.0,68.0,2.0,499.0,499.0,16.0,499.0,7.0,45.0,56.0,160.0,81.0,8.0,499.0,499.0,499.0,499.0,12.0,56.0,499.0,45.0,16.0,8.0,499.0,499.0,4.0,70.0,499.0,15.0,118.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,27.0,0.0,499.0,10.0,42.0,143.0,431.0,7.0,42.0,66.0,143.0,431.0,28.0,55.0,58.0,376.0,4.0,499.0,70.0,303.0,10.0,499.0,69.0,188.0,66.0,38.0,3.0,17.0,499.0,10.0,42.0,143.0,431.0,7.0,42.0,66.0,143.0,431.0,28.0,55.0,58.0,376.0,4.0,499.0,70.0,303.0,10.0,499.0,69.0,188.0,66.0,38.0,3.0,17.0,1.0,21.0,0.0,6.0,72.0,341.0,8.0,499.0,10.0,499.0,25.0,394.0,6.0,160.0,499.0,70.0,499.0,499.0,20.0,2.0,233.0,32.0,499.0,6.0,72.0,341.0,8.0,499.0,10.0,499.0,25.0,394.0,6.0,160.0,499.0,70.0,499.0,499.0,20.0,2.0,233.0,32.0,499.0,1.0,23.0,0.0,152.0,11.0,111.0,75.0,499.0,73.0,499.0,499.0,7.0,499.0,172.0,4.0,226.0,2.0,83.0,20.0,2.0,499.0,499.0,10.0,499.0,499.0,152.0,11.0,111.0,75.0,499.0,73.0,499.0,499.0,7.0,499.0,172.0,4.0,226.0,2.0,83.0,20.0,2.0,499.0,499.0,10.0,499.0,499.0,1.0,35.0,0.0,6.0,127.0,499.0,2.0,424.0,499.0,62.0,166.0,39.0,499.0,100.0,230.0,2.0,499.0,499.0,211.0,217.0,499.0,4.0,67.0,27.0,499.0,125.0,499.0,3.0,18.0,499.0,499.0,28.0,499.0,30.0,16.0,399.0,223.0,6.0,127.0,499.0,2.0,424.0,499.0,62.0,166.0,39.0,499.0,100.0,230.0,2.0,499.0,499.0,211.0,217.0,499.0,4.0,67.0,27.0,499.0,125.0,499.0,3.0,18.0,499.0,499.0,28.0,499.0,30.0,16.0,399.0,223.0,1.0,33.0,0.0,6.0,3.0,110.0,427.0,88.0,43.0,499.0,338.0,3.0,17.0,499.0,2.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,291.0,119.0,6.0,499.0,30.0,499.0,499.0,7.0,499.0,15.0,249.0,20.0,9.0,6.0,3.0,110.0,427.0,88.0,43.0,499.0,338.0,3.0,17.0,499.0,2.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,291.0,119.0,6.0,499.0,30.0,499.0,499.0,7.0,499.0,15.0,249.0,20.0,9.0,1.0,16.0,0.0,9.0,3.0,18.0,499.0,187.0,205.0,499.0,4.0,499.0,32.0,97.0,32.0,400.0,7.0,499.0,9.0,3.0,18.0,499.0,187.0,205.0,499.0,4.0,499.0,32.0,97.0,32.0,400.0,7.0,499.0,1.0,7.0,0.0,27.0,223.0,25.0,252.0,32.0,499.0,27.0,223.0,25.0,252.0,32.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,499.0,216.0,5.0,5.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,309.0,499.0,499.0,28.0,15.0,39.0,499.0,223.0,32.0,97.0,32.0,57.0,499.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,309.0,499.0,499.0,28.0,15.0,39.0,499.0,223.0,32.0,97.0,32.0,57.0,499.0,499.0,1.0,32.0,0.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,499.0,250.0,2.0,499.0,499.0,214.0,102.0,101.0,261.0,2.0,144.0,391.0,10.0,499.0,7.0,2.0,499.0,499.0,16.0,399.0,317.0,13.0,499.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,499.0,250.0,2.0,499.0,499.0,214.0,102.0,101.0,261.0,2.0,144.0,391.0,10.0,499.0,7.0,2.0,499.0,499.0,16.0,399.0,317.0,13.0,499.0,1.0,52.0,0.0,34.0,143.0,8.0,499.0,58.0,499.0,499.0,41.0,27.0,223.0,25.0,214.0,102.0,101.0,7.0,91.0,122.0,9.0,86.0,413.0,83.0,14.0,14.0,499.0,499.0,499.0,499.0,499.0,4.0,21.0,499.0,4.0,2.0,499.0,413.0,83.0,499.0,14.0,14.0,254.0,499.0,499.0,28.0,87.0,96.0,91.0,21.0,15.0,413.0,83.0,105.0,34.0,143.0,8.0,499.0,58.0,499.0,499.0,41.0,27.0,223.0,25.0,214.0,102.0,101.0,7.0,91.0,122.0,9.0,86.0,413.0,83.0,14.0,14.0,499.0,499.0,499.0,499.0,499.0,4.0,21.0,499.0,4.0,2.0,499.0,413.0,83.0,499.0,14.0,14.0,254.0,499.0,499.0,28.0,87.0,96.0,91.0,21.0,15.0,413.0,83.0,105.0,1.0,35.0,0.0,499.0,19.0,499.0,499.0,499.0,499.0,19.0,146.0,251.0,298.0,499.0,7.0,499.0,28.0,126.0,7.0,499.0,499.0,4.0,499.0,499.0,181.0,31.0,499.0,12.0,34.0,499.0,58.0,499.0,25.0,57.0,499.0,16.0,499.0,499.0,19.0,499.0,499.0,499.0,499.0,19.0,146.0,251.0,298.0,499.0,7.0,499.0,28.0,126.0,7.0,499.0,499.0,4.0,499.0,499.0,181.0,31.0,499.0,12.0,34.0,499.0,58.0,499.0,25.0,57.0,499.0,16.0,499.0,1.0,13.0,0.0,111.0,21.0,126.0,19.0,499.0,499.0,499.0,15.0,499.0,7.0,499.0,499.0,111.0,21.0,126.0,19.0,499.0,499.0,499.0,15.0,499.0,7.0,499.0,499.0,1.0,18.0,0.0,499.0,28.0,2.0,499.0,87.0,344.0,499.0,25.0,34.0,261.0,297.0,499.0,499.0,499.0,19.0,499.0,499.0,499.0,28.0,2.0,499.0,87.0,344.0,499.0,25.0,34.0,261.0,297.0,499.0,499.0,499.0,19.0,499.0,499.0,1.0,11.0,0.0,6.0,499.0,2.0,499.0,7.0,499.0,499.0,273.0,468.0,499.0,6.0,499.0,2.0,499.0,7.0,499.0,499.0,273.0,468.0,499.0,1.0,33.0,0.0,2.0,499.0,499.0,468.0,16.0,218.0,25.0,2.0,499.0,468.0,16.0,8.0,244.0,499.0,7.0,488.0,4.0,21.0,499.0,442.0,499.0,16.0,8.0,87.0,494.0,499.0,499.0,2.0,499.0,111.0,21.0,101.0,2.0,499.0,499.0,468.0,16.0,218.0,25.0,2.0,499.0,468.0,16.0,8.0,244.0,499.0,7.0,488.0,4.0,21.0,499.0,442.0,499.0,16.0,8.0,87.0,494.0,499.0,499.0,2.0,499.0,111.0,21.0,101.0,1.0,39.0,0.0,6.0,3.0,110.0,31.0,4.0,22.0,188.0,15.0,2.0,83.0,7.0,6.0,77.0,443.0,299.0,8.0,499.0,211.0,499.0,25.0,45.0,16.0,295.0,46.0,499.0,63.0,499.0,2.0,499.0,499.0,211.0,6.0,499.0,499.0,499.0,372.0,32.0,97.0,6.0,3.0,110.0,31.0,4.0,22.0,188.0,15.0,2.0,83.0,7.0,6.0,77.0,443.0,299.0,8.0,499.0,211.0,499.0,25.0,45.0,16.0,295.0,46.0,499.0,63.0,499.0,2.0,499.0,499.0,211.0,6.0,499.0,499.0,499.0,372.0,32.0,97.0,1.0,12.0,0.0,6.0,499.0,2.0,304.0,499.0,273.0,499.0,273.0,2.0,413.0,372.0,6.0,499.0,2.0,304.0,499.0,273.0,499.0,273.0,2.0,413.0,372.0,1.0,22.0,0.0,297.0,499.0,372.0,261.0,369.0,2.0,144.0,304.0,5.0,499.0,499.0,7.0,2.0,499.0,499.0,372.0,28.0,40.0,499.0,219.0,499.0,297.0,499.0,372.0,261.0,369.0,2.0,144.0,304.0,5.0,499.0,499.0,7.0,2.0,499.0,499.0,372.0,28.0,40.0,499.0,219.0,499.0,1.0,22.0,0.0,6.0,499.0,499.0,30.0,211.0,9.0,499.0,126.0,499.0,20.0,2.0,499.0,499.0,499.0,499.0,7.0,2.0,499.0,372.0,32.0,97.0,6.0,499.0,499.0,30.0,211.0,9.0,499.0,126.0,499.0,20.0,2.0,499.0,499.0,499.0,499.0,7.0,2.0,499.0,372.0,32.0,97.0,1.0,15.0,0.0,195.0,126.0,211.0,12.0,91.0,21.0,15.0,413.0,83.0,499.0,4.0,21.0,499.0,499.0,195.0,126.0,211.0,12.0,91.0,21.0,15.0,413.0,83.0,499.0,4.0,21.0,499.0,499.0,1.0,10.0,0.0,361.0,31.0,8.0,177.0,10.0,499.0,499.0,499.0,499.0,361.0,31.0,8.0,177.0,10.0,499.0,499.0,499.0,499.0,1.0,43.0,0.0,6.0,499.0,78.0,146.0,474.0,499.0,111.0,185.0,197.0,23.0,499.0,499.0,26.0,499.0,251.0,499.0,8.0,101.0,476.0,69.0,6.0,25.0,11.0,91.0,22.0,499.0,4.0,53.0,49.0,361.0,31.0,19.0,188.0,499.0,20.0,66.0,11.0,28.0,499.0,48.0,31.0,67.0,6.0,499.0,78.0,146.0,474.0,499.0,111.0,185.0,197.0,23.0,499.0,499.0,26.0,499.0,251.0,499.0,8.0,101.0,476.0,69.0,6.0,25.0,11.0,91.0,22.0,499.0,4.0,53.0,49.0,361.0,31.0,19.0,188.0,499.0,20.0,66.0,11.0,28.0,499.0,48.0,31.0,67.0,1.0,21.0,0.0,26.0,36.0,499.0,16.0,499.0,12.0,499.0,36.0,499.0,499.0,28.0,116.0,499.0,36.0,499.0,499.0,499.0,5.0,5.0,80.0,26.0,36.0,499.0,16.0,499.0,12.0,499.0,36.0,499.0,499.0,28.0,116.0,499.0,36.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,174.0,0.0,35.0,5.0,499.0,5.0,489.0,13.0,499.0,230.0,39.0,489.0,16.0,499.0,352.0,5.0,145.0,7.0,6.0,104.0,4.0,499.0,48.0,228.0,378.0,5.0,266.0,125.0,6.0,499.0,39.0,499.0,32.0,499.0,499.0,486.0,489.0,170.0,39.0,409.0,16.0,499.0,119.0,133.0,6.0,104.0,4.0,350.0,228.0,378.0,5.0,266.0,228.0,378.0,5.0,499.0,14.0,499.0,378.0,5.0,352.0,288.0,499.0,352.0,5.0,499.0,25.0,26.0,6.0,499.0,39.0,499.0,74.0,499.0,499.0,5.0,298.0,499.0,5.0,145.0,4.0,499.0,352.0,5.0,145.0,6.0,3.0,110.0,21.0,499.0,39.0,489.0,7.0,87.0,499.0,31.0,11.0,499.0,309.0,306.0,6.0,51.0,48.0,499.0,352.0,5.0,499.0,10.0,499.0,7.0,499.0,39.0,499.0,4.0,499.0,352.0,5.0,145.0,40.0,499.0,39.0,489.0,250.0,39.0,499.0,499.0,432.0,266.0,16.0,114.0,31.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,499.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,13.0,499.0,264.0,192.0,4.0,39.0,499.0,10.0,499.0,416.0,30.0,44.0,499.0,499.0,221.0,67.0,78.0,26.0,11.0,3.0,110.0,31.0,195.0,330.0,20.0,36.0,499.0,35.0,5.0,499.0,5.0,489.0,13.0,499.0,230.0,39.0,489.0,16.0,499.0,352.0,5.0,145.0,7.0,6.0,104.0,4.0,499.0,48.0,228.0,378.0,5.0,266.0,125.0,6.0,499.0,39.0,499.0,32.0,499.0,499.0,486.0,489.0,170.0,39.0,409.0,16.0,499.0,119.0,133.0,6.0,104.0,4.0,350.0,228.0,378.0,5.0,266.0,228.0,378.0,5.0,499.0,14.0,499.0,378.0,5.0,352.0,288.0,499.0,352.0,5.0,499.0,25.0,26.0,6.0,499.0,39.0,499.0,74.0,499.0,499.0,5.0,298.0,499.0,5.0,145.0,4.0,499.0,352.0,5.0,145.0,6.0,3.0,110.0,21.0,499.0,39.0,489.0,7.0,87.0,499.0,31.0,11.0,499.0,309.0,306.0,6.0,51.0,48.0,499.0,352.0,5.0,499.0,10.0,499.0,7.0,499.0,39.0,499.0,4.0,499.0,352.0,5.0,145.0,40.0,499.0,39.0,489.0,250.0,39.0,499.0,499.0,432.0,266.0,16.0,114.0,31.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,499.0,499.0,13.0,499.0,14.0,298.0,13.0,499.0,288.0,13.0,499.0,264.0,192.0,4.0,39.0,499.0,10.0,499.0,416.0,30.0,44.0,499.0,499.0,221.0,67.0,78.0,26.0,11.0,3.0,110.0,31.0,195.0,330.0,20.0,36.0,499.0,1.0,19.0,0.0,89.0,6.0,3.0,71.0,8.0,499.0,13.0,499.0,7.0,6.0,38.0,3.0,17.0,283.0,499.0,8.0,499.0,499.0,89.0,6.0,3.0,71.0,8.0,499.0,13.0,499.0,7.0,6.0,38.0,3.0,17.0,283.0,499.0,8.0,499.0,499.0,1.0,30.0,0.0,97.0,12.0,3.0,18.0,218.0,7.0,499.0,12.0,11.0,38.0,3.0,17.0,283.0,227.0,63.0,11.0,14.0,51.0,14.0,419.0,8.0,499.0,499.0,499.0,23.0,37.0,236.0,63.0,499.0,97.0,12.0,3.0,18.0,218.0,7.0,499.0,12.0,11.0,38.0,3.0,17.0,283.0,227.0,63.0,11.0,14.0,51.0,14.0,419.0,8.0,499.0,499.0,499.0,23.0,37.0,236.0,63.0,499.0,1.0,32.0,0.0,499.0,499.0,499.0,132.0,499.0,90.0,499.0,23.0,499.0,499.0,90.0,499.0,23.0,499.0,499.0,37.0,236.0,15.0,2.0,499.0,7.0,90.0,499.0,23.0,499.0,499.0,49.0,16.0,8.0,499.0,499.0,499.0,499.0,499.0,132.0,499.0,90.0,499.0,23.0,499.0,499.0,90.0,499.0,23.0,499.0,499.0,37.0,236.0,15.0,2.0,499.0,7.0,90.0,499.0,23.0,499.0,499.0,49.0,16.0,8.0,499.0,499.0,1.0,9.0,0.0,9.0,3.0,18.0,172.0,462.0,8.0,499.0,320.0,9.0,3.0,18.0,172.0,462.0,8.0,499.0,320.0,1.0,10.0,0.0,499.0,29.0,103.0,311.0,14.0,27.0,14.0,2.0,499.0,499.0,29.0,103.0,311.0,14.0,27.0,14.0,2.0,499.0,1.0,32.0,0.0,2.0,209.0,29.0,499.0,58.0,31.0,46.0,320.0,499.0,499.0,180.0,499.0,434.0,66.0,38.0,3.0,17.0,499.0,50.0,499.0,7.0,2.0,499.0,499.0,499.0,482.0,499.0,20.0,90.0,499.0,499.0,2.0,209.0,29.0,499.0,58.0,31.0,46.0,320.0,499.0,499.0,180.0,499.0,434.0,66.0,38.0,3.0,17.0,499.0,50.0,499.0,7.0,2.0,499.0,499.0,499.0,482.0,499.0,20.0,90.0,499.0,499.0,1.0,26.0,0.0,499.0,499.0,499.0,2.0,434.0,2.0,233.0,24.0,499.0,499.0,90.0,499.0,7.0,267.0,73.0,278.0,499.0,61.0,499.0,499.0,499.0,15.0,499.0,499.0,410.0,499.0,499.0,499.0,2.0,434.0,2.0,233.0,24.0,499.0,499.0,90.0,499.0,7.0,267.0,73.0,278.0,499.0,61.0,499.0,499.0,499.0,15.0,499.0,499.0,410.0,1.0,26.0,0.0,97.0,9.0,3.0,18.0,411.0,4.0,328.0,47.0,28.0,44.0,499.0,152.0,499.0,499.0,213.0,27.0,499.0,499.0,15.0,499.0,47.0,91.0,499.0,499.0,499.0,97.0,9.0,3.0,18.0,411.0,4.0,328.0,47.0,28.0,44.0,499.0,152.0,499.0,499.0,213.0,27.0,499.0,499.0,15.0,499.0,47.0,91.0,499.0,499.0,499.0,1.0,17.0,0.0,499.0,11.0,111.0,77.0,22.0,8.0,126.0,499.0,499.0,20.0,203.0,499.0,2.0,499.0,77.0,499.0,499.0,11.0,111.0,77.0,22.0,8.0,126.0,499.0,499.0,20.0,203.0,499.0,2.0,499.0,77.0,499.0,1.0,8.0,0.0,499.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,499.0,2.0,499.0,10.0,134.0,499.0,1.0,14.0,0.0,2.0,499.0,499.0,57.0,499.0,37.0,499.0,13.0,499.0,317.0,13.0,499.0,499.0,2.0,499.0,499.0,57.0,499.0,37.0,499.0,13.0,499.0,317.0,13.0,499.0,499.0,1.0,25.0,0.0,2.0,499.0,499.0,499.0,12.0,32.0,8.0,499.0,4.0,2.0,107.0,7.0,499.0,499.0,12.0,24.0,88.0,499.0,2.0,103.0,499.0,499.0,15.0,499.0,2.0,499.0,499.0,499.0,12.0,32.0,8.0,499.0,4.0,2.0,107.0,7.0,499.0,499.0,12.0,24.0,88.0,499.0,2.0,103.0,499.0,499.0,15.0,499.0,1.0,22.0,0.0,12.0,3.0,18.0,108.0,2.0,499.0,499.0,57.0,499.0,7.0,499.0,499.0,397.0,77.0,210.0,499.0,9.0,499.0,355.0,64.0,499.0,12.0,3.0,18.0,108.0,2.0,499.0,499.0,57.0,499.0,7.0,499.0,499.0,397.0,77.0,210.0,499.0,9.0,499.0,355.0,64.0,499.0,1.0,54.0,0.0,12.0,3.0,18.0,108.0,42.0,31.0,499.0,499.0,499.0,57.0,499.0,499.0,9.0,29.0,2.0,499.0,20.0,499.0,499.0,499.0,499.0,66.0,499.0,31.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,15.0,343.0,499.0,56.0,81.0,499.0,499.0,499.0,73.0,499.0,23.0,499.0,7.0,499.0,2.0,499.0,10.0,499.0,86.0,255.0,499.0,12.0,3.0,18.0,108.0,42.0,31.0,499.0,499.0,499.0,57.0,499.0,499.0,9.0,29.0,2.0,499.0,20.0,499.0,499.0,499.0,499.0,66.0,499.0,31.0,499.0,499.0,2.0,499.0,499.0,10.0,2.0,499.0,15.0,343.0,499.0,56.0,81.0,499.0,499.0,499.0,73.0,499.0,23.0,499.0,7.0,499.0,2.0,499.0,10.0,499.0,86.0,255.0,499.0,1.0,44.0,0.0,203.0,499.0,192.0,4.0,423.0,2.0,499.0,48.0,2.0,499.0,3.0,18.0,499.0,499.0,2.0,499.0,56.0,56.0,499.0,2.0,499.0,499.0,57.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,24.0,3.0,54.0,499.0,499.0,19.0,9.0,30.0,121.0,52.0,499.0,499.0,9.0,203.0,499.0,192.0,4.0,423.0,2.0,499.0,48.0,2.0,499.0,3.0,18.0,499.0,499.0,2.0,499.0,56.0,56.0,499.0,2.0,499.0,499.0,57.0,499.0,7.0,6.0,38.0,3.0,17.0,65.0,24.0,3.0,54.0,499.0,499.0,19.0,9.0,30.0,121.0,52.0,499.0,499.0,9.0,1.0,20.0,0.0,499.0,2.0,499.0,10.0,499.0,366.0,22.0,346.0,4.0,499.0,86.0,499.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,499.0,2.0,499.0,10.0,499.0,366.0,22.0,346.0,4.0,499.0,86.0,499.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,1.0,17.0,0.0,39.0,124.0,16.0,499.0,3.0,18.0,40.0,8.0,499.0,10.0,499.0,16.0,499.0,15.0,30.0,276.0,39.0,124.0,16.0,499.0,3.0,18.0,40.0,8.0,499.0,10.0,499.0,16.0,499.0,15.0,30.0,276.0,1.0,20.0,0.0,499.0,499.0,37.0,2.0,124.0,12.0,59.0,10.0,164.0,499.0,28.0,136.0,499.0,7.0,294.0,499.0,499.0,7.0,499.0,499.0,499.0,37.0,2.0,124.0,12.0,59.0,10.0,164.0,499.0,28.0,136.0,499.0,7.0,294.0,499.0,499.0,7.0,499.0,1.0,5.0,0.0,290.0,5.0,5.0,80.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,6.0,0.0,35.0,5.0,499.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,1.0,22.0,0.0,499.0,499.0,224.0,12.0,279.0,12.0,139.0,111.0,499.0,499.0,2.0,499.0,48.0,499.0,499.0,499.0,22.0,499.0,37.0,499.0,499.0,499.0,499.0,224.0,12.0,279.0,12.0,139.0,111.0,499.0,499.0,2.0,499.0,48.0,499.0,499.0,499.0,22.0,499.0,37.0,499.0,499.0,1.0,17.0,0.0,100.0,3.0,18.0,53.0,6.0,127.0,499.0,4.0,11.0,47.0,91.0,499.0,7.0,499.0,134.0,499.0,100.0,3.0,18.0,53.0,6.0,127.0,499.0,4.0,11.0,47.0,91.0,499.0,7.0,499.0,134.0,499.0,1.0,11.0,0.0,47.0,91.0,151.0,283.0,53.0,16.0,7.0,16.0,27.0,499.0,47.0,91.0,151.0,283.0,53.0,16.0,7.0,16.0,27.0,499.0,1.0,23.0,0.0,499.0,8.0,209.0,206.0,9.0,4.0,2.0,499.0,10.0,499.0,7.0,45.0,29.0,8.0,385.0,499.0,499.0,16.0,499.0,10.0,134.0,499.0,499.0,8.0,209.0,206.0,9.0,4.0,2.0,499.0,10.0,499.0,7.0,45.0,29.0,8.0,385.0,499.0,499.0,16.0,499.0,10.0,134.0,499.0,1.0,33.0,0.0,47.0,91.0,21.0,173.0,4.0,143.0,2.0,499.0,7.0,122.0,9.0,86.0,499.0,499.0,7.0,9.0,60.0,112.0,21.0,55.0,63.0,3.0,18.0,499.0,6.0,111.0,72.0,65.0,216.0,5.0,5.0,257.0,47.0,91.0,21.0,173.0,4.0,143.0,2.0,499.0,7.0,122.0,9.0,86.0,499.0,499.0,7.0,9.0,60.0,112.0,21.0,55.0,63.0,3.0,18.0,499.0,6.0,111.0,72.0,65.0,216.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,6.0,0.0,438.0,5.0,140.0,5.0,499.0,438.0,5.0,140.0,5.0,499.0,1.0,6.0,0.0,9.0,3.0,18.0,499.0,499.0,9.0,3.0,18.0,499.0,499.0,1.0,22.0,0.0,25.0,59.0,10.0,57.0,499.0,16.0,499.0,4.0,214.0,7.0,56.0,8.0,499.0,499.0,499.0,499.0,12.0,499.0,61.0,37.0,11.0,25.0,59.0,10.0,57.0,499.0,16.0,499.0,4.0,214.0,7.0,56.0,8.0,499.0,499.0,499.0,499.0,12.0,499.0,61.0,37.0,11.0,1.0,14.0,0.0,9.0,499.0,59.0,499.0,499.0,25.0,12.0,3.0,18.0,128.0,10.0,2.0,252.0,9.0,499.0,59.0,499.0,499.0,25.0,12.0,3.0,18.0,128.0,10.0,2.0,252.0,1.0,19.0,0.0,103.0,42.0,499.0,9.0,32.0,499.0,19.0,42.0,66.0,34.0,3.0,17.0,499.0,296.0,499.0,25.0,6.0,499.0,103.0,42.0,499.0,9.0,32.0,499.0,19.0,42.0,66.0,34.0,3.0,17.0,499.0,296.0,499.0,25.0,6.0,499.0,1.0,15.0,0.0,45.0,28.0,59.0,499.0,31.0,57.0,499.0,12.0,28.0,499.0,499.0,7.0,499.0,499.0,45.0,28.0,59.0,499.0,31.0,57.0,499.0,12.0,28.0,499.0,499.0,7.0,499.0,499.0,1.0,29.0,0.0,6.0,95.0,41.0,132.0,499.0,7.0,499.0,499.0,499.0,153.0,499.0,499.0,7.0,32.0,8.0,499.0,499.0,9.0,3.0,18.0,499.0,4.0,95.0,43.0,50.0,355.0,20.0,9.0,6.0,95.0,41.0,132.0,499.0,7.0,499.0,499.0,499.0,153.0,499.0,499.0,7.0,32.0,8.0,499.0,499.0,9.0,3.0,18.0,499.0,4.0,95.0,43.0,50.0,355.0,20.0,9.0,1.0,30.0,0.0,188.0,499.0,28.0,27.0,19.0,36.0,499.0,24.0,3.0,54.0,19.0,2.0,499.0,10.0,381.0,251.0,23.0,2.0,499.0,7.0,235.0,499.0,499.0,31.0,30.0,63.0,499.0,499.0,499.0,188.0,499.0,28.0,27.0,19.0,36.0,499.0,24.0,3.0,54.0,19.0,2.0,499.0,10.0,381.0,251.0,23.0,2.0,499.0,7.0,235.0,499.0,499.0,31.0,30.0,63.0,499.0,499.0,499.0,1.0,28.0,0.0,499.0,499.0,387.0,125.0,60.0,22.0,163.0,25.0,9.0,29.0,499.0,32.0,9.0,3.0,18.0,27.0,499.0,98.0,25.0,46.0,499.0,387.0,10.0,46.0,295.0,499.0,211.0,499.0,499.0,387.0,125.0,60.0,22.0,163.0,25.0,9.0,29.0,499.0,32.0,9.0,3.0,18.0,27.0,499.0,98.0,25.0,46.0,499.0,387.0,10.0,46.0,295.0,499.0,211.0,1.0,15.0,0.0,2.0,499.0,4.0,499.0,7.0,453.0,9.0,73.0,16.0,100.0,290.0,5.0,5.0,499.0,2.0,499.0,4.0,499.0,7.0,453.0,9.0,73.0,16.0,100.0,290.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,22.0,0.0,35.0,5.0,499.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,228.0,13.0,499.0,13.0,499.0,35.0,5.0,499.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,228.0,13.0,499.0,13.0,499.0,1.0,18.0,0.0,499.0,16.0,499.0,97.0,192.0,74.0,2.0,499.0,12.0,246.0,64.0,499.0,499.0,15.0,8.0,499.0,455.0,499.0,16.0,499.0,97.0,192.0,74.0,2.0,499.0,12.0,246.0,64.0,499.0,499.0,15.0,8.0,499.0,455.0,1.0,19.0,0.0,2.0,72.0,499.0,499.0,12.0,499.0,7.0,499.0,499.0,16.0,499.0,19.0,57.0,499.0,499.0,27.0,499.0,452.0,2.0,72.0,499.0,499.0,12.0,499.0,7.0,499.0,499.0,16.0,499.0,19.0,57.0,499.0,499.0,27.0,499.0,452.0,1.0,13.0,0.0,499.0,499.0,46.0,499.0,107.0,4.0,146.0,499.0,57.0,200.0,499.0,499.0,499.0,499.0,46.0,499.0,107.0,4.0,146.0,499.0,57.0,200.0,499.0,499.0,1.0,10.0,0.0,6.0,38.0,3.0,17.0,65.0,24.0,28.0,499.0,499.0,6.0,38.0,3.0,17.0,65.0,24.0,28.0,499.0,499.0,1.0,27.0,0.0,324.0,499.0,68.0,24.0,34.0,3.0,17.0,499.0,499.0,499.0,405.0,92.0,149.0,499.0,4.0,365.0,73.0,4.0,57.0,499.0,3.0,499.0,7.0,240.0,43.0,499.0,324.0,499.0,68.0,24.0,34.0,3.0,17.0,499.0,499.0,499.0,405.0,92.0,149.0,499.0,4.0,365.0,73.0,4.0,57.0,499.0,3.0,499.0,7.0,240.0,43.0,499.0,1.0,9.0,0.0,6.0,34.0,95.0,30.0,499.0,4.0,106.0,152.0,6.0,34.0,95.0,30.0,499.0,4.0,106.0,152.0,1.0,34.0,0.0,6.0,394.0,423.0,9.0,60.0,21.0,101.0,19.0,106.0,4.0,168.0,27.0,499.0,203.0,66.0,138.0,3.0,17.0,499.0,33.0,246.0,61.0,4.0,106.0,499.0,7.0,123.0,12.0,207.0,499.0,4.0,499.0,43.0,6.0,394.0,423.0,9.0,60.0,21.0,101.0,19.0,106.0,4.0,168.0,27.0,499.0,203.0,66.0,138.0,3.0,17.0,499.0,33.0,246.0,61.0,4.0,106.0,499.0,7.0,123.0,12.0,207.0,499.0,4.0,499.0,43.0,1.0,44.0,0.0,45.0,28.0,499.0,499.0,26.0,11.0,499.0,499.0,13.0,2.0,499.0,425.0,499.0,13.0,499.0,425.0,499.0,499.0,13.0,499.0,15.0,499.0,3.0,18.0,499.0,13.0,499.0,15.0,499.0,13.0,499.0,37.0,499.0,13.0,499.0,425.0,499.0,3.0,18.0,499.0,467.0,499.0,499.0,45.0,28.0,499.0,499.0,26.0,11.0,499.0,499.0,13.0,2.0,499.0,425.0,499.0,13.0,499.0,425.0,499.0,499.0,13.0,499.0,15.0,499.0,3.0,18.0,499.0,13.0,499.0,15.0,499.0,13.0,499.0,37.0,499.0,13.0,499.0,425.0,499.0,3.0,18.0,499.0,467.0,499.0,499.0,1.0,12.0,0.0,6.0,3.0,120.0,81.0,499.0,52.0,6.0,22.0,81.0,499.0,499.0,6.0,3.0,120.0,81.0,499.0,52.0,6.0,22.0,81.0,499.0,499.0,1.0,60.0,0.0,6.0,65.0,9.0,16.0,168.0,12.0,24.0,469.0,208.0,251.0,4.0,499.0,73.0,7.0,28.0,499.0,19.0,43.0,85.0,28.0,105.0,499.0,4.0,499.0,11.0,499.0,33.0,12.0,24.0,38.0,3.0,17.0,65.0,9.0,62.0,21.0,285.0,57.0,210.0,32.0,11.0,163.0,3.0,17.0,21.0,499.0,12.0,102.0,499.0,7.0,41.0,24.0,163.0,3.0,17.0,50.0,8.0,373.0,499.0,6.0,65.0,9.0,16.0,168.0,12.0,24.0,469.0,208.0,251.0,4.0,499.0,73.0,7.0,28.0,499.0,19.0,43.0,85.0,28.0,105.0,499.0,4.0,499.0,11.0,499.0,33.0,12.0,24.0,38.0,3.0,17.0,65.0,9.0,62.0,21.0,285.0,57.0,210.0,32.0,11.0,163.0,3.0,17.0,21.0,499.0,12.0,102.0,499.0,7.0,41.0,24.0,163.0,3.0,17.0,50.0,8.0,373.0,499.0,1.0,12.0,0.0,45.0,62.0,21.0,76.0,42.0,66.0,365.0,61.0,10.0,499.0,105.0,45.0,62.0,21.0,76.0,42.0,66.0,365.0,61.0,10.0,499.0,105.0,1.0,9.0,0.0,38.0,3.0,17.0,305.0,19.0,70.0,499.0,499.0,38.0,3.0,17.0,305.0,19.0,70.0,499.0,499.0,1.0,24.0,0.0,11.0,3.0,109.0,72.0,174.0,227.0,499.0,52.0,24.0,123.0,55.0,7.0,11.0,3.0,109.0,21.0,32.0,499.0,32.0,136.0,499.0,33.0,499.0,11.0,3.0,109.0,72.0,174.0,227.0,499.0,52.0,24.0,123.0,55.0,7.0,11.0,3.0,109.0,21.0,32.0,499.0,32.0,136.0,499.0,33.0,499.0,1.0,10.0,0.0,294.0,13.0,499.0,23.0,363.0,499.0,19.0,499.0,237.0,294.0,13.0,499.0,23.0,363.0,499.0,19.0,499.0,237.0,1.0,7.0,0.0,499.0,53.0,4.0,335.0,11.0,499.0,499.0,53.0,4.0,335.0,11.0,499.0,1.0,25.0,0.0,61.0,10.0,499.0,6.0,40.0,499.0,2.0,499.0,10.0,44.0,499.0,42.0,499.0,23.0,39.0,499.0,250.0,499.0,119.0,499.0,119.0,499.0,125.0,499.0,61.0,10.0,499.0,6.0,40.0,499.0,2.0,499.0,10.0,44.0,499.0,42.0,499.0,23.0,39.0,499.0,250.0,499.0,119.0,499.0,119.0,499.0,125.0,499.0,1.0,7.0,0.0,44.0,10.0,43.0,88.0,499.0,499.0,44.0,10.0,43.0,88.0,499.0,499.0,1.0,15.0,0.0,6.0,75.0,499.0,2.0,499.0,13.0,499.0,259.0,19.0,8.0,210.0,119.0,237.0,499.0,6.0,75.0,499.0,2.0,499.0,13.0,499.0,259.0,19.0,8.0,210.0,119.0,237.0,499.0,1.0,16.0,0.0,9.0,29.0,8.0,499.0,429.0,52.0,47.0,202.0,3.0,17.0,174.0,8.0,499.0,15.0,499.0,9.0,29.0,8.0,499.0,429.0,52.0,47.0,202.0,3.0,17.0,174.0,8.0,499.0,15.0,499.0,1.0,35.0,0.0,36.0,231.0,499.0,239.0,102.0,499.0,369.0,53.0,30.0,499.0,29.0,48.0,499.0,7.0,499.0,499.0,499.0,10.0,412.0,20.0,499.0,16.0,239.0,499.0,13.0,499.0,26.0,499.0,191.0,2.0,499.0,13.0,499.0,499.0,36.0,231.0,499.0,239.0,102.0,499.0,369.0,53.0,30.0,499.0,29.0,48.0,499.0,7.0,499.0,499.0,499.0,10.0,412.0,20.0,499.0,16.0,239.0,499.0,13.0,499.0,26.0,499.0,191.0,2.0,499.0,13.0,499.0,499.0,1.0,31.0,0.0,2.0,231.0,499.0,11.0,149.0,31.0,11.0,499.0,88.0,8.0,499.0,128.0,10.0,227.0,499.0,22.0,11.0,88.0,4.0,333.0,20.0,2.0,499.0,10.0,8.0,499.0,499.0,10.0,36.0,499.0,2.0,231.0,499.0,11.0,149.0,31.0,11.0,499.0,88.0,8.0,499.0,128.0,10.0,227.0,499.0,22.0,11.0,88.0,4.0,333.0,20.0,2.0,499.0,10.0,8.0,499.0,499.0,10.0,36.0,499.0,1.0,35.0,0.0,2.0,72.0,121.0,6.0,29.0,499.0,499.0,74.0,114.0,31.0,30.0,29.0,79.0,499.0,176.0,484.0,10.0,499.0,23.0,499.0,56.0,298.0,13.0,228.0,499.0,10.0,499.0,499.0,499.0,14.0,93.0,14.0,2.0,484.0,2.0,72.0,121.0,6.0,29.0,499.0,499.0,74.0,114.0,31.0,30.0,29.0,79.0,499.0,176.0,484.0,10.0,499.0,23.0,499.0,56.0,298.0,13.0,228.0,499.0,10.0,499.0,499.0,499.0,14.0,93.0,14.0,2.0,484.0,1.0,30.0,0.0,2.0,499.0,499.0,136.0,372.0,64.0,2.0,484.0,11.0,3.0,54.0,48.0,4.0,220.0,41.0,24.0,499.0,499.0,2.0,484.0,93.0,11.0,77.0,50.0,8.0,499.0,4.0,220.0,9.0,2.0,499.0,499.0,136.0,372.0,64.0,2.0,484.0,11.0,3.0,54.0,48.0,4.0,220.0,41.0,24.0,499.0,499.0,2.0,484.0,93.0,11.0,77.0,50.0,8.0,499.0,4.0,220.0,9.0,1.0,37.0,0.0,7.0,492.0,11.0,22.0,8.0,499.0,4.0,220.0,44.0,10.0,2.0,499.0,15.0,8.0,499.0,11.0,22.0,55.0,117.0,4.0,78.0,79.0,132.0,499.0,11.0,156.0,4.0,499.0,4.0,50.0,4.0,2.0,14.0,499.0,14.0,484.0,7.0,492.0,11.0,22.0,8.0,499.0,4.0,220.0,44.0,10.0,2.0,499.0,15.0,8.0,499.0,11.0,22.0,55.0,117.0,4.0,78.0,79.0,132.0,499.0,11.0,156.0,4.0,499.0,4.0,50.0,4.0,2.0,14.0,499.0,14.0,484.0,1.0,9.0,0.0,499.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,1.0,23.0,0.0,460.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,10.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,10.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,1.0,28.0,0.0,460.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,1.0,21.0,0.0,460.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,223.0,499.0,499.0,499.0,460.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,223.0,499.0,499.0,499.0,1.0,37.0,0.0,499.0,16.0,499.0,475.0,499.0,499.0,499.0,499.0,475.0,499.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,499.0,321.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,16.0,499.0,475.0,499.0,499.0,499.0,499.0,475.0,499.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,499.0,321.0,499.0,499.0,16.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,1.0,42.0,0.0,6.0,22.0,81.0,8.0,373.0,499.0,10.0,499.0,17.0,7.0,499.0,499.0,19.0,228.0,113.0,237.0,6.0,127.0,15.0,39.0,272.0,3.0,18.0,49.0,56.0,81.0,499.0,19.0,136.0,8.0,499.0,37.0,236.0,170.0,499.0,499.0,496.0,61.0,19.0,2.0,499.0,6.0,22.0,81.0,8.0,373.0,499.0,10.0,499.0,17.0,7.0,499.0,499.0,19.0,228.0,113.0,237.0,6.0,127.0,15.0,39.0,272.0,3.0,18.0,49.0,56.0,81.0,499.0,19.0,136.0,8.0,499.0,37.0,236.0,170.0,499.0,499.0,496.0,61.0,19.0,2.0,499.0,1.0,14.0,0.0,6.0,127.0,27.0,499.0,49.0,499.0,499.0,351.0,356.0,6.0,78.0,48.0,371.0,6.0,127.0,27.0,499.0,49.0,499.0,499.0,351.0,356.0,6.0,78.0,48.0,371.0,1.0,22.0,0.0,499.0,37.0,499.0,499.0,45.0,10.0,2.0,256.0,12.0,499.0,499.0,499.0,19.0,2.0,499.0,194.0,483.0,49.0,29.0,2.0,415.0,499.0,37.0,499.0,499.0,45.0,10.0,2.0,256.0,12.0,499.0,499.0,499.0,19.0,2.0,499.0,194.0,483.0,49.0,29.0,2.0,415.0,1.0,18.0,0.0,499.0,2.0,499.0,131.0,8.0,96.0,499.0,259.0,41.0,12.0,147.0,3.0,17.0,130.0,49.0,29.0,189.0,499.0,2.0,499.0,131.0,8.0,96.0,499.0,259.0,41.0,12.0,147.0,3.0,17.0,130.0,49.0,29.0,189.0,1.0,26.0,0.0,7.0,49.0,499.0,8.0,177.0,15.0,2.0,231.0,462.0,10.0,2.0,499.0,25.0,49.0,3.0,18.0,142.0,8.0,499.0,4.0,162.0,93.0,49.0,499.0,499.0,7.0,49.0,499.0,8.0,177.0,15.0,2.0,231.0,462.0,10.0,2.0,499.0,25.0,49.0,3.0,18.0,142.0,8.0,499.0,4.0,162.0,93.0,49.0,499.0,499.0,1.0,15.0,0.0,31.0,9.0,33.0,27.0,499.0,147.0,3.0,17.0,92.0,130.0,12.0,9.0,16.0,499.0,31.0,9.0,33.0,27.0,499.0,147.0,3.0,17.0,92.0,130.0,12.0,9.0,16.0,499.0,1.0,16.0,0.0,9.0,40.0,499.0,9.0,3.0,18.0,8.0,115.0,4.0,148.0,153.0,499.0,36.0,499.0,499.0,9.0,40.0,499.0,9.0,3.0,18.0,8.0,115.0,4.0,148.0,153.0,499.0,36.0,499.0,499.0,1.0,20.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,148.0,68.0,24.0,3.0,54.0,98.0,7.0,499.0,10.0,226.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,148.0,68.0,24.0,3.0,54.0,98.0,7.0,499.0,10.0,226.0,499.0,1.0,14.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,185.0,61.0,499.0,499.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,185.0,61.0,499.0,499.0,499.0,1.0,13.0,0.0,4.0,59.0,12.0,34.0,130.0,293.0,61.0,499.0,4.0,57.0,175.0,499.0,4.0,59.0,12.0,34.0,130.0,293.0,61.0,499.0,4.0,57.0,175.0,499.0,1.0,18.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,51.0,36.0,499.0,20.0,499.0,175.0,499.0,24.0,31.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,51.0,36.0,499.0,20.0,499.0,175.0,499.0,24.0,31.0,1.0,18.0,0.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,448.0,33.0,499.0,2.0,499.0,10.0,59.0,175.0,499.0,4.0,59.0,12.0,34.0,130.0,8.0,115.0,4.0,448.0,33.0,499.0,2.0,499.0,10.0,59.0,175.0,499.0,1.0,19.0,0.0,4.0,59.0,9.0,34.0,130.0,8.0,115.0,4.0,148.0,32.0,499.0,52.0,24.0,22.0,8.0,499.0,499.0,499.0,4.0,59.0,9.0,34.0,130.0,8.0,115.0,4.0,148.0,32.0,499.0,52.0,24.0,22.0,8.0,499.0,499.0,499.0,1.0,6.0,0.0,24.0,22.0,8.0,499.0,499.0,24.0,22.0,8.0,499.0,499.0,1.0,18.0,0.0,27.0,187.0,499.0,25.0,45.0,91.0,21.0,63.0,499.0,499.0,13.0,499.0,15.0,2.0,499.0,10.0,499.0,27.0,187.0,499.0,25.0,45.0,91.0,21.0,63.0,499.0,499.0,13.0,499.0,15.0,2.0,499.0,10.0,499.0,1.0,13.0,0.0,55.0,63.0,56.0,224.0,9.0,291.0,25.0,9.0,91.0,21.0,45.0,499.0,55.0,63.0,56.0,224.0,9.0,291.0,25.0,9.0,91.0,21.0,45.0,499.0,1.0,12.0,0.0,9.0,3.0,110.0,21.0,499.0,26.0,208.0,224.0,9.0,499.0,119.0,9.0,3.0,110.0,21.0,499.0,26.0,208.0,224.0,9.0,499.0,119.0,1.0,62.0,0.0,68.0,8.0,238.0,499.0,19.0,79.0,4.0,51.0,499.0,499.0,499.0,67.0,100.0,72.0,4.0,335.0,67.0,499.0,11.0,91.0,51.0,12.0,139.0,11.0,3.0,54.0,293.0,4.0,499.0,61.0,79.0,4.0,499.0,499.0,499.0,27.0,223.0,3.0,18.0,499.0,25.0,15.0,276.0,203.0,251.0,499.0,86.0,30.0,499.0,100.0,3.0,18.0,79.0,11.0,51.0,9.0,230.0,174.0,46.0,499.0,499.0,68.0,8.0,238.0,499.0,19.0,79.0,4.0,51.0,499.0,499.0,499.0,67.0,100.0,72.0,4.0,335.0,67.0,499.0,11.0,91.0,51.0,12.0,139.0,11.0,3.0,54.0,293.0,4.0,499.0,61.0,79.0,4.0,499.0,499.0,499.0,27.0,223.0,3.0,18.0,499.0,25.0,15.0,276.0,203.0,251.0,499.0,86.0,30.0,499.0,100.0,3.0,18.0,79.0,11.0,51.0,9.0,230.0,174.0,46.0,499.0,499.0,1.0,7.0,0.0,6.0,499.0,499.0,15.0,499.0,499.0,6.0,499.0,499.0,15.0,499.0,499.0,1.0,30.0,0.0,499.0,64.0,499.0,13.0,499.0,19.0,330.0,25.0,24.0,3.0,54.0,23.0,8.0,499.0,44.0,172.0,2.0,98.0,499.0,45.0,3.0,18.0,116.0,8.0,499.0,499.0,5.0,5.0,499.0,499.0,64.0,499.0,13.0,499.0,19.0,330.0,25.0,24.0,3.0,54.0,23.0,8.0,499.0,44.0,172.0,2.0,98.0,499.0,45.0,3.0,18.0,116.0,8.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,19.0,0.0,35.0,5.0,140.0,5.0,499.0,125.0,499.0,23.0,2.0,499.0,3.0,18.0,499.0,269.0,93.0,499.0,5.0,499.0,35.0,5.0,140.0,5.0,499.0,125.0,499.0,23.0,2.0,499.0,3.0,18.0,499.0,269.0,93.0,499.0,5.0,499.0,1.0,16.0,0.0,9.0,3.0,18.0,15.0,36.0,499.0,499.0,2.0,495.0,74.0,2.0,499.0,5.0,499.0,499.0,9.0,3.0,18.0,15.0,36.0,499.0,499.0,2.0,495.0,74.0,2.0,499.0,5.0,499.0,499.0,1.0,19.0,0.0,9.0,3.0,18.0,8.0,499.0,139.0,12.0,499.0,23.0,119.0,100.0,3.0,18.0,180.0,6.0,29.0,278.0,499.0,9.0,3.0,18.0,8.0,499.0,139.0,12.0,499.0,23.0,119.0,100.0,3.0,18.0,180.0,6.0,29.0,278.0,499.0,1.0,68.0,0.0,466.0,36.0,499.0,33.0,499.0,7.0,9.0,62.0,162.0,4.0,8.0,499.0,20.0,8.0,272.0,5.0,272.0,7.0,9.0,163.0,3.0,17.0,221.0,11.0,51.0,499.0,84.0,29.0,2.0,124.0,6.0,346.0,395.0,238.0,499.0,7.0,224.0,30.0,139.0,48.0,79.0,499.0,2.0,139.0,6.0,34.0,3.0,17.0,51.0,16.0,309.0,38.0,3.0,17.0,51.0,53.0,6.0,157.0,306.0,51.0,30.0,250.0,465.0,2.0,400.0,499.0,499.0,466.0,36.0,499.0,33.0,499.0,7.0,9.0,62.0,162.0,4.0,8.0,499.0,20.0,8.0,272.0,5.0,272.0,7.0,9.0,163.0,3.0,17.0,221.0,11.0,51.0,499.0,84.0,29.0,2.0,124.0,6.0,346.0,395.0,238.0,499.0,7.0,224.0,30.0,139.0,48.0,79.0,499.0,2.0,139.0,6.0,34.0,3.0,17.0,51.0,16.0,309.0,38.0,3.0,17.0,51.0,53.0,6.0,157.0,306.0,51.0,30.0,250.0,465.0,2.0,400.0,499.0,499.0,1.0,7.0,0.0,499.0,112.0,38.0,3.0,17.0,78.0,499.0,112.0,38.0,3.0,17.0,78.0,1.0,68.0,0.0,40.0,51.0,9.0,254.0,133.0,11.0,34.0,465.0,499.0,499.0,400.0,7.0,324.0,59.0,76.0,167.0,196.0,6.0,112.0,38.0,3.0,17.0,78.0,53.0,3.0,18.0,99.0,23.0,25.0,9.0,329.0,499.0,298.0,135.0,499.0,164.0,499.0,499.0,11.0,3.0,120.0,88.0,19.0,125.0,418.0,153.0,8.0,499.0,32.0,4.0,53.0,24.0,157.0,11.0,34.0,118.0,499.0,499.0,13.0,13.0,84.0,16.0,2.0,499.0,30.0,167.0,400.0,40.0,51.0,9.0,254.0,133.0,11.0,34.0,465.0,499.0,499.0,400.0,7.0,324.0,59.0,76.0,167.0,196.0,6.0,112.0,38.0,3.0,17.0,78.0,53.0,3.0,18.0,99.0,23.0,25.0,9.0,329.0,499.0,298.0,135.0,499.0,164.0,499.0,499.0,11.0,3.0,120.0,88.0,19.0,125.0,418.0,153.0,8.0,499.0,32.0,4.0,53.0,24.0,157.0,11.0,34.0,118.0,499.0,499.0,13.0,13.0,84.0,16.0,2.0,499.0,30.0,167.0,400.0,1.0,35.0,0.0,11.0,3.0,109.0,50.0,114.0,499.0,499.0,442.0,499.0,12.0,167.0,499.0,2.0,499.0,16.0,499.0,499.0,162.0,4.0,36.0,487.0,7.0,133.0,188.0,499.0,62.0,280.0,11.0,2.0,499.0,4.0,499.0,499.0,43.0,11.0,3.0,109.0,50.0,114.0,499.0,499.0,442.0,499.0,12.0,167.0,499.0,2.0,499.0,16.0,499.0,499.0,162.0,4.0,36.0,487.0,7.0,133.0,188.0,499.0,62.0,280.0,11.0,2.0,499.0,4.0,499.0,499.0,43.0,1.0,37.0,0.0,6.0,78.0,326.0,48.0,79.0,4.0,50.0,2.0,190.0,167.0,53.0,2.0,499.0,51.0,25.0,9.0,3.0,18.0,8.0,393.0,7.0,9.0,3.0,18.0,101.0,69.0,499.0,37.0,238.0,19.0,323.0,11.0,100.0,19.0,46.0,471.0,6.0,78.0,326.0,48.0,79.0,4.0,50.0,2.0,190.0,167.0,53.0,2.0,499.0,51.0,25.0,9.0,3.0,18.0,8.0,393.0,7.0,9.0,3.0,18.0,101.0,69.0,499.0,37.0,238.0,19.0,323.0,11.0,100.0,19.0,46.0,471.0,1.0,2.0,0.0,499.0,499.0,1.0,20.0,0.0,89.0,2.0,499.0,499.0,499.0,499.0,459.0,23.0,90.0,499.0,432.0,266.0,19.0,8.0,499.0,10.0,48.0,499.0,459.0,89.0,2.0,499.0,499.0,499.0,499.0,459.0,23.0,90.0,499.0,432.0,266.0,19.0,8.0,499.0,10.0,48.0,499.0,459.0,1.0,28.0,0.0,15.0,2.0,499.0,499.0,89.0,499.0,486.0,499.0,459.0,7.0,12.0,3.0,18.0,499.0,7.0,499.0,10.0,15.0,13.0,7.0,13.0,499.0,19.0,2.0,499.0,7.0,499.0,15.0,2.0,499.0,499.0,89.0,499.0,486.0,499.0,459.0,7.0,12.0,3.0,18.0,499.0,7.0,499.0,10.0,15.0,13.0,7.0,13.0,499.0,19.0,2.0,499.0,7.0,499.0,1.0,23.0,0.0,6.0,186.0,3.0,17.0,21.0,8.0,258.0,499.0,26.0,46.0,499.0,20.0,12.0,132.0,459.0,23.0,9.0,499.0,59.0,499.0,499.0,499.0,6.0,186.0,3.0,17.0,21.0,8.0,258.0,499.0,26.0,46.0,499.0,20.0,12.0,132.0,459.0,23.0,9.0,499.0,59.0,499.0,499.0,499.0,1.0,11.0,0.0,9.0,147.0,3.0,17.0,22.0,12.0,499.0,6.0,451.0,499.0,9.0,147.0,3.0,17.0,22.0,12.0,499.0,6.0,451.0,499.0,1.0,11.0,0.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,50.0,105.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,50.0,105.0,1.0,30.0,0.0,9.0,3.0,18.0,32.0,26.0,223.0,7.0,2.0,499.0,15.0,2.0,499.0,202.0,3.0,17.0,78.0,12.0,72.0,499.0,7.0,499.0,22.0,8.0,499.0,33.0,499.0,23.0,57.0,499.0,9.0,3.0,18.0,32.0,26.0,223.0,7.0,2.0,499.0,15.0,2.0,499.0,202.0,3.0,17.0,78.0,12.0,72.0,499.0,7.0,499.0,22.0,8.0,499.0,33.0,499.0,23.0,57.0,499.0,1.0,30.0,0.0,44.0,2.0,379.0,168.0,22.0,168.0,499.0,499.0,33.0,499.0,499.0,499.0,136.0,499.0,2.0,103.0,499.0,7.0,74.0,44.0,2.0,379.0,6.0,127.0,499.0,48.0,254.0,76.0,499.0,44.0,2.0,379.0,168.0,22.0,168.0,499.0,499.0,33.0,499.0,499.0,499.0,136.0,499.0,2.0,103.0,499.0,7.0,74.0,44.0,2.0,379.0,6.0,127.0,499.0,48.0,254.0,76.0,499.0,1.0,17.0,0.0,499.0,223.0,16.0,8.0,499.0,7.0,2.0,499.0,15.0,12.0,499.0,29.0,8.0,499.0,20.0,223.0,499.0,223.0,16.0,8.0,499.0,7.0,2.0,499.0,15.0,12.0,499.0,29.0,8.0,499.0,20.0,223.0,1.0,9.0,0.0,499.0,14.0,14.0,377.0,499.0,5.0,5.0,80.0,499.0,14.0,14.0,377.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,113.0,499.0,14.0,14.0,269.0,499.0,13.0,499.0,499.0,5.0,5.0,257.0,35.0,5.0,499.0,113.0,499.0,14.0,14.0,269.0,499.0,13.0,499.0,499.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,71.0,0.0,438.0,5.0,140.0,5.0,499.0,230.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,14.0,14.0,499.0,14.0,14.0,14.0,14.0,499.0,14.0,14.0,5.0,499.0,499.0,499.0,89.0,15.0,8.0,499.0,499.0,499.0,2.0,499.0,499.0,98.0,499.0,7.0,499.0,56.0,499.0,8.0,499.0,13.0,499.0,499.0,499.0,10.0,499.0,499.0,42.0,499.0,32.0,499.0,310.0,438.0,5.0,140.0,5.0,499.0,230.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,14.0,14.0,499.0,14.0,14.0,14.0,14.0,499.0,14.0,14.0,5.0,499.0,499.0,499.0,89.0,15.0,8.0,499.0,499.0,499.0,2.0,499.0,499.0,98.0,499.0,7.0,499.0,56.0,499.0,8.0,499.0,13.0,499.0,499.0,499.0,10.0,499.0,499.0,42.0,499.0,32.0,499.0,310.0,1.0,20.0,0.0,499.0,2.0,499.0,28.0,499.0,499.0,13.0,499.0,66.0,122.0,2.0,499.0,499.0,499.0,7.0,85.0,499.0,2.0,499.0,499.0,2.0,499.0,28.0,499.0,499.0,13.0,499.0,66.0,122.0,2.0,499.0,499.0,499.0,7.0,85.0,499.0,2.0,499.0,1.0,44.0,0.0,499.0,377.0,16.0,461.0,2.0,190.0,37.0,53.0,49.0,213.0,7.0,49.0,16.0,499.0,8.0,499.0,499.0,499.0,66.0,157.0,27.0,499.0,2.0,499.0,499.0,19.0,2.0,409.0,25.0,66.0,56.0,63.0,499.0,103.0,51.0,499.0,207.0,16.0,8.0,499.0,20.0,499.0,499.0,499.0,377.0,16.0,461.0,2.0,190.0,37.0,53.0,49.0,213.0,7.0,49.0,16.0,499.0,8.0,499.0,499.0,499.0,66.0,157.0,27.0,499.0,2.0,499.0,499.0,19.0,2.0,409.0,25.0,66.0,56.0,63.0,499.0,103.0,51.0,499.0,207.0,16.0,8.0,499.0,20.0,499.0,499.0,1.0,34.0,0.0,24.0,499.0,174.0,499.0,499.0,499.0,499.0,8.0,499.0,209.0,201.0,12.0,499.0,461.0,132.0,379.0,499.0,13.0,499.0,8.0,499.0,66.0,499.0,2.0,499.0,10.0,499.0,15.0,499.0,310.0,499.0,13.0,499.0,24.0,499.0,174.0,499.0,499.0,499.0,499.0,8.0,499.0,209.0,201.0,12.0,499.0,461.0,132.0,379.0,499.0,13.0,499.0,8.0,499.0,66.0,499.0,2.0,499.0,10.0,499.0,15.0,499.0,310.0,499.0,13.0,499.0,1.0,38.0,0.0,499.0,13.0,499.0,499.0,2.0,201.0,171.0,499.0,12.0,377.0,7.0,499.0,62.0,160.0,196.0,95.0,2.0,433.0,10.0,145.0,14.0,499.0,14.0,14.0,14.0,499.0,499.0,14.0,14.0,89.0,2.0,359.0,499.0,499.0,499.0,64.0,499.0,499.0,13.0,499.0,499.0,2.0,201.0,171.0,499.0,12.0,377.0,7.0,499.0,62.0,160.0,196.0,95.0,2.0,433.0,10.0,145.0,14.0,499.0,14.0,14.0,14.0,499.0,499.0,14.0,14.0,89.0,2.0,359.0,499.0,499.0,499.0,64.0,499.0,1.0,111.0,0.0,23.0,499.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,301.0,23.0,499.0,499.0,20.0,46.0,312.0,499.0,10.0,499.0,5.0,499.0,2.0,499.0,3.0,18.0,499.0,499.0,499.0,499.0,74.0,499.0,499.0,7.0,499.0,499.0,499.0,499.0,15.0,499.0,13.0,499.0,7.0,499.0,499.0,377.0,499.0,16.0,8.0,429.0,330.0,10.0,8.0,499.0,12.0,161.0,499.0,23.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,61.0,10.0,499.0,301.0,23.0,499.0,499.0,499.0,499.0,33.0,312.0,499.0,499.0,499.0,499.0,12.0,2.0,312.0,499.0,499.0,499.0,2.0,359.0,29.0,8.0,499.0,23.0,8.0,499.0,10.0,499.0,113.0,4.0,358.0,14.0,436.0,14.0,58.0,499.0,37.0,499.0,5.0,5.0,80.0,23.0,499.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,301.0,23.0,499.0,499.0,20.0,46.0,312.0,499.0,10.0,499.0,5.0,499.0,2.0,499.0,3.0,18.0,499.0,499.0,499.0,499.0,74.0,499.0,499.0,7.0,499.0,499.0,499.0,499.0,15.0,499.0,13.0,499.0,7.0,499.0,499.0,377.0,499.0,16.0,8.0,429.0,330.0,10.0,8.0,499.0,12.0,161.0,499.0,23.0,499.0,2.0,359.0,56.0,8.0,499.0,10.0,499.0,61.0,10.0,499.0,301.0,23.0,499.0,499.0,499.0,499.0,33.0,312.0,499.0,499.0,499.0,499.0,12.0,2.0,312.0,499.0,499.0,499.0,2.0,359.0,29.0,8.0,499.0,23.0,8.0,499.0,10.0,499.0,113.0,4.0,358.0,14.0,436.0,14.0,58.0,499.0,37.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,499.0,113.0,499.0,499.0,5.0,5.0,257.0,35.0,5.0,499.0,113.0,499.0,499.0,5.0,5.0,257.0,1.0,2.0,0.0,436.0,436.0,1.0,6.0,0.0,438.0,5.0,499.0,5.0,499.0,438.0,5.0,499.0,5.0,499.0,1.0,7.0,0.0,499.0,499.0,499.0,5.0,5.0,80.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,11.0,0.0,35.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,71.0,5.0,499.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,10.0,0.0,35.0,5.0,300.0,5.0,377.0,499.0,5.0,5.0,80.0,35.0,5.0,300.0,5.0,377.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,20.0,0.0,35.0,5.0,436.0,5.0,499.0,5.0,377.0,14.0,6.0,127.0,8.0,215.0,14.0,499.0,67.0,499.0,5.0,5.0,80.0,35.0,5.0,436.0,5.0,499.0,5.0,377.0,14.0,6.0,127.0,8.0,215.0,14.0,499.0,67.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,6.0,0.0,35.0,5.0,158.0,5.0,499.0,35.0,5.0,158.0,5.0,499.0,1.0,17.0,0.0,499.0,499.0,499.0,499.0,499.0,7.0,76.0,499.0,5.0,94.0,5.0,499.0,5.0,499.0,5.0,48.0,499.0,499.0,499.0,499.0,499.0,7.0,76.0,499.0,5.0,94.0,5.0,499.0,5.0,499.0,5.0,48.0,1.0,17.0,0.0,6.0,3.0,71.0,27.0,182.0,53.0,11.0,130.0,52.0,11.0,123.0,12.0,3.0,18.0,499.0,124.0,6.0,3.0,71.0,27.0,182.0,53.0,11.0,130.0,52.0,11.0,123.0,12.0,3.0,18.0,499.0,124.0,1.0,35.0,0.0,9.0,3.0,18.0,499.0,4.0,103.0,42.0,12.0,26.0,8.0,389.0,16.0,499.0,15.0,499.0,10.0,11.0,7.0,11.0,34.0,499.0,43.0,20.0,55.0,340.0,4.0,227.0,11.0,22.0,8.0,499.0,4.0,51.0,9.0,9.0,3.0,18.0,499.0,4.0,103.0,42.0,12.0,26.0,8.0,389.0,16.0,499.0,15.0,499.0,10.0,11.0,7.0,11.0,34.0,499.0,43.0,20.0,55.0,340.0,4.0,227.0,11.0,22.0,8.0,499.0,4.0,51.0,9.0,1.0,10.0,0.0,7.0,2.0,499.0,3.0,18.0,499.0,499.0,4.0,406.0,7.0,2.0,499.0,3.0,18.0,499.0,499.0,4.0,406.0,1.0,7.0,0.0,10.0,499.0,24.0,22.0,499.0,9.0,10.0,499.0,24.0,22.0,499.0,9.0,1.0,11.0,0.0,90.0,499.0,409.0,16.0,4.0,499.0,30.0,499.0,10.0,256.0,90.0,499.0,409.0,16.0,4.0,499.0,30.0,499.0,10.0,256.0,1.0,23.0,0.0,57.0,499.0,499.0,16.0,499.0,222.0,7.0,11.0,38.0,3.0,17.0,65.0,24.0,60.0,77.0,499.0,48.0,499.0,499.0,4.0,499.0,499.0,57.0,499.0,499.0,16.0,499.0,222.0,7.0,11.0,38.0,3.0,17.0,65.0,24.0,60.0,77.0,499.0,48.0,499.0,499.0,4.0,499.0,499.0,1.0,5.0,0.0,30.0,16.0,41.0,374.0,30.0,16.0,41.0,374.0,1.0,14.0,0.0,6.0,365.0,15.0,499.0,499.0,133.0,25.0,6.0,3.0,71.0,64.0,499.0,499.0,6.0,365.0,15.0,499.0,499.0,133.0,25.0,6.0,3.0,71.0,64.0,499.0,499.0,1.0,28.0,0.0,6.0,78.0,6.0,365.0,46.0,471.0,7.0,8.0,462.0,171.0,2.0,499.0,64.0,499.0,499.0,25.0,6.0,22.0,291.0,4.0,95.0,8.0,475.0,13.0,222.0,499.0,499.0,6.0,78.0,6.0,365.0,46.0,471.0,7.0,8.0,462.0,171.0,2.0,499.0,64.0,499.0,499.0,25.0,6.0,22.0,291.0,4.0,95.0,8.0,475.0,13.0,222.0,499.0,499.0,1.0,29.0,0.0,2.0,499.0,499.0,125.0,13.0,499.0,7.0,22.0,81.0,499.0,499.0,19.0,8.0,210.0,25.0,2.0,499.0,112.0,217.0,4.0,22.0,499.0,6.0,499.0,60.0,21.0,2.0,499.0,2.0,499.0,499.0,125.0,13.0,499.0,7.0,22.0,81.0,499.0,499.0,19.0,8.0,210.0,25.0,2.0,499.0,112.0,217.0,4.0,22.0,499.0,6.0,499.0,60.0,21.0,2.0,499.0,1.0,16.0,0.0,45.0,40.0,217.0,4.0,21.0,114.0,102.0,58.0,494.0,48.0,2.0,499.0,69.0,2.0,499.0,45.0,40.0,217.0,4.0,21.0,114.0,102.0,58.0,494.0,48.0,2.0,499.0,69.0,2.0,499.0,1.0,34.0,0.0,324.0,9.0,3.0,18.0,2.0,499.0,139.0,33.0,2.0,232.0,12.0,2.0,499.0,225.0,8.0,398.0,391.0,10.0,275.0,499.0,52.0,2.0,499.0,225.0,63.0,154.0,31.0,2.0,499.0,266.0,10.0,36.0,198.0,324.0,9.0,3.0,18.0,2.0,499.0,139.0,33.0,2.0,232.0,12.0,2.0,499.0,225.0,8.0,398.0,391.0,10.0,275.0,499.0,52.0,2.0,499.0,225.0,63.0,154.0,31.0,2.0,499.0,266.0,10.0,36.0,198.0,1.0,10.0,0.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,34.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,11.0,404.0,3.0,17.0,122.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,11.0,404.0,3.0,17.0,122.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,129.0,129.0,1.0,12.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,1.0,65.0,0.0,207.0,499.0,32.0,90.0,495.0,499.0,420.0,499.0,499.0,172.0,106.0,102.0,499.0,212.0,499.0,16.0,9.0,31.0,499.0,105.0,102.0,499.0,33.0,499.0,6.0,3.0,120.0,81.0,499.0,4.0,499.0,499.0,135.0,137.0,105.0,132.0,499.0,23.0,499.0,207.0,499.0,499.0,499.0,499.0,73.0,86.0,90.0,499.0,212.0,106.0,499.0,499.0,499.0,263.0,90.0,495.0,32.0,26.0,9.0,499.0,9.0,19.0,106.0,200.0,207.0,499.0,32.0,90.0,495.0,499.0,420.0,499.0,499.0,172.0,106.0,102.0,499.0,212.0,499.0,16.0,9.0,31.0,499.0,105.0,102.0,499.0,33.0,499.0,6.0,3.0,120.0,81.0,499.0,4.0,499.0,499.0,135.0,137.0,105.0,132.0,499.0,23.0,499.0,207.0,499.0,499.0,499.0,499.0,73.0,86.0,90.0,499.0,212.0,106.0,499.0,499.0,499.0,263.0,90.0,495.0,32.0,26.0,9.0,499.0,9.0,19.0,106.0,200.0,1.0,10.0,0.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,14.0,14.0,499.0,14.0,14.0,216.0,5.0,5.0,499.0,1.0,16.0,0.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,89.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,15.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,89.0,499.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,1.0,7.0,0.0,499.0,499.0,499.0,5.0,5.0,6.0,499.0,499.0,499.0,5.0,5.0,6.0,1.0,2.0,0.0,499.0,499.0,1.0,4.0,0.0,35.0,5.0,499.0,35.0,5.0,499.0,1.0,18.0,0.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,499.0,13.0,13.0,13.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,129.0,129.0,1.0,12.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,35.0,5.0,499.0,5.0,129.0,13.0,215.0,1.0,13.0,0.0,55.0,499.0,2.0,499.0,383.0,29.0,206.0,383.0,52.0,499.0,499.0,171.0,55.0,499.0,2.0,499.0,383.0,29.0,206.0,383.0,52.0,499.0,499.0,171.0,1.0,16.0,0.0,85.0,49.0,499.0,67.0,68.0,6.0,150.0,6.0,34.0,235.0,371.0,52.0,49.0,142.0,499.0,85.0,49.0,499.0,67.0,68.0,6.0,150.0,6.0,34.0,235.0,371.0,52.0,49.0,142.0,499.0,1.0,11.0,0.0,85.0,49.0,206.0,67.0,499.0,383.0,153.0,67.0,77.0,499.0,85.0,49.0,206.0,67.0,499.0,383.0,153.0,67.0,77.0,499.0,1.0,7.0,0.0,38.0,3.0,17.0,122.0,73.0,499.0,38.0,3.0,17.0,122.0,73.0,499.0,1.0,31.0,0.0,499.0,499.0,16.0,63.0,499.0,115.0,499.0,10.0,499.0,499.0,499.0,499.0,32.0,97.0,32.0,2.0,499.0,499.0,152.0,26.0,11.0,156.0,499.0,11.0,104.0,4.0,499.0,2.0,499.0,499.0,499.0,499.0,16.0,63.0,499.0,115.0,499.0,10.0,499.0,499.0,499.0,499.0,32.0,97.0,32.0,2.0,499.0,499.0,152.0,26.0,11.0,156.0,499.0,11.0,104.0,4.0,499.0,2.0,499.0,499.0,1.0,20.0,0.0,195.0,115.0,16.0,2.0,499.0,201.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,2.0,499.0,499.0,195.0,115.0,16.0,2.0,499.0,201.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,2.0,499.0,499.0,1.0,26.0,0.0,26.0,11.0,50.0,45.0,105.0,363.0,2.0,499.0,62.0,21.0,499.0,25.0,9.0,3.0,18.0,376.0,208.0,62.0,21.0,15.0,45.0,4.0,221.0,11.0,15.0,26.0,11.0,50.0,45.0,105.0,363.0,2.0,499.0,62.0,21.0,499.0,25.0,9.0,3.0,18.0,376.0,208.0,62.0,21.0,15.0,45.0,4.0,221.0,11.0,15.0,1.0,8.0,0.0,499.0,499.0,60.0,21.0,101.0,69.0,326.0,499.0,499.0,60.0,21.0,101.0,69.0,326.0,1.0,25.0,0.0,428.0,6.0,3.0,71.0,499.0,10.0,226.0,74.0,2.0,233.0,7.0,278.0,499.0,31.0,6.0,3.0,71.0,499.0,112.0,15.0,2.0,499.0,153.0,499.0,428.0,6.0,3.0,71.0,499.0,10.0,226.0,74.0,2.0,233.0,7.0,278.0,499.0,31.0,6.0,3.0,71.0,499.0,112.0,15.0,2.0,499.0,153.0,499.0,1.0,81.0,0.0,6.0,499.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,16.0,247.0,499.0,23.0,8.0,499.0,12.0,26.0,9.0,131.0,193.0,499.0,15.0,499.0,9.0,3.0,110.0,21.0,499.0,97.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,7.0,499.0,166.0,499.0,171.0,4.0,272.0,19.0,499.0,394.0,20.0,2.0,499.0,10.0,499.0,265.0,73.0,23.0,7.0,499.0,10.0,499.0,499.0,6.0,3.0,71.0,499.0,499.0,138.0,3.0,17.0,499.0,183.0,171.0,4.0,8.0,499.0,10.0,499.0,6.0,499.0,499.0,499.0,7.0,2.0,499.0,499.0,499.0,16.0,247.0,499.0,23.0,8.0,499.0,12.0,26.0,9.0,131.0,193.0,499.0,15.0,499.0,9.0,3.0,110.0,21.0,499.0,97.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,7.0,499.0,166.0,499.0,171.0,4.0,272.0,19.0,499.0,394.0,20.0,2.0,499.0,10.0,499.0,265.0,73.0,23.0,7.0,499.0,10.0,499.0,499.0,6.0,3.0,71.0,499.0,499.0,138.0,3.0,17.0,499.0,183.0,171.0,4.0,8.0,499.0,10.0,499.0,1.0,55.0,0.0,499.0,381.0,30.0,217.0,4.0,21.0,2.0,499.0,115.0,41.0,31.0,2.0,499.0,10.0,11.0,100.0,37.0,499.0,47.0,28.0,197.0,19.0,59.0,270.0,23.0,134.0,499.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,7.0,205.0,201.0,499.0,499.0,205.0,499.0,7.0,499.0,493.0,8.0,499.0,23.0,146.0,12.0,241.0,22.0,81.0,479.0,93.0,499.0,381.0,30.0,217.0,4.0,21.0,2.0,499.0,115.0,41.0,31.0,2.0,499.0,10.0,11.0,100.0,37.0,499.0,47.0,28.0,197.0,19.0,59.0,270.0,23.0,134.0,499.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,7.0,205.0,201.0,499.0,499.0,205.0,499.0,7.0,499.0,493.0,8.0,499.0,23.0,146.0,12.0,241.0,22.0,81.0,479.0,93.0,1.0,12.0,0.0,47.0,499.0,44.0,270.0,499.0,499.0,23.0,79.0,4.0,499.0,499.0,47.0,499.0,44.0,270.0,499.0,499.0,23.0,79.0,4.0,499.0,499.0,1.0,6.0,0.0,100.0,16.0,134.0,499.0,80.0,100.0,16.0,134.0,499.0,80.0,1.0,2.0,0.0,450.0,450.0,1.0,32.0,0.0,35.0,5.0,336.0,5.0,499.0,416.0,4.0,499.0,59.0,270.0,9.0,3.0,18.0,102.0,499.0,26.0,203.0,499.0,193.0,4.0,499.0,270.0,47.0,60.0,21.0,58.0,69.0,499.0,4.0,51.0,41.0,35.0,5.0,336.0,5.0,499.0,416.0,4.0,499.0,59.0,270.0,9.0,3.0,18.0,102.0,499.0,26.0,203.0,499.0,193.0,4.0,499.0,270.0,47.0,60.0,21.0,58.0,69.0,499.0,4.0,51.0,41.0,1.0,28.0,0.0,499.0,6.0,38.0,3.0,17.0,499.0,23.0,499.0,2.0,499.0,4.0,50.0,98.0,212.0,68.0,12.0,60.0,234.0,10.0,499.0,2.0,337.0,124.0,10.0,278.0,98.0,212.0,499.0,6.0,38.0,3.0,17.0,499.0,23.0,499.0,2.0,499.0,4.0,50.0,98.0,212.0,68.0,12.0,60.0,234.0,10.0,499.0,2.0,337.0,124.0,10.0,278.0,98.0,212.0,1.0,23.0,0.0,75.0,77.0,26.0,6.0,499.0,59.0,275.0,12.0,186.0,3.0,17.0,21.0,192.0,19.0,2.0,499.0,10.0,2.0,499.0,499.0,2.0,83.0,75.0,77.0,26.0,6.0,499.0,59.0,275.0,12.0,186.0,3.0,17.0,21.0,192.0,19.0,2.0,499.0,10.0,2.0,499.0,499.0,2.0,83.0,1.0,6.0,0.0,499.0,19.0,2.0,499.0,152.0,499.0,19.0,2.0,499.0,152.0,1.0,28.0,0.0,11.0,316.0,499.0,48.0,79.0,96.0,307.0,499.0,402.0,361.0,52.0,11.0,34.0,22.0,172.0,499.0,10.0,43.0,23.0,2.0,499.0,37.0,499.0,20.0,55.0,499.0,499.0,11.0,316.0,499.0,48.0,79.0,96.0,307.0,499.0,402.0,361.0,52.0,11.0,34.0,22.0,172.0,499.0,10.0,43.0,23.0,2.0,499.0,37.0,499.0,20.0,55.0,499.0,499.0,1.0,19.0,0.0,39.0,72.0,416.0,19.0,499.0,16.0,12.0,2.0,499.0,499.0,38.0,3.0,17.0,499.0,8.0,499.0,499.0,499.0,39.0,72.0,416.0,19.0,499.0,16.0,12.0,2.0,499.0,499.0,38.0,3.0,17.0,499.0,8.0,499.0,499.0,499.0,1.0,16.0,0.0,6.0,3.0,110.0,102.0,427.0,22.0,132.0,219.0,499.0,499.0,69.0,499.0,255.0,499.0,212.0,6.0,3.0,110.0,102.0,427.0,22.0,132.0,219.0,499.0,499.0,69.0,499.0,255.0,499.0,212.0,1.0,22.0,0.0,499.0,8.0,177.0,10.0,499.0,499.0,15.0,499.0,499.0,2.0,144.0,421.0,100.0,3.0,18.0,2.0,499.0,499.0,5.0,5.0,499.0,499.0,8.0,177.0,10.0,499.0,499.0,15.0,499.0,499.0,2.0,144.0,421.0,100.0,3.0,18.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,4.0,0.0,499.0,13.0,499.0,499.0,13.0,499.0,1.0,14.0,0.0,37.0,5.0,499.0,13.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,37.0,5.0,499.0,13.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,22.0,0.0,499.0,116.0,2.0,63.0,197.0,103.0,31.0,8.0,499.0,499.0,499.0,20.0,8.0,499.0,10.0,499.0,499.0,2.0,499.0,10.0,499.0,499.0,116.0,2.0,63.0,197.0,103.0,31.0,8.0,499.0,499.0,499.0,20.0,8.0,499.0,10.0,499.0,499.0,2.0,499.0,10.0,499.0,1.0,19.0,0.0,97.0,26.0,53.0,11.0,123.0,16.0,374.0,85.0,9.0,499.0,499.0,13.0,499.0,77.0,58.0,10.0,8.0,499.0,97.0,26.0,53.0,11.0,123.0,16.0,374.0,85.0,9.0,499.0,499.0,13.0,499.0,77.0,58.0,10.0,8.0,499.0,1.0,37.0,0.0,6.0,3.0,71.0,27.0,293.0,4.0,499.0,20.0,11.0,25.0,40.0,64.0,39.0,499.0,10.0,208.0,66.0,499.0,13.0,499.0,210.0,499.0,23.0,222.0,499.0,499.0,20.0,499.0,113.0,499.0,49.0,150.0,228.0,13.0,125.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,499.0,20.0,11.0,25.0,40.0,64.0,39.0,499.0,10.0,208.0,66.0,499.0,13.0,499.0,210.0,499.0,23.0,222.0,499.0,499.0,20.0,499.0,113.0,499.0,49.0,150.0,228.0,13.0,125.0,499.0,1.0,19.0,0.0,6.0,3.0,71.0,182.0,11.0,34.0,194.0,499.0,20.0,499.0,33.0,255.0,499.0,499.0,499.0,23.0,499.0,499.0,6.0,3.0,71.0,182.0,11.0,34.0,194.0,499.0,20.0,499.0,33.0,255.0,499.0,499.0,499.0,23.0,499.0,499.0,1.0,46.0,0.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,159.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,44.0,0.0,6.0,22.0,8.0,499.0,25.0,55.0,499.0,499.0,27.0,182.0,26.0,114.0,56.0,274.0,27.0,277.0,2.0,499.0,499.0,133.0,25.0,2.0,499.0,217.0,4.0,181.0,218.0,133.0,6.0,127.0,173.0,4.0,499.0,7.0,118.0,3.0,499.0,3.0,4.0,499.0,5.0,407.0,281.0,6.0,22.0,8.0,499.0,25.0,55.0,499.0,499.0,27.0,182.0,26.0,114.0,56.0,274.0,27.0,277.0,2.0,499.0,499.0,133.0,25.0,2.0,499.0,217.0,4.0,181.0,218.0,133.0,6.0,127.0,173.0,4.0,499.0,7.0,118.0,3.0,499.0,3.0,4.0,499.0,5.0,407.0,281.0,1.0,62.0,0.0,2.0,499.0,499.0,4.0,21.0,499.0,27.0,499.0,499.0,64.0,2.0,499.0,41.0,6.0,34.0,3.0,17.0,499.0,499.0,263.0,466.0,499.0,33.0,264.0,146.0,499.0,6.0,127.0,173.0,4.0,499.0,2.0,499.0,7.0,32.0,7.0,499.0,6.0,127.0,173.0,4.0,466.0,5.0,499.0,3.0,499.0,3.0,15.0,2.0,169.0,499.0,30.0,385.0,499.0,67.0,6.0,127.0,75.0,277.0,8.0,94.0,2.0,499.0,499.0,4.0,21.0,499.0,27.0,499.0,499.0,64.0,2.0,499.0,41.0,6.0,34.0,3.0,17.0,499.0,499.0,263.0,466.0,499.0,33.0,264.0,146.0,499.0,6.0,127.0,173.0,4.0,499.0,2.0,499.0,7.0,32.0,7.0,499.0,6.0,127.0,173.0,4.0,466.0,5.0,499.0,3.0,499.0,3.0,15.0,2.0,169.0,499.0,30.0,385.0,499.0,67.0,6.0,127.0,75.0,277.0,8.0,94.0,1.0,23.0,0.0,37.0,6.0,3.0,109.0,174.0,8.0,499.0,13.0,499.0,499.0,7.0,95.0,26.0,12.0,329.0,70.0,101.0,5.0,216.0,5.0,5.0,80.0,37.0,6.0,3.0,109.0,174.0,8.0,499.0,13.0,499.0,499.0,7.0,95.0,26.0,12.0,329.0,70.0,101.0,5.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,5.0,0.0,8.0,87.0,499.0,209.0,8.0,87.0,499.0,209.0,1.0,4.0,0.0,499.0,16.0,222.0,499.0,16.0,222.0,1.0,8.0,0.0,47.0,3.0,120.0,44.0,81.0,45.0,499.0,47.0,3.0,120.0,44.0,81.0,45.0,499.0,1.0,9.0,0.0,499.0,58.0,42.0,69.0,11.0,65.0,499.0,499.0,499.0,58.0,42.0,69.0,11.0,65.0,499.0,499.0,1.0,12.0,0.0,478.0,87.0,499.0,11.0,202.0,3.0,17.0,162.0,191.0,20.0,9.0,478.0,87.0,499.0,11.0,202.0,3.0,17.0,162.0,191.0,20.0,9.0,1.0,14.0,0.0,499.0,499.0,7.0,499.0,23.0,499.0,227.0,7.0,36.0,198.0,19.0,2.0,101.0,499.0,499.0,7.0,499.0,23.0,499.0,227.0,7.0,36.0,198.0,19.0,2.0,101.0,1.0,8.0,0.0,51.0,2.0,281.0,12.0,122.0,11.0,499.0,51.0,2.0,281.0,12.0,122.0,11.0,499.0,1.0,3.0,0.0,249.0,227.0,249.0,227.0,1.0,7.0,0.0,499.0,10.0,11.0,499.0,11.0,28.0,499.0,10.0,11.0,499.0,11.0,28.0,1.0,6.0,0.0,12.0,499.0,39.0,370.0,369.0,12.0,499.0,39.0,370.0,369.0,1.0,44.0,0.0,345.0,11.0,41.0,26.0,478.0,499.0,64.0,499.0,4.0,123.0,499.0,7.0,2.0,499.0,72.0,56.0,119.0,499.0,12.0,499.0,45.0,28.0,72.0,119.0,499.0,119.0,499.0,13.0,63.0,15.0,499.0,499.0,7.0,63.0,15.0,499.0,2.0,499.0,499.0,361.0,31.0,230.0,499.0,345.0,11.0,41.0,26.0,478.0,499.0,64.0,499.0,4.0,123.0,499.0,7.0,2.0,499.0,72.0,56.0,119.0,499.0,12.0,499.0,45.0,28.0,72.0,119.0,499.0,119.0,499.0,13.0,63.0,15.0,499.0,499.0,7.0,63.0,15.0,499.0,2.0,499.0,499.0,361.0,31.0,230.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,4.0,0.0,35.0,125.0,499.0,35.0,125.0,499.0,1.0,4.0,0.0,499.0,119.0,499.0,499.0,119.0,499.0,1.0,6.0,0.0,499.0,309.0,499.0,13.0,499.0,499.0,309.0,499.0,13.0,499.0,1.0,2.0,0.0,35.0,35.0,1.0,24.0,0.0,89.0,141.0,22.0,499.0,499.0,21.0,499.0,499.0,85.0,196.0,49.0,295.0,142.0,2.0,300.0,452.0,19.0,132.0,325.0,83.0,498.0,15.0,499.0,89.0,141.0,22.0,499.0,499.0,21.0,499.0,499.0,85.0,196.0,49.0,295.0,142.0,2.0,300.0,452.0,19.0,132.0,325.0,83.0,498.0,15.0,499.0,1.0,21.0,0.0,6.0,186.0,3.0,17.0,21.0,499.0,26.0,2.0,499.0,29.0,173.0,4.0,499.0,195.0,297.0,499.0,499.0,4.0,325.0,275.0,6.0,186.0,3.0,17.0,21.0,499.0,26.0,2.0,499.0,29.0,173.0,4.0,499.0,195.0,297.0,499.0,499.0,4.0,325.0,275.0,1.0,32.0,0.0,7.0,4.0,21.0,499.0,26.0,24.0,499.0,2.0,374.0,499.0,499.0,9.0,366.0,40.0,499.0,59.0,42.0,7.0,477.0,43.0,4.0,499.0,193.0,499.0,10.0,499.0,499.0,499.0,15.0,499.0,499.0,7.0,4.0,21.0,499.0,26.0,24.0,499.0,2.0,374.0,499.0,499.0,9.0,366.0,40.0,499.0,59.0,42.0,7.0,477.0,43.0,4.0,499.0,193.0,499.0,10.0,499.0,499.0,499.0,15.0,499.0,499.0,1.0,49.0,0.0,19.0,330.0,26.0,24.0,499.0,12.0,2.0,499.0,499.0,29.0,2.0,499.0,477.0,10.0,2.0,499.0,10.0,73.0,4.0,14.0,14.0,14.0,230.0,499.0,14.0,14.0,14.0,499.0,2.0,499.0,10.0,499.0,131.0,499.0,24.0,60.0,21.0,222.0,178.0,4.0,499.0,2.0,499.0,10.0,499.0,7.0,499.0,499.0,19.0,330.0,26.0,24.0,499.0,12.0,2.0,499.0,499.0,29.0,2.0,499.0,477.0,10.0,2.0,499.0,10.0,73.0,4.0,14.0,14.0,14.0,230.0,499.0,14.0,14.0,14.0,499.0,2.0,499.0,10.0,499.0,131.0,499.0,24.0,60.0,21.0,222.0,178.0,4.0,499.0,2.0,499.0,10.0,499.0,7.0,499.0,499.0,1.0,24.0,0.0,7.0,12.0,426.0,499.0,44.0,10.0,2.0,499.0,499.0,4.0,499.0,7.0,253.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,10.0,57.0,499.0,7.0,12.0,426.0,499.0,44.0,10.0,2.0,499.0,499.0,4.0,499.0,7.0,253.0,499.0,84.0,16.0,75.0,8.0,499.0,499.0,10.0,57.0,499.0,1.0,26.0,0.0,6.0,88.0,442.0,499.0,10.0,9.0,20.0,499.0,499.0,29.0,499.0,263.0,499.0,499.0,20.0,8.0,499.0,12.0,29.0,443.0,255.0,340.0,19.0,499.0,499.0,6.0,88.0,442.0,499.0,10.0,9.0,20.0,499.0,499.0,29.0,499.0,263.0,499.0,499.0,20.0,8.0,499.0,12.0,29.0,443.0,255.0,340.0,19.0,499.0,499.0,1.0,16.0,0.0,499.0,496.0,37.0,499.0,113.0,119.0,6.0,29.0,8.0,499.0,499.0,74.0,85.0,9.0,499.0,499.0,496.0,37.0,499.0,113.0,119.0,6.0,29.0,8.0,499.0,499.0,74.0,85.0,9.0,499.0,1.0,17.0,0.0,65.0,363.0,55.0,499.0,53.0,499.0,23.0,499.0,8.0,117.0,4.0,469.0,363.0,499.0,2.0,499.0,65.0,363.0,55.0,499.0,53.0,499.0,23.0,499.0,8.0,117.0,4.0,469.0,363.0,499.0,2.0,499.0,1.0,38.0,0.0,6.0,3.0,71.0,15.0,499.0,73.0,196.0,20.0,426.0,119.0,55.0,499.0,499.0,68.0,9.0,499.0,72.0,499.0,67.0,25.0,499.0,7.0,499.0,28.0,499.0,6.0,3.0,71.0,99.0,499.0,69.0,39.0,266.0,499.0,499.0,336.0,499.0,6.0,3.0,71.0,15.0,499.0,73.0,196.0,20.0,426.0,119.0,55.0,499.0,499.0,68.0,9.0,499.0,72.0,499.0,67.0,25.0,499.0,7.0,499.0,28.0,499.0,6.0,3.0,71.0,99.0,499.0,69.0,39.0,266.0,499.0,499.0,336.0,499.0,1.0,11.0,0.0,6.0,78.0,6.0,3.0,71.0,15.0,19.0,2.0,248.0,499.0,6.0,78.0,6.0,3.0,71.0,15.0,19.0,2.0,248.0,499.0,1.0,4.0,0.0,499.0,15.0,45.0,499.0,15.0,45.0,1.0,13.0,0.0,6.0,22.0,499.0,12.0,6.0,156.0,4.0,143.0,195.0,214.0,37.0,9.0,6.0,22.0,499.0,12.0,6.0,156.0,4.0,143.0,195.0,214.0,37.0,9.0,1.0,18.0,0.0,41.0,132.0,42.0,249.0,9.0,12.0,6.0,499.0,19.0,8.0,248.0,121.0,6.0,29.0,323.0,499.0,499.0,41.0,132.0,42.0,249.0,9.0,12.0,6.0,499.0,19.0,8.0,248.0,121.0,6.0,29.0,323.0,499.0,499.0,1.0,17.0,0.0,9.0,16.0,63.0,10.0,2.0,72.0,499.0,12.0,6.0,22.0,499.0,499.0,68.0,6.0,29.0,499.0,9.0,16.0,63.0,10.0,2.0,72.0,499.0,12.0,6.0,22.0,499.0,499.0,68.0,6.0,29.0,499.0,1.0,28.0,0.0,6.0,328.0,9.0,29.0,37.0,2.0,128.0,180.0,24.0,131.0,499.0,64.0,2.0,499.0,7.0,6.0,40.0,421.0,499.0,499.0,50.0,23.0,20.0,499.0,7.0,499.0,499.0,6.0,328.0,9.0,29.0,37.0,2.0,128.0,180.0,24.0,131.0,499.0,64.0,2.0,499.0,7.0,6.0,40.0,421.0,499.0,499.0,50.0,23.0,20.0,499.0,7.0,499.0,499.0,1.0,13.0,0.0,12.0,29.0,132.0,237.0,499.0,324.0,6.0,60.0,499.0,9.0,58.0,133.0,12.0,29.0,132.0,237.0,499.0,324.0,6.0,60.0,499.0,9.0,58.0,133.0,1.0,14.0,0.0,9.0,3.0,18.0,499.0,68.0,6.0,499.0,260.0,143.0,12.0,499.0,20.0,146.0,9.0,3.0,18.0,499.0,68.0,6.0,499.0,260.0,143.0,12.0,499.0,20.0,146.0,1.0,19.0,0.0,63.0,121.0,67.0,7.0,39.0,408.0,131.0,499.0,134.0,499.0,499.0,4.0,307.0,76.0,499.0,153.0,134.0,420.0,63.0,121.0,67.0,7.0,39.0,408.0,131.0,499.0,134.0,499.0,499.0,4.0,307.0,76.0,499.0,153.0,134.0,420.0,1.0,18.0,0.0,6.0,88.0,2.0,126.0,458.0,19.0,67.0,4.0,499.0,499.0,90.0,499.0,210.0,49.0,499.0,499.0,499.0,6.0,88.0,2.0,126.0,458.0,19.0,67.0,4.0,499.0,499.0,90.0,499.0,210.0,49.0,499.0,499.0,499.0,1.0,10.0,0.0,47.0,499.0,499.0,7.0,45.0,29.0,499.0,10.0,499.0,47.0,499.0,499.0,7.0,45.0,29.0,499.0,10.0,499.0,1.0,30.0,0.0,499.0,29.0,499.0,499.0,499.0,6.0,421.0,2.0,320.0,499.0,29.0,499.0,5.0,499.0,6.0,65.0,6.0,3.0,71.0,499.0,4.0,50.0,499.0,293.0,4.0,328.0,66.0,381.0,29.0,499.0,29.0,499.0,499.0,499.0,6.0,421.0,2.0,320.0,499.0,29.0,499.0,5.0,499.0,6.0,65.0,6.0,3.0,71.0,499.0,4.0,50.0,499.0,293.0,4.0,328.0,66.0,381.0,29.0,1.0,21.0,0.0,6.0,78.0,11.0,3.0,54.0,107.0,48.0,63.0,139.0,30.0,499.0,499.0,499.0,56.0,160.0,81.0,499.0,23.0,499.0,93.0,6.0,78.0,11.0,3.0,54.0,107.0,48.0,63.0,139.0,30.0,499.0,499.0,499.0,56.0,160.0,81.0,499.0,23.0,499.0,93.0,1.0,9.0,0.0,112.0,34.0,24.0,499.0,8.0,430.0,31.0,499.0,112.0,34.0,24.0,499.0,8.0,430.0,31.0,499.0,1.0,37.0,0.0,89.0,7.0,19.0,12.0,499.0,108.0,34.0,3.0,17.0,6.0,499.0,499.0,15.0,2.0,300.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,185.0,4.0,499.0,46.0,499.0,11.0,3.0,54.0,40.0,299.0,227.0,214.0,2.0,499.0,89.0,7.0,19.0,12.0,499.0,108.0,34.0,3.0,17.0,6.0,499.0,499.0,15.0,2.0,300.0,499.0,26.0,11.0,3.0,54.0,99.0,4.0,185.0,4.0,499.0,46.0,499.0,11.0,3.0,54.0,40.0,299.0,227.0,214.0,2.0,499.0,1.0,13.0,0.0,11.0,34.0,3.0,17.0,499.0,499.0,499.0,68.0,12.0,16.0,27.0,499.0,11.0,34.0,3.0,17.0,499.0,499.0,499.0,68.0,12.0,16.0,27.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,5.0,0.0,499.0,8.0,499.0,16.0,499.0,8.0,499.0,16.0,1.0,3.0,0.0,499.0,183.0,499.0,183.0,1.0,14.0,0.0,2.0,499.0,64.0,2.0,499.0,28.0,499.0,20.0,90.0,499.0,7.0,499.0,499.0,2.0,499.0,64.0,2.0,499.0,28.0,499.0,20.0,90.0,499.0,7.0,499.0,499.0,1.0,42.0,0.0,499.0,9.0,499.0,86.0,2.0,499.0,499.0,10.0,499.0,499.0,499.0,12.0,499.0,499.0,49.0,16.0,499.0,25.0,26.0,11.0,38.0,3.0,17.0,65.0,9.0,16.0,4.0,21.0,499.0,32.0,128.0,10.0,57.0,499.0,13.0,499.0,499.0,15.0,499.0,55.0,499.0,499.0,9.0,499.0,86.0,2.0,499.0,499.0,10.0,499.0,499.0,499.0,12.0,499.0,499.0,49.0,16.0,499.0,25.0,26.0,11.0,38.0,3.0,17.0,65.0,9.0,16.0,4.0,21.0,499.0,32.0,128.0,10.0,57.0,499.0,13.0,499.0,499.0,15.0,499.0,55.0,499.0,1.0,84.0,0.0,42.0,50.0,499.0,24.0,499.0,499.0,15.0,57.0,485.0,44.0,2.0,121.0,12.0,40.0,217.0,4.0,21.0,46.0,499.0,499.0,19.0,90.0,499.0,26.0,12.0,131.0,2.0,276.0,499.0,45.0,29.0,75.0,499.0,23.0,2.0,470.0,74.0,2.0,499.0,52.0,49.0,29.0,499.0,5.0,137.0,499.0,20.0,2.0,499.0,499.0,210.0,106.0,499.0,29.0,499.0,4.0,2.0,499.0,40.0,128.0,10.0,2.0,499.0,33.0,226.0,15.0,90.0,499.0,68.0,49.0,499.0,9.0,499.0,461.0,90.0,499.0,10.0,499.0,499.0,499.0,384.0,4.0,499.0,42.0,50.0,499.0,24.0,499.0,499.0,15.0,57.0,485.0,44.0,2.0,121.0,12.0,40.0,217.0,4.0,21.0,46.0,499.0,499.0,19.0,90.0,499.0,26.0,12.0,131.0,2.0,276.0,499.0,45.0,29.0,75.0,499.0,23.0,2.0,470.0,74.0,2.0,499.0,52.0,49.0,29.0,499.0,5.0,137.0,499.0,20.0,2.0,499.0,499.0,210.0,106.0,499.0,29.0,499.0,4.0,2.0,499.0,40.0,128.0,10.0,2.0,499.0,33.0,226.0,15.0,90.0,499.0,68.0,49.0,499.0,9.0,499.0,461.0,90.0,499.0,10.0,499.0,499.0,499.0,384.0,4.0,499.0,1.0,38.0,0.0,467.0,32.0,6.0,220.0,30.0,6.0,271.0,149.0,31.0,6.0,271.0,31.0,8.0,499.0,25.0,499.0,97.0,12.0,3.0,18.0,40.0,79.0,9.0,44.0,496.0,61.0,12.0,3.0,18.0,356.0,6.0,34.0,65.0,10.0,37.0,2.0,499.0,467.0,32.0,6.0,220.0,30.0,6.0,271.0,149.0,31.0,6.0,271.0,31.0,8.0,499.0,25.0,499.0,97.0,12.0,3.0,18.0,40.0,79.0,9.0,44.0,496.0,61.0,12.0,3.0,18.0,356.0,6.0,34.0,65.0,10.0,37.0,2.0,499.0,1.0,12.0,0.0,6.0,3.0,120.0,142.0,8.0,499.0,499.0,119.0,126.0,244.0,499.0,6.0,3.0,120.0,142.0,8.0,499.0,499.0,119.0,126.0,244.0,499.0,1.0,60.0,0.0,8.0,177.0,58.0,252.0,69.0,8.0,499.0,25.0,499.0,219.0,499.0,27.0,12.0,6.0,3.0,120.0,88.0,70.0,499.0,20.0,499.0,41.0,437.0,499.0,499.0,457.0,57.0,337.0,499.0,15.0,499.0,7.0,178.0,2.0,103.0,499.0,44.0,13.0,499.0,499.0,15.0,2.0,499.0,119.0,482.0,101.0,499.0,499.0,69.0,2.0,499.0,33.0,499.0,7.0,56.0,58.0,304.0,32.0,97.0,8.0,177.0,58.0,252.0,69.0,8.0,499.0,25.0,499.0,219.0,499.0,27.0,12.0,6.0,3.0,120.0,88.0,70.0,499.0,20.0,499.0,41.0,437.0,499.0,499.0,457.0,57.0,337.0,499.0,15.0,499.0,7.0,178.0,2.0,103.0,499.0,44.0,13.0,499.0,499.0,15.0,2.0,499.0,119.0,482.0,101.0,499.0,499.0,69.0,2.0,499.0,33.0,499.0,7.0,56.0,58.0,304.0,32.0,97.0,1.0,18.0,0.0,20.0,12.0,150.0,499.0,366.0,21.0,8.0,244.0,499.0,170.0,499.0,28.0,499.0,499.0,74.0,499.0,499.0,20.0,12.0,150.0,499.0,366.0,21.0,8.0,244.0,499.0,170.0,499.0,28.0,499.0,499.0,74.0,499.0,499.0,1.0,5.0,0.0,499.0,285.0,9.0,499.0,499.0,285.0,9.0,499.0,1.0,22.0,0.0,89.0,23.0,30.0,464.0,70.0,499.0,10.0,382.0,482.0,451.0,499.0,86.0,499.0,12.0,3.0,18.0,499.0,7.0,11.0,78.0,9.0,89.0,23.0,30.0,464.0,70.0,499.0,10.0,382.0,482.0,451.0,499.0,86.0,499.0,12.0,3.0,18.0,499.0,7.0,11.0,78.0,9.0,1.0,22.0,0.0,26.0,11.0,3.0,54.0,499.0,499.0,20.0,12.0,499.0,7.0,2.0,499.0,499.0,282.0,85.0,24.0,3.0,109.0,499.0,50.0,499.0,26.0,11.0,3.0,54.0,499.0,499.0,20.0,12.0,499.0,7.0,2.0,499.0,499.0,282.0,85.0,24.0,3.0,109.0,499.0,50.0,499.0,1.0,12.0,0.0,499.0,499.0,499.0,8.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,8.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,28.0,0.0,499.0,257.0,499.0,67.0,49.0,499.0,499.0,499.0,499.0,315.0,321.0,49.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,315.0,159.0,499.0,321.0,499.0,499.0,499.0,499.0,257.0,499.0,67.0,49.0,499.0,499.0,499.0,499.0,315.0,321.0,49.0,499.0,499.0,499.0,257.0,499.0,499.0,499.0,499.0,315.0,159.0,499.0,321.0,499.0,499.0,499.0,1.0,8.0,0.0,499.0,55.0,321.0,499.0,55.0,499.0,499.0,499.0,55.0,321.0,499.0,55.0,499.0,499.0,1.0,11.0,0.0,56.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,321.0,499.0,8.0,499.0,315.0,55.0,499.0,315.0,55.0,499.0,321.0,499.0,8.0,499.0,315.0,55.0,499.0,315.0,55.0,499.0,1.0,20.0,0.0,499.0,55.0,499.0,159.0,499.0,499.0,257.0,499.0,67.0,499.0,499.0,499.0,55.0,499.0,499.0,499.0,499.0,315.0,499.0,499.0,55.0,499.0,159.0,499.0,499.0,257.0,499.0,67.0,499.0,499.0,499.0,55.0,499.0,499.0,499.0,499.0,315.0,499.0,1.0,18.0,0.0,499.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,315.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,67.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,315.0,67.0,499.0,499.0,499.0,499.0,499.0,1.0,16.0,0.0,499.0,257.0,499.0,321.0,499.0,499.0,499.0,499.0,499.0,257.0,499.0,315.0,321.0,49.0,499.0,499.0,257.0,499.0,321.0,499.0,499.0,499.0,499.0,499.0,257.0,499.0,315.0,321.0,49.0,499.0,1.0,31.0,0.0,6.0,38.0,3.0,17.0,22.0,8.0,177.0,10.0,499.0,15.0,2.0,499.0,3.0,18.0,499.0,26.0,6.0,104.0,4.0,444.0,96.0,499.0,3.0,18.0,499.0,6.0,34.0,214.0,251.0,180.0,6.0,38.0,3.0,17.0,22.0,8.0,177.0,10.0,499.0,15.0,2.0,499.0,3.0,18.0,499.0,26.0,6.0,104.0,4.0,444.0,96.0,499.0,3.0,18.0,499.0,6.0,34.0,214.0,251.0,180.0,1.0,16.0,0.0,6.0,249.0,52.0,42.0,50.0,499.0,48.0,2.0,499.0,136.0,499.0,367.0,50.0,172.0,9.0,6.0,249.0,52.0,42.0,50.0,499.0,48.0,2.0,499.0,136.0,499.0,367.0,50.0,172.0,9.0,1.0,30.0,0.0,75.0,6.0,249.0,79.0,42.0,104.0,4.0,499.0,265.0,48.0,499.0,7.0,122.0,499.0,499.0,48.0,42.0,24.0,51.0,38.0,3.0,17.0,78.0,7.0,499.0,43.0,2.0,499.0,212.0,75.0,6.0,249.0,79.0,42.0,104.0,4.0,499.0,265.0,48.0,499.0,7.0,122.0,499.0,499.0,48.0,42.0,24.0,51.0,38.0,3.0,17.0,78.0,7.0,499.0,43.0,2.0,499.0,212.0,1.0,19.0,0.0,6.0,62.0,143.0,2.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,6.0,62.0,143.0,2.0,2.0,499.0,499.0,499.0,7.0,499.0,4.0,2.0,499.0,499.0,499.0,12.0,499.0,499.0,1.0,20.0,0.0,75.0,6.0,34.0,160.0,50.0,499.0,37.0,360.0,68.0,26.0,9.0,16.0,247.0,73.0,6.0,62.0,444.0,114.0,251.0,75.0,6.0,34.0,160.0,50.0,499.0,37.0,360.0,68.0,26.0,9.0,16.0,247.0,73.0,6.0,62.0,444.0,114.0,251.0,1.0,37.0,0.0,360.0,16.0,27.0,2.0,267.0,44.0,21.0,44.0,25.0,30.0,115.0,182.0,499.0,31.0,9.0,16.0,103.0,10.0,2.0,499.0,28.0,44.0,360.0,499.0,41.0,6.0,493.0,2.0,499.0,10.0,2.0,499.0,23.0,499.0,360.0,499.0,360.0,16.0,27.0,2.0,267.0,44.0,21.0,44.0,25.0,30.0,115.0,182.0,499.0,31.0,9.0,16.0,103.0,10.0,2.0,499.0,28.0,44.0,360.0,499.0,41.0,6.0,493.0,2.0,499.0,10.0,2.0,499.0,23.0,499.0,360.0,499.0,1.0,36.0,0.0,55.0,11.0,3.0,54.0,218.0,13.0,6.0,78.0,9.0,3.0,18.0,234.0,10.0,499.0,499.0,25.0,268.0,3.0,17.0,182.0,26.0,30.0,29.0,499.0,4.0,499.0,499.0,499.0,8.0,499.0,4.0,5.0,94.0,5.0,129.0,55.0,11.0,3.0,54.0,218.0,13.0,6.0,78.0,9.0,3.0,18.0,234.0,10.0,499.0,499.0,25.0,268.0,3.0,17.0,182.0,26.0,30.0,29.0,499.0,4.0,499.0,499.0,499.0,8.0,499.0,4.0,5.0,94.0,5.0,129.0,1.0,20.0,0.0,35.0,27.0,499.0,15.0,100.0,93.0,25.0,6.0,111.0,335.0,45.0,29.0,451.0,55.0,499.0,4.0,2.0,347.0,426.0,35.0,27.0,499.0,15.0,100.0,93.0,25.0,6.0,111.0,335.0,45.0,29.0,451.0,55.0,499.0,4.0,2.0,347.0,426.0,1.0,102.0,0.0,89.0,15.0,499.0,499.0,499.0,4.0,499.0,61.0,154.0,499.0,499.0,12.0,62.0,388.0,42.0,20.0,8.0,499.0,499.0,4.0,396.0,499.0,331.0,499.0,499.0,499.0,21.0,173.0,4.0,499.0,86.0,499.0,13.0,499.0,162.0,499.0,162.0,23.0,2.0,499.0,210.0,499.0,15.0,499.0,7.0,396.0,8.0,499.0,289.0,107.0,45.0,23.0,36.0,499.0,150.0,499.0,499.0,11.0,50.0,4.0,2.0,499.0,11.0,40.0,499.0,43.0,2.0,499.0,41.0,213.0,30.0,130.0,11.0,51.0,27.0,22.0,4.0,499.0,19.0,499.0,93.0,11.0,499.0,36.0,499.0,499.0,6.0,423.0,23.0,499.0,11.0,156.0,4.0,499.0,19.0,499.0,26.0,6.0,127.0,27.0,499.0,89.0,15.0,499.0,499.0,499.0,4.0,499.0,61.0,154.0,499.0,499.0,12.0,62.0,388.0,42.0,20.0,8.0,499.0,499.0,4.0,396.0,499.0,331.0,499.0,499.0,499.0,21.0,173.0,4.0,499.0,86.0,499.0,13.0,499.0,162.0,499.0,162.0,23.0,2.0,499.0,210.0,499.0,15.0,499.0,7.0,396.0,8.0,499.0,289.0,107.0,45.0,23.0,36.0,499.0,150.0,499.0,499.0,11.0,50.0,4.0,2.0,499.0,11.0,40.0,499.0,43.0,2.0,499.0,41.0,213.0,30.0,130.0,11.0,51.0,27.0,22.0,4.0,499.0,19.0,499.0,93.0,11.0,499.0,36.0,499.0,499.0,6.0,423.0,23.0,499.0,11.0,156.0,4.0,499.0,19.0,499.0,26.0,6.0,127.0,27.0,499.0,1.0,16.0,0.0,12.0,3.0,18.0,8.0,87.0,97.0,499.0,166.0,100.0,11.0,22.0,39.0,499.0,499.0,499.0,12.0,3.0,18.0,8.0,87.0,97.0,499.0,166.0,100.0,11.0,22.0,39.0,499.0,499.0,499.0,1.0,52.0,0.0,40.0,4.0,499.0,59.0,281.0,73.0,6.0,499.0,4.0,499.0,15.0,2.0,499.0,12.0,6.0,38.0,3.0,17.0,130.0,176.0,447.0,63.0,10.0,193.0,499.0,176.0,447.0,499.0,499.0,15.0,232.0,6.0,150.0,15.0,2.0,155.0,499.0,12.0,6.0,313.0,43.0,7.0,10.0,499.0,45.0,28.0,281.0,12.0,111.0,21.0,101.0,40.0,4.0,499.0,59.0,281.0,73.0,6.0,499.0,4.0,499.0,15.0,2.0,499.0,12.0,6.0,38.0,3.0,17.0,130.0,176.0,447.0,63.0,10.0,193.0,499.0,176.0,447.0,499.0,499.0,15.0,232.0,6.0,150.0,15.0,2.0,155.0,499.0,12.0,6.0,313.0,43.0,7.0,10.0,499.0,45.0,28.0,281.0,12.0,111.0,21.0,101.0,1.0,44.0,0.0,39.0,499.0,499.0,72.0,499.0,67.0,4.0,440.0,499.0,73.0,4.0,8.0,319.0,124.0,25.0,2.0,347.0,124.0,16.0,47.0,28.0,499.0,32.0,8.0,337.0,37.0,312.0,77.0,152.0,45.0,28.0,499.0,499.0,7.0,281.0,12.0,111.0,7.0,91.0,21.0,499.0,5.0,274.0,39.0,499.0,499.0,72.0,499.0,67.0,4.0,440.0,499.0,73.0,4.0,8.0,319.0,124.0,25.0,2.0,347.0,124.0,16.0,47.0,28.0,499.0,32.0,8.0,337.0,37.0,312.0,77.0,152.0,45.0,28.0,499.0,499.0,7.0,281.0,12.0,111.0,7.0,91.0,21.0,499.0,5.0,274.0,1.0,30.0,0.0,7.0,77.0,152.0,59.0,499.0,131.0,206.0,499.0,58.0,499.0,33.0,58.0,121.0,499.0,6.0,65.0,12.0,347.0,24.0,28.0,499.0,193.0,102.0,58.0,69.0,24.0,499.0,64.0,193.0,7.0,77.0,152.0,59.0,499.0,131.0,206.0,499.0,58.0,499.0,33.0,58.0,121.0,499.0,6.0,65.0,12.0,347.0,24.0,28.0,499.0,193.0,102.0,58.0,69.0,24.0,499.0,64.0,193.0,1.0,18.0,0.0,47.0,142.0,499.0,10.0,499.0,4.0,499.0,7.0,47.0,349.0,47.0,34.0,3.0,17.0,50.0,43.0,44.0,47.0,142.0,499.0,10.0,499.0,4.0,499.0,7.0,47.0,349.0,47.0,34.0,3.0,17.0,50.0,43.0,44.0,1.0,13.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,28.0,105.0,121.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,28.0,105.0,121.0,499.0,1.0,13.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,47.0,34.0,50.0,43.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,47.0,34.0,50.0,43.0,499.0,1.0,15.0,0.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,163.0,3.0,17.0,21.0,45.0,499.0,47.0,142.0,98.0,499.0,7.0,47.0,349.0,24.0,163.0,3.0,17.0,21.0,45.0,499.0,1.0,8.0,0.0,6.0,65.0,11.0,34.0,95.0,2.0,499.0,6.0,65.0,11.0,34.0,95.0,2.0,499.0,1.0,75.0,0.0,75.0,499.0,47.0,34.0,3.0,17.0,316.0,499.0,47.0,22.0,2.0,107.0,4.0,22.0,9.0,44.0,33.0,225.0,9.0,44.0,6.0,186.0,3.0,17.0,469.0,2.0,83.0,4.0,388.0,67.0,4.0,21.0,499.0,15.0,499.0,20.0,8.0,259.0,10.0,309.0,14.0,74.0,72.0,499.0,67.0,20.0,287.0,31.0,499.0,2.0,144.0,117.0,42.0,38.0,3.0,17.0,469.0,4.0,499.0,15.0,296.0,198.0,72.0,20.0,144.0,13.0,499.0,42.0,306.0,10.0,2.0,337.0,499.0,6.0,75.0,499.0,47.0,34.0,3.0,17.0,316.0,499.0,47.0,22.0,2.0,107.0,4.0,22.0,9.0,44.0,33.0,225.0,9.0,44.0,6.0,186.0,3.0,17.0,469.0,2.0,83.0,4.0,388.0,67.0,4.0,21.0,499.0,15.0,499.0,20.0,8.0,259.0,10.0,309.0,14.0,74.0,72.0,499.0,67.0,20.0,287.0,31.0,499.0,2.0,144.0,117.0,42.0,38.0,3.0,17.0,469.0,4.0,499.0,15.0,296.0,198.0,72.0,20.0,144.0,13.0,499.0,42.0,306.0,10.0,2.0,337.0,499.0,6.0,1.0,65.0,0.0,499.0,499.0,15.0,8.0,175.0,499.0,20.0,8.0,344.0,499.0,499.0,26.0,11.0,38.0,3.0,17.0,22.0,175.0,499.0,11.0,38.0,3.0,17.0,162.0,4.0,175.0,499.0,6.0,65.0,9.0,3.0,18.0,499.0,6.0,3.0,71.0,182.0,2.0,499.0,111.0,21.0,499.0,25.0,37.0,59.0,124.0,11.0,91.0,21.0,499.0,20.0,287.0,101.0,69.0,499.0,15.0,499.0,4.0,465.0,8.0,499.0,37.0,36.0,499.0,499.0,499.0,15.0,8.0,175.0,499.0,20.0,8.0,344.0,499.0,499.0,26.0,11.0,38.0,3.0,17.0,22.0,175.0,499.0,11.0,38.0,3.0,17.0,162.0,4.0,175.0,499.0,6.0,65.0,9.0,3.0,18.0,499.0,6.0,3.0,71.0,182.0,2.0,499.0,111.0,21.0,499.0,25.0,37.0,59.0,124.0,11.0,91.0,21.0,499.0,20.0,287.0,101.0,69.0,499.0,15.0,499.0,4.0,465.0,8.0,499.0,37.0,36.0,499.0,1.0,31.0,0.0,499.0,20.0,499.0,499.0,6.0,3.0,71.0,15.0,2.0,175.0,499.0,19.0,2.0,499.0,264.0,4.0,2.0,267.0,41.0,9.0,3.0,18.0,27.0,12.0,121.0,499.0,6.0,3.0,110.0,123.0,499.0,20.0,499.0,499.0,6.0,3.0,71.0,15.0,2.0,175.0,499.0,19.0,2.0,499.0,264.0,4.0,2.0,267.0,41.0,9.0,3.0,18.0,27.0,12.0,121.0,499.0,6.0,3.0,110.0,123.0,1.0,41.0,0.0,7.0,85.0,196.0,9.0,3.0,18.0,27.0,31.0,11.0,3.0,109.0,499.0,8.0,297.0,499.0,9.0,3.0,18.0,58.0,31.0,499.0,345.0,11.0,19.0,36.0,499.0,499.0,6.0,65.0,12.0,47.0,34.0,499.0,307.0,76.0,15.0,2.0,439.0,135.0,44.0,7.0,85.0,196.0,9.0,3.0,18.0,27.0,31.0,11.0,3.0,109.0,499.0,8.0,297.0,499.0,9.0,3.0,18.0,58.0,31.0,499.0,345.0,11.0,19.0,36.0,499.0,499.0,6.0,65.0,12.0,47.0,34.0,499.0,307.0,76.0,15.0,2.0,439.0,135.0,44.0,1.0,19.0,0.0,148.0,8.0,258.0,58.0,93.0,201.0,8.0,414.0,492.0,11.0,3.0,54.0,201.0,8.0,499.0,5.0,499.0,414.0,148.0,8.0,258.0,58.0,93.0,201.0,8.0,414.0,492.0,11.0,3.0,54.0,201.0,8.0,499.0,5.0,499.0,414.0,1.0,60.0,0.0,492.0,11.0,3.0,54.0,2.0,231.0,499.0,10.0,2.0,499.0,499.0,430.0,260.0,135.0,226.0,19.0,8.0,499.0,11.0,22.0,451.0,55.0,499.0,108.0,319.0,331.0,91.0,21.0,15.0,53.0,499.0,53.0,2.0,499.0,7.0,499.0,499.0,331.0,28.0,53.0,499.0,499.0,52.0,9.0,3.0,18.0,499.0,4.0,148.0,114.0,52.0,4.0,419.0,499.0,4.0,499.0,4.0,8.0,499.0,492.0,11.0,3.0,54.0,2.0,231.0,499.0,10.0,2.0,499.0,499.0,430.0,260.0,135.0,226.0,19.0,8.0,499.0,11.0,22.0,451.0,55.0,499.0,108.0,319.0,331.0,91.0,21.0,15.0,53.0,499.0,53.0,2.0,499.0,7.0,499.0,499.0,331.0,28.0,53.0,499.0,499.0,52.0,9.0,3.0,18.0,499.0,4.0,148.0,114.0,52.0,4.0,419.0,499.0,4.0,499.0,4.0,8.0,499.0,1.0,54.0,0.0,45.0,3.0,18.0,41.0,102.0,4.0,9.0,12.0,11.0,3.0,54.0,397.0,499.0,86.0,2.0,499.0,267.0,68.0,136.0,2.0,402.0,66.0,161.0,499.0,2.0,414.0,92.0,499.0,7.0,499.0,12.0,3.0,18.0,8.0,499.0,499.0,40.0,499.0,79.0,4.0,499.0,9.0,3.0,18.0,499.0,4.0,313.0,79.0,2.0,499.0,169.0,329.0,499.0,45.0,3.0,18.0,41.0,102.0,4.0,9.0,12.0,11.0,3.0,54.0,397.0,499.0,86.0,2.0,499.0,267.0,68.0,136.0,2.0,402.0,66.0,161.0,499.0,2.0,414.0,92.0,499.0,7.0,499.0,12.0,3.0,18.0,8.0,499.0,499.0,40.0,499.0,79.0,4.0,499.0,9.0,3.0,18.0,499.0,4.0,313.0,79.0,2.0,499.0,169.0,329.0,499.0,1.0,11.0,0.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,499.0,499.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,499.0,499.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,14.0,0.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,29.0,0.0,35.0,5.0,499.0,254.0,499.0,250.0,5.0,250.0,13.0,499.0,499.0,8.0,499.0,499.0,289.0,4.0,36.0,495.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,35.0,5.0,499.0,254.0,499.0,250.0,5.0,250.0,13.0,499.0,499.0,8.0,499.0,499.0,289.0,4.0,36.0,495.0,14.0,14.0,14.0,499.0,499.0,5.0,5.0,499.0,13.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,429.0,499.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,499.0,14.0,14.0,499.0,499.0,429.0,499.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,14.0,0.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,331.0,5.0,499.0,13.0,499.0,13.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,8.0,0.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,23.0,0.0,35.0,5.0,499.0,250.0,499.0,13.0,499.0,8.0,289.0,7.0,333.0,165.0,499.0,4.0,154.0,499.0,499.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,250.0,499.0,13.0,499.0,8.0,289.0,7.0,333.0,165.0,499.0,4.0,154.0,499.0,499.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,17.0,0.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,13.0,215.0,322.0,67.0,20.0,73.0,4.0,298.0,499.0,35.0,5.0,158.0,5.0,292.0,5.0,499.0,13.0,215.0,322.0,67.0,20.0,73.0,4.0,298.0,499.0,1.0,63.0,0.0,6.0,199.0,4.0,65.0,14.0,499.0,499.0,14.0,29.0,48.0,499.0,105.0,25.0,499.0,6.0,499.0,12.0,9.0,3.0,18.0,161.0,8.0,499.0,48.0,79.0,499.0,62.0,122.0,42.0,499.0,48.0,2.0,499.0,499.0,7.0,133.0,12.0,6.0,65.0,48.0,9.0,12.0,3.0,18.0,369.0,53.0,499.0,15.0,2.0,499.0,42.0,499.0,4.0,50.0,499.0,10.0,499.0,15.0,499.0,10.0,499.0,499.0,6.0,199.0,4.0,65.0,14.0,499.0,499.0,14.0,29.0,48.0,499.0,105.0,25.0,499.0,6.0,499.0,12.0,9.0,3.0,18.0,161.0,8.0,499.0,48.0,79.0,499.0,62.0,122.0,42.0,499.0,48.0,2.0,499.0,499.0,7.0,133.0,12.0,6.0,65.0,48.0,9.0,12.0,3.0,18.0,369.0,53.0,499.0,15.0,2.0,499.0,42.0,499.0,4.0,50.0,499.0,10.0,499.0,15.0,499.0,10.0,499.0,499.0,1.0,7.0,0.0,6.0,78.0,369.0,79.0,11.0,149.0,6.0,78.0,369.0,79.0,11.0,149.0,1.0,18.0,0.0,6.0,104.0,4.0,21.0,173.0,4.0,21.0,407.0,48.0,9.0,41.0,189.0,25.0,6.0,365.0,15.0,499.0,6.0,104.0,4.0,21.0,173.0,4.0,21.0,407.0,48.0,9.0,41.0,189.0,25.0,6.0,365.0,15.0,499.0,1.0,48.0,0.0,84.0,16.0,239.0,102.0,63.0,10.0,2.0,415.0,499.0,4.0,21.0,407.0,48.0,9.0,351.0,47.0,38.0,3.0,17.0,77.0,22.0,398.0,499.0,499.0,499.0,72.0,7.0,19.0,87.0,242.0,499.0,26.0,6.0,29.0,15.0,8.0,499.0,31.0,499.0,6.0,3.0,110.0,22.0,55.0,499.0,20.0,9.0,84.0,16.0,239.0,102.0,63.0,10.0,2.0,415.0,499.0,4.0,21.0,407.0,48.0,9.0,351.0,47.0,38.0,3.0,17.0,77.0,22.0,398.0,499.0,499.0,499.0,72.0,7.0,19.0,87.0,242.0,499.0,26.0,6.0,29.0,15.0,8.0,499.0,31.0,499.0,6.0,3.0,110.0,22.0,55.0,499.0,20.0,9.0,1.0,20.0,0.0,2.0,232.0,12.0,11.0,3.0,54.0,499.0,19.0,8.0,115.0,12.0,499.0,499.0,499.0,92.0,499.0,281.0,6.0,149.0,2.0,232.0,12.0,11.0,3.0,54.0,499.0,19.0,8.0,115.0,12.0,499.0,499.0,499.0,92.0,499.0,281.0,6.0,149.0,1.0,36.0,0.0,9.0,3.0,18.0,499.0,7.0,107.0,12.0,11.0,3.0,110.0,149.0,30.0,117.0,25.0,9.0,3.0,18.0,116.0,19.0,2.0,190.0,12.0,11.0,240.0,9.0,23.0,2.0,171.0,344.0,19.0,2.0,499.0,483.0,37.0,236.0,9.0,3.0,18.0,499.0,7.0,107.0,12.0,11.0,3.0,110.0,149.0,30.0,117.0,25.0,9.0,3.0,18.0,116.0,19.0,2.0,190.0,12.0,11.0,240.0,9.0,23.0,2.0,171.0,344.0,19.0,2.0,499.0,483.0,37.0,236.0,1.0,17.0,0.0,188.0,499.0,499.0,28.0,72.0,499.0,15.0,276.0,10.0,8.0,455.0,499.0,84.0,16.0,87.0,429.0,188.0,499.0,499.0,28.0,72.0,499.0,15.0,276.0,10.0,8.0,455.0,499.0,84.0,16.0,87.0,429.0,1.0,14.0,0.0,15.0,44.0,76.0,499.0,499.0,16.0,32.0,499.0,32.0,9.0,29.0,23.0,499.0,15.0,44.0,76.0,499.0,499.0,16.0,32.0,499.0,32.0,9.0,29.0,23.0,499.0,1.0,54.0,0.0,41.0,9.0,3.0,18.0,8.0,225.0,13.0,225.0,100.0,26.0,2.0,455.0,16.0,73.0,356.0,499.0,499.0,26.0,2.0,455.0,16.0,171.0,11.0,34.0,112.0,50.0,36.0,499.0,499.0,499.0,499.0,75.0,9.0,16.0,58.0,31.0,254.0,499.0,10.0,499.0,13.0,499.0,27.0,499.0,11.0,78.0,348.0,113.0,336.0,7.0,348.0,113.0,342.0,41.0,9.0,3.0,18.0,8.0,225.0,13.0,225.0,100.0,26.0,2.0,455.0,16.0,73.0,356.0,499.0,499.0,26.0,2.0,455.0,16.0,171.0,11.0,34.0,112.0,50.0,36.0,499.0,499.0,499.0,499.0,75.0,9.0,16.0,58.0,31.0,254.0,499.0,10.0,499.0,13.0,499.0,27.0,499.0,11.0,78.0,348.0,113.0,336.0,7.0,348.0,113.0,342.0,1.0,13.0,0.0,12.0,139.0,47.0,44.0,499.0,79.0,4.0,51.0,15.0,2.0,499.0,499.0,12.0,139.0,47.0,44.0,499.0,79.0,4.0,51.0,15.0,2.0,499.0,499.0,1.0,43.0,0.0,26.0,8.0,499.0,16.0,105.0,499.0,4.0,448.0,79.0,4.0,348.0,113.0,336.0,348.0,113.0,342.0,499.0,4.0,499.0,7.0,60.0,427.0,22.0,90.0,499.0,286.0,2.0,412.0,10.0,2.0,455.0,66.0,34.0,499.0,37.0,70.0,121.0,85.0,12.0,16.0,90.0,499.0,26.0,8.0,499.0,16.0,105.0,499.0,4.0,448.0,79.0,4.0,348.0,113.0,336.0,348.0,113.0,342.0,499.0,4.0,499.0,7.0,60.0,427.0,22.0,90.0,499.0,286.0,2.0,412.0,10.0,2.0,455.0,66.0,34.0,499.0,37.0,70.0,121.0,85.0,12.0,16.0,90.0,499.0,1.0,41.0,0.0,499.0,9.0,3.0,18.0,499.0,4.0,499.0,350.0,36.0,499.0,15.0,30.0,499.0,32.0,2.0,499.0,62.0,280.0,11.0,8.0,499.0,244.0,499.0,499.0,15.0,499.0,26.0,11.0,499.0,73.0,348.0,113.0,336.0,5.0,348.0,113.0,342.0,3.0,499.0,114.0,499.0,9.0,3.0,18.0,499.0,4.0,499.0,350.0,36.0,499.0,15.0,30.0,499.0,32.0,2.0,499.0,62.0,280.0,11.0,8.0,499.0,244.0,499.0,499.0,15.0,499.0,26.0,11.0,499.0,73.0,348.0,113.0,336.0,5.0,348.0,113.0,342.0,3.0,499.0,114.0,1.0,12.0,0.0,9.0,3.0,18.0,27.0,31.0,36.0,499.0,62.0,162.0,86.0,499.0,9.0,3.0,18.0,27.0,31.0,36.0,499.0,62.0,162.0,86.0,499.0,1.0,33.0,0.0,499.0,499.0,8.0,125.0,13.0,10.0,13.0,499.0,499.0,34.0,499.0,499.0,20.0,499.0,11.0,271.0,31.0,8.0,499.0,492.0,11.0,3.0,54.0,499.0,84.0,499.0,12.0,16.0,59.0,87.0,96.0,499.0,499.0,499.0,8.0,125.0,13.0,10.0,13.0,499.0,499.0,34.0,499.0,499.0,20.0,499.0,11.0,271.0,31.0,8.0,499.0,492.0,11.0,3.0,54.0,499.0,84.0,499.0,12.0,16.0,59.0,87.0,96.0,499.0,1.0,9.0,0.0,499.0,16.0,8.0,398.0,499.0,499.0,2.0,499.0,499.0,16.0,8.0,398.0,499.0,499.0,2.0,499.0,1.0,7.0,0.0,499.0,29.0,499.0,77.0,20.0,499.0,499.0,29.0,499.0,77.0,20.0,499.0,1.0,7.0,0.0,499.0,499.0,213.0,27.0,499.0,499.0,499.0,499.0,213.0,27.0,499.0,499.0,1.0,12.0,0.0,499.0,56.0,81.0,499.0,351.0,53.0,49.0,3.0,18.0,81.0,499.0,499.0,56.0,81.0,499.0,351.0,53.0,49.0,3.0,18.0,81.0,499.0,1.0,22.0,0.0,49.0,3.0,18.0,112.0,8.0,499.0,312.0,499.0,7.0,49.0,19.0,182.0,499.0,73.0,2.0,499.0,15.0,98.0,499.0,194.0,499.0,49.0,3.0,18.0,112.0,8.0,499.0,312.0,499.0,7.0,49.0,19.0,182.0,499.0,73.0,2.0,499.0,15.0,98.0,499.0,194.0,499.0,1.0,22.0,0.0,6.0,3.0,71.0,311.0,351.0,12.0,499.0,7.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,39.0,499.0,400.0,4.0,499.0,499.0,6.0,3.0,71.0,311.0,351.0,12.0,499.0,7.0,12.0,3.0,18.0,108.0,6.0,60.0,499.0,39.0,499.0,400.0,4.0,499.0,499.0,1.0,8.0,0.0,75.0,499.0,12.0,499.0,7.0,327.0,499.0,75.0,499.0,12.0,499.0,7.0,327.0,499.0,1.0,14.0,0.0,6.0,60.0,149.0,499.0,323.0,499.0,198.0,5.0,499.0,499.0,52.0,277.0,499.0,6.0,60.0,149.0,499.0,323.0,499.0,198.0,5.0,499.0,499.0,52.0,277.0,499.0,1.0,10.0,0.0,25.0,6.0,499.0,9.0,34.0,3.0,17.0,21.0,499.0,25.0,6.0,499.0,9.0,34.0,3.0,17.0,21.0,499.0,1.0,27.0,0.0,428.0,6.0,60.0,417.0,30.0,4.0,21.0,46.0,499.0,115.0,19.0,203.0,12.0,60.0,31.0,4.0,499.0,499.0,7.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,428.0,6.0,60.0,417.0,30.0,4.0,21.0,46.0,499.0,115.0,19.0,203.0,12.0,60.0,31.0,4.0,499.0,499.0,7.0,499.0,2.0,499.0,10.0,134.0,499.0,499.0,1.0,26.0,0.0,6.0,60.0,75.0,417.0,9.0,4.0,21.0,301.0,15.0,166.0,48.0,296.0,445.0,499.0,15.0,2.0,362.0,98.0,7.0,320.0,12.0,499.0,4.0,12.0,499.0,6.0,60.0,75.0,417.0,9.0,4.0,21.0,301.0,15.0,166.0,48.0,296.0,445.0,499.0,15.0,2.0,362.0,98.0,7.0,320.0,12.0,499.0,4.0,12.0,499.0,1.0,21.0,0.0,6.0,38.0,3.0,17.0,65.0,499.0,499.0,91.0,21.0,499.0,100.0,492.0,24.0,499.0,15.0,296.0,198.0,23.0,57.0,200.0,6.0,38.0,3.0,17.0,65.0,499.0,499.0,91.0,21.0,499.0,100.0,492.0,24.0,499.0,15.0,296.0,198.0,23.0,57.0,200.0,1.0,18.0,0.0,25.0,6.0,3.0,71.0,27.0,499.0,4.0,21.0,8.0,499.0,7.0,6.0,104.0,4.0,499.0,36.0,499.0,25.0,6.0,3.0,71.0,27.0,499.0,4.0,21.0,8.0,499.0,7.0,6.0,104.0,4.0,499.0,36.0,499.0,1.0,29.0,0.0,32.0,30.0,16.0,8.0,87.0,98.0,464.0,6.0,65.0,499.0,2.0,499.0,47.0,104.0,499.0,7.0,15.0,499.0,20.0,2.0,499.0,47.0,22.0,37.0,30.0,124.0,16.0,441.0,32.0,30.0,16.0,8.0,87.0,98.0,464.0,6.0,65.0,499.0,2.0,499.0,47.0,104.0,499.0,7.0,15.0,499.0,20.0,2.0,499.0,47.0,22.0,37.0,30.0,124.0,16.0,441.0,1.0,9.0,0.0,41.0,141.0,499.0,36.0,499.0,7.0,70.0,499.0,41.0,141.0,499.0,36.0,499.0,7.0,70.0,499.0,1.0,25.0,0.0,37.0,2.0,144.0,121.0,6.0,38.0,3.0,17.0,65.0,9.0,91.0,21.0,8.0,499.0,13.0,499.0,13.0,44.0,13.0,2.0,13.0,121.0,115.0,168.0,37.0,2.0,144.0,121.0,6.0,38.0,3.0,17.0,65.0,9.0,91.0,21.0,8.0,499.0,13.0,499.0,13.0,44.0,13.0,2.0,13.0,121.0,115.0,168.0,1.0,11.0,0.0,6.0,60.0,31.0,9.0,4.0,21.0,499.0,15.0,296.0,445.0,6.0,60.0,31.0,9.0,4.0,21.0,499.0,15.0,296.0,445.0,1.0,6.0,0.0,20.0,2.0,499.0,499.0,499.0,20.0,2.0,499.0,499.0,499.0,1.0,46.0,0.0,89.0,499.0,470.0,499.0,125.0,125.0,5.0,499.0,288.0,499.0,113.0,125.0,499.0,41.0,499.0,19.0,499.0,470.0,4.0,472.0,125.0,486.0,5.0,230.0,3.0,18.0,9.0,72.0,488.0,4.0,21.0,499.0,499.0,19.0,499.0,11.0,50.0,63.0,499.0,40.0,19.0,499.0,2.0,499.0,499.0,89.0,499.0,470.0,499.0,125.0,125.0,5.0,499.0,288.0,499.0,113.0,125.0,499.0,41.0,499.0,19.0,499.0,470.0,4.0,472.0,125.0,486.0,5.0,230.0,3.0,18.0,9.0,72.0,488.0,4.0,21.0,499.0,499.0,19.0,499.0,11.0,50.0,63.0,499.0,40.0,19.0,499.0,2.0,499.0,499.0,1.0,22.0,0.0,15.0,232.0,19.0,499.0,70.0,426.0,10.0,486.0,5.0,230.0,3.0,18.0,499.0,470.0,62.0,499.0,2.0,144.0,32.0,499.0,499.0,15.0,232.0,19.0,499.0,70.0,426.0,10.0,486.0,5.0,230.0,3.0,18.0,499.0,470.0,62.0,499.0,2.0,144.0,32.0,499.0,499.0,1.0,18.0,0.0,499.0,470.0,403.0,61.0,499.0,52.0,11.0,104.0,4.0,333.0,58.0,69.0,63.0,165.0,4.0,499.0,499.0,499.0,470.0,403.0,61.0,499.0,52.0,11.0,104.0,4.0,333.0,58.0,69.0,63.0,165.0,4.0,499.0,499.0,1.0,19.0,0.0,20.0,499.0,6.0,65.0,11.0,3.0,54.0,493.0,117.0,105.0,102.0,499.0,15.0,2.0,282.0,64.0,2.0,209.0,20.0,499.0,6.0,65.0,11.0,3.0,54.0,493.0,117.0,105.0,102.0,499.0,15.0,2.0,282.0,64.0,2.0,209.0,1.0,30.0,0.0,6.0,130.0,47.0,38.0,3.0,17.0,156.0,499.0,499.0,19.0,499.0,13.0,26.0,11.0,3.0,54.0,499.0,61.0,10.0,499.0,499.0,4.0,280.0,354.0,11.0,34.0,3.0,17.0,354.0,6.0,130.0,47.0,38.0,3.0,17.0,156.0,499.0,499.0,19.0,499.0,13.0,26.0,11.0,3.0,54.0,499.0,61.0,10.0,499.0,499.0,4.0,280.0,354.0,11.0,34.0,3.0,17.0,354.0,1.0,31.0,0.0,367.0,47.0,3.0,54.0,136.0,499.0,15.0,30.0,15.0,2.0,183.0,499.0,33.0,499.0,88.0,63.0,499.0,303.0,499.0,25.0,499.0,16.0,2.0,499.0,10.0,354.0,19.0,499.0,7.0,499.0,367.0,47.0,3.0,54.0,136.0,499.0,15.0,30.0,15.0,2.0,183.0,499.0,33.0,499.0,88.0,63.0,499.0,303.0,499.0,25.0,499.0,16.0,2.0,499.0,10.0,354.0,19.0,499.0,7.0,499.0,1.0,48.0,0.0,2.0,499.0,3.0,18.0,385.0,138.0,3.0,17.0,499.0,10.0,499.0,63.0,3.0,18.0,229.0,135.0,2.0,232.0,13.0,57.0,499.0,499.0,23.0,499.0,33.0,27.0,207.0,499.0,4.0,2.0,422.0,4.0,22.0,499.0,207.0,111.0,112.0,499.0,4.0,27.0,354.0,52.0,2.0,499.0,161.0,499.0,499.0,2.0,499.0,3.0,18.0,385.0,138.0,3.0,17.0,499.0,10.0,499.0,63.0,3.0,18.0,229.0,135.0,2.0,232.0,13.0,57.0,499.0,499.0,23.0,499.0,33.0,27.0,207.0,499.0,4.0,2.0,422.0,4.0,22.0,499.0,207.0,111.0,112.0,499.0,4.0,27.0,354.0,52.0,2.0,499.0,161.0,499.0,499.0,1.0,17.0,0.0,6.0,95.0,55.0,499.0,12.0,207.0,91.0,21.0,173.0,4.0,499.0,106.0,229.0,135.0,2.0,232.0,6.0,95.0,55.0,499.0,12.0,207.0,91.0,21.0,173.0,4.0,499.0,106.0,229.0,135.0,2.0,232.0,1.0,19.0,0.0,7.0,10.0,499.0,2.0,499.0,10.0,2.0,244.0,499.0,28.0,99.0,4.0,499.0,73.0,19.0,57.0,244.0,499.0,7.0,10.0,499.0,2.0,499.0,10.0,2.0,244.0,499.0,28.0,99.0,4.0,499.0,73.0,19.0,57.0,244.0,499.0,1.0,32.0,0.0,24.0,3.0,54.0,27.0,99.0,4.0,246.0,61.0,46.0,499.0,8.0,499.0,499.0,2.0,362.0,57.0,499.0,16.0,8.0,499.0,499.0,19.0,77.0,99.0,33.0,499.0,4.0,499.0,93.0,2.0,422.0,24.0,3.0,54.0,27.0,99.0,4.0,246.0,61.0,46.0,499.0,8.0,499.0,499.0,2.0,362.0,57.0,499.0,16.0,8.0,499.0,499.0,19.0,77.0,99.0,33.0,499.0,4.0,499.0,93.0,2.0,422.0,1.0,21.0,0.0,154.0,499.0,4.0,2.0,209.0,68.0,176.0,499.0,62.0,499.0,31.0,12.0,26.0,24.0,423.0,57.0,499.0,29.0,161.0,499.0,154.0,499.0,4.0,2.0,209.0,68.0,176.0,499.0,62.0,499.0,31.0,12.0,26.0,24.0,423.0,57.0,499.0,29.0,161.0,499.0,1.0,29.0,0.0,6.0,51.0,65.0,12.0,30.0,499.0,116.0,142.0,499.0,74.0,2.0,169.0,499.0,6.0,78.0,13.0,25.0,499.0,132.0,10.0,36.0,499.0,48.0,2.0,209.0,499.0,499.0,499.0,6.0,51.0,65.0,12.0,30.0,499.0,116.0,142.0,499.0,74.0,2.0,169.0,499.0,6.0,78.0,13.0,25.0,499.0,132.0,10.0,36.0,499.0,48.0,2.0,209.0,499.0,499.0,499.0,1.0,5.0,0.0,40.0,39.0,499.0,499.0,40.0,39.0,499.0,499.0,1.0,4.0,0.0,6.0,231.0,499.0,6.0,231.0,499.0,1.0,6.0,0.0,11.0,3.0,109.0,249.0,9.0,11.0,3.0,109.0,249.0,9.0,1.0,2.0,0.0,499.0,499.0,1.0,26.0,0.0,6.0,3.0,110.0,75.0,435.0,3.0,55.0,58.0,499.0,15.0,499.0,3.0,13.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,314.0,48.0,499.0,64.0,499.0,6.0,3.0,110.0,75.0,435.0,3.0,55.0,58.0,499.0,15.0,499.0,3.0,13.0,9.0,3.0,18.0,8.0,499.0,499.0,499.0,314.0,48.0,499.0,64.0,499.0,1.0,10.0,0.0,499.0,9.0,3.0,18.0,499.0,499.0,6.0,249.0,9.0,499.0,9.0,3.0,18.0,499.0,499.0,6.0,249.0,9.0,1.0,20.0,0.0,45.0,3.0,18.0,55.0,499.0,37.0,44.0,7.0,9.0,3.0,18.0,126.0,19.0,8.0,499.0,20.0,8.0,242.0,339.0,45.0,3.0,18.0,55.0,499.0,37.0,44.0,7.0,9.0,3.0,18.0,126.0,19.0,8.0,499.0,20.0,8.0,242.0,339.0,1.0,16.0,0.0,6.0,499.0,499.0,4.0,9.0,20.0,8.0,408.0,7.0,9.0,3.0,18.0,40.0,126.0,499.0,6.0,499.0,499.0,4.0,9.0,20.0,8.0,408.0,7.0,9.0,3.0,18.0,40.0,126.0,499.0,1.0,52.0,0.0,27.0,182.0,26.0,9.0,3.0,18.0,443.0,3.0,499.0,3.0,25.0,6.0,3.0,110.0,499.0,435.0,2.0,499.0,499.0,499.0,26.0,11.0,34.0,50.0,36.0,420.0,23.0,9.0,499.0,499.0,499.0,280.0,9.0,355.0,499.0,176.0,483.0,33.0,41.0,499.0,209.0,499.0,7.0,8.0,126.0,314.0,4.0,499.0,191.0,7.0,499.0,27.0,182.0,26.0,9.0,3.0,18.0,443.0,3.0,499.0,3.0,25.0,6.0,3.0,110.0,499.0,435.0,2.0,499.0,499.0,499.0,26.0,11.0,34.0,50.0,36.0,420.0,23.0,9.0,499.0,499.0,499.0,280.0,9.0,355.0,499.0,176.0,483.0,33.0,41.0,499.0,209.0,499.0,7.0,8.0,126.0,314.0,4.0,499.0,191.0,7.0,499.0,1.0,22.0,0.0,24.0,499.0,3.0,499.0,490.0,3.0,84.0,16.0,499.0,499.0,7.0,9.0,3.0,18.0,499.0,194.0,433.0,15.0,8.0,499.0,499.0,24.0,499.0,3.0,499.0,490.0,3.0,84.0,16.0,499.0,499.0,7.0,9.0,3.0,18.0,499.0,194.0,433.0,15.0,8.0,499.0,499.0,1.0,36.0,0.0,6.0,338.0,3.0,17.0,341.0,2.0,490.0,387.0,10.0,499.0,76.0,69.0,8.0,499.0,499.0,68.0,6.0,499.0,2.0,499.0,19.0,109.0,490.0,25.0,24.0,3.0,120.0,274.0,9.0,73.0,105.0,102.0,19.0,39.0,499.0,6.0,338.0,3.0,17.0,341.0,2.0,490.0,387.0,10.0,499.0,76.0,69.0,8.0,499.0,499.0,68.0,6.0,499.0,2.0,499.0,19.0,109.0,490.0,25.0,24.0,3.0,120.0,274.0,9.0,73.0,105.0,102.0,19.0,39.0,499.0,1.0,29.0,0.0,499.0,194.0,433.0,490.0,16.0,218.0,32.0,45.0,3.0,18.0,27.0,102.0,15.0,2.0,117.0,10.0,499.0,499.0,9.0,29.0,499.0,41.0,264.0,4.0,2.0,490.0,13.0,499.0,499.0,194.0,433.0,490.0,16.0,218.0,32.0,45.0,3.0,18.0,27.0,102.0,15.0,2.0,117.0,10.0,499.0,499.0,9.0,29.0,499.0,41.0,264.0,4.0,2.0,490.0,13.0,499.0,1.0,26.0,0.0,262.0,15.0,2.0,499.0,6.0,328.0,499.0,4.0,2.0,310.0,499.0,74.0,499.0,499.0,499.0,499.0,210.0,499.0,23.0,8.0,499.0,499.0,499.0,37.0,499.0,262.0,15.0,2.0,499.0,6.0,328.0,499.0,4.0,2.0,310.0,499.0,74.0,499.0,499.0,499.0,499.0,210.0,499.0,23.0,8.0,499.0,499.0,499.0,37.0,499.0,1.0,5.0,0.0,311.0,22.0,67.0,499.0,311.0,22.0,67.0,499.0,1.0,11.0,0.0,324.0,8.0,258.0,499.0,133.0,25.0,6.0,112.0,499.0,9.0,324.0,8.0,258.0,499.0,133.0,25.0,6.0,112.0,499.0,9.0,1.0,17.0,0.0,75.0,6.0,499.0,9.0,15.0,195.0,385.0,2.0,499.0,499.0,74.0,499.0,499.0,36.0,499.0,369.0,75.0,6.0,499.0,9.0,15.0,195.0,385.0,2.0,499.0,499.0,74.0,499.0,499.0,36.0,499.0,369.0,1.0,5.0,0.0,64.0,2.0,499.0,499.0,64.0,2.0,499.0,499.0,1.0,8.0,0.0,9.0,3.0,18.0,499.0,499.0,7.0,499.0,9.0,3.0,18.0,499.0,499.0,7.0,499.0,1.0,31.0,0.0,66.0,15.0,2.0,499.0,157.0,499.0,499.0,65.0,49.0,29.0,74.0,499.0,4.0,499.0,53.0,70.0,383.0,499.0,15.0,57.0,499.0,49.0,488.0,4.0,78.0,90.0,115.0,15.0,30.0,499.0,66.0,15.0,2.0,499.0,157.0,499.0,499.0,65.0,49.0,29.0,74.0,499.0,4.0,499.0,53.0,70.0,383.0,499.0,15.0,57.0,499.0,49.0,488.0,4.0,78.0,90.0,115.0,15.0,30.0,499.0,1.0,8.0,0.0,499.0,51.0,27.0,499.0,4.0,70.0,499.0,499.0,51.0,27.0,499.0,4.0,70.0,499.0,1.0,3.0,0.0,18.0,383.0,18.0,383.0,1.0,24.0,0.0,383.0,499.0,29.0,499.0,4.0,499.0,499.0,3.0,18.0,499.0,499.0,2.0,165.0,12.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,98.0,499.0,383.0,499.0,29.0,499.0,4.0,499.0,499.0,3.0,18.0,499.0,499.0,2.0,165.0,12.0,499.0,499.0,56.0,499.0,499.0,499.0,499.0,98.0,499.0,1.0,40.0,0.0,26.0,11.0,28.0,499.0,4.0,2.0,499.0,11.0,62.0,294.0,8.0,499.0,15.0,499.0,48.0,499.0,11.0,3.0,109.0,116.0,75.0,499.0,20.0,76.0,499.0,263.0,11.0,41.0,32.0,97.0,84.0,62.0,75.0,499.0,2.0,368.0,10.0,2.0,499.0,26.0,11.0,28.0,499.0,4.0,2.0,499.0,11.0,62.0,294.0,8.0,499.0,15.0,499.0,48.0,499.0,11.0,3.0,109.0,116.0,75.0,499.0,20.0,76.0,499.0,263.0,11.0,41.0,32.0,97.0,84.0,62.0,75.0,499.0,2.0,368.0,10.0,2.0,499.0,1.0,14.0,0.0,25.0,2.0,499.0,16.0,12.0,11.0,62.0,22.0,8.0,499.0,15.0,36.0,499.0,25.0,2.0,499.0,16.0,12.0,11.0,62.0,22.0,8.0,499.0,15.0,36.0,499.0,1.0,15.0,0.0,11.0,34.0,151.0,185.0,499.0,11.0,200.0,499.0,7.0,95.0,79.0,12.0,329.0,61.0,11.0,34.0,151.0,185.0,499.0,11.0,200.0,499.0,7.0,95.0,79.0,12.0,329.0,61.0,1.0,43.0,0.0,6.0,3.0,110.0,435.0,114.0,10.0,368.0,26.0,11.0,28.0,15.0,8.0,499.0,13.0,499.0,499.0,84.0,499.0,31.0,11.0,28.0,396.0,114.0,31.0,46.0,499.0,499.0,13.0,499.0,178.0,36.0,499.0,499.0,86.0,499.0,499.0,7.0,499.0,2.0,499.0,4.0,12.0,6.0,3.0,110.0,435.0,114.0,10.0,368.0,26.0,11.0,28.0,15.0,8.0,499.0,13.0,499.0,499.0,84.0,499.0,31.0,11.0,28.0,396.0,114.0,31.0,46.0,499.0,499.0,13.0,499.0,178.0,36.0,499.0,499.0,86.0,499.0,499.0,7.0,499.0,2.0,499.0,4.0,12.0,1.0,31.0,0.0,20.0,59.0,255.0,13.0,368.0,499.0,499.0,12.0,16.0,248.0,192.0,11.0,91.0,21.0,173.0,4.0,499.0,2.0,499.0,4.0,8.0,58.0,499.0,499.0,7.0,22.0,8.0,101.0,499.0,347.0,20.0,59.0,255.0,13.0,368.0,499.0,499.0,12.0,16.0,248.0,192.0,11.0,91.0,21.0,173.0,4.0,499.0,2.0,499.0,4.0,8.0,58.0,499.0,499.0,7.0,22.0,8.0,101.0,499.0,347.0,1.0,40.0,0.0,6.0,38.0,3.0,17.0,22.0,14.0,12.0,14.0,102.0,10.0,46.0,499.0,20.0,43.0,76.0,69.0,2.0,232.0,12.0,24.0,28.0,499.0,499.0,499.0,499.0,499.0,6.0,355.0,499.0,43.0,32.0,499.0,499.0,499.0,31.0,79.0,499.0,499.0,43.0,6.0,38.0,3.0,17.0,22.0,14.0,12.0,14.0,102.0,10.0,46.0,499.0,20.0,43.0,76.0,69.0,2.0,232.0,12.0,24.0,28.0,499.0,499.0,499.0,499.0,499.0,6.0,355.0,499.0,43.0,32.0,499.0,499.0,499.0,31.0,79.0,499.0,499.0,43.0,1.0,19.0,0.0,25.0,6.0,51.0,31.0,79.0,24.0,499.0,2.0,499.0,6.0,151.0,152.0,2.0,499.0,131.0,499.0,15.0,499.0,25.0,6.0,51.0,31.0,79.0,24.0,499.0,2.0,499.0,6.0,151.0,152.0,2.0,499.0,131.0,499.0,15.0,499.0,1.0,10.0,0.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,313.0,12.0,3.0,18.0,53.0,6.0,38.0,3.0,17.0,313.0,1.0,41.0,0.0,11.0,78.0,12.0,44.0,11.0,22.0,4.0,51.0,16.0,499.0,499.0,499.0,4.0,27.0,50.0,499.0,7.0,291.0,11.0,112.0,40.0,499.0,15.0,2.0,407.0,7.0,221.0,499.0,499.0,11.0,286.0,499.0,7.0,85.0,349.0,12.0,49.0,3.0,18.0,223.0,11.0,78.0,12.0,44.0,11.0,22.0,4.0,51.0,16.0,499.0,499.0,499.0,4.0,27.0,50.0,499.0,7.0,291.0,11.0,112.0,40.0,499.0,15.0,2.0,407.0,7.0,221.0,499.0,499.0,11.0,286.0,499.0,7.0,85.0,349.0,12.0,49.0,3.0,18.0,223.0,1.0,74.0,0.0,6.0,78.0,8.0,177.0,10.0,380.0,42.0,15.0,344.0,499.0,28.0,299.0,499.0,31.0,12.0,68.0,24.0,38.0,3.0,17.0,78.0,53.0,4.0,51.0,33.0,24.0,38.0,3.0,17.0,78.0,79.0,4.0,333.0,20.0,8.0,319.0,499.0,33.0,499.0,25.0,52.0,11.0,78.0,53.0,11.0,3.0,54.0,499.0,4.0,51.0,84.0,9.0,217.0,381.0,213.0,20.0,499.0,7.0,85.0,11.0,112.0,38.0,3.0,17.0,51.0,9.0,6.0,40.0,38.0,3.0,17.0,313.0,12.0,6.0,78.0,8.0,177.0,10.0,380.0,42.0,15.0,344.0,499.0,28.0,299.0,499.0,31.0,12.0,68.0,24.0,38.0,3.0,17.0,78.0,53.0,4.0,51.0,33.0,24.0,38.0,3.0,17.0,78.0,79.0,4.0,333.0,20.0,8.0,319.0,499.0,33.0,499.0,25.0,52.0,11.0,78.0,53.0,11.0,3.0,54.0,499.0,4.0,51.0,84.0,9.0,217.0,381.0,213.0,20.0,499.0,7.0,85.0,11.0,112.0,38.0,3.0,17.0,51.0,9.0,6.0,40.0,38.0,3.0,17.0,313.0,12.0,1.0,29.0,0.0,499.0,499.0,16.0,499.0,52.0,11.0,148.0,9.0,3.0,3.0,41.0,499.0,499.0,475.0,499.0,3.0,3.0,6.0,118.0,499.0,273.0,382.0,7.0,499.0,499.0,228.0,23.0,9.0,499.0,499.0,16.0,499.0,52.0,11.0,148.0,9.0,3.0,3.0,41.0,499.0,499.0,475.0,499.0,3.0,3.0,6.0,118.0,499.0,273.0,382.0,7.0,499.0,499.0,228.0,23.0,9.0,1.0,31.0,0.0,9.0,3.0,18.0,499.0,499.0,4.0,118.0,19.0,52.0,6.0,104.0,4.0,499.0,8.0,175.0,83.0,4.0,95.0,499.0,99.0,23.0,52.0,39.0,499.0,229.0,34.0,3.0,17.0,499.0,9.0,9.0,3.0,18.0,499.0,499.0,4.0,118.0,19.0,52.0,6.0,104.0,4.0,499.0,8.0,175.0,83.0,4.0,95.0,499.0,99.0,23.0,52.0,39.0,499.0,229.0,34.0,3.0,17.0,499.0,9.0,1.0,6.0,0.0,428.0,6.0,118.0,135.0,499.0,428.0,6.0,118.0,135.0,499.0,1.0,23.0,0.0,38.0,3.0,17.0,499.0,67.0,23.0,9.0,25.0,6.0,29.0,286.0,2.0,499.0,12.0,499.0,16.0,8.0,499.0,13.0,301.0,499.0,499.0,38.0,3.0,17.0,499.0,67.0,23.0,9.0,25.0,6.0,29.0,286.0,2.0,499.0,12.0,499.0,16.0,8.0,499.0,13.0,301.0,499.0,499.0,1.0,27.0,0.0,6.0,199.0,499.0,68.0,9.0,3.0,18.0,46.0,499.0,7.0,499.0,499.0,12.0,329.0,20.0,499.0,499.0,7.0,16.0,499.0,4.0,21.0,499.0,20.0,499.0,499.0,6.0,199.0,499.0,68.0,9.0,3.0,18.0,46.0,499.0,7.0,499.0,499.0,12.0,329.0,20.0,499.0,499.0,7.0,16.0,499.0,4.0,21.0,499.0,20.0,499.0,499.0,1.0,6.0,0.0,6.0,78.0,326.0,48.0,499.0,6.0,78.0,326.0,48.0,499.0,1.0,12.0,0.0,19.0,499.0,7.0,499.0,499.0,499.0,11.0,104.0,8.0,499.0,499.0,19.0,499.0,7.0,499.0,499.0,499.0,11.0,104.0,8.0,499.0,499.0,1.0,11.0,0.0,499.0,16.0,58.0,499.0,19.0,53.0,11.0,3.0,54.0,395.0,499.0,16.0,58.0,499.0,19.0,53.0,11.0,3.0,54.0,395.0,1.0,15.0,0.0,75.0,499.0,10.0,499.0,16.0,58.0,69.0,192.0,19.0,8.0,499.0,499.0,107.0,133.0,75.0,499.0,10.0,499.0,16.0,58.0,69.0,192.0,19.0,8.0,499.0,499.0,107.0,133.0,1.0,24.0,0.0,6.0,499.0,59.0,499.0,61.0,19.0,379.0,12.0,28.0,499.0,499.0,368.0,7.0,101.0,19.0,2.0,364.0,184.0,128.0,499.0,5.0,5.0,184.0,6.0,499.0,59.0,499.0,61.0,19.0,379.0,12.0,28.0,499.0,499.0,368.0,7.0,101.0,19.0,2.0,364.0,184.0,128.0,499.0,5.0,5.0,184.0,1.0,14.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,499.0,74.0,499.0,5.0,5.0,184.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,499.0,74.0,499.0,5.0,5.0,184.0,1.0,47.0,0.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,303.0,82.0,499.0,82.0,499.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,499.0,5.0,499.0,5.0,499.0,5.0,303.0,82.0,499.0,82.0,499.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,82.0,13.0,13.0,13.0,13.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,1.0,31.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,193.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,193.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,33.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,125.0,486.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,125.0,486.0,499.0,499.0,13.0,499.0,499.0,5.0,5.0,184.0,1.0,33.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,37.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,222.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,222.0,499.0,5.0,5.0,184.0,1.0,39.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,190.0,396.0,14.0,14.0,325.0,289.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,325.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,499.0,13.0,499.0,13.0,222.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,190.0,396.0,14.0,14.0,325.0,289.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,325.0,499.0,5.0,5.0,184.0,1.0,32.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,325.0,13.0,289.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,276.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,325.0,13.0,289.0,13.0,499.0,82.0,499.0,245.0,499.0,14.0,14.0,276.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,184.0,1.0,38.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,276.0,13.0,499.0,82.0,499.0,245.0,499.0,499.0,14.0,14.0,304.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,113.0,499.0,499.0,499.0,13.0,499.0,499.0,304.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,276.0,13.0,499.0,82.0,499.0,245.0,499.0,499.0,14.0,14.0,304.0,499.0,14.0,14.0,82.0,499.0,499.0,499.0,499.0,113.0,499.0,499.0,499.0,13.0,499.0,499.0,304.0,499.0,5.0,5.0,184.0,1.0,46.0,0.0,35.0,5.0,128.0,5.0,499.0,13.0,304.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,82.0,14.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,14.0,82.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,74.0,499.0,5.0,5.0,184.0,35.0,5.0,128.0,5.0,499.0,13.0,304.0,13.0,499.0,13.0,499.0,82.0,499.0,245.0,499.0,82.0,14.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,14.0,82.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,14.0,14.0,499.0,14.0,14.0,82.0,499.0,74.0,499.0,5.0,5.0,184.0,1.0,12.0,0.0,35.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,82.0,35.0,446.0,13.0,499.0,13.0,499.0,499.0,499.0,13.0,499.0,82.0,1.0,35.0,0.0,39.0,499.0,499.0,499.0,16.0,46.0,499.0,317.0,13.0,499.0,499.0,15.0,499.0,84.0,499.0,40.0,499.0,4.0,22.0,499.0,15.0,320.0,499.0,499.0,7.0,437.0,499.0,2.0,499.0,47.0,3.0,54.0,499.0,20.0,39.0,499.0,499.0,499.0,16.0,46.0,499.0,317.0,13.0,499.0,499.0,15.0,499.0,84.0,499.0,40.0,499.0,4.0,22.0,499.0,15.0,320.0,499.0,499.0,7.0,437.0,499.0,2.0,499.0,47.0,3.0,54.0,499.0,20.0,1.0,26.0,0.0,499.0,499.0,499.0,499.0,73.0,23.0,2.0,499.0,168.0,499.0,9.0,15.0,499.0,33.0,499.0,74.0,137.0,59.0,499.0,499.0,10.0,2.0,499.0,362.0,499.0,499.0,499.0,499.0,499.0,73.0,23.0,2.0,499.0,168.0,499.0,9.0,15.0,499.0,33.0,499.0,74.0,137.0,59.0,499.0,499.0,10.0,2.0,499.0,362.0,499.0,1.0,6.0,0.0,499.0,499.0,499.0,33.0,499.0,499.0,499.0,499.0,33.0,499.0,1.0,11.0,0.0,47.0,51.0,156.0,4.0,499.0,499.0,2.0,391.0,10.0,499.0,47.0,51.0,156.0,4.0,499.0,499.0,2.0,391.0,10.0,499.0,1.0,9.0,0.0,33.0,174.0,8.0,98.0,117.0,10.0,499.0,43.0,33.0,174.0,8.0,98.0,117.0,10.0,499.0,43.0,1.0,48.0,0.0,6.0,3.0,120.0,151.0,499.0,2.0,458.0,12.0,499.0,499.0,111.0,499.0,57.0,200.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,77.0,2.0,499.0,7.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,419.0,8.0,499.0,15.0,2.0,499.0,6.0,3.0,120.0,151.0,499.0,2.0,458.0,12.0,499.0,499.0,111.0,499.0,57.0,200.0,499.0,499.0,2.0,499.0,499.0,499.0,2.0,499.0,499.0,499.0,10.0,499.0,7.0,499.0,499.0,499.0,77.0,2.0,499.0,7.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,419.0,8.0,499.0,15.0,2.0,499.0,1.0,28.0,0.0,41.0,24.0,3.0,54.0,296.0,499.0,20.0,237.0,10.0,294.0,12.0,28.0,499.0,4.0,499.0,183.0,2.0,499.0,7.0,499.0,10.0,57.0,499.0,15.0,8.0,499.0,499.0,41.0,24.0,3.0,54.0,296.0,499.0,20.0,237.0,10.0,294.0,12.0,28.0,499.0,4.0,499.0,183.0,2.0,499.0,7.0,499.0,10.0,57.0,499.0,15.0,8.0,499.0,499.0,1.0,7.0,0.0,258.0,10.0,8.0,499.0,499.0,152.0,258.0,10.0,8.0,499.0,499.0,152.0,1.0,18.0,0.0,8.0,499.0,37.0,39.0,499.0,499.0,499.0,15.0,8.0,499.0,20.0,499.0,165.0,334.0,46.0,61.0,499.0,8.0,499.0,37.0,39.0,499.0,499.0,499.0,15.0,8.0,499.0,20.0,499.0,165.0,334.0,46.0,61.0,499.0,1.0,44.0,0.0,9.0,29.0,311.0,499.0,4.0,46.0,499.0,499.0,23.0,106.0,128.0,7.0,499.0,61.0,16.0,114.0,11.0,91.0,151.0,21.0,499.0,19.0,477.0,499.0,9.0,14.0,16.0,14.0,2.0,101.0,499.0,25.0,499.0,27.0,499.0,31.0,45.0,3.0,18.0,160.0,146.0,4.0,9.0,9.0,29.0,311.0,499.0,4.0,46.0,499.0,499.0,23.0,106.0,128.0,7.0,499.0,61.0,16.0,114.0,11.0,91.0,151.0,21.0,499.0,19.0,477.0,499.0,9.0,14.0,16.0,14.0,2.0,101.0,499.0,25.0,499.0,27.0,499.0,31.0,45.0,3.0,18.0,160.0,146.0,4.0,9.0,1.0,23.0,0.0,499.0,67.0,499.0,52.0,6.0,95.0,42.0,123.0,499.0,499.0,3.0,18.0,28.0,46.0,330.0,10.0,499.0,499.0,7.0,24.0,499.0,9.0,499.0,67.0,499.0,52.0,6.0,95.0,42.0,123.0,499.0,499.0,3.0,18.0,28.0,46.0,330.0,10.0,499.0,499.0,7.0,24.0,499.0,9.0,1.0,11.0,0.0,55.0,63.0,499.0,4.0,22.0,57.0,405.0,499.0,64.0,499.0,55.0,63.0,499.0,4.0,22.0,57.0,405.0,499.0,64.0,499.0,1.0,22.0,0.0,30.0,499.0,3.0,18.0,175.0,282.0,499.0,12.0,55.0,63.0,499.0,48.0,293.0,4.0,50.0,499.0,499.0,499.0,33.0,499.0,499.0,30.0,499.0,3.0,18.0,175.0,282.0,499.0,12.0,55.0,63.0,499.0,48.0,293.0,4.0,50.0,499.0,499.0,499.0,33.0,499.0,499.0,1.0,10.0,0.0,24.0,40.0,104.0,4.0,21.0,499.0,499.0,7.0,499.0,24.0,40.0,104.0,4.0,21.0,499.0,499.0,7.0,499.0,1.0,59.0,0.0,499.0,499.0,499.0,36.0,166.0,56.0,81.0,499.0,89.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,13.0,499.0,14.0,14.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,7.0,27.0,2.0,499.0,499.0,284.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,89.0,95.0,2.0,140.0,499.0,19.0,58.0,89.0,499.0,5.0,5.0,80.0,499.0,499.0,499.0,36.0,166.0,56.0,81.0,499.0,89.0,499.0,499.0,499.0,499.0,14.0,14.0,499.0,13.0,499.0,14.0,14.0,499.0,12.0,499.0,2.0,499.0,499.0,499.0,499.0,499.0,7.0,499.0,7.0,27.0,2.0,499.0,499.0,284.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,89.0,95.0,2.0,140.0,499.0,19.0,58.0,89.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,35.0,0.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,13.0,499.0,11.0,241.0,21.0,499.0,15.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,36.0,499.0,3.0,18.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,13.0,499.0,11.0,241.0,21.0,499.0,15.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,36.0,499.0,3.0,18.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,33.0,499.0,13.0,499.0,35.0,5.0,94.0,5.0,401.0,5.0,140.0,5.0,499.0,33.0,499.0,13.0,499.0,1.0,5.0,0.0,499.0,5.0,5.0,499.0,499.0,5.0,5.0,499.0,1.0,4.0,0.0,499.0,13.0,499.0,499.0,13.0,499.0,1.0,32.0,0.0,35.0,5.0,499.0,13.0,499.0,13.0,474.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,2.0,499.0,499.0,5.0,5.0,499.0,35.0,5.0,499.0,13.0,499.0,13.0,474.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,13.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,2.0,0.0,238.0,238.0,1.0,19.0,0.0,35.0,5.0,499.0,5.0,401.0,5.0,13.0,499.0,401.0,499.0,5.0,499.0,499.0,13.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,401.0,5.0,13.0,499.0,401.0,499.0,5.0,499.0,499.0,13.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,7.0,0.0,35.0,5.0,499.0,5.0,5.0,80.0,35.0,5.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,499.0,499.0,1.0,28.0,0.0,35.0,5.0,33.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,33.0,499.0,499.0,13.0,499.0,11.0,366.0,21.0,499.0,15.0,499.0,134.0,499.0,499.0,13.0,14.0,499.0,35.0,5.0,33.0,5.0,94.0,5.0,499.0,13.0,499.0,499.0,33.0,499.0,499.0,13.0,499.0,11.0,366.0,21.0,499.0,15.0,499.0,134.0,499.0,499.0,13.0,14.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,28.0,0.0,438.0,499.0,14.0,26.0,11.0,3.0,54.0,499.0,30.0,64.0,8.0,499.0,499.0,11.0,34.0,499.0,193.0,15.0,46.0,15.0,13.0,499.0,375.0,499.0,5.0,5.0,499.0,438.0,499.0,14.0,26.0,11.0,3.0,54.0,499.0,30.0,64.0,8.0,499.0,499.0,11.0,34.0,499.0,193.0,15.0,46.0,15.0,13.0,499.0,375.0,499.0,5.0,5.0,499.0,1.0,6.0,0.0,35.0,5.0,375.0,5.0,499.0,35.0,5.0,375.0,5.0,499.0,1.0,2.0,0.0,499.0,499.0,1.0,21.0,0.0,438.0,5.0,401.0,26.0,11.0,60.0,31.0,4.0,499.0,141.0,158.0,2.0,357.0,74.0,499.0,30.0,499.0,5.0,5.0,80.0,438.0,5.0,401.0,26.0,11.0,60.0,31.0,4.0,499.0,141.0,158.0,2.0,357.0,74.0,499.0,30.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,20.0,0.0,35.0,5.0,158.0,5.0,499.0,13.0,13.0,13.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,158.0,5.0,499.0,13.0,13.0,13.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,401.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,401.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,50.0,0.0,6.0,38.0,3.0,17.0,156.0,4.0,54.0,13.0,220.0,36.0,385.0,180.0,11.0,499.0,2.0,499.0,7.0,499.0,12.0,9.0,60.0,21.0,14.0,219.0,14.0,499.0,4.0,261.0,8.0,187.0,499.0,499.0,12.0,499.0,2.0,499.0,10.0,114.0,12.0,111.0,21.0,499.0,74.0,63.0,441.0,20.0,8.0,499.0,499.0,6.0,38.0,3.0,17.0,156.0,4.0,54.0,13.0,220.0,36.0,385.0,180.0,11.0,499.0,2.0,499.0,7.0,499.0,12.0,9.0,60.0,21.0,14.0,219.0,14.0,499.0,4.0,261.0,8.0,187.0,499.0,499.0,12.0,499.0,2.0,499.0,10.0,114.0,12.0,111.0,21.0,499.0,74.0,63.0,441.0,20.0,8.0,499.0,499.0,1.0,26.0,0.0,6.0,295.0,220.0,12.0,499.0,7.0,499.0,79.0,499.0,392.0,499.0,11.0,131.0,13.0,12.0,3.0,18.0,108.0,6.0,499.0,15.0,4.0,499.0,11.0,499.0,6.0,295.0,220.0,12.0,499.0,7.0,499.0,79.0,499.0,392.0,499.0,11.0,131.0,13.0,12.0,3.0,18.0,108.0,6.0,499.0,15.0,4.0,499.0,11.0,499.0,1.0,11.0,0.0,36.0,499.0,16.0,4.0,261.0,195.0,499.0,499.0,441.0,499.0,36.0,499.0,16.0,4.0,261.0,195.0,499.0,499.0,441.0,499.0,1.0,13.0,0.0,499.0,499.0,499.0,30.0,499.0,19.0,126.0,499.0,499.0,499.0,5.0,499.0,499.0,499.0,499.0,30.0,499.0,19.0,126.0,499.0,499.0,499.0,5.0,499.0,1.0,5.0,0.0,64.0,2.0,499.0,499.0,64.0,2.0,499.0,499.0,1.0,9.0,0.0,499.0,195.0,499.0,16.0,8.0,87.0,499.0,499.0,499.0,195.0,499.0,16.0,8.0,87.0,499.0,499.0,1.0,21.0,0.0,136.0,20.0,8.0,499.0,11.0,34.0,499.0,19.0,106.0,499.0,7.0,499.0,16.0,114.0,27.0,132.0,499.0,50.0,4.0,294.0,136.0,20.0,8.0,499.0,11.0,34.0,499.0,19.0,106.0,499.0,7.0,499.0,16.0,114.0,27.0,132.0,499.0,50.0,4.0,294.0,1.0,27.0,0.0,45.0,16.0,499.0,499.0,499.0,4.0,181.0,191.0,499.0,20.0,457.0,55.0,499.0,7.0,499.0,399.0,151.0,267.0,20.0,2.0,499.0,10.0,137.0,224.0,8.0,499.0,45.0,16.0,499.0,499.0,499.0,4.0,181.0,191.0,499.0,20.0,457.0,55.0,499.0,7.0,499.0,399.0,151.0,267.0,20.0,2.0,499.0,10.0,137.0,224.0,8.0,499.0,1.0,46.0,0.0,45.0,28.0,72.0,119.0,281.0,4.0,179.0,64.0,39.0,294.0,7.0,332.0,282.0,100.0,7.0,499.0,8.0,28.0,183.0,42.0,499.0,192.0,4.0,499.0,499.0,15.0,2.0,499.0,7.0,499.0,9.0,59.0,499.0,26.0,27.0,9.0,62.0,499.0,61.0,499.0,28.0,183.0,42.0,499.0,6.0,45.0,28.0,72.0,119.0,281.0,4.0,179.0,64.0,39.0,294.0,7.0,332.0,282.0,100.0,7.0,499.0,8.0,28.0,183.0,42.0,499.0,192.0,4.0,499.0,499.0,15.0,2.0,499.0,7.0,499.0,9.0,59.0,499.0,26.0,27.0,9.0,62.0,499.0,61.0,499.0,28.0,183.0,42.0,499.0,6.0,1.0,53.0,0.0,499.0,55.0,499.0,499.0,13.0,499.0,198.0,16.0,222.0,132.0,10.0,193.0,499.0,499.0,84.0,34.0,21.0,499.0,499.0,84.0,16.0,499.0,279.0,2.0,499.0,63.0,482.0,86.0,46.0,499.0,499.0,20.0,195.0,402.0,7.0,45.0,28.0,499.0,23.0,2.0,499.0,336.0,16.0,45.0,499.0,169.0,499.0,7.0,34.0,9.0,21.0,499.0,499.0,55.0,499.0,499.0,13.0,499.0,198.0,16.0,222.0,132.0,10.0,193.0,499.0,499.0,84.0,34.0,21.0,499.0,499.0,84.0,16.0,499.0,279.0,2.0,499.0,63.0,482.0,86.0,46.0,499.0,499.0,20.0,195.0,402.0,7.0,45.0,28.0,499.0,23.0,2.0,499.0,336.0,16.0,45.0,499.0,169.0,499.0,7.0,34.0,9.0,21.0,499.0,1.0,46.0,0.0,30.0,499.0,183.0,323.0,499.0,10.0,2.0,361.0,499.0,87.0,222.0,52.0,11.0,28.0,15.0,2.0,439.0,10.0,8.0,499.0,7.0,75.0,40.0,137.0,59.0,499.0,499.0,4.0,36.0,499.0,12.0,240.0,2.0,499.0,499.0,499.0,10.0,2.0,76.0,402.0,499.0,499.0,20.0,2.0,499.0,30.0,499.0,183.0,323.0,499.0,10.0,2.0,361.0,499.0,87.0,222.0,52.0,11.0,28.0,15.0,2.0,439.0,10.0,8.0,499.0,7.0,75.0,40.0,137.0,59.0,499.0,499.0,4.0,36.0,499.0,12.0,240.0,2.0,499.0,499.0,499.0,10.0,2.0,76.0,402.0,499.0,499.0,20.0,2.0,499.0,1.0,39.0,0.0,499.0,15.0,336.0,45.0,16.0,8.0,177.0,10.0,499.0,99.0,64.0,42.0,66.0,404.0,3.0,17.0,499.0,219.0,48.0,146.0,76.0,69.0,499.0,499.0,499.0,13.0,499.0,4.0,42.0,66.0,104.0,8.0,58.0,499.0,499.0,499.0,499.0,499.0,499.0,15.0,336.0,45.0,16.0,8.0,177.0,10.0,499.0,99.0,64.0,42.0,66.0,404.0,3.0,17.0,499.0,219.0,48.0,146.0,76.0,69.0,499.0,499.0,499.0,13.0,499.0,4.0,42.0,66.0,104.0,8.0,58.0,499.0,499.0,499.0,499.0,499.0,1.0,6.0,0.0,2.0,499.0,499.0,56.0,164.0,2.0,499.0,499.0,56.0,164.0,1.0,35.0,0.0,24.0,3.0,54.0,37.0,2.0,262.0,10.0,2.0,499.0,499.0,41.0,2.0,499.0,138.0,3.0,17.0,126.0,25.0,2.0,499.0,130.0,11.0,34.0,37.0,236.0,499.0,40.0,218.0,25.0,55.0,63.0,34.0,499.0,11.0,24.0,3.0,54.0,37.0,2.0,262.0,10.0,2.0,499.0,499.0,41.0,2.0,499.0,138.0,3.0,17.0,126.0,25.0,2.0,499.0,130.0,11.0,34.0,37.0,236.0,499.0,40.0,218.0,25.0,55.0,63.0,34.0,499.0,11.0,1.0,32.0,0.0,6.0,78.0,30.0,68.0,26.0,11.0,149.0,499.0,24.0,3.0,109.0,221.0,11.0,118.0,43.0,32.0,97.0,499.0,170.0,87.0,242.0,42.0,499.0,405.0,4.0,2.0,499.0,15.0,2.0,155.0,115.0,6.0,78.0,30.0,68.0,26.0,11.0,149.0,499.0,24.0,3.0,109.0,221.0,11.0,118.0,43.0,32.0,97.0,499.0,170.0,87.0,242.0,42.0,499.0,405.0,4.0,2.0,499.0,15.0,2.0,155.0,115.0,1.0,24.0,0.0,12.0,117.0,11.0,34.0,499.0,33.0,499.0,7.0,27.0,499.0,42.0,66.0,499.0,499.0,19.0,57.0,499.0,33.0,53.0,13.0,22.0,13.0,11.0,12.0,117.0,11.0,34.0,499.0,33.0,499.0,7.0,27.0,499.0,42.0,66.0,499.0,499.0,19.0,57.0,499.0,33.0,53.0,13.0,22.0,13.0,11.0,1.0,37.0,0.0,89.0,24.0,157.0,9.0,153.0,499.0,7.0,75.0,153.0,499.0,499.0,7.0,499.0,89.0,89.0,89.0,89.0,85.0,238.0,496.0,15.0,450.0,157.0,27.0,22.0,499.0,33.0,77.0,499.0,279.0,14.0,135.0,14.0,238.0,499.0,9.0,89.0,24.0,157.0,9.0,153.0,499.0,7.0,75.0,153.0,499.0,499.0,7.0,499.0,89.0,89.0,89.0,89.0,85.0,238.0,496.0,15.0,450.0,157.0,27.0,22.0,499.0,33.0,77.0,499.0,279.0,14.0,135.0,14.0,238.0,499.0,9.0,1.0,22.0,0.0,24.0,131.0,8.0,499.0,499.0,499.0,191.0,499.0,7.0,238.0,499.0,43.0,19.0,2.0,499.0,7.0,499.0,4.0,122.0,9.0,499.0,24.0,131.0,8.0,499.0,499.0,499.0,191.0,499.0,7.0,238.0,499.0,43.0,19.0,2.0,499.0,7.0,499.0,4.0,122.0,9.0,499.0,1.0,35.0,0.0,6.0,3.0,71.0,27.0,182.0,13.0,6.0,72.0,78.0,12.0,8.0,210.0,262.0,6.0,499.0,4.0,499.0,4.0,2.0,499.0,4.0,124.0,61.0,79.0,499.0,9.0,29.0,7.0,39.0,385.0,29.0,499.0,13.0,499.0,6.0,3.0,71.0,27.0,182.0,13.0,6.0,72.0,78.0,12.0,8.0,210.0,262.0,6.0,499.0,4.0,499.0,4.0,2.0,499.0,4.0,124.0,61.0,79.0,499.0,9.0,29.0,7.0,39.0,385.0,29.0,499.0,13.0,499.0,1.0,17.0,0.0,84.0,16.0,116.0,108.0,30.0,166.0,499.0,4.0,46.0,499.0,387.0,427.0,69.0,2.0,499.0,499.0,84.0,16.0,116.0,108.0,30.0,166.0,499.0,4.0,46.0,499.0,387.0,427.0,69.0,2.0,499.0,499.0,1.0,10.0,0.0,9.0,62.0,376.0,162.0,23.0,4.0,36.0,499.0,499.0,9.0,62.0,376.0,162.0,23.0,4.0,36.0,499.0,499.0,1.0,22.0,0.0,26.0,11.0,499.0,499.0,15.0,2.0,499.0,499.0,499.0,93.0,11.0,9.0,62.0,21.0,15.0,499.0,499.0,85.0,178.0,262.0,499.0,26.0,11.0,499.0,499.0,15.0,2.0,499.0,499.0,499.0,93.0,11.0,9.0,62.0,21.0,15.0,499.0,499.0,85.0,178.0,262.0,499.0,1.0,11.0,0.0,11.0,3.0,109.0,156.0,4.0,499.0,9.0,152.0,46.0,499.0,11.0,3.0,109.0,156.0,4.0,499.0,9.0,152.0,46.0,499.0,1.0,26.0,0.0,499.0,499.0,16.0,499.0,239.0,189.0,19.0,499.0,6.0,3.0,110.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,26.0,188.0,28.0,499.0,4.0,11.0,499.0,499.0,16.0,499.0,239.0,189.0,19.0,499.0,6.0,3.0,110.0,499.0,499.0,499.0,499.0,499.0,5.0,499.0,499.0,26.0,188.0,28.0,499.0,4.0,11.0,1.0,49.0,0.0,133.0,12.0,11.0,22.0,499.0,36.0,499.0,23.0,499.0,91.0,21.0,499.0,255.0,499.0,334.0,499.0,499.0,41.0,11.0,3.0,109.0,499.0,95.0,8.0,499.0,499.0,15.0,499.0,23.0,319.0,499.0,499.0,499.0,410.0,133.0,4.0,2.0,499.0,23.0,2.0,499.0,472.0,36.0,499.0,36.0,499.0,93.0,499.0,133.0,12.0,11.0,22.0,499.0,36.0,499.0,23.0,499.0,91.0,21.0,499.0,255.0,499.0,334.0,499.0,499.0,41.0,11.0,3.0,109.0,499.0,95.0,8.0,499.0,499.0,15.0,499.0,23.0,319.0,499.0,499.0,499.0,410.0,133.0,4.0,2.0,499.0,23.0,2.0,499.0,472.0,36.0,499.0,36.0,499.0,93.0,499.0,1.0,28.0,0.0,196.0,6.0,3.0,120.0,150.0,30.0,499.0,30.0,16.0,72.0,8.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,76.0,499.0,25.0,9.0,16.0,112.0,8.0,499.0,499.0,196.0,6.0,3.0,120.0,150.0,30.0,499.0,30.0,16.0,72.0,8.0,499.0,499.0,499.0,19.0,499.0,499.0,4.0,76.0,499.0,25.0,9.0,16.0,112.0,8.0,499.0,499.0,1.0,23.0,0.0,6.0,51.0,499.0,423.0,30.0,29.0,499.0,4.0,499.0,136.0,499.0,363.0,7.0,27.0,11.0,499.0,25.0,51.0,240.0,30.0,15.0,229.0,6.0,51.0,499.0,423.0,30.0,29.0,499.0,4.0,499.0,136.0,499.0,363.0,7.0,27.0,11.0,499.0,25.0,51.0,240.0,30.0,15.0,229.0,1.0,35.0,0.0,48.0,499.0,6.0,51.0,499.0,277.0,499.0,499.0,113.0,327.0,499.0,23.0,499.0,7.0,499.0,31.0,6.0,150.0,8.0,499.0,282.0,499.0,499.0,6.0,3.0,110.0,118.0,327.0,499.0,113.0,499.0,23.0,499.0,499.0,48.0,499.0,6.0,51.0,499.0,277.0,499.0,499.0,113.0,327.0,499.0,23.0,499.0,7.0,499.0,31.0,6.0,150.0,8.0,499.0,282.0,499.0,499.0,6.0,3.0,110.0,118.0,327.0,499.0,113.0,499.0,23.0,499.0,499.0,1.0,23.0,0.0,6.0,186.0,3.0,17.0,148.0,499.0,23.0,499.0,499.0,351.0,36.0,499.0,16.0,499.0,84.0,16.0,77.0,101.0,69.0,464.0,19.0,499.0,6.0,186.0,3.0,17.0,148.0,499.0,23.0,499.0,499.0,351.0,36.0,499.0,16.0,499.0,84.0,16.0,77.0,101.0,69.0,464.0,19.0,499.0,1.0,19.0,0.0,499.0,16.0,116.0,2.0,415.0,499.0,9.0,3.0,18.0,44.0,499.0,165.0,170.0,499.0,16.0,2.0,296.0,499.0,499.0,16.0,116.0,2.0,415.0,499.0,9.0,3.0,18.0,44.0,499.0,165.0,170.0,499.0,16.0,2.0,296.0,499.0,1.0,11.0,0.0,416.0,9.0,29.0,499.0,499.0,36.0,499.0,214.0,499.0,347.0,416.0,9.0,29.0,499.0,499.0,36.0,499.0,214.0,499.0,347.0,1.0,13.0,0.0,12.0,3.0,18.0,2.0,103.0,499.0,139.0,6.0,3.0,120.0,260.0,499.0,12.0,3.0,18.0,2.0,103.0,499.0,139.0,6.0,3.0,120.0,260.0,499.0,1.0,47.0,0.0,6.0,38.0,3.0,17.0,499.0,48.0,2.0,499.0,499.0,25.0,499.0,499.0,6.0,31.0,4.0,148.0,23.0,255.0,499.0,41.0,6.0,34.0,22.0,46.0,499.0,23.0,76.0,256.0,25.0,6.0,34.0,3.0,17.0,51.0,12.0,52.0,30.0,499.0,265.0,499.0,499.0,499.0,263.0,41.0,499.0,499.0,6.0,38.0,3.0,17.0,499.0,48.0,2.0,499.0,499.0,25.0,499.0,499.0,6.0,31.0,4.0,148.0,23.0,255.0,499.0,41.0,6.0,34.0,22.0,46.0,499.0,23.0,76.0,256.0,25.0,6.0,34.0,3.0,17.0,51.0,12.0,52.0,30.0,499.0,265.0,499.0,499.0,499.0,263.0,41.0,499.0,499.0,1.0,8.0,0.0,499.0,499.0,499.0,9.0,3.0,18.0,499.0,499.0,499.0,499.0,9.0,3.0,18.0,499.0,1.0,28.0,0.0,6.0,3.0,120.0,81.0,499.0,2.0,499.0,499.0,19.0,2.0,155.0,121.0,7.0,29.0,92.0,499.0,4.0,50.0,4.0,499.0,170.0,9.0,499.0,262.0,2.0,499.0,169.0,6.0,3.0,120.0,81.0,499.0,2.0,499.0,499.0,19.0,2.0,155.0,121.0,7.0,29.0,92.0,499.0,4.0,50.0,4.0,499.0,170.0,9.0,499.0,262.0,2.0,499.0,169.0,1.0,20.0,0.0,6.0,3.0,71.0,137.0,252.0,499.0,499.0,499.0,499.0,2.0,209.0,41.0,437.0,56.0,81.0,499.0,499.0,7.0,499.0,6.0,3.0,71.0,137.0,252.0,499.0,499.0,499.0,499.0,2.0,209.0,41.0,437.0,56.0,81.0,499.0,499.0,7.0,499.0,1.0,9.0,0.0,499.0,10.0,2.0,498.0,28.0,87.0,494.0,168.0,499.0,10.0,2.0,498.0,28.0,87.0,494.0,168.0,1.0,11.0,0.0,499.0,392.0,10.0,342.0,30.0,16.0,8.0,297.0,221.0,171.0,499.0,392.0,10.0,342.0,30.0,16.0,8.0,297.0,221.0,171.0,1.0,30.0,0.0,499.0,6.0,3.0,71.0,112.0,499.0,137.0,252.0,499.0,167.0,7.0,6.0,65.0,12.0,3.0,18.0,53.0,499.0,213.0,190.0,499.0,11.0,8.0,499.0,13.0,407.0,362.0,4.0,499.0,499.0,6.0,3.0,71.0,112.0,499.0,137.0,252.0,499.0,167.0,7.0,6.0,65.0,12.0,3.0,18.0,53.0,499.0,213.0,190.0,499.0,11.0,8.0,499.0,13.0,407.0,362.0,4.0,499.0,1.0,25.0,0.0,499.0,499.0,499.0,6.0,3.0,120.0,499.0,4.0,148.0,9.0,19.0,8.0,248.0,121.0,7.0,6.0,3.0,71.0,499.0,299.0,39.0,117.0,191.0,9.0,499.0,499.0,499.0,6.0,3.0,120.0,499.0,4.0,148.0,9.0,19.0,8.0,248.0,121.0,7.0,6.0,3.0,71.0,499.0,299.0,39.0,117.0,191.0,9.0,1.0,27.0,0.0,6.0,92.0,104.0,4.0,280.0,30.0,83.0,8.0,499.0,5.0,499.0,68.0,10.0,2.0,499.0,10.0,9.0,44.0,9.0,34.0,21.0,499.0,6.0,34.0,3.0,17.0,6.0,92.0,104.0,4.0,280.0,30.0,83.0,8.0,499.0,5.0,499.0,68.0,10.0,2.0,499.0,10.0,9.0,44.0,9.0,34.0,21.0,499.0,6.0,34.0,3.0,17.0,1.0};
+ps_real validation_data[] = {100.0,19.0,0.0,2.0,209.0,16.0,8.0,258.0,499.0,107.0,133.0,152.0,6.0,3.0,71.0,499.0,9.0,3.0,109.0,50.0,101.0,2.0,209.0,16.0,8.0,258.0,499.0,107.0,133.0,152.0,6.0,3.0,71.0,499.0,9.0,3.0,109.0,50.0,101.0,1.0,6.0,0.0,2.0,498.0,499.0,239.0,499.0,2.0,498.0,499.0,239.0,499.0,1.0,15.0,0.0,25.0,2.0,499.0,499.0,31.0,45.0,3.0,18.0,117.0,105.0,132.0,499.0,99.0,23.0,25.0,2.0,499.0,499.0,31.0,45.0,3.0,18.0,117.0,105.0,132.0,499.0,99.0,23.0,1.0,84.0,0.0,499.0,20.0,499.0,499.0,499.0,20.0,422.0,499.0,400.0,499.0,422.0,499.0,499.0,499.0,499.0,499.0,487.0,499.0,44.0,172.0,2.0,499.0,19.0,499.0,53.0,499.0,278.0,499.0,499.0,20.0,499.0,205.0,499.0,7.0,59.0,136.0,499.0,33.0,499.0,13.0,499.0,499.0,499.0,169.0,2.0,337.0,499.0,499.0,499.0,19.0,8.0,499.0,499.0,499.0,12.0,499.0,15.0,499.0,9.0,499.0,31.0,9.0,3.0,18.0,105.0,102.0,291.0,499.0,10.0,9.0,499.0,499.0,172.0,39.0,485.0,41.0,6.0,3.0,71.0,112.0,499.0,9.0,44.0,499.0,20.0,499.0,499.0,499.0,20.0,422.0,499.0,400.0,499.0,422.0,499.0,499.0,499.0,499.0,499.0,487.0,499.0,44.0,172.0,2.0,499.0,19.0,499.0,53.0,499.0,278.0,499.0,499.0,20.0,499.0,205.0,499.0,7.0,59.0,136.0,499.0,33.0,499.0,13.0,499.0,499.0,499.0,169.0,2.0,337.0,499.0,499.0,499.0,19.0,8.0,499.0,499.0,499.0,12.0,499.0,15.0,499.0,9.0,499.0,31.0,9.0,3.0,18.0,105.0,102.0,291.0,499.0,10.0,9.0,499.0,499.0,172.0,39.0,485.0,41.0,6.0,3.0,71.0,112.0,499.0,9.0,44.0,1.0,14.0,0.0,75.0,499.0,499.0,499.0,16.0,116.0,2.0,190.0,325.0,83.0,497.0,260.0,206.0,75.0,499.0,499.0,499.0,16.0,116.0,2.0,190.0,325.0,83.0,497.0,260.0,206.0,1.0,11.0,0.0,168.0,117.0,45.0,3.0,18.0,499.0,499.0,499.0,499.0,499.0,168.0,117.0,45.0,3.0,18.0,499.0,499.0,499.0,499.0,499.0,1.0,54.0,0.0,499.0,23.0,2.0,232.0,499.0,149.0,2.0,156.0,4.0,21.0,58.0,499.0,170.0,24.0,499.0,5.0,62.0,21.0,499.0,32.0,219.0,69.0,24.0,28.0,77.0,499.0,7.0,499.0,66.0,149.0,9.0,3.0,18.0,27.0,499.0,12.0,9.0,3.0,18.0,499.0,41.0,499.0,10.0,43.0,4.0,14.0,22.0,14.0,499.0,7.0,499.0,499.0,499.0,499.0,23.0,2.0,232.0,499.0,149.0,2.0,156.0,4.0,21.0,58.0,499.0,170.0,24.0,499.0,5.0,62.0,21.0,499.0,32.0,219.0,69.0,24.0,28.0,77.0,499.0,7.0,499.0,66.0,149.0,9.0,3.0,18.0,27.0,499.0,12.0,9.0,3.0,18.0,499.0,41.0,499.0,10.0,43.0,4.0,14.0,22.0,14.0,499.0,7.0,499.0,499.0,499.0,1.0,14.0,0.0,6.0,112.0,34.0,3.0,17.0,148.0,8.0,447.0,83.0,153.0,2.0,83.0,499.0,6.0,112.0,34.0,3.0,17.0,148.0,8.0,447.0,83.0,153.0,2.0,83.0,499.0,1.0,105.0,0.0,6.0,34.0,3.0,17.0,77.0,499.0,13.0,499.0,135.0,12.0,7.0,22.0,4.0,168.0,499.0,2.0,382.0,33.0,118.0,225.0,113.0,94.0,4.0,118.0,499.0,187.0,499.0,68.0,6.0,40.0,95.0,8.0,499.0,499.0,75.0,2.0,499.0,499.0,16.0,499.0,7.0,499.0,39.0,499.0,28.0,151.0,499.0,52.0,6.0,393.0,2.0,83.0,52.0,9.0,499.0,113.0,52.0,6.0,264.0,9.0,499.0,41.0,6.0,75.0,22.0,4.0,453.0,356.0,4.0,499.0,2.0,499.0,499.0,499.0,6.0,22.0,55.0,458.0,79.0,2.0,499.0,7.0,382.0,499.0,28.0,41.0,499.0,135.0,2.0,92.0,96.0,499.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,225.0,499.0,499.0,6.0,34.0,3.0,17.0,77.0,499.0,13.0,499.0,135.0,12.0,7.0,22.0,4.0,168.0,499.0,2.0,382.0,33.0,118.0,225.0,113.0,94.0,4.0,118.0,499.0,187.0,499.0,68.0,6.0,40.0,95.0,8.0,499.0,499.0,75.0,2.0,499.0,499.0,16.0,499.0,7.0,499.0,39.0,499.0,28.0,151.0,499.0,52.0,6.0,393.0,2.0,83.0,52.0,9.0,499.0,113.0,52.0,6.0,264.0,9.0,499.0,41.0,6.0,75.0,22.0,4.0,453.0,356.0,4.0,499.0,2.0,499.0,499.0,499.0,6.0,22.0,55.0,458.0,79.0,2.0,499.0,7.0,382.0,499.0,28.0,41.0,499.0,135.0,2.0,92.0,96.0,499.0,499.0,499.0,499.0,13.0,499.0,499.0,499.0,499.0,499.0,225.0,499.0,499.0,1.0,18.0,0.0,32.0,208.0,66.0,499.0,9.0,4.0,39.0,499.0,6.0,3.0,110.0,435.0,323.0,9.0,37.0,106.0,499.0,32.0,208.0,66.0,499.0,9.0,4.0,39.0,499.0,6.0,3.0,110.0,435.0,323.0,9.0,37.0,106.0,499.0,1.0,13.0,0.0,499.0,34.0,21.0,499.0,68.0,45.0,3.0,18.0,41.0,102.0,4.0,448.0,499.0,34.0,21.0,499.0,68.0,45.0,3.0,18.0,41.0,102.0,4.0,448.0,1.0,25.0,0.0,221.0,106.0,51.0,2.0,499.0,444.0,2.0,499.0,40.0,450.0,9.0,45.0,3.0,18.0,59.0,126.0,212.0,444.0,2.0,499.0,20.0,106.0,20.0,499.0,221.0,106.0,51.0,2.0,499.0,444.0,2.0,499.0,40.0,450.0,9.0,45.0,3.0,18.0,59.0,126.0,212.0,444.0,2.0,499.0,20.0,106.0,20.0,499.0,1.0,10.0,0.0,24.0,3.0,54.0,126.0,4.0,440.0,499.0,7.0,440.0,24.0,3.0,54.0,126.0,4.0,440.0,499.0,7.0,440.0,1.0,2.0,0.0,499.0,499.0,1.0,17.0,0.0,77.0,499.0,4.0,143.0,499.0,499.0,499.0,2.0,117.0,499.0,73.0,8.0,499.0,20.0,8.0,408.0,77.0,499.0,4.0,143.0,499.0,499.0,499.0,2.0,117.0,499.0,73.0,8.0,499.0,20.0,8.0,408.0,1.0,13.0,0.0,6.0,3.0,110.0,21.0,499.0,32.0,499.0,395.0,9.0,19.0,12.0,248.0,6.0,3.0,110.0,21.0,499.0,32.0,499.0,395.0,9.0,19.0,12.0,248.0,1.0,12.0,0.0,37.0,39.0,499.0,499.0,6.0,499.0,37.0,119.0,459.0,46.0,471.0,37.0,39.0,499.0,499.0,6.0,499.0,37.0,119.0,459.0,46.0,471.0,1.0,11.0,0.0,499.0,171.0,499.0,12.0,6.0,40.0,34.0,3.0,17.0,499.0,499.0,171.0,499.0,12.0,6.0,40.0,34.0,3.0,17.0,499.0,1.0,33.0,0.0,97.0,351.0,12.0,77.0,8.0,499.0,34.0,21.0,499.0,20.0,8.0,485.0,13.0,23.0,499.0,20.0,8.0,499.0,2.0,499.0,376.0,404.0,3.0,17.0,499.0,499.0,3.0,18.0,499.0,485.0,13.0,23.0,97.0,351.0,12.0,77.0,8.0,499.0,34.0,21.0,499.0,20.0,8.0,485.0,13.0,23.0,499.0,20.0,8.0,499.0,2.0,499.0,376.0,404.0,3.0,17.0,499.0,499.0,3.0,18.0,499.0,485.0,13.0,23.0,1.0,16.0,0.0,26.0,2.0,499.0,88.0,499.0,33.0,499.0,33.0,114.0,10.0,12.0,499.0,499.0,36.0,499.0,26.0,2.0,499.0,88.0,499.0,33.0,499.0,33.0,114.0,10.0,12.0,499.0,499.0,36.0,499.0,1.0,25.0,0.0,89.0,499.0,9.0,73.0,40.0,403.0,392.0,32.0,8.0,499.0,473.0,499.0,68.0,37.0,30.0,124.0,30.0,16.0,2.0,72.0,139.0,360.0,499.0,48.0,89.0,499.0,9.0,73.0,40.0,403.0,392.0,32.0,8.0,499.0,473.0,499.0,68.0,37.0,30.0,124.0,30.0,16.0,2.0,72.0,139.0,360.0,499.0,48.0,1.0,16.0,0.0,24.0,3.0,120.0,151.0,81.0,499.0,52.0,9.0,403.0,4.0,189.0,499.0,20.0,499.0,499.0,24.0,3.0,120.0,151.0,81.0,499.0,52.0,9.0,403.0,4.0,189.0,499.0,20.0,499.0,499.0,1.0,21.0,0.0,24.0,60.0,160.0,499.0,499.0,7.0,118.0,106.0,121.0,20.0,2.0,499.0,7.0,106.0,499.0,20.0,499.0,23.0,8.0,499.0,24.0,60.0,160.0,499.0,499.0,7.0,118.0,106.0,121.0,20.0,2.0,499.0,7.0,106.0,499.0,20.0,499.0,23.0,8.0,499.0,1.0,5.0,0.0,290.0,5.0,5.0,499.0,290.0,5.0,5.0,499.0,1.0,4.0,0.0,35.0,5.0,499.0,35.0,5.0,499.0,1.0,18.0,0.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,21.0,499.0,33.0,146.0,25.0,499.0,30.0,60.0,21.0,499.0,499.0,6.0,3.0,71.0,27.0,293.0,4.0,21.0,499.0,33.0,146.0,25.0,499.0,30.0,60.0,21.0,499.0,1.0,51.0,0.0,39.0,499.0,28.0,499.0,265.0,449.0,25.0,398.0,20.0,46.0,499.0,13.0,499.0,499.0,499.0,499.0,7.0,442.0,499.0,10.0,499.0,3.0,17.0,499.0,499.0,499.0,499.0,19.0,2.0,499.0,499.0,7.0,499.0,382.0,25.0,499.0,499.0,19.0,2.0,499.0,5.0,499.0,4.0,499.0,499.0,26.0,6.0,38.0,3.0,17.0,39.0,499.0,28.0,499.0,265.0,449.0,25.0,398.0,20.0,46.0,499.0,13.0,499.0,499.0,499.0,499.0,7.0,442.0,499.0,10.0,499.0,3.0,17.0,499.0,499.0,499.0,499.0,19.0,2.0,499.0,499.0,7.0,499.0,382.0,25.0,499.0,499.0,19.0,2.0,499.0,5.0,499.0,4.0,499.0,499.0,26.0,6.0,38.0,3.0,17.0,1.0,6.0,0.0,499.0,16.0,8.0,499.0,499.0,499.0,16.0,8.0,499.0,499.0,1.0,21.0,0.0,499.0,42.0,116.0,149.0,31.0,24.0,22.0,8.0,107.0,4.0,2.0,499.0,10.0,39.0,499.0,499.0,7.0,499.0,499.0,105.0,499.0,42.0,116.0,149.0,31.0,24.0,22.0,8.0,107.0,4.0,2.0,499.0,10.0,39.0,499.0,499.0,7.0,499.0,499.0,105.0,1.0,19.0,0.0,135.0,44.0,9.0,3.0,18.0,247.0,499.0,12.0,6.0,3.0,71.0,40.0,499.0,12.0,364.0,499.0,45.0,499.0,135.0,44.0,9.0,3.0,18.0,247.0,499.0,12.0,6.0,3.0,71.0,40.0,499.0,12.0,364.0,499.0,45.0,499.0,1.0,12.0,0.0,6.0,38.0,3.0,17.0,229.0,499.0,191.0,46.0,37.0,13.0,499.0,6.0,38.0,3.0,17.0,229.0,499.0,191.0,46.0,37.0,13.0,499.0,1.0,30.0,0.0,499.0,499.0,213.0,9.0,23.0,367.0,499.0,25.0,499.0,176.0,76.0,499.0,64.0,499.0,3.0,18.0,499.0,499.0,20.0,14.0,6.0,14.0,47.0,78.0,11.0,131.0,8.0,499.0,499.0,499.0,499.0,213.0,9.0,23.0,367.0,499.0,25.0,499.0,176.0,76.0,499.0,64.0,499.0,3.0,18.0,499.0,499.0,20.0,14.0,6.0,14.0,47.0,78.0,11.0,131.0,8.0,499.0,499.0,1.0,21.0,0.0,49.0,34.0,499.0,499.0,499.0,499.0,7.0,2.0,31.0,153.0,499.0,499.0,193.0,12.0,49.0,199.0,4.0,148.0,2.0,83.0,49.0,34.0,499.0,499.0,499.0,499.0,7.0,2.0,31.0,153.0,499.0,499.0,193.0,12.0,49.0,199.0,4.0,148.0,2.0,83.0,1.0,15.0,0.0,9.0,3.0,18.0,48.0,2.0,499.0,23.0,2.0,499.0,27.0,15.0,2.0,499.0,499.0,9.0,3.0,18.0,48.0,2.0,499.0,23.0,2.0,499.0,27.0,15.0,2.0,499.0,499.0,1.0,16.0,0.0,36.0,499.0,56.0,81.0,318.0,499.0,68.0,36.0,499.0,16.0,219.0,69.0,272.0,499.0,320.0,36.0,499.0,56.0,81.0,318.0,499.0,68.0,36.0,499.0,16.0,219.0,69.0,272.0,499.0,320.0,1.0,13.0,0.0,141.0,220.0,2.0,233.0,4.0,448.0,58.0,245.0,290.0,5.0,5.0,80.0,141.0,220.0,2.0,233.0,4.0,448.0,58.0,245.0,290.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,21.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,233.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,233.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,49.0,0.0,89.0,499.0,6.0,3.0,71.0,499.0,499.0,7.0,499.0,41.0,6.0,3.0,120.0,499.0,73.0,20.0,46.0,391.0,10.0,499.0,499.0,32.0,11.0,3.0,110.0,469.0,25.0,6.0,499.0,9.0,58.0,7.0,58.0,2.0,499.0,250.0,13.0,254.0,237.0,69.0,260.0,93.0,68.0,154.0,499.0,499.0,86.0,499.0,89.0,499.0,6.0,3.0,71.0,499.0,499.0,7.0,499.0,41.0,6.0,3.0,120.0,499.0,73.0,20.0,46.0,391.0,10.0,499.0,499.0,32.0,11.0,3.0,110.0,469.0,25.0,6.0,499.0,9.0,58.0,7.0,58.0,2.0,499.0,250.0,13.0,254.0,237.0,69.0,260.0,93.0,68.0,154.0,499.0,499.0,86.0,499.0,1.0,19.0,0.0,9.0,217.0,47.0,22.0,499.0,499.0,64.0,12.0,499.0,499.0,65.0,47.0,465.0,8.0,96.0,439.0,499.0,394.0,9.0,217.0,47.0,22.0,499.0,499.0,64.0,12.0,499.0,499.0,65.0,47.0,465.0,8.0,96.0,439.0,499.0,394.0,1.0,16.0,0.0,154.0,27.0,499.0,23.0,129.0,11.0,34.0,499.0,114.0,153.0,499.0,499.0,48.0,187.0,406.0,154.0,27.0,499.0,23.0,129.0,11.0,34.0,499.0,114.0,153.0,499.0,499.0,48.0,187.0,406.0,1.0,15.0,0.0,126.0,499.0,4.0,11.0,7.0,96.0,499.0,23.0,499.0,499.0,499.0,11.0,142.0,99.0,126.0,499.0,4.0,11.0,7.0,96.0,499.0,23.0,499.0,499.0,499.0,11.0,142.0,99.0,1.0,3.0,0.0,499.0,499.0,499.0,499.0,1.0,13.0,0.0,6.0,3.0,71.0,8.0,373.0,499.0,10.0,499.0,499.0,7.0,2.0,31.0,6.0,3.0,71.0,8.0,373.0,499.0,10.0,499.0,499.0,7.0,2.0,31.0,1.0,9.0,0.0,32.0,253.0,6.0,417.0,499.0,499.0,499.0,410.0,32.0,253.0,6.0,417.0,499.0,499.0,499.0,410.0,1.0,10.0,0.0,7.0,44.0,57.0,499.0,7.0,499.0,13.0,303.0,499.0,7.0,44.0,57.0,499.0,7.0,499.0,13.0,303.0,499.0,1.0,42.0,0.0,6.0,499.0,73.0,226.0,164.0,499.0,10.0,275.0,20.0,39.0,499.0,66.0,29.0,168.0,8.0,499.0,297.0,13.0,499.0,499.0,33.0,499.0,41.0,49.0,151.0,499.0,8.0,499.0,499.0,4.0,235.0,333.0,165.0,7.0,6.0,151.0,499.0,499.0,172.0,499.0,499.0,6.0,499.0,73.0,226.0,164.0,499.0,10.0,275.0,20.0,39.0,499.0,66.0,29.0,168.0,8.0,499.0,297.0,13.0,499.0,499.0,33.0,499.0,41.0,49.0,151.0,499.0,8.0,499.0,499.0,4.0,235.0,333.0,165.0,7.0,6.0,151.0,499.0,499.0,172.0,499.0,499.0,1.0,21.0,0.0,30.0,136.0,150.0,6.0,3.0,120.0,81.0,197.0,86.0,499.0,41.0,47.0,3.0,109.0,95.0,26.0,6.0,499.0,8.0,258.0,30.0,136.0,150.0,6.0,3.0,120.0,81.0,197.0,86.0,499.0,41.0,47.0,3.0,109.0,95.0,26.0,6.0,499.0,8.0,258.0,1.0,21.0,0.0,39.0,83.0,499.0,87.0,499.0,12.0,499.0,499.0,93.0,11.0,77.0,393.0,2.0,83.0,11.0,95.0,15.0,2.0,499.0,499.0,39.0,83.0,499.0,87.0,499.0,12.0,499.0,499.0,93.0,11.0,77.0,393.0,2.0,83.0,11.0,95.0,15.0,2.0,499.0,499.0,1.0,21.0,0.0,367.0,68.0,6.0,499.0,2.0,499.0,499.0,28.0,27.0,499.0,291.0,499.0,32.0,2.0,83.0,91.0,27.0,21.0,61.0,291.0,367.0,68.0,6.0,499.0,2.0,499.0,499.0,28.0,27.0,499.0,291.0,499.0,32.0,2.0,83.0,91.0,27.0,21.0,61.0,291.0,1.0,32.0,0.0,37.0,2.0,340.0,10.0,499.0,31.0,46.0,499.0,138.0,3.0,17.0,12.0,234.0,10.0,2.0,124.0,10.0,137.0,8.0,98.0,499.0,499.0,19.0,499.0,499.0,56.0,4.0,316.0,37.0,59.0,124.0,37.0,2.0,340.0,10.0,499.0,31.0,46.0,499.0,138.0,3.0,17.0,12.0,234.0,10.0,2.0,124.0,10.0,137.0,8.0,98.0,499.0,499.0,19.0,499.0,499.0,56.0,4.0,316.0,37.0,59.0,124.0,1.0,18.0,0.0,34.0,3.0,17.0,92.0,499.0,15.0,2.0,499.0,26.0,11.0,3.0,54.0,112.0,499.0,20.0,499.0,499.0,34.0,3.0,17.0,92.0,499.0,15.0,2.0,499.0,26.0,11.0,3.0,54.0,112.0,499.0,20.0,499.0,499.0,1.0,24.0,0.0,499.0,499.0,499.0,16.0,23.0,499.0,5.0,499.0,26.0,11.0,200.0,46.0,499.0,169.0,11.0,22.0,4.0,50.0,199.0,4.0,226.0,499.0,275.0,499.0,499.0,499.0,16.0,23.0,499.0,5.0,499.0,26.0,11.0,200.0,46.0,499.0,169.0,11.0,22.0,4.0,50.0,199.0,4.0,226.0,499.0,275.0,1.0,11.0,0.0,12.0,3.0,18.0,234.0,10.0,8.0,499.0,497.0,4.0,499.0,12.0,3.0,18.0,234.0,10.0,8.0,499.0,497.0,4.0,499.0,1.0,35.0,0.0,6.0,130.0,24.0,499.0,150.0,24.0,499.0,499.0,499.0,27.0,12.0,6.0,38.0,3.0,17.0,249.0,12.0,497.0,25.0,9.0,138.0,3.0,17.0,53.0,103.0,42.0,66.0,283.0,46.0,330.0,10.0,499.0,499.0,499.0,6.0,130.0,24.0,499.0,150.0,24.0,499.0,499.0,499.0,27.0,12.0,6.0,38.0,3.0,17.0,249.0,12.0,497.0,25.0,9.0,138.0,3.0,17.0,53.0,103.0,42.0,66.0,283.0,46.0,330.0,10.0,499.0,499.0,499.0,1.0,24.0,0.0,499.0,30.0,241.0,21.0,8.0,258.0,499.0,25.0,11.0,111.0,396.0,44.0,2.0,167.0,155.0,7.0,85.0,499.0,8.0,499.0,20.0,499.0,499.0,499.0,30.0,241.0,21.0,8.0,258.0,499.0,25.0,11.0,111.0,396.0,44.0,2.0,167.0,155.0,7.0,85.0,499.0,8.0,499.0,20.0,499.0,499.0,1.0,17.0,0.0,85.0,26.0,24.0,31.0,2.0,499.0,7.0,104.0,4.0,499.0,2.0,499.0,499.0,8.0,499.0,499.0,85.0,26.0,24.0,31.0,2.0,499.0,7.0,104.0,4.0,499.0,2.0,499.0,499.0,8.0,499.0,499.0,1.0,17.0,0.0,6.0,38.0,3.0,17.0,78.0,2.0,499.0,499.0,12.0,147.0,3.0,17.0,22.0,8.0,499.0,499.0,6.0,38.0,3.0,17.0,78.0,2.0,499.0,499.0,12.0,147.0,3.0,17.0,22.0,8.0,499.0,499.0,1.0,5.0,0.0,499.0,31.0,228.0,499.0,499.0,31.0,228.0,499.0,1.0,13.0,0.0,16.0,45.0,8.0,499.0,499.0,19.0,499.0,26.0,27.0,45.0,91.0,21.0,16.0,45.0,8.0,499.0,499.0,19.0,499.0,26.0,27.0,45.0,91.0,21.0,1.0,22.0,0.0,26.0,47.0,111.0,50.0,2.0,499.0,10.0,44.0,2.0,42.0,66.0,246.0,4.0,30.0,464.0,9.0,60.0,311.0,122.0,46.0,499.0,26.0,47.0,111.0,50.0,2.0,499.0,10.0,44.0,2.0,42.0,66.0,246.0,4.0,30.0,464.0,9.0,60.0,311.0,122.0,46.0,499.0,1.0,29.0,0.0,133.0,6.0,111.0,499.0,63.0,7.0,499.0,4.0,9.0,100.0,25.0,6.0,38.0,3.0,17.0,104.0,9.0,4.0,246.0,392.0,32.0,59.0,234.0,10.0,499.0,499.0,33.0,146.0,133.0,6.0,111.0,499.0,63.0,7.0,499.0,4.0,9.0,100.0,25.0,6.0,38.0,3.0,17.0,104.0,9.0,4.0,246.0,392.0,32.0,59.0,234.0,10.0,499.0,499.0,33.0,146.0,1.0,11.0,0.0,6.0,404.0,3.0,17.0,406.0,58.0,20.0,36.0,499.0,499.0,6.0,404.0,3.0,17.0,406.0,58.0,20.0,36.0,499.0,499.0,1.0,14.0,0.0,499.0,6.0,127.0,8.0,373.0,499.0,10.0,499.0,10.0,63.0,10.0,2.0,499.0,499.0,6.0,127.0,8.0,373.0,499.0,10.0,499.0,10.0,63.0,10.0,2.0,499.0,1.0,31.0,0.0,41.0,132.0,380.0,6.0,22.0,499.0,8.0,472.0,4.0,499.0,39.0,499.0,499.0,40.0,15.0,121.0,19.0,168.0,8.0,166.0,13.0,499.0,33.0,37.0,2.0,87.0,236.0,499.0,499.0,165.0,41.0,132.0,380.0,6.0,22.0,499.0,8.0,472.0,4.0,499.0,39.0,499.0,499.0,40.0,15.0,121.0,19.0,168.0,8.0,166.0,13.0,499.0,33.0,37.0,2.0,87.0,236.0,499.0,499.0,165.0,1.0,10.0,0.0,467.0,187.0,499.0,172.0,499.0,499.0,499.0,96.0,181.0,467.0,187.0,499.0,172.0,499.0,499.0,499.0,96.0,181.0,1.0,14.0,0.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,216.0,5.0,5.0,204.0,499.0,499.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,216.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,30.0,0.0,35.0,5.0,140.0,5.0,499.0,64.0,204.0,243.0,499.0,13.0,13.0,13.0,499.0,16.0,8.0,98.0,499.0,499.0,15.0,2.0,14.0,204.0,342.0,499.0,98.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,64.0,204.0,243.0,499.0,13.0,13.0,13.0,499.0,16.0,8.0,98.0,499.0,499.0,15.0,2.0,14.0,204.0,342.0,499.0,98.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,21.0,0.0,35.0,5.0,140.0,5.0,499.0,14.0,499.0,499.0,7.0,2.0,441.0,4.0,499.0,2.0,98.0,463.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,14.0,499.0,499.0,7.0,2.0,441.0,4.0,499.0,2.0,98.0,463.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,38.0,0.0,35.0,5.0,140.0,5.0,499.0,9.0,16.0,31.0,2.0,231.0,499.0,128.0,10.0,2.0,98.0,463.0,169.0,10.0,2.0,83.0,13.0,499.0,46.0,499.0,499.0,84.0,499.0,499.0,2.0,76.0,499.0,499.0,36.0,499.0,74.0,463.0,499.0,35.0,5.0,140.0,5.0,499.0,9.0,16.0,31.0,2.0,231.0,499.0,128.0,10.0,2.0,98.0,463.0,169.0,10.0,2.0,83.0,13.0,499.0,46.0,499.0,499.0,84.0,499.0,499.0,2.0,76.0,499.0,499.0,36.0,499.0,74.0,463.0,499.0,1.0,46.0,0.0,154.0,499.0,28.0,499.0,329.0,10.0,499.0,499.0,74.0,36.0,204.0,84.0,499.0,499.0,201.0,8.0,499.0,201.0,33.0,299.0,499.0,10.0,499.0,499.0,7.0,499.0,32.0,97.0,32.0,499.0,499.0,499.0,61.0,74.0,36.0,499.0,7.0,85.0,499.0,499.0,15.0,36.0,499.0,7.0,499.0,154.0,499.0,28.0,499.0,329.0,10.0,499.0,499.0,74.0,36.0,204.0,84.0,499.0,499.0,201.0,8.0,499.0,201.0,33.0,299.0,499.0,10.0,499.0,499.0,7.0,499.0,32.0,97.0,32.0,499.0,499.0,499.0,61.0,74.0,36.0,499.0,7.0,85.0,499.0,499.0,15.0,36.0,499.0,7.0,499.0,1.0,24.0,0.0,57.0,499.0,463.0,499.0,499.0,76.0,499.0,499.0,2.0,499.0,10.0,36.0,499.0,7.0,499.0,43.0,89.0,499.0,499.0,499.0,5.0,5.0,204.0,57.0,499.0,463.0,499.0,499.0,76.0,499.0,499.0,2.0,499.0,10.0,36.0,499.0,7.0,499.0,43.0,89.0,499.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,322.0,82.0,499.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,499.0,499.0,322.0,82.0,499.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,2.0,499.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,2.0,499.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,14.0,0.0,35.0,5.0,140.0,5.0,310.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,35.0,5.0,140.0,5.0,310.0,499.0,322.0,82.0,499.0,499.0,5.0,5.0,204.0,1.0,2.0,0.0,243.0,243.0,1.0,15.0,0.0,35.0,5.0,140.0,5.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,140.0,5.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,17.0,0.0,35.0,5.0,158.0,5.0,499.0,499.0,499.0,13.0,499.0,113.0,499.0,499.0,499.0,5.0,5.0,80.0,35.0,5.0,158.0,5.0,499.0,499.0,499.0,13.0,499.0,113.0,499.0,499.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,27.0,0.0,35.0,5.0,158.0,5.0,499.0,499.0,113.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,322.0,13.0,230.0,499.0,499.0,322.0,82.0,499.0,5.0,5.0,80.0,35.0,5.0,158.0,5.0,499.0,499.0,113.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,499.0,322.0,13.0,230.0,499.0,499.0,322.0,82.0,499.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,16.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,499.0,322.0,82.0,499.0,5.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,140.0,5.0,499.0,322.0,82.0,499.0,5.0,5.0,499.0,1.0,15.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,30.0,215.0,16.0,15.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,30.0,215.0,16.0,15.0,499.0,1.0,23.0,0.0,70.0,235.0,60.0,21.0,499.0,499.0,77.0,26.0,9.0,16.0,40.0,8.0,499.0,499.0,141.0,499.0,2.0,499.0,499.0,5.0,5.0,499.0,70.0,235.0,60.0,21.0,499.0,499.0,77.0,26.0,9.0,16.0,40.0,8.0,499.0,499.0,141.0,499.0,2.0,499.0,499.0,5.0,5.0,499.0,1.0,11.0,0.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,499.0,35.0,5.0,499.0,5.0,499.0,13.0,499.0,499.0,499.0,499.0,1.0,11.0,0.0,6.0,34.0,95.0,53.0,11.0,3.0,54.0,293.0,4.0,51.0,6.0,34.0,95.0,53.0,11.0,3.0,54.0,293.0,4.0,51.0,1.0,17.0,0.0,19.0,67.0,499.0,4.0,42.0,66.0,499.0,4.0,39.0,499.0,499.0,128.0,10.0,2.0,499.0,499.0,19.0,67.0,499.0,4.0,42.0,66.0,499.0,4.0,39.0,499.0,499.0,128.0,10.0,2.0,499.0,499.0,1.0,20.0,0.0,6.0,34.0,50.0,8.0,499.0,499.0,23.0,10.0,2.0,499.0,10.0,2.0,499.0,191.0,46.0,499.0,33.0,499.0,499.0,6.0,34.0,50.0,8.0,499.0,499.0,23.0,10.0,2.0,499.0,10.0,2.0,499.0,191.0,46.0,499.0,33.0,499.0,499.0,1.0,11.0,0.0,12.0,60.0,21.0,499.0,26.0,2.0,499.0,29.0,105.0,499.0,12.0,60.0,21.0,499.0,26.0,2.0,499.0,29.0,105.0,499.0,1.0,56.0,0.0,8.0,499.0,499.0,86.0,8.0,499.0,7.0,499.0,4.0,2.0,499.0,3.0,6.0,3.0,109.0,22.0,8.0,499.0,7.0,499.0,345.0,11.0,3.0,3.0,182.0,139.0,3.0,2.0,499.0,499.0,7.0,499.0,3.0,25.0,499.0,20.0,2.0,297.0,499.0,3.0,2.0,499.0,499.0,73.0,90.0,420.0,7.0,499.0,3.0,6.0,29.0,499.0,20.0,43.0,3.0,8.0,499.0,499.0,86.0,8.0,499.0,7.0,499.0,4.0,2.0,499.0,3.0,6.0,3.0,109.0,22.0,8.0,499.0,7.0,499.0,345.0,11.0,3.0,3.0,182.0,139.0,3.0,2.0,499.0,499.0,7.0,499.0,3.0,25.0,499.0,20.0,2.0,297.0,499.0,3.0,2.0,499.0,499.0,73.0,90.0,420.0,7.0,499.0,3.0,6.0,29.0,499.0,20.0,43.0,3.0,1.0,24.0,0.0,12.0,7.0,52.0,24.0,499.0,499.0,24.0,60.0,499.0,7.0,499.0,499.0,4.0,499.0,2.0,83.0,171.0,41.0,24.0,111.0,453.0,57.0,499.0,12.0,7.0,52.0,24.0,499.0,499.0,24.0,60.0,499.0,7.0,499.0,499.0,4.0,499.0,2.0,83.0,171.0,41.0,24.0,111.0,453.0,57.0,499.0,1.0,17.0,0.0,57.0,83.0,473.0,499.0,453.0,2.0,499.0,19.0,79.0,24.0,60.0,21.0,19.0,30.0,362.0,499.0,57.0,83.0,473.0,499.0,453.0,2.0,499.0,19.0,79.0,24.0,60.0,21.0,19.0,30.0,362.0,499.0,1.0};
+ps_real test_data[] = {100.0,21.0,0.0,6.0,161.0,499.0,12.0,499.0,60.0,499.0,43.0,309.0,13.0,499.0,24.0,499.0,499.0,15.0,59.0,10.0,57.0,499.0,275.0,6.0,161.0,499.0,12.0,499.0,60.0,499.0,43.0,309.0,13.0,499.0,24.0,499.0,499.0,15.0,59.0,10.0,57.0,499.0,275.0,1.0,11.0,0.0,9.0,29.0,8.0,499.0,7.0,499.0,499.0,179.0,19.0,43.0,9.0,29.0,8.0,499.0,7.0,499.0,499.0,179.0,19.0,43.0,1.0,64.0,0.0,27.0,4.0,499.0,2.0,76.0,266.0,6.0,29.0,15.0,39.0,499.0,499.0,499.0,52.0,499.0,499.0,43.0,73.0,7.0,456.0,79.0,132.0,499.0,10.0,279.0,499.0,24.0,499.0,2.0,499.0,10.0,2.0,499.0,150.0,499.0,2.0,499.0,499.0,456.0,108.0,2.0,499.0,499.0,456.0,79.0,49.0,111.0,21.0,499.0,4.0,499.0,499.0,52.0,2.0,42.0,49.0,29.0,499.0,9.0,64.0,131.0,499.0,371.0,27.0,4.0,499.0,2.0,76.0,266.0,6.0,29.0,15.0,39.0,499.0,499.0,499.0,52.0,499.0,499.0,43.0,73.0,7.0,456.0,79.0,132.0,499.0,10.0,279.0,499.0,24.0,499.0,2.0,499.0,10.0,2.0,499.0,150.0,499.0,2.0,499.0,499.0,456.0,108.0,2.0,499.0,499.0,456.0,79.0,49.0,111.0,21.0,499.0,4.0,499.0,499.0,52.0,2.0,42.0,49.0,29.0,499.0,9.0,64.0,131.0,499.0,371.0,1.0,13.0,0.0,499.0,42.0,34.0,499.0,11.0,86.0,499.0,43.0,499.0,20.0,2.0,389.0,499.0,42.0,34.0,499.0,11.0,86.0,499.0,43.0,499.0,20.0,2.0,389.0,1.0,18.0,0.0,499.0,42.0,34.0,499.0,36.0,389.0,12.0,24.0,28.0,2.0,96.0,212.0,7.0,11.0,28.0,2.0,499.0,499.0,42.0,34.0,499.0,36.0,389.0,12.0,24.0,28.0,2.0,96.0,212.0,7.0,11.0,28.0,2.0,499.0,1.0,28.0,0.0,499.0,42.0,34.0,178.0,73.0,8.0,96.0,499.0,19.0,237.0,41.0,12.0,11.0,65.0,24.0,22.0,274.0,52.0,24.0,92.0,22.0,72.0,274.0,52.0,11.0,28.0,499.0,499.0,42.0,34.0,178.0,73.0,8.0,96.0,499.0,19.0,237.0,41.0,12.0,11.0,65.0,24.0,22.0,274.0,52.0,24.0,92.0,22.0,72.0,274.0,52.0,11.0,28.0,499.0,1.0,29.0,0.0,10.0,2.0,499.0,15.0,39.0,198.0,2.0,499.0,16.0,12.0,39.0,434.0,499.0,499.0,37.0,2.0,420.0,10.0,57.0,499.0,93.0,47.0,499.0,12.0,454.0,88.0,27.0,274.0,10.0,2.0,499.0,15.0,39.0,198.0,2.0,499.0,16.0,12.0,39.0,434.0,499.0,499.0,37.0,2.0,420.0,10.0,57.0,499.0,93.0,47.0,499.0,12.0,454.0,88.0,27.0,274.0,1.0,24.0,0.0,499.0,499.0,47.0,202.0,3.0,17.0,221.0,106.0,22.0,43.0,499.0,25.0,454.0,72.0,499.0,499.0,499.0,2.0,499.0,7.0,499.0,499.0,499.0,499.0,499.0,47.0,202.0,3.0,17.0,221.0,106.0,22.0,43.0,499.0,25.0,454.0,72.0,499.0,499.0,499.0,2.0,499.0,7.0,499.0,499.0,499.0,1.0,26.0,0.0,26.0,6.0,88.0,499.0,52.0,24.0,131.0,499.0,12.0,454.0,29.0,112.0,454.0,13.0,499.0,37.0,379.0,6.0,60.0,27.0,22.0,221.0,106.0,425.0,43.0,26.0,6.0,88.0,499.0,52.0,24.0,131.0,499.0,12.0,454.0,29.0,112.0,454.0,13.0,499.0,37.0,379.0,6.0,60.0,27.0,22.0,221.0,106.0,425.0,43.0,1.0,5.0,0.0,6.0,499.0,6.0,88.0,6.0,499.0,6.0,88.0,1.0,11.0,0.0,47.0,499.0,499.0,499.0,4.0,399.0,499.0,15.0,30.0,499.0,47.0,499.0,499.0,499.0,4.0,399.0,499.0,15.0,30.0,499.0,1.0,12.0,0.0,26.0,9.0,16.0,8.0,96.0,499.0,367.0,22.0,499.0,20.0,43.0,26.0,9.0,16.0,8.0,96.0,499.0,367.0,22.0,499.0,20.0,43.0,1.0,31.0,0.0,25.0,26.0,53.0,24.0,28.0,99.0,4.0,499.0,36.0,389.0,16.0,12.0,2.0,389.0,16.0,499.0,33.0,4.0,21.0,499.0,499.0,31.0,454.0,33.0,70.0,76.0,499.0,85.0,390.0,355.0,25.0,26.0,53.0,24.0,28.0,99.0,4.0,499.0,36.0,389.0,16.0,12.0,2.0,389.0,16.0,499.0,33.0,4.0,21.0,499.0,499.0,31.0,454.0,33.0,70.0,76.0,499.0,85.0,390.0,355.0,1.0,42.0,0.0,8.0,499.0,6.0,499.0,88.0,8.0,499.0,12.0,199.0,4.0,499.0,373.0,499.0,10.0,364.0,277.0,106.0,499.0,499.0,29.0,499.0,9.0,29.0,187.0,499.0,7.0,12.0,2.0,364.0,496.0,64.0,90.0,409.0,499.0,272.0,499.0,37.0,8.0,499.0,499.0,499.0,8.0,499.0,6.0,499.0,88.0,8.0,499.0,12.0,199.0,4.0,499.0,373.0,499.0,10.0,364.0,277.0,106.0,499.0,499.0,29.0,499.0,9.0,29.0,187.0,499.0,7.0,12.0,2.0,364.0,496.0,64.0,90.0,409.0,499.0,272.0,499.0,37.0,8.0,499.0,499.0,499.0,1.0,11.0,0.0,499.0,499.0,12.0,30.0,16.0,2.0,83.0,3.0,18.0,499.0,499.0,499.0,12.0,30.0,16.0,2.0,83.0,3.0,18.0,499.0,1.0,5.0,0.0,216.0,5.0,5.0,6.0,216.0,5.0,5.0,6.0,1.0,2.0,0.0,499.0,499.0,1.0,26.0,0.0,35.0,5.0,499.0,75.0,499.0,29.0,72.0,96.0,64.0,8.0,499.0,499.0,9.0,56.0,244.0,4.0,55.0,161.0,499.0,499.0,4.0,122.0,8.0,300.0,64.0,35.0,5.0,499.0,75.0,499.0,29.0,72.0,96.0,64.0,8.0,499.0,499.0,9.0,56.0,244.0,4.0,55.0,161.0,499.0,499.0,4.0,122.0,8.0,300.0,64.0,1.0,12.0,0.0,499.0,4.0,8.0,499.0,499.0,499.0,499.0,29.0,136.0,221.0,162.0,499.0,4.0,8.0,499.0,499.0,499.0,499.0,29.0,136.0,221.0,162.0,1.0,11.0,0.0,499.0,499.0,64.0,499.0,62.0,21.0,499.0,86.0,90.0,115.0,499.0,499.0,64.0,499.0,62.0,21.0,499.0,86.0,90.0,115.0,1.0,7.0,0.0,6.0,22.0,499.0,499.0,48.0,499.0,6.0,22.0,499.0,499.0,48.0,499.0,1.0,11.0,0.0,6.0,3.0,109.0,40.0,22.0,4.0,95.0,79.0,9.0,499.0,6.0,3.0,109.0,40.0,22.0,4.0,95.0,79.0,9.0,499.0,1.0,3.0,0.0,467.0,499.0,467.0,499.0,1.0,8.0,0.0,499.0,499.0,28.0,499.0,7.0,499.0,105.0,499.0,499.0,28.0,499.0,7.0,499.0,105.0,1.0,12.0,0.0,40.0,214.0,37.0,70.0,10.0,2.0,499.0,20.0,499.0,15.0,43.0,40.0,214.0,37.0,70.0,10.0,2.0,499.0,20.0,499.0,15.0,43.0,1.0,10.0,0.0,33.0,12.0,325.0,10.0,2.0,499.0,2.0,76.0,145.0,33.0,12.0,325.0,10.0,2.0,499.0,2.0,76.0,145.0,1.0,5.0,0.0,216.0,5.0,5.0,80.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,8.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,499.0,1.0,9.0,0.0,9.0,3.0,18.0,77.0,101.0,23.0,8.0,499.0,9.0,3.0,18.0,77.0,101.0,23.0,8.0,499.0,1.0,3.0,0.0,2.0,499.0,2.0,499.0,1.0,3.0,0.0,2.0,499.0,2.0,499.0,1.0,6.0,0.0,2.0,499.0,23.0,36.0,499.0,2.0,499.0,23.0,36.0,499.0,1.0,10.0,0.0,79.0,2.0,499.0,499.0,7.0,499.0,499.0,11.0,263.0,79.0,2.0,499.0,499.0,7.0,499.0,499.0,11.0,263.0,1.0,4.0,0.0,356.0,499.0,74.0,356.0,499.0,74.0,1.0,10.0,0.0,154.0,2.0,499.0,499.0,19.0,2.0,499.0,499.0,229.0,154.0,2.0,499.0,499.0,19.0,2.0,499.0,499.0,229.0,1.0,6.0,0.0,11.0,162.0,86.0,8.0,499.0,11.0,162.0,86.0,8.0,499.0,1.0,5.0,0.0,39.0,499.0,499.0,105.0,39.0,499.0,499.0,105.0,1.0,22.0,0.0,2.0,139.0,12.0,206.0,9.0,499.0,19.0,67.0,29.0,4.0,72.0,499.0,499.0,52.0,11.0,78.0,12.0,9.0,62.0,499.0,499.0,2.0,139.0,12.0,206.0,9.0,499.0,19.0,67.0,29.0,4.0,72.0,499.0,499.0,52.0,11.0,78.0,12.0,9.0,62.0,499.0,499.0,1.0,13.0,0.0,499.0,72.0,466.0,4.0,499.0,9.0,52.0,11.0,3.0,54.0,15.0,499.0,499.0,72.0,466.0,4.0,499.0,9.0,52.0,11.0,3.0,54.0,15.0,499.0,1.0,12.0,0.0,26.0,11.0,51.0,12.0,85.0,107.0,135.0,11.0,466.0,499.0,499.0,26.0,11.0,51.0,12.0,85.0,107.0,135.0,11.0,466.0,499.0,499.0,1.0,28.0,0.0,11.0,34.0,499.0,473.0,499.0,7.0,167.0,9.0,3.0,18.0,411.0,4.0,21.0,173.0,4.0,51.0,41.0,40.0,240.0,37.0,9.0,7.0,11.0,3.0,109.0,50.0,9.0,11.0,34.0,499.0,473.0,499.0,7.0,167.0,9.0,3.0,18.0,411.0,4.0,21.0,173.0,4.0,51.0,41.0,40.0,240.0,37.0,9.0,7.0,11.0,3.0,109.0,50.0,9.0,1.0,27.0,0.0,6.0,3.0,120.0,160.0,499.0,499.0,499.0,6.0,499.0,2.0,499.0,499.0,16.0,87.0,411.0,4.0,67.0,41.0,6.0,38.0,3.0,17.0,65.0,12.0,60.0,235.0,6.0,3.0,120.0,160.0,499.0,499.0,499.0,6.0,499.0,2.0,499.0,499.0,16.0,87.0,411.0,4.0,67.0,41.0,6.0,38.0,3.0,17.0,65.0,12.0,60.0,235.0,1.0,41.0,0.0,6.0,51.0,9.0,68.0,85.0,2.0,499.0,62.0,160.0,50.0,43.0,262.0,7.0,12.0,499.0,67.0,467.0,499.0,6.0,150.0,2.0,499.0,32.0,8.0,499.0,85.0,220.0,2.0,499.0,10.0,2.0,282.0,7.0,9.0,499.0,61.0,42.0,92.0,51.0,12.0,6.0,51.0,9.0,68.0,85.0,2.0,499.0,62.0,160.0,50.0,43.0,262.0,7.0,12.0,499.0,67.0,467.0,499.0,6.0,150.0,2.0,499.0,32.0,8.0,499.0,85.0,220.0,2.0,499.0,10.0,2.0,282.0,7.0,9.0,499.0,61.0,42.0,92.0,51.0,12.0,1.0,4.0,0.0,42.0,28.0,499.0,42.0,28.0,499.0,1.0,13.0,0.0,14.0,14.0,141.0,220.0,30.0,158.0,15.0,154.0,499.0,93.0,323.0,269.0,14.0,14.0,141.0,220.0,30.0,158.0,15.0,154.0,499.0,93.0,323.0,269.0,1.0,30.0,0.0,11.0,22.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,14.0,14.0,36.0,166.0,29.0,499.0,32.0,9.0,361.0,31.0,11.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,11.0,22.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,14.0,14.0,36.0,166.0,29.0,499.0,32.0,9.0,361.0,31.0,11.0,499.0,4.0,305.0,8.0,370.0,15.0,36.0,314.0,1.0,117.0,0.0,499.0,179.0,356.0,499.0,499.0,7.0,185.0,499.0,196.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,4.0,335.0,8.0,209.0,33.0,440.0,114.0,141.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,499.0,10.0,70.0,234.0,185.0,5.0,94.0,5.0,499.0,33.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,8.0,232.0,301.0,476.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,114.0,12.0,56.0,499.0,36.0,229.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,146.0,251.0,27.0,499.0,185.0,63.0,10.0,2.0,499.0,499.0,15.0,134.0,499.0,12.0,101.0,499.0,36.0,488.0,499.0,179.0,356.0,499.0,499.0,7.0,185.0,499.0,196.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,4.0,335.0,8.0,209.0,33.0,440.0,114.0,141.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,499.0,499.0,10.0,70.0,234.0,185.0,5.0,94.0,5.0,499.0,33.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,8.0,232.0,301.0,476.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,14.0,14.0,14.0,26.0,11.0,3.0,54.0,197.0,19.0,114.0,12.0,56.0,499.0,36.0,229.0,185.0,5.0,94.0,5.0,499.0,14.0,14.0,146.0,251.0,27.0,499.0,185.0,63.0,10.0,2.0,499.0,499.0,15.0,134.0,499.0,12.0,101.0,499.0,36.0,488.0,1.0,35.0,0.0,26.0,11.0,156.0,58.0,499.0,33.0,149.0,30.0,29.0,46.0,499.0,141.0,353.0,2.0,424.0,7.0,261.0,8.0,499.0,4.0,30.0,166.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,26.0,11.0,156.0,58.0,499.0,33.0,149.0,30.0,29.0,46.0,499.0,141.0,353.0,2.0,424.0,7.0,261.0,8.0,499.0,4.0,30.0,166.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,67.0,0.0,85.0,440.0,79.0,47.0,34.0,22.0,499.0,499.0,434.0,499.0,48.0,2.0,98.0,499.0,7.0,22.0,499.0,499.0,64.0,499.0,499.0,84.0,147.0,3.0,17.0,499.0,37.0,2.0,98.0,499.0,4.0,174.0,250.0,499.0,434.0,52.0,499.0,499.0,499.0,2.0,499.0,28.0,55.0,499.0,499.0,4.0,499.0,263.0,334.0,2.0,145.0,7.0,49.0,147.0,3.0,17.0,65.0,24.0,77.0,181.0,70.0,58.0,216.0,5.0,5.0,80.0,85.0,440.0,79.0,47.0,34.0,22.0,499.0,499.0,434.0,499.0,48.0,2.0,98.0,499.0,7.0,22.0,499.0,499.0,64.0,499.0,499.0,84.0,147.0,3.0,17.0,499.0,37.0,2.0,98.0,499.0,4.0,174.0,250.0,499.0,434.0,52.0,499.0,499.0,499.0,2.0,499.0,28.0,55.0,499.0,499.0,4.0,499.0,263.0,334.0,2.0,145.0,7.0,49.0,147.0,3.0,17.0,65.0,24.0,77.0,181.0,70.0,58.0,216.0,5.0,5.0,80.0,1.0,2.0,0.0,129.0,129.0,1.0,14.0,0.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,35.0,5.0,94.0,5.0,499.0,5.0,282.0,5.0,499.0,5.0,499.0,5.0,499.0,1.0,18.0,0.0,6.0,38.0,3.0,17.0,68.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,499.0,4.0,2.0,499.0,499.0,6.0,38.0,3.0,17.0,68.0,47.0,185.0,4.0,240.0,134.0,499.0,499.0,499.0,4.0,2.0,499.0,499.0,1.0,36.0,0.0,25.0,63.0,10.0,2.0,87.0,155.0,499.0,499.0,284.0,6.0,29.0,260.0,456.0,15.0,39.0,87.0,155.0,499.0,29.0,48.0,499.0,499.0,13.0,499.0,499.0,7.0,63.0,499.0,13.0,499.0,499.0,7.0,2.0,499.0,499.0,25.0,63.0,10.0,2.0,87.0,155.0,499.0,499.0,284.0,6.0,29.0,260.0,456.0,15.0,39.0,87.0,155.0,499.0,29.0,48.0,499.0,499.0,13.0,499.0,499.0,7.0,63.0,499.0,13.0,499.0,499.0,7.0,2.0,499.0,499.0,1.0,8.0,0.0,6.0,499.0,87.0,97.0,499.0,4.0,476.0,6.0,499.0,87.0,97.0,499.0,4.0,476.0,1.0,27.0,0.0,499.0,311.0,142.0,499.0,105.0,9.0,3.0,18.0,40.0,27.0,32.0,189.0,347.0,68.0,499.0,56.0,499.0,499.0,499.0,12.0,62.0,116.0,499.0,4.0,21.0,218.0,499.0,311.0,142.0,499.0,105.0,9.0,3.0,18.0,40.0,27.0,32.0,189.0,347.0,68.0,499.0,56.0,499.0,499.0,499.0,12.0,62.0,116.0,499.0,4.0,21.0,218.0,1.0,8.0,0.0,311.0,499.0,19.0,2.0,103.0,128.0,152.0,311.0,499.0,19.0,2.0,103.0,128.0,152.0,1.0,15.0,0.0,394.0,24.0,92.0,156.0,4.0,50.0,117.0,101.0,37.0,499.0,499.0,289.0,304.0,273.0,394.0,24.0,92.0,156.0,4.0,50.0,117.0,101.0,37.0,499.0,499.0,289.0,304.0,273.0,1.0,2.0,0.0,499.0,499.0,1.0,23.0,0.0,499.0,16.0,40.0,499.0,189.0,12.0,499.0,499.0,15.0,499.0,19.0,53.0,499.0,309.0,5.0,119.0,138.0,3.0,17.0,77.0,96.0,499.0,499.0,16.0,40.0,499.0,189.0,12.0,499.0,499.0,15.0,499.0,19.0,53.0,499.0,309.0,5.0,119.0,138.0,3.0,17.0,77.0,96.0,499.0,1.0,6.0,0.0,27.0,4.0,499.0,499.0,499.0,27.0,4.0,499.0,499.0,499.0,1.0,17.0,0.0,19.0,2.0,499.0,499.0,499.0,241.0,87.0,97.0,22.0,499.0,2.0,415.0,331.0,61.0,10.0,203.0,19.0,2.0,499.0,499.0,499.0,241.0,87.0,97.0,22.0,499.0,2.0,415.0,331.0,61.0,10.0,203.0,1.0,25.0,0.0,37.0,236.0,499.0,142.0,59.0,499.0,494.0,212.0,31.0,499.0,2.0,499.0,499.0,7.0,499.0,7.0,75.0,142.0,8.0,239.0,499.0,499.0,15.0,499.0,37.0,236.0,499.0,142.0,59.0,499.0,494.0,212.0,31.0,499.0,2.0,499.0,499.0,7.0,499.0,7.0,75.0,142.0,8.0,239.0,499.0,499.0,15.0,499.0,1.0,7.0,0.0,499.0,92.0,40.0,142.0,451.0,326.0,499.0,92.0,40.0,142.0,451.0,326.0,1.0,24.0,0.0,23.0,2.0,76.0,499.0,10.0,2.0,499.0,6.0,72.0,22.0,254.0,418.0,285.0,10.0,499.0,294.0,7.0,12.0,29.0,40.0,19.0,8.0,499.0,23.0,2.0,76.0,499.0,10.0,2.0,499.0,6.0,72.0,22.0,254.0,418.0,285.0,10.0,499.0,294.0,7.0,12.0,29.0,40.0,19.0,8.0,499.0,1.0,16.0,0.0,6.0,157.0,59.0,499.0,167.0,15.0,499.0,25.0,12.0,138.0,3.0,17.0,92.0,285.0,499.0,6.0,157.0,59.0,499.0,167.0,15.0,499.0,25.0,12.0,138.0,3.0,17.0,92.0,285.0,499.0,1.0,15.0,0.0,6.0,72.0,78.0,79.0,4.0,499.0,15.0,499.0,7.0,59.0,499.0,499.0,499.0,499.0,6.0,72.0,78.0,79.0,4.0,499.0,15.0,499.0,7.0,59.0,499.0,499.0,499.0,499.0,1.0,54.0,0.0,41.0,11.0,130.0,4.0,335.0,67.0,12.0,499.0,499.0,12.0,499.0,57.0,337.0,499.0,15.0,2.0,439.0,499.0,22.0,499.0,499.0,86.0,8.0,337.0,205.0,499.0,20.0,8.0,205.0,499.0,7.0,42.0,66.0,214.0,326.0,31.0,11.0,7.0,38.0,3.0,17.0,22.0,146.0,15.0,499.0,20.0,499.0,316.0,2.0,499.0,13.0,499.0,499.0,41.0,11.0,130.0,4.0,335.0,67.0,12.0,499.0,499.0,12.0,499.0,57.0,337.0,499.0,15.0,2.0,439.0,499.0,22.0,499.0,499.0,86.0,8.0,337.0,205.0,499.0,20.0,8.0,205.0,499.0,7.0,42.0,66.0,214.0,326.0,31.0,11.0,7.0,38.0,3.0,17.0,22.0,146.0,15.0,499.0,20.0,499.0,316.0,2.0,499.0,13.0,499.0,499.0,1.0,13.0,0.0,47.0,142.0,59.0,499.0,61.0,10.0,2.0,499.0,499.0,499.0,107.0,100.0,47.0,142.0,59.0,499.0,61.0,10.0,2.0,499.0,499.0,499.0,107.0,100.0,1.0,33.0,0.0,6.0,186.0,3.0,17.0,123.0,49.0,29.0,260.0,8.0,499.0,499.0,25.0,499.0,49.0,157.0,499.0,499.0,499.0,7.0,59.0,10.0,90.0,181.0,20.0,2.0,499.0,88.0,4.0,51.0,20.0,499.0,499.0,6.0,186.0,3.0,17.0,123.0,49.0,29.0,260.0,8.0,499.0,499.0,25.0,499.0,49.0,157.0,499.0,499.0,499.0,7.0,59.0,10.0,90.0,181.0,20.0,2.0,499.0,88.0,4.0,51.0,20.0,499.0,499.0,1.0,15.0,0.0,9.0,3.0,18.0,27.0,12.0,14.0,499.0,14.0,403.0,4.0,499.0,64.0,2.0,499.0,9.0,3.0,18.0,27.0,12.0,14.0,499.0,14.0,403.0,4.0,499.0,64.0,2.0,499.0,1.0,18.0,0.0,9.0,3.0,18.0,40.0,12.0,103.0,246.0,64.0,2.0,499.0,499.0,7.0,76.0,499.0,31.0,499.0,499.0,9.0,3.0,18.0,40.0,12.0,103.0,246.0,64.0,2.0,499.0,499.0,7.0,76.0,499.0,31.0,499.0,499.0,1.0,5.0,0.0,499.0,19.0,36.0,499.0,499.0,19.0,36.0,499.0,1.0,19.0,0.0,6.0,3.0,71.0,197.0,86.0,278.0,39.0,499.0,499.0,289.0,365.0,15.0,499.0,7.0,499.0,12.0,8.0,499.0,6.0,3.0,71.0,197.0,86.0,278.0,39.0,499.0,499.0,289.0,365.0,15.0,499.0,7.0,499.0,12.0,8.0,499.0,1.0,32.0,0.0,9.0,34.0,3.0,17.0,499.0,499.0,26.0,39.0,499.0,212.0,131.0,15.0,499.0,6.0,60.0,22.0,88.0,2.0,499.0,2.0,145.0,135.0,2.0,499.0,499.0,6.0,29.0,8.0,499.0,19.0,63.0,9.0,34.0,3.0,17.0,499.0,499.0,26.0,39.0,499.0,212.0,131.0,15.0,499.0,6.0,60.0,22.0,88.0,2.0,499.0,2.0,145.0,135.0,2.0,499.0,499.0,6.0,29.0,8.0,499.0,19.0,63.0,1.0,17.0,0.0,6.0,65.0,24.0,3.0,54.0,499.0,23.0,39.0,499.0,7.0,104.0,4.0,95.0,67.0,149.0,101.0,6.0,65.0,24.0,3.0,54.0,499.0,23.0,39.0,499.0,7.0,104.0,4.0,95.0,67.0,149.0,101.0,1.0,32.0,0.0,24.0,3.0,54.0,44.0,41.0,499.0,12.0,6.0,3.0,109.0,21.0,101.0,7.0,499.0,8.0,499.0,198.0,25.0,107.0,133.0,2.0,499.0,38.0,3.0,17.0,499.0,2.0,499.0,15.0,39.0,499.0,24.0,3.0,54.0,44.0,41.0,499.0,12.0,6.0,3.0,109.0,21.0,101.0,7.0,499.0,8.0,499.0,198.0,25.0,107.0,133.0,2.0,499.0,38.0,3.0,17.0,499.0,2.0,499.0,15.0,39.0,499.0,1.0,22.0,0.0,6.0,3.0,71.0,293.0,4.0,499.0,4.0,39.0,98.0,198.0,7.0,62.0,499.0,4.0,181.0,23.0,499.0,8.0,198.0,15.0,499.0,6.0,3.0,71.0,293.0,4.0,499.0,4.0,39.0,98.0,198.0,7.0,62.0,499.0,4.0,181.0,23.0,499.0,8.0,198.0,15.0,499.0,1.0,8.0,0.0,499.0,36.0,499.0,56.0,81.0,318.0,499.0,499.0,36.0,499.0,56.0,81.0,318.0,499.0,1.0,10.0,0.0,30.0,308.0,213.0,27.0,388.0,499.0,4.0,166.0,499.0,30.0,308.0,213.0,27.0,388.0,499.0,4.0,166.0,499.0,1.0,11.0,0.0,141.0,179.0,61.0,2.0,233.0,93.0,499.0,70.0,58.0,499.0,141.0,179.0,61.0,2.0,233.0,93.0,499.0,70.0,58.0,499.0,1.0,28.0,0.0,26.0,11.0,3.0,54.0,197.0,19.0,270.0,23.0,8.0,499.0,179.0,61.0,2.0,499.0,270.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,26.0,11.0,3.0,54.0,197.0,19.0,270.0,23.0,8.0,499.0,179.0,61.0,2.0,499.0,270.0,499.0,14.0,6.0,127.0,8.0,215.0,7.0,30.0,269.0,29.0,491.0,318.0,1.0,26.0,0.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,141.0,353.0,2.0,357.0,10.0,30.0,308.0,5.0,158.0,5.0,292.0,5.0,481.0,5.0,94.0,5.0,499.0,26.0,11.0,22.0,70.0,284.0,33.0,480.0,14.0,1.0,17.0,0.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,15.0,2.0,499.0,3.0,18.0,16.0,499.0,10.0,499.0,14.0,14.0,499.0,499.0,14.0,14.0,499.0,15.0,2.0,499.0,3.0,18.0,16.0,499.0,10.0,499.0,1.0,5.0,0.0,499.0,159.0,499.0,410.0,499.0,159.0,499.0,410.0,1.0,38.0,0.0,170.0,2.0,300.0,3.0,18.0,121.0,499.0,16.0,14.0,14.0,499.0,14.0,14.0,4.0,2.0,499.0,6.0,399.0,149.0,31.0,47.0,28.0,99.0,4.0,50.0,8.0,453.0,73.0,19.0,2.0,499.0,7.0,499.0,10.0,499.0,7.0,499.0,170.0,2.0,300.0,3.0,18.0,121.0,499.0,16.0,14.0,14.0,499.0,14.0,14.0,4.0,2.0,499.0,6.0,399.0,149.0,31.0,47.0,28.0,99.0,4.0,50.0,8.0,453.0,73.0,19.0,2.0,499.0,7.0,499.0,10.0,499.0,7.0,499.0,1.0,86.0,0.0,328.0,2.0,499.0,28.0,197.0,19.0,499.0,7.0,499.0,7.0,180.0,51.0,47.0,174.0,8.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,12.0,3.0,18.0,107.0,188.0,10.0,11.0,226.0,37.0,499.0,53.0,26.0,30.0,300.0,16.0,99.0,4.0,21.0,499.0,181.0,19.0,8.0,231.0,300.0,4.0,143.0,193.0,4.0,499.0,499.0,4.0,499.0,5.0,499.0,188.0,499.0,47.0,78.0,64.0,499.0,12.0,2.0,499.0,28.0,499.0,8.0,499.0,499.0,15.0,499.0,4.0,174.0,499.0,41.0,114.0,56.0,4.0,499.0,43.0,15.0,12.0,499.0,499.0,328.0,2.0,499.0,28.0,197.0,19.0,499.0,7.0,499.0,7.0,180.0,51.0,47.0,174.0,8.0,499.0,499.0,10.0,499.0,499.0,499.0,499.0,12.0,3.0,18.0,107.0,188.0,10.0,11.0,226.0,37.0,499.0,53.0,26.0,30.0,300.0,16.0,99.0,4.0,21.0,499.0,181.0,19.0,8.0,231.0,300.0,4.0,143.0,193.0,4.0,499.0,499.0,4.0,499.0,5.0,499.0,188.0,499.0,47.0,78.0,64.0,499.0,12.0,2.0,499.0,28.0,499.0,8.0,499.0,499.0,15.0,499.0,4.0,174.0,499.0,41.0,114.0,56.0,4.0,499.0,43.0,15.0,12.0,499.0,499.0,1.0,13.0,0.0,278.0,270.0,16.0,63.0,139.0,277.0,9.0,19.0,146.0,499.0,16.0,195.0,278.0,270.0,16.0,63.0,139.0,277.0,9.0,19.0,146.0,499.0,16.0,195.0,1.0,30.0,0.0,280.0,59.0,42.0,8.0,499.0,4.0,499.0,64.0,7.0,24.0,366.0,22.0,8.0,499.0,499.0,149.0,96.0,499.0,4.0,499.0,43.0,19.0,8.0,258.0,89.0,5.0,499.0,5.0,499.0,280.0,59.0,42.0,8.0,499.0,4.0,499.0,64.0,7.0,24.0,366.0,22.0,8.0,499.0,499.0,149.0,96.0,499.0,4.0,499.0,43.0,19.0,8.0,258.0,89.0,5.0,499.0,5.0,499.0,1.0,48.0,0.0,22.0,11.0,260.0,499.0,70.0,10.0,2.0,499.0,167.0,24.0,3.0,120.0,479.0,33.0,499.0,450.0,499.0,12.0,3.0,18.0,44.0,43.0,360.0,116.0,499.0,43.0,8.0,499.0,499.0,33.0,499.0,124.0,4.0,465.0,25.0,6.0,499.0,499.0,45.0,3.0,18.0,70.0,499.0,499.0,499.0,20.0,43.0,22.0,11.0,260.0,499.0,70.0,10.0,2.0,499.0,167.0,24.0,3.0,120.0,479.0,33.0,499.0,450.0,499.0,12.0,3.0,18.0,44.0,43.0,360.0,116.0,499.0,43.0,8.0,499.0,499.0,33.0,499.0,124.0,4.0,465.0,25.0,6.0,499.0,499.0,45.0,3.0,18.0,70.0,499.0,499.0,499.0,20.0,43.0,1.0,37.0,0.0,499.0,28.0,11.0,499.0,499.0,8.0,499.0,138.0,3.0,17.0,8.0,499.0,11.0,499.0,499.0,112.0,499.0,23.0,11.0,4.0,174.0,46.0,499.0,180.0,208.0,29.0,499.0,19.0,499.0,33.0,499.0,208.0,15.0,8.0,499.0,499.0,499.0,28.0,11.0,499.0,499.0,8.0,499.0,138.0,3.0,17.0,8.0,499.0,11.0,499.0,499.0,112.0,499.0,23.0,11.0,4.0,174.0,46.0,499.0,180.0,208.0,29.0,499.0,19.0,499.0,33.0,499.0,208.0,15.0,8.0,499.0,499.0,1.0,11.0,0.0,499.0,75.0,147.0,3.0,17.0,499.0,499.0,11.0,247.0,499.0,499.0,75.0,147.0,3.0,17.0,499.0,499.0,11.0,247.0,499.0,1.0,15.0,0.0,68.0,8.0,499.0,404.0,3.0,17.0,21.0,443.0,8.0,499.0,74.0,70.0,499.0,499.0,68.0,8.0,499.0,404.0,3.0,17.0,21.0,443.0,8.0,499.0,74.0,70.0,499.0,499.0,1.0,24.0,0.0,499.0,56.0,499.0,48.0,30.0,128.0,10.0,2.0,145.0,399.0,32.0,132.0,380.0,26.0,27.0,58.0,69.0,49.0,56.0,499.0,48.0,2.0,499.0,499.0,56.0,499.0,48.0,30.0,128.0,10.0,2.0,145.0,399.0,32.0,132.0,380.0,26.0,27.0,58.0,69.0,49.0,56.0,499.0,48.0,2.0,499.0,1.0,22.0,0.0,37.0,499.0,49.0,7.0,499.0,131.0,499.0,10.0,499.0,15.0,2.0,499.0,180.0,499.0,3.0,18.0,499.0,60.0,499.0,21.0,224.0,37.0,499.0,49.0,7.0,499.0,131.0,499.0,10.0,499.0,15.0,2.0,499.0,180.0,499.0,3.0,18.0,499.0,60.0,499.0,21.0,224.0,1.0,8.0,0.0,6.0,88.0,81.0,8.0,499.0,499.0,499.0,6.0,88.0,81.0,8.0,499.0,499.0,499.0,1.0,13.0,0.0,9.0,40.0,206.0,499.0,39.0,339.0,341.0,9.0,7.0,6.0,341.0,9.0,9.0,40.0,206.0,499.0,39.0,339.0,341.0,9.0,7.0,6.0,341.0,9.0,1.0,14.0,0.0,6.0,499.0,499.0,172.0,499.0,7.0,6.0,202.0,3.0,17.0,77.0,283.0,382.0,6.0,499.0,499.0,172.0,499.0,7.0,6.0,202.0,3.0,17.0,77.0,283.0,382.0,1.0,9.0,0.0,12.0,29.0,279.0,63.0,408.0,346.0,201.0,63.0,12.0,29.0,279.0,63.0,408.0,346.0,201.0,63.0,1.0};
 #endif
@@ -0,0 +1,149 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <stdlib.h>
+
+#ifdef USE_AVX
+#include "avx.h"
+#endif
+
+#include "gemm.h"
+
+#ifndef USE_AVX
+
+// Number of B rows (ie. output neurons) kept hot in cache while the whole
+// A matrix (ie. the batch) is streamed against them.
+#define GEMM_ROWS_BLOCK 8
+
+#endif
+
+void PSGemmNT(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode)
+{
+#ifdef USE_AVX
+    avx_gemm_nt(m, n, k, a, lda, b, ldb, c, ldc,
+                (mode == PS_GEMM_ADD ? AVX_STORE_MODE_ADD :
+                 AVX_STORE_MODE_NORM));
+#else
+    int i, j, jj, p;
+    for (j = 0; j < n; j += GEMM_ROWS_BLOCK) {
+        int max_j = j + GEMM_ROWS_BLOCK;
+        if (max_j > n) max_j = n;
+        for (i = 0; i < m; i++) {
+            ps_real * a_row = a + (i * lda);
+            ps_real * c_row = c + (i * ldc);
+            for (jj = j; jj < max_j; jj++) {
+                ps_real * b_row = b + (jj * ldb);
+                ps_real sum = 0.0;
+                for (p = 0; p < k; p++)
+                    sum += (a_row[p] * b_row[p]);
+                if (mode == PS_GEMM_ADD) c_row[jj] += sum;
+                else c_row[jj] = sum;
+            }
+        }
+    }
+#endif
+}
+
+#ifndef USE_AVX
+
+// Generic C = A * B, where the element (i, p) of A is a[i * ars + p * acs]
+
+static void gemmNN(int m, int n, int k, ps_real * a, int ars, int acs,
+                   ps_real * b, int ldb, ps_real * c, int ldc, int mode)
+{
+    int i, j, p;
+    for (i = 0; i < m; i++) {
+        ps_real * c_row = c + (i * ldc);
+        if (mode != PS_GEMM_ADD) {
+            for (j = 0; j < n; j++) c_row[j] = 0.0;
+        }
+        for (p = 0; p < k; p++) {
+            ps_real v = a[(i * ars) + (p * acs)];
+            ps_real * b_row = b + (p * ldb);
+            for (j = 0; j < n; j++) c_row[j] += (v * b_row[j]);
+        }
+    }
+}
+
+#endif
+
+void PSGemmNN(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode)
+{
+#ifdef USE_AVX
+    avx_gemm_nn(m, n, k, a, lda, b, ldb, c, ldc,
+                (mode == PS_GEMM_ADD ? AVX_STORE_MODE_ADD :
+                 AVX_STORE_MODE_NORM));
+#else
+    gemmNN(m, n, k, a, lda, 1, b, ldb, c, ldc, mode);
+#endif
+}
+
+void PSGemmTN(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode)
+{
+#ifdef USE_AVX
+    avx_gemm_tn(m, n, k, a, lda, b, ldb, c, ldc,
+                (mode == PS_GEMM_ADD ? AVX_STORE_MODE_ADD :
+                 AVX_STORE_MODE_NORM));
+#else
+    gemmNN(m, n, k, a, 1, lda, b, ldb, c, ldc, mode);
+#endif
+}
+
+void PSGemmU8S8NT(int m, int n, int k, uint8_t * a, int lda, int8_t * b,
+                  int ldb, int32_t * c, int ldc)
+{
+#ifdef USE_AVX
+    avx_gemm_u8s8_nt(m, n, k, a, lda, b, ldb, c, ldc);
+#else
+    int i, j, p;
+    for (i = 0; i < m; i++) {
+        uint8_t * a_row = a + (i * lda);
+        int32_t * c_row = c + (i * ldc);
+        for (j = 0; j < n; j++) {
+            int8_t * b_row = b + (j * ldb);
+            int32_t sum = 0;
+            for (p = 0; p < k; p++)
+                sum += ((int32_t) a_row[p] * (int32_t) b_row[p]);
+            c_row[j] = sum;
+        }
+    }
+#endif
+}
+
+void PSGemmS8U8NT(int m, int n, int k, int8_t * a, int lda, uint8_t * b,
+                  int ldb, int32_t * c, int ldc)
+{
+#ifdef USE_AVX
+    avx_gemm_s8u8_nt(m, n, k, a, lda, b, ldb, c, ldc);
+#else
+    int i, j, p;
+    for (i = 0; i < m; i++) {
+        int8_t * a_row = a + (i * lda);
+        int32_t * c_row = c + (i * ldc);
+        for (j = 0; j < n; j++) {
+            uint8_t * b_row = b + (j * ldb);
+            int32_t sum = 0;
+            for (p = 0; p < k; p++)
+                sum += ((int32_t) a_row[p] * (int32_t) b_row[p]);
+            c_row[j] = sum;
+        }
+    }
+#endif
+}
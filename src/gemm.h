@@ -0,0 +1,57 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef __PS_GEMM_H
+#define __PS_GEMM_H
+
+#include <stdint.h>
+#include "psyc.h"
+
+/* Matrix-matrix kernels. Matrices are row-major and every row is addressed
+ * through its leading dimension (ld*), so that padded layer tensors can be
+ * used directly. The mode tells whether the product overwrites C
+ * (PS_GEMM_STORE) or it's added to it (PS_GEMM_ADD). */
+
+#define PS_GEMM_STORE   0
+#define PS_GEMM_ADD     1
+
+/* C = A * B^T, where A is [m x k] and B is [n x k]: every element of C is
+ * the dot product between a row of A and a row of B (ie. a batch of inputs
+ * multiplied by a layer's weights matrix). */
+void PSGemmNT(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode);
+
+/* C = A * B, where A is [m x k] and B is [k x n] (ie. deltas propagated
+ * back through a layer's weights matrix). */
+void PSGemmNN(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode);
+
+/* C = A^T * B, where A is [k x m] and B is [k x n] (ie. weight gradients,
+ * as the outer product between deltas and the previous activations). */
+void PSGemmTN(int m, int n, int k, ps_real * a, int lda, ps_real * b, int ldb,
+              ps_real * c, int ldc, int mode);
+
+/* C = A * B^T on quantized values: A is [m x k] unsigned (<= 127), B is
+ * [n x k] signed and C holds 32-bit sums (always overwritten). k must be a
+ * multiple of 32, with rows padded with zeros. */
+void PSGemmU8S8NT(int m, int n, int k, uint8_t * a, int lda, int8_t * b,
+                  int ldb, int32_t * c, int ldc);
+/* Same as PSGemmU8S8NT, with A signed and B unsigned (<= 127). */
+void PSGemmS8U8NT(int m, int n, int k, int8_t * a, int lda, uint8_t * b,
+                  int ldb, int32_t * c, int ldc);
+
+#endif //__PS_GEMM_H
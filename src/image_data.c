@@ -29,11 +29,11 @@ static int __magick_instantiated = 0; //Ensure compatibility with older versions
 #define LOG_MAGICK_ERR(wand) fprintf(stderr, "Magick ERROR: %s\n", \
     MagickGetException(wand, &serverity))
 
-/*static void dumpPixels(int w, int h, int bytes, double* pixels){
+/*static void dumpPixels(int w, int h, int bytes, ps_real* pixels){
     int i, numsamples = 0, area = w * h * bytes;
-    double last_pixel;
+    ps_real last_pixel;
     for (i = 0; i < area; i++) {
-        double pixel = pixels[i];
+        ps_real pixel = pixels[i];
         if (i == 0 || last_pixel != pixel) {
             int x = i % w;
             int y = i / w;
@@ -51,7 +51,7 @@ static float getScaleFactorToFit(int w, int h, int fitW, int fitH) {
     return (scale > 1 ? 1 : scale);
 }
 
-static double * getImagePixels(char * filename, int fit_w, int fit_h,
+static ps_real * getImagePixels(char * filename, int fit_w, int fit_h,
                                int grayscale, int invert, char* bgcolor,
                                char* dump_file) {
     //if (IsMagickWandInstantiated() != MagickTrue)
@@ -170,7 +170,7 @@ static double * getImagePixels(char * filename, int fit_w, int fit_h,
         }
     }
     
-    double * pixels = malloc(fit_w * fit_h * pixel_size * sizeof(double));
+    ps_real * pixels = malloc(fit_w * fit_h * pixel_size * sizeof(ps_real));
     if (pixels == NULL) {
         fprintf(stderr, "Could not allocate memory for image pixels!\n");
         DestroyMagickWand(wand);
@@ -216,7 +216,7 @@ int PSClassifyImage(PSNeuralNetwork * network, char * filename, int grayscale,
 {
     int input_size = network->input_size;
     int w = (int) sqrt((double) input_size);
-    double * pixels = getImagePixels(filename, w, w, grayscale,
+    ps_real * pixels = getImagePixels(filename, w, w, grayscale,
                                      invert, bgcolor, dump_file);
     if (pixels == NULL) {
         PSErr("PSClassifyImage", "Failed to get pixels from %s", filename);
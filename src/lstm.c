@@ -27,12 +27,28 @@
 #endif
 
 #include "lstm.h"
+#include "recurrent.h"
 #include "utils.h"
+#include "threads.h"
+#include "gemm.h"
 
 #define CANDIDATE_IDX   0
 #define INPUT_IDX       1
 #define OUTPUT_IDX      2
 #define FORGET_IDX      3
+#define LSTM_GATES      4
+
+/* State arena buffers (see recurrent.h) */
+#define STATES_BUFFER       0
+#define Z_VALUES_BUFFER     1
+#define CANDIDATES_BUFFER   2
+#define INPUT_GATES_BUFFER  3
+#define OUTPUT_GATES_BUFFER 4
+#define FORGET_GATES_BUFFER 5
+#define LSTM_BUFFERS        6
+
+#define GetLSTMState(arena, buffer, i, t) \
+    ((arena)->buffers[buffer][((t) * (arena)->size) + (i)])
 
 #define FreeLSTMDeltas() do {\
     if (delta_c != NULL) free(delta_c);\
@@ -42,151 +58,10 @@
     if (lstm_delta != NULL) free(lstm_delta);\
 } while(0)
 
-static int LSTMCellFeedforward(PSLayer * layer, PSLayer * previous,
-                               PSNeuron * neuron, int onehot_idx,
-                               int times, int t)
-{
-    PSLSTMCell * cell = GetLSTMCell(neuron);
-    if (cell == NULL) {
-        PSErr(NULL, "Layer[%d]: neuron[%d] cell is NULL!",
-              layer->index, neuron->index);
-        return 0;
-    }
-    int wsize = cell->weights_size;
-    int prev_size = wsize - layer->size;
-    
-    double candidate = 0.0;
-    double input_gate = 0.0;
-    double output_gate = 0.0;
-    double forget_gate = 0.0;
-    
-    double last_z = 0.0;
-    
-    if (onehot_idx >= 0) {
-        candidate = cell->candidate_weights[onehot_idx];
-        input_gate = cell->input_weights[onehot_idx];
-        output_gate = cell->output_weights[onehot_idx];
-        forget_gate = cell->forget_weights[onehot_idx];
-    } else {
-        int i = 0;
-#ifdef USE_AVX
-        int j = 0, o = 0, f = 0;
-        AVXDotProduct(previous->size, previous->avx_activation_cache,
-                      cell->candidate_weights, candidate, i, 1, t);
-        AVXDotProduct(previous->size, previous->avx_activation_cache,
-                      cell->input_weights, input_gate, j, 1, t);
-        AVXDotProduct(previous->size, previous->avx_activation_cache,
-                      cell->output_weights, output_gate, o, 1, t);
-        AVXDotProduct(previous->size, previous->avx_activation_cache,
-                      cell->forget_weights, forget_gate, f, 1, t);
-#endif
-        for (; i < previous->size; i++) {
-            PSNeuron * prev_neuron = previous->neurons[i];
-            if (prev_neuron == NULL) return 0;
-            double a = prev_neuron->activation;
-            candidate += (a * cell->candidate_weights[i]);
-            input_gate += (a * cell->input_weights[i]);
-            output_gate += (a * cell->output_weights[i]);
-            forget_gate += (a * cell->forget_weights[i]);
-        }
-    }
-    
-    if (t > 0) {
-        int last_t = t - 1;
-        last_z = cell->z_values[last_t];
-        int i = 0;
-#ifdef USE_AVX
-        int j = 0, o = 0, f = 0;
-        AVXDotProduct(layer->size, layer->avx_activation_cache,
-                      cell->candidate_weights + prev_size,
-                      candidate, i, 1, last_t);
-        AVXDotProduct(layer->size, layer->avx_activation_cache,
-                      cell->input_weights + prev_size,
-                      input_gate, j, 1, last_t);
-        AVXDotProduct(layer->size, layer->avx_activation_cache,
-                      cell->output_weights + prev_size,
-                      output_gate, o, 1, last_t);
-        AVXDotProduct(layer->size, layer->avx_activation_cache,
-                      cell->forget_weights + prev_size,
-                      forget_gate, f, 1, last_t);
-#endif
-        for (; i < layer->size; i++) {
-            int w = i + prev_size;
-            PSNeuron * n = layer->neurons[i];
-            PSLSTMCell * c = GetLSTMCell(n);
-            if (c == NULL) return 0;
-            double last_state = c->states[last_t];
-            candidate += (cell->candidate_weights[w] * last_state);
-            input_gate += (cell->input_weights[w] * last_state);
-            output_gate += (cell->output_weights[w] * last_state);
-            forget_gate += (cell->forget_weights[w] * last_state);
-        }
-    } else {
-        if (cell->states != NULL) free(cell->states);
-        if (cell->z_values != NULL) free(cell->z_values);
-        if (cell->candidates != NULL) free(cell->candidates);
-        if (cell->input_gates != NULL) free(cell->input_gates);
-        if (cell->output_gates != NULL) free(cell->output_gates);
-        if (cell->forget_gates != NULL) free(cell->forget_gates);
-        cell->states_count = times;
-        cell->states = calloc(times, sizeof(double));
-        cell->z_values = calloc(times, sizeof(double));
-        cell->candidates = calloc(times, sizeof(double));
-        cell->input_gates = calloc(times, sizeof(double));
-        cell->output_gates = calloc(times, sizeof(double));
-        cell->forget_gates = calloc(times, sizeof(double));
-        if (cell->states == NULL) return 0;
-        if (cell->z_values == NULL) return 0;
-        if (cell->candidates == NULL) return 0;
-        if (cell->input_gates == NULL) return 0;
-        if (cell->output_gates == NULL) return 0;
-        if (cell->forget_gates == NULL) return 0;
-#ifdef USE_AVX
-        if (neuron->index == 0) {
-            if (layer->avx_activation_cache != NULL)
-                free(layer->avx_activation_cache);
-            layer->avx_activation_cache = calloc(times * layer->size,
-                                                 sizeof(double));
-            if (layer->avx_activation_cache == NULL) {
-                printMemoryErrorMsg();
-                return 0;
-            }
-        }
-#endif
-    }
-    candidate = tanh(candidate + cell->candidate_bias);
-    input_gate = sigmoid(input_gate + cell->input_bias);
-    output_gate = sigmoid(output_gate + cell->output_bias);
-    forget_gate = sigmoid(forget_gate + cell->forget_bias);
-    
-    cell->candidates[t] = candidate;
-    cell->input_gates[t] = input_gate;
-    cell->output_gates[t] = output_gate;
-    cell->forget_gates[t] = forget_gate;
-    
-    neuron->z_value = candidate * input_gate + last_z * forget_gate;
-    cell->z_values[t] = neuron->z_value;
-    
-    double activation = neuron->z_value;
-    if (layer->activate != NULL) activation = layer->activate(activation);
-    activation = output_gate * activation;
-    neuron->activation = activation;
-    cell->states[t] = activation;
-    
-    return 1;
-}
-
 PSLSTMCell * PSCreateLSTMCell(PSNeuron * neuron, int weight_size) {
     
     PSLSTMCell * cell = malloc(sizeof(PSLSTMCell));
     if (cell == NULL) return NULL;
-    cell->states_count = 0;
-    cell->candidates = NULL;
-    cell->input_gates = NULL;
-    cell->output_gates = NULL;
-    cell->forget_gates = NULL;
-    cell->z_values = NULL;
-    cell->states = NULL;
     
     cell->candidate_bias = gaussian_random(0, 1);
     cell->input_bias = gaussian_random(0, 1);
@@ -204,17 +79,11 @@ PSLSTMCell * PSCreateLSTMCell(PSNeuron * neuron, int weight_size) {
 }
 
 void PSDeleteLSTMCell(PSLSTMCell * cell) {
-    if (cell->candidates != NULL) free(cell->candidates);
-    if (cell->input_gates != NULL) free(cell->input_gates);
-    if (cell->output_gates != NULL) free(cell->output_gates);
-    if (cell->forget_gates != NULL) free(cell->forget_gates);
-    if (cell->z_values != NULL) free(cell->z_values);
-    if (cell->states != NULL) free(cell->states);
     free(cell);
 }
 
 void PSUpdateLSTMBiases(PSNeuron * neuron, PSGradient * gradient, double rate) {
-    double * biases = GetLSTMGradientBiases(neuron, gradient);
+    ps_real * biases = GetLSTMGradientBiases(neuron, gradient);
     PSLSTMCell *cell = GetLSTMCell(neuron);
     cell->candidate_bias -= (rate * biases[0]);
     cell->input_bias -= (rate * biases[INPUT_IDX]);
@@ -230,12 +99,17 @@ int PSInitLSTMLayer(PSNeuralNetwork * network, PSLayer * layer,
     ws += size;
     int tot_ws = ws * 4; //Weights for candidate, input, output and forget gates
     char * func = "PSInitLSTMLayer";
-    layer->neurons = malloc(sizeof(PSNeuron*) * size);
+    layer->neurons = calloc(size, sizeof(PSNeuron*));
     if (layer->neurons == NULL) {
         PSErr(func, "Could not allocate layer neurons!");
         PSAbortLayer(network, layer);
         return 0;
     }
+    if (!PSInitPackedLayerTensors(layer, size, tot_ws)) {
+        PSErr(func, "Could not allocate layer tensors!");
+        PSAbortLayer(network, layer);
+        return 0;
+    }
     for (i = 0; i < size; i++) {
         PSNeuron * neuron = malloc(sizeof(PSNeuron));
         if (neuron == NULL) {
@@ -245,13 +119,9 @@ int PSInitLSTMLayer(PSNeuralNetwork * network, PSLayer * layer,
         }
         neuron->index = i;
         neuron->weights_size = tot_ws;
-        neuron->bias = gaussian_random(0, 1);
-        neuron->weights = malloc(sizeof(double) * tot_ws);
-        if (neuron->weights ==  NULL) {
-            PSAbortLayer(network, layer);
-            PSErr(func, "Could not allocate neuron weights!");
-            return 0;
-        }
+        neuron->bias = layer->biases + i;
+        *(neuron->bias) = gaussian_random(0, 1);
+        neuron->weights = layer->weights + (i * layer->weights_stride);
         for (j = 0; j < tot_ws; j++) {
             neuron->weights[j] = gaussian_random(0, 1);
         }
@@ -266,7 +136,7 @@ int PSInitLSTMLayer(PSNeuralNetwork * network, PSLayer * layer,
         neuron->layer = layer;
     }
     layer->flags |= FLAG_RECURRENT;
-    layer->activate = tanh;
+    layer->activate = ps_tanh;
     layer->derivative = tanh_derivative;
     layer->feedforward = PSLSTMFeedforward;
     network->flags |= FLAG_RECURRENT;
@@ -275,6 +145,131 @@ int PSInitLSTMLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 /* Feedforward Functions */
 
+typedef struct {
+    PSLayer * layer;
+    PSLayer * previous;
+    int vector_idx;
+    int t;
+    int ok;
+} PSLSTMJob;
+
+typedef struct {
+    PSLayer * layer;
+    ps_real * inputs;
+    int times;
+} PSLSTMProjectionJob;
+
+static void LSTMProjectionWorker(void * arg, int worker, int count) {
+    PSLSTMProjectionJob * job = (PSLSTMProjectionJob *) arg;
+    PSLayer * layer = job->layer;
+    PSStateArena * arena = GetStateArena(layer);
+    int first, last;
+    PSGetWorkerRange(layer->size, worker, count, &first, &last);
+    if (first >= last) return;
+    int ws = layer->weights_stride / LSTM_GATES;
+    int inputs_size = ws - layer->size;
+    PSGemmNT(job->times, (last - first) * LSTM_GATES, inputs_size,
+             job->inputs, inputs_size,
+             layer->weights + (first * layer->weights_stride), ws,
+             arena->projections + (first * LSTM_GATES),
+             arena->projection_size, PS_GEMM_STORE);
+}
+
+int PSLSTMProjectInputs(PSLayer * layer, ps_real * inputs, int times) {
+    int size = layer->size;
+    if (PSPrepareStateArena(layer, LSTM_BUFFERS, times) == NULL ||
+        PSPrepareStateProjections(layer, size * LSTM_GATES) == NULL)
+        return 0;
+    int inputs_size = (layer->weights_stride / LSTM_GATES) - size;
+    PSLSTMProjectionJob job = {layer, inputs, times};
+    long work = (long) times * size * LSTM_GATES * inputs_size;
+    PSRunLayerWorkers(LSTMProjectionWorker, &job, work);
+    GetStateArena(layer)->projected = 1;
+    return 1;
+}
+
+/* Feedforwards the cells [first, last) at step `t`. The products between
+ * the gates matrix and the inputs (unless they've already been projected
+ * for the whole sequence) plus the last states are stored in the step's
+ * row of the projections, that holds the four gates of every cell next to
+ * each other, then the gates activations and the new states of the cells
+ * are computed in a single pass. */
+static int LSTMCellsFeedforward(PSLayer * layer, PSLayer * previous,
+                                int onehot_idx, int t, int first, int last)
+{
+    PSStateArena * arena = GetStateArena(layer);
+    int size = layer->size, i;
+    int ws = layer->weights_stride / LSTM_GATES;
+    int prev_size = ws - size;
+    int rows = (last - first) * LSTM_GATES;
+    ps_real * gates = arena->projections + (t * arena->projection_size);
+    ps_real * weights = layer->weights + (first * layer->weights_stride);
+    ps_real * cells_gates = gates + (first * LSTM_GATES);
+    if (onehot_idx >= 0) {
+        for (i = 0; i < rows; i++)
+            cells_gates[i] = weights[(i * ws) + onehot_idx];
+    } else if (!arena->projected) {
+        PSGemmNT(1, rows, prev_size, previous->activations, prev_size,
+                 weights, ws, cells_gates, rows, PS_GEMM_STORE);
+    }
+    ps_real * last_z = NULL;
+    if (t > 0) {
+        int last_t = t - 1;
+        ps_real * last_states = arena->buffers[STATES_BUFFER] +
+            (last_t * size);
+        last_z = arena->buffers[Z_VALUES_BUFFER] + (last_t * size);
+        PSGemmNT(1, rows, size, last_states, size, weights + prev_size, ws,
+                 cells_gates, rows, PS_GEMM_ADD);
+    }
+    for (i = first; i < last; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        PSLSTMCell * cell = GetLSTMCell(neuron);
+        if (cell == NULL) {
+            PSErr(NULL, "Layer[%d]: neuron[%d] cell is NULL!",
+                  layer->index, i);
+            return 0;
+        }
+        ps_real * cell_gates = gates + (i * LSTM_GATES);
+        ps_real candidate = tanh(cell_gates[CANDIDATE_IDX] +
+                                 cell->candidate_bias);
+        ps_real input_gate = sigmoid(cell_gates[INPUT_IDX] +
+                                     cell->input_bias);
+        ps_real output_gate = sigmoid(cell_gates[OUTPUT_IDX] +
+                                      cell->output_bias);
+        ps_real forget_gate = sigmoid(cell_gates[FORGET_IDX] +
+                                      cell->forget_bias);
+        
+        GetLSTMState(arena, CANDIDATES_BUFFER, i, t) = candidate;
+        GetLSTMState(arena, INPUT_GATES_BUFFER, i, t) = input_gate;
+        GetLSTMState(arena, OUTPUT_GATES_BUFFER, i, t) = output_gate;
+        GetLSTMState(arena, FORGET_GATES_BUFFER, i, t) = forget_gate;
+        
+        ps_real z = candidate * input_gate;
+        if (last_z != NULL) z += last_z[i] * forget_gate;
+        ps_real activation = z;
+        if (layer->activate != NULL) activation = layer->activate(activation);
+        activation = output_gate * activation;
+        neuron->z_value = z;
+        neuron->activation = activation;
+        layer->z_values[i] = z;
+        layer->activations[i] = activation;
+        GetLSTMState(arena, Z_VALUES_BUFFER, i, t) = z;
+        GetLSTMState(arena, STATES_BUFFER, i, t) = activation;
+    }
+    return 1;
+}
+
+static void LSTMFeedforwardWorker(void * arg, int worker, int count) {
+    PSLSTMJob * job = (PSLSTMJob *) arg;
+    PSLayer * layer = job->layer;
+    int first, last;
+    PSGetWorkerRange(layer->size, worker, count, &first, &last);
+    if (first >= last) return;
+    if (!LSTMCellsFeedforward(layer, job->previous, job->vector_idx, job->t,
+                              first, last))
+        job->ok = 0;
+}
+
 int PSLSTMFeedforward(void * _net, void * _layer, ...) {
     PSNeuralNetwork * net = (PSNeuralNetwork*) _net;
     PSLayer * layer = (PSLayer*) _layer;
@@ -327,20 +322,17 @@ int PSLSTMFeedforward(void * _net, void * _layer, ...) {
             return 0;
         }
     }
-    int i = 0;
-    for (; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        int ok = LSTMCellFeedforward(layer, previous, neuron,
-                                     vector_idx, times, t);
-        if (!ok) {
-            //TODO: handle
+    if (t == 0) {
+        if (PSPrepareStateArena(layer, LSTM_BUFFERS, times) == NULL ||
+            PSPrepareStateProjections(layer, size * LSTM_GATES) == NULL)
             return 0;
-        }
-#ifdef USE_AVX
-        layer->avx_activation_cache[(t * size) + i] = neuron->activation;
-#endif
     }
-    return 1;
+    PSLSTMJob job = {layer, previous, vector_idx, t, 1};
+    int projected = GetStateArena(layer)->projected;
+    long work = (long) size * LSTM_GATES *
+        (size + (onehot || projected ? 0 : previous->size));
+    PSRunLayerWorkers(LSTMFeedforwardWorker, &job, work);
+    return job.ok;
 }
 
 /* Backpropagation Functions */
@@ -361,43 +353,46 @@ int PSLSTMBackprop(PSLayer * layer, PSLayer * previousLayer,
         previous_size = (int) params->parameters[0];
         assert(previous_size > 0);
     }
-    double * delta_c = calloc(sizeof(double), lsize);
-    double * delta_i = calloc(sizeof(double), lsize);
-    double * delta_o = calloc(sizeof(double), lsize);
-    double * delta_f = calloc(sizeof(double), lsize);
+    ps_real * delta_c = calloc(sizeof(ps_real), lsize);
+    ps_real * delta_i = calloc(sizeof(ps_real), lsize);
+    ps_real * delta_o = calloc(sizeof(ps_real), lsize);
+    ps_real * delta_f = calloc(sizeof(ps_real), lsize);
     
-    double * delta = layer->delta;
-    double * delta_z = delta + lsize;
+    ps_real * delta = layer->delta;
+    ps_real * delta_z = delta + lsize;
+    PSStateArena * arena = GetStateArena(layer);
 
     for (i = 0; i < lsize; i++) {
         PSNeuron * neuron = layer->neurons[i];
         PSLSTMCell * cell = GetLSTMCell(neuron);
         PSGradient * gradient = &(lgradients[i]);
-        double * gradient_biases = GetLSTMGradientBiases(neuron, gradient);
-        double dv = delta[i];
+        ps_real * gradient_biases = GetLSTMGradientBiases(neuron, gradient);
+        ps_real dv = delta[i];
         int cwsize = cell->weights_size;
         int rwsize = layer->size;
         int wsize = cwsize - rwsize;
         
-        double z = cell->z_values[t];
-        double last_z = (t > 0 ? cell->z_values[last_t] : 0.0);
-        double ig = cell->input_gates[t];
-        double og = cell->output_gates[t];
-        double fg = cell->forget_gates[t];
-        double c = cell->candidates[t];
+        ps_real z = GetLSTMState(arena, Z_VALUES_BUFFER, i, t);
+        ps_real last_z = (t > 0 ?
+                          GetLSTMState(arena, Z_VALUES_BUFFER, i, last_t) :
+                          0.0);
+        ps_real ig = GetLSTMState(arena, INPUT_GATES_BUFFER, i, t);
+        ps_real og = GetLSTMState(arena, OUTPUT_GATES_BUFFER, i, t);
+        ps_real fg = GetLSTMState(arena, FORGET_GATES_BUFFER, i, t);
+        ps_real c = GetLSTMState(arena, CANDIDATES_BUFFER, i, t);
         
-        double last_dz = delta_z[i];
-        double z_multiplier = 1, zz = z;
+        ps_real last_dz = delta_z[i];
+        ps_real z_multiplier = 1, zz = z;
         if (layer->activate != NULL) {
             z_multiplier = layer->activate(z);
             zz = z_multiplier;
             z_multiplier = layer->derivative(z_multiplier);
         }
-        double dout = zz * dv;
-        double dz = og * dv * z_multiplier + last_dz;
-        double di = c * dz;
-        double df = last_z * dz;
-        double dc = ig * dz;
+        ps_real dout = zz * dv;
+        ps_real dz = og * dv * z_multiplier + last_dz;
+        ps_real di = c * dz;
+        ps_real df = last_z * dz;
+        ps_real dc = ig * dz;
         delta_z[i] = dz * fg;
         
         dout *= (og * (1 - og)); // sigmoid_derivative
@@ -416,9 +411,7 @@ int PSLSTMBackprop(PSLayer * layer, PSLayer * previousLayer,
         gradient_biases[FORGET_IDX] += df;
         
         if (onehot) {
-            PSNeuron * prev_n = previousLayer->neurons[0];
-            PSLSTMCell * prev_c = GetLSTMCell(prev_n);
-            double prev_a = prev_c->states[t];
+            ps_real prev_a = GetLayerState(previousLayer, 0, t);
             assert(prev_a < previous_size);
             w = (int) prev_a;
             gradient->weights[w] += dc;
@@ -427,9 +420,7 @@ int PSLSTMBackprop(PSLayer * layer, PSLayer * previousLayer,
             gradient->weights[w + (cwsize * FORGET_IDX)] += df;
         } else {
             for (w = 0; w < wsize; w++) {
-                PSNeuron * prev_n = previousLayer->neurons[w];
-                PSLSTMCell * prev_c = GetLSTMCell(prev_n);
-                double prev_a = prev_c->states[t];
+                ps_real prev_a = GetLayerState(previousLayer, w, t);
                 gradient->weights[w] += (dc * prev_a);
                 gradient->weights[w + cwsize] += (di * prev_a);
                 gradient->weights[w + (cwsize * OUTPUT_IDX)] +=
@@ -443,28 +434,26 @@ int PSLSTMBackprop(PSLayer * layer, PSLayer * previousLayer,
             int w = 0;
 #ifdef USE_AVX
             int i = 0, o = 0, f = 0;
-            double * rweights = gradient->weights + wsize;
+            ps_real * rweights = gradient->weights + wsize;
             AVXMultiplyValue(layer->size,
-                             layer->avx_activation_cache,
+                             GetLayerStates(layer),
                              dc, rweights, w,
                              1, (last_t), AVX_STORE_MODE_ADD);
             AVXMultiplyValue(layer->size,
-                             layer->avx_activation_cache,
+                             GetLayerStates(layer),
                              di, rweights + cwsize, i,
                              1, (last_t), AVX_STORE_MODE_ADD);
             AVXMultiplyValue(layer->size,
-                             layer->avx_activation_cache,
+                             GetLayerStates(layer),
                              dout, rweights + (cwsize * OUTPUT_IDX), o,
                              1, (last_t), AVX_STORE_MODE_ADD);
             AVXMultiplyValue(layer->size,
-                             layer->avx_activation_cache,
+                             GetLayerStates(layer),
                              df, rweights + (cwsize * FORGET_IDX), f,
                              1, (last_t), AVX_STORE_MODE_ADD);
 #endif
             for (; w < layer->size; w++) {
-                PSNeuron * rn = layer->neurons[w];
-                PSLSTMCell * rc = GetLSTMCell(rn);
-                double a = rc->states[last_t];
+                ps_real a = GetLayerState(layer, w, last_t);
                 int widx = wsize + w;
                 gradient->weights[widx] += (dc * a);
                 gradient->weights[widx + cwsize] += (di * a);
@@ -484,16 +473,16 @@ int PSLSTMBackprop(PSLayer * layer, PSLayer * previousLayer,
             PSLSTMCell * cell = GetLSTMCell(neuron);
             int cwsize = cell->weights_size;
             int wsize = cwsize - layer->size;
-            //double prev_a = cell->states[last_t];
-            double d = 0.0;
+            //ps_real prev_a = cell->states[last_t];
+            ps_real d = 0.0;
             for (w = 0; w < lsize; w++) {
                 PSNeuron * rn = layer->neurons[w];
                 PSLSTMCell * rc = GetLSTMCell(rn);
                 int widx = neuron->index + wsize;
-                double cw = rc->candidate_weights[widx];
-                double iw = rc->input_weights[widx];
-                double ow = rc->output_weights[widx];
-                double fw = rc->forget_weights[widx];
+                ps_real cw = rc->candidate_weights[widx];
+                ps_real iw = rc->input_weights[widx];
+                ps_real ow = rc->output_weights[widx];
+                ps_real fw = rc->forget_weights[widx];
                 
                 d += delta_c[rn->index] * cw;
                 d += delta_i[rn->index] * iw;
@@ -23,23 +23,25 @@
 #define GetLSTMCell(neuron) ((PSLSTMCell*) neuron->extra)
 #define GetLSTMGradientBiases(n, gradient) (gradient->weights + n->weights_size)
 
+/* The states of the cells through time (hidden states, cell states,
+ * candidates and gates) are kept by the layer's state arena (see
+ * recurrent.h).
+ * Every cell's weights row holds the candidate, input, output and forget
+ * weights (each one made of the input weights followed by the recurrent
+ * ones) and the rows aren't padded, so that the layer weights are also a
+ * single [(size * 4) x weights_size] gates matrix, whose product with the
+ * inputs gives all of the gates of the layer at once. */
+
 typedef struct {
-    int states_count;
     int weights_size;
-    double * states;
-    double * z_values;
-    double * candidates;
-    double * input_gates;
-    double * output_gates;
-    double * forget_gates;
-    double candidate_bias;
-    double input_bias;
-    double output_bias;
-    double forget_bias;
-    double * candidate_weights;
-    double * input_weights;
-    double * output_weights;
-    double * forget_weights;
+    ps_real candidate_bias;
+    ps_real input_bias;
+    ps_real output_bias;
+    ps_real forget_bias;
+    ps_real * candidate_weights;
+    ps_real * input_weights;
+    ps_real * output_weights;
+    ps_real * forget_weights;
 } PSLSTMCell;
 
 PSLSTMCell * PSCreateLSTMCell(PSNeuron * neuron, int lsize);
@@ -53,6 +55,9 @@ int PSInitLSTMLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 /* Feedforward Functions */
 
+/* Computes the input products of the gates for all of the `times` steps of
+ * a sequence at once (see PSRecurrentProjectInputs). */
+int PSLSTMProjectInputs(PSLayer * layer, ps_real * inputs, int times);
 int PSLSTMFeedforward(void * _net, void * _layer, ...);
 
 /* Backpropagation Functions */
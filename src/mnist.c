@@ -18,243 +18,305 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <assert.h>
 #include <stdint.h>
+#include <time.h>
+#include <pthread.h>
 #include <zlib.h>
 #include "mnist.h"
 
-#define CHUNK 16384
 #define IMAGES_MAGIC_NUM 2051
 #define LABELS_MAGIC_NUM 2049
-#define le2be(x) ((x >> 24 & 0x000000FF) | \
-    (x >> 8 & 0x0000FF00) | \
-    (x << 8 & 0x00FF0000) | \
-    (x << 24))
+#define IDX_MAX_DIMS 3
+#define IDX_READ_CHUNK (1 << 24)
+#define MNIST_TRAINING_CACHE "/tmp/psyc-mnist-train.dataset"
+#define MNIST_TEST_CACHE "/tmp/psyc-mnist-test.dataset"
 
-int decompressGZip(FILE *source, FILE * dest) {
-    int ret;
-    unsigned have;
-    z_stream strm;
-    unsigned char in[CHUNK];
-    unsigned char out[CHUNK];
-    
-    /* allocate inflate state */
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    strm.avail_in = 0;
-    strm.next_in = Z_NULL;
-    ret = inflateInit2(&strm, 16+MAX_WBITS);
-    if (ret != Z_OK)
-        return ret;
-    /* decompress until deflate stream ends or end of file */
-    do {
-        strm.avail_in = fread(in, 1, CHUNK, source);
-        if (ferror(source)) {
-            (void)inflateEnd(&strm);
-            return Z_ERRNO;
-        }
-        if (strm.avail_in == 0)
-            break;
-        strm.next_in = in;
-        /* run inflate() on input until output buffer not full */
-        do {
-            strm.avail_out = CHUNK;
-            strm.next_out = out;
-            ret = inflate(&strm, Z_NO_FLUSH);
-            assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-            switch (ret) {
-                case Z_NEED_DICT:
-                    ret = Z_DATA_ERROR;     /* and fall through */
-                case Z_DATA_ERROR:
-                case Z_MEM_ERROR:
-                    (void)inflateEnd(&strm);
-                    return ret;
-            }
-            have = CHUNK - strm.avail_out;
-            if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-                (void)inflateEnd(&strm);
-                return Z_ERRNO;
-            }
-        } while (strm.avail_out == 0);
-        /* done when inflate() says it's done */
-    } while (ret != Z_STREAM_END);
-    /* clean up and return */
-    (void)inflateEnd(&strm);
-    return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
-}
+/* IDX file: a big-endian magic number (whose last byte is the number of
+ * dimensions) and the size of every dimension, followed by the values.
+ * Gzipped files are inflated straight into memory while reading them. */
 
+typedef struct {
+    const char * filename;
+    uint32_t magic;
+    int dims_count;
+    uint32_t dims[IDX_MAX_DIMS];
+    uint8_t * values;
+    int ok;
+} PSIDXFile;
 
-/* report a zlib or i/o error */
-void zerr(int ret)
-{
-    fputs("zpipe: ", stderr);
-    switch (ret) {
-        case Z_ERRNO:
-            if (ferror(stdin))
-                fputs("error reading stdin\n", stderr);
-            if (ferror(stdout))
-                fputs("error writing stdout\n", stderr);
-            break;
-        case Z_STREAM_ERROR:
-            fputs("invalid compression level\n", stderr);
-            break;
-        case Z_DATA_ERROR:
-            fputs("invalid or incomplete deflate data\n", stderr);
-            break;
-        case Z_MEM_ERROR:
-            fputs("out of memory\n", stderr);
-            break;
-        case Z_VERSION_ERROR:
-            fputs("zlib version mismatch!\n", stderr);
-    }
+static uint32_t getBigEndian32(const unsigned char * bytes) {
+    return ((uint32_t) bytes[0] << 24) | ((uint32_t) bytes[1] << 16) |
+           ((uint32_t) bytes[2] << 8) | (uint32_t) bytes[3];
 }
 
-void getTempFileName(const char * prefix, char * buffer) {
-    FILE * urand = fopen("/dev/urandom", "r");
-    char buff[4];
-    fgets(buff, 4, urand);
-    sprintf(buffer, "/tmp/%s-%02x%02x%02x%02x",
-            prefix,
-            (unsigned char) buff[0],
-            (unsigned char) buff[1],
-            (unsigned char) buff[2],
-            (unsigned char) buff[3]);
-    fclose(urand);
-}
-
-int loadMNISTData(int type,
-                  const char * images_file,
-                  const char * labels_file,
-                  double ** data) {
-    char tmpImagesFileName[255];
-    char tmpLabelsFileName[255];
-    char * prefixImg;
-    char * prefixLbl;
-    int err;
-    if (type == TRAINING_DATA) {
-        printf("Loading MNIST Data for training...\n");
-        prefixImg = "train-images";
-        prefixLbl = "train-labels";
-    } else {
-        printf("Loading MNIST Data for testing...\n");
-        prefixImg = "test-images";
-        prefixLbl = "test-labels";
+static void * readIDXFile(void * arg) {
+    PSIDXFile * idx = (PSIDXFile *) arg;
+    unsigned char header[4 * (IDX_MAX_DIMS + 1)];
+    int header_size = 4 * (idx->dims_count + 1), i;
+    idx->ok = 0;
+    gzFile f = gzopen(idx->filename, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "Cannot open %s\n", idx->filename);
+        return NULL;
     }
-    getTempFileName(prefixImg, tmpImagesFileName);
-    getTempFileName(prefixLbl, tmpLabelsFileName);
-    FILE * images = fopen(images_file, "r");
-    FILE * labels = fopen(labels_file, "r");
-    if (images == NULL) {
-        fprintf(stderr, "Cannot open %s\n", images_file);
-        data = NULL;
-        return 0;
+    if (gzread(f, header, header_size) != header_size) {
+        fprintf(stderr, "Invalid IDX file %s\n", idx->filename);
+        gzclose(f);
+        return NULL;
     }
-    if (labels == NULL) {
-        fprintf(stderr, "Cannot open %s\n", labels_file);
-        data = NULL;
-        return 0;
+    uint32_t magic_num = getBigEndian32(header);
+    if (magic_num != idx->magic) {
+        fprintf(stderr, "Invalid magic number for %s: %d\n", idx->filename,
+                magic_num);
+        gzclose(f);
+        return NULL;
     }
-    FILE * tmpimages = fopen(tmpImagesFileName, "w");
-    FILE * tmplabels = fopen(tmpLabelsFileName, "w");
-    printf("Loading images...\n");
-    err = decompressGZip(images, tmpimages);
-    if (err) {zerr(err); data = NULL; return 0;}
-    printf("Loading labels...\n");
-    err = decompressGZip(labels, tmplabels);
-    if (err) {zerr(err); data = NULL; return 0;}
-    fclose(tmpimages);
-    fclose(tmplabels);
-    tmpimages = fopen(tmpImagesFileName, "r");
-    tmplabels = fopen(tmpLabelsFileName, "r");
-    fseek(tmpimages, 0, SEEK_SET);
-    fseek(tmplabels, 0, SEEK_SET);
-    uint32_t magic_num = 0, image_count = 0, label_count = 0;
-    int i = 0, j = 0;
-    fread(&magic_num, 1, 4, tmpimages);
-    magic_num = le2be(magic_num);
-    if (magic_num != IMAGES_MAGIC_NUM) {
-        fprintf(stderr, "Invalid magic number for image file: %d\n", magic_num);
-        data = NULL;
-        return 0;
+    size_t size = 1;
+    for (i = 0; i < idx->dims_count; i++) {
+        idx->dims[i] = getBigEndian32(header + (4 * (i + 1)));
+        size *= idx->dims[i];
     }
-    fread(&image_count, 1, 4, tmpimages);
-    image_count = le2be(image_count);
-    if (image_count == 0) {
-        fputs("Image count is 0!\n", stderr);
-        data = NULL;
-        return 0;
+    if (size == 0) {
+        fprintf(stderr, "Empty IDX file %s\n", idx->filename);
+        gzclose(f);
+        return NULL;
     }
-    printf("Found %d images.\n", image_count);
-    fread(&magic_num, 1, 4, tmplabels);
-    magic_num = le2be(magic_num);
-    if (magic_num != LABELS_MAGIC_NUM) {
-        fprintf(stderr, "Invalid magic number for labels file: %d\n",magic_num);
-        data = NULL;
-        return 0;
+    idx->values = malloc(size);
+    if (idx->values == NULL) {
+        fprintf(stderr, "Could not allocate memory!\n");
+        gzclose(f);
+        return NULL;
     }
-    fread(&label_count, 1, 4, tmplabels);
-    label_count = le2be(label_count);
-    if (label_count == 0) {
-        fputs("Label count is 0!\n", stderr);
-        data = NULL;
-        return 0;
+    size_t offset = 0;
+    while (offset < size) {
+        size_t chunk = size - offset;
+        if (chunk > IDX_READ_CHUNK) chunk = IDX_READ_CHUNK;
+        int read = gzread(f, idx->values + offset, (unsigned) chunk);
+        if (read <= 0) break;
+        offset += read;
+    }
+    gzclose(f);
+    if (offset < size) {
+        fprintf(stderr, "Truncated IDX file %s\n", idx->filename);
+        free(idx->values);
+        idx->values = NULL;
+        return NULL;
     }
+    idx->ok = 1;
+    return NULL;
+}
+
+/* Every image is followed by its label in the elements of the dataset. */
+PSDataset * PSLoadMNISTData(const char * images_file,
+                            const char * labels_file)
+{
+    PSIDXFile images = {images_file, IMAGES_MAGIC_NUM, 3, {0}, NULL, 0};
+    PSIDXFile labels = {labels_file, LABELS_MAGIC_NUM, 1, {0}, NULL, 0};
+    pthread_t images_thread;
+    int threaded = (pthread_create(&images_thread, NULL, readIDXFile,
+                                   &images) == 0);
+    if (!threaded) readIDXFile(&images);
+    readIDXFile(&labels);
+    if (threaded) pthread_join(images_thread, NULL);
+    PSDataset * dataset = NULL;
+    uint8_t * bytes = NULL;
+    if (!images.ok || !labels.ok) goto cleanup;
+    uint32_t image_count = images.dims[0], label_count = labels.dims[0], i;
+    printf("Found %d images.\n", image_count);
     printf("Found %d labels.\n", label_count);
     if (label_count != image_count) {
         fputs("Image count and label count do not match!\n", stderr);
-        data = NULL;
-        return 0;
+        goto cleanup;
     }
-    uint32_t rows = 0, cols = 0;
-    fread(&rows, 1, 4, tmpimages);
-    fread(&cols, 1, 4, tmpimages);
-    rows = le2be(rows);
-    cols = le2be(cols);
-    printf("Image size: %dx%d\n", rows, cols);
-    int img_area = rows * cols;
-    if (img_area == 0) {
-        fputs("Invalid image size!\n", stderr);
-        data = NULL;
-        return 0;
+    printf("Image size: %dx%d\n", images.dims[1], images.dims[2]);
+    size_t area = (size_t) images.dims[1] * images.dims[2];
+    size_t length = (size_t) image_count * (area + 1);
+    bytes = malloc(length);
+    if (bytes == NULL) {
+        fprintf(stderr, "Could not allocate memory!\n");
+        goto cleanup;
     }
-    int data_len = (img_area * image_count) + (label_count * 10);
-    *data = malloc(data_len * sizeof(double));
-    double * data_p = *data;
-    for (i = 0; i < (int) image_count; i++) {
-        printf("\rLoading image %d/%d", i + 1, image_count);
-        for (j = 0; j < img_area; j++) {
-            int pixel = fgetc(tmpimages);
-            double d = (double) pixel / (double) 255;
-            *data_p = d;
-            data_p++;
+    for (i = 0; i < image_count; i++) {
+        uint8_t * element = bytes + (i * (area + 1));
+        memcpy(element, images.values + (i * area), area);
+        element[area] = labels.values[i];
+    }
+    dataset = PSCreateByteDataset(bytes, length, (int) area, 1);
+    if (dataset == NULL) free(bytes);
+cleanup:
+    free(images.values);
+    free(labels.values);
+    return dataset;
+}
+
+void PSGetMNISTElements(PSDataset * dataset, int first, int count,
+                        ps_real * elements)
+{
+    int img_area = dataset->input_size, i, j;
+    for (i = first; i < first + count; i++) {
+        uint8_t * pixels = dataset->bytes + ((size_t) i * (img_area + 1));
+        for (j = 0; j < img_area; j++)
+            elements[j] = (ps_real) pixels[j] / (ps_real) 255;
+        elements += img_area;
+        int label = pixels[img_area];
+        for (j = 0; j < PS_MNIST_CLASSES; j++) elements[j] = (j == label);
+        elements += PS_MNIST_CLASSES;
+    }
+}
+
+/* MNIST sources convert the samples chunk by chunk, while they're read.
+ * Shuffled sources read them through a permutation of the range. */
+
+typedef struct {
+    PSDataset * dataset;
+    int first;
+    int next;
+    int * order;
+    unsigned int seed;
+} PSMNISTSource;
+
+static int readMNISTSource(PSDataSource * source, ps_real * elements,
+                           int count)
+{
+    PSMNISTSource * mnist_source = (PSMNISTSource *) source->data;
+    int left = source->count - mnist_source->next, i;
+    if (count > left) count = left;
+    if (count <= 0) return 0;
+    if (mnist_source->order == NULL) {
+        PSGetMNISTElements(mnist_source->dataset, mnist_source->first +
+                           mnist_source->next, count, elements);
+    } else {
+        int element_size = PSGetMNISTElementSize(mnist_source->dataset);
+        int * order = mnist_source->order + mnist_source->next;
+        for (i = 0; i < count; i++) {
+            PSGetMNISTElements(mnist_source->dataset, order[i], 1, elements);
+            elements += element_size;
         }
-        int label = fgetc(tmplabels);
-        //printf("Label: %d", label);
-        for (j = 0; j < 10; j++) {
-            *data_p = (j == label);
-            data_p++;
+    }
+    mnist_source->next += count;
+    return count;
+}
+
+static int rewindMNISTSource(PSDataSource * source) {
+    PSMNISTSource * mnist_source = (PSMNISTSource *) source->data;
+    int * order = mnist_source->order, i;
+    mnist_source->next = 0;
+    if (order == NULL) return 1;
+    for (i = source->count - 1; i > 0; i--) {
+        int j = rand_r(&mnist_source->seed) % (i + 1), tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+    return 1;
+}
+
+static void closeMNISTSource(PSDataSource * source) {
+    PSMNISTSource * mnist_source = (PSMNISTSource *) source->data;
+    free(mnist_source->order);
+    free(mnist_source);
+}
+
+static PSDataSource * createMNISTSource(PSDataset * dataset, int first,
+                                        int count, int shuffled)
+{
+    if (!(dataset->flags & PS_DATASET_BYTES) || dataset->output_size != 1 ||
+        first < 0 || count < 0 || first + count > dataset->count) {
+        fprintf(stderr, "Invalid MNIST samples range %d-%d\n", first,
+                first + count);
+        return NULL;
+    }
+    PSDataSource * source = calloc(1, sizeof(PSDataSource));
+    PSMNISTSource * mnist_source = calloc(1, sizeof(PSMNISTSource));
+    int * order = (shuffled ? malloc((count + 1) * sizeof(int)) : NULL);
+    if (source == NULL || mnist_source == NULL || (shuffled && !order)) {
+        fprintf(stderr, "Could not allocate memory!\n");
+        free(source);
+        free(mnist_source);
+        free(order);
+        return NULL;
+    }
+    int i;
+    if (order != NULL) for (i = 0; i < count; i++) order[i] = first + i;
+    mnist_source->dataset = dataset;
+    mnist_source->first = first;
+    mnist_source->order = order;
+    mnist_source->seed = (unsigned int) time(NULL);
+    source->count = count;
+    source->input_size = dataset->input_size;
+    source->output_size = PS_MNIST_CLASSES;
+    source->read = readMNISTSource;
+    source->rewind = rewindMNISTSource;
+    source->close = closeMNISTSource;
+    source->data = mnist_source;
+    return source;
+}
+
+PSDataSource * PSCreateMNISTSource(PSDataset * dataset, int first,
+                                   int count)
+{
+    return createMNISTSource(dataset, first, count, 0);
+}
+
+PSDataSource * PSCreateShuffledMNISTSource(PSDataset * dataset, int first,
+                                           int count)
+{
+    return createMNISTSource(dataset, first, count, 1);
+}
+
+PSDataset * PSLoadCachedMNISTData(const char * images_file,
+                                  const char * labels_file,
+                                  const char * cache_file)
+{
+    PSDataset * dataset = NULL;
+    uint64_t hash = 0;
+    if (cache_file != NULL) {
+        hash = PSHashFile(images_file, PS_DATASET_HASH_SEED);
+        if (hash != 0) hash = PSHashFile(labels_file, hash);
+        if (hash != 0) dataset = PSLoadDataset(cache_file, hash);
+        if (dataset != NULL && (dataset->flags & PS_DATASET_BYTES) &&
+            dataset->output_size == 1) {
+            printf("Found %d cached samples in %s\n", dataset->count,
+                   cache_file);
+            return dataset;
         }
+        PSDeleteDataset(dataset);
     }
-    printf("\n");
-    fclose(images);
-    fclose(labels);
-    fclose(tmpimages);
-    fclose(tmplabels);
-    remove(tmpImagesFileName);
-    remove(tmpLabelsFileName);
-    //printf("Datalen: %d\n", data_len);
-    //printf("Allocated data size: %d\n", data_p - *data);
-    return data_len;
+    dataset = PSLoadMNISTData(images_file, labels_file);
+    if (dataset == NULL || cache_file == NULL || hash == 0) return dataset;
+    dataset->source_hash = hash;
+    if (!PSSaveDataset(dataset, cache_file)) return dataset;
+    // Maps the saved copy, so that it's shared with other processes
+    PSDataset * cached = PSLoadDataset(cache_file, hash);
+    if (cached == NULL) return dataset;
+    printf("Samples cached in %s\n", cache_file);
+    PSDeleteDataset(dataset);
+    return cached;
 }
 
-/*int main(int argc, char** argv) {
-    //printf("Argc: %d\n", argc);
-    double * training_data = NULL;
-    loadMNISTData(TRAINING_DATA,
-                  "train-images-idx3-ubyte.gz",
-                  "train-labels-idx1-ubyte.gz",
-                  &training_data);
-    return 0;
-}*/
+const char * PSGetMNISTCacheFile(int type) {
+    return (type == TRAINING_DATA ? MNIST_TRAINING_CACHE : MNIST_TEST_CACHE);
+}
 
+int loadMNISTData(int type,
+                  const char * images_file,
+                  const char * labels_file,
+                  ps_real ** data) {
+    if (type == TRAINING_DATA)
+        printf("Loading MNIST Data for training...\n");
+    else
+        printf("Loading MNIST Data for testing...\n");
+    *data = NULL;
+    PSDataset * dataset = PSLoadCachedMNISTData(images_file, labels_file,
+                                                PSGetMNISTCacheFile(type));
+    if (dataset == NULL) return 0;
+    int data_len = dataset->count * PSGetMNISTElementSize(dataset);
+    *data = malloc(data_len * sizeof(ps_real));
+    if (*data == NULL) {
+        fprintf(stderr, "Could not allocate memory!\n");
+        PSDeleteDataset(dataset);
+        return 0;
+    }
+    PSGetMNISTElements(dataset, 0, dataset->count, *data);
+    PSDeleteDataset(dataset);
+    return data_len;
+}
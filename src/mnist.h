@@ -18,11 +18,56 @@
 #ifndef __PS_MNIST_H
 #define __PS_MNIST_H
 
+#include <stdint.h>
+#include "psyc.h"
+#include "dataset.h"
+
 #define TRAINING_DATA   0
 #define TEST_DATA       1
 
+#define PS_MNIST_CLASSES 10
+
+/* MNIST datasets are kept as compact PS_DATASET_BYTES datasets: every
+ * element is made of the image pixels (`input_size` bytes, as stored in
+ * the IDX files) followed by a single label byte (`output_size` is 1).
+ * Samples are only converted into training data elements (pixels scaled to
+ * [0, 1] followed by the one-hot label) when they're needed. */
+
+#define PSGetMNISTElementSize(dataset) \
+    ((dataset)->input_size + PS_MNIST_CLASSES)
+
+/* Loads a pair of (optionally gzipped) IDX files, decoding the images and
+ * the labels concurrently. */
+PSDataset * PSLoadMNISTData(const char * images_file,
+                            const char * labels_file);
+/* Converts `count` samples, starting from `first`, into training data
+ * elements. */
+void PSGetMNISTElements(PSDataset * dataset, int first, int count,
+                        ps_real * elements);
+/* Streams `count` samples, starting from `first`, converting them while
+ * they're read (the dataset must outlive the source). */
+PSDataSource * PSCreateMNISTSource(PSDataset * dataset, int first,
+                                   int count);
+/* Like PSCreateMNISTSource, but the samples are read in a new random order
+ * after every rewind, so that the whole range is shuffled without
+ * buffering converted samples. */
+PSDataSource * PSCreateShuffledMNISTSource(PSDataset * dataset, int first,
+                                           int count);
+/* Loads the dataset of a pair of IDX files. If `cache_file` isn't NULL,
+ * the dataset is saved there and mapped from it by later calls, until the
+ * IDX files change. */
+PSDataset * PSLoadCachedMNISTData(const char * images_file,
+                                  const char * labels_file,
+                                  const char * cache_file);
+/* Cache file of the training or test data (TRAINING_DATA or TEST_DATA),
+ * shared by loadMNISTData and psycl. */
+const char * PSGetMNISTCacheFile(int type);
+
+/* Loads the whole dataset as training data elements, returning its length
+ * (or 0 on errors). The compact dataset is cached in
+ * PSGetMNISTCacheFile(type). */
 int loadMNISTData(int type,
                   const char * images_file,
                   const char * labels_file,
-                  double ** data);
+                  ps_real ** data);
 #endif // __PS_MNIST_H
@@ -22,6 +22,11 @@
 #include <string.h>
 #include <assert.h>
 #include <time.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #ifdef USE_AVX
 #include "avx.h"
@@ -32,12 +37,11 @@
 #include "convolutional.h"
 #include "recurrent.h"
 #include "lstm.h"
+#include "gemm.h"
+#include "threads.h"
 
 int PSGlobalFlags = 0;
 
-typedef double (*PSGetDeltaFunction)(PSNeuron* n, PSLayer* l, PSLayer* next,
-                                     double * last_d);
-
 static PSLossFunction loss_functions[] = {
     NULL,
     PSQuadraticLoss,
@@ -51,9 +55,43 @@ static size_t loss_functions_count = sizeof(loss_functions) /
 
 void PSDeleteLayerGradients(PSGradient * lgradients, int size);
 void PSDeleteGradients(PSGradient ** gradients, PSNeuralNetwork * network);
+static PSLayer * addLayer(PSNeuralNetwork * network, PSLayerType type,
+                          int size, PSLayerParameters* params, int log);
 
 /* Feedforward Functions */
 
+typedef struct {
+    PSLayer * layer;
+    PSLayer * previous;
+} PSLayerJob;
+
+static void fullFeedforwardRange(PSLayer * layer, PSLayer * previous,
+                                 int first, int last)
+{
+    int i, previous_size = previous->size;
+    PSGemmNT(1, last - first, previous_size, previous->activations,
+             previous_size, layer->weights + first * layer->weights_stride,
+             layer->weights_stride, layer->z_values + first, last - first,
+             PS_GEMM_STORE);
+    for (i = first; i < last; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        ps_real z = layer->z_values[i] + layer->biases[i];
+        ps_real a = layer->activate(z);
+        layer->z_values[i] = z;
+        layer->activations[i] = a;
+        neuron->z_value = z;
+        neuron->activation = a;
+    }
+}
+
+static void fullFeedforwardWorker(void * arg, int worker, int count) {
+    PSLayerJob * job = (PSLayerJob *) arg;
+    int first, last;
+    PSGetWorkerRange(job->layer->size, worker, count, &first, &last);
+    if (first < last) fullFeedforwardRange(job->layer, job->previous,
+                                           first, last);
+}
+
 static int fullFeedforward(void * _net, void * _layer, ...) {
     PSNeuralNetwork * network = (PSNeuralNetwork*) _net;
     PSLayer * layer = (PSLayer*) _layer;
@@ -72,46 +110,23 @@ static int fullFeedforward(void * _net, void * _layer, ...) {
         PSErr(NULL, "Layer[%d]: previous layer is NULL!", layer->index);
         return 0;
     }
-    int i, j, previous_size = previous->size;
+    int previous_size = previous->size;
     int is_recurrent = (network->flags & FLAG_RECURRENT), times, t;
-    if (is_recurrent) {
-        va_list args;
-        va_start(args, _layer);
-        times = va_arg(args, int);
-        t = va_arg(args, int);
-        va_end(args);
+    if (!is_recurrent) {
+        PSLayerJob job = {layer, previous};
+        PSRunLayerWorkers(fullFeedforwardWorker, &job,
+                          (long) size * previous_size);
+        return 1;
     }
-    for (i = 0; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        double sum = 0.0;
-        j = 0;
-#ifdef USE_AVX
-        AVXDotProduct(previous_size, previous->avx_activation_cache,
-                      neuron->weights, sum, j, is_recurrent, t);
-#endif
-        for (; j < previous_size; j++) {
-            PSNeuron * prev_neuron = previous->neurons[j];
-            if (prev_neuron == NULL) {
-                PSErr(NULL, "Layer[%d]: previous layer's neuron[%d] is NULL!",
-                      layer->index, j);
-                return 0;
-            }
-            double a = prev_neuron->activation;
-            sum += (a * neuron->weights[j]);
-        }
-        neuron->z_value = sum + neuron->bias;
-        neuron->activation = layer->activate(neuron->z_value);
-#ifdef USE_AVX
-        if (!is_recurrent)
-            layer->avx_activation_cache[i] = neuron->activation;
-#endif
-        if (is_recurrent) {
-            PSAddRecurrentState(neuron, neuron->activation, times, t);
-            if (neuron->extra == NULL) {
-                PSErr(func, "Failed to allocate Recurrent Cell!");
-                return 0;
-            }
-        }
+    fullFeedforwardRange(layer, previous, 0, size);
+    va_list args;
+    va_start(args, _layer);
+    times = va_arg(args, int);
+    t = va_arg(args, int);
+    va_end(args);
+    if (PSAddRecurrentStates(layer, layer->activations, times, t) == NULL) {
+        PSErr(func, "Failed to allocate recurrent states!");
+        return 0;
     }
     return 1;
 }
@@ -134,7 +149,7 @@ static int softmaxFeedforward(void * _net, void * _layer, ...) {
         PSErr(NULL, "Layer[%d]: previous layer is NULL!", layer->index);
         return 0;
     }
-    int i, j, previous_size = previous->size;
+    int i, previous_size = previous->size;
     int is_recurrent = (net->flags & FLAG_RECURRENT), times, t;
     if (is_recurrent) {
         va_list args;
@@ -143,59 +158,42 @@ static int softmaxFeedforward(void * _net, void * _layer, ...) {
         t = va_arg(args, int);
         va_end(args);
     }
-    double max = 0.0, esum = 0.0;
+    ps_real max = 0.0, esum = 0.0;
+    ps_real * z_values = layer->z_values;
+    ps_real * activations = layer->activations;
+    PSGemmNT(1, size, previous_size, previous->activations, previous_size,
+             layer->weights, layer->weights_stride, z_values, size,
+             PS_GEMM_STORE);
     for (i = 0; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        double sum = 0;
-        j = 0;
-#ifdef USE_AVX
-        AVXDotProduct(previous_size, previous->avx_activation_cache,
-                      neuron->weights, sum, j, is_recurrent, t);
-#endif
-        for (; j < previous_size; j++) {
-            PSNeuron * prev_neuron = previous->neurons[j];
-            if (prev_neuron == NULL) {
-                PSErr(NULL, "Layer[%d]: previous layer's neuron[%d] is NULL!",
-                      layer->index, j);
-                return 0;
-            }
-            double a = prev_neuron->activation;
-            sum += (a * neuron->weights[j]);
-        }
-        neuron->z_value = sum + neuron->bias;
+        ps_real z = z_values[i] + layer->biases[i];
+        z_values[i] = z;
         if (i == 0)
-            max = neuron->z_value;
-        else if (neuron->z_value > max)
-            max = neuron->z_value;
+            max = z;
+        else if (z > max)
+            max = z;
     }
     for (i = 0; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        double z = neuron->z_value;
-        double e = exp(z - max);
+        ps_real e = exp(z_values[i] - max);
         esum += e;
-        neuron->activation = e;
+        activations[i] = e;
     }
     for (i = 0; i < size; i++) {
         PSNeuron * neuron = layer->neurons[i];
-        neuron->activation /= esum;
-#ifdef USE_AVX
-        if (!is_recurrent)
-            layer->avx_activation_cache[i] = neuron->activation;
-#endif
-        if (is_recurrent) {
-            PSAddRecurrentState(neuron, neuron->activation, times, t);
-            if (neuron->extra == NULL) {
-                PSErr(func, "Failed to allocate Recurrent Cell!");
-                return 0;
-            }
-        }
+        activations[i] /= esum;
+        neuron->z_value = z_values[i];
+        neuron->activation = activations[i];
+    }
+    if (is_recurrent &&
+        PSAddRecurrentStates(layer, activations, times, t) == NULL) {
+        PSErr(func, "Failed to allocate recurrent states!");
+        return 0;
     }
     return 1;
 }
 
 /* Utils */
 
-static double norm(double* matrix, int size) {
+static double norm(ps_real* matrix, int size) {
     double r = 0.0;
     int i;
     for (i = 0; i < size; i++) {
@@ -205,49 +203,355 @@ static double norm(double* matrix, int size) {
     return sqrt(r);
 }
 
-static void shuffle ( double * array, int size, int element_size )
-{
-    srand ( time(NULL) );
-    int byte_size = element_size * sizeof(double);
+/* Training batches are gathered through a permutation of the elements
+ * indexes, so that the training data is never moved (and it can be a
+ * read-only mapping): each batch is copied into an aligned buffer,
+ * prefetching the next element while copying the current one. Batches of
+ * data that isn't shuffled are read in place. The random generator is
+ * seeded once per training.
+ * Pipelined loaders shuffle and gather batches on their own thread, into
+ * two buffers: the next batch is gathered while the current one trains.
+ * Loaders of data sources read the elements in chunks of PS_SOURCE_CHUNK
+ * elements: shuffled elements are drawn at random from a window of the
+ * next elements, every drawn element being replaced by the next one read
+ * from the source. */
+
+#define PS_LOADER_BUFFERS 2
+#define PS_SOURCE_CHUNK 256
+
+typedef struct {
+    ps_real * data;
+    int element_size;
+    int count;
+    int batch_size;
+    int * indexes; // Elements permutation (NULL if not shuffled)
+    ps_real * buffers[PS_LOADER_BUFFERS];
+    unsigned int seed;
+    int pipelined;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int batches_count; // Batches of the current epoch
+    int produced; // Batches gathered in the current epoch
+    int consumed; // Batches trained in the current epoch
+    int shuffle; // The permutation must be shuffled before gathering
+    int stopped;
+    int failed; // A batch could not be read from the data source
+    /* Data source state */
+    PSDataSource * source;
+    pthread_mutex_t source_lock; // Hogwild workers read batches concurrently
+    ps_real * chunk;
+    int chunk_count;
+    int chunk_next;
+    ps_real * window; // Shuffle window (NULL if not shuffled)
+    int window_size;
+    int window_count;
+} PSBatchLoader;
+
+static void shuffleIndexes(int * indexes, int size, unsigned int * seed) {
     for (int i = size - 1; i > 0; i--) {
-        int j = rand() % (i+1);
-        //printf("Shuffle cycle %d: random is %d\n", i, j);
-        double tmp_a[element_size];
-        double tmp_b[element_size];
-        int idx_a = i * element_size;
-        int idx_b = j * element_size;
-        //printf("-> idx_a: %d\n", idx_a);
-        //printf("-> idx_b: %d\n", idx_b);
-        memcpy(tmp_a, array + idx_a, byte_size);
-        memcpy(tmp_b, array + idx_b, byte_size);
-        memcpy(array + idx_a, tmp_b, byte_size);
-        memcpy(array + idx_b, tmp_a, byte_size);
-    }
-}
-
-static void shuffleSeries ( double ** series, int size)
-{
-    srand ( time(NULL) );
+        int j = rand_r(seed) % (i + 1);
+        int tmp = indexes[i];
+        indexes[i] = indexes[j];
+        indexes[j] = tmp;
+    }
+}
+
+static void shuffleSeries(ps_real ** series, int size, unsigned int * seed) {
     for (int i = size - 1; i > 0; i--) {
-        int j = rand() % (i+1);
-        //printf("Shuffle cycle %d: random is %d\n", i, j);
-        double * tmp_a = series[i];
-        double * tmp_b = series[j];
-        series[i] = tmp_b;
-        series[j] = tmp_a;
+        int j = rand_r(seed) % (i + 1);
+        ps_real * tmp = series[i];
+        series[i] = series[j];
+        series[j] = tmp;
+    }
+}
+
+/* Returns the next element read from the data source, or NULL at the end
+ * of the data or on errors. */
+static ps_real * nextSourceElement(PSBatchLoader * loader) {
+    if (loader->chunk_next >= loader->chunk_count) {
+        PSDataSource * source = loader->source;
+        int read = source->read(source, loader->chunk, PS_SOURCE_CHUNK);
+        if (read <= 0) {
+            if (read < 0) loader->failed = 1;
+            loader->chunk_count = 0;
+            loader->chunk_next = 0;
+            return NULL;
+        }
+        loader->chunk_count = read;
+        loader->chunk_next = 0;
+    }
+    return loader->chunk + ((size_t) (loader->chunk_next++) *
+                            loader->element_size);
+}
+
+/* Rewinds the data source and fills the shuffle window. */
+static int rewindSource(PSBatchLoader * loader) {
+    PSDataSource * source = loader->source;
+    size_t bytes = loader->element_size * sizeof(ps_real);
+    loader->chunk_count = 0;
+    loader->chunk_next = 0;
+    loader->window_count = 0;
+    if (!source->rewind(source)) {
+        loader->failed = 1;
+        return 0;
+    }
+    if (loader->window == NULL) return 1;
+    while (loader->window_count < loader->window_size) {
+        ps_real * element = nextSourceElement(loader);
+        if (element == NULL) break;
+        memcpy(loader->window + ((size_t) (loader->window_count++) *
+                                 loader->element_size), element, bytes);
+    }
+    return !loader->failed;
+}
+
+/* Reads the next batch from the data source into `buffer`. */
+static ps_real * readSourceBatch(PSBatchLoader * loader, ps_real * buffer) {
+    int element_size = loader->element_size, i;
+    size_t bytes = element_size * sizeof(ps_real);
+    pthread_mutex_lock(&loader->source_lock);
+    for (i = 0; i < loader->batch_size && !loader->failed; i++) {
+        ps_real * dest = buffer + ((size_t) i * element_size);
+        if (loader->window == NULL) {
+            ps_real * element = nextSourceElement(loader);
+            if (element == NULL) break;
+            memcpy(dest, element, bytes);
+            continue;
+        }
+        if (loader->window_count == 0) break;
+        int j = rand_r(&(loader->seed)) % loader->window_count;
+        ps_real * drawn = loader->window + ((size_t) j * element_size);
+        memcpy(dest, drawn, bytes);
+        ps_real * element = nextSourceElement(loader);
+        if (element == NULL)
+            element = loader->window + ((size_t) (--loader->window_count) *
+                                        element_size);
+        if (element != drawn) memcpy(drawn, element, bytes);
+    }
+    if (i < loader->batch_size && !loader->failed) {
+        PSErr("PSTrainSource", "Data source ended before %d elements!",
+              loader->count);
+        loader->failed = 1;
+    }
+    int failed = loader->failed;
+    pthread_mutex_unlock(&loader->source_lock);
+    return (failed ? NULL : buffer);
+}
+
+/* Returns the elements of a batch, gathering them into `buffer` if the
+ * data is shuffled (or NULL if they could not be read). */
+static ps_real * gatherBatch(PSBatchLoader * loader, int batch,
+                             ps_real * buffer)
+{
+    int element_size = loader->element_size, i, first = batch *
+        loader->batch_size;
+    if (loader->source != NULL) return readSourceBatch(loader, buffer);
+    if (loader->indexes == NULL)
+        return loader->data + ((size_t) first * element_size);
+    int * indexes = loader->indexes + first;
+    size_t bytes = element_size * sizeof(ps_real), line;
+    for (i = 0; i < loader->batch_size; i++) {
+        if (i < loader->batch_size - 1) {
+            char * next = (char *) (loader->data +
+                                    ((size_t) indexes[i + 1] * element_size));
+            for (line = 0; line < bytes; line += PS_TENSOR_ALIGNMENT)
+                __builtin_prefetch(next + line);
+        }
+        memcpy(buffer + (i * element_size),
+               loader->data + ((size_t) indexes[i] * element_size), bytes);
+    }
+    return buffer;
+}
+
+/* Shuffles the permutation, or rewinds the data source, before the first
+ * batch of an epoch is gathered. */
+static int shuffleBatches(PSBatchLoader * loader) {
+    if (loader->source != NULL) return rewindSource(loader);
+    if (loader->indexes != NULL)
+        shuffleIndexes(loader->indexes, loader->count, &(loader->seed));
+    return 1;
+}
+
+static void * batchLoaderThread(void * arg) {
+    PSBatchLoader * loader = (PSBatchLoader *) arg;
+    pthread_mutex_lock(&loader->lock);
+    while (1) {
+        while (!loader->stopped && (loader->produced >= loader->batches_count
+               || loader->produced - loader->consumed >= PS_LOADER_BUFFERS))
+            pthread_cond_wait(&loader->cond, &loader->lock);
+        if (loader->stopped) break;
+        int batch = loader->produced, shuffle = loader->shuffle;
+        loader->shuffle = 0;
+        pthread_mutex_unlock(&loader->lock);
+        if (shuffle) shuffleBatches(loader);
+        if (!loader->failed)
+            gatherBatch(loader, batch,
+                        loader->buffers[batch % PS_LOADER_BUFFERS]);
+        pthread_mutex_lock(&loader->lock);
+        // Failed batches are produced too, so that they're never waited for
+        loader->produced++;
+        pthread_cond_broadcast(&loader->cond);
+    }
+    pthread_mutex_unlock(&loader->lock);
+    return NULL;
+}
+
+static void deleteBatchLoader(PSBatchLoader * loader) {
+    int i;
+    if (loader->pipelined) {
+        pthread_mutex_lock(&loader->lock);
+        loader->stopped = 1;
+        pthread_cond_broadcast(&loader->cond);
+        pthread_mutex_unlock(&loader->lock);
+        pthread_join(loader->thread, NULL);
+        pthread_mutex_destroy(&loader->lock);
+        pthread_cond_destroy(&loader->cond);
+        loader->pipelined = 0;
+    }
+    if (loader->source != NULL) {
+        pthread_mutex_destroy(&loader->source_lock);
+        loader->source = NULL;
+    }
+    free(loader->indexes);
+    loader->indexes = NULL;
+    free(loader->chunk);
+    loader->chunk = NULL;
+    free(loader->window);
+    loader->window = NULL;
+    for (i = 0; i < PS_LOADER_BUFFERS; i++) {
+        free(loader->buffers[i]);
+        loader->buffers[i] = NULL;
+    }
+}
+
+/* Recurrent series are shuffled through their own pointers array, so
+ * loaders of recurrent data (NULL) only hold the random generator. Loaders
+ * of data sources (`source` isn't NULL) shuffle the elements through a
+ * window of `window_size` elements. */
+static int initBatchLoader(PSBatchLoader * loader, ps_real * data, int count,
+                           PSDataSource * source, int window_size,
+                           int element_size, int batch_size, int shuffled,
+                           int pipelined)
+{
+    int i;
+    memset(loader, 0, sizeof(PSBatchLoader));
+    loader->data = data;
+    loader->count = count;
+    loader->element_size = element_size;
+    loader->batch_size = batch_size;
+    loader->seed = (unsigned int) time(NULL);
+    if (source == NULL && (data == NULL || !shuffled)) return 1;
+    int buffers_count = (pipelined ? PS_LOADER_BUFFERS : 1), ok = 1;
+    for (i = 0; i < buffers_count; i++) {
+        loader->buffers[i] = PSCreateTensor(batch_size * element_size);
+        if (loader->buffers[i] == NULL) ok = 0;
+    }
+    if (source != NULL) {
+        loader->source = source;
+        pthread_mutex_init(&loader->source_lock, NULL);
+        loader->chunk = malloc((size_t) PS_SOURCE_CHUNK * element_size *
+                               sizeof(ps_real));
+        if (loader->chunk == NULL) ok = 0;
+        if (shuffled) {
+            loader->window_size = window_size;
+            loader->window = malloc((size_t) window_size * element_size *
+                                    sizeof(ps_real));
+            if (loader->window == NULL) ok = 0;
+        }
+    } else {
+        loader->indexes = malloc(count * sizeof(int));
+        if (loader->indexes == NULL) ok = 0;
+    }
+    if (!ok) {
+        printMemoryErrorMsg();
+        deleteBatchLoader(loader);
+        return 0;
+    }
+    if (loader->indexes != NULL)
+        for (i = 0; i < count; i++) loader->indexes[i] = i;
+    if (!pipelined) return 1;
+    pthread_mutex_init(&loader->lock, NULL);
+    pthread_cond_init(&loader->cond, NULL);
+    if (pthread_create(&loader->thread, NULL, batchLoaderThread, loader)) {
+        // Batches are gathered on the training thread
+        pthread_mutex_destroy(&loader->lock);
+        pthread_cond_destroy(&loader->cond);
+        return 1;
+    }
+    loader->pipelined = 1;
+    return 1;
+}
+
+/* Shuffles the permutation (or rewinds the data source) and starts
+ * gathering the batches of an epoch. */
+static void startBatchLoader(PSBatchLoader * loader, int batches_count) {
+    if (loader->indexes == NULL && loader->source == NULL) return;
+    if (!loader->pipelined) {
+        shuffleBatches(loader);
+        return;
+    }
+    pthread_mutex_lock(&loader->lock);
+    loader->batches_count = batches_count;
+    loader->produced = 0;
+    loader->consumed = 0;
+    loader->shuffle = 1;
+    pthread_cond_broadcast(&loader->cond);
+    pthread_mutex_unlock(&loader->lock);
+}
+
+/* Returns the next batch of the epoch (or NULL if it could not be read),
+ * which must be released by releaseBatch once trained. */
+static ps_real * getNextBatch(PSBatchLoader * loader, int batch) {
+    if (!loader->pipelined) {
+        if (loader->failed) return NULL;
+        return gatherBatch(loader, batch, loader->buffers[0]);
     }
+    pthread_mutex_lock(&loader->lock);
+    while (loader->produced <= batch)
+        pthread_cond_wait(&loader->cond, &loader->lock);
+    pthread_mutex_unlock(&loader->lock);
+    if (loader->failed) return NULL;
+    return loader->buffers[batch % PS_LOADER_BUFFERS];
+}
+
+static void releaseBatch(PSBatchLoader * loader, int batch) {
+    if (!loader->pipelined) return;
+    pthread_mutex_lock(&loader->lock);
+    loader->consumed = batch + 1;
+    pthread_cond_broadcast(&loader->cond);
+    pthread_mutex_unlock(&loader->lock);
+}
+
+/* Progress is printed about once per percent of the batches of an epoch,
+ * since flushing it at every batch can take longer than training small
+ * batches. */
+
+#define PROGRESS_STEPS 100
+
+static int isProgressBatch(int batch, int batches_count) {
+    int step = batches_count / PROGRESS_STEPS;
+    return (step < 2 || (batch % step) == 0 || batch == batches_count - 1);
 }
 
-static double ** getRecurrentSeries(double * array, int series_count,
+static void printProgress(PSNeuralNetwork * network, int epochs, int batch,
+                          int batches_count)
+{
+    printf("\rEpoch %d/%d: batch %d/%d", network->current_epoch + 1, epochs,
+           batch + 1, batches_count);
+    fflush(stdout);
+}
+
+static ps_real ** getRecurrentSeries(ps_real * array, int series_count,
                                     int x_size, int y_size)
 {
-    double ** series = malloc(series_count * sizeof(double**));
+    ps_real ** series = malloc(series_count * sizeof(ps_real**));
     if (series == NULL) {
         PSErr(NULL, "Could not allocate memory for recurrent series!");
         return NULL;
     }
     int i;
-    double * p = array;
+    ps_real * p = array;
     for (i = 0; i < series_count; i++) {
         int series_size = (int) *p;
         if (!series_size) {
@@ -261,12 +565,12 @@ static double ** getRecurrentSeries(double * array, int series_count,
     return series;
 }
 
-static int arrayMaxIndex(double * array, int len) {
+static int arrayMaxIndex(ps_real * array, int len) {
     int i;
-    double max = 0;
+    ps_real max = 0;
     int max_idx = 0;
     for (i = 0; i < len; i++) {
-        double v = array[i];
+        ps_real v = array[i];
         if (v > max) {
             max = v;
             max_idx = i;
@@ -275,11 +579,11 @@ static int arrayMaxIndex(double * array, int len) {
     return max_idx;
 }
 
-/*static double arrayMax(double * array, int len) {
+/*static ps_real arrayMax(ps_real * array, int len) {
     int i;
-    double max = 0;
+    ps_real max = 0;
     for (i = 0; i < len; i++) {
-        double v = array[i];
+        ps_real v = array[i];
         if (v > max) {
             max = v;
         }
@@ -287,16 +591,14 @@ static int arrayMaxIndex(double * array, int len) {
     return max;
 }*/
 
-static void fetchRecurrentOutputState(PSLayer * out, double * outputs,
+static void fetchRecurrentOutputState(PSLayer * out, ps_real * outputs,
                                       int i, int onehot)
 {
     int t = (onehot ? i : i % out->size), j;
     int max_idx = 0;
-    double max = 0.0;
+    ps_real max = 0.0;
     for (j = 0; j < out->size; j++) {
-        PSNeuron * neuron = out->neurons[j];
-        PSRecurrentCell * cell = GetRecurrentCell(neuron);
-        double s = cell->states[t];
+        ps_real s = GetLayerState(out, j, t);
         if (onehot) {
             if (s > max) {
                 max = s;
@@ -309,22 +611,20 @@ static void fetchRecurrentOutputState(PSLayer * out, double * outputs,
     if (onehot) outputs[i] = max_idx;
 }
 
-static double getDeltaForNeuron(PSNeuron * neuron,
-                                PSLayer * layer,
-                                PSLayer * nextLayer,
-                                double * last_delta)
+static void getLayerDeltas(PSLayer * layer, PSLayer * nextLayer,
+                           ps_real * last_delta, ps_real * delta)
 {
-    int index = neuron->index, i;
-    double dv = 0;
-    for (i = 0; i < nextLayer->size; i++) {
-        PSNeuron * nextNeuron = nextLayer->neurons[i];
-        double weight = nextNeuron->weights[index];
-        double d = last_delta[i];
-        dv += (d * weight);
+    // Deltas are computed as the product between the next layer's deltas
+    // and its weights matrix, by walking the contiguous weight rows instead
+    // of gathering a column from every next neuron.
+    int size = layer->size, next_size = nextLayer->size, j;
+    PSGemmNN(1, size, next_size, last_delta, next_size, nextLayer->weights,
+             nextLayer->weights_stride, delta, size, PS_GEMM_STORE);
+    if (layer->derivative != NULL) {
+        ps_real * activations = layer->activations;
+        for (j = 0; j < size; j++)
+            delta[j] *= layer->derivative(activations[j]);
     }
-    if (layer->derivative != NULL)
-        dv *= layer->derivative(neuron->activation);
-    return dv;
 }
 
 static int compareVersion(const char* vers1, const char* vers2) {
@@ -433,15 +733,15 @@ void PSPrintNetworkInfo(PSNeuralNetwork * network) {
 
 /* Loss Functions */
 
-double PSQuadraticLoss(double * outputs, double * desired, int size,
-                     int onehot_size)
+double PSQuadraticLoss(ps_real * outputs, ps_real * desired, int size,
+                       int onehot_size)
 {
-    double * _diffs;
-    double diffs[size];
+    ps_real * _diffs;
+    ps_real diffs[size];
     if (!onehot_size) {
         int i;
         for (i = 0; i < size; i++) {
-            double d = outputs[i] - desired[i];
+            ps_real d = outputs[i] - desired[i];
             diffs[i] = d;
         }
         _diffs = diffs;
@@ -452,8 +752,8 @@ double PSQuadraticLoss(double * outputs, double * desired, int size,
     return loss;
 }
 
-double PSCrossEntropyLoss(double * outputs, double * desired, int size,
-                        int onehot_size)
+double PSCrossEntropyLoss(ps_real * outputs, ps_real * desired, int size,
+                          int onehot_size)
 {
     double loss = 0.0;
     int i;
@@ -492,10 +792,85 @@ PSNeuralNetwork * PSCreateNetwork(const char* name) {
     network->flags = FLAG_NONE;
     network->loss = PSQuadraticLoss;
     network->onEpochTrained = NULL;
+    network->gradients = NULL;
+    network->workers = NULL;
+    network->checkpoints = NULL;
+    network->mapping = NULL;
+    network->mapping_size = 0;
     return network;
 }
 
-PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only) {
+/* Points the weights and biases tensors of a layer to the given arrays,
+ * moving the views of its neurons (and shared params or LSTM cells) too. */
+static void setLayerParameters(PSLayer * layer, ps_real * weights,
+                               ps_real * biases)
+{
+    int i;
+    layer->weights = weights;
+    layer->biases = biases;
+    if (layer->type == Convolutional) {
+        PSSharedParams * shared = getConvSharedParams(layer);
+        int feature_size = layer->size / shared->feature_count;
+        shared->biases = biases;
+        for (i = 0; i < shared->feature_count; i++)
+            shared->weights[i] = weights + (i * layer->weights_stride);
+        for (i = 0; i < layer->size; i++) {
+            layer->neurons[i]->weights = shared->weights[i / feature_size];
+            layer->neurons[i]->bias = biases + (i / feature_size);
+        }
+        return;
+    }
+    for (i = 0; i < layer->size; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        neuron->weights = weights + (i * layer->weights_stride);
+        neuron->bias = biases + i;
+        if (layer->type != LSTM || neuron->extra == NULL) continue;
+        PSLSTMCell * cell = GetLSTMCell(neuron);
+        int ws = cell->weights_size;
+        cell->candidate_weights = neuron->weights;
+        cell->input_weights = neuron->weights + ws;
+        cell->output_weights = neuron->weights + (ws * 2);
+        cell->forget_weights = neuron->weights + (ws * 3);
+    }
+}
+
+// Detaches a layer from the shared parameters, so that it can be deleted
+
+static void unshareLayerParameters(PSLayer * layer) {
+    int i;
+    if (layer->weights == NULL) return;
+    layer->weights = NULL;
+    layer->biases = NULL;
+    for (i = 0; i < layer->size; i++) layer->neurons[i]->weights = NULL;
+    if (layer->type == Convolutional) getConvSharedParams(layer)->biases = NULL;
+}
+
+/* Copies weights and biases of a layer into a layer with the same layout. */
+static void copyLayerParameters(PSLayer * dst, PSLayer * src) {
+    int j;
+    if (src->weights != NULL) {
+        int rows = getLayerWeightsRows(src);
+        memcpy(dst->weights, src->weights,
+               rows * src->weights_stride * sizeof(ps_real));
+        memcpy(dst->biases, src->biases, rows * sizeof(ps_real));
+    }
+    for (j = 0; j < src->size; j++) {
+        PSNeuron * orig_n = src->neurons[j];
+        PSNeuron * clone_n = dst->neurons[j];
+        if (src->type == LSTM) {
+            PSLSTMCell * ocell = GetLSTMCell(orig_n);
+            PSLSTMCell * ccell = GetLSTMCell(clone_n);
+            ccell->candidate_bias = ocell->candidate_bias;
+            ccell->input_bias = ocell->input_bias;
+            ccell->output_bias = ocell->output_bias;
+            ccell->forget_bias = ocell->forget_bias;
+        }
+    }
+}
+
+static PSNeuralNetwork * cloneNetwork(PSNeuralNetwork * network,
+                                      int layout_only, int log)
+{
     if (network == NULL) return NULL;
     PSNeuralNetwork * clone = PSCreateNetwork(NULL);
     if (clone == NULL) return NULL;
@@ -508,7 +883,7 @@ PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only) {
     clone->flags = network->flags;
     clone->loss = network->loss;
     
-    int i, j, k, w;
+    int i, j, k;
     for (i = 0; i < network->size; i++) {
         PSLayer * layer = network->layers[i];
         PSLayerType type = layer->type;
@@ -531,62 +906,38 @@ PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only) {
             for (j = 0; j < cparams->count; j++)
                 cparams->parameters[j] = oparams->parameters[j];
         }
-        PSLayer * cloned_layer = PSAddLayer(clone, type, layer->size, cparams);
+        PSLayer * cloned_layer = addLayer(clone, type, layer->size, cparams,
+                                          log);
         if (cloned_layer == NULL) {
             PSDeleteNetwork(clone);
             return NULL;
         }
         cloned_layer->flags = layer->flags;
         if (!layout_only) {
-            void * extra = layer->extra;
-            if (Convolutional == type && extra) {
-                PSSharedParams * oshared = getConvSharedParams(layer);
-                PSSharedParams * cshared = getConvSharedParams(cloned_layer);
-                cshared->feature_count = oshared->feature_count;
-                cshared->weights_size = oshared->weights_size;
-                for (k = 0; k < cshared->feature_count; k++) {
-                    cshared->biases[k] = oshared->biases[k];
-                    for (w = 0; w < cshared->weights_size; w++)
-                        cshared->weights[k][w] = oshared->weights[k][w];
-                }
-            }
-            for (j = 0; j < layer->size; j++) {
+            int lsize = layer->size;
+            memcpy(cloned_layer->activations, layer->activations,
+                   lsize * sizeof(ps_real));
+            memcpy(cloned_layer->z_values, layer->z_values,
+                   lsize * sizeof(ps_real));
+            copyLayerParameters(cloned_layer, layer);
+            for (j = 0; j < lsize; j++) {
                 PSNeuron * orig_n = layer->neurons[j];
                 PSNeuron * clone_n = cloned_layer->neurons[j];
                 clone_n->activation = orig_n->activation;
                 clone_n->z_value = orig_n->z_value;
-                //if (Pooling == type) continue;
-                clone_n->bias = orig_n->bias;
-
-                if (Convolutional != type && Pooling != type) {
-                    double * oweights = orig_n->weights;
-                    double * cweights = clone_n->weights;
-                    for (w = 0; w < orig_n->weights_size; w++)
-                        cweights[w] = oweights[w];
-                }
-                if (layer->flags & FLAG_RECURRENT) {
-                    PSRecurrentCell * ocell = GetRecurrentCell(orig_n);
-                    PSRecurrentCell * ccell = GetRecurrentCell(clone_n);
-                    int sc = ocell->states_count;
-                    ccell->states_count = sc;
-                    if (sc > 0) {
-                        ccell->states = malloc(sc * sizeof(double));
-                        if (ccell->states == NULL) {
-                            printMemoryErrorMsg();
-                            PSDeleteNetwork(clone);
-                            return NULL;
-                        }
-                        for (k = 0; k < sc; k++)
-                            ccell->states[k] = ocell->states[k];
-                    }
+            }
+            PSStateArena * arena = GetStateArena(layer);
+            if (arena != NULL) {
+                PSStateArena * carena = PSPrepareStateArena(cloned_layer,
+                                                            arena->count,
+                                                            arena->times);
+                if (carena == NULL) {
+                    PSDeleteNetwork(clone);
+                    return NULL;
                 }
-                if (layer->type == LSTM) {
-                    PSLSTMCell * ocell = GetLSTMCell(orig_n);
-                    PSLSTMCell * ccell = GetLSTMCell(clone_n);
-                    ccell->candidate_bias = ocell->candidate_bias;
-                    ccell->input_bias = ocell->input_bias;
-                    ccell->output_bias = ocell->output_bias;
-                    ccell->forget_bias = ocell->forget_bias;
+                for (k = 0; k < arena->count; k++) {
+                    memcpy(carena->buffers[k], arena->buffers[k],
+                           (size_t) arena->times * lsize * sizeof(ps_real));
                 }
             }
         }
@@ -594,78 +945,716 @@ PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only) {
     return clone;
 }
 
-int PSLoadNetwork(PSNeuralNetwork * network, const char* filename) {
-    if (network == NULL) return 0;
-    FILE * f = fopen(filename, "r");
-    printf("Loading network from %s\n", filename);
-    if (f == NULL) {
-        fprintf(stderr, "Cannot open %s!\n", filename);
+PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only) {
+    return cloneNetwork(network, layout_only, 1);
+}
+
+/* Checks that a layer of the network matches the one read from a file. */
+static int checkLoadedLayer(PSLayer * layer, PSLayerType ltype, int lsize,
+                            double * args, int argc)
+{
+    char * func = "PSLoadNetwork";
+    int i = layer->index, aidx;
+    if (layer->size != lsize) {
+        PSErr(func, "Layer %d size %d differs from %d!", i,
+              layer->size, lsize);
         return 0;
     }
-    char * func = "PSLoadNetwork";
-    int netsize, i, j, k;
-    int empty = (network->size == 0);
-    char vers[20] = "0.0.0";
-    int v0 = 0, v1 = 0, v2 = 0;
-    int epochs = 0, batch_count = 0;
-    int matched = fscanf(f, "--v%d.%d.%d", &v0, &v1, &v2);
-    if (matched) {
-        sprintf(vers, "%d.%d.%d", v0, v1, v2);
-        printf("File version is %s (current: %s).\n", vers, PSYC_VERSION);
-        int idx = 0, val = 0;
-        PSLossFunction loss = NULL;
-        while ((matched = fscanf(f, ",%d", &val))) {
-            switch (idx++) {
-                case 0:
-                    network->flags |= val; break;
-                case 1:
-                    if ((size_t) val < loss_functions_count) {
-                        loss = loss_functions[val];
-                        network->loss = loss;
-                        printf("Loss Function: %s\n",getLossFunctionName(loss));
-                    }
-                    break;
-                case 2: epochs = val; break;
-                case 3: batch_count = val; break;
-                default:
-                    break;
+    if (ltype != layer->type) {
+        PSErr(func, "Layer %d type %d differs from %d!", i,
+              (int) (layer->type), (int) ltype);
+        return 0;
+    }
+    if (ltype == Convolutional || ltype == Pooling) {
+        PSLayerParameters * params = layer->parameters;
+        if (params == NULL) {
+            PSErr(func, "Layer %d params are NULL!", i);
+            return 0;
+        }
+        for (aidx = 0; aidx < argc; aidx++) {
+            if (aidx >= params->count) break;
+            int arg = (int) args[aidx];
+            double val = params->parameters[aidx];
+            if (arg != (int) val) {
+                PSErr(func, "Layer %d arg[%d] %d diff. from %d!",
+                      i, aidx,(int) val, arg);
+                return 0;
             }
         }
-        fscanf(f, "\n");
     }
-    matched = fscanf(f, "%d:", &netsize);
-    if (!matched) {
-        PSErr(func, "Invalid file %s!", filename);
-        fclose(f);
+    return 1;
+}
+
+/* Adds a layer read from a file: its args are the layer parameters (or the
+ * vector size of one-hot input layers). */
+static PSLayer * addLoadedLayer(PSNeuralNetwork * network, PSLayerType ltype,
+                                int lsize, int lflags, double * args,
+                                int argc)
+{
+    char * func = "PSLoadNetwork";
+    PSLayer * layer = NULL;
+    PSLayerParameters * params = NULL;
+    int aidx;
+    if (ltype == Convolutional || ltype == Pooling) {
+        int param_c = CONV_PARAMETER_COUNT;
+        params = PSCreateLayerParamenters(param_c);
+        for (aidx = 0; aidx < argc; aidx++) {
+            if (aidx >= param_c) break;
+            params->parameters[aidx] = (double) ((int) args[aidx]);
+        }
+        layer = PSAddLayer(network, ltype, lsize, params);
+    } else {
+        if (network->size == 0 && (lflags & FLAG_ONEHOT) && argc > 0) {
+            lsize = (int) args[0];
+            network->flags |= FLAG_ONEHOT;
+        } else if (argc > 0) {
+            params = PSCreateLayerParamenters(argc);
+            for (aidx = 0; aidx < argc; aidx++)
+                params->parameters[aidx] = (double) ((int) args[aidx]);
+        }
+        layer = PSAddLayer(network, ltype, lsize, params);
+    }
+    if (layer == NULL) {
+        PSErr(func, "Could not create layer %d", network->size);
+        return NULL;
+    }
+    layer->flags |= lflags;
+    return layer;
+}
+
+/* Text format parameters: a line for every neuron (or feature) of every
+ * layer but the input and pooling ones, made of its bias (or the four LSTM
+ * cell biases) followed by its weights. Once the whole parameters section
+ * has been read and split into lines, every line can be parsed on its own,
+ * so lines are split across the library's workers. */
+
+typedef struct {
+    PSNeuralNetwork * network;
+    char ** lines;
+    int * line_layers; // Layer of every line
+    int * layer_lines; // First line of every layer
+    int count;
+    int failed;
+} PSTextParameters;
+
+/* Returns the number of parameters lines of a layer, or -1 on error. */
+static int getLayerParametersLines(PSLayer * layer) {
+    if (layer->type == Pooling) return 0;
+    if (layer->type == Convolutional) {
+        PSSharedParams * shared = getConvSharedParams(layer);
+        if (shared == NULL) {
+            PSErr("PSLoadNetwork", "Layer %d, missing shared params!",
+                  layer->index);
+            return -1;
+        }
+        return shared->feature_count;
+    }
+    return layer->size;
+}
+
+/* Parses `count` values separated by `sep` and followed by `last`,
+ * returning a pointer past `last` or NULL on error. */
+static char * parseTextValues(char * p, double * values, int count,
+                              char sep, char last)
+{
+    int i;
+    char * end;
+    for (i = 0; i < count; i++) {
+        values[i] = PSParseReal(p, &end);
+        if (end == p) return NULL;
+        p = end;
+        if (*p != (i < (count - 1) ? sep : last)) return NULL;
+        p++;
+    }
+    return p;
+}
+
+static int parseParametersLine(PSTextParameters * params, int line) {
+    char * func = "PSLoadNetwork";
+    int i = params->line_layers[line], j = line - params->layer_lines[i], k;
+    PSLayer * layer = params->network->layers[i];
+    char * p = params->lines[line], * end;
+    int is_lstm = (LSTM == layer->type), wsize = 0;
+    //Bias (or candidate, input, output and forget LSTM biases)
+    double biases[4] = {0};
+    p = parseTextValues(p, biases, (is_lstm ? 4 : 1), ',', '|');
+    if (p == NULL) {
+        PSErr(func, "Layer %d, neuron %d: invalid bias!", i, j);
         return 0;
     }
-    if (!empty && network->size != netsize) {
-        PSErr(func, "Network size differs!");
-        fclose(f);
+    ps_real * weights = NULL;
+    if (layer->type == Convolutional) {
+        PSSharedParams * shared = getConvSharedParams(layer);
+        shared->biases[j] = biases[0];
+        wsize = shared->weights_size;
+        weights = shared->weights[j];
+    } else {
+        PSNeuron * neuron = layer->neurons[j];
+        wsize = neuron->weights_size;
+        layer->biases[j] = biases[0];
+        weights = neuron->weights;
+        if (is_lstm) {
+            PSLSTMCell * cell = GetLSTMCell(neuron);
+            assert(cell != NULL);
+            cell->candidate_bias = biases[0];
+            cell->input_bias = biases[1];
+            cell->output_bias = biases[2];
+            cell->forget_bias = biases[3];
+        }
+    }
+    for (k = 0; k < wsize; k++) {
+        weights[k] = PSParseReal(p, &end);
+        if (end == p || (k < (wsize - 1) && *end != ',')) {
+            PSErr(func, "Layer %d neuron %d: invalid weight[%d]", i, j, k);
+            return 0;
+        }
+        p = end + 1;
+    }
+    return 1;
+}
+
+static void parseParametersWorker(void * arg, int worker, int count) {
+    PSTextParameters * params = (PSTextParameters *) arg;
+    int first, last, line;
+    PSGetWorkerRange(params->count, worker, count, &first, &last);
+    for (line = first; line < last; line++) {
+        if (params->failed) break;
+        if (!parseParametersLine(params, line)) params->failed = 1;
+    }
+}
+
+/* Reads the parameters section of a text file, starting from the current
+ * position of `f`. */
+static int loadTextParameters(PSNeuralNetwork * network, FILE * f) {
+    char * func = "PSLoadNetwork";
+    int i, j, ok = 0;
+    long offset = ftell(f), size = 0;
+    if (offset < 0 || fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) < 0 ||
+        fseek(f, offset, SEEK_SET) != 0) {
+        PSErr(func, "Could not read parameters!");
         return 0;
     }
-    char sep[] = ",";
-    char eol[] = "\n";
-    int min_argc = (compareVersion(vers, "0.0.0") == 1 ? 2 : 1);
-    PSLayer * layer = NULL;
-    for (i = 0; i < netsize; i++) {
-        int lsize = 0;
-        int lflags = 0;
-        PSLayerType ltype = FullyConnected;
-        int args[20];
-        int argc = 0, aidx = 0;
-        char * last = (i == (netsize - 1) ? eol : sep);
-        char fmt[50];
-        char buff[255];
-        sprintf(fmt, "%%d%s", last);
-        //fputs(fmt, stderr);
-        matched = fscanf(f, fmt, &lsize);
-        if (!matched) {
-            int type = 0, arg = 0;
-            argc = 0;
-            matched = fscanf(f, "[%d,%d", &type, &argc);
-            if (!matched) {
-                PSErr(func, "Invalid header: layer[%d], col. %ld!",
+    size -= offset;
+    PSTextParameters params = {network, NULL, NULL, NULL, 0, 0};
+    char * buffer = malloc(size + 1);
+    params.layer_lines = calloc(network->size, sizeof(int));
+    if (buffer == NULL || params.layer_lines == NULL) {
+        printMemoryErrorMsg();
+        goto cleanup;
+    }
+    if (fread(buffer, 1, size, f) != (size_t) size) {
+        PSErr(func, "Could not read parameters!");
+        goto cleanup;
+    }
+    buffer[size] = '\0';
+    int lines_count = 0;
+    for (i = 1; i < network->size; i++) {
+        int layer_lines = getLayerParametersLines(network->layers[i]);
+        if (layer_lines < 0) goto cleanup;
+        params.layer_lines[i] = lines_count;
+        lines_count += layer_lines;
+    }
+    params.lines = malloc(lines_count * sizeof(char *));
+    params.line_layers = malloc(lines_count * sizeof(int));
+    if (lines_count > 0 && (params.lines == NULL ||
+                            params.line_layers == NULL)) {
+        printMemoryErrorMsg();
+        goto cleanup;
+    }
+    // Every line is terminated so that parsing can't go past its end.
+    char * p = buffer, * buffer_end = buffer + size;
+    while (p < buffer_end && params.count < lines_count) {
+        char * eol = memchr(p, '\n', buffer_end - p);
+        if (eol == NULL) eol = buffer_end;
+        *eol = '\0';
+        if (p[strspn(p, " \t\r")] != '\0')
+            params.lines[params.count++] = p;
+        p = eol + 1;
+    }
+    for (i = 1; i < network->size; i++) {
+        int first = params.layer_lines[i];
+        int last = (i < (network->size - 1) ? params.layer_lines[i + 1] :
+                    lines_count);
+        for (j = first; j < last; j++) params.line_layers[j] = i;
+        if (params.count < last) {
+            PSErr(func, "Layer %d, neuron %d: invalid bias!", i,
+                  params.count - first);
+            goto cleanup;
+        }
+    }
+    PSRunLayerWorkers(parseParametersWorker, &params, size);
+    ok = !params.failed;
+cleanup:
+    free(buffer);
+    free(params.lines);
+    free(params.line_layers);
+    free(params.layer_lines);
+    return ok;
+}
+
+/* Binary format: a header followed by a table of layers, whose parameters
+ * are stored as ps_real arrays (in native byte order, which the header
+ * tags) aligned to PS_TENSOR_ALIGNMENT in the file, so that they can be
+ * mapped straight into the layer tensors. Weights rows are padded to
+ * `weights_stride` (LSTM rows are packed, see lstm.h). LSTM layers also
+ * store the four biases of every cell. */
+
+#define PS_BINARY_MAGIC     "PSYCBIN"
+#define PS_BINARY_VERSION   1
+#define PS_BINARY_MAX_ARGS  12
+// Read back as a different value on machines with another byte order
+#define PS_BINARY_BYTE_ORDER 0x01020304
+
+typedef struct {
+    char magic[8];
+    int32_t version;
+    int32_t real_size;
+    int32_t flags;
+    int32_t loss;
+    int32_t epochs;
+    int32_t batch;
+    int32_t layers_count;
+    int32_t byte_order;
+    uint64_t file_size;
+} PSBinaryHeader;
+
+typedef struct {
+    int32_t type;
+    int32_t size;
+    int32_t flags;
+    int32_t argc;
+    double args[PS_BINARY_MAX_ARGS];
+    int32_t rows;
+    int32_t weights_size;
+    int32_t weights_stride;
+    int32_t reserved;
+    uint64_t weights_offset;
+    uint64_t biases_offset;
+    uint64_t cell_biases_offset;
+} PSBinaryLayer;
+
+#define alignBinaryOffset(offset) \
+    (((offset) + PS_TENSOR_ALIGNMENT - 1) / PS_TENSOR_ALIGNMENT * \
+     PS_TENSOR_ALIGNMENT)
+
+static int isBinaryNetworkFile(const char * filename) {
+    char magic[8] = {0};
+    FILE * f = fopen(filename, "rb");
+    if (f == NULL) return 0;
+    size_t read = fread(magic, 1, sizeof(magic), f);
+    fclose(f);
+    return (read == sizeof(magic) && strcmp(magic, PS_BINARY_MAGIC) == 0);
+}
+
+static int getLayerWeightsSize(PSLayer * layer) {
+    if (layer->weights == NULL) return 0;
+    if (layer->type == Convolutional)
+        return getConvSharedParams(layer)->weights_size;
+    return layer->neurons[0]->weights_size;
+}
+
+static int isMappedTensor(PSNeuralNetwork * network, ps_real * tensor) {
+    char * mapping = (char *) network->mapping, * ptr = (char *) tensor;
+    if (mapping == NULL || tensor == NULL) return 0;
+    return (ptr >= mapping && ptr < mapping + network->mapping_size);
+}
+
+/* Reads an array of `count` values stored with the given size into dst. */
+static void readBinaryReals(ps_real * dst, char * src, int count,
+                            int real_size)
+{
+    int i;
+    if (real_size == sizeof(ps_real)) {
+        memcpy(dst, src, count * sizeof(ps_real));
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        if (real_size == sizeof(float)) dst[i] = ((float *) src)[i];
+        else dst[i] = ((double *) src)[i];
+    }
+}
+
+/* Loads the parameters of a layer from the mapped file: they are used in
+ * place if their layout matches the layer's tensors, otherwise they're
+ * copied. Returns 2 if the layer uses the mapping, 1 if it has been copied
+ * and 0 on errors. */
+static int loadBinaryLayerParameters(PSLayer * layer, PSBinaryLayer * info,
+                                     char * data, size_t data_size,
+                                     int real_size, int can_map)
+{
+    char * func = "PSLoadNetwork";
+    int i, j, rows = getLayerWeightsRows(layer), mapped = 0;
+    int weights_size = getLayerWeightsSize(layer);
+    if (layer->weights == NULL) return 1;
+    if (info->rows != rows || info->weights_size != weights_size ||
+        info->weights_stride < weights_size)
+    {
+        PSErr(func, "Layer %d parameters differ from the file!",
+              layer->index);
+        return 0;
+    }
+    uint64_t weights_bytes = (uint64_t) rows * info->weights_stride *
+                             real_size;
+    uint64_t biases_bytes = (uint64_t) rows * real_size;
+    if (info->weights_offset + weights_bytes > data_size ||
+        info->biases_offset + biases_bytes > data_size ||
+        (layer->type == LSTM &&
+         info->cell_biases_offset + (biases_bytes * 4) > data_size))
+    {
+        PSErr(func, "Layer %d parameters exceed the file!", layer->index);
+        return 0;
+    }
+    char * weights = data + info->weights_offset;
+    char * biases = data + info->biases_offset;
+    if (can_map && real_size == sizeof(ps_real) &&
+        info->weights_stride == layer->weights_stride &&
+        info->weights_offset % PS_TENSOR_ALIGNMENT == 0 &&
+        info->biases_offset % PS_TENSOR_ALIGNMENT == 0)
+    {
+        free(layer->weights);
+        free(layer->biases);
+        setLayerParameters(layer, (ps_real *) weights, (ps_real *) biases);
+        mapped = 1;
+    } else {
+        for (i = 0; i < rows; i++) {
+            readBinaryReals(layer->weights + (i * layer->weights_stride),
+                            weights + ((size_t) i * info->weights_stride *
+                                       real_size),
+                            weights_size, real_size);
+        }
+        readBinaryReals(layer->biases, biases, rows, real_size);
+    }
+    if (layer->type == Convolutional) return 1 + mapped;
+    ps_real cell_biases[4];
+    for (i = 0; i < layer->size; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        if (layer->type != LSTM) continue;
+        PSLSTMCell * cell = GetLSTMCell(neuron);
+        assert(cell != NULL);
+        j = i * 4;
+        readBinaryReals(cell_biases, data + info->cell_biases_offset +
+                        ((size_t) j * real_size), 4, real_size);
+        cell->candidate_bias = cell_biases[0];
+        cell->input_bias = cell_biases[1];
+        cell->output_bias = cell_biases[2];
+        cell->forget_bias = cell_biases[3];
+    }
+    return 1 + mapped;
+}
+
+static int loadBinaryNetwork(PSNeuralNetwork * network, const char * filename) {
+    char * func = "PSLoadNetwork";
+    int fd = open(filename, O_RDONLY), i, ok = 1, mapped = 0;
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "Cannot open %s!\n", filename);
+        if (fd >= 0) close(fd);
+        return 0;
+    }
+    size_t data_size = (size_t) st.st_size;
+    if (data_size < sizeof(PSBinaryHeader)) {
+        PSErr(func, "Invalid file %s!", filename);
+        close(fd);
+        return 0;
+    }
+    // Private mapping: training a loaded network copies the pages it
+    // updates, leaving the file untouched.
+    char * data = mmap(NULL, data_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                       fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        PSErr(func, "Could not map %s!", filename);
+        return 0;
+    }
+    PSBinaryHeader * header = (PSBinaryHeader *) data;
+    int count = header->layers_count;
+    size_t table_end = sizeof(PSBinaryHeader) +
+                       ((size_t) count * sizeof(PSBinaryLayer));
+    if (header->byte_order != PS_BINARY_BYTE_ORDER) {
+        PSErr(func, "File %s was saved with a different byte order!",
+              filename);
+        munmap(data, data_size);
+        return 0;
+    }
+    if (header->version < 1 || header->version > PS_BINARY_VERSION ||
+        count < 1 || table_end > data_size || header->file_size != data_size ||
+        (header->real_size != sizeof(float) &&
+         header->real_size != sizeof(double)))
+    {
+        PSErr(func, "Invalid or unsupported file %s!", filename);
+        munmap(data, data_size);
+        return 0;
+    }
+    printf("File version is binary v%d (%d bytes reals).\n",
+           header->version, header->real_size);
+    int empty = (network->size == 0);
+    if (!empty && network->size != count) {
+        PSErr(func, "Network size differs!");
+        munmap(data, data_size);
+        return 0;
+    }
+    network->flags |= header->flags;
+    if (header->loss >= 0 && (size_t) header->loss < loss_functions_count) {
+        network->loss = loss_functions[header->loss];
+        printf("Loss Function: %s\n", getLossFunctionName(network->loss));
+    }
+    PSBinaryLayer * table = (PSBinaryLayer *) (data + sizeof(PSBinaryHeader));
+    for (i = 0; i < count && ok; i++) {
+        PSBinaryLayer * info = table + i;
+        int argc = info->argc;
+        if (argc < 0 || argc > PS_BINARY_MAX_ARGS) {
+            PSErr(func, "Layer %d: invalid arguments count!", i);
+            ok = 0;
+            break;
+        }
+        PSLayerType ltype = (PSLayerType) info->type;
+        if (!empty)
+            ok = checkLoadedLayer(network->layers[i], ltype, info->size,
+                                  info->args, argc);
+        else
+            ok = (addLoadedLayer(network, ltype, info->size, info->flags,
+                                 info->args, argc) != NULL);
+    }
+    // A network already using a mapping gets its parameters copied, so that
+    // there's a single mapping to release.
+    int can_map = (network->mapping == NULL);
+    for (i = 1; i < count && ok; i++) {
+        int loaded = loadBinaryLayerParameters(network->layers[i], table + i,
+                                               data, data_size,
+                                               header->real_size, can_map);
+        ok = (loaded > 0);
+        if (loaded == 2) mapped = 1;
+    }
+    if (mapped) {
+        network->mapping = data;
+        network->mapping_size = data_size;
+    }
+    if (!ok) {
+        // Mapped layers stay valid until the network is deleted
+        if (!mapped) munmap(data, data_size);
+        return 0;
+    }
+    if (!mapped) munmap(data, data_size);
+    return 1;
+}
+
+/* Networks are written to a temporary file, which replaces `filename` only
+ * once it has been completely written: a loaded network can be mapped from
+ * the same file it's saved to, so the file must never be truncated. */
+static FILE * createNetworkFile(const char * filename, char * tmpfile,
+                                const char * mode)
+{
+    sprintf(tmpfile, "%s.%ld.tmp", filename, (long) getpid());
+    FILE * f = fopen(tmpfile, mode);
+    if (f == NULL) fprintf(stderr, "Cannot open %s for writing!\n", tmpfile);
+    return f;
+}
+
+static int closeNetworkFile(FILE * f, int ok, char * tmpfile,
+                            const char * filename, char * func)
+{
+    if (ferror(f)) ok = 0;
+    if (fclose(f) != 0) ok = 0;
+    if (ok && rename(tmpfile, filename) != 0) ok = 0;
+    if (!ok) {
+        PSErr(func, "Could not write %s!", filename);
+        remove(tmpfile);
+    }
+    return ok;
+}
+
+static int saveNetworkBinary(PSNeuralNetwork * network,
+                             const char * filename, int log)
+{
+    char * func = "PSSaveNetworkBinary";
+    if (network->size == 0) {
+        PSErr(func, "Empty network!");
+        return 0;
+    }
+    int i, j, count = network->size, ok = 1;
+    PSBinaryHeader header;
+    PSBinaryLayer * table = calloc(count, sizeof(PSBinaryLayer));
+    if (table == NULL) {
+        printMemoryErrorMsg();
+        return 0;
+    }
+    memset(&header, 0, sizeof(header));
+    strcpy(header.magic, PS_BINARY_MAGIC);
+    header.version = PS_BINARY_VERSION;
+    header.byte_order = PS_BINARY_BYTE_ORDER;
+    header.real_size = sizeof(ps_real);
+    header.flags = network->flags;
+    header.loss = 0;
+    for (i = 0; i < (int) loss_functions_count; i++) {
+        if (network->loss == loss_functions[i]) {
+            header.loss = i;
+            break;
+        }
+    }
+    header.epochs = network->current_epoch;
+    header.batch = network->current_batch;
+    header.layers_count = count;
+    uint64_t offset = sizeof(PSBinaryHeader) +
+                      ((uint64_t) count * sizeof(PSBinaryLayer));
+    for (i = 0; i < count; i++) {
+        PSLayer * layer = network->layers[i];
+        PSBinaryLayer * info = table + i;
+        PSLayerParameters * params = layer->parameters;
+        info->type = (int32_t) layer->type;
+        info->size = layer->size;
+        info->flags = layer->flags;
+        if (params != NULL) {
+            info->argc = params->count;
+            if (info->argc > PS_BINARY_MAX_ARGS) {
+                PSErr(func, "Layer %d has too many parameters!", i);
+                free(table);
+                return 0;
+            }
+            for (j = 0; j < info->argc; j++)
+                info->args[j] = params->parameters[j];
+        }
+        if (layer->weights == NULL || i == 0) continue;
+        int rows = getLayerWeightsRows(layer);
+        info->rows = rows;
+        info->weights_size = getLayerWeightsSize(layer);
+        info->weights_stride = layer->weights_stride;
+        offset = alignBinaryOffset(offset);
+        info->weights_offset = offset;
+        offset += (uint64_t) rows * layer->weights_stride * sizeof(ps_real);
+        offset = alignBinaryOffset(offset);
+        info->biases_offset = offset;
+        offset += (uint64_t) rows * sizeof(ps_real);
+        if (layer->type == LSTM) {
+            offset = alignBinaryOffset(offset);
+            info->cell_biases_offset = offset;
+            offset += (uint64_t) rows * 4 * sizeof(ps_real);
+        }
+    }
+    header.file_size = offset;
+    char tmpfile[strlen(filename) + 32];
+    if (log) printf("Saving network to %s\n", filename);
+    FILE * f = createNetworkFile(filename, tmpfile, "wb");
+    if (f == NULL) {
+        free(table);
+        return 0;
+    }
+    ok = (fwrite(&header, sizeof(header), 1, f) == 1);
+    ok = ok && (fwrite(table, sizeof(PSBinaryLayer), count, f) ==
+                (size_t) count);
+    for (i = 1; i < count && ok; i++) {
+        PSLayer * layer = network->layers[i];
+        PSBinaryLayer * info = table + i;
+        if (info->rows == 0) continue;
+        int rows = info->rows;
+        ok = (fseek(f, (long) info->weights_offset, SEEK_SET) == 0);
+        ok = ok && (fwrite(layer->weights, sizeof(ps_real),
+                           (size_t) rows * layer->weights_stride, f) ==
+                    (size_t) rows * layer->weights_stride);
+        ok = ok && (fseek(f, (long) info->biases_offset, SEEK_SET) == 0);
+        ok = ok && (fwrite(layer->biases, sizeof(ps_real), rows, f) ==
+                    (size_t) rows);
+        if (!ok || layer->type != LSTM) continue;
+        ok = (fseek(f, (long) info->cell_biases_offset, SEEK_SET) == 0);
+        for (j = 0; j < rows && ok; j++) {
+            PSLSTMCell * cell = GetLSTMCell(layer->neurons[j]);
+            assert(cell != NULL);
+            ps_real biases[4] = {
+                cell->candidate_bias, cell->input_bias,
+                cell->output_bias, cell->forget_bias
+            };
+            ok = (fwrite(biases, sizeof(ps_real), 4, f) == 4);
+        }
+    }
+    // Padding after the last array, if any
+    ok = ok && (fseek(f, 0, SEEK_END) == 0);
+    if (ok && (uint64_t) ftell(f) < header.file_size) {
+        ok = (fseek(f, (long) header.file_size - 1, SEEK_SET) == 0);
+        ok = ok && (fputc(0, f) != EOF);
+    }
+    free(table);
+    return closeNetworkFile(f, ok, tmpfile, filename, func);
+}
+
+int PSSaveNetworkBinary(PSNeuralNetwork * network, const char * filename) {
+    return saveNetworkBinary(network, filename, 1);
+}
+
+int PSLoadNetwork(PSNeuralNetwork * network, const char* filename) {
+    if (network == NULL) return 0;
+    if (isBinaryNetworkFile(filename)) {
+        printf("Loading network from %s\n", filename);
+        return loadBinaryNetwork(network, filename);
+    }
+    FILE * f = fopen(filename, "r");
+    printf("Loading network from %s\n", filename);
+    if (f == NULL) {
+        fprintf(stderr, "Cannot open %s!\n", filename);
+        return 0;
+    }
+    char * func = "PSLoadNetwork";
+    int netsize, i;
+    int empty = (network->size == 0);
+    char vers[20] = "0.0.0";
+    int v0 = 0, v1 = 0, v2 = 0;
+    int epochs = 0, batch_count = 0;
+    int matched = fscanf(f, "--v%d.%d.%d", &v0, &v1, &v2);
+    if (matched) {
+        sprintf(vers, "%d.%d.%d", v0, v1, v2);
+        printf("File version is %s (current: %s).\n", vers, PSYC_VERSION);
+        int idx = 0, val = 0;
+        PSLossFunction loss = NULL;
+        while ((matched = fscanf(f, ",%d", &val))) {
+            switch (idx++) {
+                case 0:
+                    network->flags |= val; break;
+                case 1:
+                    if ((size_t) val < loss_functions_count) {
+                        loss = loss_functions[val];
+                        network->loss = loss;
+                        printf("Loss Function: %s\n",getLossFunctionName(loss));
+                    }
+                    break;
+                case 2: epochs = val; break;
+                case 3: batch_count = val; break;
+                default:
+                    break;
+            }
+        }
+        fscanf(f, "\n");
+    }
+    matched = fscanf(f, "%d:", &netsize);
+    if (!matched) {
+        PSErr(func, "Invalid file %s!", filename);
+        fclose(f);
+        return 0;
+    }
+    if (!empty && network->size != netsize) {
+        PSErr(func, "Network size differs!");
+        fclose(f);
+        return 0;
+    }
+    char sep[] = ",";
+    char eol[] = "\n";
+    int min_argc = (compareVersion(vers, "0.0.0") == 1 ? 2 : 1);
+    PSLayer * layer = NULL;
+    for (i = 0; i < netsize; i++) {
+        int lsize = 0;
+        int lflags = 0;
+        PSLayerType ltype = FullyConnected;
+        double args[20];
+        int argc = 0, aidx = 0;
+        char * last = (i == (netsize - 1) ? eol : sep);
+        char fmt[50];
+        char buff[255];
+        sprintf(fmt, "%%d%s", last);
+        //fputs(fmt, stderr);
+        matched = fscanf(f, fmt, &lsize);
+        if (!matched) {
+            int type = 0, arg = 0;
+            argc = 0;
+            matched = fscanf(f, "[%d,%d", &type, &argc);
+            if (!matched) {
+                PSErr(func, "Invalid header: layer[%d], col. %ld!",
                       i, ftell(f));
                 fclose(f);
                 return 0;
@@ -694,154 +1683,35 @@ int PSLoadNetwork(PSNeuralNetwork * network, const char* filename) {
         }
         if (!empty) {
             layer = network->layers[i];
-            if (layer->size != lsize) {
-                PSErr(func, "Layer %d size %d differs from %d!", i,
-                      layer->size, lsize);
-                fclose(f);
-                return 0;
-            }
-            if (ltype != layer->type) {
-                PSErr(func, "Layer %d type %d differs from %d!", i,
-                      (int) (layer->type), (int) ltype);
+            if (!checkLoadedLayer(layer, ltype, lsize, args, argc)) {
                 fclose(f);
                 return 0;
             }
-            if (ltype == Convolutional || ltype == Pooling) {
-                PSLayerParameters * params = layer->parameters;
-                if (params == NULL) {
-                    PSErr(func, "Layer %d params are NULL!", i);
-                    fclose(f);
-                    return 0;
-                }
-                for (aidx = 0; aidx < argc; aidx++) {
-                    if (aidx >= params->count) break;
-                    int arg = args[aidx];
-                    double val = params->parameters[aidx];
-                    if (arg != (int) val) {
-                        PSErr(func, "Layer %d arg[%d] %d diff. from %d!",
-                              i, aidx,(int) val, arg);
-                        fclose(f);
-                        return 0;
-                    }
-                }
-            }
         } else {
-            layer = NULL;
-            PSLayerParameters * params = NULL;
-            if (ltype == Convolutional || ltype == Pooling) {
-                int param_c = CONV_PARAMETER_COUNT;
-                params = PSCreateLayerParamenters(param_c);
-                for (aidx = 0; aidx < argc; aidx++) {
-                    if (aidx >= param_c) break;
-                    int arg = args[aidx];
-                    params->parameters[aidx] = (double) arg;
-                }
-                layer = PSAddLayer(network, ltype, lsize, params);
-            } else {
-                if (network->size == 0 && (lflags & FLAG_ONEHOT) && argc > 0) {
-                    lsize = args[0];
-                    network->flags |= FLAG_ONEHOT;
-                } else if (argc > 0) {
-                    params = PSCreateLayerParamenters(argc);
-                    for (aidx = 0; aidx < argc; aidx++) {
-                        int arg = args[aidx];
-                        params->parameters[aidx] = (double) arg;
-                    }
-                }
-                layer = PSAddLayer(network, ltype, lsize, params);
-            }
+            layer = addLoadedLayer(network, ltype, lsize, lflags, args, argc);
             if (layer == NULL) {
-                PSErr(func, "Could not create layer %d", i);
-                fclose(f);
-                return 0;
-            }
-            layer->flags |= lflags;
-        }
-    }
-    for (i = 1; i < network->size; i++) {
-        layer = network->layers[i];
-        int lsize = 0;
-        PSSharedParams * shared = NULL;
-        if (layer->type == Convolutional) {
-            shared = getConvSharedParams(layer);
-            if (shared == NULL) {
-                PSErr(func, "Layer %d, missing shared params!", i);
-                fclose(f);
-                return 0;
-            }
-            lsize = shared->feature_count;
-        } else if (layer->type == Pooling) {
-            continue;
-        } else lsize = layer->size;
-        int is_lstm = (LSTM == layer->type);
-        for (j = 0; j < lsize; j++) {
-            double bias = 0;
-            int wsize = 0;
-            double * weights = NULL;
-            //LSTM biases
-            double cb = 0.0, ib = 0.0, ob = 0.0, fb = 0.0;
-            if (!is_lstm)
-                matched = fscanf(f, "%lf|", &bias);
-            else
-                matched = fscanf(f, "%lf,%lf,%lf,%lf|", &cb, &ib, &ob, &fb);
-            if (!matched) {
-                PSErr(func, "Layer %d, neuron %d: invalid bias!", i, j);
                 fclose(f);
                 return 0;
             }
-            if (shared == NULL) {
-                PSNeuron * neuron = layer->neurons[j];
-                wsize = neuron->weights_size;
-                neuron->bias = bias;
-                weights = neuron->weights;
-                if (is_lstm) {
-                    PSLSTMCell * cell = GetLSTMCell(neuron);
-                    assert(cell != NULL);
-                    cell->candidate_bias = cb;
-                    cell->input_bias = ib;
-                    cell->output_bias = ob;
-                    cell->forget_bias = fb;
-                }
-            } else {
-                shared->biases[j] = bias;
-                wsize = shared->weights_size;
-                weights = shared->weights[j];
-            }
-            for (k = 0; k < wsize; k++) {
-                double w = 0;
-                char * last = (k == (wsize - 1) ? eol : sep);
-                char fmt[5];
-                sprintf(fmt, "%%lf%s", last);
-                matched = fscanf(f, fmt, &w);
-                if (!matched) {
-                    PSErr(func,"Layer %d neuron %d: invalid weight[%d]",
-                          i, j, k);
-                    fclose(f);
-                    return 0;
-                }
-                weights[k] = w;
-                printf("\rLoading layer %d, neuron %d   ", i, j);
-                fflush(stdout);
-            }
         }
     }
-    printf("\n");
+    int ok = loadTextParameters(network, f);
     fclose(f);
-    return 1;
+    return ok;
 }
 
-int PSSaveNetwork(PSNeuralNetwork * network, const char* filename) {
+static int saveNetwork(PSNeuralNetwork * network, const char* filename,
+                       int log)
+{
     char * func = "saveNetwork";
     if (network->size == 0) {
         PSErr(func, "Empty network!");
         return 0;
     }
-    FILE * f = fopen(filename, "w");
-    printf("Saving network to %s\n", filename);
-    if (f == NULL) {
-        fprintf(stderr, "Cannot open %s for writing!\n", filename);
-        return 0;
-    }
+    char tmpfile[strlen(filename) + 32];
+    if (log) printf("Saving network to %s\n", filename);
+    FILE * f = createNetworkFile(filename, tmpfile, "w");
+    if (f == NULL) return 0;
     int i, j, k, loss_function = 0;
     // Header
     fprintf(f, "--v%s", PSYC_VERSION);
@@ -884,23 +1754,21 @@ int PSSaveNetwork(PSNeuralNetwork * network, const char* filename) {
             PSSharedParams * shared = getConvSharedParams(layer);
             if (shared == NULL) {
                 PSErr(func, "Layer[%d]: shared params are NULL!", i);
-                fclose(f);
-                return 0;
+                return closeNetworkFile(f, 0, tmpfile, filename, func);
             }
             int feature_count = shared->feature_count;
             if (feature_count < 1) {
                 PSErr(func, "Layer[%d]: feature count must be >= 1!", i);
-                fclose(f);
-                return 0;
+                return closeNetworkFile(f, 0, tmpfile, filename, func);
             }
             for (j = 0; j < feature_count; j++) {
-                double bias = shared->biases[j];
-                double * weights = shared->weights[j];
-                fprintf(f, "%.15e|", bias);
+                ps_real bias = shared->biases[j];
+                ps_real * weights = shared->weights[j];
+                fprintf(f, PS_REAL_FMT "|", bias);
                 for (k = 0; k < shared->weights_size; k++) {
                     if (k > 0) fprintf(f, ",");
-                    double w = weights[k];
-                    fprintf(f, "%.15e", w);
+                    ps_real w = weights[k];
+                    fprintf(f, PS_REAL_FMT, w);
                 }
                 fprintf(f, "\n");
             }
@@ -911,11 +1779,12 @@ int PSSaveNetwork(PSNeuralNetwork * network, const char* filename) {
             for (j = 0; j < lsize; j++) {
                 PSNeuron * neuron = layer->neurons[j];
                 if (!is_lstm)
-                    fprintf(f, "%.15e|", neuron->bias);
+                    fprintf(f, PS_REAL_FMT "|", *(neuron->bias));
                 else {
                     PSLSTMCell * cell = GetLSTMCell(neuron);
                     assert(cell != NULL);
-                    fprintf(f, "%.15e,%.15e,%.15e,%.15e|",
+                    fprintf(f, PS_REAL_FMT "," PS_REAL_FMT "," PS_REAL_FMT ","
+                            PS_REAL_FMT "|",
                             cell->candidate_bias,
                             cell->input_bias,
                             cell->output_bias,
@@ -923,49 +1792,62 @@ int PSSaveNetwork(PSNeuralNetwork * network, const char* filename) {
                 }
                 for (k = 0; k < neuron->weights_size; k++) {
                     if (k > 0) fprintf(f, ",");
-                    double w = neuron->weights[k];
-                    fprintf(f, "%.15e", w);
+                    ps_real w = neuron->weights[k];
+                    fprintf(f, PS_REAL_FMT, w);
                 }
                 fprintf(f, "\n");
             }
         }
     }
-    fclose(f);
-    return 1;
+    return closeNetworkFile(f, 1, tmpfile, filename, func);
+}
+
+int PSSaveNetwork(PSNeuralNetwork * network, const char* filename) {
+    return saveNetwork(network, filename, 1);
 }
 
 void PSDeleteNetwork(PSNeuralNetwork * network) {
     int size = network->size;
     int i, is_recurrent = (network->flags & FLAG_RECURRENT);
+    if (network->gradients != NULL)
+        PSDeleteGradients(network->gradients, network);
     for (i = 0; i < size; i++) {
         PSLayer * layer = network->layers[i];
         if (is_recurrent) layer->flags |= FLAG_RECURRENT;
+        if (isMappedTensor(network, layer->weights))
+            unshareLayerParameters(layer);
         PSDeleteLayer(layer);
     }
+    if (network->mapping != NULL)
+        munmap(network->mapping, network->mapping_size);
     free(network->layers);
     free(network);
 }
 
 void PSDeleteNeuron(PSNeuron * neuron, PSLayer * layer) {
-    if (neuron->weights != NULL) free(neuron->weights);
+    // Weights are owned by the layer tensor unless the neuron has its own.
+    if (neuron->weights != NULL && layer->weights == NULL)
+        free(neuron->weights);
     if (neuron->extra != NULL) {
         if (layer->flags & FLAG_RECURRENT) {
             if (layer->type == LSTM)
                 PSDeleteLSTMCell(GetLSTMCell(neuron));
-            else {
-                PSRecurrentCell * cell = GetRecurrentCell(neuron);
-                if (cell->states != NULL) free(cell->states);
-                free(cell);
-            }
+            else free(GetRecurrentCell(neuron));
         } else free(neuron->extra);
     }
     free(neuron);
 }
 
-PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
-                     PSLayerParameters* params) {
+static PSLayer * addLayer(PSNeuralNetwork * network, PSLayerType type,
+                          int size, PSLayerParameters* params, int log)
+{
     if (network == NULL) return NULL;
     char * func = "PSAddLayer";
+    if (network->gradients != NULL) {
+        // The gradients workspace no longer matches the network's layout
+        PSDeleteGradients(network->gradients, network);
+        network->gradients = NULL;
+    }
     if (network->size == 0 && type != FullyConnected) {
         PSErr(func, "First layer type must be FullyConnected");
         return NULL;
@@ -983,9 +1865,13 @@ PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
     layer->extra = NULL;
     layer->flags = FLAG_NONE;
     layer->delta = NULL;
-#ifdef USE_AVX
-    layer->avx_activation_cache = NULL;
-#endif
+    layer->neurons = NULL;
+    layer->state_arena = NULL;
+    layer->weights = NULL;
+    layer->biases = NULL;
+    layer->activations = NULL;
+    layer->z_values = NULL;
+    layer->weights_stride = 0;
     PSLayer * previous = NULL;
     int previous_size = 0;
     int initialized = 0;
@@ -1040,20 +1926,18 @@ PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
         return NULL;
     }
     if (type == FullyConnected || type == SoftMax) {
-        layer->neurons = malloc(sizeof(PSNeuron*) * size);
+        layer->neurons = calloc(size, sizeof(PSNeuron*));
         if (layer->neurons == NULL) {
             PSErr(func, "Layer[%d]: could not allocate neurons!", layer->index);
             PSAbortLayer(network, layer);
             return NULL;
         }
-#ifdef USE_AVX
-        layer->avx_activation_cache = calloc(size, sizeof(double));
-        if (layer->avx_activation_cache == NULL) {
+        int ws = (layer->index > 0 ? previous_size : 0);
+        if (!PSInitLayerTensors(layer, size, ws)) {
             printMemoryErrorMsg();
             PSAbortLayer(network, layer);
             return NULL;
         }
-#endif
         int i, j;
         for (i = 0; i < size; i++) {
             PSNeuron * neuron = malloc(sizeof(PSNeuron));
@@ -1066,13 +1950,14 @@ PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
             neuron->extra = NULL;
             if (layer->index > 0) {
                 neuron->weights_size = previous_size;
-                neuron->bias = gaussian_random(0, 1);
-                neuron->weights = malloc(sizeof(double) * previous_size);
+                neuron->bias = layer->biases + i;
+                *(neuron->bias) = gaussian_random(0, 1);
+                neuron->weights = layer->weights + (i * layer->weights_stride);
                 for (j = 0; j < previous_size; j++) {
                     neuron->weights[j] = gaussian_random(0, 1);
                 }
             } else {
-                neuron->bias = 0;
+                neuron->bias = NULL;
                 neuron->weights_size = 0;
                 neuron->weights = NULL;
             }
@@ -1111,7 +1996,7 @@ PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
     if (layer->index > 0) {
         int dsize = layer->size;
         if (type == LSTM) dsize *= 2;
-        layer->delta = calloc(dsize, sizeof(double));
+        layer->delta = calloc(dsize, sizeof(ps_real));
         if (layer->delta == NULL) {
             PSAbortLayer(network, layer);
             printMemoryErrorMsg();
@@ -1120,11 +2005,16 @@ PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
         }
     }
     network->layers[layer->index] = layer;
-    printLayerInfo(layer);
+    if (log) printLayerInfo(layer);
     return layer;
 }
 
-PSLayer * PSAddConvolutionalLayer(PSNeuralNetwork * network,
+PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
+                     PSLayerParameters* params) {
+    return addLayer(network, type, size, params, 1);
+}
+
+PSLayer * PSAddConvolutionalLayer(PSNeuralNetwork * network,
                                   PSLayerParameters* params)
 {
     return PSAddLayer(network, Convolutional, 0, params);
@@ -1139,8 +2029,9 @@ PSLayer * PSAddPoolingLayer(PSNeuralNetwork * network,
 void PSDeleteLayer(PSLayer* layer) {
     int size = layer->size;
     int i;
-    for (i = 0; i < size; i++) {
+    for (i = 0; layer->neurons != NULL && i < size; i++) {
         PSNeuron* neuron = layer->neurons[i];
+        if (neuron == NULL) continue;
         if (layer->type != Convolutional)
             PSDeleteNeuron(neuron, layer);
         else
@@ -1153,20 +2044,17 @@ void PSDeleteLayer(PSLayer* layer) {
     if (extra != NULL) {
         if (layer->type == Convolutional) {
             PSSharedParams * shared = (PSSharedParams*) extra;
-            int fc = shared->feature_count;
-            //int ws = shared->weights_size;
-            if (shared->biases != NULL) free(shared->biases);
-            if (shared->weights != NULL) {
-                int i;
-                for (i = 0; i < fc; i++) free(shared->weights[i]);
-                free(shared->weights);
-            }
+            // Shared biases and weights rows live in the layer tensors
+            if (shared->weights != NULL) free(shared->weights);
+            if (shared->workspace != NULL) free(shared->workspace);
             free(extra);
         } else free(extra);
     }
-#ifdef USE_AVX
-    if (layer->avx_activation_cache != NULL) free(layer->avx_activation_cache);
-#endif
+    PSDeleteStateArena(GetStateArena(layer));
+    if (layer->weights != NULL) free(layer->weights);
+    if (layer->biases != NULL) free(layer->biases);
+    if (layer->activations != NULL) free(layer->activations);
+    if (layer->z_values != NULL) free(layer->z_values);
     if (layer->delta != NULL) free(layer->delta);
     free(layer);
 }
@@ -1246,43 +2134,72 @@ void PSDeleteLayerParamenters(PSLayerParameters * params) {
     free(params);
 }
 
-int feedforwardThroughTime(PSNeuralNetwork * network, double * values,
+/* The inputs of the layer following the input layer are known for all of
+ * the steps before the sequence starts, so their products with its input
+ * weights are computed at once (the products of the deeper layers depend
+ * on the states of the previous layers at every step). */
+static PSLayer * projectInputs(PSNeuralNetwork * network, ps_real * values,
+                               int times, int * ok)
+{
+    *ok = 1;
+    if (network->size < 2 || (network->layers[0]->flags & FLAG_ONEHOT))
+        return NULL;
+    PSLayer * layer = network->layers[1];
+    if (layer == NULL) return NULL;
+    if (layer->type == Recurrent)
+        *ok = PSRecurrentProjectInputs(layer, values, times);
+    else if (layer->type == LSTM)
+        *ok = PSLSTMProjectInputs(layer, values, times);
+    else return NULL;
+    return layer;
+}
+
+int feedforwardThroughTime(PSNeuralNetwork * network, ps_real * values,
                            int times)
 {
     if (network == NULL) return 0;
     PSLayer * first = network->layers[0];
     int input_size = first->size;
     char * func = "feedforwardThroughTime";
-    int i, t;
-    for (t = 0; t < times; t++) {
+    int i, t, ok = 1;
+    PSLayer * projected = projectInputs(network, values, times, &ok);
+    if (!ok) {
+        PSErr(func, "Failed to project inputs!");
+        return 0;
+    }
+    for (t = 0; t < times && ok; t++) {
         for (i = 0; i < input_size; i++) {
             PSNeuron * neuron = first->neurons[i];
             neuron->activation = values[i];
-            PSAddRecurrentState(neuron, values[i], times, t);
-            if (neuron->extra == NULL) {
-                PSErr(func, "Failed to allocate Recurrent Cell!");
-                return 0;
-            }
+            first->activations[i] = values[i];
+        }
+        if (PSAddRecurrentStates(first, values, times, t) == NULL) {
+            PSErr(func, "Failed to allocate recurrent states!");
+            ok = 0;
+            break;
         }
         for (i = 1; i < network->size; i++) {
             PSLayer * layer = network->layers[i];
             if (layer == NULL) {
                 PSErr(func, "Layer %d is NULL", i);
-                return 0;
+                ok = 0;
+                break;
             }
             if (layer->feedforward == NULL) {
                 PSErr(func, "Layer %d feedforward function is NULL", i);
-                return 0;
+                ok = 0;
+                break;
             }
-            int ok = layer->feedforward(network, layer, times, t);
-            if (!ok) return 0;
+            ok = layer->feedforward(network, layer, times, t);
+            if (!ok) break;
         }
         values += input_size;
     }
-    return 1;
+    if (projected != NULL) GetStateArena(projected)->projected = 0;
+    return ok;
 }
 
-int PSFeedforward(PSNeuralNetwork * network, double * values) {
+int PSFeedforward(PSNeuralNetwork * network, ps_real * values) {
     if (network == NULL) return 0;
     char * func = "PSFeedforward";
     if (network->size == 0) {
@@ -1300,12 +2217,9 @@ int PSFeedforward(PSNeuralNetwork * network, double * values) {
     PSLayer * first = network->layers[0];
     int input_size = first->size;
     int i;
-    for (i = 0; i < input_size; i++) {
+    memcpy(first->activations, values, input_size * sizeof(ps_real));
+    for (i = 0; i < input_size; i++)
         first->neurons[i]->activation = values[i];
-#ifdef USE_AVX
-        first->avx_activation_cache[i] = values[i];
-#endif
-    }
     for (i = 1; i < network->size; i++) {
         PSLayer * layer = network->layers[i];
         if (layer == NULL) {
@@ -1322,6 +2236,239 @@ int PSFeedforward(PSNeuralNetwork * network, double * values) {
     return 1;
 }
 
+static void softmaxActivateRow(ps_real * row, int size) {
+    ps_real max = row[0], esum = 0.0;
+    int i;
+    for (i = 1; i < size; i++)
+        if (row[i] > max) max = row[i];
+    for (i = 0; i < size; i++) {
+        row[i] = exp(row[i] - max);
+        esum += row[i];
+    }
+    for (i = 0; i < size; i++) row[i] /= esum;
+}
+
+static ps_real * feedforwardBatchChunk(PSInferenceContext * context,
+                                      ps_real * values, int count,
+                                      int values_stride)
+{
+    char * func = "feedforwardBatch";
+    PSNeuralNetwork * network = context->network;
+    PSLayer * first = network->layers[0];
+    ps_real * inputs = context->buffers[0], * outputs = context->buffers[1];
+    ps_real * tmp;
+    int i, j, l, input_size = first->size;
+    int buffer_stride = context->buffer_stride;
+    for (i = 0; i < count; i++) {
+        memcpy(inputs + (i * buffer_stride), values + (i * values_stride),
+               input_size * sizeof(ps_real));
+    }
+    for (l = 1; l < network->size; l++) {
+        PSLayer * layer = network->layers[l];
+        if (layer == NULL) {
+            PSErr(func, "Layer %d is NULL!", l);
+            return NULL;
+        }
+        PSLayer * previous = network->layers[l - 1];
+        int size = layer->size, previous_size = previous->size;
+        if (layer->feedforward == fullFeedforward ||
+            layer->feedforward == softmaxFeedforward)
+        {
+            // The whole chunk goes through the layer as a single
+            // matrix-matrix product, so every weights row is reused across
+            // all the samples instead of being reloaded for each of them.
+            PSGemmNT(count, size, previous_size, inputs, buffer_stride,
+                     layer->weights, layer->weights_stride,
+                     outputs, buffer_stride, PS_GEMM_STORE);
+            for (i = 0; i < count; i++) {
+                ps_real * row = outputs + (i * buffer_stride);
+                for (j = 0; j < size; j++) row[j] += layer->biases[j];
+                if (layer->feedforward == softmaxFeedforward)
+                    softmaxActivateRow(row, size);
+                else {
+                    for (j = 0; j < size; j++)
+                        row[j] = layer->activate(row[j]);
+                }
+            }
+        } else if (layer->feedforward == PSConvolve) {
+            if (!PSConvolveBatch(network, layer, inputs, buffer_stride,
+                                 outputs, buffer_stride, count,
+                                 context->workspace)) return NULL;
+        } else if (layer->feedforward == PSPool) {
+            if (!PSPoolBatch(network, layer, inputs, buffer_stride,
+                             outputs, buffer_stride, count)) return NULL;
+        } else {
+            PSErr(func, "Layer %d type is not supported", l);
+            return NULL;
+        }
+        tmp = inputs;
+        inputs = outputs;
+        outputs = tmp;
+    }
+    return inputs;
+}
+
+static PSInferenceContext * createInferenceContext(PSNeuralNetwork * network,
+                                                   int batch_size)
+{
+    char * func = "PSCreateInferenceContext";
+    if (network->size == 0) {
+        PSErr(func, "Empty network!");
+        return NULL;
+    }
+    if (network->flags & FLAG_RECURRENT) {
+        PSErr(func, "Inference contexts are not supported by recurrent "
+                    "networks");
+        return NULL;
+    }
+    int i, buffer_stride = 0, workspace_size = 0;
+    for (i = 0; i < network->size; i++) {
+        PSLayer * layer = network->layers[i];
+        if (layer == NULL) {
+            PSErr(func, "Layer %d is NULL!", i);
+            return NULL;
+        }
+        int stride = getTensorStride(layer->size);
+        if (stride > buffer_stride) buffer_stride = stride;
+        if (layer->type == Convolutional) {
+            int size = PSGetConvBatchWorkspaceSize(layer, batch_size);
+            if (size > workspace_size) workspace_size = size;
+        }
+    }
+    PSInferenceContext * context = calloc(1, sizeof(PSInferenceContext));
+    if (context == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    context->network = network;
+    context->batch_size = batch_size;
+    context->buffer_stride = buffer_stride;
+    context->buffers[0] = PSCreateTensor(batch_size * buffer_stride);
+    context->buffers[1] = PSCreateTensor(batch_size * buffer_stride);
+    if (workspace_size > 0)
+        context->workspace = PSCreateTensor(workspace_size);
+    if (context->buffers[0] == NULL || context->buffers[1] == NULL ||
+        (workspace_size > 0 && context->workspace == NULL))
+    {
+        printMemoryErrorMsg();
+        PSDeleteInferenceContext(context);
+        return NULL;
+    }
+    return context;
+}
+
+PSInferenceContext * PSCreateInferenceContext(PSNeuralNetwork * network) {
+    if (network == NULL) return NULL;
+    return createInferenceContext(network, 1);
+}
+
+void PSDeleteInferenceContext(PSInferenceContext * context) {
+    if (context == NULL) return;
+    if (context->buffers[0] != NULL) free(context->buffers[0]);
+    if (context->buffers[1] != NULL) free(context->buffers[1]);
+    if (context->workspace != NULL) free(context->workspace);
+    free(context);
+}
+
+int PSContextFeedforward(PSInferenceContext * context, ps_real * values) {
+    if (context == NULL) return 0;
+    PSNeuralNetwork * network = context->network;
+    context->outputs = feedforwardBatchChunk(context, values, 1,
+                                             network->input_size);
+    return (context->outputs != NULL);
+}
+
+int PSContextClassify(PSInferenceContext * context, ps_real * values) {
+    if (!PSContextFeedforward(context, values)) return -1;
+    ps_real * outputs = context->outputs, max = 0.0;
+    int i, max_idx = 0;
+    for (i = 0; i < context->network->output_size; i++) {
+        if (outputs[i] > max) {
+            max = outputs[i];
+            max_idx = i;
+        }
+    }
+    return max_idx;
+}
+
+/* Feedforward 'count' samples starting at 'values' (each one 'values_stride'
+ * numbers apart). Every sample's output layer activations are copied into
+ * 'outputs' and/or its predicted class is stored into 'results' (either of
+ * them can be NULL). Since a temporary context is used, the network is only
+ * read. */
+static int feedforwardBatch(PSNeuralNetwork * network, ps_real * values,
+                            int count, int values_stride, ps_real * outputs,
+                            int * results)
+{
+    int i, j, k, ok = 1;
+    int output_size = network->output_size;
+    int chunk_size = PS_BATCH_CHUNK_SIZE;
+    if (count < chunk_size) chunk_size = count;
+    PSInferenceContext * context = createInferenceContext(network,
+                                                          chunk_size);
+    if (context == NULL) return 0;
+    int buffer_stride = context->buffer_stride;
+    for (i = 0; i < count; i += chunk_size) {
+        int n = count - i;
+        if (n > chunk_size) n = chunk_size;
+        ps_real * out = feedforwardBatchChunk(context, values, n,
+                                             values_stride);
+        if (out == NULL) {
+            ok = 0;
+            break;
+        }
+        for (j = 0; j < n; j++) {
+            ps_real * row = out + (j * buffer_stride);
+            if (outputs != NULL) {
+                memcpy(outputs, row, output_size * sizeof(ps_real));
+                outputs += output_size;
+            }
+            if (results != NULL) {
+                ps_real max = 0.0;
+                int max_idx = 0;
+                for (k = 0; k < output_size; k++) {
+                    if (row[k] > max) {
+                        max = row[k];
+                        max_idx = k;
+                    }
+                }
+                *(results++) = max_idx;
+            }
+        }
+        values += (n * values_stride);
+    }
+    PSDeleteInferenceContext(context);
+    return ok;
+}
+
+int PSFeedforwardBatch(PSNeuralNetwork * network, ps_real * values, int count,
+                       ps_real * outputs)
+{
+    if (network == NULL || count <= 0) return 0;
+    return feedforwardBatch(network, values, count, network->input_size,
+                            outputs, NULL);
+}
+
+int PSClassifyBatch(PSNeuralNetwork * network, ps_real * values, int count,
+                    int * results)
+{
+    if (network == NULL || count <= 0) return 0;
+    return feedforwardBatch(network, values, count, network->input_size,
+                            NULL, results);
+}
+
+static int getLayerGradientSize(PSLayer * layer) {
+    if (layer->type == Pooling) return 0;
+    if (layer->type == Convolutional) {
+        PSLayerParameters * parameters = layer->parameters;
+        int region_size = (int) (parameters->parameters[PARAM_REGION_SIZE]);
+        return region_size * region_size;
+    }
+    int ws = layer->neurons[0]->weights_size;
+    if (layer->type == LSTM) ws += 4; // Make room for LSTM biases
+    return ws;
+}
+
 PSGradient * createLayerGradients(PSLayer * layer) {
     if (layer == NULL) return NULL;
     PSGradient * gradients;
@@ -1343,33 +2490,41 @@ PSGradient * createLayerGradients(PSLayer * layer) {
         PSErr(func, "Could not allocate memory!");
         return NULL;
     }
-    int i, ws = 0;
+    // All the weight gradients of a layer share a single contiguous block
+    // laid out like the layer's weights matrix, so that it can be cleared
+    // and reduced in bulk.
+    int i, stride = getTensorStride(getLayerGradientSize(layer));
+    ps_real * block = PSCreateTensor(size * stride);
+    if (block == NULL) {
+        PSErr(func, "Could not allocate memory!");
+        free(gradients);
+        return NULL;
+    }
     for (i = 0; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        if (ltype == Convolutional) {
-            if (!ws) {
-                int region_size =
-                    (int) (parameters->parameters[PARAM_REGION_SIZE]);
-                ws = region_size * region_size;
-            }
-        } else {
-            ws = neuron->weights_size;
-            if (ltype == LSTM) ws += 4; // Make room for LSTM biases
-        }
         gradients[i].bias = 0;
-        int memsize = sizeof(double) * ws;
-        gradients[i].weights = malloc(memsize);
-        if (gradients[i].weights == NULL) {
-            PSErr(func, "Could not allocate memory!");
-            PSDeleteLayerGradients(gradients, size);
-            return NULL;
-        }
-        memset(gradients[i].weights, 0, memsize);
+        gradients[i].weights = block + (i * stride);
     }
     return gradients;
 }
 
-int PSClassify(PSNeuralNetwork * network, double * values) {
+static void clearLayerGradients(PSLayer * layer, PSGradient * lgradients) {
+    int size = getLayerWeightsRows(layer), i;
+    int stride = getTensorStride(getLayerGradientSize(layer));
+    memset(lgradients[0].weights, 0, size * stride * sizeof(ps_real));
+    for (i = 0; i < size; i++) lgradients[i].bias = 0;
+}
+
+static void clearGradients(PSNeuralNetwork * network, PSGradient ** gradients)
+{
+    int i;
+    for (i = 1; i < network->size; i++) {
+        PSGradient * lgradients = gradients[i - 1];
+        if (lgradients == NULL) continue;
+        clearLayerGradients(network->layers[i], lgradients);
+    }
+}
+
+int PSClassify(PSNeuralNetwork * network, ps_real * values) {
     int ok = PSFeedforward(network, values);
     if (!ok) {
         PSErr("PSClassify", "Feedforward failed");
@@ -1377,10 +2532,10 @@ int PSClassify(PSNeuralNetwork * network, double * values) {
     };
     int netsize = network->size, outsize = network->output_size, i;
     PSLayer * out = network->layers[netsize - 1];
-    double max = 0.0;
+    ps_real max = 0.0;
     int max_idx = 0;
     for (i = 0; i < outsize; i++) {
-        double a = out->neurons[i]->activation;
+        ps_real a = out->activations[i];
         if (a > max) {
             max = a;
             max_idx = i;
@@ -1391,7 +2546,7 @@ int PSClassify(PSNeuralNetwork * network, double * values) {
 
 PSGradient ** createGradients(PSNeuralNetwork * network) {
     if (network == NULL) return NULL;
-    PSGradient ** gradients = malloc(sizeof(PSGradient*) * network->size - 1);
+    PSGradient ** gradients = calloc(network->size, sizeof(PSGradient*));
     if (gradients == NULL) {
         printMemoryErrorMsg();
         return NULL;
@@ -1411,11 +2566,7 @@ PSGradient ** createGradients(PSNeuralNetwork * network) {
 }
 
 void PSDeleteLayerGradients(PSGradient * gradient, int size) {
-    int i;
-    for (i = 0; i < size; i++) {
-        PSGradient g = gradient[i];
-        free(g.weights);
-    }
+    if (size > 0) free(gradient[0].weights);
     free(gradient);
 }
 
@@ -1435,38 +2586,54 @@ void PSDeleteGradients(PSGradient ** gradients, PSNeuralNetwork * network) {
     free(gradients);
 }
 
-PSGradient ** backprop(PSNeuralNetwork * network, double * x, double * y) {
-    if (network == NULL) return NULL;
-    PSGradient ** gradients = createGradients(network);
-    if (gradients == NULL) return NULL;
+static PSGradient ** getGradientsWorkspace(PSNeuralNetwork * network) {
+    if (network->gradients == NULL)
+        network->gradients = createGradients(network);
+    else
+        clearGradients(network, network->gradients);
+    return network->gradients;
+}
+
+/* Adds the outer product between the layer's deltas and the previous
+ * layer's activations to the layer's weight gradients. */
+static void accumulateLayerGradients(PSLayer * layer, PSLayer * previous,
+                                     ps_real * delta, PSGradient * lgradients)
+{
+    int size = layer->size, i;
+    int stride = getTensorStride(getLayerGradientSize(layer));
+    for (i = 0; i < size; i++) lgradients[i].bias += delta[i];
+    PSGemmTN(size, previous->size, 1, delta, size, previous->activations,
+             previous->size, lgradients[0].weights, stride, PS_GEMM_ADD);
+}
+
+static int accumulateBackprop(PSNeuralNetwork * network, ps_real * x,
+                              ps_real * y, PSGradient ** gradients)
+{
     int netsize = network->size;
     PSLayer * outputLayer = network->layers[netsize - 1];
     int osize = outputLayer->size;
     PSGradient * lgradients = gradients[netsize - 2]; //No gradient for inputs
     PSLayer * previousLayer = network->layers[outputLayer->index - 1];
     PSLayer * nextLayer = NULL;
-    double * delta = outputLayer->delta;
-    double * last_delta = delta;
+    ps_real * delta = outputLayer->delta;
+    ps_real * last_delta = delta;
 
-    int i, o, w, j, ok = 1;
+    int i, o, ok = 1;
     if (x != NULL) {
         ok = PSFeedforward(network, x);
-        if (!ok) {
-            PSDeleteGradients(gradients, network);
-            return NULL;
-        }
+        if (!ok) return 0;
     }
     int apply_derivative = shouldApplyDerivative(network);
-    double softmax_sum = 0.0;
+    ps_real softmax_sum = 0.0;
+    ps_real * outputs = outputLayer->activations;
     for (o = 0; o < osize; o++) {
-        PSNeuron * neuron = outputLayer->neurons[o];
-        double o_val = neuron->activation;
-        double y_val = y[o];
-        double d = 0.0;
+        ps_real o_val = outputs[o];
+        ps_real y_val = y[o];
+        ps_real d = 0.0;
         if (outputLayer->type != SoftMax) {
             d = o_val - y_val;
             if (apply_derivative)
-                d *= outputLayer->derivative(neuron->activation);
+                d *= outputLayer->derivative(o_val);
         } else {
             y_val = (y_val < 1 ? 0 : 1);
             d = -(y_val - o_val);
@@ -1474,80 +2641,29 @@ PSGradient ** backprop(PSNeuralNetwork * network, double * x, double * y) {
             softmax_sum += d;
         }
         delta[o] = d;
-        if (outputLayer->type != SoftMax) {
-            PSGradient * gradient = &(lgradients[o]);
-            gradient->bias = d;
-            int wsize = neuron->weights_size;
-            w = 0;
-#ifdef USE_AVX
-            AVXMultiplyValue(wsize, previousLayer->avx_activation_cache, d,
-                             gradient->weights, w, 0, 0, 0);
-#endif
-            for (; w < wsize; w++) {
-                double prev_a = previousLayer->neurons[w]->activation;
-                gradient->weights[w] = d * prev_a;
-            }
-        }
     }
-    if (outputLayer->type == SoftMax) {
-        for (o = 0; o < osize; o++) {
-            PSNeuron * neuron = outputLayer->neurons[o];
-            double o_val = neuron->activation;
-            if (apply_derivative) delta[o] -= (o_val * softmax_sum);
-            double d = delta[o];
-            PSGradient * gradient = &(lgradients[o]);
-            gradient->bias = d;
-            int wsize = neuron->weights_size;
-            w = 0;
-#ifdef USE_AVX
-            AVXMultiplyValue(wsize, previousLayer->avx_activation_cache, d,
-                             gradient->weights, w, 0, 0, 0);
-#endif
-            for (; w < wsize; w++) {
-                double prev_a = previousLayer->neurons[w]->activation;
-                gradient->weights[w] = d * prev_a;
-            }
-        }
+    if (outputLayer->type == SoftMax && apply_derivative) {
+        for (o = 0; o < osize; o++)
+            delta[o] -= (outputs[o] * softmax_sum);
     }
+    accumulateLayerGradients(outputLayer, previousLayer, delta, lgradients);
     for (i = previousLayer->index; i > 0; i--) {
         PSLayer * layer = network->layers[i];
         previousLayer = network->layers[i - 1];
         nextLayer = network->layers[i + 1];
         lgradients = gradients[i - 1];
-        int lsize = layer->size;
         PSLayerType ltype = layer->type;
         PSLayerType prev_ltype = previousLayer->type;
         if (FullyConnected == ltype) {
             delta = layer->delta;
-            for (j = 0; j < lsize; j++) {
-                PSNeuron * neuron = layer->neurons[j];
-                double d = getDeltaForNeuron(neuron, layer,
-                                             nextLayer, last_delta);
-                delta[j] = d;
-                PSGradient * gradient = &(lgradients[j]);
-                gradient->bias = delta[j];
-                w = 0;
-                int wsize = neuron->weights_size;
-#ifdef USE_AVX
-                AVXMultiplyValue(wsize, previousLayer->avx_activation_cache, d,
-                                 gradient->weights, w, 0, 0, 0);
-#endif
-                for (; w < wsize; w++) {
-                    double prev_a = previousLayer->neurons[w]->activation;
-                    gradient->weights[w] = d * prev_a;
-                }
-            }
+            getLayerDeltas(layer, nextLayer, last_delta, delta);
+            accumulateLayerGradients(layer, previousLayer, delta, lgradients);
         } else if (Pooling == ltype && Convolutional == prev_ltype) {
             delta = layer->delta;
-            PSGetDeltaFunction _getDelta = NULL;
             if (nextLayer->type == Convolutional)
-                _getDelta = getDeltaForConvolutionalNeuron;
-            else
-                _getDelta = getDeltaForNeuron;
-            for (j = 0; j < lsize; j++) {
-                PSNeuron * neuron = layer->neurons[j];
-                delta[j] = _getDelta(neuron, layer, nextLayer, last_delta);
-            }
+                getConvolutionalLayerDeltas(layer, nextLayer, last_delta,
+                                            delta);
+            else getLayerDeltas(layer, nextLayer, last_delta, delta);
             last_delta = delta;
             PSPoolingBackprop(layer, previousLayer, last_delta);
         } else if (Convolutional == ltype) {
@@ -1556,28 +2672,35 @@ PSGradient ** backprop(PSNeuralNetwork * network, double * x, double * y) {
             fprintf(stderr, "Backprop from %s to %s not suported!\n",
                     PSGetLayerTypeLabel(layer),
                     PSGetLayerTypeLabel(previousLayer));
-            PSDeleteGradients(gradients, network);
-            return NULL;
+            return 0;
         }
         if (last_delta != delta) last_delta = delta;
     }
-    return gradients;
+    return 1;
 }
 
-PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
-                                  double * y, int times)
-{
+PSGradient ** backprop(PSNeuralNetwork * network, ps_real * x, ps_real * y) {
     if (network == NULL) return NULL;
     PSGradient ** gradients = createGradients(network);
     if (gradients == NULL) return NULL;
+    if (!accumulateBackprop(network, x, y, gradients)) {
+        PSDeleteGradients(gradients, network);
+        return NULL;
+    }
+    return gradients;
+}
+
+static int accumulateBackpropThroughTime(PSNeuralNetwork * network,
+                                         ps_real * x, ps_real * y, int times,
+                                         PSGradient ** gradients)
+{
     int netsize = network->size;
     PSLayer * outputLayer = network->layers[netsize - 1];
     if (outputLayer->type != SoftMax) {
         PSErr("backpropThroughTime",
               "Recurrent networks require a Softmax output layer, "
               "current one is of type %s.", PSGetLayerTypeLabel(outputLayer));
-        PSDeleteGradients(gradients, network);
-        return NULL;
+        return 0;
     }
     int onehot = (outputLayer->flags & FLAG_ONEHOT);
     int osize = outputLayer->size;
@@ -1585,14 +2708,11 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
 
     int i, o, w, j, k, t;
     int ok = feedforwardThroughTime(network, x, times);
-    if (!ok) {
-        PSDeleteGradients(gradients, network);
-        return NULL;
-    }
+    if (!ok) return 0;
     
     int last_t = times - 1;
-    double * delta;
-    double * last_delta;
+    ps_real * delta;
+    ps_real * last_delta;
     for (t = last_t; t >= 0; t--) {
         int lowest_t = t - bptt_truncate;
         if (lowest_t < 0) lowest_t = 0;
@@ -1600,7 +2720,7 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
         PSLayer * nextLayer = NULL;
         int ysize = (onehot ? 1 : osize);
         int time_offset = t * ysize;
-        double * time_y = y + time_offset;
+        ps_real * time_y = y + time_offset;
         
         PSGradient * lgradients =
         gradients[netsize - 2];// No grad.for inputs
@@ -1610,19 +2730,17 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
         delta = outputLayer->delta;
         last_delta = delta;
         
-        double softmax_sum = 0.0;
+        ps_real softmax_sum = 0.0;
         int apply_derivative = shouldApplyDerivative(network);
         // Calculate output deltas, output layer must be Softmax
         for (o = 0; o < osize; o++) {
-            PSNeuron * neuron = outputLayer->neurons[o];
-            PSRecurrentCell * cell = GetRecurrentCell(neuron);
-            double o_val = cell->states[t];
-            double y_val;
+            ps_real o_val = GetLayerState(outputLayer, o, t);
+            ps_real y_val;
             if (onehot)
                 y_val = ((int) *(time_y) == o);
             else
                 y_val = time_y[o];
-            double d = 0.0;
+            ps_real d = 0.0;
             y_val = (y_val < 1 ? 0 : 1);
             d = -(y_val - o_val);
             if (apply_derivative) d *= o_val;
@@ -1632,23 +2750,20 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
         // Update gradients for output layer
         for (o = 0; o < osize; o++) {
             PSNeuron * neuron = outputLayer->neurons[o];
-            PSRecurrentCell * cell = GetRecurrentCell(neuron);
-            double o_val = cell->states[t];
+            ps_real o_val = GetLayerState(outputLayer, o, t);
             if (apply_derivative) delta[o] -= (o_val * softmax_sum);
-            double d = delta[o];
+            ps_real d = delta[o];
             PSGradient * gradient = &(lgradients[o]);
-            gradient->bias = d;
+            gradient->bias += d;
             w = 0;
 #ifdef USE_AVX
             AVXMultiplyValue(neuron->weights_size,
-                             previousLayer->avx_activation_cache, d,
+                             GetLayerStates(previousLayer), d,
                              gradient->weights, w,
                              1, t, AVX_STORE_MODE_ADD);
 #endif
             for (; w < neuron->weights_size; w++) {
-                PSNeuron * prev_neuron = previousLayer->neurons[w];
-                PSRecurrentCell * prev_cell = GetRecurrentCell(prev_neuron);
-                double prev_a = prev_cell->states[t];
+                ps_real prev_a = GetLayerState(previousLayer, w, t);
                 gradient->weights[w] += (d * prev_a);
             }
         }
@@ -1670,15 +2785,16 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
             // Calculate layer deltas
             for (j = 0; j < lsize; j++) {
                 PSNeuron * neuron = layer->neurons[j];
-                PSRecurrentCell * cell = GetRecurrentCell(neuron);
-                double sum = 0;
+                ps_real sum = 0;
+                ps_real * next_weights = nextLayer->weights + j;
+                int next_stride = nextLayer->weights_stride;
                 for (k = 0; k < nextLayer->size; k++) {
-                    PSNeuron * nextNeuron = nextLayer->neurons[k];
-                    double weight = nextNeuron->weights[j];
-                    double d = last_delta[k];
+                    ps_real weight = next_weights[k * next_stride];
+                    ps_real d = last_delta[k];
                     sum += (d * weight);
                 }
-                double dv = sum * layer->derivative(cell->states[t]);
+                ps_real dv = sum * layer->derivative(GetLayerState(layer, j,
+                                                                  t));
                 if (!is_lstm)
                     delta[j] = dv;
                 else
@@ -1693,21 +2809,18 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
                         if (params == NULL) {
                             fprintf(stderr, "Layer %d params are NULL!\n",
                                     previousLayer->index);
-                            return NULL;
+                            return 0;
                         }
                         int vector_size = (int) params->parameters[0];
                         assert(vector_size > 0);
-                        PSNeuron * prev_n = previousLayer->neurons[0];
-                        PSRecurrentCell * prev_c = GetRecurrentCell(prev_n);
-                        double prev_a = prev_c->states[t];
+                        ps_real prev_a = GetLayerState(previousLayer, 0, t);
                         assert(prev_a < vector_size);
                         w = (int) prev_a;
                         gradient->weights[w] += dv;
                     } else {
                         for (w = 0; w < wsize; w++) {
-                            PSNeuron * prev_n = previousLayer->neurons[w];
-                            PSRecurrentCell * prev_c = GetRecurrentCell(prev_n);
-                            double prev_a = prev_c->states[t];
+                            ps_real prev_a = GetLayerState(previousLayer, w,
+                                                           t);
                             gradient->weights[w] += (dv * prev_a);
                         }
                     }
@@ -1719,114 +2832,240 @@ PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
                                          lgradients, t);
             else if (is_lstm)
                 ok = PSLSTMBackprop(layer, previousLayer, lgradients, t);
-            if (!ok) return NULL;
+            if (!ok) return 0;
             last_delta = layer->delta;
         }
     }
-    return gradients;
+    return 1;
 }
 
-double updateWeights(PSNeuralNetwork * network, double * training_data,
-                     int batch_size, int elements_count,
-                     PSTrainingOptions* opts, double rate, ...)
+PSGradient ** backpropThroughTime(PSNeuralNetwork * network, ps_real * x,
+                                  ps_real * y, int times)
 {
-    double r = rate / (double) batch_size;
-    int i, j, k, w, netsize = network->size, dsize = netsize - 1, times;
-    int training_data_size = network->input_size;
-    int label_data_size = network->output_size;
+    if (network == NULL) return NULL;
     PSGradient ** gradients = createGradients(network);
-    if (gradients == NULL) {
-        network->status = STATUS_ERROR;
-        return -999.0;
-    }
-    char * func = "updateWeights";
-    PSGradient ** bp_gradients = NULL;
-    double ** series = NULL;
-    int is_recurrent = network->flags & FLAG_RECURRENT;
-    if (is_recurrent) {
-        va_list args;
-        va_start(args, rate);
-        series = va_arg(args, double**);
-        va_end(args);
-        if (series == NULL) {
-            PSErr(func, "Series is NULL");
-            network->status = STATUS_ERROR;
-            PSDeleteGradients(gradients, network);
-            return -999.0;
-        }
+    if (gradients == NULL) return NULL;
+    if (!accumulateBackpropThroughTime(network, x, y, times, gradients)) {
+        PSDeleteGradients(gradients, network);
+        return NULL;
     }
-    double * x;
-    double * y;
-    for (i = 0; i < batch_size; i++) {
+    return gradients;
+}
+
+/* Accumulates the gradients of the batch elements in [first, last). */
+static int accumulateBatch(PSNeuralNetwork * network, ps_real * training_data,
+                           ps_real ** series, int first, int last,
+                           PSGradient ** gradients)
+{
+    int training_data_size = network->input_size;
+    int element_size = training_data_size + network->output_size;
+    int i, ok = 1;
+    for (i = first; i < last && ok; i++) {
+        ps_real * x;
         if (series == NULL) {
-            int element_size = training_data_size + label_data_size;
-            x = training_data;
-            y = training_data + training_data_size;
-            training_data += element_size;
-            bp_gradients = backprop(network, x, y);
+            x = training_data + (i * element_size);
+            ok = accumulateBackprop(network, x, x + training_data_size,
+                                    gradients);
         } else {
             x = series[i];
-            times = (int) *(x++);
+            int times = (int) *(x++);
             if (times == 0) {
-                PSErr(func, "Series len must b > 0. (batch = %d)", i);
-                PSDeleteGradients(gradients, network);
-                return -999.0;
+                PSErr("updateWeights", "Series len must b > 0. (batch = %d)",
+                      i);
+                return 0;
             }
-            y = x + (times * training_data_size);
-            bp_gradients = backpropThroughTime(network, x, y, times);
-        }
-        if (bp_gradients == NULL) {
-            network->status = STATUS_ERROR;
-            PSDeleteGradients(gradients, network);
-            return -999.0;
+            ok = accumulateBackpropThroughTime(network, x,
+                                               x + (times * training_data_size),
+                                               times, gradients);
         }
-        for (j = 0; j < dsize; j++) {
-            PSLayer * layer = network->layers[j + 1];
-            PSGradient * lgradients_bp = bp_gradients[j];
-            PSGradient * lgradients = gradients[j];
-            if (lgradients == NULL) continue;
-            int lsize = layer->size;
-            int wsize = 0;
-            if (layer->type == Convolutional) {
-                PSLayerParameters * params = layer->parameters;
-                lsize = (int) (params->parameters[PARAM_FEATURE_COUNT]);
-                int rsize = (int) (params->parameters[PARAM_REGION_SIZE]);
-                wsize = rsize * rsize;
-            }
-            for (k = 0; k < lsize; k++) {
-                if (!wsize) {
-                    PSNeuron * neuron = layer->neurons[k];
-                    wsize = neuron->weights_size;
-                    if (layer->type == LSTM) wsize += 4; // LSTM biases
-                }
-                PSGradient * gradient_bp = &(lgradients_bp[k]);
-                PSGradient * gradient = &(lgradients[k]);
-                gradient->bias += gradient_bp->bias;
-                w = 0;
-#ifdef USE_AVX
-                AVXSum(wsize, gradient->weights, gradient_bp->weights,
-                       gradient->weights, w, 0);
-#endif
-                for (; w < wsize; w++)
-                    gradient->weights[w] += gradient_bp->weights[w];
+    }
+    return ok;
+}
+
+/* Data-parallel training: the batch is split across the workers, each one
+ * running backprop through its own replica of the network (worker 0 uses
+ * the network itself) and accumulating into the replica's gradients. The
+ * replicas' gradients are then reduced into the network's gradients, every
+ * worker summing its own range of rows.
+ * In Hogwild mode the replicas share the network's weights and biases
+ * instead, and every worker updates them directly (see hogwildDescent). */
+
+typedef struct {
+    PSWorkerPool * pool;
+    PSNeuralNetwork ** replicas;
+    int count;
+    int shared; // Replicas use the network's own weights and biases
+} PSTrainingWorkers;
+
+typedef struct {
+    PSNeuralNetwork * network;
+    PSTrainingWorkers * workers;
+    ps_real * training_data;
+    ps_real ** series;
+    int batch_size;
+    int * results;
+} PSTrainingBatch;
+
+/* Makes a replica's layer use the weights and biases of the network's layer
+ * in place of its own copy of them. */
+static void shareLayerParameters(PSLayer * dst, PSLayer * src) {
+    if (src->weights == NULL) return;
+    free(dst->weights);
+    free(dst->biases);
+    setLayerParameters(dst, src->weights, src->biases);
+}
+
+static void deleteTrainingWorkers(PSTrainingWorkers * workers) {
+    if (workers == NULL) return;
+    int i, j;
+    PSDeleteWorkerPool(workers->pool);
+    if (workers->replicas != NULL) {
+        for (i = 1; i < workers->count; i++) {
+            PSNeuralNetwork * replica = workers->replicas[i];
+            if (replica == NULL) continue;
+            if (workers->shared) {
+                for (j = 1; j < replica->size; j++)
+                    unshareLayerParameters(replica->layers[j]);
             }
+            PSDeleteNetwork(replica);
         }
-        PSDeleteGradients(bp_gradients, network);
+        free(workers->replicas);
     }
-    
-    double l1 = 0.0, l2 = 0.0, l2_loss = 0.0;
-    if (opts != NULL) {
-        //if (opts->l1_decay != 0.0) l1 = opts->l1_decay / elements_count;
-        if (opts->l2_decay != 0.0) {
-            l2 = opts->l2_decay / elements_count;
-            l2 = (1 - (rate * l2));
-        }
-        l1 = (1 - (rate * l1));
+    free(workers);
+}
+
+static PSTrainingWorkers * createTrainingWorkers(PSNeuralNetwork * network,
+                                                 int count, int shared)
+{
+    PSTrainingWorkers * workers = calloc(1, sizeof(PSTrainingWorkers));
+    if (workers == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
     }
-    
-    for (i = 0; i < dsize; i++) {
-        PSGradient * lgradients = gradients[i];
-        if (lgradients == NULL) continue;
+    workers->count = count;
+    workers->shared = shared;
+    workers->replicas = calloc(count, sizeof(PSNeuralNetwork *));
+    if (workers->replicas == NULL) {
+        printMemoryErrorMsg();
+        deleteTrainingWorkers(workers);
+        return NULL;
+    }
+    workers->replicas[0] = network;
+    int i, j;
+    for (i = 1; i < count; i++) {
+        PSNeuralNetwork * replica = cloneNetwork(network, 0, 0);
+        workers->replicas[i] = replica;
+        if (replica == NULL) {
+            deleteTrainingWorkers(workers);
+            return NULL;
+        }
+        if (shared) {
+            for (j = 1; j < network->size; j++)
+                shareLayerParameters(replica->layers[j], network->layers[j]);
+        }
+    }
+    workers->pool = PSCreateWorkerPool(count);
+    if (workers->pool == NULL) {
+        deleteTrainingWorkers(workers);
+        return NULL;
+    }
+    return workers;
+}
+
+static void trainBatchWorker(void * arg, int worker, int count) {
+    PSTrainingBatch * batch = (PSTrainingBatch *) arg;
+    PSNeuralNetwork * network = batch->network;
+    PSNeuralNetwork * replica = batch->workers->replicas[worker];
+    int i, first, last;
+    if (replica != network && !batch->workers->shared) {
+        for (i = 1; i < network->size; i++)
+            copyLayerParameters(replica->layers[i], network->layers[i]);
+    }
+    PSGradient ** gradients = getGradientsWorkspace(replica);
+    if (gradients == NULL) {
+        batch->results[worker] = 0;
+        return;
+    }
+    PSGetWorkerRange(batch->batch_size, worker, count, &first, &last);
+    batch->results[worker] = accumulateBatch(replica, batch->training_data,
+                                             batch->series, first, last,
+                                             gradients);
+}
+
+static void reduceGradientsWorker(void * arg, int worker, int count) {
+    PSTrainingBatch * batch = (PSTrainingBatch *) arg;
+    PSNeuralNetwork * network = batch->network;
+    PSTrainingWorkers * workers = batch->workers;
+    int i, r, j, first, last;
+    for (i = 1; i < network->size; i++) {
+        PSGradient * lgradients = network->gradients[i - 1];
+        if (lgradients == NULL) continue;
+        PSLayer * layer = network->layers[i];
+        int stride = getTensorStride(getLayerGradientSize(layer));
+        PSGetWorkerRange(getLayerWeightsRows(layer), worker, count,
+                         &first, &last);
+        if (first == last) continue;
+        int size = (last - first) * stride;
+        ps_real * dst = lgradients[first].weights;
+        for (r = 1; r < workers->count; r++) {
+            PSGradient * rgradients = workers->replicas[r]->gradients[i - 1];
+            ps_real * src = rgradients[first].weights;
+            for (j = first; j < last; j++)
+                lgradients[j].bias += rgradients[j].bias;
+            for (j = 0; j < size; j++) dst[j] += src[j];
+        }
+    }
+}
+
+static int accumulateBatchInParallel(PSNeuralNetwork * network,
+                                     ps_real * training_data,
+                                     ps_real ** series, int batch_size)
+{
+    PSTrainingWorkers * workers = (PSTrainingWorkers *) network->workers;
+    int results[workers->count], i;
+    PSTrainingBatch batch = {
+        .network = network,
+        .workers = workers,
+        .training_data = training_data,
+        .series = series,
+        .batch_size = batch_size,
+        .results = results
+    };
+    PSRunWorkers(workers->pool, trainBatchWorker, &batch);
+    for (i = 0; i < workers->count; i++) {
+        if (!results[i]) return 0;
+    }
+    PSRunWorkers(workers->pool, reduceGradientsWorker, &batch);
+    return 1;
+}
+
+/* Hogwild updates only touch the weights having a non-zero gradient (ie.
+ * the ones fed by non-zero inputs), so that workers don't write to cache
+ * lines they don't need to change. */
+static void applySparseGradient(ps_real * weights, ps_real * gradient,
+                                int size, double r)
+{
+    int k;
+    for (k = 0; k < size; k++) {
+        ps_real grad_w = gradient[k];
+        if (grad_w != 0) weights[k] -= (r * grad_w);
+    }
+}
+
+/* Subtracts the gradients (scaled by r) from the network's weights, also
+ * applying L2 decay if l2 is not zero, and returns the sum of the squared
+ * weight gradients. When sparse is set and there's no decay, only the
+ * weights having a non-zero gradient are written. */
+static double applyGradients(PSNeuralNetwork * network,
+                             PSGradient ** gradients, double r, double l2,
+                             int sparse)
+{
+    int i, j, k, dsize = network->size - 1;
+    double l2_loss = 0.0;
+    if (l2 != 0.0) sparse = 0;
+    for (i = 0; i < dsize; i++) {
+        PSGradient * lgradients = gradients[i];
+        if (lgradients == NULL) continue;
         PSLayer * layer = network->layers[i + 1];
         PSLayerType ltype = layer->type;
         int l_size;
@@ -1841,9 +3080,13 @@ double updateWeights(PSNeuralNetwork * network, double * training_data,
             PSGradient * g = &(lgradients[j]);
             if (shared == NULL) {
                 PSNeuron * neuron = layer->neurons[j];
-                neuron->bias = neuron->bias - r * g->bias;
+                layer->biases[j] -= (r * g->bias);
                 int wsize = neuron->weights_size;
                 if (is_lstm) PSUpdateLSTMBiases(neuron, g, r);
+                if (sparse) {
+                    applySparseGradient(neuron->weights, g->weights, wsize, r);
+                    continue;
+                }
                 k = 0;
 #ifdef USE_AVX
                 if (l2 != 0.0) {
@@ -1854,7 +3097,7 @@ double updateWeights(PSNeuralNetwork * network, double * training_data,
                     AVXDotSquare(wsize, g->weights, l2_loss, kk, 0, 0);
                     if (kk < k) { // AVX Step Length could differ
                         for (; kk < k; kk++) {
-                            double grad_w = g->weights[kk];
+                            ps_real grad_w = g->weights[kk];
                             l2_loss += (grad_w * grad_w);
                         }
                     }
@@ -1864,7 +3107,7 @@ double updateWeights(PSNeuralNetwork * network, double * training_data,
                 }
 #endif
                 for (; k < wsize; k++) {
-                    double grad_w = g->weights[k];
+                    ps_real grad_w = g->weights[k];
                     if (l2 != 0.0) {
                         neuron->weights[k] *= l2;
                         l2_loss += (grad_w * grad_w);
@@ -1873,7 +3116,12 @@ double updateWeights(PSNeuralNetwork * network, double * training_data,
                 }
             } else {
                 shared->biases[j] -= (r * g->bias);
-                double * weights = shared->weights[j];
+                ps_real * weights = shared->weights[j];
+                if (sparse) {
+                    applySparseGradient(weights, g->weights,
+                                        shared->weights_size, r);
+                    continue;
+                }
                 k = 0;
 #ifdef USE_AVX
                 AVXMultiplyValue(shared->weights_size, g->weights, r, weights,
@@ -1884,39 +3132,334 @@ double updateWeights(PSNeuralNetwork * network, double * training_data,
             }
         }
     }
-    PSDeleteGradients(gradients, network);
-    PSLayer * out = network->layers[netsize - 1];
+    return l2_loss;
+}
+
+/* Returns the loss of the last element fed through the network, given its
+ * expected outputs y (times is the sequence length for recurrent
+ * networks). */
+static double getOutputLoss(PSNeuralNetwork * network, ps_real * y,
+                            int times)
+{
+    int i, label_data_size = network->output_size;
+    int is_recurrent = network->flags & FLAG_RECURRENT;
+    PSLayer * out = network->layers[network->size - 1];
     int onehot = out->flags & FLAG_ONEHOT;
     if (onehot) label_data_size = 1;
     if (is_recurrent) label_data_size *= times;
-    double outputs[label_data_size];
+    ps_real outputs[label_data_size];
     for (i = 0; i < label_data_size; i++) {
         if (!is_recurrent)
-            outputs[i] = out->neurons[i]->activation;
+            outputs[i] = out->activations[i];
         else {
             if (onehot) {
                 int idx = (int) *(y + i);
-                PSNeuron * n = out->neurons[idx];
-                PSRecurrentCell * cell = GetRecurrentCell(n);
-                outputs[i] = cell->states[i];
+                outputs[i] = GetLayerState(out, idx, i);
             } else fetchRecurrentOutputState(out, outputs, i, 0);
         }
     }
-    if (l2 != 0.0) l2_loss = (0.5 * (opts->l2_decay / batch_size) * l2_loss);
     int onehot_s = (onehot ? out->size : 0);
-    return network->loss(outputs, y, label_data_size, onehot_s) + l2_loss;
+    return network->loss(outputs, y, label_data_size, onehot_s);
+}
+
+static double getL2Decay(PSTrainingOptions * opts, double rate,
+                         int elements_count)
+{
+    if (opts == NULL || opts->l2_decay == 0.0) return 0.0;
+    double l2 = opts->l2_decay / elements_count;
+    return (1 - (rate * l2));
+}
+
+double updateWeights(PSNeuralNetwork * network, ps_real * training_data,
+                     int batch_size, int elements_count,
+                     PSTrainingOptions* opts, double rate, ...)
+{
+    double r = rate / (double) batch_size;
+    int times = 0;
+    int training_data_size = network->input_size;
+    int label_data_size = network->output_size;
+    char * func = "updateWeights";
+    ps_real ** series = NULL;
+    int is_recurrent = network->flags & FLAG_RECURRENT;
+    if (is_recurrent) {
+        va_list args;
+        va_start(args, rate);
+        series = va_arg(args, ps_real**);
+        va_end(args);
+        if (series == NULL) {
+            PSErr(func, "Series is NULL");
+            network->status = STATUS_ERROR;
+            return -999.0;
+        }
+    }
+    // Every sample of the batch accumulates its gradients straight into
+    // the network's workspace, which is only cleared once per batch.
+    // The loss is then computed on the last sample, so it's taken from the
+    // replica that processed it when the batch is split across workers.
+    PSNeuralNetwork * last_net = network;
+    PSGradient ** gradients;
+    int ok;
+    if (network->workers != NULL) {
+        PSTrainingWorkers * workers = (PSTrainingWorkers *) network->workers;
+        ok = accumulateBatchInParallel(network, training_data, series,
+                                       batch_size);
+        gradients = network->gradients;
+        last_net = workers->replicas[workers->count - 1];
+    } else {
+        gradients = getGradientsWorkspace(network);
+        ok = (gradients != NULL &&
+              accumulateBatch(network, training_data, series, 0, batch_size,
+                              gradients));
+    }
+    if (!ok) {
+        network->status = STATUS_ERROR;
+        return -999.0;
+    }
+    ps_real * y;
+    if (series == NULL) {
+        int element_size = training_data_size + label_data_size;
+        y = training_data + ((batch_size - 1) * element_size) +
+            training_data_size;
+    } else {
+        ps_real * x = series[batch_size - 1];
+        times = (int) *(x++);
+        y = x + (times * training_data_size);
+    }
+    
+    double l2 = getL2Decay(opts, rate, elements_count);
+    double l2_loss = applyGradients(network, gradients, r, l2, 0);
+    if (l2 != 0.0) l2_loss = (0.5 * (opts->l2_decay / batch_size) * l2_loss);
+    return getOutputLoss(last_net, y, times) + l2_loss;
+}
+
+/* Hogwild training: the workers pull batches from the shuffled dataset and,
+ * without any synchronization, apply their gradients straight to the
+ * weights they share with the network. */
+
+typedef struct {
+    PSNeuralNetwork * network;
+    PSTrainingWorkers * workers;
+    PSBatchLoader * loader;
+    ps_real * buffers; // Batch buffer of every worker
+    int buffer_stride;
+    int batch_size;
+    int batches_count;
+    int next_batch; // Next batch to be pulled by a worker
+    int epochs;
+    double rate;
+    double l2;
+    double l2_decay;
+    double * losses;
+    int * results;
+} PSHogwildEpoch;
+
+static void hogwildWorker(void * arg, int worker, int count) {
+    PSHogwildEpoch * epoch = (PSHogwildEpoch *) arg;
+    PSNeuralNetwork * network = epoch->network;
+    PSNeuralNetwork * replica = epoch->workers->replicas[worker];
+    int input_size = network->input_size, batch_size = epoch->batch_size;
+    int element_size = input_size + network->output_size, batch;
+    double r = epoch->rate / (double) batch_size, loss = 0.0;
+    (void) count; // Batches are pulled on demand instead of being split
+    epoch->results[worker] = 1;
+    while ((batch = __sync_fetch_and_add(&(epoch->next_batch), 1)) <
+           epoch->batches_count)
+    {
+        if (worker == 0 && isProgressBatch(batch, epoch->batches_count))
+            printProgress(network, epoch->epochs, batch, epoch->batches_count);
+        ps_real * data = gatherBatch(epoch->loader, batch, epoch->buffers +
+                                     (worker * epoch->buffer_stride));
+        PSGradient ** gradients = getGradientsWorkspace(replica);
+        if (data == NULL || gradients == NULL ||
+            !accumulateBatch(replica, data, NULL, 0, batch_size, gradients))
+        {
+            epoch->results[worker] = 0;
+            break;
+        }
+        double l2_loss = applyGradients(network, gradients, r, epoch->l2, 1);
+        if (epoch->l2 != 0.0)
+            l2_loss = (0.5 * (epoch->l2_decay / batch_size) * l2_loss);
+        ps_real * y = data + ((batch_size - 1) * element_size) + input_size;
+        loss += getOutputLoss(replica, y, 0) + l2_loss;
+    }
+    epoch->losses[worker] = loss;
+}
+
+static double hogwildDescent(PSNeuralNetwork * network,
+                             PSBatchLoader * loader, int elements_count,
+                             double learning_rate, int batch_size,
+                             PSTrainingOptions * options, int epochs)
+{
+    PSTrainingWorkers * workers = (PSTrainingWorkers *) network->workers;
+    int batches_count = elements_count / batch_size, i;
+    double losses[workers->count], err = 0.0;
+    int results[workers->count];
+    int buffer_stride = getTensorStride(batch_size * loader->element_size);
+    ps_real * buffers = NULL;
+    if (loader->indexes != NULL || loader->source != NULL) {
+        buffers = PSCreateTensor(workers->count * buffer_stride);
+        if (buffers == NULL) {
+            printMemoryErrorMsg();
+            network->status = STATUS_ERROR;
+            return -999.00;
+        }
+    }
+    PSHogwildEpoch epoch = {
+        .network = network,
+        .workers = workers,
+        .loader = loader,
+        .buffers = buffers,
+        .buffer_stride = buffer_stride,
+        .batch_size = batch_size,
+        .batches_count = batches_count,
+        .next_batch = 0,
+        .epochs = epochs,
+        .rate = learning_rate,
+        .l2 = getL2Decay(options, learning_rate, elements_count),
+        .l2_decay = options->l2_decay,
+        .losses = losses,
+        .results = results
+    };
+    PSRunWorkers(workers->pool, hogwildWorker, &epoch);
+    printProgress(network, epochs, batches_count - 1, batches_count);
+    free(buffers);
+    network->current_batch = batches_count - 1;
+    for (i = 0; i < workers->count; i++) {
+        if (!results[i]) {
+            network->status = STATUS_ERROR;
+            return -999.00;
+        }
+        err += losses[i];
+    }
+    return err / (double) batches_count;
+}
+
+/* Checkpoints are written by a background thread: the training thread only
+ * copies the parameters into a snapshot of the network, and waits only if
+ * the previous checkpoint is still being written. Files are written to a
+ * temporary file first, so that an interrupted write never replaces the
+ * last complete checkpoint. */
+
+typedef struct {
+    PSNeuralNetwork * snapshot;
+    char * filename;
+    int binary;
+    int epochs; // Epochs between checkpoints
+    int batches; // Batches between checkpoints
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int pending; // The snapshot has still to be written
+    int stopped;
+    int failed;
+} PSCheckpointWriter;
+
+static void * checkpointThread(void * arg) {
+    PSCheckpointWriter * writer = (PSCheckpointWriter *) arg;
+    pthread_mutex_lock(&writer->lock);
+    while (1) {
+        while (!writer->pending && !writer->stopped)
+            pthread_cond_wait(&writer->cond, &writer->lock);
+        if (!writer->pending) break;
+        pthread_mutex_unlock(&writer->lock);
+        int ok;
+        if (writer->binary)
+            ok = saveNetworkBinary(writer->snapshot, writer->filename, 0);
+        else ok = saveNetwork(writer->snapshot, writer->filename, 0);
+        pthread_mutex_lock(&writer->lock);
+        if (!ok) writer->failed++;
+        writer->pending = 0;
+        pthread_cond_broadcast(&writer->cond);
+    }
+    pthread_mutex_unlock(&writer->lock);
+    return NULL;
+}
+
+/* Waits for the last checkpoint to be written and stops the writer. */
+static void deleteCheckpointWriter(PSCheckpointWriter * writer) {
+    if (writer == NULL) return;
+    pthread_mutex_lock(&writer->lock);
+    writer->stopped = 1;
+    pthread_cond_broadcast(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
+    pthread_join(writer->thread, NULL);
+    if (writer->failed) {
+        PSErr("PSTrain", "%d checkpoints could not be saved to %s!",
+              writer->failed, writer->filename);
+    }
+    pthread_mutex_destroy(&writer->lock);
+    pthread_cond_destroy(&writer->cond);
+    PSDeleteNetwork(writer->snapshot);
+    free(writer->filename);
+    free(writer);
+}
+
+static PSCheckpointWriter * createCheckpointWriter(PSNeuralNetwork * network,
+                                                   PSTrainingOptions * options)
+{
+    PSCheckpointWriter * writer = calloc(1, sizeof(PSCheckpointWriter));
+    if (writer == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    const char * filename = options->checkpoint_file;
+    writer->filename = malloc(strlen(filename) + 1);
+    writer->snapshot = cloneNetwork(network, 1, 0);
+    if (writer->filename == NULL || writer->snapshot == NULL) {
+        printMemoryErrorMsg();
+        PSDeleteNetwork(writer->snapshot);
+        free(writer->filename);
+            free(writer);
+        return NULL;
+    }
+    strcpy(writer->filename, filename);
+    writer->binary = (options->flags & TRAINING_BINARY_CHECKPOINTS);
+    writer->epochs = options->checkpoint_epochs;
+    writer->batches = options->checkpoint_batches;
+    if (writer->epochs <= 0 && writer->batches <= 0) writer->epochs = 1;
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->cond, NULL);
+    if (pthread_create(&writer->thread, NULL, checkpointThread, writer)) {
+        PSErr("PSTrain", "Could not create the checkpoint thread!");
+        pthread_mutex_destroy(&writer->lock);
+        pthread_cond_destroy(&writer->cond);
+        PSDeleteNetwork(writer->snapshot);
+        free(writer->filename);
+            free(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+/* Hands a snapshot of the network over to the checkpoint writer. */
+static void writeCheckpoint(PSNeuralNetwork * network) {
+    PSCheckpointWriter * writer = (PSCheckpointWriter *) network->checkpoints;
+    PSNeuralNetwork * snapshot = writer->snapshot;
+    int i;
+    pthread_mutex_lock(&writer->lock);
+    while (writer->pending)
+        pthread_cond_wait(&writer->cond, &writer->lock);
+    for (i = 1; i < network->size; i++)
+        copyLayerParameters(snapshot->layers[i], network->layers[i]);
+    snapshot->flags = network->flags;
+    snapshot->loss = network->loss;
+    snapshot->current_epoch = network->current_epoch;
+    snapshot->current_batch = network->current_batch;
+    writer->pending = 1;
+    pthread_cond_broadcast(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
 }
 
 double gradientDescent(PSNeuralNetwork * network,
-                       double * training_data,
-                       int element_size,
+                       ps_real * training_data,
                        int elements_count,
                        double learning_rate,
                        int batch_size,
                        PSTrainingOptions * options,
+                       PSBatchLoader * loader,
                        int epochs) {
     int batches_count = elements_count / batch_size;
-    double ** series = NULL;
+    ps_real ** series = NULL;
     int flags = 0;
     if (options != NULL) flags = options->flags;
     if (network->flags & FLAG_RECURRENT) {
@@ -1933,34 +3476,183 @@ double gradientDescent(PSNeuralNetwork * network,
             }
         }
         if (!(flags & TRAINING_NO_SHUFFLE))
-            shuffleSeries(series, elements_count);
+            shuffleSeries(series, elements_count, &(loader->seed));
     } else {
-        if (!(flags & TRAINING_NO_SHUFFLE))
-            shuffle(training_data, elements_count, element_size);
+        if ((flags & TRAINING_HOGWILD) && network->workers != NULL) {
+            if (!shuffleBatches(loader)) {
+                network->status = STATUS_ERROR;
+                return -999.00;
+            }
+            return hogwildDescent(network, loader, elements_count,
+                                  learning_rate, batch_size, options, epochs);
+        }
+        startBatchLoader(loader, batches_count);
     }
-    int offset = (element_size * batch_size), i;
+    int i;
     double err = 0.0;
     for (i = 0; i < batches_count; i++) {
         network->current_batch = i;
-        printf("\rEpoch %d/%d: batch %d/%d", network->current_epoch + 1, epochs,
-               i + 1, batches_count);
-        fflush(stdout);
-        err += updateWeights(network, training_data, batch_size, elements_count,
+        if (isProgressBatch(i, batches_count))
+            printProgress(network, epochs, i, batches_count);
+        ps_real * batch = training_data;
+        if (series == NULL) batch = getNextBatch(loader, i);
+        if (batch == NULL) {
+            network->status = STATUS_ERROR;
+            return -999.00;
+        }
+        err += updateWeights(network, batch, batch_size, elements_count,
                              options, learning_rate, series);
+        if (series == NULL) releaseBatch(loader, i);
         if (network->status == STATUS_ERROR) {
-            if (series != NULL) free(series - (i * batches_count));
+            if (series != NULL) free(series - (i * batch_size));
             return -999.00;
         }
-        if (series == NULL) training_data += offset;
-        else series += batch_size;
+        PSCheckpointWriter * writer = network->checkpoints;
+        if (writer != NULL && writer->batches > 0) {
+            int trained = (network->current_epoch * batches_count) + i + 1;
+            if ((trained % writer->batches) == 0) writeCheckpoint(network);
+        }
+        if (series != NULL) series += batch_size;
     }
     if (series != NULL) free(series - (batch_size * batches_count));
     return err / (double) batches_count;
 }
 
-float validate(PSNeuralNetwork * network, double * test_data, int data_size,
+/* Feedforwards a recurrent series, returning the fraction of its correctly
+ * predicted states (or -1 on errors). */
+static float validateSeries(PSNeuralNetwork * network, ps_real * inputs) {
+    PSLayer * output_layer = network->layers[network->size - 1];
+    int input_size = network->input_size;
+    int y_size = network->output_size, j;
+    int onehot = output_layer->flags & FLAG_ONEHOT;
+    if (onehot) y_size = 1;
+    int times = (int) (*inputs);
+    if (times == 0) return -1.0f;
+    ps_real * expected = inputs + 1 + (times * input_size);
+    if (!PSFeedforward(network, inputs)) return -1.0f;
+    int label_data_size = y_size * times;
+    int correct_states = 0;
+    ps_real outputs[label_data_size];
+    for (j = 0; j < label_data_size; j++) {
+        fetchRecurrentOutputState(output_layer, outputs, j, onehot);
+        if (onehot && (outputs[j] == expected[j])) correct_states++;
+        else if (!onehot && j > 0 && (j % y_size) == 0) {
+            int t = (j / y_size) - 1;
+            int omax = arrayMaxIndex(outputs + (t * y_size), y_size);
+            int emax = arrayMaxIndex(expected + (t * y_size), y_size);
+            if (emax == omax) correct_states++;
+        }
+    }
+    return (float) correct_states / (float) times;
+}
+
+typedef struct {
+    PSNeuralNetwork * network;
+    // Networks holding the recurrent states of every worker
+    PSNeuralNetwork ** replicas;
+    int shared; // Replicas use the network's own weights and biases
+    ps_real * test_data;
+    int data_size;
+    ps_real ** series;
+    int elements_count;
+    int * results; // Predicted classes (non-recurrent networks)
+    float * amounts; // Correct states of every series (recurrent networks)
+    int failed;
+} PSValidation;
+
+/* Every worker validates a shard of the test set: non-recurrent networks
+ * are only read (see feedforwardBatch), while every recurrent series is fed
+ * through the worker's own replica. */
+static void validateWorker(void * arg, int worker, int count) {
+    PSValidation * validation = (PSValidation *) arg;
+    PSNeuralNetwork * network = validation->network;
+    int element_size = network->input_size + network->output_size;
+    int i, first, last;
+    PSGetWorkerRange(validation->elements_count, worker, count, &first,
+                     &last);
+    if (first >= last) return;
+    if (validation->series == NULL) {
+        int ok = feedforwardBatch(network,
+                                  validation->test_data +
+                                  (first * element_size), last - first,
+                                  element_size, NULL,
+                                  validation->results + first);
+        if (!ok) validation->failed = 1;
+        return;
+    }
+    PSNeuralNetwork * replica = network;
+    if (worker > 0) replica = validation->replicas[worker];
+    if (replica != network && !validation->shared) {
+        for (i = 1; i < network->size; i++)
+            copyLayerParameters(replica->layers[i], network->layers[i]);
+    }
+    for (i = first; i < last; i++) {
+        float amount = validateSeries(replica, validation->series[i]);
+        if (amount < 0) {
+            validation->failed = 1;
+            return;
+        }
+        validation->amounts[i] = amount;
+    }
+}
+
+/* Runs validateWorker on the training workers (while training) or on the
+ * library's ones, creating temporary replicas for recurrent networks. */
+static int runValidation(PSValidation * validation) {
+    PSNeuralNetwork * network = validation->network;
+    PSTrainingWorkers * workers = (PSTrainingWorkers *) network->workers;
+    if (workers != NULL) {
+        validation->replicas = workers->replicas;
+        validation->shared = workers->shared;
+        PSRunWorkers(workers->pool, validateWorker, validation);
+        return !validation->failed;
+    }
+    int i, count = PSGetThreadCount(), ok = 1;
+    long work = validation->data_size;
+    if (validation->series != NULL && count > 1 &&
+        work >= PS_PARALLEL_MIN_WORK)
+    {
+        validation->replicas = calloc(count, sizeof(PSNeuralNetwork *));
+        if (validation->replicas == NULL) {
+            printMemoryErrorMsg();
+            return 0;
+        }
+        for (i = 1; i < count && ok; i++) {
+            validation->replicas[i] = cloneNetwork(network, 0, 0);
+            ok = (validation->replicas[i] != NULL);
+        }
+        // Clones already have the network's parameters
+        validation->shared = 1;
+    }
+    if (ok) PSRunLayerWorkers(validateWorker, validation, work);
+    if (validation->replicas != NULL) {
+        for (i = 1; i < count; i++) {
+            PSNeuralNetwork * replica = validation->replicas[i];
+            if (replica != NULL) PSDeleteNetwork(replica);
+        }
+        free(validation->replicas);
+        validation->replicas = NULL;
+    }
+    return ok && !validation->failed;
+}
+
+/* Returns 1 if `result` is the class expected by a non-recurrent element. */
+static int isExpectedClass(PSNeuralNetwork * network, ps_real * element,
+                           int result)
+{
+    PSLayer * output_layer = network->layers[network->size - 1];
+    ps_real * expected = element + network->input_size;
+    int emax;
+    if (!(output_layer->flags & FLAG_ONEHOT))
+        emax = arrayMaxIndex(expected, network->output_size);
+    else
+        emax = *(expected - 1);
+    return (result == emax);
+}
+
+float validate(PSNeuralNetwork * network, ps_real * test_data, int data_size,
                int log) {
-    int i, j;
+    int i;
     float accuracy = 0.0f;
     int correct_results = 0;
     float correct_amount = 0.0f;
@@ -1971,7 +3663,7 @@ float validate(PSNeuralNetwork * network, double * test_data, int data_size,
     int onehot = output_layer->flags & FLAG_ONEHOT;
     int element_size = input_size + output_size;
     int elements_count;
-    double ** series = NULL;
+    ps_real ** series = NULL;
     if (network->flags & FLAG_RECURRENT) {
         // First training data number for Recurrent networks must indicate
         // the data elements count
@@ -1987,7 +3679,6 @@ float validate(PSNeuralNetwork * network, double * test_data, int data_size,
             return -999.0f;
         }
     } else elements_count = data_size / element_size;
-    //double outputs[output_size];
     if (log) printf("Test data elements: %d\n", elements_count);
     time_t start_t, end_t;
     char timestr[80];
@@ -1996,86 +3687,49 @@ float validate(PSNeuralNetwork * network, double * test_data, int data_size,
     tminfo = localtime(&start_t);
     strftime(timestr, 80, "%H:%M:%S", tminfo);
     if (log) printf("Testing started at %s\n", timestr);
+    PSValidation validation = {
+        .network = network,
+        .test_data = test_data,
+        .data_size = data_size,
+        .series = series,
+        .elements_count = elements_count
+    };
+    int ok = 1;
+    if (elements_count > 0) {
+        if (series == NULL)
+            validation.results = malloc(elements_count * sizeof(int));
+        else
+            validation.amounts = malloc(elements_count * sizeof(float));
+        if (validation.results == NULL && validation.amounts == NULL) {
+            printMemoryErrorMsg();
+            ok = 0;
+        } else ok = runValidation(&validation);
+    }
+    if (!ok) {
+        if (validation.results != NULL) free(validation.results);
+        if (validation.amounts != NULL) free(validation.amounts);
+        if (series != NULL) free(series);
+        network->status = STATUS_ERROR;
+        fprintf(stderr, "\nAn error occurred while validating, aborting!\n");
+        return -999.0;
+    }
+    if (log) printf("Testing %d/%d\n", elements_count, elements_count);
     for (i = 0; i < elements_count; i++) {
-        if (log) printf("\rTesting %d/%d", i + 1, elements_count);
-        fflush(stdout);
-        double * inputs = NULL;
-        double * expected = NULL;
-        int times = 0;
         if (series == NULL) {
-            // Not Recurrent
-            inputs = test_data;
-            test_data += input_size;
-            expected = test_data;
-            
-            int ok = PSFeedforward(network, inputs);
-            if (!ok) {
-                network->status = STATUS_ERROR;
-                fprintf(stderr,
-                        "\nAn error occurred while validating, aborting!\n");
-                return -999.0;
-            }
-            
-            double max = 0.0;
-            int omax = 0;
-            int emax = 0;
-            for (j = 0; j < output_size; j++) {
-                PSNeuron * neuron = output_layer->neurons[j];
-                if (neuron->activation > max) {
-                    max = neuron->activation;
-                    omax = j;
-                }
-            }
-            if (!onehot)
-                emax = arrayMaxIndex(expected, output_size);
-            else
-                emax = *(expected + (times - 1));
-            if (omax == emax) correct_results++;
-            test_data += output_size;
-        } else {
-            // Recurrent
-            inputs = series[i];
-            times = (int) (*inputs);
-            if (times == 0) {
-                network->status = STATUS_ERROR;
-                fprintf(stderr,
-                        "\nAn error occurred while validating, aborting!\n");
-                return -999.0;
-            }
-            expected = inputs + 1 + (times * input_size);
-            
-            int ok = PSFeedforward(network, inputs);
-            if (!ok) {
-                network->status = STATUS_ERROR;
-                fprintf(stderr,
-                        "\nAn error occurred while validating, aborting!\n");
-                return -999.0;
-            }
-            
-            int label_data_size = y_size * times;
-            int correct_states = 0;
-            double outputs[label_data_size];
-            for (j = 0; j < label_data_size; j++) {
-                fetchRecurrentOutputState(output_layer, outputs, j, onehot);
-                if (onehot && (outputs[j] == expected[j])) correct_states++;
-                else if (!onehot && j > 0 && (j % y_size) == 0) {
-                    int t = (j / y_size) - 1;
-                    int omax = arrayMaxIndex(outputs + (t * y_size), y_size);
-                    int emax = arrayMaxIndex(expected + (t * y_size), y_size);
-                    if (emax == omax) correct_states++;
-                }
-            }
-            correct_amount += (float) correct_states / (float) times;
-        }
+            correct_results += isExpectedClass(network, test_data,
+                                               validation.results[i]);
+            test_data += element_size;
+        } else correct_amount += validation.amounts[i];
     }
-    if (log) printf("\n");
     time(&end_t);
     if (log) printf("Completed in %ld sec.\n", end_t - start_t);
     if (series == NULL) {
+        if (validation.results != NULL) free(validation.results);
         accuracy = (float) correct_results / (float) elements_count;
         if (log) printf("Accuracy (%d/%d): %.2f\n",
                         correct_results, elements_count,accuracy);
     } else {
+        if (validation.amounts != NULL) free(validation.amounts);
         accuracy = correct_amount / (float) elements_count;
         free(series);
         if (log) printf("Accuracy: %.2f\n", accuracy);
@@ -2083,15 +3737,106 @@ float validate(PSNeuralNetwork * network, double * test_data, int data_size,
     return accuracy;
 }
 
-void PSTrain(PSNeuralNetwork * network,
-             double * training_data,
-             int data_size,
-             int epochs,
-             double learning_rate,
-             int batch_size,
-             PSTrainingOptions * options,
-             double * test_data,
-             int test_size) {
+/* Data sources stream non-recurrent elements matching the network's
+ * input and output. */
+static int checkDataSource(PSNeuralNetwork * network, PSDataSource * source,
+                           char * func)
+{
+    if (network->flags & FLAG_RECURRENT) {
+        PSErr(func, "Data sources are not supported by recurrent networks");
+        return 0;
+    }
+    if (source->input_size != network->input_size ||
+        source->output_size != network->output_size) {
+        PSErr(func, "Data source elements (%d + %d) don't match the "
+              "network (%d + %d)", source->input_size, source->output_size,
+              network->input_size, network->output_size);
+        return 0;
+    }
+    return 1;
+}
+
+#define PS_VALIDATION_CHUNK 1024
+
+/* Validates a non-recurrent network on the elements of a data source,
+ * reading them PS_VALIDATION_CHUNK elements at a time. */
+static float validateSource(PSNeuralNetwork * network, PSDataSource * source,
+                            int log)
+{
+    int element_size = network->input_size + network->output_size;
+    int tested = 0, correct_results = 0, count, i;
+    if (log) printf("Test data elements: %d\n", source->count);
+    time_t start_t, end_t;
+    char timestr[80];
+    struct tm * tminfo;
+    time(&start_t);
+    tminfo = localtime(&start_t);
+    strftime(timestr, 80, "%H:%M:%S", tminfo);
+    if (log) printf("Testing started at %s\n", timestr);
+    ps_real * chunk = malloc((size_t) PS_VALIDATION_CHUNK * element_size *
+                             sizeof(ps_real));
+    int * results = malloc(PS_VALIDATION_CHUNK * sizeof(int));
+    int ok = (chunk != NULL && results != NULL);
+    if (!ok) printMemoryErrorMsg();
+    else ok = source->rewind(source);
+    while (ok && tested < source->count) {
+        count = source->count - tested;
+        if (count > PS_VALIDATION_CHUNK) count = PS_VALIDATION_CHUNK;
+        count = source->read(source, chunk, count);
+        if (count <= 0) {
+            ok = (count == 0);
+            break;
+        }
+        PSValidation validation = {
+            .network = network,
+            .test_data = chunk,
+            .data_size = count * element_size,
+            .elements_count = count,
+            .results = results
+        };
+        ok = runValidation(&validation);
+        for (i = 0; ok && i < count; i++) {
+            correct_results += isExpectedClass(network, chunk +
+                                               (i * element_size),
+                                               results[i]);
+        }
+        tested += count;
+        if (log) {
+            printf("\rTesting %d/%d", tested, source->count);
+            fflush(stdout);
+        }
+    }
+    free(chunk);
+    free(results);
+    if (!ok) {
+        network->status = STATUS_ERROR;
+        fprintf(stderr, "\nAn error occurred while validating, aborting!\n");
+        return -999.0;
+    }
+    if (log) printf("\n");
+    time(&end_t);
+    if (log) printf("Completed in %ld sec.\n", end_t - start_t);
+    float accuracy = 0.0f;
+    if (tested > 0) accuracy = (float) correct_results / (float) tested;
+    if (log) printf("Accuracy (%d/%d): %.2f\n",
+                    correct_results, tested, accuracy);
+    return accuracy;
+}
+
+/* Trains the network either on an array of training data or on a data
+ * source (if `source` isn't NULL), validating it on either `test_data` or
+ * `test_source`. */
+static void train(PSNeuralNetwork * network,
+                  ps_real * training_data,
+                  int data_size,
+                  PSDataSource * source,
+                  int epochs,
+                  double learning_rate,
+                  int batch_size,
+                  PSTrainingOptions * options,
+                  ps_real * test_data,
+                  int test_size,
+                  PSDataSource * test_source) {
     int i, elements_count;
     int element_size = network->input_size + network->output_size;
     int valid = PSVerifyNetwork(network);
@@ -2099,7 +3844,8 @@ void PSTrain(PSNeuralNetwork * network,
         network->status = STATUS_ERROR;
         return;
     }
-    if (network->flags & FLAG_RECURRENT) {
+    if (source != NULL) elements_count = source->count;
+    else if (network->flags & FLAG_RECURRENT) {
         // First training data number for Recurrent networks must indicate
         // the data elements count
         elements_count = (int) *(training_data++);
@@ -2113,6 +3859,55 @@ void PSTrain(PSNeuralNetwork * network,
     printf("Batch Size: %d\n", batch_size);
     printf("Learning Rate: %.2f\n", learning_rate);
     if (options != NULL) printf("L2 Decay: %.2f\n", options->l2_decay);
+    if (options != NULL && options->threads > 1) {
+        int hogwild = (options->flags & TRAINING_HOGWILD);
+        if (hogwild && (network->flags & FLAG_RECURRENT)) {
+            PSErr("PSTrain", "Hogwild training is not supported by "
+                  "recurrent networks");
+            network->status = STATUS_ERROR;
+            return;
+        }
+        printf("Threads: %d%s\n", options->threads,
+               (hogwild ? " (Hogwild)" : ""));
+        network->workers = createTrainingWorkers(network, options->threads,
+                                                 hogwild);
+        if (network->workers == NULL) {
+            network->status = STATUS_ERROR;
+            return;
+        }
+    }
+    if (options != NULL && options->checkpoint_file != NULL) {
+        printf("Checkpoints: %s\n", options->checkpoint_file);
+        network->checkpoints = createCheckpointWriter(network, options);
+        if (network->checkpoints == NULL) {
+            deleteTrainingWorkers(network->workers);
+            network->workers = NULL;
+            network->status = STATUS_ERROR;
+            return;
+        }
+    }
+    PSBatchLoader loader;
+    int shuffled = (options == NULL || !(options->flags & TRAINING_NO_SHUFFLE));
+    // Hogwild workers gather their own batches
+    int pipelined = (options == NULL || !(options->flags & TRAINING_HOGWILD) ||
+                     network->workers == NULL);
+    ps_real * samples = (network->flags & FLAG_RECURRENT ? NULL :
+                         training_data);
+    int window_size = PS_SHUFFLE_WINDOW;
+    if (options != NULL && options->shuffle_window > 0)
+        window_size = options->shuffle_window;
+    if (source != NULL && shuffled)
+        printf("Shuffle Window: %d\n", window_size);
+    if (!initBatchLoader(&loader, samples, elements_count, source,
+                         window_size, element_size, batch_size, shuffled,
+                         pipelined)) {
+        deleteTrainingWorkers(network->workers);
+        network->workers = NULL;
+        deleteCheckpointWriter(network->checkpoints);
+        network->checkpoints = NULL;
+        network->status = STATUS_ERROR;
+        return;
+    }
     network->status = STATUS_TRAINING;
     time_t start_t, end_t, epoch_t;
     char timestr[80];
@@ -2131,22 +3926,29 @@ void PSTrain(PSNeuralNetwork * network,
     if (options != NULL) adjust_rate = (options->flags & TRAINING_ADJUST_RATE);
     for (i = 0; i < epochs; i++) {
         network->current_epoch = i;
-        double err = gradientDescent(network, training_data, element_size,
-                                     elements_count, learning_rate,
-                                     batch_size, options, epochs);
+        double err = gradientDescent(network, training_data, elements_count,
+                                     learning_rate, batch_size, options,
+                                     &loader, epochs);
         if (network->status == STATUS_ERROR) {
             fprintf(stderr, "\nAn error occurred while training, aborting!\n");
+            deleteTrainingWorkers(network->workers);
+            network->workers = NULL;
+            deleteCheckpointWriter(network->checkpoints);
+            network->checkpoints = NULL;
+            deleteBatchLoader(&loader);
             return;
         }
         char accuracy_msg[255] = "";
-        if (test_data != NULL) {
+        if (test_data != NULL || test_source != NULL) {
             int batches_count = elements_count / batch_size;
             printf("\rEpoch %d/%d: batch %d/%d, validating...",
                    network->current_epoch + 1,
                    epochs,
                    network->current_batch + 1,
                    batches_count);
-            acc = validate(network, test_data, test_size, 0);
+            if (test_source != NULL)
+                acc = validateSource(network, test_source, 0);
+            else acc = validate(network, test_data, test_size, 0);
             printf("\rEpoch %d/%d: batch %d/%d",
                    network->current_epoch + 1,
                    epochs,
@@ -2162,9 +3964,17 @@ void PSTrain(PSNeuralNetwork * network,
         if (network->onEpochTrained != NULL)
             network->onEpochTrained(network, i, err, prev_err,
                                     acc, &learning_rate);
+        PSCheckpointWriter * writer = network->checkpoints;
+        if (writer != NULL && writer->epochs > 0 &&
+            ((i + 1) % writer->epochs) == 0) writeCheckpoint(network);
         prev_err = err;
         printf(", loss = %.2lf%s (%ld sec.)\n", err, accuracy_msg, elapsed_t);
     }
+    deleteTrainingWorkers(network->workers);
+    network->workers = NULL;
+    deleteCheckpointWriter(network->checkpoints);
+    network->checkpoints = NULL;
+    deleteBatchLoader(&loader);
     time(&end_t);
     if (PSGlobalFlags & FLAG_LOG_COLORS) printf(GREEN);
     printf("Completed in %ld sec.\n", end_t - start_t);
@@ -2172,10 +3982,113 @@ void PSTrain(PSNeuralNetwork * network,
     network->status = STATUS_TRAINED;
 }
 
-float PSTest(PSNeuralNetwork * network, double * test_data, int data_size) {
+void PSTrain(PSNeuralNetwork * network,
+             ps_real * training_data,
+             int data_size,
+             int epochs,
+             double learning_rate,
+             int batch_size,
+             PSTrainingOptions * options,
+             ps_real * test_data,
+             int test_size) {
+    train(network, training_data, data_size, NULL, epochs, learning_rate,
+          batch_size, options, test_data, test_size, NULL);
+}
+
+float PSTest(PSNeuralNetwork * network, ps_real * test_data, int data_size) {
     return validate(network, test_data, data_size, 1);
 }
 
+void PSTrainSource(PSNeuralNetwork * network,
+                   PSDataSource * training,
+                   int epochs,
+                   double learning_rate,
+                   int batch_size,
+                   PSTrainingOptions * options,
+                   PSDataSource * test) {
+    char * func = "PSTrainSource";
+    if (network == NULL || training == NULL) {
+        PSErr(func, "Network or data source is NULL");
+        return;
+    }
+    if (!checkDataSource(network, training, func) ||
+        (test != NULL && !checkDataSource(network, test, func))) {
+        network->status = STATUS_ERROR;
+        return;
+    }
+    train(network, NULL, 0, training, epochs, learning_rate, batch_size,
+          options, NULL, 0, test);
+}
+
+float PSTestSource(PSNeuralNetwork * network, PSDataSource * test) {
+    if (!checkDataSource(network, test, "PSTestSource")) {
+        network->status = STATUS_ERROR;
+        return -999.0f;
+    }
+    return validateSource(network, test, 1);
+}
+
+/* Array sources */
+
+typedef struct {
+    ps_real * data;
+    int first;
+    int next;
+} PSArraySource;
+
+static int readArraySource(PSDataSource * source, ps_real * elements,
+                           int count)
+{
+    PSArraySource * array = (PSArraySource *) source->data;
+    int element_size = source->input_size + source->output_size;
+    int left = source->count - array->next;
+    if (count > left) count = left;
+    if (count <= 0) return 0;
+    memcpy(elements, array->data + ((size_t) (array->first + array->next) *
+                                    element_size),
+           (size_t) count * element_size * sizeof(ps_real));
+    array->next += count;
+    return count;
+}
+
+static int rewindArraySource(PSDataSource * source) {
+    ((PSArraySource *) source->data)->next = 0;
+    return 1;
+}
+
+static void closeArraySource(PSDataSource * source) {
+    free(source->data);
+}
+
+PSDataSource * PSCreateArraySource(ps_real * data, int first, int count,
+                                   int input_size, int output_size)
+{
+    PSDataSource * source = calloc(1, sizeof(PSDataSource));
+    PSArraySource * array = calloc(1, sizeof(PSArraySource));
+    if (source == NULL || array == NULL) {
+        printMemoryErrorMsg();
+        free(source);
+        free(array);
+        return NULL;
+    }
+    array->data = data;
+    array->first = first;
+    source->count = count;
+    source->input_size = input_size;
+    source->output_size = output_size;
+    source->read = readArraySource;
+    source->rewind = rewindArraySource;
+    source->close = closeArraySource;
+    source->data = array;
+    return source;
+}
+
+void PSDeleteDataSource(PSDataSource * source) {
+    if (source == NULL) return;
+    if (source->close != NULL) source->close(source);
+    free(source);
+}
+
 int PSVerifyNetwork(PSNeuralNetwork * network) {
     char * func = "PSVerifyNetwork";
     if (network == NULL) {
@@ -2250,7 +4163,8 @@ int PSVerifyNetwork(PSNeuralNetwork * network) {
                   "but derivative function is not relu_derivative", i);
             return 0;
         }
-        if (layer->activate == tanh && layer->derivative != tanh_derivative) {
+        if (layer->activate == ps_tanh &&
+            layer->derivative != tanh_derivative) {
             PSErr(func,
                   "Layer[%d] activate function is tanh, "
                   "but derivative function is not tanh_derivative", i);
@@ -18,6 +18,8 @@
 #ifndef __PSYC_H
 #define __PSYC_H
 
+#include <stddef.h>
+
 #define PSYC_VERSION      "0.2.2"
 
 #define LAYER_TYPES  6
@@ -39,21 +41,38 @@
 
 #define TRAINING_NO_SHUFFLE     (1 << 0)
 #define TRAINING_ADJUST_RATE    (1 << 1)
+/* Workers update the shared weights without synchronization (Hogwild),
+ * requires PSTrainingOptions.threads > 1 */
+#define TRAINING_HOGWILD        (1 << 2)
+/* Checkpoints are saved in binary format (see PSSaveNetworkBinary) */
+#define TRAINING_BINARY_CHECKPOINTS (1 << 3)
 
 #define BPTT_TRUNCATE   4
 
+#define PS_SHUFFLE_WINDOW   8192
+
+/* Precision of weights, activations and data: define PS_USE_FLOAT (make
+ * FLOAT=on) to build the library in single precision. */
+
+#ifdef PS_USE_FLOAT
+typedef float ps_real;
+#define PS_REAL_FMT "%.8e"
+#else
+typedef double ps_real;
+#define PS_REAL_FMT "%.15e"
+#endif
 
-typedef double  (*PSActivationFunction) (double);
+typedef ps_real  (*PSActivationFunction) (ps_real);
 typedef int     (*PSFeedforwardFunction) (void * network, void * layer, ...);
-typedef double  (*PSLossFunction) (double* x, double* y, int size,
+typedef double  (*PSLossFunction) (ps_real* x, ps_real* y, int size,
                                    int onehot_size);
 typedef void    (*PSTrainCallback) (void * network, int epoch, double loss,
                                     double previous_loss, float accuracy,
                                     double * rate);
 
 typedef struct {
-    double bias;
-    double * weights;
+    ps_real bias;
+    ps_real * weights;
 } PSGradient;
 
 typedef enum {
@@ -73,22 +92,58 @@ typedef struct {
 typedef struct {
     int feature_count;
     int weights_size;
-    double * biases;
-    double ** weights;
+    ps_real * biases;
+    ps_real ** weights;
+    ps_real * workspace; // Convolution workspace
+    int workspace_size;
+    int kernel;
 } PSSharedParams;
 
 typedef struct {
     int flags;
     double l2_decay;
+    int threads; // Worker threads splitting every batch (0 or 1: serial)
+    /* File periodically saved by a background thread while training (NULL:
+     * no checkpoints), every `checkpoint_epochs` epochs and/or every
+     * `checkpoint_batches` batches (every epoch if both are 0). Hogwild
+     * training only saves checkpoints at the end of epochs. */
+    const char * checkpoint_file;
+    int checkpoint_epochs;
+    int checkpoint_batches;
+    /* Elements buffered by PSTrainSource in order to shuffle the elements
+     * read from a data source (0: PS_SHUFFLE_WINDOW). */
+    int shuffle_window;
 } PSTrainingOptions;
 
+/* Streams the elements of non-recurrent training data (every input
+ * followed by its expected output, see PSTrain), so that data that doesn't
+ * fit in memory can be trained on chunk by chunk. `read` copies up to
+ * `count` next elements into `elements`, returning how many elements it
+ * copied (0 at the end of the data, -1 on errors). `rewind` restarts the
+ * source from its first element (it's called before every epoch) and
+ * returns 0 on errors. `count` is the number of elements of an epoch.
+ * Sources created by the library must be deleted by PSDeleteDataSource,
+ * which calls `close` (if any) and frees them. */
+
+typedef struct PSDataSource PSDataSource;
+
+struct PSDataSource {
+    int count;
+    int input_size;
+    int output_size;
+    int (*read) (PSDataSource * source, ps_real * elements, int count);
+    int (*rewind) (PSDataSource * source);
+    void (*close) (PSDataSource * source);
+    void * data;
+};
+
 typedef struct {
     int index;
     int weights_size;
-    double bias;
-    double * weights;
-    double activation;
-    double z_value;
+    ps_real * bias; // View on the layer's biases (NULL on layers without)
+    ps_real * weights;
+    ps_real activation;
+    ps_real z_value;
     void * extra;
     void * layer;
 } PSNeuron;
@@ -102,13 +157,25 @@ typedef struct {
     PSActivationFunction derivative;
     PSFeedforwardFunction feedforward;
     PSNeuron ** neurons;
-    double * delta;
+    ps_real * delta;
     int flags;
     void * extra;
-#ifdef USE_AVX
-    double * avx_activation_cache;
-#endif
+    void * state_arena; // States through time (see recurrent.h)
     void * network;
+    /* Contiguous layer tensors. Each neuron's `weights` and `bias`
+     * pointers are views on its row of the aligned `weights` matrix and on
+     * its element of the `biases` vector. Rows start `weights_stride`
+     * values apart: they're padded to the tensor alignment (see
+     * PSInitLayerTensors), except on LSTM layers, whose rows are packed
+     * (`weights_stride` is the size of a row) so that their gate rows also
+     * make a single gates matrix (see PSInitPackedLayerTensors and lstm.h).
+     * Activations and z-values are flat vectors indexed by neuron, that the
+     * library mirrors into the PSNeuron fields. */
+    ps_real * weights;
+    ps_real * biases;
+    ps_real * activations;
+    ps_real * z_values;
+    int weights_stride;
 } PSLayer;
 
 typedef struct {
@@ -123,14 +190,39 @@ typedef struct {
     int current_epoch;
     int current_batch;
     PSTrainCallback onEpochTrained;
+    PSGradient ** gradients; // Training workspace, reused across batches
+    void * workers; // Network replicas used by multithreaded training
+    void * checkpoints; // Background checkpoint writer used by training
+    /* Binary file loaded by PSLoadNetwork: layer tensors can be views on
+     * it, so it's kept mapped until the network is deleted. */
+    void * mapping;
+    size_t mapping_size;
 } PSNeuralNetwork;
 
+/* Inference state of a network: feedforwarding through a context only reads
+ * the network, so that many threads can share a single loaded network, each
+ * one with its own context. Contexts must be recreated if layers are added
+ * to the network, and they don't support recurrent networks. */
+
+typedef struct {
+    PSNeuralNetwork * network;
+    int batch_size;
+    int buffer_stride;
+    ps_real * buffers[2];
+    ps_real * workspace; // Convolution workspace
+    ps_real * outputs; // Output layer activations of the last feedforward
+} PSInferenceContext;
+
 extern int PSGlobalFlags;
 
 PSNeuralNetwork * PSCreateNetwork(const char* name);
 PSNeuralNetwork * PSCloneNetwork(PSNeuralNetwork * network, int layout_only);
+/* Loads a network saved either as text or in binary format (detected
+ * automatically): binary parameters are mapped from the file whenever
+ * their layout matches the current build. */
 int PSLoadNetwork(PSNeuralNetwork * network, const char* filename);
 int PSSaveNetwork(PSNeuralNetwork * network, const char* filename);
+int PSSaveNetworkBinary(PSNeuralNetwork * network, const char * filename);
 PSLayer * PSAddLayer(PSNeuralNetwork * network, PSLayerType type, int size,
                      PSLayerParameters* params);
 PSLayer * PSAddConvolutionalLayer(PSNeuralNetwork * network,
@@ -146,8 +238,16 @@ PSLayerParameters * PSCreateConvolutionalParameters(double feature_count,
                                                     int padding,
                                                     int use_relu);
 void PSDeleteLayerParamenters(PSLayerParameters * params);
-int PSFeedforward(PSNeuralNetwork * network, double * values);
-int PSClassify(PSNeuralNetwork * network, double * values);
+int PSFeedforward(PSNeuralNetwork * network, ps_real * values);
+int PSClassify(PSNeuralNetwork * network, ps_real * values);
+int PSFeedforwardBatch(PSNeuralNetwork * network, ps_real * values, int count,
+                       ps_real * outputs);
+int PSClassifyBatch(PSNeuralNetwork * network, ps_real * values, int count,
+                    int * results);
+PSInferenceContext * PSCreateInferenceContext(PSNeuralNetwork * network);
+void PSDeleteInferenceContext(PSInferenceContext * context);
+int PSContextFeedforward(PSInferenceContext * context, ps_real * values);
+int PSContextClassify(PSInferenceContext * context, ps_real * values);
 
 void PSDeleteNetwork(PSNeuralNetwork * network);
 void PSDeleteLayer(PSLayer * layer);
@@ -155,25 +255,48 @@ void PSDeleteNeuron(PSNeuron * neuron, PSLayer * layer);
 void PSDeleteGradients(PSGradient ** gradients, PSNeuralNetwork * network);
 
 void PSTrain(PSNeuralNetwork * network,
-             double * training_data,
+             ps_real * training_data,
              int data_size,
              int epochs,
              double learning_rate,
              int batch_size,
              PSTrainingOptions * options,
-             double * test_data,
+             ps_real * test_data,
              int test_size);
-float PSTest(PSNeuralNetwork * network, double * test_data, int data_size);
+float PSTest(PSNeuralNetwork * network, ps_real * test_data, int data_size);
+/* Trains a non-recurrent network on the elements read from a data source
+ * (and validates it on `test`, if it isn't NULL), keeping only a few
+ * batches and the shuffle window in memory. Shuffled elements are drawn at
+ * random from a window of the next elements of the source. */
+void PSTrainSource(PSNeuralNetwork * network,
+                   PSDataSource * training,
+                   int epochs,
+                   double learning_rate,
+                   int batch_size,
+                   PSTrainingOptions * options,
+                   PSDataSource * test);
+float PSTestSource(PSNeuralNetwork * network, PSDataSource * test);
+/* Streams `count` elements of an array of training data, starting from
+ * `first`. */
+PSDataSource * PSCreateArraySource(ps_real * data, int first, int count,
+                                   int input_size, int output_size);
+void PSDeleteDataSource(PSDataSource * source);
 int PSVerifyNetwork(PSNeuralNetwork * network);
-//int arrayMaxIndex(double * array, int len);
+//int arrayMaxIndex(ps_real * array, int len);
 char * PSGetLabelForType(PSLayerType type);
 char * PSGetLayerTypeLabel(PSLayer * layer);
 void PSPrintNetworkInfo(PSNeuralNetwork * network);
 
+/* Sets the number of threads (including the calling one) the library uses
+ * to split the work of single layers (1 disables them). Returns 0 if the
+ * threads could not be created. */
+int PSSetThreadCount(int count);
+int PSGetThreadCount();
+
 // Loss functions
 
-double PSQuadraticLoss(double * x, double * y, int size, int onehot_size);
-double PSCrossEntropyLoss(double * x, double * y, int size, int onehot_size);
+double PSQuadraticLoss(ps_real * x, ps_real * y, int size, int onehot_size);
+double PSCrossEntropyLoss(ps_real * x, ps_real * y, int size, int onehot_size);
 
 #endif // __PSYC_H
 
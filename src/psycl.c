@@ -183,22 +183,37 @@ static void getTempFileName(const char * prefix, char * buffer) {
     fclose(urand);
 }
 
-double * training_data = NULL;
-double * test_data = NULL;
-double * validation_data = NULL;
-int testlen = 0;
-int datalen = 0;
-int valdlen = 0;
+PSDataset * training_data = NULL;
+PSDataset * test_data = NULL;
 int train_dataset_len = 0;
 int eval_dataset_len = 0;
 int epochs = EPOCHS;
 float learning_rate = LEARNING_RATE;
 float l2_decay = 0.0;
 int batch_size = BATCH_SIZE;
+int training_threads = 1;
+int save_binary = 0;
+char * checkpoint_file = NULL;
+int checkpoint_epochs = 0;
+int checkpoint_batches = 0;
+int use_dataset_cache = 1;
+int stream_dataset = 0;
+int shuffle_window = 0;
 char outputFile[255];
 
 void print_help(const char* program_path);
 
+/* MNIST samples are cached in /tmp, in order to be mapped (and shared) by
+ * the following runs. They're only converted batch by batch, while the
+ * network is trained or tested on them. */
+static PSDataset * loadMNISTDataset(int type, char * images_file,
+                                    char * labels_file)
+{
+    const char * cache_file = NULL;
+    if (use_dataset_cache) cache_file = PSGetMNISTCacheFile(type);
+    return PSLoadCachedMNISTData(images_file, labels_file, cache_file);
+}
+
 int main(int argc, char ** argv) {
     PSNeuralNetwork * network = PSCreateNetwork("CLI Network");
     int i, j;
@@ -235,6 +250,16 @@ int main(int argc, char ** argv) {
             continue;
         }
         
+        if (strcmp("--no-dataset-cache", arg) == 0) {
+            use_dataset_cache = 0;
+            continue;
+        }
+        
+        if (strcmp("--binary", arg) == 0) {
+            save_binary = 1;
+            continue;
+        }
+        
         if (strcmp("--name", arg) == 0 && ++i < argc) {
             char * name = (char*) argv[i];
             network->name = name;
@@ -368,10 +393,12 @@ int main(int argc, char ** argv) {
                 imgfile = MNISTDataFiles[MNIST_TRAIN_IMAGES];
                 lblfile = MNISTDataFiles[MNIST_TRAIN_LABELS];
             }
-            if (imgfile != NULL && lblfile != NULL)
-                datalen = loadMNISTData(TRAINING_DATA, imgfile, lblfile,
-                                        &training_data);
-            if (datalen == 0 || training_data == NULL) {
+            if (imgfile != NULL && lblfile != NULL) {
+                printf("Loading MNIST Data for training...\n");
+                training_data = loadMNISTDataset(TRAINING_DATA, imgfile,
+                                                 lblfile);
+            }
+            if (training_data == NULL) {
                 fprintf(stderr, "Could not load training data!\n");
                 PSDeleteNetwork(network);
                 exit(1);
@@ -409,10 +436,11 @@ int main(int argc, char ** argv) {
                 imgfile = MNISTDataFiles[MNIST_TEST_IMAGES];
                 lblfile = MNISTDataFiles[MNIST_TEST_LABELS];
             }
-            if (imgfile != NULL && lblfile != NULL)
-                testlen = loadMNISTData(TEST_DATA, imgfile, lblfile,
-                                        &test_data);
-            if (testlen == 0 || test_data == NULL) {
+            if (imgfile != NULL && lblfile != NULL) {
+                printf("Loading MNIST Data for testing...\n");
+                test_data = loadMNISTDataset(TEST_DATA, imgfile, lblfile);
+            }
+            if (test_data == NULL) {
                 fprintf(stderr, "Could not load test data!\n");
                 PSDeleteNetwork(network);
                 exit(1);
@@ -487,11 +515,69 @@ int main(int argc, char ** argv) {
             continue;
         }
         
+        if (strcmp("--training-threads", arg) == 0 && ++i < argc) {
+            char * len_s = argv[i];
+            int matched = sscanf(len_s, "%d", &training_threads);
+            if (!matched)
+                fprintf(stderr, "Invalid threads count %s\n", len_s);
+            continue;
+        }
+        
+        if (strcmp("--checkpoint", arg) == 0 && ++i < argc) {
+            checkpoint_file = argv[i];
+            continue;
+        }
+        
+        if (strcmp("--checkpoint-epochs", arg) == 0 && ++i < argc) {
+            char * len_s = argv[i];
+            int matched = sscanf(len_s, "%d", &checkpoint_epochs);
+            if (!matched)
+                fprintf(stderr, "Invalid checkpoint epochs %s\n", len_s);
+            continue;
+        }
+        
+        if (strcmp("--stream", arg) == 0) {
+            stream_dataset = 1;
+            continue;
+        }
+        
+        if (strcmp("--shuffle-window", arg) == 0 && ++i < argc) {
+            char * len_s = argv[i];
+            int matched = sscanf(len_s, "%d", &shuffle_window);
+            if (!matched)
+                fprintf(stderr, "Invalid shuffle window %s\n", len_s);
+            continue;
+        }
+        
+        if (strcmp("--checkpoint-batches", arg) == 0 && ++i < argc) {
+            char * len_s = argv[i];
+            int matched = sscanf(len_s, "%d", &checkpoint_batches);
+            if (!matched)
+                fprintf(stderr, "Invalid checkpoint batches %s\n", len_s);
+            continue;
+        }
+        
+        if (strcmp("--threads", arg) == 0 && ++i < argc) {
+            char * len_s = argv[i];
+            int threads = 1;
+            int matched = sscanf(len_s, "%d", &threads);
+            if (!matched)
+                fprintf(stderr, "Invalid threads count %s\n", len_s);
+            else if (!PSSetThreadCount(threads))
+                fprintf(stderr, "Could not create %d threads\n", threads);
+            continue;
+        }
+        
         if (strcmp("--training-no-shuffle", arg) == 0) {
             training_flags |= TRAINING_NO_SHUFFLE;
             continue;
         }
         
+        if (strcmp("--training-hogwild", arg) == 0) {
+            training_flags |= TRAINING_HOGWILD;
+            continue;
+        }
+        
         if (strcmp("--training-adjust-rate", arg) == 0) {
             training_flags |= TRAINING_ADJUST_RATE;
             continue;
@@ -513,11 +599,11 @@ int main(int argc, char ** argv) {
         
     }
     if (training_data != NULL) {
-        int element_size = network->input_size + network->output_size;
-        int element_count = datalen / element_size;
+        int element_count = training_data->count;
         if (element_count < train_dataset_len) {
             fprintf(stderr, "Loaded dataset elements %d < %d\n", element_count,
                    train_dataset_len);
+            PSDeleteDataset(training_data);
             PSDeleteNetwork(network);
             return 1;
         } else {
@@ -532,25 +618,46 @@ int main(int argc, char ** argv) {
                         "WARNING: no dataset remaining for evaluation!\n");
                 eval_dataset_len = remaining;
             }
-            datalen = train_dataset_len * element_size;
-            if (eval_dataset_len == 0) validation_data = NULL;
-            else {
-                validation_data = training_data + datalen;
-                valdlen = eval_dataset_len * element_size;
-            }
         }
         
+        if (save_binary) training_flags |= TRAINING_BINARY_CHECKPOINTS;
+        PSDataSource * training, * validation = NULL;
+        if (stream_dataset || (training_flags & TRAINING_NO_SHUFFLE)) {
+            // Samples are read sequentially and shuffled within a window
+            training = PSCreateMNISTSource(training_data, 0,
+                                           train_dataset_len);
+        } else {
+            // The source shuffles the whole range by itself
+            training = PSCreateShuffledMNISTSource(training_data, 0,
+                                                   train_dataset_len);
+            training_flags |= TRAINING_NO_SHUFFLE;
+        }
+        if (eval_dataset_len > 0) {
+            validation = PSCreateMNISTSource(training_data, train_dataset_len,
+                                             eval_dataset_len);
+        }
         PSTrainingOptions options = {
             .flags = training_flags,
-            .l2_decay = (double) l2_decay
+            .l2_decay = (double) l2_decay,
+            .threads = training_threads,
+            .checkpoint_file = checkpoint_file,
+            .checkpoint_epochs = checkpoint_epochs,
+            .checkpoint_batches = checkpoint_batches,
+            .shuffle_window = shuffle_window
         };
-        PSTrain(network, training_data, datalen, epochs, learning_rate,
-                batch_size, &options, validation_data, valdlen);
-        free(training_data);
+        if (training != NULL)
+            PSTrainSource(network, training, epochs, learning_rate,
+                          batch_size, &options, validation);
+        PSDeleteDataSource(training);
+        PSDeleteDataSource(validation);
+        PSDeleteDataset(training_data);
     }
     if (test_data != NULL) {
-        PSTest(network, test_data, testlen);
-        free(test_data);
+        PSDataSource * test = PSCreateMNISTSource(test_data, 0,
+                                                  test_data->count);
+        if (test != NULL) PSTestSource(network, test);
+        PSDeleteDataSource(test);
+        PSDeleteDataset(test_data);
     }
     
 #ifdef HAS_MAGICK
@@ -569,9 +676,13 @@ int main(int argc, char ** argv) {
         if (!outfile_len) {
             getTempFileName("saved-network", outputFile);
         }
-        int saved = PSSaveNetwork(network, outputFile);
+        int saved;
+        if (save_binary) saved = PSSaveNetworkBinary(network, outputFile);
+        else saved = PSSaveNetwork(network, outputFile);
         if (!saved) {
             fprintf(stderr, "Could not save network to %s\n", outputFile);
+            PSDeleteNetwork(network);
+            return 1;
         } else {
             printf("Network saved to %s\n", outputFile);
         }
@@ -586,6 +697,7 @@ void print_help(const char* program_path) {
     printf("OPTIONS:\n");
     printf("        --load PRETRAINED           Load a pretrained network\n");
     printf("        --save FILE                 Save network\n");
+    printf("        --binary                    Save in binary format\n");
     printf("        --name NAME                 Network name\n");
     printf("        --layer TYPE SIZE|OPTIONS   Add layer\n");
     printf("        --onehot                    "
@@ -595,6 +707,8 @@ void print_help(const char* program_path) {
     printf("                                    (if after output layer)\n");
     printf("        --train TRAIN_DATASET       Train network\n");
     printf("        --test TEST_DATASET         Perform tests\n");
+    printf("        --no-dataset-cache          Don't cache the following "
+           "datasets\n");
 #ifdef HAS_MAGICK
     printf("        --classify-image FILE [OPT] Perform tests\n");
 #endif
@@ -607,8 +721,22 @@ void print_help(const char* program_path) {
     printf("        --learning-rate SIZE        Train. learn rate (def. %f)\n",
            LEARNING_RATE);
     printf("        --l2-decay SIZE             L2 Weight Decay (def. 0)\n");
+    printf("        --threads COUNT             Layers threads (def. 1)\n");
+    printf("        --training-threads COUNT    Train. threads (def. 1)\n");
+    printf("        --training-hogwild          Lock-free threads updates\n");
     printf("        --training-no-shuffle       Prevent dataset shuffle\n");
     printf("        --training-adjust-rate      Auto-adjust learn rate\n");
+    printf("        --checkpoint FILE           Save checkpoints while "
+           "training\n");
+    printf("        --checkpoint-epochs COUNT   Epochs between checkpoints\n");
+    printf("        --checkpoint-batches COUNT  Batches between "
+           "checkpoints\n");
+    printf("        --stream                    Read training data "
+           "sequentially\n");
+    printf("        --shuffle-window COUNT      Streamed samples shuffled "
+           "together\n");
+    printf("                                    (def. %d)\n",
+           PS_SHUFFLE_WINDOW);
     printf("    -v, --version                   Print version\n");
     printf("    -h, --help                      Print this help\n");
     printf("\n");
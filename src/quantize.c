@@ -0,0 +1,631 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "psyc.h"
+#include "utils.h"
+#include "convolutional.h"
+#include "gemm.h"
+#include "quantize.h"
+
+#define getQuantStride(size) (((size) + PS_QUANT_ROW_ALIGNMENT - 1) / \
+    PS_QUANT_ROW_ALIGNMENT * PS_QUANT_ROW_ALIGNMENT)
+
+typedef struct {
+    int feature_count;
+    int region_size;
+    int input_w;
+    int output_w;
+    int input_size;
+} PSQuantPooling;
+
+typedef struct {
+    float min;
+    float max;
+} PSQuantRange;
+
+#define PS_QUANT_LEVELS PS_QUANT_MAX_ACTIVATION
+
+/* Utils */
+
+static inline uint8_t quantizeValue(PSQuantParams * params, float val) {
+    int q = (int) roundf(val / params->scale) + params->zero_point;
+    if (q < 0) q = 0;
+    else if (q > PS_QUANT_MAX_ACTIVATION) q = PS_QUANT_MAX_ACTIVATION;
+    return (uint8_t) q;
+}
+
+static inline float dequantizeValue(PSQuantParams * params, uint8_t q) {
+    return params->scale * (float) ((int) q - params->zero_point);
+}
+
+/* Single precision versions of the most common activation functions, since
+ * they dominate the cost of the quantized layers. */
+
+static inline float activate(PSQuantizedLayer * layer, float z) {
+    if (layer->activate == sigmoid) return 1.0f / (1.0f + expf(-z));
+    else if (layer->activate == relu) return (z >= 0.0f ? z : 0.0f);
+    return (float) layer->activate(z);
+}
+
+/* The last layer stores real values into 'real_out', every other layer
+ * stores quantized values into 'out'. */
+
+static inline void storeActivation(PSQuantizedLayer * layer, uint8_t * out,
+                                   float * real_out, int idx, float val)
+{
+    if (real_out != NULL) real_out[idx] = val;
+    else out[idx] = quantizeValue(&(layer->output), val);
+}
+
+/* Zero is always exactly representable, so that zero padding and pooling
+ * (which starts from zero) behave as in the original network. */
+
+static void getQuantParams(PSQuantRange * range, PSQuantParams * params) {
+    float min = (range->min < 0.0f ? range->min : 0.0f);
+    float max = (range->max > 0.0f ? range->max : 0.0f);
+    if (max - min <= 0.0f) {
+        params->scale = 1.0f;
+        params->zero_point = 0;
+        return;
+    }
+    params->scale = (max - min) / (float) PS_QUANT_MAX_ACTIVATION;
+    params->zero_point = (int) roundf(-min / params->scale);
+}
+
+/* Inverse of the activation function: returns 0 if it is unknown. Values
+ * outside of the function's range are mapped to +/- HUGE_VAL. */
+
+static int inverseActivation(PSActivationFunction activate, double y,
+                             double * z)
+{
+    if (activate == sigmoid) {
+        if (y <= 0.0) *z = -HUGE_VAL;
+        else if (y >= 1.0) *z = HUGE_VAL;
+        else *z = log(y / (1.0 - y));
+    } else if (activate == relu) {
+        *z = (y <= 0.0 ? -HUGE_VAL : y);
+    } else return 0;
+    return 1;
+}
+
+/* The quantized output of a row is a step function of its accumulated sum,
+ * since the activation is monotonic: the thresholds are the sums at which
+ * each step (level) begins, so that the output can be found without leaving
+ * the integer domain. */
+
+static int createThresholds(PSQuantizedLayer * layer) {
+    int i, k;
+    double z;
+    if (!inverseActivation(layer->activate, 0.5, &z)) return 1;
+    layer->thresholds = malloc(layer->rows * PS_QUANT_LEVELS *
+                               sizeof(int32_t));
+    if (layer->thresholds == NULL) return 0;
+    PSQuantParams * out = &(layer->output);
+    for (i = 0; i < layer->rows; i++) {
+        int32_t * thresholds = layer->thresholds + (i * PS_QUANT_LEVELS);
+        double scale = layer->scales[i], bias = layer->biases[i];
+        double correction = (double) layer->input.zero_point *
+                            (double) layer->row_sums[i];
+        for (k = 1; k <= PS_QUANT_LEVELS; k++) {
+            // Outputs are rounded: level k begins halfway from level k - 1
+            double y = ((double) (k - out->zero_point) - 0.5) * out->scale;
+            double sum;
+            inverseActivation(layer->activate, y, &z);
+            sum = ceil((z - bias) / scale + correction);
+            if (sum <= (double) INT32_MIN) sum = (double) INT32_MIN;
+            else if (sum >= (double) INT32_MAX) sum = (double) INT32_MAX;
+            thresholds[k - 1] = (int32_t) sum;
+        }
+    }
+    return 1;
+}
+
+// Branchless binary search of the level of 'sum' among the thresholds
+
+static inline uint8_t requantize(int32_t * thresholds, int32_t sum) {
+    int q = 0;
+    q += (sum >= thresholds[q + 63] ? 64 : 0);
+    q += (sum >= thresholds[q + 31] ? 32 : 0);
+    q += (sum >= thresholds[q + 15] ? 16 : 0);
+    q += (sum >= thresholds[q + 7] ? 8 : 0);
+    q += (sum >= thresholds[q + 3] ? 4 : 0);
+    q += (sum >= thresholds[q + 1] ? 2 : 0);
+    q += (sum >= thresholds[q] ? 1 : 0);
+    return (uint8_t) q;
+}
+
+static int arrayMaxIndex(float * array, int len) {
+    int i, max_idx = 0;
+    float max = array[0];
+    for (i = 1; i < len; i++) {
+        if (array[i] > max) {
+            max = array[i];
+            max_idx = i;
+        }
+    }
+    return max_idx;
+}
+
+/* Calibration
+ *
+ * Feeds 'count' samples through the floating point network and records the
+ * range of every layer's activations. */
+
+static int calibrate(PSNeuralNetwork * network, ps_real * data, int count,
+                     int element_size, PSQuantRange * ranges)
+{
+    int i, j, l;
+    for (l = 0; l < network->size; l++) {
+        ranges[l].min = 0.0f;
+        ranges[l].max = 0.0f;
+    }
+    for (i = 0; i < count; i++) {
+        if (!PSFeedforward(network, data + (i * element_size))) return 0;
+        for (l = 0; l < network->size; l++) {
+            PSLayer * layer = network->layers[l];
+            PSQuantRange * range = ranges + l;
+            for (j = 0; j < layer->size; j++) {
+                float a = (float) layer->activations[j];
+                if (a < range->min) range->min = a;
+                if (a > range->max) range->max = a;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Quantization */
+
+static int quantizeWeights(PSQuantizedLayer * qlayer, PSLayer * layer,
+                           int rows, int weights_size)
+{
+    int i, w;
+    qlayer->rows = rows;
+    qlayer->weights_size = weights_size;
+    qlayer->weights_stride = getQuantStride(weights_size);
+    qlayer->weights = calloc(rows * qlayer->weights_stride, sizeof(int8_t));
+    qlayer->scales = calloc(rows, sizeof(float));
+    qlayer->row_sums = calloc(rows, sizeof(int32_t));
+    qlayer->biases = calloc(rows, sizeof(float));
+    if (qlayer->weights == NULL || qlayer->scales == NULL ||
+        qlayer->row_sums == NULL || qlayer->biases == NULL) {
+        printMemoryErrorMsg();
+        return 0;
+    }
+    for (i = 0; i < rows; i++) {
+        ps_real * weights = layer->weights + (i * layer->weights_stride);
+        int8_t * qweights = qlayer->weights + (i * qlayer->weights_stride);
+        float max = 0.0f, scale;
+        int32_t sum = 0;
+        for (w = 0; w < weights_size; w++) {
+            float v = fabsf((float) weights[w]);
+            if (v > max) max = v;
+        }
+        scale = (max > 0.0f ? max / (float) PS_QUANT_MAX_WEIGHT : 1.0f);
+        for (w = 0; w < weights_size; w++) {
+            int q = (int) roundf((float) weights[w] / scale);
+            if (q > PS_QUANT_MAX_WEIGHT) q = PS_QUANT_MAX_WEIGHT;
+            else if (q < -PS_QUANT_MAX_WEIGHT) q = -PS_QUANT_MAX_WEIGHT;
+            qweights[w] = (int8_t) q;
+            sum += q;
+        }
+        qlayer->scales[i] = scale * qlayer->input.scale;
+        qlayer->row_sums[i] = sum;
+        qlayer->biases[i] = (float) layer->biases[i];
+    }
+    return 1;
+}
+
+static PSQuantizedLayer * quantizeLayer(PSNeuralNetwork * network,
+                                        PSLayer * layer, PSQuantRange * range,
+                                        PSQuantizedLayer * previous)
+{
+    char * func = "PSQuantizeNetwork";
+    PSQuantizedLayer * qlayer = calloc(1, sizeof(PSQuantizedLayer));
+    if (qlayer == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    qlayer->type = layer->type;
+    qlayer->index = layer->index;
+    qlayer->size = layer->size;
+    qlayer->activate = layer->activate;
+    getQuantParams(range, &(qlayer->output));
+    if (previous == NULL) return qlayer;
+    qlayer->input = previous->output;
+    PSLayer * previous_layer = network->layers[layer->index - 1];
+    int ok = 1;
+    if (layer->type == FullyConnected || layer->type == SoftMax) {
+        if (layer->type == SoftMax && layer->index != network->size - 1) {
+            PSErr(func, "Layer[%d]: SoftMax must be the output layer",
+                  layer->index);
+            ok = 0;
+        } else ok = quantizeWeights(qlayer, layer, layer->size,
+                                    previous_layer->size);
+    } else if (layer->type == Convolutional) {
+        PSSharedParams * shared = getConvSharedParams(layer);
+        PSConvGeometry * g = malloc(sizeof(PSConvGeometry));
+        qlayer->extra = g;
+        if (g == NULL) printMemoryErrorMsg();
+        ok = (g != NULL && quantizeWeights(qlayer, layer,
+                                           shared->feature_count,
+                                           shared->weights_size));
+        if (ok) {
+            PSGetConvGeometry(layer, previous_layer, g);
+            g->col_stride = qlayer->weights_stride;
+        }
+    } else if (layer->type == Pooling) {
+        double * params = layer->parameters->parameters;
+        double * previous_params = previous_layer->parameters->parameters;
+        PSQuantPooling * pooling = malloc(sizeof(PSQuantPooling));
+        qlayer->extra = pooling;
+        // Max pooling doesn't change the range of its inputs
+        qlayer->output = qlayer->input;
+        if (pooling != NULL) {
+            pooling->feature_count = (int) (params[PARAM_FEATURE_COUNT]);
+            pooling->region_size = (int) (params[PARAM_REGION_SIZE]);
+            pooling->input_w = (int) (previous_params[PARAM_OUTPUT_WIDTH]);
+            pooling->output_w = (int) (params[PARAM_OUTPUT_WIDTH]);
+            pooling->input_size = previous_layer->size /
+                                  pooling->feature_count;
+        } else {
+            printMemoryErrorMsg();
+            ok = 0;
+        }
+    } else {
+        PSErr(func, "Layer[%d]: %s layers cannot be quantized",
+              layer->index, PSGetLayerTypeLabel(layer));
+        ok = 0;
+    }
+    // The output layer always computes real values
+    if (ok && qlayer->weights != NULL && layer->type != SoftMax &&
+        layer->index < network->size - 1)
+    {
+        ok = createThresholds(qlayer);
+        if (!ok) printMemoryErrorMsg();
+    }
+    if (!ok) {
+        free(qlayer->thresholds);
+        free(qlayer->weights);
+        free(qlayer->scales);
+        free(qlayer->row_sums);
+        free(qlayer->biases);
+        free(qlayer->extra);
+        free(qlayer);
+        return NULL;
+    }
+    return qlayer;
+}
+
+static int createWorkspace(PSQuantizedNetwork * qnet) {
+    int i, activations_size = 0, col_size = 0, accumulators_size = 0;
+    for (i = 0; i < qnet->size; i++) {
+        PSQuantizedLayer * layer = qnet->layers[i];
+        int size = getQuantStride(layer->size), acc_size = layer->rows;
+        if (size > activations_size) activations_size = size;
+        if (layer->type == Convolutional) {
+            PSConvGeometry * g = (PSConvGeometry *) layer->extra;
+            int csize = g->feature_size * g->col_stride;
+            if (csize > col_size) col_size = csize;
+            acc_size = g->feature_size * g->features_per_map;
+        }
+        if (acc_size > accumulators_size) accumulators_size = acc_size;
+    }
+    // Padding is read by the kernels (and multiplied by zero weights), so
+    // buffers are zeroed once here.
+    qnet->activations[0] = calloc(activations_size, sizeof(uint8_t));
+    qnet->activations[1] = calloc(activations_size, sizeof(uint8_t));
+    qnet->col = calloc(col_size > 0 ? col_size : 1, sizeof(uint8_t));
+    qnet->accumulators = calloc(accumulators_size > 0 ? accumulators_size : 1,
+                                sizeof(int32_t));
+    qnet->outputs = calloc(qnet->output_size, sizeof(float));
+    return (qnet->activations[0] != NULL && qnet->activations[1] != NULL &&
+            qnet->col != NULL && qnet->accumulators != NULL &&
+            qnet->outputs != NULL);
+}
+
+/* Creates an inference-only INT8 copy of 'network'. The activation ranges
+ * are calibrated on the first 'samples' elements of 'calibration_data'
+ * (every element is made of its inputs followed by its expected outputs,
+ * as in PSTest): if 'samples' is <= 0, all the elements are used.
+ * Supported layers are FullyConnected, Convolutional, Pooling and SoftMax.
+ * The source network's activations are overwritten during calibration. */
+
+PSQuantizedNetwork * PSQuantizeNetwork(PSNeuralNetwork * network,
+                                       ps_real * calibration_data,
+                                       int data_size, int samples)
+{
+    char * func = "PSQuantizeNetwork";
+    if (network == NULL || calibration_data == NULL) return NULL;
+    if (network->size < 2) {
+        PSErr(func, "Network must have at least 2 layers");
+        return NULL;
+    }
+    if (network->flags & FLAG_RECURRENT) {
+        PSErr(func, "Recurrent networks cannot be quantized");
+        return NULL;
+    }
+    int element_size = network->input_size + network->output_size;
+    int count = data_size / element_size, i;
+    if (samples > 0 && samples < count) count = samples;
+    if (count <= 0) {
+        PSErr(func, "No calibration data");
+        return NULL;
+    }
+    PSQuantRange * ranges = malloc(network->size * sizeof(PSQuantRange));
+    if (ranges == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    if (!calibrate(network, calibration_data, count, element_size, ranges)) {
+        PSErr(func, "Calibration failed");
+        free(ranges);
+        return NULL;
+    }
+    PSQuantizedNetwork * qnet = calloc(1, sizeof(PSQuantizedNetwork));
+    if (qnet == NULL) {
+        printMemoryErrorMsg();
+        free(ranges);
+        return NULL;
+    }
+    qnet->name = network->name;
+    qnet->input_size = network->input_size;
+    qnet->output_size = network->output_size;
+    qnet->layers = calloc(network->size, sizeof(PSQuantizedLayer *));
+    if (qnet->layers == NULL) {
+        printMemoryErrorMsg();
+        free(ranges);
+        PSDeleteQuantizedNetwork(qnet);
+        return NULL;
+    }
+    PSQuantizedLayer * previous = NULL;
+    for (i = 0; i < network->size; i++) {
+        PSQuantizedLayer * qlayer = quantizeLayer(network, network->layers[i],
+                                                  ranges + i, previous);
+        if (qlayer == NULL) {
+            free(ranges);
+            PSDeleteQuantizedNetwork(qnet);
+            return NULL;
+        }
+        qnet->layers[i] = qlayer;
+        qnet->size++;
+        previous = qlayer;
+    }
+    free(ranges);
+    if (!createWorkspace(qnet)) {
+        printMemoryErrorMsg();
+        PSDeleteQuantizedNetwork(qnet);
+        return NULL;
+    }
+    return qnet;
+}
+
+void PSDeleteQuantizedNetwork(PSQuantizedNetwork * network) {
+    if (network == NULL) return;
+    int i;
+    if (network->layers != NULL) {
+        for (i = 0; i < network->size; i++) {
+            PSQuantizedLayer * layer = network->layers[i];
+            if (layer == NULL) continue;
+            free(layer->weights);
+            free(layer->scales);
+            free(layer->row_sums);
+            free(layer->biases);
+            free(layer->thresholds);
+            free(layer->extra);
+            free(layer);
+        }
+        free(network->layers);
+    }
+    free(network->activations[0]);
+    free(network->activations[1]);
+    free(network->col);
+    free(network->accumulators);
+    free(network->outputs);
+    free(network);
+}
+
+/* Feedforward Functions */
+
+static void quantizedFullFeedforward(PSQuantizedLayer * layer, uint8_t * in,
+                                     uint8_t * out, int32_t * acc,
+                                     float * real_out)
+{
+    int i, size = layer->size, zero_point = layer->input.zero_point;
+    PSGemmU8S8NT(1, size, layer->weights_stride, in, layer->weights_stride,
+                 layer->weights, layer->weights_stride, acc, size);
+    if (layer->type == SoftMax) {
+        // SoftMax is always the output layer
+        float max = 0.0f, esum = 0.0f;
+        for (i = 0; i < size; i++) {
+            float z = layer->scales[i] *
+                      (float) (acc[i] - zero_point * layer->row_sums[i]) +
+                      layer->biases[i];
+            real_out[i] = z;
+            if (i == 0 || z > max) max = z;
+        }
+        for (i = 0; i < size; i++) {
+            real_out[i] = expf(real_out[i] - max);
+            esum += real_out[i];
+        }
+        for (i = 0; i < size; i++) real_out[i] /= esum;
+        return;
+    }
+    for (i = 0; i < size; i++) {
+        if (real_out == NULL && layer->thresholds != NULL) {
+            out[i] = requantize(layer->thresholds + (i * PS_QUANT_LEVELS),
+                                acc[i]);
+            continue;
+        }
+        float z = layer->scales[i] *
+                  (float) (acc[i] - zero_point * layer->row_sums[i]) +
+                  layer->biases[i];
+        storeActivation(layer, out, real_out, i, activate(layer, z));
+    }
+}
+
+// Same as im2col in convolutional.c, on quantized values
+
+static void quantizedIm2col(uint8_t * input, PSConvGeometry * g,
+                            uint8_t * col)
+{
+    int row, c, y;
+    for (row = 0; row < g->output_h; row++) {
+        uint8_t * input_row = input + (row * g->stride * g->input_w);
+        for (c = 0; c < g->output_w; c++) {
+            uint8_t * region = input_row + (c * g->stride);
+            uint8_t * dst = col + (((row * g->output_w) + c) * g->col_stride);
+            for (y = 0; y < g->region_size; y++) {
+                memcpy(dst, region, g->region_size);
+                dst += g->region_size;
+                region += g->input_w;
+            }
+        }
+    }
+}
+
+static void quantizedConvolve(PSQuantizedLayer * layer, uint8_t * in,
+                              uint8_t * out, uint8_t * col, int32_t * acc,
+                              float * real_out)
+{
+    PSConvGeometry * g = (PSConvGeometry *) layer->extra;
+    int map, f, i, zero_point = layer->input.zero_point;
+    for (map = 0; map < g->maps; map++) {
+        int first = map * g->features_per_map;
+        quantizedIm2col(in + (map * g->map_size), g, col);
+        // Every row of the result holds all the positions of a feature
+        PSGemmS8U8NT(g->features_per_map, g->feature_size, g->col_stride,
+                     layer->weights + (first * layer->weights_stride),
+                     layer->weights_stride, col, g->col_stride, acc,
+                     g->feature_size);
+        for (f = 0; f < g->features_per_map; f++) {
+            int feature = first + f;
+            float scale = layer->scales[feature];
+            float bias = layer->biases[feature];
+            int32_t correction = zero_point * layer->row_sums[feature];
+            int32_t * sums = acc + (f * g->feature_size);
+            int offset = feature * g->feature_size;
+            if (real_out == NULL && layer->thresholds != NULL) {
+                int32_t * thresholds = layer->thresholds +
+                                       (feature * PS_QUANT_LEVELS);
+                for (i = 0; i < g->feature_size; i++)
+                    out[offset + i] = requantize(thresholds, sums[i]);
+                continue;
+            }
+            for (i = 0; i < g->feature_size; i++) {
+                float z = scale * (float) (sums[i] - correction) + bias;
+                storeActivation(layer, out, real_out, offset + i,
+                                activate(layer, z));
+            }
+        }
+    }
+}
+
+static void quantizedPool(PSQuantizedLayer * layer, uint8_t * in,
+                          uint8_t * out, float * real_out)
+{
+    PSQuantPooling * pooling = (PSQuantPooling *) layer->extra;
+    int feature_size = layer->size / pooling->feature_count;
+    int region_size = pooling->region_size, i, j, x, y;
+    for (i = 0; i < pooling->feature_count; i++) {
+        uint8_t * input = in + (i * pooling->input_size);
+        for (j = 0; j < feature_size; j++) {
+            int r_row = (j / pooling->output_w) * region_size;
+            int r_col = (j % pooling->output_w) * region_size;
+            // The same scale is used by inputs and outputs, so the maximum
+            // can be taken directly on the quantized values
+            uint8_t max = (uint8_t) layer->input.zero_point;
+            for (y = r_row; y < r_row + region_size; y++) {
+                uint8_t * row = input + (y * pooling->input_w);
+                for (x = r_col; x < r_col + region_size; x++)
+                    if (row[x] > max) max = row[x];
+            }
+            int idx = (i * feature_size) + j;
+            if (real_out != NULL)
+                real_out[idx] = dequantizeValue(&(layer->input), max);
+            else out[idx] = max;
+        }
+    }
+}
+
+int PSQuantizedFeedforward(PSQuantizedNetwork * network, ps_real * values,
+                           ps_real * outputs)
+{
+    if (network == NULL || values == NULL) return 0;
+    PSQuantizedLayer * first = network->layers[0];
+    uint8_t * in = network->activations[0], * out = network->activations[1];
+    uint8_t * tmp;
+    int i;
+    for (i = 0; i < network->input_size; i++)
+        in[i] = quantizeValue(&(first->output), (float) values[i]);
+    for (i = 1; i < network->size; i++) {
+        PSQuantizedLayer * layer = network->layers[i];
+        float * real_out = (i == network->size - 1 ? network->outputs : NULL);
+        if (layer->type == Convolutional)
+            quantizedConvolve(layer, in, out, network->col,
+                              network->accumulators, real_out);
+        else if (layer->type == Pooling)
+            quantizedPool(layer, in, out, real_out);
+        else
+            quantizedFullFeedforward(layer, in, out, network->accumulators,
+                                     real_out);
+        tmp = in;
+        in = out;
+        out = tmp;
+    }
+    if (outputs != NULL) {
+        for (i = 0; i < network->output_size; i++)
+            outputs[i] = (ps_real) network->outputs[i];
+    }
+    return 1;
+}
+
+int PSQuantizedClassify(PSQuantizedNetwork * network, ps_real * values) {
+    if (!PSQuantizedFeedforward(network, values, NULL)) return -1;
+    return arrayMaxIndex(network->outputs, network->output_size);
+}
+
+/* Returns the accuracy on 'test_data', which has the same layout used by
+ * PSTest. */
+
+float PSQuantizedTest(PSQuantizedNetwork * network, ps_real * test_data,
+                      int data_size)
+{
+    if (network == NULL || test_data == NULL) return -999.0f;
+    int input_size = network->input_size;
+    int output_size = network->output_size;
+    int element_size = input_size + output_size;
+    int elements_count = data_size / element_size;
+    int correct_results = 0, i, j;
+    if (elements_count <= 0) return 0.0f;
+    for (i = 0; i < elements_count; i++) {
+        ps_real * expected = test_data + input_size;
+        int omax = PSQuantizedClassify(network, test_data);
+        if (omax < 0) return -999.0f;
+        int emax = 0;
+        for (j = 1; j < output_size; j++)
+            if (expected[j] > expected[emax]) emax = j;
+        if (omax == emax) correct_results++;
+        test_data += element_size;
+    }
+    return (float) correct_results / (float) elements_count;
+}
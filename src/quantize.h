@@ -0,0 +1,88 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef __PS_QUANTIZE_H
+#define __PS_QUANTIZE_H
+
+#include <stdint.h>
+#include "psyc.h"
+
+/* Post-training INT8 quantization.
+ * Weights are stored as signed 8-bit values, with a scale for every row
+ * (neuron or feature). Activations are stored as unsigned values in the
+ * range [0, PS_QUANT_MAX_ACTIVATION], with a scale and a zero point for
+ * every layer, calibrated on a sample of data. Biases, activation functions
+ * and SoftMax outputs are still computed in floating point. */
+
+#define PS_QUANT_MAX_ACTIVATION 127
+#define PS_QUANT_MAX_WEIGHT     127
+
+/* Rows of weights and unrolled inputs are padded with zeros to a whole
+ * number of 256-bit vectors. */
+#define PS_QUANT_ROW_ALIGNMENT  32
+
+typedef struct {
+    float scale;
+    int zero_point;
+} PSQuantParams;
+
+typedef struct {
+    PSLayerType type;
+    int index;
+    int size;
+    int rows;
+    int weights_size;
+    int weights_stride;
+    int8_t * weights;
+    float * scales; // Weights row scale multiplied by the input scale
+    int32_t * row_sums; // Sum of every weights row (zero point correction)
+    float * biases;
+    /* Smallest accumulated sum reaching each of the quantized output
+     * levels, for every row: NULL when the activation function isn't
+     * monotonic or its inverse isn't known (outputs are then computed in
+     * floating point). */
+    int32_t * thresholds;
+    PSQuantParams input;
+    PSQuantParams output;
+    PSActivationFunction activate;
+    void * extra; // Convolution geometry or pooling parameters
+} PSQuantizedLayer;
+
+typedef struct {
+    const char * name;
+    int size;
+    int input_size;
+    int output_size;
+    PSQuantizedLayer ** layers;
+    /* Inference workspace */
+    uint8_t * activations[2];
+    uint8_t * col;
+    int32_t * accumulators;
+    float * outputs;
+} PSQuantizedNetwork;
+
+PSQuantizedNetwork * PSQuantizeNetwork(PSNeuralNetwork * network,
+                                       ps_real * calibration_data,
+                                       int data_size, int samples);
+int PSQuantizedFeedforward(PSQuantizedNetwork * network, ps_real * values,
+                           ps_real * outputs);
+int PSQuantizedClassify(PSQuantizedNetwork * network, ps_real * values);
+float PSQuantizedTest(PSQuantizedNetwork * network, ps_real * test_data,
+                      int data_size);
+void PSDeleteQuantizedNetwork(PSQuantizedNetwork * network);
+
+#endif //__PS_QUANTIZE_H
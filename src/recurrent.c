@@ -28,56 +28,86 @@
 
 #include "recurrent.h"
 #include "utils.h"
+#include "gemm.h"
 
 PSRecurrentCell * PSCreateRecurrentCell(PSNeuron * neuron, int lsize) {
     PSRecurrentCell * cell = malloc(sizeof(PSRecurrentCell));
     if (cell == NULL) return NULL;
-    cell->states_count = 0;
-    cell->states = NULL;
     cell->weights_size = lsize;
     if (!lsize) cell->weights = NULL;
     else cell->weights = neuron->weights + (neuron->weights_size - lsize);
     return cell;
 }
 
-double * PSAddRecurrentState(PSNeuron * neuron, double state, int times, int t)
-{
-    PSRecurrentCell * cell = GetRecurrentCell(neuron);
-    if (cell == NULL) {
-        cell = PSCreateRecurrentCell(neuron, 0);
-        neuron->extra = cell;
-        if (cell == NULL) return NULL;
+PSStateArena * PSPrepareStateArena(PSLayer * layer, int count, int times) {
+    PSStateArena * arena = GetStateArena(layer);
+    if (arena == NULL) {
+        arena = calloc(1, sizeof(PSStateArena));
+        if (arena == NULL) {
+            printMemoryErrorMsg();
+            return NULL;
+        }
+        arena->size = layer->size;
+        layer->state_arena = arena;
     }
-    if (t == 0) {
-        cell->states_count = times;
-        if (cell->states != NULL) free(cell->states);
-        cell->states = malloc(times * sizeof(double));
-        if (cell->states == NULL) {
-            neuron->extra = NULL;
-            free(cell);
+    if (times > arena->capacity || count > arena->count) {
+        int capacity = arena->capacity, i;
+        if (capacity < PS_MIN_STATE_STEPS) capacity = PS_MIN_STATE_STEPS;
+        while (capacity < times) capacity *= 2;
+        if (count < arena->count) count = arena->count;
+        size_t stride = getTensorStride((size_t) capacity * arena->size);
+        ps_real * data = PSCreateTensor(count * stride);
+        if (data == NULL) {
+            printMemoryErrorMsg();
             return NULL;
         }
+        memset(data, 0, count * stride * sizeof(ps_real));
+        free(arena->data);
+        arena->data = data;
+        arena->capacity = capacity;
+        arena->count = count;
+        for (i = 0; i < count; i++) arena->buffers[i] = data + (i * stride);
     }
-    cell->states[t] = state;
-#ifdef USE_AVX
-    PSLayer * layer = getNeuronLayer(neuron);
-    assert(layer != NULL);
-    int lsize = layer->size;
-    if (t == 0 && neuron->index == 0) {
-        if (layer->avx_activation_cache != NULL)
-            free(layer->avx_activation_cache);
-        layer->avx_activation_cache = calloc(lsize * times, sizeof(double));
+    arena->times = times;
+    return arena;
+}
+
+ps_real * PSPrepareStateProjections(PSLayer * layer, int size) {
+    PSStateArena * arena = GetStateArena(layer);
+    if (arena == NULL) return NULL;
+    size_t length = (size_t) arena->capacity * size;
+    if (length > arena->projections_length) {
+        ps_real * projections = PSCreateTensor(length);
+        if (projections == NULL) {
+            printMemoryErrorMsg();
+            return NULL;
+        }
+        free(arena->projections);
+        arena->projections = projections;
+        arena->projections_length = length;
     }
-    if (layer->avx_activation_cache == NULL) {
-        printMemoryErrorMsg();
-        neuron->extra = NULL;
-        if (cell->states != NULL) free(cell->states);
-        free(cell);
-        return NULL;
+    arena->projection_size = size;
+    return arena->projections;
+}
+
+void PSDeleteStateArena(PSStateArena * arena) {
+    if (arena == NULL) return;
+    free(arena->projections);
+    free(arena->data);
+    free(arena);
+}
+
+ps_real * PSAddRecurrentStates(PSLayer * layer, ps_real * states, int times,
+                               int t)
+{
+    PSStateArena * arena = GetStateArena(layer);
+    if (t == 0 || arena == NULL) {
+        arena = PSPrepareStateArena(layer, 1, times);
+        if (arena == NULL) return NULL;
     }
-    layer->avx_activation_cache[(t * lsize) + neuron->index] = state;
-#endif
-    return cell->states;
+    ps_real * dest = arena->buffers[0] + ((size_t) t * layer->size);
+    memcpy(dest, states, layer->size * sizeof(ps_real));
+    return dest;
 }
 
 /* Init Functions */
@@ -88,15 +118,17 @@ int PSInitRecurrentLayer(PSNeuralNetwork * network, PSLayer * layer,
     int i, j;
     ws += size;
     char * func = "PSInitRecurrentLayer";
-    layer->neurons = malloc(sizeof(PSNeuron*) * size);
-    /*#ifdef USE_AVX
-     layer->avx_activation_cache = calloc(size, sizeof(double));
-     #endif*/
+    layer->neurons = calloc(size, sizeof(PSNeuron*));
     if (layer->neurons == NULL) {
         PSErr(func, "Could not allocate layer neurons!");
         PSAbortLayer(network, layer);
         return 0;
     }
+    if (!PSInitLayerTensors(layer, size, ws)) {
+        PSErr(func, "Could not allocate layer tensors!");
+        PSAbortLayer(network, layer);
+        return 0;
+    }
     for (i = 0; i < size; i++) {
         PSNeuron * neuron = malloc(sizeof(PSNeuron));
         if (neuron == NULL) {
@@ -106,13 +138,9 @@ int PSInitRecurrentLayer(PSNeuralNetwork * network, PSLayer * layer,
         }
         neuron->index = i;
         neuron->weights_size = ws;
-        neuron->bias = gaussian_random(0, 1);
-        neuron->weights = malloc(sizeof(double) * ws);
-        if (neuron->weights ==  NULL) {
-            PSAbortLayer(network, layer);
-            PSErr(func, "Could not allocate neuron weights!");
-            return 0;
-        }
+        neuron->bias = layer->biases + i;
+        *(neuron->bias) = gaussian_random(0, 1);
+        neuron->weights = layer->weights + (i * layer->weights_stride);
         for (j = 0; j < ws; j++) {
             neuron->weights[j] = gaussian_random(0, 1);
         }
@@ -127,7 +155,7 @@ int PSInitRecurrentLayer(PSNeuralNetwork * network, PSLayer * layer,
         neuron->layer = layer;
     }
     layer->flags |= FLAG_RECURRENT;
-    layer->activate = tanh;
+    layer->activate = ps_tanh;
     layer->derivative = tanh_derivative;
     layer->feedforward = PSRecurrentFeedforward;
     network->flags |= FLAG_RECURRENT;
@@ -136,6 +164,17 @@ int PSInitRecurrentLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 /* Feedforward Functions */
 
+int PSRecurrentProjectInputs(PSLayer * layer, ps_real * inputs, int times) {
+    int size = layer->size;
+    int inputs_size = layer->neurons[0]->weights_size - size;
+    if (PSPrepareStateArena(layer, 1, times) == NULL) return 0;
+    ps_real * projections = PSPrepareStateProjections(layer, size);
+    if (projections == NULL) return 0;
+    PSGemmNT(times, size, inputs_size, inputs, inputs_size, layer->weights,
+             layer->weights_stride, projections, size, PS_GEMM_STORE);
+    GetStateArena(layer)->projected = 1;
+    return 1;
+}
 
 int PSRecurrentFeedforward(void * _net, void * _layer, ...) {
     PSNeuralNetwork * net = (PSNeuralNetwork*) _net;
@@ -189,68 +228,42 @@ int PSRecurrentFeedforward(void * _net, void * _layer, ...) {
             return 0;
         }
     }
-    int i, j, w, previous_size = previous->size;
+    int i, previous_size = previous->size;
+    if (t == 0 && PSPrepareStateArena(layer, 1, times) == NULL) return 0;
+    PSStateArena * arena = GetStateArena(layer);
+    ps_real * states = GetLayerStates(layer);
+    ps_real * z_values = layer->z_values;
     for (i = 0; i < size; i++) {
-        PSNeuron * neuron = layer->neurons[i];
-        PSRecurrentCell * cell = GetRecurrentCell(neuron);
-        if (cell == NULL) {
+        if (GetRecurrentCell(layer->neurons[i]) == NULL) {
             PSErr(NULL, "Layer[%d]: neuron[%d] cell is NULL!",
                   layer->index, i);
             return 0;
         }
-        double sum = 0, bias = 0;
-        if (onehot) sum = neuron->weights[vector_idx];
-        else {
-            j = 0;
-#ifdef USE_AVX
-            AVXDotProduct(previous_size, previous->avx_activation_cache,
-                          neuron->weights, sum, j, 1, t);
-#endif
-            for (; j < previous_size; j++) {
-                PSNeuron * prev_neuron = previous->neurons[j];
-                if (prev_neuron == NULL) return 0;
-                double a = prev_neuron->activation;
-                sum += (a * neuron->weights[j]);
-            }
-        }
-        if (t > 0) {
-            int last_t = t - 1;
-            w = 0;
-#ifdef USE_AVX
-            AVXDotProduct(size, layer->avx_activation_cache, cell->weights,
-                          bias, w, 1, last_t);
-#endif
-            for (; w < size; w++) {
-                PSNeuron * n = layer->neurons[w];
-                PSRecurrentCell * rc = GetRecurrentCell(n);
-                if (rc == NULL) return 0;
-                double weight = cell->weights[w];
-                double last_state = rc->states[last_t];
-                bias += (weight * last_state);
-            }
-        } else {
-            if (cell->states != NULL) free(cell->states);
-            cell->states_count = times;
-            cell->states = calloc(times, sizeof(double));
-#ifdef USE_AVX
-            if (neuron->index == 0) {
-                if (layer->avx_activation_cache != NULL)
-                    free(layer->avx_activation_cache);
-                layer->avx_activation_cache = calloc(times * size,
-                                                     sizeof(double));
-                if (layer->avx_activation_cache == NULL) {
-                    printMemoryErrorMsg();
-                    return 0;
-                }
-            }
-#endif
-        }
-        neuron->z_value = sum + bias;
+    }
+    int inputs_size = layer->neurons[0]->weights_size - size;
+    if (onehot) {
+        for (i = 0; i < size; i++)
+            z_values[i] = layer->neurons[i]->weights[vector_idx];
+    } else if (arena->projected) {
+        memcpy(z_values, arena->projections + (t * arena->projection_size),
+               size * sizeof(ps_real));
+    } else {
+        PSGemmNT(1, size, previous_size, previous->activations,
+                 previous_size, layer->weights, layer->weights_stride,
+                 z_values, size, PS_GEMM_STORE);
+    }
+    if (t > 0) {
+        ps_real * last_states = states + ((t - 1) * size);
+        PSGemmNT(1, size, size, last_states, size,
+                 layer->weights + inputs_size, layer->weights_stride,
+                 z_values, size, PS_GEMM_ADD);
+    }
+    for (i = 0; i < size; i++) {
+        PSNeuron * neuron = layer->neurons[i];
+        neuron->z_value = z_values[i];
         neuron->activation = layer->activate(neuron->z_value);
-        cell->states[t] = neuron->activation;
-#ifdef USE_AVX
-        layer->avx_activation_cache[(t * size) + i] = neuron->activation;
-#endif
+        layer->activations[i] = neuron->activation;
+        states[(t * size) + i] = neuron->activation;
     }
     return 1;
 }
@@ -262,13 +275,13 @@ int PSRecurrentBackprop(PSLayer * layer, PSLayer * previousLayer, int lowest_t,
 {
     int lsize = layer->size, i, w, tt;
     for (tt = t; tt >= lowest_t; tt--) {
-        double * delta = layer->delta;
-        double * new_delta = NULL;
+        ps_real * delta = layer->delta;
+        ps_real * new_delta = NULL;
         for (i = 0; i < lsize; i++) {
             PSNeuron * neuron = layer->neurons[i];
             PSRecurrentCell * cell = GetRecurrentCell(neuron);
             PSGradient * gradient = &(lgradients[i]);
-            double dv = delta[i];
+            ps_real dv = delta[i];
             gradient->bias += dv;
             int wsize = neuron->weights_size - cell->weights_size;
             
@@ -281,50 +294,44 @@ int PSRecurrentBackprop(PSLayer * layer, PSLayer * previousLayer, int lowest_t,
                 }
                 int vector_size = (int) params->parameters[0];
                 assert(vector_size > 0);
-                PSNeuron * prev_n = previousLayer->neurons[0];
-                PSRecurrentCell * prev_c = GetRecurrentCell(prev_n);
-                double prev_a = prev_c->states[tt];
+                ps_real prev_a = GetLayerState(previousLayer, 0, tt);
                 assert(prev_a < vector_size);
                 w = (int) prev_a;
                 gradient->weights[w] += dv;
             } else {
                 for (w = 0; w < wsize; w++) {
-                    PSNeuron * prev_n = previousLayer->neurons[w];
-                    PSRecurrentCell * prev_c = GetRecurrentCell(prev_n);
-                    double prev_a = prev_c->states[tt];
+                    ps_real prev_a = GetLayerState(previousLayer, w, tt);
                     gradient->weights[w] += (dv * prev_a);
                 }
             }
             
             if (tt > 0) {
                 if (new_delta == NULL) {
-                    new_delta = calloc(lsize, sizeof(double));
+                    new_delta = calloc(lsize, sizeof(ps_real));
                     if (new_delta == NULL) {
                         printMemoryErrorMsg();
                         return 0;
                     }
                 }
-                double rsum = 0.0;
+                ps_real rsum = 0.0;
                 w = 0;
 #ifdef USE_AVX
                 AVXMultiplyValue(cell->weights_size,
-                                 layer->avx_activation_cache, dv,
+                                 GetLayerStates(layer), dv,
                                  gradient->weights + wsize, w, 1,
                                  (tt - 1), AVX_STORE_MODE_ADD);
 #endif
                 for (; w < cell->weights_size; w++) {
-                    PSNeuron * rn = layer->neurons[w];
-                    PSRecurrentCell * rc = GetRecurrentCell(rn);
-                    double a = rc->states[tt - 1];
+                    ps_real a = GetLayerState(layer, w, tt - 1);
                     gradient->weights[wsize + w] += (dv * a);
                 }
                 for (w = 0; w < cell->weights_size; w++) {
                     PSNeuron * rn = layer->neurons[w];
                     PSRecurrentCell * rc = GetRecurrentCell(rn);
-                    double rw = rc->weights[neuron->index];
+                    ps_real rw = rc->weights[neuron->index];
                     rsum += (delta[rn->index] * rw);
                 }
-                double prev_a = cell->states[tt - 1];
+                ps_real prev_a = GetLayerState(layer, neuron->index, tt - 1);
                 new_delta[neuron->index] = rsum * layer->derivative(prev_a);
             }
             
@@ -23,14 +23,53 @@
 #define GetRecurrentCell(neuron) ((PSRecurrentCell*) neuron->extra)
 
 typedef struct {
-    int states_count;
     int weights_size;
-    double * states;
-    double * weights;
+    ps_real * weights;
 } PSRecurrentCell;
 
+/* States of every layer of a recurrent network through the steps of a
+ * sequence, kept in time-major [times][size] buffers: the first buffer
+ * holds the activations, the others hold whatever the layer type needs
+ * (ie. LSTM gates). Buffers are reused by the following sequences and they
+ * grow geometrically, so that they're only reallocated when a sequence is
+ * longer than all of the previous ones. */
+
+#define PS_STATE_BUFFERS    6
+#define PS_MIN_STATE_STEPS  8
+
+typedef struct {
+    int times; // Steps of the current sequence
+    int capacity; // Steps the buffers have room for
+    int size;
+    int count; // Buffers count
+    ps_real * data;
+    ps_real * buffers[PS_STATE_BUFFERS];
+    /* Pre-activations of every step (ie. the LSTM gates), kept in a
+     * [capacity][projection_size] buffer. When `projected` is set, the
+     * products of the inputs have already been stored for all of the steps
+     * of the sequence. */
+    int projection_size;
+    size_t projections_length;
+    ps_real * projections;
+    int projected;
+} PSStateArena;
+
+#define GetStateArena(layer) ((PSStateArena *) (layer)->state_arena)
+#define GetLayerStates(layer) (GetStateArena(layer)->buffers[0])
+#define GetLayerState(layer, i, t) \
+    (GetLayerStates(layer)[((t) * (layer)->size) + (i)])
+
 PSRecurrentCell * PSCreateRecurrentCell(PSNeuron * neuron, int lsize);
-double * PSAddRecurrentState(PSNeuron * neuron, double state, int times, int t);
+/* Makes room for the `count` buffers of a sequence of `times` steps. */
+PSStateArena * PSPrepareStateArena(PSLayer * layer, int count, int times);
+/* Makes room for `size` pre-activations for every step of the arena,
+ * returning the projections buffer (or NULL on errors). */
+ps_real * PSPrepareStateProjections(PSLayer * layer, int size);
+void PSDeleteStateArena(PSStateArena * arena);
+/* Stores the states (activations) of a layer at step `t`, returning them
+ * (or NULL on errors). */
+ps_real * PSAddRecurrentStates(PSLayer * layer, ps_real * states, int times,
+                               int t);
 
 /* Init Functions */
 
@@ -39,6 +78,10 @@ int PSInitRecurrentLayer(PSNeuralNetwork * network, PSLayer * layer,
 
 /* Feedforward Functions */
 
+/* Multiplies the inputs of all of the `times` steps of a sequence by the
+ * input weights at once, storing them in the arena projections, so that
+ * only the recurrent products are left to every step. */
+int PSRecurrentProjectInputs(PSLayer * layer, ps_real * inputs, int times);
 int PSRecurrentFeedforward(void * _net, void * _layer, ...);
 
 /* Backpropagation Functions */
@@ -69,9 +69,10 @@ int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * other)
                             i, fidx, obias, cbias);
                     break;
                 }
-            } else if (otype != Recurrent && otype != LSTM) {
-                double obias = getRoundedDouble(orig_n->bias);
-                double cbias = getRoundedDouble(other_n->bias);
+            } else if (otype != Recurrent && otype != LSTM &&
+                       otype != Pooling) {
+                double obias = getRoundedDouble(*(orig_n->bias));
+                double cbias = getRoundedDouble(*(other_n->bias));
                 ok = (obias == cbias);
             } else if (otype == LSTM) {
                 PSLSTMCell * ocell =  GetLSTMCell(orig_n);
@@ -105,7 +106,7 @@ int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * other)
             }
             if (!ok) {
                 sprintf(msg, "Layer[%d][%d]: bias %.15e != %.15e\n",
-                        i, k, orig_n->bias, other_n->bias);
+                        i, k, *(orig_n->bias), *(other_n->bias));
                 break;
             }
             for (w = 0; w < orig_n->weights_size; w++) {
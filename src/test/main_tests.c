@@ -19,12 +19,16 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <pthread.h>
 #include "test.h"
 #include "../psyc.h"
 #include "../convolutional.h"
 #include "../recurrent.h"
 #include "../lstm.h"
 #include "../mnist.h"
+#include "../dataset.h"
+#include "../quantize.h"
+#include "../utils.h"
 #ifdef USE_AVX
 #include "../avx.h"
 #endif
@@ -40,11 +44,34 @@
 #define BP_GRADIENTS_CHECKS 8
 #define BP_CONV_GRADIENTS_CHECKS 4
 #define CONV_L1F0_BIAS 0.02630446809718423
+#define QUANT_CALIBRATION_SAMPLES 1000
+#define QUANT_MAX_ACCURACY_LOSS 1.0
+#define PARALLEL_TRAIN_SAMPLES 100
+#define PARALLEL_TRAIN_BATCH 10
+#define PARALLEL_TRAIN_THREADS 4
+#define HOGWILD_TRAIN_SAMPLES 1000
+#define HOGWILD_MAX_ACCURACY_LOSS 2.0
+#define CHECKPOINT_EPOCHS 2
+#define CHECKPOINT_BATCHES 3
+#define MNIST_DATA_SAMPLES 10
+#define SOURCE_TRAIN_EPOCHS 2
+#define SOURCE_SHUFFLE_WINDOW 7
+#define THREADED_FEEDFORWARD_SAMPLES 10
+#define FEEDFORWARD_THREADS 4
+#define CONTEXT_SAMPLES 200
+#define CONTEXT_THREADS 4
+#define PARALLEL_TEST_SAMPLES 500
+#define PARALLEL_TEST_THREADS 4
+#define RNN_PARALLEL_TEST_SERIES 4000
 
 #define RNN_INPUT_SIZE  4
 #define RNN_HIDDEN_SIZE 2
 #define RNN_TIMES       4
 #define RNN_LEARNING_RATE 0.005
+#define RNN_LONG_TIMES  ((PS_MIN_STATE_STEPS * 2) + 1)
+#define RNN_DENSE_INPUTS 3
+#define RNN_DENSE_SIZE 5
+#define RNN_DENSE_TIMES 4
 
 #define LSTM_LEARNING_RATE 0.1
 #define LSTM_TIMES 3
@@ -52,9 +79,23 @@
 #define LSTM_BATCHES 1
 
 #define getNetwork(tc) ((PSNeuralNetwork*)(tc->data[0]))
-#define getTestData(tc) ((double*)(tc->data[1]))
-#define getRoundedDouble(d) (round(d * 1000000.0) / 1000000.0)
+#define getTestData(tc) ((ps_real*)(tc->data[1]))
+/* Expected values are compared after rounding them to TEST_DECIMALS
+ * (TEST_GRADIENT_DECIMALS for gradients). Single precision builds only
+ * guarantee about 7 significant digits, so they use fewer decimals. */
+#ifdef PS_USE_FLOAT
+#define TEST_DECIMALS           10000.0
+#define TEST_GRADIENT_DECIMALS  100000.0
+#define TEST_TOLERANCE          1e-4
+#else
+#define TEST_DECIMALS           1000000.0
+#define TEST_GRADIENT_DECIMALS  100000000.0
+#define TEST_TOLERANCE          1e-9
+#endif
+
+#define getRoundedDouble(d) (round(d * TEST_DECIMALS) / TEST_DECIMALS)
 #define getRoundedDoubleDec(d, dec) (round(d * dec) / dec)
+#define getRoundedGradient(d) getRoundedDoubleDec(d, TEST_GRADIENT_DECIMALS)
 
 TestCase * fullNetworkTests;
 TestCase * convNetworkTests;
@@ -73,38 +114,63 @@ int LSTMSetup (void* test_case);
 
 int testGenericClone(void* test_case, void* test);
 int testGenericSave(void* test_case, void* test);
+int testGenericSaveBinary(void* test_case, void* test);
+int testFullBinaryHeader(void* tc, void* t);
+int testGenericLoadPrecision(void* test_case, void* test);
+int testGenericFeedforwardBatch(void* test_case, void* test);
+int testGenericParallelTrain(void* test_case, void* test);
+int testGenericHogwildTrain(void* test_case, void* test);
+int testGenericCheckpoint(void* test_case, void* test);
+int testGenericThreadedFeedforward(void* test_case, void* test);
+int testGenericInferenceContext(void* test_case, void* test);
+int testGenericParallelTest(void* test_case, void* test);
 
 #ifdef USE_AVX
 int testAVXDot(void* test_case, void* test);
 int testAVXSquare(void* test_case, void* test);
 int testAVXMultiplyVal(void* tc, void* t);
+int testAVXGemm(void* tc, void* t);
 #endif
 
 int testFullLoad(void* test_case, void* test);
 int testFullFeedforward(void* test_case, void* test);
 int testFullAccuracy(void* tc, void* t);
 int testFullBackprop(void* test_case, void* test);
+int testFullQuantize(void* tc, void* t);
+int testFullMNISTData(void* tc, void* t);
+int testFullDatasetCache(void* tc, void* t);
+int testFullShuffledTrain(void* tc, void* t);
+int testFullDataSource(void* tc, void* t);
 
 int testConvLoad(void* test_case, void* test);
 int testConvFeedforward(void* test_case, void* test);
 int testConvAccuracy(void* tc, void* t);
 int testConvBackprop(void* test_case, void* test);
+int testConvDeltas(void* tc, void* t);
+int testConvWinograd(void* tc, void* t);
+int testConvQuantize(void* tc, void* t);
+int testConvThreadedWinograd(void* tc, void* t);
 
 int testRNNLoad(void* test_case, void* test);
 int testRNNFeedforward(void* test_case, void* test);
 int testRNNBackprop(void* test_case, void* test);
 int testRNNStep(void* tc, void* t);
+int testRNNBatchGradients(void* tc, void* t);
+int testRNNStateArena(void* tc, void* t);
+int testRNNProjectedInputs(void* tc, void* t);
+int testRNNParallelTest(void* tc, void* t);
 
 int testLSTMLoad(void* test_case, void* test);
 int testLSTMTrain(void* test_case, void* test);
+int testLSTMGates(void* tc, void* t);
 
 /* psyc.c static function prototypes */
 
-PSGradient ** backprop(PSNeuralNetwork * network, double * x, double * y);
-PSGradient ** backpropThroughTime(PSNeuralNetwork * network, double * x,
-                                  double * y, int times);
+PSGradient ** backprop(PSNeuralNetwork * network, ps_real * x, ps_real * y);
+PSGradient ** backpropThroughTime(PSNeuralNetwork * network, ps_real * x,
+                                  ps_real * y, int times);
 
-double updateWeights(PSNeuralNetwork * network, double * training_data,
+double updateWeights(PSNeuralNetwork * network, ps_real * training_data,
                      int batch_size, int elements_count,
                      PSTrainingOptions* opts, double rate, ...);
 
@@ -210,10 +276,14 @@ double rnn_trained_recurrent_weights[2][2] = {
     {-0.0554759, -0.69286102}
 };
 
-double rnn_inputs[5] = {4, 0, 1, 2, 3};
-double rnn_labels[4] = {3, 2, 1, 0};
+ps_real rnn_inputs[5] = {4, 0, 1, 2, 3};
+ps_real rnn_labels[4] = {3, 2, 1, 0};
+ps_real rnn_batch_series[2][9] = {
+    {4, 0, 1, 2, 3, 3, 2, 1, 0},
+    {3, 2, 0, 1, 1, 3, 2}
+};
 
-double lstm_training_data[] = {1.0, 3.0, 0.0, 1.0, 2.0, 1.0, 2.0, 3.0};
+ps_real lstm_training_data[] = {1.0, 3.0, 0.0, 1.0, 2.0, 1.0, 2.0, 3.0};
 double wg[2][6] = {
     { 0.0097627,0.04303787,0.02055268,0.00897664,-0.01526904,0.02917882},
     {-0.01248256,0.0783546,0.09273255,-0.0233117,0.05834501,0.00577898}
@@ -296,6 +366,7 @@ int main(int argc, char** argv) {
     addTest(AVXTests, "Dot Product", NULL, testAVXDot);
     addTest(AVXTests, "Square", NULL, testAVXSquare);
     addTest(AVXTests, "Multiply Value", NULL, testAVXMultiplyVal);
+    addTest(AVXTests, "GEMM", NULL, testAVXGemm);
     performTests(AVXTests);
     deleteTest(AVXTests);
 #endif
@@ -303,12 +374,32 @@ int main(int argc, char** argv) {
     fullNetworkTests = createTest("Fully Connected Network");
     fullNetworkTests->setup = genericSetup;
     fullNetworkTests->teardown = genericTeardown;
+    addTest(fullNetworkTests, "MNIST Data", NULL, testFullMNISTData);
+    addTest(fullNetworkTests, "Dataset Cache", NULL, testFullDatasetCache);
     addTest(fullNetworkTests, "Load", NULL, testFullLoad);
     addTest(fullNetworkTests, "Feedforward", NULL, testFullFeedforward);
     addTest(fullNetworkTests, "Accuracy", NULL, testFullAccuracy);
+    addTest(fullNetworkTests, "Feedforward Batch", NULL,
+            testGenericFeedforwardBatch);
     addTest(fullNetworkTests, "Backprop", NULL, testFullBackprop);
+    addTest(fullNetworkTests, "Quantize", NULL, testFullQuantize);
+    addTest(fullNetworkTests, "Shuffled Train", NULL, testFullShuffledTrain);
+    addTest(fullNetworkTests, "Data Source", NULL, testFullDataSource);
+    addTest(fullNetworkTests, "Parallel Train", NULL,
+            testGenericParallelTrain);
+    addTest(fullNetworkTests, "Hogwild Train", NULL, testGenericHogwildTrain);
+    addTest(fullNetworkTests, "Checkpoint", NULL, testGenericCheckpoint);
+    addTest(fullNetworkTests, "Threaded Feedforward", NULL,
+            testGenericThreadedFeedforward);
+    addTest(fullNetworkTests, "Inference Context", NULL,
+            testGenericInferenceContext);
+    addTest(fullNetworkTests, "Parallel Test", NULL, testGenericParallelTest);
     addTest(fullNetworkTests, "Clone", NULL, testGenericClone);
     addTest(fullNetworkTests, "Save", NULL, testGenericSave);
+    addTest(fullNetworkTests, "Save Binary", NULL, testGenericSaveBinary);
+    addTest(fullNetworkTests, "Binary Header", NULL, testFullBinaryHeader);
+    addTest(fullNetworkTests, "Load Precision", NULL,
+            testGenericLoadPrecision);
     performTests(fullNetworkTests);
     deleteTest(fullNetworkTests);
     
@@ -318,9 +409,28 @@ int main(int argc, char** argv) {
     addTest(convNetworkTests, "Load", NULL, testConvLoad);
     addTest(convNetworkTests, "Feedforward", NULL, testConvFeedforward);
     addTest(convNetworkTests, "Backprop", NULL, testConvBackprop);
+    addTest(convNetworkTests, "Deltas", NULL, testConvDeltas);
+    addTest(convNetworkTests, "Winograd", NULL, testConvWinograd);
     addTest(convNetworkTests, "Accuracy", NULL, testConvAccuracy);
+    addTest(convNetworkTests, "Quantize", NULL, testConvQuantize);
+    addTest(convNetworkTests, "Feedforward Batch", NULL,
+            testGenericFeedforwardBatch);
+    addTest(convNetworkTests, "Parallel Train", NULL,
+            testGenericParallelTrain);
+    addTest(convNetworkTests, "Hogwild Train", NULL, testGenericHogwildTrain);
+    addTest(convNetworkTests, "Checkpoint", NULL, testGenericCheckpoint);
+    addTest(convNetworkTests, "Threaded Feedforward", NULL,
+            testGenericThreadedFeedforward);
+    addTest(convNetworkTests, "Threaded Winograd", NULL,
+            testConvThreadedWinograd);
+    addTest(convNetworkTests, "Inference Context", NULL,
+            testGenericInferenceContext);
+    addTest(convNetworkTests, "Parallel Test", NULL, testGenericParallelTest);
     addTest(convNetworkTests, "Clone", NULL, testGenericClone);
     addTest(convNetworkTests, "Save", NULL, testGenericSave);
+    addTest(convNetworkTests, "Save Binary", NULL, testGenericSaveBinary);
+    addTest(convNetworkTests, "Load Precision", NULL,
+            testGenericLoadPrecision);
     performTests(convNetworkTests);
     deleteTest(convNetworkTests);
     
@@ -329,10 +439,20 @@ int main(int argc, char** argv) {
     recurrentNetworkTests->teardown = RNNTeardown;
     addTest(recurrentNetworkTests, "Load", NULL, testRNNLoad);
     addTest(recurrentNetworkTests, "Feedforward", NULL, testRNNFeedforward);
+    addTest(recurrentNetworkTests, "State Arena", NULL, testRNNStateArena);
+    addTest(recurrentNetworkTests, "Projected Inputs", NULL,
+            testRNNProjectedInputs);
     addTest(recurrentNetworkTests, "Backprop", NULL, testRNNBackprop);
+    addTest(recurrentNetworkTests, "Batch Gradients", NULL,
+            testRNNBatchGradients);
     addTest(recurrentNetworkTests, "Step", NULL, testRNNStep);
+    addTest(recurrentNetworkTests, "Parallel Test", NULL,
+            testRNNParallelTest);
     addTest(recurrentNetworkTests, "Clone", NULL, testGenericClone);
     addTest(recurrentNetworkTests, "Save", NULL, testGenericSave);
+    addTest(recurrentNetworkTests, "Save Binary", NULL, testGenericSaveBinary);
+    addTest(recurrentNetworkTests, "Load Precision", NULL,
+            testGenericLoadPrecision);
     performTests(recurrentNetworkTests);
     deleteTest(recurrentNetworkTests);
     
@@ -341,8 +461,12 @@ int main(int argc, char** argv) {
     LSTMNetworkTests->teardown = RNNTeardown;
     //addTest(LSTMNetworkTests, "Load", NULL, testLSTMLoad);
     addTest(LSTMNetworkTests, "Train", NULL, testLSTMTrain);
+    addTest(LSTMNetworkTests, "Gates", NULL, testLSTMGates);
     addTest(LSTMNetworkTests, "Clone", NULL, testGenericClone);
     addTest(LSTMNetworkTests, "Save", NULL, testGenericSave);
+    addTest(LSTMNetworkTests, "Save Binary", NULL, testGenericSaveBinary);
+    addTest(LSTMNetworkTests, "Load Precision", NULL,
+            testGenericLoadPrecision);
     performTests(LSTMNetworkTests);
     deleteTest(LSTMNetworkTests);
     
@@ -363,7 +487,7 @@ int genericSetup (void* tc) {
         return 0;
     }
     test_case->data[0] = network;
-    double * test_data = NULL;
+    ps_real * test_data = NULL;
     testlen = loadMNISTData(TEST_DATA, TEST_IMAGE_FILE, TEST_LABEL_FILE,
                             &test_data);
     test_case->data[1] = test_data;
@@ -377,7 +501,7 @@ int genericTeardown (void* tc) {
     TestCase * test_case = (TestCase*) tc;
     PSNeuralNetwork * network = getNetwork(test_case);
     if (network != NULL) PSDeleteNetwork(network);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     if (test_data != NULL) free(test_data);
     free(test_case->data);
     test_case->data = NULL;
@@ -406,7 +530,7 @@ int RNNSetup (void* tc) {
         PSLayer * layer = network->layers[i];
         for (j = 0; j < layer->size; j++) {
             PSNeuron * n = layer->neurons[j];
-            n->bias = 0;
+            *(n->bias) = 0;
             for (w = 0; w < n->weights_size; w++) {
                 double * weights;
                 int w_idx = w;
@@ -430,15 +554,15 @@ int RNNSetup (void* tc) {
     test_case->data[0] = network;
     int train_data_len = 1 + (RNN_TIMES * 2);
     int labels_offset = 1 + RNN_TIMES;
-    double * training_data = malloc(train_data_len * sizeof(double));
-    double * p = training_data;
+    ps_real * training_data = malloc(train_data_len * sizeof(ps_real));
+    ps_real * p = training_data;
     if (training_data == NULL) {
         fprintf(stderr, "\nCould not allocate memory!\n");
         return 0;
     }
-    memcpy(p, rnn_inputs, labels_offset * sizeof(double));
+    memcpy(p, rnn_inputs, labels_offset * sizeof(ps_real));
     p += labels_offset;
-    memcpy(p, rnn_labels, RNN_TIMES * sizeof(double));
+    memcpy(p, rnn_labels, RNN_TIMES * sizeof(ps_real));
     test_case->data[1] = training_data;
     return 1;
 }
@@ -447,7 +571,7 @@ int RNNTeardown (void* tc) {
     TestCase * test_case = (TestCase*) tc;
     PSNeuralNetwork * network = getNetwork(test_case);
     if (network != NULL) PSDeleteNetwork(network);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     if (test_data != NULL) free(test_data);
     free(test_case->data);
     test_case->data = NULL;
@@ -491,7 +615,7 @@ int LSTMSetup (void* tc) {
     
     for (i = 0; i < out->size; i++) {
         PSNeuron * neuron = out->neurons[i];
-        neuron->bias = 0.0;
+        *(neuron->bias) = 0.0;
         for (w = 0; w < neuron->weights_size; w++) {
             neuron->weights[w] = lstm_out_weights[i][w];
         }
@@ -504,13 +628,13 @@ int LSTMSetup (void* tc) {
     }
     test_case->data[0] = network;
     int train_data_len = 2 + (LSTM_TIMES * 2);
-    double * training_data = malloc(train_data_len * sizeof(double));
-    double * p = training_data;
+    ps_real * training_data = malloc(train_data_len * sizeof(ps_real));
+    ps_real * p = training_data;
     if (training_data == NULL) {
         fprintf(stderr, "\nCould not allocate memory!\n");
         return 0;
     }
-    memcpy(training_data, lstm_training_data, train_data_len * sizeof(double));
+    memcpy(training_data, lstm_training_data, train_data_len * sizeof(ps_real));
     test_case->data[1] = training_data;
     return 1;
 }
@@ -527,7 +651,7 @@ int testFullFeedforward(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     PSNeuralNetwork * network = getNetwork(test_case);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     PSFeedforward(network, test_data);
 
     PSLayer * output = network->layers[network->size - 1];
@@ -553,7 +677,7 @@ int testFullAccuracy(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * testobj = (Test*) t;
     PSNeuralNetwork * network = getNetwork(test_case);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     double accuracy = PSTest(network, test_data, testlen);
     accuracy = round(accuracy * 100.0);
     int ok = (accuracy == 95.0);
@@ -570,10 +694,10 @@ int testFullBackprop(void* tc, void* t) {
     Test * testobj = (Test*) t;
     testobj->error_message = malloc(255 * sizeof(char));
     PSNeuralNetwork * network = getNetwork(test_case);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     int input_size = network->layers[0]->size;
-    double * x = test_data;
-    double * y = test_data + input_size;
+    ps_real * x = test_data;
+    ps_real * y = test_data + input_size;
     PSGradient ** gradients = backprop(network, x, y);
     int ok = 1, i;
     for (i = 0; i < BP_GRADIENTS_CHECKS; i++) {
@@ -586,24 +710,24 @@ int testFullBackprop(void* tc, void* t) {
         double w2 = backpropGradients[i][6];
         PSGradient * dl = gradients[lidx - 1];
         PSGradient * d = &(dl[nidx]);
-        double val = getRoundedDoubleDec(d->bias, 100000000.0);
-        ok = (val == bias);
+        double val = getRoundedGradient(d->bias);
+        ok = (val == getRoundedGradient(bias));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] bias %lf != from expected (%lf)",
                     lidx - 1, nidx, val, bias);
             break;
         }
-        val = getRoundedDoubleDec(d->weights[widx1], 100000000.0);
-        ok = (val == w1);
+        val = getRoundedGradient(d->weights[widx1]);
+        ok = (val == getRoundedGradient(w1));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] weight[%d] %lf != from expected (%lf)",
                     lidx - 1, nidx, widx1, val, w1);
             break;
         }
-        val = getRoundedDoubleDec(d->weights[widx2], 100000000.0);
-        ok = (val == w2);
+        val = getRoundedGradient(d->weights[widx2]);
+        ok = (val == getRoundedGradient(w2));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] weight[%d] %lf != from expected (%lf)",
@@ -647,7 +771,7 @@ int testConvFeedforward(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     PSNeuralNetwork * network = getNetwork(test_case);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     PSFeedforward(network, test_data);
     
     PSLayer * output = network->layers[network->size - 1];
@@ -674,10 +798,10 @@ int testConvBackprop(void* tc, void* t) {
     Test * testobj = (Test*) t;
     testobj->error_message = malloc(255 * sizeof(char));
     PSNeuralNetwork * network = getNetwork(test_case);
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     int input_size = network->layers[0]->size;
-    double * x = test_data;
-    double * y = test_data + input_size;
+    ps_real * x = test_data;
+    ps_real * y = test_data + input_size;
     PSGradient ** gradients = backprop(network, x, y);
     int ok = 1, i;
     for (i = 0; i < BP_CONV_GRADIENTS_CHECKS; i++) {
@@ -691,24 +815,24 @@ int testConvBackprop(void* tc, void* t) {
         PSGradient * dl = gradients[lidx - 1];
         if (dl == NULL) continue;
         PSGradient * d = &(dl[nidx]);
-        double val = getRoundedDoubleDec(d->bias, 100000000.0);
-        ok = (val == bias);
+        double val = getRoundedGradient(d->bias);
+        ok = (val == getRoundedGradient(bias));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] bias %.8lf != from expected (%.8lf)",
                     lidx - 1, nidx, val, bias);
             break;
         }
-        val = getRoundedDoubleDec(d->weights[widx1], 100000000.0);
-        ok = (val == w1);
+        val = getRoundedGradient(d->weights[widx1]);
+        ok = (val == getRoundedGradient(w1));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] weight[%d] %.8lf != from expect. (%.8lf)",
                     lidx - 1, nidx, widx1, val, w1);
             break;
         }
-        val = getRoundedDoubleDec(d->weights[widx2], 100000000.0);
-        ok = (val == w2);
+        val = getRoundedGradient(d->weights[widx2]);
+        ok = (val == getRoundedGradient(w2));
         if (!ok) {
             sprintf(testobj->error_message,
                     "Gradient[%d][%d] weight[%d] %.8lf != from expect. (%.8lf)",
@@ -723,7 +847,7 @@ int testConvBackprop(void* tc, void* t) {
 int testConvAccuracy(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * testobj = (Test*) t;
-    double * test_data = getTestData(test_case);
+    ps_real * test_data = getTestData(test_case);
     PSNeuralNetwork * network = PSCreateNetwork("CNN Test Network");
     int loaded = PSLoadNetwork(network, CONVOLUTIONAL_TRAINED_NETWORK);
     if (!loaded) {
@@ -746,6 +870,386 @@ int testConvAccuracy(void* tc, void* t) {
     return ok;
 }
 
+/* Quantizes the network and checks that its accuracy is within
+ * QUANT_MAX_ACCURACY_LOSS points from the expected one. */
+
+static int testQuantizedAccuracy(PSNeuralNetwork * network,
+                                 ps_real * test_data, double expected,
+                                 Test * test)
+{
+    test->error_message = malloc(255 * sizeof(char));
+    PSQuantizedNetwork * qnet = PSQuantizeNetwork(network, test_data, testlen,
+                                                  QUANT_CALIBRATION_SAMPLES);
+    if (qnet == NULL) {
+        sprintf(test->error_message, "Quantization failed");
+        return 0;
+    }
+    double accuracy = PSQuantizedTest(qnet, test_data, testlen);
+    accuracy = round(accuracy * 100.0);
+    int ok = (accuracy >= expected - QUANT_MAX_ACCURACY_LOSS);
+    if (!ok) {
+        sprintf(test->error_message,
+                "Quantized accuracy %lf too far from expected (%lf)",
+                accuracy, expected);
+    }
+    PSDeleteQuantizedNetwork(qnet);
+    return ok;
+}
+
+int testFullQuantize(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    return testQuantizedAccuracy(network, test_data, 95.0, (Test*) t);
+}
+
+/* Samples converted on demand from the compact dataset must match the
+ * fully expanded test data. */
+int testFullMNISTData(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    ps_real * test_data = getTestData(test_case);
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSDataset * mnist = PSLoadMNISTData(TEST_IMAGE_FILE, TEST_LABEL_FILE);
+    if (mnist == NULL) {
+        sprintf(msg, "Could not load MNIST data!\n");
+        return 0;
+    }
+    int element_size = PSGetMNISTElementSize(mnist), i, ok = 1;
+    if (mnist->count * element_size != testlen) {
+        sprintf(msg, "Data length %d != %d\n", mnist->count * element_size,
+                testlen);
+        PSDeleteDataset(mnist);
+        return 0;
+    }
+    int first = mnist->count - MNIST_DATA_SAMPLES;
+    ps_real elements[MNIST_DATA_SAMPLES * element_size];
+    PSGetMNISTElements(mnist, first, MNIST_DATA_SAMPLES, elements);
+    ps_real * expected = test_data + (first * element_size);
+    for (i = 0; i < MNIST_DATA_SAMPLES * element_size; i++) {
+        if (elements[i] != expected[i]) {
+            sprintf(msg, "Sample[%d], value[%d]: %f != %f\n",
+                    first + (i / element_size), i % element_size,
+                    (double) elements[i], (double) expected[i]);
+            ok = 0;
+            break;
+        }
+    }
+    PSDeleteDataset(mnist);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+/* Datasets are cached on the first load and mapped by the following ones,
+ * until their source changes. */
+int testFullDatasetCache(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    ps_real * test_data = getTestData(test_case);
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    char tmpfile[255];
+    getTmpFileName("tests-dataset", ".dataset", tmpfile);
+    PSDataset * built = NULL, * cached = NULL, * series = NULL;
+    PSDataSource * source = NULL;
+    ps_real * elements = NULL;
+    int ok = 1, i, j;
+    built = PSLoadCachedMNISTData(TEST_IMAGE_FILE, TEST_LABEL_FILE, tmpfile);
+    cached = PSLoadCachedMNISTData(TEST_IMAGE_FILE, TEST_LABEL_FILE, tmpfile);
+    if (built == NULL || cached == NULL) {
+        sprintf(msg, "Could not load dataset!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    int element_size = PSGetMNISTElementSize(cached);
+    elements = malloc(testlen * sizeof(ps_real));
+    if (elements == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    if (cached->mapping == NULL || !(cached->flags & PS_DATASET_BYTES) ||
+        cached->count * element_size != testlen) {
+        sprintf(msg, "Cached dataset differs from test data!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSGetMNISTElements(cached, 0, cached->count, elements);
+    if (memcmp(elements, test_data, testlen * sizeof(ps_real)) != 0) {
+        sprintf(msg, "Cached dataset differs from test data!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    // Shuffled sources must read every sample once
+    int label_counts[PS_MNIST_CLASSES] = {0};
+    for (i = 0; i < cached->count; i++) {
+        int label = cached->bytes[(i * (cached->input_size + 1)) +
+                                  cached->input_size];
+        label_counts[label]++;
+    }
+    source = PSCreateShuffledMNISTSource(cached, 0, cached->count);
+    ok = (source != NULL && source->rewind(source) &&
+          source->read(source, elements, cached->count) == cached->count);
+    for (i = 0; ok && i < cached->count; i++) {
+        ps_real * label = elements + (i * element_size) +
+                          cached->input_size;
+        for (j = 0; j < PS_MNIST_CLASSES; j++)
+            if (label[j] == 1) label_counts[j]--;
+    }
+    for (j = 0; ok && j < PS_MNIST_CLASSES; j++) ok = !label_counts[j];
+    if (!ok) {
+        sprintf(msg, "Shuffled source differs from test data!\n");
+        goto cleanup;
+    }
+    PSDeleteDataset(cached);
+    cached = PSLoadDataset(tmpfile, built->source_hash + 1);
+    if (cached != NULL) {
+        sprintf(msg, "Stale dataset not detected!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    // Two series of 2 and 1 steps, with 2 inputs and 1 output
+    ps_real series_data[] = {2, 2, 1, 2, 3, 4, 5, 6, 1, 7, 8, 9};
+    size_t series_len = sizeof(series_data) / sizeof(ps_real);
+    ps_real * data = malloc(sizeof(series_data));
+    if (data == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    memcpy(data, series_data, sizeof(series_data));
+    series = PSCreateDataset(data, series_len, 2, 1, PS_DATASET_SERIES);
+    if (series == NULL) free(data);
+    ok = (series != NULL && series->count == 2 &&
+          PSSaveDataset(series, tmpfile));
+    PSDeleteDataset(series);
+    series = (ok ? PSLoadDataset(tmpfile, 0) : NULL);
+    ok = (series != NULL && series->count == 2 &&
+          (series->flags & PS_DATASET_SERIES) &&
+          series->length == series_len &&
+          memcmp(series->data, series_data, sizeof(series_data)) == 0);
+    if (!ok) sprintf(msg, "Series dataset differs!\n");
+cleanup:
+    remove(tmpfile);
+    PSDeleteDataSource(source);
+    free(elements);
+    PSDeleteDataset(built);
+    PSDeleteDataset(cached);
+    PSDeleteDataset(series);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+/* Shuffled training must reorder the samples without moving them. */
+int testFullShuffledTrain(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    int datalen = PARALLEL_TRAIN_SAMPLES * element_size, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * serial = PSCloneNetwork(network, 0);
+    PSNeuralNetwork * shuffled = PSCloneNetwork(network, 0);
+    ps_real * data = malloc(datalen * sizeof(ps_real));
+    if (serial == NULL || shuffled == NULL || data == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    memcpy(data, test_data, datalen * sizeof(ps_real));
+    PSTrainingOptions options = {
+        .flags = TRAINING_NO_SHUFFLE,
+        .l2_decay = 0.0
+    };
+    PSTrain(serial, data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH, &options,
+            NULL, 0);
+    options.flags = 0;
+    PSTrain(shuffled, data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH, &options,
+            NULL, 0);
+    if (serial->status != STATUS_TRAINED ||
+        shuffled->status != STATUS_TRAINED) {
+        sprintf(msg, "Training failed!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    if (memcmp(data, test_data, datalen * sizeof(ps_real)) != 0) {
+        sprintf(msg, "Training data has been modified!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSLayer * layer = shuffled->layers[network->size - 1];
+    PSLayer * serial_layer = serial->layers[network->size - 1];
+    ok = (memcmp(layer->biases, serial_layer->biases,
+                 layer->size * sizeof(ps_real)) != 0);
+    if (!ok) sprintf(msg, "Samples have not been shuffled!\n");
+cleanup:
+    if (serial != NULL) PSDeleteNetwork(serial);
+    if (shuffled != NULL) PSDeleteNetwork(shuffled);
+    free(data);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+/* Generator streaming the test data, which counts its rewinds and can end
+ * before its declared count. */
+typedef struct {
+    ps_real * data;
+    int length; // Elements actually available
+    int next;
+    int rewinds;
+} TestGenerator;
+
+static int readTestGenerator(PSDataSource * source, ps_real * elements,
+                             int count)
+{
+    TestGenerator * generator = (TestGenerator *) source->data;
+    int element_size = source->input_size + source->output_size;
+    if (count > generator->length - generator->next)
+        count = generator->length - generator->next;
+    memcpy(elements, generator->data + (generator->next * element_size),
+           count * element_size * sizeof(ps_real));
+    generator->next += count;
+    return count;
+}
+
+static int rewindTestGenerator(PSDataSource * source) {
+    TestGenerator * generator = (TestGenerator *) source->data;
+    generator->next = 0;
+    generator->rewinds++;
+    return 1;
+}
+
+/* Sources must train exactly like arrays when they're not shuffled, and
+ * they must be streamed through mapped datasets too. */
+int testFullDataSource(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int input_size = network->input_size, output_size = network->output_size;
+    int element_size = input_size + output_size;
+    int datalen = PARALLEL_TRAIN_SAMPLES * element_size, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    char tmpfile[255];
+    getTmpFileName("tests-source", ".dataset", tmpfile);
+    PSNeuralNetwork * serial = PSCloneNetwork(network, 0);
+    PSNeuralNetwork * streamed = PSCloneNetwork(network, 0);
+    PSDataSource * source = PSCreateArraySource(test_data, 0,
+                                                PARALLEL_TRAIN_SAMPLES,
+                                                input_size, output_size);
+    PSDataSource * dataset_source = NULL;
+    PSDataset * dataset = NULL;
+    if (serial == NULL || streamed == NULL || source == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSTrainingOptions options = {
+        .flags = TRAINING_NO_SHUFFLE,
+        .l2_decay = 0.0
+    };
+    PSTrain(serial, test_data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH,
+            &options, NULL, 0);
+    PSTrainSource(streamed, source, 1, 0.5, PARALLEL_TRAIN_BATCH, &options,
+                  NULL);
+    PSLayer * layer = streamed->layers[network->size - 1];
+    PSLayer * serial_layer = serial->layers[network->size - 1];
+    if (streamed->status != STATUS_TRAINED ||
+        memcmp(layer->weights, serial_layer->weights,
+               layer->size * layer->weights_stride * sizeof(ps_real)) != 0) {
+        sprintf(msg, "Streamed training differs from array training!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    TestGenerator generator = {
+        .data = test_data,
+        .length = PARALLEL_TRAIN_SAMPLES
+    };
+    PSDataSource generated = {
+        .count = PARALLEL_TRAIN_SAMPLES,
+        .input_size = input_size,
+        .output_size = output_size,
+        .read = readTestGenerator,
+        .rewind = rewindTestGenerator,
+        .data = &generator
+    };
+    options.flags = 0;
+    options.shuffle_window = SOURCE_SHUFFLE_WINDOW;
+    PSTrainSource(streamed, &generated, SOURCE_TRAIN_EPOCHS, 0.5,
+                  PARALLEL_TRAIN_BATCH, &options, source);
+    if (streamed->status != STATUS_TRAINED ||
+        generator.rewinds != SOURCE_TRAIN_EPOCHS) {
+        sprintf(msg, "Shuffled streamed training failed!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    generated.count = PARALLEL_TRAIN_SAMPLES + PARALLEL_TRAIN_BATCH;
+    PSTrainSource(streamed, &generated, 1, 0.5, PARALLEL_TRAIN_BATCH,
+                  &options, NULL);
+    if (streamed->status != STATUS_ERROR) {
+        sprintf(msg, "Truncated source not detected!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    source->count = testlen / element_size;
+    if (!PSSaveDataSource(source, tmpfile, 0) ||
+        (dataset = PSLoadDataset(tmpfile, 0)) == NULL ||
+        (int) dataset->length != testlen ||
+        memcmp(dataset->data, test_data, testlen * sizeof(ps_real)) != 0) {
+        sprintf(msg, "Saved data source differs from test data!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    dataset_source = PSCreateDatasetSource(dataset, 0, dataset->count);
+    float accuracy = PSTest(network, test_data, testlen);
+    ok = (dataset_source != NULL &&
+          PSTestSource(network, dataset_source) == accuracy);
+    if (!ok) sprintf(msg, "Streamed test accuracy differs!\n");
+cleanup:
+    remove(tmpfile);
+    if (serial != NULL) PSDeleteNetwork(serial);
+    if (streamed != NULL) PSDeleteNetwork(streamed);
+    PSDeleteDataSource(source);
+    PSDeleteDataSource(dataset_source);
+    PSDeleteDataset(dataset);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+int testConvQuantize(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * testobj = (Test*) t;
+    ps_real * test_data = getTestData(test_case);
+    PSNeuralNetwork * network = PSCreateNetwork("CNN Test Network");
+    int loaded = PSLoadNetwork(network, CONVOLUTIONAL_TRAINED_NETWORK);
+    if (!loaded) {
+        testobj->error_message = malloc(255 * sizeof(char));
+        sprintf(testobj->error_message, "Failed to load %s",
+                CONVOLUTIONAL_TRAINED_NETWORK);
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    int ok = testQuantizedAccuracy(network, test_data, 98.0, testobj);
+    PSDeleteNetwork(network);
+    return ok;
+}
+
 int testRNNLoad(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
@@ -773,7 +1277,7 @@ int testRNNLoad(void* tc, void* t) {
                         w_idx -= RNN_INPUT_SIZE;
                     }
                 } else weights = rnn_outer_weights[j];
-                ok = (n->weights[w] == weights[w_idx]);
+                ok = (n->weights[w] == (ps_real) weights[w_idx]);
                 if (!ok) {
                     test->error_message = malloc(255 * sizeof(char));
                     sprintf(test->error_message,
@@ -798,11 +1302,10 @@ int testRNNFeedforward(void* tc, void* t) {
     
     PSLayer * output = network->layers[network->size - 1];
     int ok = 1, i, j;
+    int times = GetStateArena(output)->times;
     for (i = 0; i < output->size; i++) {
-        PSNeuron * n = output->neurons[i];
-        PSRecurrentCell* cell = (PSRecurrentCell*) n->extra;
-        for (j = 0; j < cell->states_count; j++) {
-            double s = getRoundedDouble(cell->states[j]);
+        for (j = 0; j < times; j++) {
+            double s = getRoundedDouble(GetLayerState(output, i, j));
             double expected = getRoundedDouble(rnn_expected_output[j][i]);
             ok = (s == expected);
             if (!ok) {
@@ -817,6 +1320,112 @@ int testRNNFeedforward(void* tc, void* t) {
     return ok;
 }
 
+/* States buffers grow geometrically with longer sequences, and they're
+ * reused by shorter ones without leaking their states. */
+int testRNNStateArena(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    PSLayer * output = network->layers[network->size - 1];
+    ps_real inputs[RNN_LONG_TIMES + 1];
+    int ok = 1, i, j;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    inputs[0] = RNN_LONG_TIMES;
+    for (i = 1; i <= RNN_LONG_TIMES; i++)
+        inputs[i] = (RNN_LONG_TIMES - i) % RNN_INPUT_SIZE;
+    PSFeedforward(network, inputs);
+    PSStateArena * arena = GetStateArena(output);
+    if (arena->times != RNN_LONG_TIMES ||
+        arena->capacity != PS_MIN_STATE_STEPS * 4) {
+        sprintf(msg, "Unexpected arena capacity %d for %d steps!\n",
+                arena->capacity, arena->times);
+        return 0;
+    }
+    ps_real * data = arena->data;
+    PSFeedforward(network, rnn_inputs);
+    if (arena->data != data || arena->times != RNN_TIMES) {
+        sprintf(msg, "Arena has not been reused!\n");
+        return 0;
+    }
+    for (i = 0; i < output->size && ok; i++) {
+        for (j = 0; j < RNN_TIMES && ok; j++) {
+            double s = getRoundedDouble(GetLayerState(output, i, j));
+            double expected = getRoundedDouble(rnn_expected_output[j][i]);
+            ok = (s == expected);
+            if (!ok) sprintf(msg, "Output[%d][%d]: %lf != %lf\n",
+                             i, j, s, expected);
+        }
+    }
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+/* Feedforwards a sequence of dense inputs, whose products are projected
+ * for the whole sequence, and compares the states with the ones computed
+ * step by step. */
+int testRNNProjectedInputs(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int ok = 1, i, j, w, step;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * network = PSCreateNetwork("RNN Dense Network");
+    if (network == NULL) {
+        sprintf(msg, "Could not create network!\n");
+        return 0;
+    }
+    PSAddLayer(network, FullyConnected, RNN_DENSE_INPUTS, NULL);
+    PSAddLayer(network, Recurrent, RNN_DENSE_SIZE, NULL);
+    PSAddLayer(network, SoftMax, RNN_DENSE_INPUTS, NULL);
+    if (network->size < 3) {
+        sprintf(msg, "Could not add all layers!\n");
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    PSLayer * layer = network->layers[1];
+    ps_real inputs[1 + (RNN_DENSE_TIMES * RNN_DENSE_INPUTS)];
+    inputs[0] = RNN_DENSE_TIMES;
+    for (i = 1; i <= RNN_DENSE_TIMES * RNN_DENSE_INPUTS; i++)
+        inputs[i] = ((i % 5) - 2) * 0.25;
+    PSFeedforward(network, inputs);
+    double h[RNN_DENSE_SIZE], new_h[RNN_DENSE_SIZE];
+    memset(h, 0, sizeof(h));
+    for (step = 0; step < RNN_DENSE_TIMES && ok; step++) {
+        ps_real * x = inputs + 1 + (step * RNN_DENSE_INPUTS);
+        for (i = 0; i < RNN_DENSE_SIZE; i++) {
+            PSNeuron * neuron = layer->neurons[i];
+            double z = 0.0;
+            for (w = 0; w < neuron->weights_size; w++) {
+                double a = (w < RNN_DENSE_INPUTS ? x[w] :
+                            h[w - RNN_DENSE_INPUTS]);
+                z += a * neuron->weights[w];
+            }
+            new_h[i] = layer->activate(z);
+        }
+        for (j = 0; j < RNN_DENSE_SIZE && ok; j++) {
+            h[j] = new_h[j];
+            double state = getRoundedDouble(GetLayerState(layer, j, step));
+            double expected = getRoundedDouble(h[j]);
+            ok = (state == expected);
+            if (!ok) sprintf(msg, "State[%d][%d]: %lf != %lf\n",
+                             step, j, state, expected);
+        }
+    }
+    if (ok && GetStateArena(layer)->projected) {
+        sprintf(msg, "Projected inputs have not been reset!\n");
+        ok = 0;
+    }
+    PSDeleteNetwork(network);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
 int testRNNBackprop(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
@@ -855,13 +1464,83 @@ int testRNNBackprop(void* tc, void* t) {
     return ok;
 }
 
+/* The gradients of a batch of two series must be the sum of the gradients
+ * of each one of them. */
+int testRNNBatchGradients(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    PSGradient ** sample_gradients[2] = {NULL, NULL};
+    ps_real * series[2];
+    int ok = 1, i, j, k, w;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * batch_net = PSCloneNetwork(network, 0);
+    if (batch_net == NULL) {
+        sprintf(msg, "Could not clone network!\n");
+        return 0;
+    }
+    for (k = 0; k < 2; k++) {
+        series[k] = rnn_batch_series[k];
+        int times = (int) series[k][0];
+        sample_gradients[k] = backpropThroughTime(network, series[k] + 1,
+                                                  series[k] + 1 + times,
+                                                  times);
+        if (sample_gradients[k] == NULL) {
+            sprintf(msg, "Backprop failed on series %d!\n", k);
+            ok = 0;
+            goto cleanup;
+        }
+    }
+    updateWeights(batch_net, NULL, 2, 2, NULL, RNN_LEARNING_RATE, series);
+    for (i = 0; i < network->size - 1 && ok; i++) {
+        PSLayer * layer = network->layers[i + 1];
+        for (j = 0; j < layer->size && ok; j++) {
+            PSGradient * g1 = &(sample_gradients[0][i][j]);
+            PSGradient * g2 = &(sample_gradients[1][i][j]);
+            PSGradient * gb = &(batch_net->gradients[i][j]);
+            double sum = g1->bias + g2->bias;
+            sum = getRoundedGradient(sum);
+            double batch = getRoundedGradient(gb->bias);
+            ok = (sum == batch);
+            if (!ok) {
+                sprintf(msg, "Gradient[%d][%d]->bias: %lf != %lf\n",
+                        i, j, batch, sum);
+                break;
+            }
+            for (w = 0; w < layer->neurons[j]->weights_size; w++) {
+                sum = g1->weights[w] + g2->weights[w];
+                sum = getRoundedGradient(sum);
+                batch = getRoundedGradient(gb->weights[w]);
+                ok = (sum == batch);
+                if (!ok) {
+                    sprintf(msg, "Gradient[%d][%d]->weight[%d]: %lf != %lf\n",
+                            i, j, w, batch, sum);
+                    break;
+                }
+            }
+        }
+    }
+cleanup:
+    for (k = 0; k < 2; k++) {
+        if (sample_gradients[k] != NULL)
+            PSDeleteGradients(sample_gradients[k], network);
+    }
+    PSDeleteNetwork(batch_net);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
 int testRNNStep(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     PSNeuralNetwork * network = getNetwork(test_case);
     int train_data_len = 1 + (RNN_TIMES * 2);
-    double * training_data = getTestData(test_case);
-    double ** series = &training_data;
+    ps_real * training_data = getTestData(test_case);
+    ps_real ** series = &training_data;
     int elements_count = (int) *training_data;
     
     int ok = 1, i, j, w;
@@ -906,7 +1585,7 @@ int testLSTMTrain(void* tc, void* tst) {
     Test * test = (Test*) tst;
     PSNeuralNetwork * network = getNetwork(test_case);
     int train_data_len = 2 + (LSTM_TIMES * 2);
-    double * training_data = getTestData(test_case);
+    ps_real * training_data = getTestData(test_case);
     
     PSTrainingOptions options = {
         .flags = TRAINING_NO_SHUFFLE,
@@ -918,12 +1597,12 @@ int testLSTMTrain(void* tc, void* tst) {
     PSLayer * layer = network->layers[1];
     int i, t, w, ok = 1;
     
+    int times = GetStateArena(layer)->times;
     for (i = 0; i < layer->size; i++) {
         PSNeuron * neuron = layer->neurons[i];
         PSLSTMCell * cell = GetLSTMCell(neuron);
-        int times = cell->states_count;
         for (t = 0; t < times; t++) {
-            double h = getRoundedDouble(cell->states[t]);
+            double h = getRoundedDouble(GetLayerState(layer, i, t));
             double expected = getRoundedDouble(lstm_expected_states[i][t]);
             ok = (h == expected);
             printf("H[%d][%d] = %lf (%s)\n", t, i, h, (ok ? "OK" : "FAIL"));
@@ -1022,12 +1701,10 @@ int testLSTMTrain(void* tc, void* tst) {
     
     PSLayer * out = network->layers[network->size - 1];
     
+    times = GetStateArena(out)->times;
     for (i = 0; i < out->size; i++) {
-        PSNeuron * neuron = out->neurons[i];
-        PSRecurrentCell * cell = GetRecurrentCell(neuron);
-        int times = cell->states_count;
         for (t = 0; t < times; t++) {
-            double h = getRoundedDouble(cell->states[t]);
+            double h = getRoundedDouble(GetLayerState(out, i, t));
             double e = getRoundedDouble(lstm_expected_outputs[t][i]);
             int ok = (h == e);
             if (!ok) {
@@ -1043,6 +1720,131 @@ int testLSTMTrain(void* tc, void* tst) {
     return ok;
 }
 
+// Compares the deltas propagated back from a Convolutional layer to the
+// Pooling layer preceding it with a direct transposed convolution.
+
+int testConvDeltas(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int i, j, y, x, ok = 1;
+    PSNeuralNetwork * network = PSCreateNetwork("Conv Deltas Network");
+    if (network == NULL) return 0;
+    PSAddLayer(network, FullyConnected, 100, NULL);
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(2, 3, 1, 0, 0));
+    PSAddPoolingLayer(network, PSCreateConvolutionalParameters(2, 2, 0, 0, 0));
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(4, 2, 1, 0, 0));
+    if (network->size != 4) {
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    PSLayer * pooling = network->layers[2];
+    PSLayer * conv = network->layers[3];
+    ps_real inputs[100];
+    for (i = 0; i < 100; i++) inputs[i] = (ps_real) (i % 7) / 7.0;
+    PSFeedforward(network, inputs);
+    ps_real last_delta[conv->size], delta[pooling->size];
+    ps_real expected[pooling->size];
+    for (i = 0; i < conv->size; i++)
+        last_delta[i] = (ps_real) ((i * 5) % 11) / 11.0 - 0.5;
+    getConvolutionalLayerDeltas(pooling, conv, last_delta, delta);
+    // Pooling: 2 maps of 4x4, Conv: 4 features of 3x3 (2 per map)
+    memset(expected, 0, pooling->size * sizeof(ps_real));
+    for (i = 0; i < 4; i++) {
+        ps_real * weights = conv->weights + (i * conv->weights_stride);
+        ps_real * map = expected + ((i / 2) * 16);
+        for (j = 0; j < 9; j++) {
+            ps_real d = last_delta[(i * 9) + j];
+            int row = j / 3, col = j % 3;
+            for (y = 0; y < 2; y++) {
+                for (x = 0; x < 2; x++)
+                    map[((row + y) * 4) + col + x] += d * weights[(y * 2) + x];
+            }
+        }
+    }
+    for (i = 0; i < pooling->size; i++) {
+        double exp_val = expected[i] *
+                         pooling->derivative(pooling->activations[i]);
+        if (fabs(exp_val - delta[i]) > TEST_TOLERANCE) {
+            char * msg = malloc(255 * sizeof(char));
+            test->error_message = msg;
+            sprintf(msg, "Delta[%d]: %lf != %lf\n", i, delta[i], exp_val);
+            ok = 0;
+            break;
+        }
+    }
+    PSDeleteNetwork(network);
+    return ok;
+}
+
+// Compares the outputs of the Winograd kernels with the ones of the im2col
+// kernel. Feature maps sizes are not multiple of the tiles sizes, so that
+// partial tiles are tested too.
+
+#define WINOGRAD_TOLERANCE TEST_TOLERANCE
+
+int testConvWinograd(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int i, l, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * network = PSCreateNetwork("Winograd Network");
+    if (network == NULL) return 0;
+    PSAddLayer(network, FullyConnected, 400, NULL);
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(3, 3, 1, 0, 0));
+    PSAddPoolingLayer(network, PSCreateConvolutionalParameters(3, 2, 0, 0, 0));
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(6, 3, 1, 0, 1));
+    if (network->size != 4) {
+        sprintf(msg, "Could not create network!\n");
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    // 18x18 and 7x7 feature maps
+    int kernels[] = {CONV_KERNEL_WINOGRAD_4X4, CONV_KERNEL_WINOGRAD_2X2};
+    PSLayer * layers[] = {network->layers[1], network->layers[3]};
+    for (l = 0; l < 2; l++) {
+        PSSharedParams * shared = getConvSharedParams(layers[l]);
+        if (shared->kernel != kernels[l]) {
+            sprintf(msg, "Layer[%d]: kernel %d != %d\n", layers[l]->index,
+                    shared->kernel, kernels[l]);
+            PSDeleteNetwork(network);
+            return 0;
+        }
+    }
+    ps_real inputs[400];
+    for (i = 0; i < 400; i++) inputs[i] = (ps_real) ((i * 13) % 17) / 17.0;
+    ok = PSFeedforward(network, inputs);
+    int max_size = layers[0]->size;
+    if (layers[1]->size > max_size) max_size = layers[1]->size;
+    ps_real winograd_z[2][max_size];
+    for (l = 0; l < 2; l++) {
+        memcpy(winograd_z[l], layers[l]->z_values,
+               layers[l]->size * sizeof(ps_real));
+        getConvSharedParams(layers[l])->kernel = CONV_KERNEL_IM2COL;
+    }
+    ok = ok && PSFeedforward(network, inputs);
+    if (!ok) sprintf(msg, "Feedforward failed!\n");
+    for (l = 0; l < 2 && ok; l++) {
+        for (i = 0; i < layers[l]->size; i++) {
+            ps_real z = layers[l]->z_values[i];
+            if (fabs(z - winograd_z[l][i]) > WINOGRAD_TOLERANCE) {
+                sprintf(msg, "Layer[%d] z[%d]: %lf != %lf\n",
+                        layers[l]->index, i, winograd_z[l][i], z);
+                ok = 0;
+                break;
+            }
+        }
+    }
+    PSDeleteNetwork(network);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
 int testGenericClone(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
@@ -1061,6 +1863,492 @@ int testGenericClone(void* tc, void* t) {
     return ok;
 }
 
+/* Trains two clones of the network on the same data, the first one serially
+ * and the second one splitting every batch across threads: apart from the
+ * order of the gradients sums, they must end up with the same parameters. */
+int testGenericParallelTrain(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    int datalen = PARALLEL_TRAIN_SAMPLES * element_size, i, j, ok = 1;
+    PSNeuralNetwork * serial = PSCloneNetwork(network, 0);
+    PSNeuralNetwork * parallel = PSCloneNetwork(network, 0);
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    if (serial == NULL || parallel == NULL) {
+        sprintf(msg, "Could not create network clones!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSTrainingOptions options = {
+        .flags = TRAINING_NO_SHUFFLE,
+        .l2_decay = 0.0
+    };
+    PSTrain(serial, test_data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH,
+            &options, NULL, 0);
+    options.threads = PARALLEL_TRAIN_THREADS;
+    PSTrain(parallel, test_data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH,
+            &options, NULL, 0);
+    ok = (serial->status == STATUS_TRAINED &&
+          parallel->status == STATUS_TRAINED);
+    if (!ok) {
+        sprintf(msg, "Training failed!\n");
+        goto cleanup;
+    }
+    for (i = 1; i < network->size && ok; i++) {
+        PSLayer * s_layer = serial->layers[i];
+        PSLayer * p_layer = parallel->layers[i];
+        if (s_layer->weights == NULL) continue;
+        int rows = getLayerWeightsRows(s_layer);
+        int size = rows * s_layer->weights_stride;
+        for (j = 0; j < size; j++) {
+            double diff = fabs(s_layer->weights[j] - p_layer->weights[j]);
+            ok = (diff < TEST_TOLERANCE);
+            if (!ok) {
+                sprintf(msg, "Layer[%d]->weights[%d]: %.15e != %.15e\n", i,
+                        j, (double) s_layer->weights[j],
+                        (double) p_layer->weights[j]);
+                break;
+            }
+        }
+        for (j = 0; j < rows && ok; j++) {
+            double diff = fabs(s_layer->biases[j] - p_layer->biases[j]);
+            ok = (diff < TEST_TOLERANCE);
+            if (!ok)
+                sprintf(msg, "Layer[%d]->biases[%d]: %.15e != %.15e\n", i,
+                        j, (double) s_layer->biases[j],
+                        (double) p_layer->biases[j]);
+        }
+    }
+cleanup:
+    if (serial != NULL) PSDeleteNetwork(serial);
+    if (parallel != NULL) PSDeleteNetwork(parallel);
+    return ok;
+}
+
+/* Hogwild updates aren't deterministic, so the network trained by them is
+ * only required not to lose accuracy with respect to the loaded one. */
+int testGenericHogwildTrain(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    int datalen = HOGWILD_TRAIN_SAMPLES * element_size, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * clone = PSCloneNetwork(network, 0);
+    if (clone == NULL) {
+        sprintf(msg, "Could not create network clone!\n");
+        return 0;
+    }
+    // Shuffling must leave the training data untouched
+    ps_real * data = malloc(datalen * sizeof(ps_real));
+    if (data == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        PSDeleteNetwork(clone);
+        return 0;
+    }
+    memcpy(data, test_data, datalen * sizeof(ps_real));
+    PSTrainingOptions options = {
+        .flags = TRAINING_HOGWILD,
+        .l2_decay = 0.0,
+        .threads = PARALLEL_TRAIN_THREADS
+    };
+    PSTrain(clone, data, datalen, 1, 0.5, PARALLEL_TRAIN_BATCH, &options,
+            NULL, 0);
+    ok = (clone->status == STATUS_TRAINED);
+    if (!ok) sprintf(msg, "Training failed!\n");
+    else if (memcmp(data, test_data, datalen * sizeof(ps_real)) != 0) {
+        sprintf(msg, "Training data has been modified!\n");
+        ok = 0;
+    } else {
+        double expected = round(PSTest(network, test_data, datalen) * 100);
+        double accuracy = round(PSTest(clone, test_data, datalen) * 100);
+        ok = (accuracy >= expected - HOGWILD_MAX_ACCURACY_LOSS);
+        if (!ok)
+            sprintf(msg, "Accuracy %d%% < %d%%\n", (int) accuracy,
+                    (int) expected);
+    }
+    free(data);
+    PSDeleteNetwork(clone);
+    return ok;
+}
+
+/* The checkpoint saved at the end of training must match the trained
+ * network, even after being written many times in background. */
+int testGenericCheckpoint(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    int datalen = PARALLEL_TRAIN_SAMPLES * element_size, ok = 1;
+    char tmpfile[255], checkpoint_tmpfile[260];
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    getTmpFileName("tests-checkpoint-nn", ".data", tmpfile);
+    sprintf(checkpoint_tmpfile, "%s.tmp", tmpfile);
+    PSNeuralNetwork * clone = PSCloneNetwork(network, 0);
+    PSNeuralNetwork * loaded = PSCreateNetwork("Checkpoint Test Network");
+    if (clone == NULL || loaded == NULL) {
+        sprintf(msg, "Could not create networks!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSTrainingOptions options = {
+        .flags = TRAINING_NO_SHUFFLE,
+        .l2_decay = 0.0,
+        .checkpoint_file = tmpfile,
+        .checkpoint_epochs = 1,
+        .checkpoint_batches = CHECKPOINT_BATCHES
+    };
+    PSTrain(clone, test_data, datalen, CHECKPOINT_EPOCHS, 0.5,
+            PARALLEL_TRAIN_BATCH, &options, NULL, 0);
+    if (clone->status != STATUS_TRAINED) {
+        sprintf(msg, "Training failed!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    if (!PSLoadNetwork(loaded, tmpfile)) {
+        sprintf(msg, "Could not load checkpoint!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    if (remove(checkpoint_tmpfile) == 0) {
+        sprintf(msg, "Temporary checkpoint file left behind!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    free(msg);
+    test->error_message = NULL;
+    ok = compareNetworks(clone, loaded, test);
+cleanup:
+    remove(tmpfile);
+    if (clone != NULL) PSDeleteNetwork(clone);
+    if (loaded != NULL) PSDeleteNetwork(loaded);
+    return ok;
+}
+
+/* Feedforwards the inputs with the layers split across threads, comparing
+ * the activations of every layer with the ones computed serially. */
+static int compareThreadedFeedforward(PSNeuralNetwork * network,
+                                      ps_real * inputs, char * msg)
+{
+    int l, i, ok = 1, total_size = 0;
+    for (l = 1; l < network->size; l++)
+        total_size += network->layers[l]->size;
+    ps_real * expected = malloc(total_size * sizeof(ps_real));
+    if (expected == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        return 0;
+    }
+    ok = PSFeedforward(network, inputs);
+    ps_real * a = expected;
+    for (l = 1; l < network->size; l++) {
+        PSLayer * layer = network->layers[l];
+        memcpy(a, layer->activations, layer->size * sizeof(ps_real));
+        a += layer->size;
+    }
+    ok = ok && PSSetThreadCount(FEEDFORWARD_THREADS);
+    ok = ok && PSFeedforward(network, inputs);
+    PSSetThreadCount(1);
+    if (!ok) {
+        sprintf(msg, "Feedforward failed!\n");
+        free(expected);
+        return 0;
+    }
+    a = expected;
+    for (l = 1; l < network->size && ok; l++) {
+        PSLayer * layer = network->layers[l];
+        for (i = 0; i < layer->size; i++) {
+            if (fabs(layer->activations[i] - a[i]) > TEST_TOLERANCE) {
+                sprintf(msg, "Layer[%d] activation[%d]: %lf != %lf\n", l,
+                        i, (double) layer->activations[i], (double) a[i]);
+                ok = 0;
+                break;
+            }
+        }
+        a += layer->size;
+    }
+    free(expected);
+    return ok;
+}
+
+int testGenericThreadedFeedforward(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size, i, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    for (i = 0; i < THREADED_FEEDFORWARD_SAMPLES && ok; i++) {
+        ok = compareThreadedFeedforward(network,
+                                        test_data + (i * element_size), msg);
+    }
+    return ok;
+}
+
+/* The test network's features are too large for Winograd kernels, so they
+ * are tested on a network with several input maps, forcing every kernel. */
+int testConvThreadedWinograd(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int i, k, l, ok = 1;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * network = PSCreateNetwork("Threaded Winograd Network");
+    if (network == NULL) return 0;
+    PSAddLayer(network, FullyConnected, 900, NULL);
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(16, 3, 1, 0, 0));
+    PSAddPoolingLayer(network,
+                      PSCreateConvolutionalParameters(16, 2, 0, 0, 0));
+    PSAddConvolutionalLayer(network,
+                            PSCreateConvolutionalParameters(32, 3, 1, 0, 1));
+    if (network->size != 4) {
+        sprintf(msg, "Could not create network!\n");
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    ps_real inputs[900];
+    for (i = 0; i < 900; i++) inputs[i] = (ps_real) ((i * 13) % 17) / 17.0;
+    int kernels[] = {
+        CONV_KERNEL_WINOGRAD_2X2,
+        CONV_KERNEL_WINOGRAD_4X4,
+        CONV_KERNEL_IM2COL
+    };
+    for (k = 0; k < 3 && ok; k++) {
+        for (l = 1; l < network->size; l++) {
+            PSLayer * layer = network->layers[l];
+            if (layer->type != Convolutional) continue;
+            getConvSharedParams(layer)->kernel = kernels[k];
+        }
+        ok = compareThreadedFeedforward(network, inputs, msg);
+    }
+    PSDeleteNetwork(network);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+typedef struct {
+    PSInferenceContext * context;
+    ps_real * data;
+    int element_size;
+    int first;
+    int last;
+    int * results;
+} ContextTestJob;
+
+static void * classifyWithContext(void * arg) {
+    ContextTestJob * job = (ContextTestJob *) arg;
+    int i;
+    for (i = job->first; i < job->last; i++) {
+        job->results[i] = PSContextClassify(job->context, job->data +
+                                            (i * job->element_size));
+    }
+    return NULL;
+}
+
+/* Many threads classify samples through the same network, each one with its
+ * own context, while the network's own activations must stay untouched. */
+int testGenericInferenceContext(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    int i, ok = 1, started = 0;
+    PSInferenceContext * contexts[CONTEXT_THREADS] = {NULL};
+    pthread_t threads[CONTEXT_THREADS];
+    ContextTestJob jobs[CONTEXT_THREADS];
+    int expected[CONTEXT_SAMPLES], results[CONTEXT_SAMPLES];
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSLayer * output = network->layers[network->size - 1];
+    ps_real * activations = malloc(output->size * sizeof(ps_real));
+    if (activations == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        return 0;
+    }
+    for (i = 0; i < CONTEXT_SAMPLES; i++)
+        expected[i] = PSClassify(network, test_data + (i * element_size));
+    memcpy(activations, output->activations, output->size * sizeof(ps_real));
+    for (i = 0; i < CONTEXT_THREADS && ok; i++) {
+        contexts[i] = PSCreateInferenceContext(network);
+        ok = (contexts[i] != NULL);
+        if (!ok) {
+            sprintf(msg, "Could not create context!\n");
+            goto cleanup;
+        }
+        jobs[i].context = contexts[i];
+        jobs[i].data = test_data;
+        jobs[i].element_size = element_size;
+        jobs[i].first = (CONTEXT_SAMPLES * i) / CONTEXT_THREADS;
+        jobs[i].last = (CONTEXT_SAMPLES * (i + 1)) / CONTEXT_THREADS;
+        jobs[i].results = results;
+    }
+    for (i = 0; i < CONTEXT_THREADS; i++) {
+        if (pthread_create(&(threads[i]), NULL, classifyWithContext,
+                           &(jobs[i])) != 0) break;
+        started++;
+    }
+    for (i = 0; i < started; i++) pthread_join(threads[i], NULL);
+    if (started < CONTEXT_THREADS) {
+        sprintf(msg, "Could not start threads!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    for (i = 0; i < CONTEXT_SAMPLES; i++) {
+        if (results[i] != expected[i]) {
+            sprintf(msg, "Sample[%d]: class %d != %d\n", i, results[i],
+                    expected[i]);
+            ok = 0;
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < output->size; i++) {
+        if (output->activations[i] != activations[i]) {
+            sprintf(msg, "Network output[%d] changed!\n", i);
+            ok = 0;
+            goto cleanup;
+        }
+    }
+cleanup:
+    for (i = 0; i < CONTEXT_THREADS; i++)
+        PSDeleteInferenceContext(contexts[i]);
+    free(activations);
+    return ok;
+}
+
+/* Validates the network on the given data both serially and sharding it
+ * across threads: the accuracy must be the same. */
+static int compareParallelTest(PSNeuralNetwork * network, ps_real * data,
+                               int data_size, char * msg)
+{
+    float expected = PSTest(network, data, data_size);
+    int ok = PSSetThreadCount(PARALLEL_TEST_THREADS);
+    float accuracy = PSTest(network, data, data_size);
+    PSSetThreadCount(1);
+    if (!ok) {
+        sprintf(msg, "Could not create threads!\n");
+        return 0;
+    }
+    if (accuracy != expected) {
+        sprintf(msg, "Accuracy %f != %f\n", accuracy, expected);
+        return 0;
+    }
+    return 1;
+}
+
+int testGenericParallelTest(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    int element_size = network->input_size + network->output_size;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    return compareParallelTest(network, test_data,
+                               PARALLEL_TEST_SAMPLES * element_size, msg);
+}
+
+/* Random series, long enough to be sharded across threads. */
+int testRNNParallelTest(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    int series_size = 1 + (RNN_TIMES * 2), i, j, ok;
+    int data_size = 1 + (RNN_PARALLEL_TEST_SERIES * series_size);
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    ps_real * data = malloc(data_size * sizeof(ps_real));
+    if (data == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        return 0;
+    }
+    ps_real * p = data;
+    *(p++) = RNN_PARALLEL_TEST_SERIES;
+    for (i = 0; i < RNN_PARALLEL_TEST_SERIES; i++) {
+        *(p++) = RNN_TIMES;
+        for (j = 0; j < RNN_TIMES * 2; j++) *(p++) = rand() % RNN_INPUT_SIZE;
+    }
+    ok = compareParallelTest(network, data, data_size, msg);
+    free(data);
+    return ok;
+}
+
+int testGenericFeedforwardBatch(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    ps_real * test_data = getTestData(test_case);
+    // Use more samples than a single batch chunk in order to test the
+    // chunk boundaries too.
+    int count = 70, i, j, ok = 1;
+    int input_size = network->input_size, output_size = network->output_size;
+    int element_size = input_size + output_size;
+    ps_real * inputs = malloc(count * input_size * sizeof(ps_real));
+    ps_real * outputs = malloc(count * output_size * sizeof(ps_real));
+    int * results = malloc(count * sizeof(int));
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    if (inputs == NULL || outputs == NULL || results == NULL) {
+        sprintf(msg, "Could not allocate memory!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    for (i = 0; i < count; i++) {
+        memcpy(inputs + (i * input_size), test_data + (i * element_size),
+               input_size * sizeof(ps_real));
+    }
+    if (!PSFeedforwardBatch(network, inputs, count, outputs)) {
+        sprintf(msg, "Batch feedforward failed!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    if (!PSClassifyBatch(network, inputs, count, results)) {
+        sprintf(msg, "Batch classification failed!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    PSLayer * output = network->layers[network->size - 1];
+    for (i = 0; i < count && ok; i++) {
+        ps_real * x = inputs + (i * input_size);
+        int expected_class = PSClassify(network, x);
+        if (results[i] != expected_class) {
+            sprintf(msg, "Sample[%d]: class %d != %d", i, results[i],
+                    expected_class);
+            ok = 0;
+            break;
+        }
+        for (j = 0; j < output_size; j++) {
+            double a = getRoundedDouble(outputs[(i * output_size) + j]);
+            double expected = getRoundedDouble(output->activations[j]);
+            if (a != expected) {
+                sprintf(msg, "Sample[%d], Output[%d]-> %lf != %lf", i, j,
+                        a, expected);
+                ok = 0;
+                break;
+            }
+        }
+    }
+cleanup:
+    if (inputs != NULL) free(inputs);
+    if (outputs != NULL) free(outputs);
+    if (results != NULL) free(results);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
 int testGenericSave(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
@@ -1096,6 +2384,217 @@ int testGenericSave(void* tc, void* t) {
     return ok;
 }
 
+/* Binary networks are loaded as views on the mapped file: updating them
+ * must leave the file untouched, and saving them over it must not truncate
+ * the file while it's read. */
+int testGenericSaveBinary(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    PSNeuralNetwork * loaded = NULL, * reloaded = NULL;
+    char tmpfile[255];
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    getTmpFileName("tests-save-nn", ".bin", tmpfile);
+    int ok = PSSaveNetworkBinary(network, tmpfile);
+    if (!ok) {
+        sprintf(msg, "Could not save network!\n");
+        return 0;
+    }
+    loaded = PSCreateNetwork("Binary Test Network");
+    reloaded = PSCreateNetwork("Binary Test Network");
+    if (loaded == NULL || reloaded == NULL) {
+        sprintf(msg, "Could not create networks!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    ok = PSLoadNetwork(loaded, tmpfile);
+    if (!ok) {
+        sprintf(msg, "Could not load network!\n");
+        goto cleanup;
+    }
+    if (loaded->mapping == NULL) {
+        sprintf(msg, "Network parameters are not mapped!\n");
+        ok = 0;
+        goto cleanup;
+    }
+    free(msg);
+    test->error_message = NULL;
+    ok = compareNetworks(network, loaded, test);
+    if (!ok) goto cleanup;
+    loaded->layers[1]->weights[0] += 1.0;
+    ok = PSLoadNetwork(reloaded, tmpfile);
+    if (!ok) {
+        msg = malloc(255 * sizeof(char));
+        test->error_message = msg;
+        sprintf(msg, "Could not reload network!\n");
+        goto cleanup;
+    }
+    ok = compareNetworks(network, reloaded, test);
+    // Saving a mapped network over its own file, in both formats
+    int binary;
+    for (binary = 1; binary >= 0 && ok; binary--) {
+        if (binary) ok = PSSaveNetworkBinary(reloaded, tmpfile);
+        else ok = PSSaveNetwork(reloaded, tmpfile);
+        PSDeleteNetwork(loaded);
+        loaded = PSCreateNetwork("Binary Test Network");
+        ok = ok && loaded != NULL && PSLoadNetwork(loaded, tmpfile);
+        if (!ok) {
+            msg = malloc(255 * sizeof(char));
+            test->error_message = msg;
+            sprintf(msg, "Could not save over the mapped file!\n");
+            goto cleanup;
+        }
+        ok = compareNetworks(network, loaded, test);
+    }
+cleanup:
+    remove(tmpfile);
+    if (loaded != NULL) PSDeleteNetwork(loaded);
+    if (reloaded != NULL) PSDeleteNetwork(reloaded);
+    return ok;
+}
+
+/* Binary files with an invalid version or with another byte order must be
+ * rejected instead of being mapped. */
+#define BINARY_VERSION_OFFSET       8
+#define BINARY_BYTE_ORDER_OFFSET    36
+
+static int loadPatchedBinary(const char * filename, long offset,
+                             int32_t value)
+{
+    int32_t saved;
+    FILE * f = fopen(filename, "r+b");
+    if (f == NULL) return -1;
+    int ok = (fseek(f, offset, SEEK_SET) == 0 &&
+              fread(&saved, sizeof(saved), 1, f) == 1 &&
+              fseek(f, offset, SEEK_SET) == 0 &&
+              fwrite(&value, sizeof(value), 1, f) == 1);
+    fclose(f);
+    if (!ok) return -1;
+    PSNeuralNetwork * network = PSCreateNetwork("Binary Header Network");
+    int loaded = (network != NULL && PSLoadNetwork(network, filename));
+    if (network != NULL) PSDeleteNetwork(network);
+    f = fopen(filename, "r+b");
+    if (f == NULL) return -1;
+    ok = (fseek(f, offset, SEEK_SET) == 0 &&
+          fwrite(&saved, sizeof(saved), 1, f) == 1);
+    fclose(f);
+    return (ok ? loaded : -1);
+}
+
+int testFullBinaryHeader(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    char tmpfile[255];
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    getTmpFileName("tests-header-nn", ".bin", tmpfile);
+    if (!PSSaveNetworkBinary(network, tmpfile)) {
+        sprintf(msg, "Could not save network!\n");
+        return 0;
+    }
+    // The byte order tag as read on a machine with another byte order
+    int32_t byte_order = 0x04030201;
+    int ok = 1;
+    if (loadPatchedBinary(tmpfile, BINARY_VERSION_OFFSET, 0) != 0) {
+        sprintf(msg, "Version 0 not rejected!\n");
+        ok = 0;
+    } else if (loadPatchedBinary(tmpfile, BINARY_VERSION_OFFSET, -1) != 0) {
+        sprintf(msg, "Negative version not rejected!\n");
+        ok = 0;
+    } else if (loadPatchedBinary(tmpfile, BINARY_BYTE_ORDER_OFFSET,
+                                 byte_order) != 0) {
+        sprintf(msg, "Different byte order not rejected!\n");
+        ok = 0;
+    } else if (loadPatchedBinary(tmpfile, BINARY_VERSION_OFFSET, 1) != 1) {
+        sprintf(msg, "Could not load network!\n");
+        ok = 0;
+    }
+    remove(tmpfile);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
+/* Loaded parameters must be exactly the values strtod reads from the
+ * saved text, regardless of the number of threads parsing it. */
+static int isExactlyLoaded(ps_real value, ps_real loaded) {
+    char buff[64];
+    sprintf(buff, PS_REAL_FMT, value);
+    return ((ps_real) strtod(buff, NULL) == loaded);
+}
+
+int testGenericLoadPrecision(void* tc, void* t) {
+    TestCase * test_case = (TestCase*) tc;
+    Test * test = (Test*) t;
+    PSNeuralNetwork * network = getNetwork(test_case);
+    PSNeuralNetwork * loaded = NULL;
+    char tmpfile[255];
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    int i, j, k, ok;
+    getTmpFileName("tests-load-nn", ".data", tmpfile);
+    if (!PSSaveNetwork(network, tmpfile)) {
+        sprintf(msg, "Could not save network!\n");
+        return 0;
+    }
+    loaded = PSCreateNetwork("Load Test Network");
+    ok = (loaded != NULL && PSSetThreadCount(FEEDFORWARD_THREADS));
+    ok = ok && PSLoadNetwork(loaded, tmpfile);
+    PSSetThreadCount(1);
+    if (!ok) {
+        sprintf(msg, "Could not load network!\n");
+        goto cleanup;
+    }
+    for (i = 1; i < network->size && ok; i++) {
+        PSLayer * layer = network->layers[i];
+        PSLayer * llayer = loaded->layers[i];
+        if (layer->type == Pooling) continue;
+        if (layer->type == Convolutional) {
+            PSSharedParams * shared = getConvSharedParams(layer);
+            PSSharedParams * lshared = getConvSharedParams(llayer);
+            for (j = 0; j < shared->feature_count && ok; j++) {
+                ok = isExactlyLoaded(shared->biases[j], lshared->biases[j]);
+                for (k = 0; k < shared->weights_size && ok; k++) {
+                    ok = isExactlyLoaded(shared->weights[j][k],
+                                         lshared->weights[j][k]);
+                }
+                if (!ok) sprintf(msg, "Layer[%d], feature[%d] differs!\n",
+                                 i, j);
+            }
+            continue;
+        }
+        for (j = 0; j < layer->size && ok; j++) {
+            PSNeuron * neuron = layer->neurons[j];
+            PSNeuron * lneuron = llayer->neurons[j];
+            if (layer->type == LSTM) {
+                PSLSTMCell * cell = GetLSTMCell(neuron);
+                PSLSTMCell * lcell = GetLSTMCell(lneuron);
+                ok = isExactlyLoaded(cell->candidate_bias,
+                                     lcell->candidate_bias) &&
+                     isExactlyLoaded(cell->input_bias, lcell->input_bias) &&
+                     isExactlyLoaded(cell->output_bias, lcell->output_bias) &&
+                     isExactlyLoaded(cell->forget_bias, lcell->forget_bias);
+            } else ok = isExactlyLoaded(*(neuron->bias), *(lneuron->bias));
+            for (k = 0; k < neuron->weights_size && ok; k++) {
+                ok = isExactlyLoaded(neuron->weights[k], lneuron->weights[k]);
+            }
+            if (!ok) sprintf(msg, "Layer[%d], neuron[%d] differs!\n", i, j);
+        }
+    }
+cleanup:
+    remove(tmpfile);
+    if (loaded != NULL) PSDeleteNetwork(loaded);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
+
 int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * clone,
                     Test* test)
 {
@@ -1169,9 +2668,10 @@ int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * clone,
                             i, fidx, obias, cbias);
                     break;
                 }
-            } else if (otype != Recurrent && otype != LSTM) {
-                double obias = getRoundedDouble(orig_n->bias);
-                double cbias = getRoundedDouble(clone_n->bias);
+            } else if (otype != Recurrent && otype != LSTM &&
+                       otype != Pooling) {
+                double obias = getRoundedDouble(*(orig_n->bias));
+                double cbias = getRoundedDouble(*(clone_n->bias));
                 ok = (obias == cbias);
             } else if (otype == LSTM) {
                 PSLSTMCell * ocell =  GetLSTMCell(orig_n);
@@ -1219,7 +2719,7 @@ int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * clone,
                 char * msg = malloc(255 * sizeof(char));
                 test->error_message = msg;
                 sprintf(msg, "Layer[%d][%d]: bias %.15e != %.15e\n",
-                        i, k, orig_n->bias, clone_n->bias);
+                        i, k, *(orig_n->bias), *(clone_n->bias));
                 break;
             }
             ok = orig_n->weights_size == clone_n->weights_size;
@@ -1251,9 +2751,13 @@ int compareNetworks(PSNeuralNetwork * network, PSNeuralNetwork * clone,
 
 #ifdef USE_AVX
 
-double test_dot(double * x, double * y, int size) {
+/* Single precision kernels process twice as many values per call, so AVX
+ * test arrays are zero padded accordingly. */
+#define AVX_TEST_SIZE(n) ((n) * (int) (sizeof(double) / sizeof(ps_real)))
+
+ps_real test_dot(ps_real * x, ps_real * y, int size) {
     int i;
-    double dot = 0.0;
+    ps_real dot = 0.0;
     for (i = 0; i < size; i++) {
         dot += (x[i] * y[i]);
     }
@@ -1264,22 +2768,22 @@ int testAVXDot(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     
-    double x2[2] = {1.0, 2.0};
-    double y2[2] = {0.5, 0.5};
+    ps_real x2[AVX_TEST_SIZE(2)] = {1.0, 2.0};
+    ps_real y2[AVX_TEST_SIZE(2)] = {0.5, 0.5};
     
-    double x4[4] = {1.0, 1.0, 2.0, 2.0};
-    double y4[4] = {0.5, 0.5, 1.0, 0.5};
+    ps_real x4[AVX_TEST_SIZE(4)] = {1.0, 1.0, 2.0, 2.0};
+    ps_real y4[AVX_TEST_SIZE(4)] = {0.5, 0.5, 1.0, 0.5};
     
-    double x8[8] = {1.0, 1.0, 2.0, 2.0, 3.0, 2.0, 1.0, 1.0};
-    double y8[8] = {0.5, 0.5, 1.0, 0.5, 0.0, 1.0, 2.0, 1.0};
+    ps_real x8[AVX_TEST_SIZE(8)] = {1.0, 1.0, 2.0, 2.0, 3.0, 2.0, 1.0, 1.0};
+    ps_real y8[AVX_TEST_SIZE(8)] = {0.5, 0.5, 1.0, 0.5, 0.0, 1.0, 2.0, 1.0};
     
-    double x16[16] = {1.0, 1.0, 2.0, 2.0, 3.0, 2.0, 1.0, 1.0,
+    ps_real x16[AVX_TEST_SIZE(16)] = {1.0, 1.0, 2.0, 2.0, 3.0, 2.0, 1.0, 1.0,
                       0.5, 1.0, 0.0, 1.0, 3.0, 2.0, 1.0, 1.0};
-    double y16[16] = {0.5, 0.5, 1.0, 0.5, 0.0, 1.0, 2.0, 1.0,
+    ps_real y16[AVX_TEST_SIZE(16)] = {0.5, 0.5, 1.0, 0.5, 0.0, 1.0, 2.0, 1.0,
                       1.0, 2.0, 1.0, 0.0, 0.5, 1.0, 0.5, 0.5};
     
-    double avx_res = avx_dot_product16(x16, y16);
-    double cmp_res = test_dot(x16, y16, 16);
+    ps_real avx_res = avx_dot_product16(x16, y16);
+    ps_real cmp_res = test_dot(x16, y16, AVX_TEST_SIZE(16));
     int ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1290,7 +2794,7 @@ int testAVXDot(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product8(x8, y8);
-    cmp_res = test_dot(x8, y8, 8);
+    cmp_res = test_dot(x8, y8, AVX_TEST_SIZE(8));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1301,7 +2805,7 @@ int testAVXDot(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product4(x4, y4);
-    cmp_res = test_dot(x4, y4, 4);
+    cmp_res = test_dot(x4, y4, AVX_TEST_SIZE(4));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1312,7 +2816,7 @@ int testAVXDot(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product2(x2, y2);
-    cmp_res = test_dot(x2, y2, 2);
+    cmp_res = test_dot(x2, y2, AVX_TEST_SIZE(2));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1329,15 +2833,15 @@ int testAVXSquare(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     
-    double x2[2] = {1.0, 2.0};//5
-    double x4[4] = {1.0, 1.0, 2.0, 2.0};//10
-    double x8[8] = {1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0};//20
+    ps_real x2[AVX_TEST_SIZE(2)] = {1.0, 2.0};//5
+    ps_real x4[AVX_TEST_SIZE(4)] = {1.0, 1.0, 2.0, 2.0};//10
+    ps_real x8[AVX_TEST_SIZE(8)] = {1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0};//20
     
-    double x16[16] = {1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0,
+    ps_real x16[AVX_TEST_SIZE(16)] = {1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0,
         1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 2.0, 2.0}; //40
     
-    double avx_res = avx_dot_product16(x16, x16);
-    double cmp_res = test_dot(x16, x16, 16);
+    ps_real avx_res = avx_dot_product16(x16, x16);
+    ps_real cmp_res = test_dot(x16, x16, AVX_TEST_SIZE(16));
     int ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1348,7 +2852,7 @@ int testAVXSquare(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product8(x8, x8);
-    cmp_res = test_dot(x8, x8, 8);
+    cmp_res = test_dot(x8, x8, AVX_TEST_SIZE(8));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1359,7 +2863,7 @@ int testAVXSquare(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product4(x4, x4);
-    cmp_res = test_dot(x4, x4, 4);
+    cmp_res = test_dot(x4, x4, AVX_TEST_SIZE(4));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1370,7 +2874,7 @@ int testAVXSquare(void* tc, void* t) {
     }
     
     avx_res = avx_dot_product2(x2, x2);
-    cmp_res = test_dot(x2, x2, 2);
+    cmp_res = test_dot(x2, x2, AVX_TEST_SIZE(2));
     ok = avx_res == cmp_res;
     
     if (!ok) {
@@ -1387,17 +2891,17 @@ int testAVXMultiplyVal(void* tc, void* t) {
     TestCase * test_case = (TestCase*) tc;
     Test * test = (Test*) t;
     int ok = 1, i;
-    double x[4] = {0.0, 1.0, 2.0, 3.0};
-    double val = 2.0;
-    double y[4] = {0.0, 2.0, 4.0, 6.0};
-    double dest[4] = {0.0, 0.0, 0.0, 0.0};
+    ps_real x[AVX_TEST_SIZE(4)] = {0.0, 1.0, 2.0, 3.0};
+    ps_real val = 2.0;
+    ps_real y[AVX_TEST_SIZE(4)] = {0.0, 2.0, 4.0, 6.0};
+    ps_real dest[AVX_TEST_SIZE(4)] = {0.0, 0.0, 0.0, 0.0};
     
-    double x2[2] = {2.0, 3.0};
-    double y2[2] = {4.0, 6.0};
-    double dest2[2] = {0.0, 0.0};
+    ps_real x2[AVX_TEST_SIZE(2)] = {2.0, 3.0};
+    ps_real y2[AVX_TEST_SIZE(2)] = {4.0, 6.0};
+    ps_real dest2[AVX_TEST_SIZE(2)] = {0.0, 0.0};
     
     avx_multiply_value4(x, val, dest, 0);
-    for (i = 0; i < 4; i++) {
+    for (i = 0; i < AVX_TEST_SIZE(4); i++) {
         ok = dest[i] == y[i];
         if (!ok) {
             char * msg = malloc(255 * sizeof(char));
@@ -1409,7 +2913,7 @@ int testAVXMultiplyVal(void* tc, void* t) {
     }
     
     avx_multiply_value4(x, val, dest, AVX_STORE_MODE_ADD);
-    for (i = 0; i < 4; i++) {
+    for (i = 0; i < AVX_TEST_SIZE(4); i++) {
         ok = (dest[i] == (y[i] + y[i]));
         if (!ok) {
             char * msg = malloc(255 * sizeof(char));
@@ -1421,7 +2925,7 @@ int testAVXMultiplyVal(void* tc, void* t) {
     }
     
     avx_multiply_value2(x2, val, dest2, 0);
-    for (i = 0; i < 2; i++) {
+    for (i = 0; i < AVX_TEST_SIZE(2); i++) {
         ok = dest2[i] == y2[i];
         if (!ok) {
             char * msg = malloc(255 * sizeof(char));
@@ -1433,7 +2937,7 @@ int testAVXMultiplyVal(void* tc, void* t) {
     }
     
     avx_multiply_value2(x2, val, dest2, AVX_STORE_MODE_ADD);
-    for (i = 0; i < 2; i++) {
+    for (i = 0; i < AVX_TEST_SIZE(2); i++) {
         ok = (dest2[i] == (y2[i] + y2[i]));
         if (!ok) {
             char * msg = malloc(255 * sizeof(char));
@@ -1447,4 +2951,143 @@ int testAVXMultiplyVal(void* tc, void* t) {
     return ok;
 }
 
+// Compares the AVX GEMM kernels with a naive product. Sizes are chosen so
+// that every kernel has row, column and depth remainders and spans more than
+// one cache block. Matrices only hold small integers, so that results are
+// exact regardless of the summation order.
+
+#define GEMM_TEST_M 3
+#define GEMM_TEST_N 70
+#define GEMM_TEST_K 261
+#define GEMM_TEST_LDC (GEMM_TEST_N + 3)
+#define GEMM_TEST_SENTINEL -12345.0
+
+int testAVXGemm(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int m = GEMM_TEST_M, n = GEMM_TEST_N, k = GEMM_TEST_K;
+    int ldc = GEMM_TEST_LDC, i, j, p, form, mode, ok = 1;
+    ps_real * a = malloc(m * k * sizeof(ps_real));
+    ps_real * b = malloc(n * k * sizeof(ps_real));
+    ps_real * c = malloc(m * ldc * sizeof(ps_real));
+    ps_real * expected = malloc(m * n * sizeof(ps_real));
+    char * forms[] = {"NT", "NN", "TN"};
+    for (i = 0; i < m * k; i++) a[i] = (ps_real) ((i * 7) % 5) - 2.0;
+    for (i = 0; i < n * k; i++) b[i] = (ps_real) ((i * 3) % 7) - 3.0;
+    for (form = 0; form < 3 && ok; form++) {
+        for (i = 0; i < m; i++) {
+            for (j = 0; j < n; j++) {
+                ps_real sum = 0.0;
+                for (p = 0; p < k; p++) {
+                    if (form == 0) sum += a[i * k + p] * b[j * k + p];
+                    else if (form == 1) sum += a[i * k + p] * b[p * n + j];
+                    else sum += a[p * m + i] * b[p * n + j];
+                }
+                expected[i * n + j] = sum;
+            }
+        }
+        for (i = 0; i < m * ldc; i++) c[i] = GEMM_TEST_SENTINEL;
+        for (mode = AVX_STORE_MODE_NORM; mode <= AVX_STORE_MODE_ADD; mode++) {
+            if (form == 0) avx_gemm_nt(m, n, k, a, k, b, k, c, ldc, mode);
+            else if (form == 1) avx_gemm_nn(m, n, k, a, k, b, n, c, ldc, mode);
+            else avx_gemm_tn(m, n, k, a, m, b, n, c, ldc, mode);
+        }
+        for (i = 0; i < m && ok; i++) {
+            for (j = 0; j < ldc; j++) {
+                ps_real val = c[i * ldc + j];
+                ps_real exp_val = GEMM_TEST_SENTINEL;
+                if (j < n) exp_val = 2.0 * expected[i * n + j];
+                if (val != exp_val) {
+                    char * msg = malloc(255 * sizeof(char));
+                    test->error_message = msg;
+                    sprintf(msg, "GEMM %s [%d, %d]: Expected %lf != %lf\n",
+                            forms[form], i, j, exp_val, val);
+                    ok = 0;
+                    break;
+                }
+            }
+        }
+    }
+    free(a);
+    free(b);
+    free(c);
+    free(expected);
+    return ok;
+}
+
 #endif
+
+/* Feedforwards a sequence through an LSTM layer fed by dense inputs (whose
+ * products are projected for the whole sequence) and compares its states
+ * with the ones computed gate by gate. */
+int testLSTMGates(void* tc, void* t) {
+    Test * test = (Test*) t;
+    int ok = 1, i, j, w, step;
+    char * msg = malloc(255 * sizeof(char));
+    test->error_message = msg;
+    PSNeuralNetwork * network = PSCreateNetwork("LSTM Gates Network");
+    if (network == NULL) {
+        sprintf(msg, "Could not create network!\n");
+        return 0;
+    }
+    PSAddLayer(network, FullyConnected, RNN_DENSE_INPUTS, NULL);
+    PSAddLayer(network, LSTM, RNN_DENSE_SIZE, NULL);
+    PSAddLayer(network, SoftMax, RNN_DENSE_INPUTS, NULL);
+    if (network->size < 3) {
+        sprintf(msg, "Could not add all layers!\n");
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    PSLayer * layer = network->layers[1];
+    int ws = GetLSTMCell(layer->neurons[0])->weights_size;
+    if (layer->weights_stride != ws * 4) {
+        sprintf(msg, "Unexpected gates matrix stride %d (expected %d)!\n",
+                layer->weights_stride, ws * 4);
+        PSDeleteNetwork(network);
+        return 0;
+    }
+    ps_real inputs[1 + (RNN_DENSE_TIMES * RNN_DENSE_INPUTS)];
+    inputs[0] = RNN_DENSE_TIMES;
+    for (i = 1; i <= RNN_DENSE_TIMES * RNN_DENSE_INPUTS; i++)
+        inputs[i] = ((i % 7) - 3) * 0.25;
+    PSFeedforward(network, inputs);
+    double h[RNN_DENSE_SIZE], c[RNN_DENSE_SIZE];
+    double new_h[RNN_DENSE_SIZE];
+    memset(h, 0, sizeof(h));
+    memset(c, 0, sizeof(c));
+    for (step = 0; step < RNN_DENSE_TIMES && ok; step++) {
+        ps_real * x = inputs + 1 + (step * RNN_DENSE_INPUTS);
+        for (i = 0; i < RNN_DENSE_SIZE; i++) {
+            PSLSTMCell * cell = GetLSTMCell(layer->neurons[i]);
+            double g = cell->candidate_bias, in = cell->input_bias;
+            double o = cell->output_bias, f = cell->forget_bias;
+            for (w = 0; w < ws; w++) {
+                double a = (w < RNN_DENSE_INPUTS ? x[w] :
+                            h[w - RNN_DENSE_INPUTS]);
+                g += a * cell->candidate_weights[w];
+                in += a * cell->input_weights[w];
+                o += a * cell->output_weights[w];
+                f += a * cell->forget_weights[w];
+            }
+            c[i] = tanh(g) * sigmoid(in) + c[i] * sigmoid(f);
+            new_h[i] = sigmoid(o) * tanh(c[i]);
+        }
+        for (j = 0; j < RNN_DENSE_SIZE && ok; j++) {
+            h[j] = new_h[j];
+            double state = getRoundedDouble(GetLayerState(layer, j, step));
+            double expected = getRoundedDouble(h[j]);
+            ok = (state == expected);
+            if (!ok) sprintf(msg, "State[%d][%d]: %lf != %lf\n",
+                             step, j, state, expected);
+        }
+    }
+    if (ok && GetStateArena(layer)->projected) {
+        sprintf(msg, "Projected inputs have not been reset!\n");
+        ok = 0;
+    }
+    PSDeleteNetwork(network);
+    if (ok) {
+        free(msg);
+        test->error_message = NULL;
+    }
+    return ok;
+}
@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <stdlib.h>
+#include "psyc.h"
+#include "utils.h"
+#include "threads.h"
+
+typedef struct {
+    PSWorkerPool * pool;
+    int index;
+} PSWorkerInfo;
+
+static PSWorkerPool * library_pool = NULL;
+static pthread_mutex_t library_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Set on threads running a job, so that nested jobs are run serially
+static __thread int running_job = 0;
+
+static void * workerLoop(void * arg) {
+    PSWorkerInfo * info = (PSWorkerInfo *) arg;
+    PSWorkerPool * pool = info->pool;
+    int index = info->index;
+    unsigned long generation = 0;
+    free(info);
+    running_job = 1;
+    while (1) {
+        pthread_mutex_lock(&(pool->lock));
+        while (!pool->stopped && pool->generation == generation)
+            pthread_cond_wait(&(pool->start), &(pool->lock));
+        if (pool->stopped) {
+            pthread_mutex_unlock(&(pool->lock));
+            break;
+        }
+        generation = pool->generation;
+        PSWorkerFunction job = pool->job;
+        void * job_arg = pool->arg;
+        pthread_mutex_unlock(&(pool->lock));
+        job(job_arg, index, pool->count);
+        pthread_mutex_lock(&(pool->lock));
+        if (--(pool->pending) == 0) pthread_cond_signal(&(pool->done));
+        pthread_mutex_unlock(&(pool->lock));
+    }
+    return NULL;
+}
+
+PSWorkerPool * PSCreateWorkerPool(int count) {
+    char * func = "PSCreateWorkerPool";
+    if (count < 1) count = 1;
+    PSWorkerPool * pool = calloc(1, sizeof(PSWorkerPool));
+    if (pool == NULL) {
+        printMemoryErrorMsg();
+        return NULL;
+    }
+    pool->threads = calloc(count, sizeof(pthread_t));
+    if (pool->threads == NULL) {
+        printMemoryErrorMsg();
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&(pool->lock), NULL);
+    pthread_cond_init(&(pool->start), NULL);
+    pthread_cond_init(&(pool->done), NULL);
+    pool->count = 1;
+    int i;
+    for (i = 1; i < count; i++) {
+        PSWorkerInfo * info = malloc(sizeof(PSWorkerInfo));
+        if (info == NULL) {
+            printMemoryErrorMsg();
+            PSDeleteWorkerPool(pool);
+            return NULL;
+        }
+        info->pool = pool;
+        info->index = i;
+        if (pthread_create(&(pool->threads[i]), NULL, workerLoop, info)) {
+            PSErr(func, "Could not create worker thread %d!", i);
+            free(info);
+            PSDeleteWorkerPool(pool);
+            return NULL;
+        }
+        pool->count++;
+    }
+    return pool;
+}
+
+void PSRunWorkers(PSWorkerPool * pool, PSWorkerFunction job, void * arg) {
+    int was_running = running_job;
+    if (pool->count == 1) {
+        running_job = 1;
+        job(arg, 0, 1);
+        running_job = was_running;
+        return;
+    }
+    pthread_mutex_lock(&(pool->lock));
+    pool->job = job;
+    pool->arg = arg;
+    pool->pending = pool->count - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&(pool->start));
+    pthread_mutex_unlock(&(pool->lock));
+    running_job = 1;
+    job(arg, 0, pool->count);
+    running_job = was_running;
+    pthread_mutex_lock(&(pool->lock));
+    while (pool->pending > 0)
+        pthread_cond_wait(&(pool->done), &(pool->lock));
+    pthread_mutex_unlock(&(pool->lock));
+}
+
+void PSDeleteWorkerPool(PSWorkerPool * pool) {
+    if (pool == NULL) return;
+    int i;
+    pthread_mutex_lock(&(pool->lock));
+    pool->stopped = 1;
+    pthread_cond_broadcast(&(pool->start));
+    pthread_mutex_unlock(&(pool->lock));
+    for (i = 1; i < pool->count; i++) pthread_join(pool->threads[i], NULL);
+    pthread_mutex_destroy(&(pool->lock));
+    pthread_cond_destroy(&(pool->start));
+    pthread_cond_destroy(&(pool->done));
+    free(pool->threads);
+    free(pool);
+}
+
+void PSGetWorkerRange(int size, int worker, int count, int * first,
+                      int * last)
+{
+    *first = (int) (((long) size * worker) / count);
+    *last = (int) (((long) size * (worker + 1)) / count);
+}
+
+int PSSetThreadCount(int count) {
+    int ok = 1;
+    pthread_mutex_lock(&library_pool_lock);
+    PSDeleteWorkerPool(library_pool);
+    library_pool = NULL;
+    if (count > 1) {
+        library_pool = PSCreateWorkerPool(count);
+        ok = (library_pool != NULL);
+    }
+    pthread_mutex_unlock(&library_pool_lock);
+    return ok;
+}
+
+int PSGetThreadCount() {
+    pthread_mutex_lock(&library_pool_lock);
+    int count = (library_pool != NULL ? library_pool->count : 1);
+    pthread_mutex_unlock(&library_pool_lock);
+    return count;
+}
+
+void PSRunLayerWorkers(PSWorkerFunction job, void * arg, long work) {
+    if (running_job || work < PS_PARALLEL_MIN_WORK || library_pool == NULL ||
+        pthread_mutex_trylock(&library_pool_lock) != 0)
+    {
+        job(arg, 0, 1);
+        return;
+    }
+    if (library_pool != NULL) PSRunWorkers(library_pool, job, arg);
+    else job(arg, 0, 1);
+    pthread_mutex_unlock(&library_pool_lock);
+}
@@ -0,0 +1,66 @@
+/*
+ Copyright (c) 2016 Fabio Nicotra.
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms are permitted
+ provided that the above copyright notice and this paragraph are
+ duplicated in all such forms and that any documentation,
+ advertising materials, and other materials related to such
+ distribution and use acknowledge that the software was developed
+ by the copyright holder. The name of the
+ copyright holder may not be used to endorse or promote products derived
+ from this software without specific prior written permission.
+ THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef __PS_THREADS_H
+#define __PS_THREADS_H
+
+#include <pthread.h>
+
+/* A set of persistent worker threads running the same job on every worker.
+ * The calling thread takes part in every run as worker 0, so a pool of
+ * `count` workers only spawns `count - 1` threads. */
+
+typedef void (*PSWorkerFunction) (void * arg, int worker, int count);
+
+typedef struct {
+    int count;
+    pthread_t * threads;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    PSWorkerFunction job;
+    void * arg;
+    unsigned long generation; // Incremented on every run
+    int pending; // Threads still running the current job
+    int stopped;
+} PSWorkerPool;
+
+PSWorkerPool * PSCreateWorkerPool(int count);
+/* Runs job(arg, worker, count) on every worker and waits for all of them
+ * to complete. */
+void PSRunWorkers(PSWorkerPool * pool, PSWorkerFunction job, void * arg);
+void PSDeleteWorkerPool(PSWorkerPool * pool);
+
+/* Splits `size` items into `count` contiguous ranges, returning the range
+ * [first, last) of the given worker. */
+void PSGetWorkerRange(int size, int worker, int count, int * first,
+                      int * last);
+
+/* Library-wide pool (see PSSetThreadCount), used to split the neurons or
+ * features of a single layer across workers. A layer is only split when it
+ * takes at least PS_PARALLEL_MIN_WORK multiply-adds, since waking the
+ * workers up costs a few microseconds. */
+
+#define PS_PARALLEL_MIN_WORK 32768
+
+/* Runs a job taking `work` multiply-adds on the library's workers. It's run
+ * on the calling thread alone when the pool is disabled or busy with another
+ * caller, when the work is too small or when the caller is a worker itself,
+ * so jobs must not assume a given number of workers. */
+void PSRunLayerWorkers(PSWorkerFunction job, void * arg, long work);
+
+#endif //__PS_THREADS_H
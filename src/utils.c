@@ -15,11 +15,15 @@
  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <time.h>
+#include <stdint.h>
 #include "psyc.h"
 #include "utils.h"
 
@@ -44,23 +48,23 @@ void PSErr(const char* tag, char* fmt, ...) {
 
 /* Activation Functions */
 
-double sigmoid(double val) {
+ps_real sigmoid(ps_real val) {
     return 1.0 / (1.0 + exp(-val));
 }
 
-double sigmoid_derivative(double val) {
+ps_real sigmoid_derivative(ps_real val) {
     return val * (1 - val);
 }
 
-double relu(double val) {
+ps_real relu(ps_real val) {
     return (val >= 0.0 ? val : 0.0);
 }
 
-double relu_derivative(double val) {
-    return (double)(val > 0.0);
+ps_real relu_derivative(ps_real val) {
+    return (ps_real)(val > 0.0);
 }
 
-double tanh_derivative(double val) {
+ps_real tanh_derivative(ps_real val) {
     return (1 - (val * val));
 }
 
@@ -85,8 +89,98 @@ void PSAbortLayer(PSNeuralNetwork * network, PSLayer * layer) {
     }
 }
 
+static int initLayerTensors(PSLayer * layer, int rows, int weights_size,
+                            int stride)
+{
+    int size = layer->size;
+    layer->activations = PSCreateTensor(size);
+    layer->z_values = PSCreateTensor(size);
+    if (layer->activations == NULL || layer->z_values == NULL) return 0;
+    if (weights_size <= 0 || rows <= 0) return 1;
+    layer->weights_stride = stride;
+    layer->weights = PSCreateTensor(rows * layer->weights_stride);
+    layer->biases = PSCreateTensor(rows);
+    return (layer->weights != NULL && layer->biases != NULL);
+}
+
+int PSInitLayerTensors(PSLayer * layer, int rows, int weights_size) {
+    return initLayerTensors(layer, rows, weights_size,
+                            getTensorStride(weights_size));
+}
+
+int PSInitPackedLayerTensors(PSLayer * layer, int rows, int weights_size) {
+    return initLayerTensors(layer, rows, weights_size, weights_size);
+}
+
+/* Memory */
+
+ps_real * PSCreateTensor(int size) {
+    void * tensor = NULL;
+    size_t bytes = getTensorStride(size > 0 ? size : 1) * sizeof(ps_real);
+    if (posix_memalign(&tensor, PS_TENSOR_ALIGNMENT, bytes) != 0)
+        return NULL;
+    memset(tensor, 0, bytes);
+    return (ps_real *) tensor;
+}
+
 /* Misc */
 
+static const double exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_POWER_OF_TEN 22
+#define MAX_EXACT_MANTISSA (1ULL << 53)
+
+/* Numbers whose digits fit a double mantissa and whose exponent has an
+ * exact double power of ten are computed with a single (correctly rounded)
+ * multiplication or division. Any other number is left to strtod. */
+double PSParseReal(const char * str, char ** end) {
+    const char * p = str;
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    const char * start = p;
+    int negative = 0, exponent = 0, digits = 0, exact = 1;
+    uint64_t mantissa = 0;
+    if (*p == '-' || *p == '+') negative = (*(p++) == '-');
+    const char * digits_start = p;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        if (mantissa > 0 || *p != '0') digits++;
+        if (digits > 19) exact = 0;
+        else mantissa = (mantissa * 10) + (*p - '0');
+    }
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            if (mantissa > 0 || *p != '0') digits++;
+            if (digits > 19) exact = 0;
+            else mantissa = (mantissa * 10) + (*p - '0');
+            exponent--;
+        }
+    }
+    if (p == digits_start || (p == digits_start + 1 && *digits_start == '.')
+        || *p == 'x' || *p == 'X')
+        return strtod(start, end);
+    if (*p == 'e' || *p == 'E') {
+        const char * e = p + 1;
+        int exp_negative = 0, exp_value = 0;
+        if (*e == '-' || *e == '+') exp_negative = (*(e++) == '-');
+        if (*e < '0' || *e > '9') return strtod(start, end);
+        for (; *e >= '0' && *e <= '9'; e++) {
+            if (exp_value < 10000) exp_value = (exp_value * 10) + (*e - '0');
+        }
+        exponent += (exp_negative ? -exp_value : exp_value);
+        p = e;
+    }
+    if (!exact || mantissa > MAX_EXACT_MANTISSA ||
+        exponent > MAX_EXACT_POWER_OF_TEN ||
+        exponent < -MAX_EXACT_POWER_OF_TEN)
+        return strtod(start, end);
+    double value = (double) mantissa;
+    if (exponent < 0) value /= exact_powers_of_ten[-exponent];
+    else value *= exact_powers_of_ten[exponent];
+    if (end != NULL) *end = (char *) p;
+    return (negative ? -value : value);
+}
 
 double normalized_random() {
     if (!randomSeeded) {
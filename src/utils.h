@@ -28,6 +28,20 @@
 #define getLayerNetwork(layer) ((PSNeuralNetwork*) layer->network)
 #define shouldApplyDerivative(network) (network->loss != PSCrossEntropyLoss)
 
+/* Layer tensors are 64-byte aligned and every row is padded to a whole
+ * number of cache lines, so that each neuron's weights start on an aligned
+ * boundary and SIMD kernels can always load full vectors. */
+#define PS_TENSOR_ALIGNMENT 64
+#define PS_TENSOR_PADDING   ((int) (PS_TENSOR_ALIGNMENT / sizeof(ps_real)))
+#define getTensorStride(size) \
+    (((size) + PS_TENSOR_PADDING - 1) / PS_TENSOR_PADDING * PS_TENSOR_PADDING)
+#define getLayerWeightsRows(layer) (layer->type == Convolutional ? \
+    ((PSSharedParams*) layer->extra)->feature_count : layer->size)
+
+/* Maximum number of samples fed through the network at once by the batch
+ * feedforward functions. */
+#define PS_BATCH_CHUNK_SIZE 64
+
 #ifdef USE_AVX
 
 #define AVXDotProduct(size, x, y, res, i, is_recurrent, t) do { \
@@ -35,9 +49,9 @@
     avx_dot_product dot_product = AVXGetDotProductFunc(size); \
     int avx_steps = size / avx_step_len, avx_step; \
     for (avx_step = 0; avx_step < avx_steps; avx_step++) { \
-        double * x_vector = x + i; \
+        ps_real * x_vector = x + i; \
         if (is_recurrent) x_vector += (t * size); \
-        double * y_vector = y + i; \
+        ps_real * y_vector = y + i; \
         res += dot_product(x_vector, y_vector); \
         i += avx_step_len; \
     } \
@@ -49,7 +63,7 @@
     avx_dot_product dot_product = AVXGetDotProductFunc(size); \
     int avx_steps = size / avx_step_len, avx_step; \
     for (avx_step = 0; avx_step < avx_steps; avx_step++) { \
-        double * x_vector = x + i; \
+        ps_real * x_vector = x + i; \
         if (is_recurrent) x_vector += (t * size); \
         res += dot_product(x_vector, x_vector); \
         i += avx_step_len; \
@@ -61,7 +75,7 @@
     int avx_steps = size / avx_step_len, avx_step; \
     avx_multiply_value multiply_val = AVXGetMultiplyValFunc(size); \
     for (avx_step = 0; avx_step < avx_steps; avx_step++) { \
-        double * x_vector = x + i; \
+        ps_real * x_vector = x + i; \
         if (is_recurrent) x_vector += (t * size); \
         multiply_val(x_vector, val, dest + i, mode); \
         i += avx_step_len; \
@@ -73,9 +87,9 @@
     int avx_steps = size / avx_step_len, avx_step; \
     avx_multiply_value multiply_val = AVXGetMultiplyValFunc(size); \
     for (avx_step = 0; avx_step < avx_steps; avx_step++) { \
-        double * xv1 = x1 + i; \
-        double * xv2 = x2 + i; \
-        double * dd = d + i; \
+        ps_real * xv1 = x1 + i; \
+        ps_real * xv2 = x2 + i; \
+        ps_real * dd = d + i; \
         if (is_rec) {\
             xv1 += (t * size); \
             xv2 += (t * size); \
@@ -131,22 +145,40 @@ void PSErr(const char* tag, char* fmt, ...);
 
 /* Activation Functions */
 
-double sigmoid(double val);
+ps_real sigmoid(ps_real val);
+
+ps_real sigmoid_derivative(ps_real val);
 
-double sigmoid_derivative(double val);
+ps_real relu(ps_real val);
 
-double relu(double val);
+ps_real relu_derivative(ps_real val);
 
-double relu_derivative(double val);
+ps_real tanh_derivative(ps_real val);
 
-double tanh_derivative(double val);
+#ifdef PS_USE_FLOAT
+#define ps_tanh tanhf
+#else
+#define ps_tanh tanh
+#endif
 
 /* Network Functions */
 
 void PSAbortLayer(PSNeuralNetwork * network, PSLayer * layer);
+int PSInitLayerTensors(PSLayer * layer, int rows, int weights_size);
+/* Same as PSInitLayerTensors, but weights rows aren't padded, so that the
+ * weights matrix can also be read as a matrix with a multiple of its rows
+ * (ie. the LSTM gates of every cell, see lstm.h). */
+int PSInitPackedLayerTensors(PSLayer * layer, int rows, int weights_size);
+
+/* Memory */
+
+ps_real * PSCreateTensor(int size);
 
 /* Misc */
 
+/* Parses a decimal number like strtod (leading blanks are skipped), but
+ * faster for the numbers written by PSSaveNetwork. */
+double PSParseReal(const char * str, char ** end);
 
 double normalized_random();
 